@@ -52,6 +52,7 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
@@ -60,6 +61,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -556,11 +558,74 @@ class SetupTargetLayer
 
 class LayerTranslator
 {
+    /** State of the geometry processing stage that cannot be shared between
+     * threads. */
+    struct GeomProcessingContext
+    {
+        std::vector<std::unique_ptr<OGRCoordinateTransformation>>
+            apoClonedCT{};
+        bool bUseClonedCT = false;
+        OGRGeometryFactory::TransformWithOptionsCache
+            oTransformWithOptionsCache{};
+        bool bWarnedClipSrcSRS = false;
+        std::unique_ptr<OGRGeometry> poClipSrcReprojectedToSrcSRS{};
+        const OGRSpatialReference *poClipSrcReprojectedToSrcSRS_SRS = nullptr;
+        bool bWarnedClipDstSRS = false;
+        std::unique_ptr<OGRGeometry> poClipDstReprojectedToDstSRS{};
+        const OGRSpatialReference *poClipDstReprojectedToDstSRS_SRS = nullptr;
+    };
+
+    enum class PendingFeatureStatus
+    {
+        OK,
+        SKIP,
+        TRANSLATION_FAILED,
+    };
+
+    /** Destination feature prepared from a source feature (or from a part
+     * of it when exploding collections), waiting for its geometries to be
+     * processed and for being written. */
+    struct PendingFeature
+    {
+        std::unique_ptr<OGRFeature> poDstFeature{};
+        std::unique_ptr<OGRGeometry> poExplodedPart{};
+        int iGeomExplodedPart = -1;
+        bool bSetZ = false;
+        double dfZ = 0;
+        GIntBig nSrcFID = OGRNullFID;
+        GIntBig nDesiredFID = OGRNullFID;
+        bool bLastPart = true;
+        PendingFeatureStatus eStatus = PendingFeatureStatus::OK;
+        int nReprojectionFailures = 0;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        // Geometry fields already reprojected by ReprojectInBatch()
+        std::vector<bool> abGeomReprojected{};
+    };
+
+    struct GeomProcessingJob
+    {
+        LayerTranslator *poTranslator = nullptr;
+        GeomProcessingContext *poCtxt = nullptr;
+        TargetLayerInfo *psInfo = nullptr;
+        const OGRFeatureDefn *poDstFDefn = nullptr;
+        const char *pszSrcLayerName = nullptr;
+        const OGRSpatialReference *poOutputSRS = nullptr;
+        bool bRunSetPrecision = false;
+        const GDALVectorTranslateOptions *psOptions = nullptr;
+        bool bBatchReprojection = false;
+        PendingFeature *pasFeatures = nullptr;
+        size_t nFeatures = 0;
+    };
+
+    static void GeomProcessingJobFunc(void *pData);
+    static void ReprojectInBatch(const GeomProcessingJob &oJob);
+
     static bool TranslateArrow(const TargetLayerInfo *psInfo,
                                GIntBig nCountLayerFeatures,
                                GIntBig *pnReadFeatureCount,
                                GDALProgressFunc pfnProgress, void *pProgressArg,
-                               const GDALVectorTranslateOptions *psOptions);
+                               const GDALVectorTranslateOptions *psOptions,
+                               bool bPrefetch);
 
   public:
     GDALDataset *m_poSrcDS = nullptr;
@@ -579,17 +644,12 @@ class LayerTranslator
     GeomOperation m_eGeomOp = GEOMOP_NONE;
     double m_dfGeomOpParam = 0;
     OGRGeometry *m_poClipSrcOri = nullptr;
-    bool m_bWarnedClipSrcSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS;
-    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
     OGRGeometry *m_poClipDstOri = nullptr;
-    bool m_bWarnedClipDstSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS;
-    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
     bool m_bExplodeCollections = false;
     bool m_bNativeData = false;
     GIntBig m_nLimit = -1;
-    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache;
+    int m_nNumThreads = 1;
+    GeomProcessingContext m_oGeomCtxt{};
 
     bool Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
                    GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
@@ -598,8 +658,17 @@ class LayerTranslator
                    const GDALVectorTranslateOptions *psOptions);
 
   private:
-    const OGRGeometry *GetDstClipGeom(const OGRSpatialReference *poGeomSRS);
-    const OGRGeometry *GetSrcClipGeom(const OGRSpatialReference *poGeomSRS);
+    bool
+    HasGeometryProcessing(const GDALVectorTranslateOptions *psOptions) const;
+
+    void ProcessGeometries(GeomProcessingContext &oCtxt,
+                           const GeomProcessingJob &oJob,
+                           PendingFeature &oFeature);
+
+    const OGRGeometry *GetDstClipGeom(GeomProcessingContext &oCtxt,
+                                      const OGRSpatialReference *poGeomSRS);
+    const OGRGeometry *GetSrcClipGeom(GeomProcessingContext &oCtxt,
+                                      const OGRSpatialReference *poGeomSRS);
 };
 
 static OGRLayer *GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -2885,15 +2954,17 @@ GDALDatasetH GDALVectorTranslate(const char *pszDest, GDALDatasetH hDstDS,
     oTranslator.m_dfGeomOpParam = psOptions->dfGeomOpParam;
     // Do not emit warning if the user specified directly the clip source geom
     if (psOptions->osClipSrcDS.empty())
-        oTranslator.m_bWarnedClipSrcSRS = true;
+        oTranslator.m_oGeomCtxt.bWarnedClipSrcSRS = true;
     oTranslator.m_poClipSrcOri = psOptions->poClipSrc.get();
     // Do not emit warning if the user specified directly the clip dest geom
     if (psOptions->osClipDstDS.empty())
-        oTranslator.m_bWarnedClipDstSRS = true;
+        oTranslator.m_oGeomCtxt.bWarnedClipDstSRS = true;
     oTranslator.m_poClipDstOri = psOptions->poClipDst.get();
     oTranslator.m_bExplodeCollections = psOptions->bExplodeCollections;
     oTranslator.m_bNativeData = psOptions->bNativeData;
     oTranslator.m_nLimit = psOptions->nLimit;
+    oTranslator.m_nNumThreads =
+        CPLParseNumThreads(CPLGetConfigOption("GDAL_NUM_THREADS", nullptr), 1);
 
     if (psOptions->nGroupTransactions)
     {
@@ -5626,7 +5697,8 @@ SetupCT(TargetLayerInfo *psInfo, OGRLayer *poSrcLayer, bool bTransform,
 bool LayerTranslator::TranslateArrow(
     const TargetLayerInfo *psInfo, GIntBig nCountLayerFeatures,
     GIntBig *pnReadFeatureCount, GDALProgressFunc pfnProgress,
-    void *pProgressArg, const GDALVectorTranslateOptions *psOptions)
+    void *pProgressArg, const GDALVectorTranslateOptions *psOptions,
+    bool bPrefetch)
 {
     struct ArrowArrayStream stream;
     struct ArrowSchema schema;
@@ -5676,13 +5748,59 @@ bool LayerTranslator::TranslateArrow(
 
     bool bRet = true;
 
+    // When prefetching, the next batch is acquired by a job of the global
+    // thread pool while the current one is written.
+    struct PrefetchJob
+    {
+        struct ArrowArrayStream *poStream = nullptr;
+        struct ArrowArray sArray{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        int nRet = 0;
+
+        static void Run(void *pData)
+        {
+            auto psJob = static_cast<PrefetchJob *>(pData);
+            CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+            psJob->nRet =
+                psJob->poStream->get_next(psJob->poStream, &psJob->sArray);
+            CPLUninstallErrorHandlerAccumulator();
+        }
+    };
+
+    PrefetchJob sPrefetchJob;
+    sPrefetchJob.poStream = &stream;
+    std::unique_ptr<CPLJobQueue> poPrefetchJobQueue;
+    if (bPrefetch)
+    {
+        if (auto poThreadPool = GDALGetGlobalThreadPool(1))
+            poPrefetchJobQueue = poThreadPool->CreateJobQueue();
+    }
+    bool bPrefetchPending = false;
+
     GIntBig nCount = 0;
     bool bGoOn = true;
     while (bGoOn)
     {
         struct ArrowArray array;
         // Acquire source batch
-        if (stream.get_next(&stream, &array) != 0)
+        int nRet;
+        if (bPrefetchPending)
+        {
+            poPrefetchJobQueue->WaitCompletion();
+            bPrefetchPending = false;
+            nRet = sPrefetchJob.nRet;
+            for (const auto &oError : sPrefetchJob.aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            sPrefetchJob.aoErrors.clear();
+            array = sPrefetchJob.sArray;
+        }
+        else
+        {
+            nRet = stream.get_next(&stream, &array);
+        }
+        if (nRet != 0)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "stream.get_next() failed");
             bRet = false;
@@ -5714,6 +5832,12 @@ bool LayerTranslator::TranslateArrow(
             nCount += array.length;
         }
 
+        if (poPrefetchJobQueue && bGoOn)
+        {
+            bPrefetchPending = poPrefetchJobQueue->SubmitJob(
+                PrefetchJob::Run, &sPrefetchJob);
+        }
+
         // Write batch to target layer
         if (!psInfo->m_poDstLayer->WriteArrowBatch(
                 &schema, &array, aosOptionsWriteArrowBatch.List()))
@@ -5745,6 +5869,13 @@ bool LayerTranslator::TranslateArrow(
             *pnReadFeatureCount = nCount;
     }
 
+    if (bPrefetchPending)
+    {
+        poPrefetchJobQueue->WaitCompletion();
+        if (sPrefetchJob.nRet == 0 && sPrefetchJob.sArray.release)
+            sPrefetchJob.sArray.release(&sPrefetchJob.sArray);
+    }
+
     schema.release(&schema);
 
     // Ugly hack to work around https://github.com/OSGeo/gdal/issues/9497
@@ -5791,6 +5922,120 @@ bool LayerTranslator::TranslateArrow(
     return bRet;
 }
 
+/************************************************************************/
+/*              LayerTranslator::HasGeometryProcessing()                */
+/************************************************************************/
+
+bool LayerTranslator::HasGeometryProcessing(
+    const GDALVectorTranslateOptions *psOptions) const
+{
+    return m_bTransform || m_bWrapDateline || m_poClipSrcOri != nullptr ||
+           m_poClipDstOri != nullptr || m_eGeomOp != GEOMOP_NONE ||
+           m_bMakeValid || m_eGeomTypeConversion != GTC_DEFAULT ||
+           m_eGType != GEOMTYPE_UNCHANGED ||
+           psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN;
+}
+
+/************************************************************************/
+/*              LayerTranslator::GeomProcessingJobFunc()                */
+/************************************************************************/
+
+void LayerTranslator::GeomProcessingJobFunc(void *pData)
+{
+    const GeomProcessingJob *psJob = static_cast<GeomProcessingJob *>(pData);
+    if (psJob->bBatchReprojection)
+        ReprojectInBatch(*psJob);
+    for (size_t i = 0; i < psJob->nFeatures; ++i)
+    {
+        PendingFeature &oFeature = psJob->pasFeatures[i];
+        if (oFeature.eStatus != PendingFeatureStatus::OK)
+            continue;
+
+        // Errors are emitted later by the writing thread, so that they
+        // appear in the order of the features.
+        CPLInstallErrorHandlerAccumulator(oFeature.aoErrors);
+        psJob->poTranslator->ProcessGeometries(*(psJob->poCtxt), *psJob,
+                                               oFeature);
+        CPLUninstallErrorHandlerAccumulator();
+    }
+}
+
+/************************************************************************/
+/*                  LayerTranslator::ReprojectInBatch()                 */
+/************************************************************************/
+
+/** Reproject the geometries of the features of a job with a single
+ * coordinate transformation call per geometry field.
+ *
+ * Only used when no geometry operation must happen before reprojection.
+ * Geometries that need the special processing of transformWithOptions(),
+ * or that failed to be reprojected, are left untouched, and reprojected by
+ * ProcessGeometries() as usual.
+ */
+void LayerTranslator::ReprojectInBatch(const GeomProcessingJob &oJob)
+{
+    const int nDstGeomFieldCount = oJob.poDstFDefn->GetGeomFieldCount();
+    std::vector<OGRGeometry *> apoGeoms;
+    std::vector<PendingFeature *> apoFeatures;
+    for (int iGeom = 0; iGeom < nDstGeomFieldCount; ++iGeom)
+    {
+        const auto &oReprojInfo = oJob.psInfo->m_aoReprojectionInfo[iGeom];
+        OGRCoordinateTransformation *const poCT =
+            oJob.poCtxt->bUseClonedCT ? oJob.poCtxt->apoClonedCT[iGeom].get()
+                                      : oReprojInfo.m_poCT.get();
+        if (poCT == nullptr || !oReprojInfo.m_aosTransformOptions.empty())
+            continue;
+
+        // Reprojection from a projected CRS to a geographic one may need
+        // cutting geometries along the antimeridian.
+        const auto poSourceCRS = poCT->GetSourceCS();
+        const auto poTargetCRS = poCT->GetTargetCS();
+        if (OGRGeometryFactory::haveGEOS() && poSourceCRS && poTargetCRS &&
+            poSourceCRS->IsProjected() && poTargetCRS->IsGeographic())
+        {
+            continue;
+        }
+
+        apoGeoms.clear();
+        apoFeatures.clear();
+        for (size_t i = 0; i < oJob.nFeatures; ++i)
+        {
+            PendingFeature &oFeature = oJob.pasFeatures[i];
+            if (oFeature.eStatus != PendingFeatureStatus::OK)
+                continue;
+            OGRGeometry *poGeom =
+                oFeature.poExplodedPart && iGeom == oFeature.iGeomExplodedPart
+                    ? oFeature.poExplodedPart.get()
+                    : oFeature.poDstFeature->GetGeomFieldRef(iGeom);
+            if (poGeom == nullptr ||
+                (oReprojInfo.m_bCanInvalidateValidity &&
+                 poGeom->hasCurveGeometry(TRUE)))
+            {
+                continue;
+            }
+            apoGeoms.push_back(poGeom);
+            apoFeatures.push_back(&oFeature);
+        }
+        if (apoGeoms.empty())
+            continue;
+
+        std::vector<OGRErr> aeErrors(apoGeoms.size());
+        OGRGeometryFactory::transformGeometries(
+            poCT, static_cast<int>(apoGeoms.size()), apoGeoms.data(),
+            aeErrors.data(), /* nThreads = */ 1,
+            /* bFallbackOnFailure = */ false);
+        for (size_t i = 0; i < apoGeoms.size(); ++i)
+        {
+            if (aeErrors[i] == OGRERR_NONE)
+            {
+                auto &abGeomReprojected = apoFeatures[i]->abGeomReprojected;
+                abGeomReprojected.resize(nDstGeomFieldCount);
+                abGeomReprojected[iGeom] = true;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                     LayerTranslator::Translate()                     */
 /************************************************************************/
@@ -5804,10 +6049,10 @@ bool LayerTranslator::Translate(
     if (psInfo->m_bUseWriteArrowBatch)
     {
         return TranslateArrow(psInfo, nCountLayerFeatures, pnReadFeatureCount,
-                              pfnProgress, pProgressArg, psOptions);
+                              pfnProgress, pProgressArg, psOptions,
+                              m_nNumThreads > 1 && m_poSrcDS != m_poODS);
     }
 
-    const int eGType = m_eGType;
     const OGRSpatialReference *poOutputSRS = m_poOutputSRS;
 
     OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
@@ -5853,12 +6098,19 @@ bool LayerTranslator::Translate(
     }
 
     std::unique_ptr<OGRFeature> poFeature;
-    std::unique_ptr<OGRFeature> poDstFeature(new OGRFeature(poDstFDefn));
     int nFeaturesInTransaction = 0;
     GIntBig nCount = 0; /* written + failed */
     GIntBig nFeaturesWritten = 0;
-    bool bRunSetPrecisionEvaluated = false;
-    bool bRunSetPrecision = false;
+
+    // OGR_APPLY_GEOM_SET_PRECISION default value for
+    // OGRLayer::CreateFeature() purposes, but here in the
+    // ogr2ogr -xyRes context, we force calling SetPrecision(),
+    // unless the user explicitly asks not to do it by
+    // setting the config option to NO.
+    const bool bRunSetPrecision =
+        psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "YES"));
 
     bool bRet = true;
     CPLErrorReset();
@@ -5872,731 +6124,1033 @@ bool LayerTranslator::Translate(
                              poOutputSRS, m_poGCPCoordTrans, false);
     }
 
-    while (true)
+    // When several threads are allowed, the processing of geometries
+    // (reprojection, clipping, etc.) is dispatched to worker threads, while
+    // the current thread reads features and writes them in their original
+    // order. Two batches are in flight: one being processed by the workers,
+    // and the other one being written and then refilled.
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    if (m_nNumThreads > 1 && poFeatureIn == nullptr &&
+        psOptions->nFIDToFetch == OGRNullFID && !psInfo->m_bPerFeatureCT &&
+        nDstGeomFieldCount > 0 && HasGeometryProcessing(psOptions))
+    {
+        poThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+    }
+    const int nThreads = poThreadPool ? m_nNumThreads : 1;
+
+    // Geometries can be reprojected with a single coordinate transformation
+    // call per batch when no geometry operation must happen before.
+    const bool bBatchReprojection =
+        (m_bTransform || m_poGCPCoordTrans != nullptr) &&
+        poFeatureIn == nullptr && psOptions->nFIDToFetch == OGRNullFID &&
+        !psInfo->m_bPerFeatureCT && nDstGeomFieldCount > 0 &&
+        m_eGeomOp == GEOMOP_NONE && m_poClipSrcOri == nullptr &&
+        m_nCoordDim == COORD_DIM_UNCHANGED && psInfo->m_iSrcZField == -1;
+
+    size_t nMaxBatchSize = 1;
+    if (poThreadPool)
+        nMaxBatchSize = static_cast<size_t>(256) * nThreads;
+    else if (bBatchReprojection && m_poSrcDS != m_poODS)
+        nMaxBatchSize = 256;
+    std::vector<PendingFeature> aoBatches[2];
+    size_t anBatchSize[2] = {0, 0};
+    std::vector<GeomProcessingJob> aoJobs[2];
+    std::unique_ptr<CPLJobQueue> apoJobQueues[2];
+    std::vector<std::unique_ptr<GeomProcessingContext>> apoThreadCtxts;
+    bool bProcessInCurrentThread = poThreadPool == nullptr;
+    if (poThreadPool)
+    {
+        apoJobQueues[0] = poThreadPool->CreateJobQueue();
+        apoJobQueues[1] = poThreadPool->CreateJobQueue();
+    }
+
+    GeomProcessingJob oJobTemplate;
+    oJobTemplate.poTranslator = this;
+    oJobTemplate.psInfo = psInfo;
+    oJobTemplate.poDstFDefn = poDstFDefn;
+    oJobTemplate.pszSrcLayerName = poSrcLayer->GetName();
+    oJobTemplate.poOutputSRS = poOutputSRS;
+    oJobTemplate.bRunSetPrecision = bRunSetPrecision;
+    oJobTemplate.psOptions = psOptions;
+    oJobTemplate.bBatchReprojection = bBatchReprojection;
+
+    bool bStopReading = false;
+    bool bSetupCTFailed = false;
+
+    /* -------------------------------------------------------------------- */
+    /*      Read source features and prepare target features, up to the    */
+    /*      batch size.                                                     */
+    /* -------------------------------------------------------------------- */
+    const auto ReadBatch = [&](int iBatch)
     {
-        if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+        auto &aoBatch = aoBatches[iBatch];
+        size_t &nBatchSize = anBatchSize[iBatch];
+        nBatchSize = 0;
+        while (!bStopReading && nBatchSize < nMaxBatchSize)
         {
-            break;
-        }
+            if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+            {
+                bStopReading = true;
+                break;
+            }
 
-        if (poFeatureIn != nullptr)
-            poFeature.reset(poFeatureIn);
-        else if (psOptions->nFIDToFetch != OGRNullFID)
-            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
-        else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+            // Errors re-emitted when writing the previous batch must not be
+            // mistaken for a read error.
+            if (nMaxBatchSize > 1)
+                CPLErrorReset();
 
-        if (poFeature == nullptr)
-        {
-            if (CPLGetLastErrorType() == CE_Failure)
+            if (poFeatureIn != nullptr)
+                poFeature.reset(poFeatureIn);
+            else if (psOptions->nFIDToFetch != OGRNullFID)
+                poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+            else
             {
-                bRet = false;
+                // Let the driver recycle the previous source feature when
+                // it has not been moved to the target layer.
+                OGRFeatureUniquePtr poRecycled(poFeature.release());
+                poSrcLayer->GetNextFeatureInto(poRecycled);
+                poFeature.reset(poRecycled.release());
             }
-            break;
-        }
 
-        if (!bSetupCTOK &&
-            (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
-        {
-            if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
-                         m_osDateLineOffset, m_poUserSourceSRS, poFeature.get(),
-                         poOutputSRS, m_poGCPCoordTrans, true))
+            if (poFeatureIn != nullptr ||
+                psOptions->nFIDToFetch != OGRNullFID)
             {
-                return false;
+                bStopReading = true;
             }
-        }
-
-        psInfo->m_nFeaturesRead++;
 
-        int nIters = 1;
-        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
-        int iGeomCollToExplode = -1;
-        if (bExplodeCollections)
-        {
-            OGRGeometry *poSrcGeometry;
-            if (iRequestedSrcGeomField >= 0)
-                poSrcGeometry =
-                    poFeature->GetGeomFieldRef(iRequestedSrcGeomField);
-            else
-                poSrcGeometry = poFeature->GetGeometryRef();
-            if (poSrcGeometry &&
-                OGR_GT_IsSubClassOf(poSrcGeometry->getGeometryType(),
-                                    wkbGeometryCollection))
+            if (poFeature == nullptr)
             {
-                const int nParts =
-                    poSrcGeometry->toGeometryCollection()->getNumGeometries();
-                if (nParts > 0)
+                if (CPLGetLastErrorType() == CE_Failure)
                 {
-                    iGeomCollToExplode = iRequestedSrcGeomField >= 0
-                                             ? iRequestedSrcGeomField
-                                             : 0;
-                    poCollToExplode.reset(
-                        poFeature->StealGeometry(iGeomCollToExplode)
-                            ->toGeometryCollection());
-                    nIters = nParts;
+                    bRet = false;
                 }
+                bStopReading = true;
+                break;
             }
-        }
-
-        const GIntBig nSrcFID = poFeature->GetFID();
-        GIntBig nDesiredFID = OGRNullFID;
-        if (bPreserveFID)
-            nDesiredFID = nSrcFID;
-        else if (psInfo->m_iSrcFIDField >= 0 &&
-                 poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
-            nDesiredFID =
-                poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
 
-        for (int iPart = 0; iPart < nIters; iPart++)
-        {
-            if (psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+            if (!bSetupCTOK &&
+                (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
             {
-                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
-                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
+                if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                             m_osDateLineOffset, m_poUserSourceSRS,
+                             poFeature.get(), poOutputSRS, m_poGCPCoordTrans,
+                             true))
                 {
-                    return false;
+                    bSetupCTFailed = true;
+                    bStopReading = true;
+                    break;
                 }
-                nFeaturesInTransaction = 0;
             }
-            else if (!psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions > 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
+
+            psInfo->m_nFeaturesRead++;
+
+            int nIters = 1;
+            std::unique_ptr<OGRGeometryCollection> poCollToExplode;
+            int iGeomCollToExplode = -1;
+            if (bExplodeCollections)
             {
-                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
-                        OGRERR_FAILURE)
-                {
-                    return false;
+                OGRGeometry *poSrcGeometry;
+                if (iRequestedSrcGeomField >= 0)
+                    poSrcGeometry =
+                        poFeature->GetGeomFieldRef(iRequestedSrcGeomField);
+                else
+                    poSrcGeometry = poFeature->GetGeometryRef();
+                if (poSrcGeometry &&
+                    OGR_GT_IsSubClassOf(poSrcGeometry->getGeometryType(),
+                                        wkbGeometryCollection))
+                {
+                    const int nParts = poSrcGeometry->toGeometryCollection()
+                                           ->getNumGeometries();
+                    if (nParts > 0)
+                    {
+                        iGeomCollToExplode = iRequestedSrcGeomField >= 0
+                                                 ? iRequestedSrcGeomField
+                                                 : 0;
+                        poCollToExplode.reset(
+                            poFeature->StealGeometry(iGeomCollToExplode)
+                                ->toGeometryCollection());
+                        nIters = nParts;
+                    }
                 }
-                nTotalEventsDone = 0;
             }
 
-            CPLErrorReset();
-            if (psInfo->m_bCanAvoidSetFrom)
-            {
-                poDstFeature = std::move(poFeature);
-                // From now on, poFeature is null !
-                poDstFeature->SetFDefnUnsafe(poDstFDefn);
-                poDstFeature->SetFID(nDesiredFID);
-            }
-            else
-            {
-                /* Optimization to avoid duplicating the source geometry in the
-                 */
-                /* target feature : we steal it from the source feature for
-                 * now... */
-                std::unique_ptr<OGRGeometry> poStolenGeometry;
-                if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
-                    (nDstGeomFieldCount == 1 ||
-                     (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
-                {
-                    poStolenGeometry.reset(poFeature->StealGeometry());
+            const GIntBig nSrcFID = poFeature->GetFID();
+            GIntBig nDesiredFID = OGRNullFID;
+            if (bPreserveFID)
+                nDesiredFID = nSrcFID;
+            else if (psInfo->m_iSrcFIDField >= 0 &&
+                     poFeature->IsFieldSetAndNotNull(psInfo->m_iSrcFIDField))
+                nDesiredFID =
+                    poFeature->GetFieldAsInteger64(psInfo->m_iSrcFIDField);
+
+            // poFeature is never moved if iSrcZField != -1
+            const bool bSetZ = iSrcZField != -1;
+            const double dfZ =
+                bSetZ ? poFeature->GetFieldAsDouble(iSrcZField) : 0.0;
+
+            for (int iPart = 0; iPart < nIters; iPart++)
+            {
+                if (nBatchSize == aoBatch.size())
+                    aoBatch.emplace_back();
+                PendingFeature &oPending = aoBatch[nBatchSize++];
+                oPending.iGeomExplodedPart = iGeomCollToExplode;
+                oPending.bSetZ = bSetZ;
+                oPending.dfZ = dfZ;
+                oPending.nSrcFID = nSrcFID;
+                oPending.nDesiredFID = nDesiredFID;
+                oPending.bLastPart = iPart + 1 == nIters;
+                oPending.eStatus = PendingFeatureStatus::OK;
+                oPending.nReprojectionFailures = 0;
+                oPending.aoErrors.clear();
+                oPending.abGeomReprojected.clear();
+                oPending.poExplodedPart.reset();
+                if (poCollToExplode)
+                {
+                    oPending.poExplodedPart.reset(
+                        poCollToExplode->getGeometryRef(0));
+                    poCollToExplode->removeGeometry(0, FALSE);
                 }
-                else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
+
+                auto &poDstFeature = oPending.poDstFeature;
+                if (!poDstFeature)
+                    poDstFeature = std::make_unique<OGRFeature>(poDstFDefn);
+
+                CPLErrorReset();
+                if (psInfo->m_bCanAvoidSetFrom)
                 {
-                    poStolenGeometry.reset(
-                        poFeature->StealGeometry(iRequestedSrcGeomField));
+                    poDstFeature = std::move(poFeature);
+                    // From now on, poFeature is null !
+                    poDstFeature->SetFDefnUnsafe(poDstFDefn);
+                    poDstFeature->SetFID(nDesiredFID);
                 }
-
-                if (nDstGeomFieldCount == 0 && poStolenGeometry &&
-                    m_poClipSrcOri)
+                else
                 {
-                    const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poStolenGeometry->getSpatialReference());
+                    /* Optimization to avoid duplicating the source geometry */
+                    /* in the target feature : we steal it from the source */
+                    /* feature for now... */
+                    std::unique_ptr<OGRGeometry> poStolenGeometry;
+                    if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
+                        (nDstGeomFieldCount == 1 ||
+                         (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
+                    {
+                        poStolenGeometry.reset(poFeature->StealGeometry());
+                    }
+                    else if (!bExplodeCollections &&
+                             iRequestedSrcGeomField >= 0)
+                    {
+                        poStolenGeometry.reset(
+                            poFeature->StealGeometry(iRequestedSrcGeomField));
+                    }
 
-                    if (poClipGeom != nullptr &&
-                        !poClipGeom->Intersects(poStolenGeometry.get()))
+                    if (nDstGeomFieldCount == 0 && poStolenGeometry &&
+                        m_poClipSrcOri)
                     {
-                        goto end_loop;
+                        const OGRGeometry *poClipGeom = GetSrcClipGeom(
+                            m_oGeomCtxt,
+                            poStolenGeometry->getSpatialReference());
+
+                        if (poClipGeom != nullptr &&
+                            !poClipGeom->Intersects(poStolenGeometry.get()))
+                        {
+                            oPending.eStatus = PendingFeatureStatus::SKIP;
+                            continue;
+                        }
                     }
-                }
 
-                poDstFeature->Reset();
-                if (poDstFeature->SetFrom(poFeature.get(), panMap, TRUE) !=
-                    OGRERR_NONE)
-                {
-                    if (psOptions->nGroupTransactions)
+                    poDstFeature->Reset();
+                    if (poDstFeature->SetFrom(poFeature.get(), panMap, TRUE) !=
+                        OGRERR_NONE)
                     {
-                        if (psOptions->nLayerTransaction)
+                        oPending.eStatus =
+                            PendingFeatureStatus::TRANSLATION_FAILED;
+                        bStopReading = true;
+                        break;
+                    }
+
+                    /* ... and now we can attach the stolen geometry */
+                    if (poStolenGeometry)
+                    {
+                        poDstFeature->SetGeometryDirectly(
+                            poStolenGeometry.release());
+                    }
+
+                    if (!psInfo->m_oMapResolved.empty())
+                    {
+                        for (const auto &kv : psInfo->m_oMapResolved)
                         {
-                            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                            const int nDstField = kv.first;
+                            const int nSrcField = kv.second.nSrcField;
+                            if (poFeature->IsFieldSetAndNotNull(nSrcField))
                             {
-                                return false;
+                                const auto poDomain = kv.second.poDomain;
+                                const auto &oMapKV =
+                                    psInfo->m_oMapDomainToKV[poDomain];
+                                const auto iter = oMapKV.find(
+                                    poFeature->GetFieldAsString(nSrcField));
+                                if (iter != oMapKV.end())
+                                {
+                                    poDstFeature->SetField(
+                                        nDstField, iter->second.c_str());
+                                }
                             }
                         }
                     }
 
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Unable to translate feature " CPL_FRMT_GIB
-                             " from layer %s.",
-                             nSrcFID, poSrcLayer->GetName());
-
-                    return false;
+                    if (nDesiredFID != OGRNullFID)
+                        poDstFeature->SetFID(nDesiredFID);
                 }
 
-                /* ... and now we can attach the stolen geometry */
-                if (poStolenGeometry)
+                if (psOptions->bEmptyStrAsNull)
                 {
-                    poDstFeature->SetGeometryDirectly(
-                        poStolenGeometry.release());
+                    for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
+                    {
+                        if (!poDstFeature->IsFieldSetAndNotNull(i))
+                            continue;
+                        auto fieldDef = poDstFeature->GetFieldDefnRef(i);
+                        if (fieldDef->GetType() != OGRFieldType::OFTString)
+                            continue;
+                        auto str = poDstFeature->GetFieldAsString(i);
+                        if (strcmp(str, "") == 0)
+                            poDstFeature->SetFieldNull(i);
+                    }
                 }
 
-                if (!psInfo->m_oMapResolved.empty())
+                if (!psInfo->m_anDateTimeFieldIdx.empty())
                 {
-                    for (const auto &kv : psInfo->m_oMapResolved)
+                    for (int i : psInfo->m_anDateTimeFieldIdx)
                     {
-                        const int nDstField = kv.first;
-                        const int nSrcField = kv.second.nSrcField;
-                        if (poFeature->IsFieldSetAndNotNull(nSrcField))
-                        {
-                            const auto poDomain = kv.second.poDomain;
-                            const auto &oMapKV =
-                                psInfo->m_oMapDomainToKV[poDomain];
-                            const auto iter = oMapKV.find(
-                                poFeature->GetFieldAsString(nSrcField));
-                            if (iter != oMapKV.end())
-                            {
-                                poDstFeature->SetField(nDstField,
-                                                       iter->second.c_str());
-                            }
-                        }
+                        if (!poDstFeature->IsFieldSetAndNotNull(i))
+                            continue;
+                        auto psField = poDstFeature->GetRawFieldRef(i);
+                        if (psField->Date.TZFlag == 0 ||
+                            psField->Date.TZFlag == 1)
+                            continue;
+
+                        const int nTZOffsetInSec =
+                            (psField->Date.TZFlag - 100) * 15 * 60;
+                        if (nTZOffsetInSec == psOptions->nTZOffsetInSec)
+                            continue;
+
+                        struct tm brokendowntime;
+                        memset(&brokendowntime, 0, sizeof(brokendowntime));
+                        brokendowntime.tm_year = psField->Date.Year - 1900;
+                        brokendowntime.tm_mon = psField->Date.Month - 1;
+                        brokendowntime.tm_mday = psField->Date.Day;
+                        GIntBig nUnixTime =
+                            CPLYMDHMSToUnixTime(&brokendowntime);
+                        int nSec = psField->Date.Hour * 3600 +
+                                   psField->Date.Minute * 60 +
+                                   static_cast<int>(psField->Date.Second);
+                        nSec += psOptions->nTZOffsetInSec - nTZOffsetInSec;
+                        nUnixTime += nSec;
+                        CPLUnixTimeToYMDHMS(nUnixTime, &brokendowntime);
+
+                        psField->Date.Year =
+                            static_cast<GInt16>(brokendowntime.tm_year + 1900);
+                        psField->Date.Month =
+                            static_cast<GByte>(brokendowntime.tm_mon + 1);
+                        psField->Date.Day =
+                            static_cast<GByte>(brokendowntime.tm_mday);
+                        psField->Date.Hour =
+                            static_cast<GByte>(brokendowntime.tm_hour);
+                        psField->Date.Minute =
+                            static_cast<GByte>(brokendowntime.tm_min);
+                        psField->Date.Second = static_cast<float>(
+                            brokendowntime.tm_sec +
+                            fmod(psField->Date.Second, 1));
+                        psField->Date.TZFlag = static_cast<GByte>(
+                            100 + psOptions->nTZOffsetInSec / (15 * 60));
                     }
                 }
 
-                if (nDesiredFID != OGRNullFID)
-                    poDstFeature->SetFID(nDesiredFID);
-            }
-
-            if (psOptions->bEmptyStrAsNull)
-            {
-                for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
+                /* Erase native data if asked explicitly */
+                if (!m_bNativeData)
                 {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto fieldDef = poDstFeature->GetFieldDefnRef(i);
-                    if (fieldDef->GetType() != OGRFieldType::OFTString)
-                        continue;
-                    auto str = poDstFeature->GetFieldAsString(i);
-                    if (strcmp(str, "") == 0)
-                        poDstFeature->SetFieldNull(i);
+                    poDstFeature->SetNativeData(nullptr);
+                    poDstFeature->SetNativeMediaType(nullptr);
                 }
             }
+        }
+    };
 
-            if (!psInfo->m_anDateTimeFieldIdx.empty())
+    /* -------------------------------------------------------------------- */
+    /*      Process the geometries of a batch, either in the current        */
+    /*      thread, or by submitting jobs to the worker threads.            */
+    /* -------------------------------------------------------------------- */
+    const auto ProcessBatch = [&](int iBatch)
+    {
+        auto &aoBatch = aoBatches[iBatch];
+        const size_t nBatchSize = anBatchSize[iBatch];
+
+        if (!bProcessInCurrentThread && apoThreadCtxts.empty())
+        {
+            // Coordinate transformations are set up by the reading of the
+            // first feature, so contexts can only be created now.
+            for (int i = 0; i < 2 * nThreads; ++i)
             {
-                for (int i : psInfo->m_anDateTimeFieldIdx)
+                auto poCtxt = std::make_unique<GeomProcessingContext>();
+                poCtxt->bUseClonedCT = true;
+                poCtxt->bWarnedClipSrcSRS = m_oGeomCtxt.bWarnedClipSrcSRS;
+                poCtxt->bWarnedClipDstSRS = m_oGeomCtxt.bWarnedClipDstSRS;
+                for (const auto &oReprojInfo : psInfo->m_aoReprojectionInfo)
                 {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto psField = poDstFeature->GetRawFieldRef(i);
-                    if (psField->Date.TZFlag == 0 || psField->Date.TZFlag == 1)
-                        continue;
-
-                    const int nTZOffsetInSec =
-                        (psField->Date.TZFlag - 100) * 15 * 60;
-                    if (nTZOffsetInSec == psOptions->nTZOffsetInSec)
-                        continue;
-
-                    struct tm brokendowntime;
-                    memset(&brokendowntime, 0, sizeof(brokendowntime));
-                    brokendowntime.tm_year = psField->Date.Year - 1900;
-                    brokendowntime.tm_mon = psField->Date.Month - 1;
-                    brokendowntime.tm_mday = psField->Date.Day;
-                    GIntBig nUnixTime = CPLYMDHMSToUnixTime(&brokendowntime);
-                    int nSec = psField->Date.Hour * 3600 +
-                               psField->Date.Minute * 60 +
-                               static_cast<int>(psField->Date.Second);
-                    nSec += psOptions->nTZOffsetInSec - nTZOffsetInSec;
-                    nUnixTime += nSec;
-                    CPLUnixTimeToYMDHMS(nUnixTime, &brokendowntime);
-
-                    psField->Date.Year =
-                        static_cast<GInt16>(brokendowntime.tm_year + 1900);
-                    psField->Date.Month =
-                        static_cast<GByte>(brokendowntime.tm_mon + 1);
-                    psField->Date.Day =
-                        static_cast<GByte>(brokendowntime.tm_mday);
-                    psField->Date.Hour =
-                        static_cast<GByte>(brokendowntime.tm_hour);
-                    psField->Date.Minute =
-                        static_cast<GByte>(brokendowntime.tm_min);
-                    psField->Date.Second = static_cast<float>(
-                        brokendowntime.tm_sec + fmod(psField->Date.Second, 1));
-                    psField->Date.TZFlag = static_cast<GByte>(
-                        100 + psOptions->nTZOffsetInSec / (15 * 60));
+                    poCtxt->apoClonedCT.emplace_back(
+                        oReprojInfo.m_poCT ? oReprojInfo.m_poCT->Clone()
+                                           : nullptr);
+                    if (oReprojInfo.m_poCT && !poCtxt->apoClonedCT.back())
+                    {
+                        CPLDebug("OGR2OGR",
+                                 "Cannot clone coordinate transformation. "
+                                 "Processing geometries in a single thread");
+                        bProcessInCurrentThread = true;
+                        break;
+                    }
                 }
+                if (bProcessInCurrentThread)
+                    break;
+                apoThreadCtxts.push_back(std::move(poCtxt));
             }
+        }
 
-            /* Erase native data if asked explicitly */
-            if (!m_bNativeData)
+        if (bProcessInCurrentThread)
+        {
+            GeomProcessingJob oJob(oJobTemplate);
+            oJob.poCtxt = &m_oGeomCtxt;
+            if (nMaxBatchSize > 1)
             {
-                poDstFeature->SetNativeData(nullptr);
-                poDstFeature->SetNativeMediaType(nullptr);
+                // Errors are accumulated, so as to be emitted in the order
+                // of the features by WriteBatch().
+                oJob.pasFeatures = aoBatch.data();
+                oJob.nFeatures = nBatchSize;
+                GeomProcessingJobFunc(&oJob);
+                return;
             }
-
-            for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+            for (size_t i = 0; i < nBatchSize; ++i)
             {
-                std::unique_ptr<OGRGeometry> poDstGeometry;
+                if (aoBatch[i].eStatus == PendingFeatureStatus::OK)
+                    ProcessGeometries(m_oGeomCtxt, oJob, aoBatch[i]);
+            }
+            return;
+        }
 
-                if (poCollToExplode && iGeom == iGeomCollToExplode)
-                {
-                    OGRGeometry *poPart = poCollToExplode->getGeometryRef(0);
-                    poCollToExplode->removeGeometry(0, FALSE);
-                    poDstGeometry.reset(poPart);
-                }
-                else
-                {
-                    poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
-                }
-                if (poDstGeometry == nullptr)
-                    continue;
+        const size_t nJobs =
+            std::min(static_cast<size_t>(nThreads), nBatchSize);
+        const size_t nFeaturesPerJob = (nBatchSize + nJobs - 1) / nJobs;
+        auto &aoBatchJobs = aoJobs[iBatch];
+        aoBatchJobs.clear();
+        for (size_t i = 0; i < nJobs; ++i)
+        {
+            GeomProcessingJob oJob(oJobTemplate);
+            oJob.poCtxt =
+                apoThreadCtxts[static_cast<size_t>(iBatch) * nThreads + i]
+                    .get();
+            oJob.pasFeatures = aoBatch.data() + i * nFeaturesPerJob;
+            oJob.nFeatures =
+                std::min(nFeaturesPerJob, nBatchSize - i * nFeaturesPerJob);
+            aoBatchJobs.push_back(std::move(oJob));
+        }
+        for (auto &oJob : aoBatchJobs)
+        {
+            if (!apoJobQueues[iBatch]->SubmitJob(GeomProcessingJobFunc, &oJob))
+                GeomProcessingJobFunc(&oJob);
+        }
+    };
 
-                // poFeature hasn't been moved if iSrcZField != -1
-                // cppcheck-suppress accessMoved
-                if (iSrcZField != -1 && poFeature != nullptr)
-                {
-                    SetZ(poDstGeometry.get(),
-                         poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    poDstGeometry.reset(poDstGeometry->clone());
-                }
+    /* -------------------------------------------------------------------- */
+    /*      Write the features of a batch, in order.                        */
+    /* -------------------------------------------------------------------- */
+    enum class WriteStatus
+    {
+        CONTINUE,
+        STOP,
+        ABORT,
+    };
 
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
-                {
-                    poDstGeometry->setCoordinateDimension(m_nCoordDim);
-                }
-                else if (m_nCoordDim == 4)
-                {
-                    poDstGeometry->set3D(TRUE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_XYM)
+    const auto WriteBatch = [&](int iBatch)
+    {
+        auto &aoBatch = aoBatches[iBatch];
+        for (size_t iFeature = 0; iFeature < anBatchSize[iBatch]; ++iFeature)
+        {
+            PendingFeature &oPending = aoBatch[iFeature];
+            const GIntBig nSrcFID = oPending.nSrcFID;
+            const GIntBig nDesiredFID = oPending.nDesiredFID;
+
+            if (psOptions->nLayerTransaction &&
+                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
+            {
+                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
                 {
-                    poDstGeometry->set3D(FALSE);
-                    poDstGeometry->setMeasured(TRUE);
+                    return WriteStatus::ABORT;
                 }
-                else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+                nFeaturesInTransaction = 0;
+            }
+            else if (!psOptions->nLayerTransaction &&
+                     psOptions->nGroupTransactions > 0 &&
+                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
+            {
+                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
+                        OGRERR_FAILURE)
                 {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                        poDstLayer->GetLayerDefn()
-                            ->GetGeomFieldDefn(iGeom)
-                            ->GetType();
-                    poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
-                    poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+                    return WriteStatus::ABORT;
                 }
+                nTotalEventsDone = 0;
+            }
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
-                {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
-                }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+            if (oPending.eStatus == PendingFeatureStatus::TRANSLATION_FAILED)
+            {
+                if (psOptions->nGroupTransactions)
                 {
-                    if (m_dfGeomOpParam > 0)
+                    if (psOptions->nLayerTransaction)
                     {
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->SimplifyPreserveTopology(
-                                m_dfGeomOpParam));
-                        if (poNewGeom)
+                        if (poDstLayer->CommitTransaction() != OGRERR_NONE)
                         {
-                            poDstGeometry = std::move(poNewGeom);
+                            return WriteStatus::ABORT;
                         }
                     }
                 }
 
-                if (m_poClipSrcOri)
-                {
-
-                    const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poDstGeometry->getSpatialReference());
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Unable to translate feature " CPL_FRMT_GIB
+                         " from layer %s.",
+                         nSrcFID, poSrcLayer->GetName());
 
-                    std::unique_ptr<OGRGeometry> poClipped;
-                    if (poClipGeom != nullptr)
-                    {
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
+                return WriteStatus::ABORT;
+            }
 
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
+            for (const auto &oError : oPending.aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            oPending.aoErrors.clear();
 
-                        if (oClipEnv.Intersects(oDstEnv))
+            for (int i = 0; i < oPending.nReprojectionFailures; ++i)
+            {
+                if (psOptions->nGroupTransactions)
+                {
+                    if (psOptions->nLayerTransaction)
+                    {
+                        if (poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                            !psOptions->bSkipFailures)
                         {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
+                            return WriteStatus::ABORT;
                         }
                     }
+                }
 
-                    if (poClipped == nullptr || poClipped->IsEmpty())
-                    {
-                        goto end_loop;
-                    }
-
-                    const int nDim = poDstGeometry->getDimension();
-                    if (poClipped->getDimension() < nDim &&
-                        wkbFlatten(
-                            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
-                            wkbUnknown)
-                    {
-                        CPLDebug(
-                            "OGR2OGR",
-                            "Discarding feature " CPL_FRMT_GIB " of layer %s, "
-                            "as its intersection with -clipsrc is a %s "
-                            "whereas the input is a %s",
-                            nSrcFID, poSrcLayer->GetName(),
-                            OGRToOGCGeomType(poClipped->getGeometryType()),
-                            OGRToOGCGeomType(poDstGeometry->getGeometryType()));
-                        goto end_loop;
-                    }
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Failed to reproject feature " CPL_FRMT_GIB
+                         " (geometry probably out of source or "
+                         "destination SRS).",
+                         nSrcFID);
+                if (!psOptions->bSkipFailures)
+                {
+                    return WriteStatus::ABORT;
+                }
+            }
 
-                    poDstGeometry = std::move(poClipped);
-                }
-
-                OGRCoordinateTransformation *const poCT =
-                    psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
-                char **const papszTransformOptions =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_aosTransformOptions.List();
-                const bool bReprojCanInvalidateValidity =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_bCanInvalidateValidity;
-
-                if (poCT != nullptr || papszTransformOptions != nullptr)
-                {
-                    // If we need to change the geometry type to linear, and
-                    // we have a geometry with curves, then convert it to
-                    // linear first, to avoid invalidities due to the fact
-                    // that validity of arc portions isn't always kept while
-                    // reprojecting and then discretizing.
-                    if (bReprojCanInvalidateValidity &&
-                        (!psInfo->m_bSupportCurves ||
-                         m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                         m_eGeomTypeConversion ==
-                             GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
+            if (oPending.eStatus == PendingFeatureStatus::OK)
+            {
+                OGRFeature *poDstFeature = oPending.poDstFeature.get();
+                CPLErrorReset();
+                if ((psOptions->bUpsert
+                         ? poDstLayer->UpsertFeature(poDstFeature)
+                         : poDstLayer->CreateFeature(poDstFeature)) ==
+                    OGRERR_NONE)
+                {
+                    nFeaturesWritten++;
+                    if (nDesiredFID != OGRNullFID &&
+                        poDstFeature->GetFID() != nDesiredFID)
                     {
-                        if (poDstGeometry->hasCurveGeometry(TRUE))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                poDstGeometry.release(), eTargetType));
-                        }
+                        CPLError(CE_Warning, CPLE_AppDefined,
+                                 "Feature id " CPL_FRMT_GIB " not preserved",
+                                 nDesiredFID);
                     }
-                    else if (bReprojCanInvalidateValidity &&
-                             eGType != GEOMTYPE_UNCHANGED &&
-                             !OGR_GT_IsNonLinear(
-                                 static_cast<OGRwkbGeometryType>(eGType)) &&
-                             poDstGeometry->hasCurveGeometry(TRUE))
+                }
+                else if (!psOptions->bSkipFailures)
+                {
+                    if (psOptions->nGroupTransactions)
                     {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
+                        if (psOptions->nLayerTransaction)
+                            poDstLayer->RollbackTransaction();
                     }
 
-                    for (int iIter = 0; iIter < 2; ++iIter)
-                    {
-                        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
-                            OGRGeometryFactory::transformWithOptions(
-                                poDstGeometry.get(), poCT,
-                                papszTransformOptions,
-                                m_transformWithOptionsCache));
-                        if (poReprojectedGeom == nullptr)
-                        {
-                            if (psOptions->nGroupTransactions)
-                            {
-                                if (psOptions->nLayerTransaction)
-                                {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
-                                }
-                            }
-
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Failed to reproject feature " CPL_FRMT_GIB
-                                     " (geometry probably out of source or "
-                                     "destination SRS).",
-                                     nSrcFID);
-                            if (!psOptions->bSkipFailures)
-                            {
-                                return false;
-                            }
-                        }
-
-                        // Check if a curve geometry is no longer valid after
-                        // reprojection
-                        const auto eType = poDstGeometry->getGeometryType();
-                        const auto eFlatType = wkbFlatten(eType);
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Unable to write feature " CPL_FRMT_GIB
+                             " from layer %s.",
+                             nSrcFID, poSrcLayer->GetName());
 
-                        const auto IsValid = [](const OGRGeometry *poGeom)
-                        {
-                            CPLErrorHandlerPusher oErrorHandler(
-                                CPLQuietErrorHandler);
-                            return poGeom->IsValid();
-                        };
-
-                        if (iIter == 0 && bReprojCanInvalidateValidity &&
-                            OGRGeometryFactory::haveGEOS() &&
-                            (eFlatType == wkbCurvePolygon ||
-                             eFlatType == wkbCompoundCurve ||
-                             eFlatType == wkbMultiCurve ||
-                             eFlatType == wkbMultiSurface) &&
-                            poDstGeometry->hasCurveGeometry(TRUE) &&
-                            IsValid(poDstGeometry.get()))
+                    return WriteStatus::ABORT;
+                }
+                else
+                {
+                    CPLDebug("GDALVectorTranslate",
+                             "Unable to write feature " CPL_FRMT_GIB
+                             " into layer %s.",
+                             nSrcFID, poSrcLayer->GetName());
+                    if (psOptions->nGroupTransactions)
+                    {
+                        if (psOptions->nLayerTransaction)
                         {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            auto poDstGeometryTmp =
-                                std::unique_ptr<OGRGeometry>(
-                                    OGRGeometryFactory::forceTo(
-                                        poReprojectedGeom->clone(),
-                                        eTargetType));
-                            if (!IsValid(poDstGeometryTmp.get()))
-                            {
-                                CPLDebug("OGR2OGR",
-                                         "Curve geometry no longer valid after "
-                                         "reprojection: transforming it into "
-                                         "linear one before reprojecting");
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eTargetType));
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eType));
-                            }
-                            else
-                            {
-                                poDstGeometry = std::move(poReprojectedGeom);
-                                break;
-                            }
+                            poDstLayer->RollbackTransaction();
+                            CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
                         }
                         else
                         {
-                            poDstGeometry = std::move(poReprojectedGeom);
-                            break;
+                            m_poODS->RollbackTransaction();
+                            m_poODS->StartTransaction(
+                                psOptions->bForceTransaction);
                         }
                     }
                 }
-                else if (poOutputSRS != nullptr)
-                {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
-                }
+            }
 
-                if (poDstGeometry != nullptr)
-                {
-                    if (m_poClipDstOri)
-                    {
-                        const OGRGeometry *poClipGeom = GetDstClipGeom(
-                            poDstGeometry->getSpatialReference());
-                        if (poClipGeom == nullptr)
-                        {
-                            goto end_loop;
-                        }
+            if (!oPending.bLastPart)
+                continue;
 
-                        std::unique_ptr<OGRGeometry> poClipped;
+            /* Report progress */
+            nCount++;
+            bool bGoOn = true;
+            if (pfnProgress)
+            {
+                bGoOn = pfnProgress(nCountLayerFeatures
+                                        ? nCount * 1.0 / nCountLayerFeatures
+                                        : 1.0,
+                                    "", pProgressArg) != FALSE;
+            }
+            if (!bGoOn)
+            {
+                return WriteStatus::STOP;
+            }
 
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
+            if (pnReadFeatureCount)
+                *pnReadFeatureCount = nCount;
+        }
+        return WriteStatus::CONTINUE;
+    };
 
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
+    WriteStatus eWriteStatus = WriteStatus::CONTINUE;
+    if (!poThreadPool)
+    {
+        while (!bStopReading)
+        {
+            ReadBatch(0);
+            if (bSetupCTFailed)
+                return false;
+            ProcessBatch(0);
+            eWriteStatus = WriteBatch(0);
+            if (eWriteStatus != WriteStatus::CONTINUE)
+                break;
+        }
+    }
+    else
+    {
+        int iCurBatch = 0;
+        bool bPrevBatchPending = false;
+        while (true)
+        {
+            ReadBatch(iCurBatch);
+            if (bSetupCTFailed)
+                break;
+            if (anBatchSize[iCurBatch] > 0)
+                ProcessBatch(iCurBatch);
+            if (bPrevBatchPending)
+            {
+                apoJobQueues[1 - iCurBatch]->WaitCompletion();
+                eWriteStatus = WriteBatch(1 - iCurBatch);
+                if (eWriteStatus != WriteStatus::CONTINUE)
+                    break;
+            }
+            bPrevBatchPending = anBatchSize[iCurBatch] > 0;
+            if (!bPrevBatchPending)
+                break;
+            iCurBatch = 1 - iCurBatch;
+        }
+        apoJobQueues[0]->WaitCompletion();
+        apoJobQueues[1]->WaitCompletion();
+        if (bSetupCTFailed)
+            return false;
+    }
 
-                        if (oClipEnv.Intersects(oDstEnv))
-                        {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
-                        }
+    if (eWriteStatus == WriteStatus::ABORT)
+        return false;
+    if (eWriteStatus == WriteStatus::STOP)
+        bRet = false;
 
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            goto end_loop;
-                        }
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                bRet = false;
+        }
+    }
 
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                           ->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug(
-                                "OGR2OGR",
-                                "Discarding feature " CPL_FRMT_GIB
-                                " of layer %s, "
-                                "as its intersection with -clipdst is a %s "
-                                "whereas the input is a %s",
-                                nSrcFID, poSrcLayer->GetName(),
-                                OGRToOGCGeomType(poClipped->getGeometryType()),
-                                OGRToOGCGeomType(
-                                    poDstGeometry->getGeometryType()));
-                            goto end_loop;
-                        }
+    if (poFeatureIn == nullptr)
+    {
+        CPLDebug("GDALVectorTranslate",
+                 CPL_FRMT_GIB " features written in layer '%s'",
+                 nFeaturesWritten, poDstLayer->GetName());
+    }
 
-                        poDstGeometry = std::move(poClipped);
-                    }
+    return bRet;
+}
 
-                    if (psOptions->dfXYRes !=
-                            OGRGeomCoordinatePrecision::UNKNOWN &&
-                        OGRGeometryFactory::haveGEOS() &&
-                        !poDstGeometry->hasCurveGeometry())
-                    {
-                        // OGR_APPLY_GEOM_SET_PRECISION default value for
-                        // OGRLayer::CreateFeature() purposes, but here in the
-                        // ogr2ogr -xyRes context, we force calling SetPrecision(),
-                        // unless the user explicitly asks not to do it by
-                        // setting the config option to NO.
-                        if (!bRunSetPrecisionEvaluated)
-                        {
-                            bRunSetPrecisionEvaluated = true;
-                            bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
-                                "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
-                        }
-                        if (bRunSetPrecision)
-                        {
-                            auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                                poDstGeometry->SetPrecision(psOptions->dfXYRes,
-                                                            /* nFlags = */ 0));
-                            if (!poNewGeom)
-                                goto end_loop;
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
+/************************************************************************/
+/*                LayerTranslator::ProcessGeometries()                  */
+/************************************************************************/
 
-                    if (m_bMakeValid)
-                    {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) ==
-                            wkbGeometryCollection;
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->MakeValid());
-                        if (!poNewGeom)
-                            goto end_loop;
-                        poDstGeometry = std::move(poNewGeom);
-                        if (!bIsGeomCollection)
-                        {
-                            poDstGeometry.reset(
-                                OGRGeometryFactory::
-                                    removeLowerDimensionSubGeoms(
-                                        poDstGeometry.get()));
-                        }
-                    }
+/** Apply the geometry operations (reprojection, clipping, type conversion,
+ * etc.) to the geometries of a pending feature.
+ *
+ * This may be called concurrently from several threads, provided that each
+ * of them uses its own context.
+ */
+void LayerTranslator::ProcessGeometries(GeomProcessingContext &oCtxt,
+                                        const GeomProcessingJob &oJob,
+                                        PendingFeature &oFeature)
+{
+    const int eGType = m_eGType;
+    const GDALVectorTranslateOptions *psOptions = oJob.psOptions;
+    TargetLayerInfo *psInfo = oJob.psInfo;
+    const OGRFeatureDefn *poDstFDefn = oJob.poDstFDefn;
+    const OGRSpatialReference *poOutputSRS = oJob.poOutputSRS;
+    const GIntBig nSrcFID = oFeature.nSrcFID;
+    OGRFeature *poDstFeature = oFeature.poDstFeature.get();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
 
-                    if (m_eGeomTypeConversion != GTC_DEFAULT)
-                    {
-                        OGRwkbGeometryType eTargetType =
-                            poDstGeometry->getGeometryType();
-                        eTargetType =
-                            ConvertType(m_eGeomTypeConversion, eTargetType);
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(), eTargetType));
-                    }
-                    else if (eGType != GEOMTYPE_UNCHANGED)
-                    {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
-                    }
-                }
+    for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+    {
+        std::unique_ptr<OGRGeometry> poDstGeometry;
 
-                poDstFeature->SetGeomFieldDirectly(iGeom,
-                                                   poDstGeometry.release());
-            }
+        if (oFeature.poExplodedPart && iGeom == oFeature.iGeomExplodedPart)
+        {
+            poDstGeometry = std::move(oFeature.poExplodedPart);
+        }
+        else
+        {
+            poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
+        }
+        if (poDstGeometry == nullptr)
+            continue;
 
-            CPLErrorReset();
-            if ((psOptions->bUpsert
-                     ? poDstLayer->UpsertFeature(poDstFeature.get())
-                     : poDstLayer->CreateFeature(poDstFeature.get())) ==
-                OGRERR_NONE)
+        if (oFeature.bSetZ)
+        {
+            SetZ(poDstGeometry.get(), oFeature.dfZ);
+            /* This will correct the coordinate dimension to 3 */
+            poDstGeometry.reset(poDstGeometry->clone());
+        }
+
+        if (m_nCoordDim == 2 || m_nCoordDim == 3)
+        {
+            poDstGeometry->setCoordinateDimension(m_nCoordDim);
+        }
+        else if (m_nCoordDim == 4)
+        {
+            poDstGeometry->set3D(TRUE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_XYM)
+        {
+            poDstGeometry->set3D(FALSE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+        {
+            const OGRwkbGeometryType eDstLayerGeomType =
+                poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+            poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
+            poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+        }
+
+        if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+        {
+            if (m_dfGeomOpParam > 0)
+                poDstGeometry->segmentize(m_dfGeomOpParam);
+        }
+        else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+        {
+            if (m_dfGeomOpParam > 0)
             {
-                nFeaturesWritten++;
-                if (nDesiredFID != OGRNullFID &&
-                    poDstFeature->GetFID() != nDesiredFID)
+                auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                    poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam));
+                if (poNewGeom)
                 {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Feature id " CPL_FRMT_GIB " not preserved",
-                             nDesiredFID);
+                    poDstGeometry = std::move(poNewGeom);
                 }
             }
-            else if (!psOptions->bSkipFailures)
+        }
+
+        if (m_poClipSrcOri)
+        {
+
+            const OGRGeometry *poClipGeom =
+                GetSrcClipGeom(oCtxt, poDstGeometry->getSpatialReference());
+
+            std::unique_ptr<OGRGeometry> poClipped;
+            if (poClipGeom != nullptr)
             {
-                if (psOptions->nGroupTransactions)
+                OGREnvelope oClipEnv;
+                OGREnvelope oDstEnv;
+
+                poClipGeom->getEnvelope(&oClipEnv);
+                poDstGeometry->getEnvelope(&oDstEnv);
+
+                if (oClipEnv.Intersects(oDstEnv))
                 {
-                    if (psOptions->nLayerTransaction)
-                        poDstLayer->RollbackTransaction();
+                    poClipped.reset(
+                        poClipGeom->Intersection(poDstGeometry.get()));
                 }
+            }
 
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " from layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
+            if (poClipped == nullptr || poClipped->IsEmpty())
+            {
+                oFeature.eStatus = PendingFeatureStatus::SKIP;
+                return;
+            }
 
-                return false;
+            const int nDim = poDstGeometry->getDimension();
+            if (poClipped->getDimension() < nDim &&
+                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                    wkbUnknown)
+            {
+                CPLDebug("OGR2OGR",
+                         "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                         "as its intersection with -clipsrc is a %s "
+                         "whereas the input is a %s",
+                         nSrcFID, oJob.pszSrcLayerName,
+                         OGRToOGCGeomType(poClipped->getGeometryType()),
+                         OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                oFeature.eStatus = PendingFeatureStatus::SKIP;
+                return;
             }
-            else
+
+            poDstGeometry = std::move(poClipped);
+        }
+
+        const auto &oReprojInfo = psInfo->m_aoReprojectionInfo[iGeom];
+        OGRCoordinateTransformation *const poCT =
+            oCtxt.bUseClonedCT ? oCtxt.apoClonedCT[iGeom].get()
+                               : oReprojInfo.m_poCT.get();
+        char **const papszTransformOptions =
+            psInfo->m_aoReprojectionInfo[iGeom].m_aosTransformOptions.List();
+        const bool bReprojCanInvalidateValidity =
+            oReprojInfo.m_bCanInvalidateValidity;
+
+        if (iGeom < static_cast<int>(oFeature.abGeomReprojected.size()) &&
+            oFeature.abGeomReprojected[iGeom])
+        {
+            // Already done by ReprojectInBatch()
+        }
+        else if (poCT != nullptr || papszTransformOptions != nullptr)
+        {
+            // If we need to change the geometry type to linear, and
+            // we have a geometry with curves, then convert it to
+            // linear first, to avoid invalidities due to the fact
+            // that validity of arc portions isn't always kept while
+            // reprojecting and then discretizing.
+            if (bReprojCanInvalidateValidity &&
+                (!psInfo->m_bSupportCurves ||
+                 m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+                 m_eGeomTypeConversion ==
+                     GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
             {
-                CPLDebug("GDALVectorTranslate",
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " into layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
-                if (psOptions->nGroupTransactions)
+                if (poDstGeometry->hasCurveGeometry(TRUE))
                 {
-                    if (psOptions->nLayerTransaction)
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                        poDstGeometry.release(), eTargetType));
+                }
+            }
+            else if (bReprojCanInvalidateValidity &&
+                     eGType != GEOMTYPE_UNCHANGED &&
+                     !OGR_GT_IsNonLinear(
+                         static_cast<OGRwkbGeometryType>(eGType)) &&
+                     poDstGeometry->hasCurveGeometry(TRUE))
+            {
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(),
+                    static_cast<OGRwkbGeometryType>(eGType)));
+            }
+
+            for (int iIter = 0; iIter < 2; ++iIter)
+            {
+                auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+                    OGRGeometryFactory::transformWithOptions(
+                        poDstGeometry.get(), poCT, papszTransformOptions,
+                        oCtxt.oTransformWithOptionsCache));
+                if (poReprojectedGeom == nullptr)
+                {
+                    // Reported by the writing stage
+                    ++oFeature.nReprojectionFailures;
+                    if (!psOptions->bSkipFailures)
                     {
-                        poDstLayer->RollbackTransaction();
-                        CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
+                        return;
+                    }
+                }
+
+                // Check if a curve geometry is no longer valid after
+                // reprojection
+                const auto eType = poDstGeometry->getGeometryType();
+                const auto eFlatType = wkbFlatten(eType);
+
+                const auto IsValid = [](const OGRGeometry *poGeom)
+                {
+                    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+                    return poGeom->IsValid();
+                };
+
+                if (iIter == 0 && bReprojCanInvalidateValidity &&
+                    OGRGeometryFactory::haveGEOS() &&
+                    (eFlatType == wkbCurvePolygon ||
+                     eFlatType == wkbCompoundCurve ||
+                     eFlatType == wkbMultiCurve ||
+                     eFlatType == wkbMultiSurface) &&
+                    poDstGeometry->hasCurveGeometry(TRUE) &&
+                    IsValid(poDstGeometry.get()))
+                {
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    auto poDstGeometryTmp = std::unique_ptr<OGRGeometry>(
+                        OGRGeometryFactory::forceTo(poReprojectedGeom->clone(),
+                                                    eTargetType));
+                    if (!IsValid(poDstGeometryTmp.get()))
+                    {
+                        CPLDebug("OGR2OGR",
+                                 "Curve geometry no longer valid after "
+                                 "reprojection: transforming it into "
+                                 "linear one before reprojecting");
+                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                            poDstGeometry.release(), eTargetType));
+                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                            poDstGeometry.release(), eType));
                     }
                     else
                     {
-                        m_poODS->RollbackTransaction();
-                        m_poODS->StartTransaction(psOptions->bForceTransaction);
+                        poDstGeometry = std::move(poReprojectedGeom);
+                        break;
                     }
                 }
+                else
+                {
+                    poDstGeometry = std::move(poReprojectedGeom);
+                    break;
+                }
             }
-
-        end_loop:;  // nothing
         }
-
-        /* Report progress */
-        nCount++;
-        bool bGoOn = true;
-        if (pfnProgress)
+        else if (poOutputSRS != nullptr)
         {
-            bGoOn = pfnProgress(nCountLayerFeatures
-                                    ? nCount * 1.0 / nCountLayerFeatures
-                                    : 1.0,
-                                "", pProgressArg) != FALSE;
+            poDstGeometry->assignSpatialReference(poOutputSRS);
         }
-        if (!bGoOn)
+
+        if (poDstGeometry != nullptr)
         {
-            bRet = false;
-            break;
-        }
+            if (m_poClipDstOri)
+            {
+                const OGRGeometry *poClipGeom = GetDstClipGeom(
+                    oCtxt, poDstGeometry->getSpatialReference());
+                if (poClipGeom == nullptr)
+                {
+                    oFeature.eStatus = PendingFeatureStatus::SKIP;
+                    return;
+                }
 
-        if (pnReadFeatureCount)
-            *pnReadFeatureCount = nCount;
+                std::unique_ptr<OGRGeometry> poClipped;
 
-        if (psOptions->nFIDToFetch != OGRNullFID)
-            break;
-        if (poFeatureIn != nullptr)
-            break;
-    }
+                OGREnvelope oClipEnv;
+                OGREnvelope oDstEnv;
 
-    if (psOptions->nGroupTransactions)
-    {
-        if (psOptions->nLayerTransaction)
-        {
-            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                bRet = false;
+                poClipGeom->getEnvelope(&oClipEnv);
+                poDstGeometry->getEnvelope(&oDstEnv);
+
+                if (oClipEnv.Intersects(oDstEnv))
+                {
+                    poClipped.reset(
+                        poClipGeom->Intersection(poDstGeometry.get()));
+                }
+
+                if (poClipped == nullptr || poClipped->IsEmpty())
+                {
+                    oFeature.eStatus = PendingFeatureStatus::SKIP;
+                    return;
+                }
+
+                const int nDim = poDstGeometry->getDimension();
+                if (poClipped->getDimension() < nDim &&
+                    wkbFlatten(
+                        poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                        wkbUnknown)
+                {
+                    CPLDebug(
+                        "OGR2OGR",
+                        "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                        "as its intersection with -clipdst is a %s "
+                        "whereas the input is a %s",
+                        nSrcFID, oJob.pszSrcLayerName,
+                        OGRToOGCGeomType(poClipped->getGeometryType()),
+                        OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                    oFeature.eStatus = PendingFeatureStatus::SKIP;
+                    return;
+                }
+
+                poDstGeometry = std::move(poClipped);
+            }
+
+            if (oJob.bRunSetPrecision && OGRGeometryFactory::haveGEOS() &&
+                !poDstGeometry->hasCurveGeometry())
+            {
+                auto poNewGeom =
+                    std::unique_ptr<OGRGeometry>(poDstGeometry->SetPrecision(
+                        psOptions->dfXYRes, /* nFlags = */ 0));
+                if (!poNewGeom)
+                {
+                    oFeature.eStatus = PendingFeatureStatus::SKIP;
+                    return;
+                }
+                poDstGeometry = std::move(poNewGeom);
+            }
+
+            if (m_bMakeValid)
+            {
+                const bool bIsGeomCollection =
+                    wkbFlatten(poDstGeometry->getGeometryType()) ==
+                    wkbGeometryCollection;
+                auto poNewGeom =
+                    std::unique_ptr<OGRGeometry>(poDstGeometry->MakeValid());
+                if (!poNewGeom)
+                {
+                    oFeature.eStatus = PendingFeatureStatus::SKIP;
+                    return;
+                }
+                poDstGeometry = std::move(poNewGeom);
+                if (!bIsGeomCollection)
+                {
+                    poDstGeometry.reset(
+                        OGRGeometryFactory::removeLowerDimensionSubGeoms(
+                            poDstGeometry.get()));
+                }
+            }
+
+            if (m_eGeomTypeConversion != GTC_DEFAULT)
+            {
+                OGRwkbGeometryType eTargetType =
+                    poDstGeometry->getGeometryType();
+                eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(), eTargetType));
+            }
+            else if (eGType != GEOMTYPE_UNCHANGED)
+            {
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(),
+                    static_cast<OGRwkbGeometryType>(eGType)));
+            }
         }
-    }
 
-    if (poFeatureIn == nullptr)
-    {
-        CPLDebug("GDALVectorTranslate",
-                 CPL_FRMT_GIB " features written in layer '%s'",
-                 nFeaturesWritten, poDstLayer->GetName());
+        poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry.release());
     }
-
-    return bRet;
 }
 
 /************************************************************************/
@@ -6604,27 +7158,28 @@ bool LayerTranslator::Translate(
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetDstClipGeom(GeomProcessingContext &oCtxt,
+                                const OGRSpatialReference *poGeomSRS)
 {
-    if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
+    if (oCtxt.poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
     {
         auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
         if (poClipDstSRS && poGeomSRS && !poClipDstSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipDstReprojectedToDstSRS.reset(m_poClipDstOri->clone());
-            if (m_poClipDstReprojectedToDstSRS->transformTo(poGeomSRS) !=
+            oCtxt.poClipDstReprojectedToDstSRS.reset(m_poClipDstOri->clone());
+            if (oCtxt.poClipDstReprojectedToDstSRS->transformTo(poGeomSRS) !=
                 OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
+            oCtxt.poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
         }
         else if (!poClipDstSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipDstSRS)
+            if (!oCtxt.bWarnedClipDstSRS)
             {
-                m_bWarnedClipDstSRS = true;
+                oCtxt.bWarnedClipDstSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip destination geometry has no "
                          "attached SRS, but the feature's "
@@ -6635,8 +7190,9 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipDstReprojectedToDstSRS ? m_poClipDstReprojectedToDstSRS.get()
-                                          : m_poClipDstOri;
+    return oCtxt.poClipDstReprojectedToDstSRS
+               ? oCtxt.poClipDstReprojectedToDstSRS.get()
+               : m_poClipDstOri;
 }
 
 /************************************************************************/
@@ -6644,27 +7200,28 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetSrcClipGeom(GeomProcessingContext &oCtxt,
+                                const OGRSpatialReference *poGeomSRS)
 {
-    if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
+    if (oCtxt.poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
     {
         auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
         if (poClipSrcSRS && poGeomSRS && !poClipSrcSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipSrcReprojectedToSrcSRS.reset(m_poClipSrcOri->clone());
-            if (m_poClipSrcReprojectedToSrcSRS->transformTo(poGeomSRS) !=
+            oCtxt.poClipSrcReprojectedToSrcSRS.reset(m_poClipSrcOri->clone());
+            if (oCtxt.poClipSrcReprojectedToSrcSRS->transformTo(poGeomSRS) !=
                 OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
+            oCtxt.poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
         }
         else if (!poClipSrcSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipSrcSRS)
+            if (!oCtxt.bWarnedClipSrcSRS)
             {
-                m_bWarnedClipSrcSRS = true;
+                oCtxt.bWarnedClipSrcSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip source geometry has no attached SRS, "
                          "but the feature's geometry has one. "
@@ -6674,8 +7231,9 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipSrcReprojectedToSrcSRS ? m_poClipSrcReprojectedToSrcSRS.get()
-                                          : m_poClipSrcOri;
+    return oCtxt.poClipSrcReprojectedToSrcSRS
+               ? oCtxt.poClipSrcReprojectedToSrcSRS.get()
+               : m_poClipSrcOri;
 }
 
 /************************************************************************/
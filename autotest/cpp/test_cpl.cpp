@@ -51,11 +51,13 @@
 #include "cpl_http.h"
 #include "cpl_auto_close.h"
 #include "cpl_minixml.h"
+#include "cpl_multiproc.h"
 #include "cpl_quad_tree.h"
 #include "cpl_worker_thread_pool.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_threadsafe_queue.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <limits>
@@ -5242,4 +5244,18 @@ TEST_F(test_cpl, CPLUTF8ForceToASCII)
     }
 }
 
+// Test CPLParseNumThreads()
+TEST_F(test_cpl, CPLParseNumThreads)
+{
+    EXPECT_EQ(CPLParseNumThreads(nullptr, 1), 1);
+    EXPECT_EQ(CPLParseNumThreads(nullptr, 4), 4);
+    EXPECT_EQ(CPLParseNumThreads("3", 1), 3);
+    EXPECT_EQ(CPLParseNumThreads("0", 4), 1);
+    EXPECT_EQ(CPLParseNumThreads("-2", 4), 1);
+    EXPECT_EQ(CPLParseNumThreads("invalid", 4), 1);
+    EXPECT_EQ(CPLParseNumThreads("100000", 1), 128);
+    EXPECT_EQ(CPLParseNumThreads("all_cpus", 1),
+              std::min(128, CPLGetNumCPUs()));
+}
+
 }  // namespace
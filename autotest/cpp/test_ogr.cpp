@@ -28,6 +28,7 @@
 
 #include "gdal_unit_test.h"
 
+#include "ogr_geometry.h"
 #include "ogr_p.h"
 #include "ogrsf_frmts.h"
 #include "../../ogr/ogrsf_frmts/osm/gpb.h"
@@ -1481,6 +1482,77 @@ TEST_F(test_ogr, DatasetFeature_and_LayerFeature_iterators)
     }
 }
 
+// Test that layer-feature iterators recycle features with drivers that
+// implement GetNextFeatureInto()
+TEST_F(test_ogr, LayerFeature_iterator_recycling)
+{
+    const char *pszFilename = "/vsimem/test_feature_recycling.csv";
+    VSIFCloseL(VSIFileFromMemBuffer(
+        pszFilename,
+        reinterpret_cast<GByte *>(const_cast<char *>(
+            "id,str,WKT\n"
+            "1,foo,POINT (1 1)\n"
+            "2,,\n"
+            "3,bar,\"LINESTRING (1 1,2 2)\"\n"
+            "4,,POINT (4 4)\n")),
+        -1, FALSE));
+
+    GDALDatasetUniquePtr poDS(GDALDataset::Open(pszFilename, GDAL_OF_VECTOR));
+    ASSERT_TRUE(poDS != nullptr);
+    GDALDatasetUniquePtr poRefDS(
+        GDALDataset::Open(pszFilename, GDAL_OF_VECTOR));
+    ASSERT_TRUE(poRefDS != nullptr);
+    OGRLayer *poLayer = poDS->GetLayer(0);
+    OGRLayer *poRefLayer = poRefDS->GetLayer(0);
+
+    for (const char *pszFilter : {static_cast<const char *>(nullptr),
+                                  "id <> '2'"})
+    {
+        poLayer->SetAttributeFilter(pszFilter);
+        poRefLayer->SetAttributeFilter(pszFilter);
+        poRefLayer->ResetReading();
+
+        const OGRFeature *poFirstFeature = nullptr;
+        int nCount = 0;
+        for (auto &&poFeature : poLayer)
+        {
+            OGRFeatureUniquePtr poRefFeature(poRefLayer->GetNextFeature());
+            ASSERT_TRUE(poRefFeature != nullptr);
+            EXPECT_TRUE(poFeature->Equal(poRefFeature.get()))
+                << poFeature->GetFID();
+            if (poFirstFeature == nullptr)
+                poFirstFeature = poFeature.get();
+            else
+                EXPECT_EQ(poFeature.get(), poFirstFeature);
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, pszFilter ? 3 : 4);
+        EXPECT_TRUE(poRefLayer->GetNextFeature() == nullptr);
+    }
+
+    // A feature moved out of the iterator is not recycled
+    {
+        poLayer->SetAttributeFilter(nullptr);
+        std::vector<OGRFeatureUniquePtr> apoFeatures;
+        for (auto &&poFeature : poLayer)
+            apoFeatures.push_back(std::move(poFeature));
+        ASSERT_EQ(apoFeatures.size(), 4U);
+        poRefLayer->SetAttributeFilter(nullptr);
+        poRefLayer->ResetReading();
+        for (const auto &poFeature : apoFeatures)
+        {
+            OGRFeatureUniquePtr poRefFeature(poRefLayer->GetNextFeature());
+            ASSERT_TRUE(poRefFeature != nullptr);
+            EXPECT_TRUE(poFeature->Equal(poRefFeature.get()))
+                << poFeature->GetFID();
+        }
+    }
+
+    poDS.reset();
+    poRefDS.reset();
+    VSIUnlink(pszFilename);
+}
+
 // Test field iterator
 TEST_F(test_ogr, field_iterator)
 {
@@ -1807,6 +1879,51 @@ TEST_F(test_ogr, OGRGeometry_exportToWkt)
     CPLFree(pszWKT);
 }
 
+// Test OGRFormatDoubleToBuffer() and OGRMakeWktCoordinateMToBuffer()
+TEST_F(test_ogr, OGRFormatDoubleToBuffer)
+{
+    OGRWktOptions opts;
+    char szBuffer[64];
+
+    EXPECT_EQ(OGRFormatDoubleToBuffer(szBuffer, sizeof(szBuffer), 1.5, opts, 1),
+              3U);
+    EXPECT_STREQ(szBuffer, "1.5");
+
+    // Zeros of the exponent must not be stripped
+    EXPECT_EQ(
+        OGRFormatDoubleToBuffer(szBuffer, sizeof(szBuffer), 1.5e20, opts, 1),
+        7U);
+    EXPECT_STREQ(szBuffer, "1.5E+20");
+    EXPECT_EQ(OGRFormatDouble(1.5e20, opts, 1), "1.5E+20");
+
+    // Too small buffer
+    EXPECT_EQ(OGRFormatDoubleToBuffer(szBuffer, 4, 123456.789, opts, 1), 0U);
+
+    for (const double dfX : {0.0, -1.0, 1.25, 123456789.123, 1e-20})
+    {
+        const std::string osExpected =
+            OGRMakeWktCoordinateM(dfX, 2, 3.5, 4, TRUE, TRUE, opts);
+        EXPECT_EQ(OGRMakeWktCoordinateMToBuffer(szBuffer, sizeof(szBuffer),
+                                                dfX, 2, 3.5, 4, TRUE, TRUE,
+                                                opts),
+                  osExpected.size());
+        EXPECT_EQ(std::string(szBuffer), osExpected);
+    }
+
+    // Shortest round-trip representation
+    opts.format = OGRWktFormat::RoundTrip;
+    for (const double dfVal : {0.1, 1.0 / 3, -123456.789, 1.5e20, 5e-324})
+    {
+        ASSERT_GT(OGRFormatDoubleToBuffer(szBuffer, sizeof(szBuffer), dfVal,
+                                          opts, 1),
+                  0U);
+        EXPECT_EQ(CPLAtof(szBuffer), dfVal) << szBuffer;
+    }
+    OGRFormatDoubleToBuffer(szBuffer, sizeof(szBuffer), 0.1, opts, 1);
+    EXPECT_STREQ(szBuffer, "0.1");
+    EXPECT_EQ(OGRMakeWktCoordinate(0.1, 2, 0, 2, opts), "0.1 2.0");
+}
+
 // Test OGRGeometry::clone()
 TEST_F(test_ogr, OGRGeometry_clone)
 {
@@ -4175,4 +4292,144 @@ TEST_F(test_ogr, OGRGeometry_removeEmptyParts)
     }
 }
 
+// Test OGRGeometryFactory::transformGeometries()
+TEST_F(test_ogr, OGRGeometryFactory_transformGeometries)
+{
+    // Shift coordinates, and fail on negative X
+    class ShiftCT final : public OGRCoordinateTransformation
+    {
+      public:
+        const OGRSpatialReference *GetSourceCS() const override
+        {
+            return nullptr;
+        }
+
+        const OGRSpatialReference *GetTargetCS() const override
+        {
+            return nullptr;
+        }
+
+        int Transform(size_t nCount, double *x, double *y, double *z,
+                      double * /* t */, int *pabSuccess) override
+        {
+            bool bRet = true;
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                pabSuccess[i] = x[i] >= 0;
+                if (!pabSuccess[i])
+                {
+                    bRet = false;
+                    continue;
+                }
+                x[i] += 10;
+                y[i] += 100;
+                if (z)
+                    z[i] += 1000;
+            }
+            return bRet;
+        }
+
+        OGRCoordinateTransformation *Clone() const override
+        {
+            return new ShiftCT();
+        }
+
+        OGRCoordinateTransformation *GetInverse() const override
+        {
+            return nullptr;
+        }
+    };
+
+    const char *const apszWKT[] = {
+        "POINT (1 2)",
+        "POINT Z (1 2 3)",
+        "POINT EMPTY",
+        "LINESTRING (1 2,3 4)",
+        "LINESTRING EMPTY",
+        "POLYGON ((0 0,0 1,1 1,0 0),(0.1 0.1,0.1 0.2,0.2 0.2,0.1 0.1))",
+        "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 2)))",
+        "COMPOUNDCURVE ((0 0,1 1),CIRCULARSTRING (1 1,2 2,3 1))",
+        "GEOMETRYCOLLECTION (POINT M (1 2 3),LINESTRING ZM (1 2 3 4,5 6 7 8))",
+        "POLYHEDRALSURFACE Z (((0 0 0,0 1 0,1 1 0,0 0 0)))",
+        "LINESTRING (1 2,-1 2)",
+        "MULTIPOINT ((1 2),(-1 2))",
+    };
+    constexpr int N = static_cast<int>(CPL_ARRAYSIZE(apszWKT));
+
+    for (int nThreads : {1, 4})
+    {
+        for (bool bFallbackOnFailure : {true, false})
+        {
+            std::vector<std::unique_ptr<OGRGeometry>> apoGeoms;
+            std::vector<std::unique_ptr<OGRGeometry>> apoExpected;
+            std::vector<OGRGeometry *> apoGeomsRaw;
+            std::vector<OGRErr> aeExpectedErrors;
+            ShiftCT oCT;
+            for (const char *pszWKT : apszWKT)
+            {
+                OGRGeometry *poGeom = nullptr;
+                OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom);
+                ASSERT_NE(poGeom, nullptr);
+                apoGeoms.emplace_back(poGeom);
+                apoGeomsRaw.push_back(poGeom);
+
+                auto poExpected = std::unique_ptr<OGRGeometry>(poGeom->clone());
+                {
+                    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+                    aeExpectedErrors.push_back(poExpected->transform(&oCT));
+                }
+                apoExpected.push_back(std::move(poExpected));
+            }
+            apoGeomsRaw.push_back(nullptr);
+
+            std::vector<OGRErr> aeErrors(N + 1, OGRERR_NONE);
+            {
+                CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+                EXPECT_FALSE(OGRGeometryFactory::transformGeometries(
+                    &oCT, N + 1, apoGeomsRaw.data(), aeErrors.data(),
+                    nThreads, bFallbackOnFailure));
+            }
+            EXPECT_EQ(aeErrors[N], OGRERR_NONE);
+            for (int i = 0; i < N; ++i)
+            {
+                const bool bFallback =
+                    i == 2 || i == 9 || aeExpectedErrors[i] != OGRERR_NONE;
+                if (bFallbackOnFailure || !bFallback)
+                {
+                    EXPECT_EQ(aeErrors[i], aeExpectedErrors[i]) << i;
+                    if (aeErrors[i] == OGRERR_NONE)
+                    {
+                        EXPECT_TRUE(apoGeoms[i]->Equals(apoExpected[i].get()))
+                            << apoGeoms[i]->exportToWkt();
+                        EXPECT_EQ(apoGeoms[i]->getCoordinateDimension(),
+                                  apoExpected[i]->getCoordinateDimension());
+                    }
+                }
+                else
+                {
+                    EXPECT_EQ(aeErrors[i], OGRERR_FAILURE) << i;
+                    EXPECT_EQ(apoGeoms[i]->exportToWkt(),
+                              std::string(apszWKT[i]));
+                }
+            }
+        }
+    }
+
+    // Enough points to be dispatched among several threads
+    OGRLineString oLS;
+    constexpr int NPOINTS = 100 * 1000;
+    oLS.setNumPoints(NPOINTS);
+    for (int i = 0; i < NPOINTS; ++i)
+        oLS.setPoint(i, i, -i);
+    OGRGeometry *poGeom = &oLS;
+    ShiftCT oCT;
+    EXPECT_TRUE(OGRGeometryFactory::transformGeometries(&oCT, 1, &poGeom,
+                                                        nullptr, 4));
+    for (int i = 0; i < NPOINTS; ++i)
+    {
+        ASSERT_EQ(oLS.getX(i), i + 10);
+        ASSERT_EQ(oLS.getY(i), -i + 100);
+    }
+}
+
 }  // namespace
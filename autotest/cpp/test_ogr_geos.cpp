@@ -36,6 +36,7 @@
 #include <geos_c.h>
 #endif
 
+#include <memory>
 #include <string>
 
 #include "gtest_include.h"
@@ -405,4 +406,79 @@ TEST_F(test_ogr_geos, OGR_G_SymDifference)
 
     OGR_G_DestroyGeometry(expect);
 }
+
+// Test round trip of geometries through GEOS
+TEST_F(test_ogr_geos, createFromGEOS_roundtrip)
+{
+#ifdef HAVE_GEOS
+    const char *const apszWKT[] = {
+        "POINT (1 2)",
+        "POINT Z (1 2 3)",
+        "POINT EMPTY",
+        "LINESTRING (1 2,3 4)",
+        "LINESTRING Z (1 2 3,4 5 6)",
+        "LINESTRING EMPTY",
+        "POLYGON ((0 0,0 1,1 1,0 0),(0.1 0.1,0.1 0.2,0.2 0.2,0.1 0.1))",
+        "POLYGON EMPTY",
+        "MULTIPOINT ((1 2),(3 4))",
+        "MULTILINESTRING ((1 2,3 4),(5 6,7 8))",
+        "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 2)))",
+        "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (1 2,3 4))",
+        "GEOMETRYCOLLECTION EMPTY",
+    };
+    GEOSContextHandle_t ctxt = OGRGeometry::createGEOSContext();
+    for (const char *pszWKT : apszWKT)
+    {
+        OGRGeometry *poGeom = nullptr;
+        OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom);
+        ASSERT_NE(poGeom, nullptr);
+        std::unique_ptr<OGRGeometry> poGeomUniquePtr(poGeom);
+
+        GEOSGeom geosGeom = poGeom->exportToGEOS(ctxt);
+        ASSERT_NE(geosGeom, nullptr) << pszWKT;
+        std::unique_ptr<OGRGeometry> poRoundTrip(
+            OGRGeometryFactory::createFromGEOS(ctxt, geosGeom));
+        GEOSGeom_destroy_r(ctxt, geosGeom);
+        ASSERT_NE(poRoundTrip, nullptr) << pszWKT;
+        EXPECT_STREQ(poRoundTrip->exportToWkt().c_str(), pszWKT);
+    }
+    OGRGeometry::freeGEOSContext(ctxt);
+#endif
+}
+
+// Test that a prepared geometry, which keeps the GEOS representation of a
+// geometry for repeated predicates, gives the same results as OGRGeometry
+TEST_F(test_ogr_geos, prepared_geometry)
+{
+#ifdef HAVE_GEOS
+    OGRPolygon oPoly;
+    {
+        OGRLinearRing oRing;
+        oRing.addPoint(0, 0);
+        oRing.addPoint(0, 1);
+        oRing.addPoint(1, 1);
+        oRing.addPoint(1, 0);
+        oRing.addPoint(0, 0);
+        oPoly.addRing(&oRing);
+    }
+    OGRPreparedGeometryUniquePtr poPrepared(
+        OGRCreatePreparedGeometry(OGRGeometry::ToHandle(&oPoly)));
+    ASSERT_NE(poPrepared, nullptr);
+
+    OGRPoint aoPoints[] = {OGRPoint(0.5, 0.5), OGRPoint(1.5, 0.5),
+                           OGRPoint(1, 0.5)};
+    for (auto &oPoint : aoPoints)
+    {
+        EXPECT_EQ(CPL_TO_BOOL(OGRPreparedGeometryIntersects(
+                      poPrepared.get(), OGRGeometry::ToHandle(&oPoint))),
+                  CPL_TO_BOOL(oPoly.Intersects(&oPoint)))
+            << oPoint.exportToWkt();
+        EXPECT_EQ(CPL_TO_BOOL(OGRPreparedGeometryContains(
+                      poPrepared.get(), OGRGeometry::ToHandle(&oPoint))),
+                  CPL_TO_BOOL(oPoly.Contains(&oPoint)))
+            << oPoint.exportToWkt();
+    }
+#endif
+}
+
 }  // namespace
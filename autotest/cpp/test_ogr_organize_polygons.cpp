@@ -31,6 +31,7 @@
 #include "ogr_geometry.h"
 #include "gtest_include.h"
 
+#include <memory>
 #include <vector>
 
 static std::unique_ptr<OGRGeometry>
@@ -268,3 +269,80 @@ TEST_P(OrganizePolygonsTest, CrossingCCWPolygons)
                 "((5 5, 15 5, 15 15, 5 15, 5 5)))"));
     ASSERT_TRUE(result->Equals(expected.get()));
 }
+
+TEST_P(OrganizePolygonsTest, ManyPolygons)
+{
+    // Grid of squares (CW), each one with a hole (CCW) containing an
+    // island (CW)
+    constexpr int N = 30;
+    std::vector<OGRGeometry *> polygons;
+    for (int iY = 0; iY < N; ++iY)
+    {
+        for (int iX = 0; iX < N; ++iX)
+        {
+            for (double dfOffset : {0.0, 0.2, 0.4})
+            {
+                const double dfMinX = iX + dfOffset;
+                const double dfMinY = iY + dfOffset;
+                const double dfMaxX = iX + 1 - dfOffset;
+                const double dfMaxY = iY + 1 - dfOffset;
+                auto poRing = std::make_unique<OGRLinearRing>();
+                poRing->addPoint(dfMinX, dfMinY);
+                if (dfOffset == 0.2)
+                {
+                    poRing->addPoint(dfMaxX, dfMinY);
+                    poRing->addPoint(dfMaxX, dfMaxY);
+                    poRing->addPoint(dfMinX, dfMaxY);
+                }
+                else
+                {
+                    poRing->addPoint(dfMinX, dfMaxY);
+                    poRing->addPoint(dfMaxX, dfMaxY);
+                    poRing->addPoint(dfMaxX, dfMinY);
+                }
+                poRing->addPoint(dfMinX, dfMinY);
+                auto poPoly = new OGRPolygon();
+                poPoly->addRingDirectly(poRing.release());
+                polygons.push_back(poPoly);
+            }
+        }
+    }
+
+    const auto &method = GetParam();
+    for (const char *pszThreads : {"1", "4"})
+    {
+        std::vector<OGRGeometry *> polygonsCopy;
+        for (const auto *poPoly : polygons)
+            polygonsCopy.push_back(poPoly->clone());
+
+        CPLStringList options;
+        options.AddNameValue("METHOD", method.c_str());
+        options.AddNameValue("NUM_THREADS", pszThreads);
+        std::unique_ptr<OGRGeometry> result(
+            OGRGeometryFactory::organizePolygons(
+                polygonsCopy.data(), static_cast<int>(polygonsCopy.size()),
+                nullptr, (const char **)options.List()));
+
+        ASSERT_NE(result, nullptr);
+        ASSERT_EQ(wkbFlatten(result->getGeometryType()), wkbMultiPolygon);
+        const auto poMP = result->toMultiPolygon();
+        if (method == "SKIP")
+        {
+            EXPECT_EQ(poMP->getNumGeometries(), 3 * N * N);
+        }
+        else
+        {
+            // Squares with their hole, and islands
+            ASSERT_EQ(poMP->getNumGeometries(), 2 * N * N);
+            for (int i = 0; i < 2 * N * N; ++i)
+            {
+                EXPECT_EQ(poMP->getGeometryRef(i)->getNumInteriorRings(),
+                          (i % 2) == 0 ? 1 : 0)
+                    << i;
+            }
+        }
+    }
+
+    for (auto *poPoly : polygons)
+        delete poPoly;
+}
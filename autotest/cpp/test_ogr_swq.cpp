@@ -226,6 +226,16 @@ TEST_F(test_ogr_swq, select_unparse)
         EXPECT_STREQ(ret, pszSQL);
         CPLFree(ret);
     }
+    {
+        swq_select select;
+        const char *pszSQL = "SELECT a, SUM(b) FROM FOO "
+                             "GROUP BY a, x.\"b c\" HAVING (COUNT(*)) > 1 "
+                             "ORDER BY a";
+        EXPECT_EQ(select.preparse(pszSQL), CE_None);
+        char *ret = select.Unparse();
+        EXPECT_STREQ(ret, pszSQL);
+        CPLFree(ret);
+    }
 }
 
 }  // namespace
@@ -34,6 +34,7 @@
 #include "gtest_include.h"
 
 #include <limits>
+#include <memory>
 
 namespace
 {
@@ -524,4 +525,257 @@ INSTANTIATE_TEST_SUITE_P(
         OGRWKBIntersectsPessimisticFixture::ParamType> &l_info)
     { return std::get<6>(l_info.param); });
 
+
+static std::vector<GByte> WKTToWKB(const char *pszWKT,
+                                   OGRwkbByteOrder eByteOrder = wkbNDR)
+{
+    OGRGeometry *poGeom = nullptr;
+    OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom);
+    std::vector<GByte> abyWkb;
+    if (poGeom)
+    {
+        abyWkb.resize(poGeom->WkbSize());
+        poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+        delete poGeom;
+    }
+    return abyWkb;
+}
+
+TEST_F(test_ogr_wkb, OGRWKBGeometryView_iteration)
+{
+    for (const auto eByteOrder : {wkbNDR, wkbXDR})
+    {
+        const auto abyWkb = WKTToWKB(
+            "GEOMETRYCOLLECTION(POINT(1 2),LINESTRING Z (1 2 3,4 5 6),"
+            "POLYGON((0 0,0 1,1 1,0 0),(0.1 0.1,0.1 0.2,0.2 0.2,0.1 0.1)))",
+            eByteOrder);
+        OGRWKBGeometryView oView;
+        ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size()));
+        EXPECT_EQ(oView.GetSize(), abyWkb.size());
+        EXPECT_EQ(wkbFlatten(oView.GetGeometryType()), wkbGeometryCollection);
+        EXPECT_EQ(oView.GetNumParts(), 3U);
+        EXPECT_FALSE(oView.IsEmpty());
+
+        int iPart = 0;
+        for (const auto &oPart : oView.GetParts())
+        {
+            if (iPart == 0)
+            {
+                const auto oPoints = oPart.GetPoints();
+                ASSERT_EQ(oPoints.size(), 1U);
+                EXPECT_EQ(oPoints.GetX(0), 1);
+                EXPECT_EQ(oPoints.GetY(0), 2);
+            }
+            else if (iPart == 1)
+            {
+                EXPECT_TRUE(oPart.Is3D());
+                const auto oPoints = oPart.GetPoints();
+                ASSERT_EQ(oPoints.size(), 2U);
+                EXPECT_EQ(oPoints.GetX(1), 4);
+                EXPECT_EQ(oPoints.GetY(1), 5);
+                EXPECT_EQ(oPoints.GetZ(1), 6);
+            }
+            else
+            {
+                EXPECT_EQ(oPart.GetNumRings(), 2U);
+                int iRing = 0;
+                for (const auto &oRing : oPart.GetRings())
+                {
+                    ASSERT_EQ(oRing.size(), 4U);
+                    EXPECT_EQ(oRing.GetX(2), iRing == 0 ? 1 : 0.2);
+                    ++iRing;
+                }
+                EXPECT_EQ(iRing, 2);
+            }
+            ++iPart;
+        }
+        EXPECT_EQ(iPart, 3);
+
+        // Truncated geometries
+        for (size_t i = 0; i < abyWkb.size(); ++i)
+        {
+            EXPECT_FALSE(oView.Init(abyWkb.data(), i));
+        }
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRWKBGeometryView_measures)
+{
+    const char *const apszWKT[] = {
+        "POINT (1 2)",
+        "LINESTRING (0 0,3 4,3 5)",
+        "LINESTRING (0 0,1 0,1 1,0 0)",
+        "POLYGON ((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))",
+        "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((2 2,2 4,4 4,4 2,2 2)))",
+        "MULTILINESTRING ((0 0,1 0),(2 2,2 5))",
+        "GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (0 0,1 0),"
+        "POLYGON ((0 0,0 1,1 1,0 0)),MULTILINESTRING ((0 0,0 3)))",
+        "TIN (((0 0,0 1,1 1,0 0)),((0 0,1 1,1 0,0 0)))",
+        "CIRCULARSTRING (0 0,1 1,2 0)",
+        "COMPOUNDCURVE ((-1 0,0 0),CIRCULARSTRING (0 0,1 1,2 0))",
+    };
+    for (const char *pszWKT : apszWKT)
+    {
+        OGRGeometry *poGeom = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom),
+                  OGRERR_NONE);
+        std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+        const auto abyWkb = WKTToWKB(pszWKT);
+        OGRWKBGeometryView oView;
+        ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size())) << pszWKT;
+
+        double dfLength = -1;
+        EXPECT_TRUE(oView.GetLength(dfLength));
+        const double dfExpectedLength =
+            (OGR_GT_IsCurve(wkbFlatten(poGeom->getGeometryType())) ||
+             OGR_GT_IsSubClassOf(wkbFlatten(poGeom->getGeometryType()),
+                                 wkbGeometryCollection))
+                ? OGR_G_Length(OGRGeometry::ToHandle(poGeom))
+                : 0.0;
+        EXPECT_NEAR(dfLength, dfExpectedLength, 1e-10) << pszWKT;
+
+        double dfArea = -1;
+        if (OGR_GT_IsNonLinear(poGeom->getGeometryType()))
+        {
+            EXPECT_FALSE(oView.GetArea(dfArea));
+        }
+        else
+        {
+            EXPECT_TRUE(oView.GetArea(dfArea));
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            EXPECT_NEAR(dfArea, OGR_G_Area(OGRGeometry::ToHandle(poGeom)),
+                        1e-10)
+                << pszWKT;
+        }
+
+        OGREnvelope sEnvelope;
+        OGREnvelope sExpectedEnvelope;
+        EXPECT_TRUE(oView.GetEnvelope(sEnvelope));
+        if (!OGR_GT_IsNonLinear(poGeom->getGeometryType()))
+        {
+            poGeom->getEnvelope(&sExpectedEnvelope);
+            EXPECT_EQ(sEnvelope, sExpectedEnvelope) << pszWKT;
+        }
+    }
+
+    {
+        const auto abyWkb = WKTToWKB(
+            "POLYGON ((0 0,0 10,10 10,10 0,0 0),(1 1,3 1,3 3,1 3,1 1))");
+        OGRWKBGeometryView oView;
+        ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size()));
+        double dfX = 0;
+        double dfY = 0;
+        ASSERT_TRUE(oView.GetCentroid(dfX, dfY));
+        EXPECT_NEAR(dfX, (100 * 5 - 4 * 2) / 96.0, 1e-10);
+        EXPECT_NEAR(dfY, (100 * 5 - 4 * 2) / 96.0, 1e-10);
+    }
+
+    {
+        const auto abyWkb =
+            WKTToWKB("GEOMETRYCOLLECTION (POINT (100 100),"
+                     "LINESTRING (0 0,2 0),LINESTRING (0 1,0 1))");
+        OGRWKBGeometryView oView;
+        ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size()));
+        double dfX = 0;
+        double dfY = 0;
+        ASSERT_TRUE(oView.GetCentroid(dfX, dfY));
+        EXPECT_EQ(dfX, 1);
+        EXPECT_EQ(dfY, 0);
+    }
+
+    {
+        const auto abyWkb = WKTToWKB("POINT EMPTY");
+        OGRWKBGeometryView oView;
+        ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size()));
+        EXPECT_TRUE(oView.IsEmpty());
+        double dfX = 0;
+        double dfY = 0;
+        EXPECT_FALSE(oView.GetCentroid(dfX, dfY));
+    }
+}
+
+TEST_F(test_ogr_wkb, OGRWKBGeometryView_intersects)
+{
+    const auto abyWkb = WKTToWKB(
+        "MULTIPOLYGON (((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4)),"
+        "((20 0,20 1,21 1,20 0)))",
+        wkbXDR);
+    OGRWKBGeometryView oView;
+    ASSERT_TRUE(oView.Init(abyWkb.data(), abyWkb.size()));
+
+    bool bIntersects = false;
+    EXPECT_TRUE(oView.IntersectsPoint(1, 1, bIntersects));
+    EXPECT_TRUE(bIntersects);
+    EXPECT_TRUE(oView.IntersectsPoint(5, 5, bIntersects));
+    EXPECT_FALSE(bIntersects);
+    EXPECT_TRUE(oView.IntersectsPoint(4, 5, bIntersects));
+    EXPECT_TRUE(bIntersects);
+    EXPECT_TRUE(oView.IntersectsPoint(15, 5, bIntersects));
+    EXPECT_FALSE(bIntersects);
+
+    const auto TestEnvelope =
+        [&oView](double dfMinX, double dfMinY, double dfMaxX, double dfMaxY)
+    {
+        OGREnvelope sEnvelope;
+        sEnvelope.MinX = dfMinX;
+        sEnvelope.MinY = dfMinY;
+        sEnvelope.MaxX = dfMaxX;
+        sEnvelope.MaxY = dfMaxY;
+        bool bRet = false;
+        EXPECT_TRUE(oView.IntersectsEnvelope(sEnvelope, bRet));
+        return bRet;
+    };
+    // Envelope inside the hole
+    EXPECT_FALSE(TestEnvelope(4.5, 4.5, 5.5, 5.5));
+    // Envelope inside the polygon, but not touching any vertex
+    EXPECT_TRUE(TestEnvelope(1, 1, 2, 2));
+    // Envelope containing the whole geometry
+    EXPECT_TRUE(TestEnvelope(-1, -1, 30, 30));
+    // Envelope crossing edges without containing any vertex
+    EXPECT_TRUE(TestEnvelope(-1, 2, 11, 3));
+    // Envelope in the bounding box of the geometry, but outside of it
+    EXPECT_FALSE(TestEnvelope(20.8, 0.1, 20.9, 0.2));
+
+    // Circular arcs are not handled
+    const auto abyWkbCurve = WKTToWKB("CIRCULARSTRING (0 0,1 1,2 0)");
+    ASSERT_TRUE(oView.Init(abyWkbCurve.data(), abyWkbCurve.size()));
+    EXPECT_FALSE(oView.IntersectsPoint(1, 1, bIntersects));
+}
+
+TEST_F(test_ogr_wkb, OGRWKBSwapXY_OGRWKBTransform)
+{
+    const char *pszWKT =
+        "GEOMETRYCOLLECTION Z (POINT Z (1 2 3),LINESTRING Z (1 2 3,4 5 6),"
+        "POLYGON Z ((0 0 1,0 1 1,1 1 1,0 0 1)))";
+    for (const auto eByteOrder : {wkbNDR, wkbXDR})
+    {
+        auto abyWkb = WKTToWKB(pszWKT, eByteOrder);
+        ASSERT_TRUE(OGRWKBSwapXY(abyWkb.data(), abyWkb.size()));
+
+        OGRGeometry *poGeom = nullptr;
+        OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom);
+        ASSERT_NE(poGeom, nullptr);
+        std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+        poGeom->swapXY();
+        EXPECT_EQ(abyWkb, WKTToWKB(poGeom->exportToWkt().c_str(), eByteOrder));
+
+        OGRSpatialReference oSRS_4326;
+        oSRS_4326.importFromEPSG(4326);
+        OGRSpatialReference oSRS_3857;
+        oSRS_3857.importFromEPSG(3857);
+        auto poCT = std::unique_ptr<OGRCoordinateTransformation>(
+            OGRCreateCoordinateTransformation(&oSRS_4326, &oSRS_3857));
+        ASSERT_NE(poCT, nullptr);
+        ASSERT_TRUE(OGRWKBTransform(abyWkb.data(), abyWkb.size(), poCT.get()));
+        ASSERT_EQ(poGeom->transform(poCT.get()), OGRERR_NONE);
+
+        OGRGeometry *poGeomFromWkb = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkb(
+                      abyWkb.data(), nullptr, &poGeomFromWkb, abyWkb.size()),
+                  OGRERR_NONE);
+        std::unique_ptr<OGRGeometry> poGeomFromWkbHolder(poGeomFromWkb);
+        EXPECT_TRUE(poGeomFromWkb->Equals(poGeom));
+    }
+}
+
 }  // namespace
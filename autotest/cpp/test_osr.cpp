@@ -35,6 +35,7 @@
 #include <algorithm>
 #include <cmath>
 #include <string>
+#include <thread>
 
 #include "gtest_include.h"
 
@@ -641,4 +642,75 @@ TEST_F(test_osr, exportToPanorama)
         EXPECT_NEAR(adfParams[6], 0, EPS);           //false_northing
     }
 }
+
+// Test the cache of CRS objects
+TEST_F(test_osr, CRSCache)
+{
+    OSRClearCRSCache();
+    GIntBig nHits = -1;
+    GIntBig nMisses = -1;
+    int nEntries = -1;
+    OSRGetCRSCacheStatistics(&nHits, &nMisses, &nEntries);
+    EXPECT_EQ(nHits, 0);
+    EXPECT_EQ(nMisses, 0);
+    EXPECT_EQ(nEntries, 0);
+
+    std::string osWKT;
+    {
+        OGRSpatialReference oSRS;
+        EXPECT_EQ(oSRS.importFromEPSG(32631), OGRERR_NONE);
+        osWKT = oSRS.exportToWkt();
+    }
+    OSRGetCRSCacheStatistics(&nHits, &nMisses, &nEntries);
+    EXPECT_GE(nMisses, 1);
+    EXPECT_GE(nEntries, 1);
+    const GIntBig nHitsBefore = nHits;
+
+    // Same thread: served from the per-thread cache, which is not counted
+    {
+        OGRSpatialReference oSRS;
+        EXPECT_EQ(oSRS.importFromEPSG(32631), OGRERR_NONE);
+        EXPECT_EQ(oSRS.exportToWkt(), osWKT);
+    }
+    OSRGetCRSCacheStatistics(&nHits, nullptr, nullptr);
+    EXPECT_EQ(nHits, nHitsBefore);
+
+    // Other thread: served from the process-wide cache
+    std::string osWKTOtherThread;
+    std::thread oThread(
+        [&osWKTOtherThread]()
+        {
+            OGRSpatialReference oSRS;
+            if (oSRS.importFromEPSG(32631) == OGRERR_NONE)
+                osWKTOtherThread = oSRS.exportToWkt();
+        });
+    oThread.join();
+    EXPECT_EQ(osWKTOtherThread, osWKT);
+    GIntBig nHitsAfter = 0;
+    OSRGetCRSCacheStatistics(&nHitsAfter, nullptr, nullptr);
+    EXPECT_GT(nHitsAfter, nHits);
+
+    // Definitions going through proj_create()
+    {
+        OGRSpatialReference oSRS;
+        EXPECT_EQ(oSRS.SetFromUserInput("urn:ogc:def:crs:EPSG::4326"),
+                  OGRERR_NONE);
+        EXPECT_EQ(oSRS.SetFromUserInput("urn:ogc:def:crs:EPSG::4326"),
+                  OGRERR_NONE);
+        EXPECT_EQ(GetEPSGCode(oSRS), 4326);
+    }
+
+    OSRClearCRSCache();
+    OSRGetCRSCacheStatistics(&nHits, &nMisses, &nEntries);
+    EXPECT_EQ(nHits, 0);
+    EXPECT_EQ(nMisses, 0);
+    EXPECT_EQ(nEntries, 0);
+
+    // Objects can still be built after clearing the cache
+    {
+        OGRSpatialReference oSRS;
+        EXPECT_EQ(oSRS.importFromEPSG(32631), OGRERR_NONE);
+        EXPECT_EQ(oSRS.exportToWkt(), osWKT);
+    }
+}
 }  // namespace
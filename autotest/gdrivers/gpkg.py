@@ -4348,3 +4348,91 @@ def test_gpkg_rename_raster_table(data_type, tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert "weird" not in content
+
+
+###############################################################################
+# Test multi-threaded tile encoding and decoding
+
+
+@pytest.mark.parametrize(
+    "data_type,tile_format",
+    [
+        (gdal.GDT_Byte, "PNG"),
+        (gdal.GDT_Byte, "JPEG"),
+        (gdal.GDT_UInt16, "PNG"),
+        (gdal.GDT_Float32, "TIFF"),
+    ],
+)
+def test_gpkg_multithreaded_tile_encoding_decoding(tmp_vsimem, data_type, tile_format):
+
+    drv_name = "GTiff" if tile_format == "TIFF" else tile_format
+    if gdal.GetDriverByName(drv_name) is None:
+        pytest.skip(f"Driver {drv_name} is missing")
+
+    if data_type == gdal.GDT_Byte:
+        src_ds = gdal.Translate("", "data/small_world.tif", format="MEM")
+    else:
+        src_ds = gdal.Translate(
+            "",
+            "data/small_world.tif",
+            format="MEM",
+            bandList=[1],
+            outputType=data_type,
+        )
+
+    def create(filename, num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdaltest.gpkg_dr.CreateCopy(
+                filename,
+                src_ds,
+                options=[
+                    "TILE_FORMAT=" + tile_format,
+                    "BLOCKSIZE=64",
+                    "RASTER_TABLE=small_world",
+                ],
+            )
+            ds.BuildOverviews("NEAR", [2, 4])
+            ds = None
+
+    def tiles(filename):
+        ds = ogr.Open(filename)
+        sql_lyr = ds.ExecuteSQL(
+            "SELECT zoom_level, tile_column, tile_row, tile_data FROM small_world "
+            "ORDER BY zoom_level, tile_column, tile_row"
+        )
+        ret = [
+            (f["zoom_level"], f["tile_column"], f["tile_row"], f["tile_data"])
+            for f in sql_lyr
+        ]
+        ds.ReleaseResultSet(sql_lyr)
+        return ret
+
+    filename_st = str(tmp_vsimem / "single_thread.gpkg")
+    filename_mt = str(tmp_vsimem / "multi_thread.gpkg")
+    create(filename_st, "1")
+    create(filename_mt, "4")
+    assert tiles(filename_mt) == tiles(filename_st)
+
+    ds = gdal.Open(filename_st)
+    expected_data = ds.ReadRaster()
+    expected_cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)]
+    ds = None
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        # Dataset level and band level requests
+        ds = gdal.Open(filename_st)
+        assert ds.ReadRaster() == expected_data
+        ds = None
+        ds = gdal.Open(filename_st)
+        assert [
+            ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+        ] == expected_cs
+
+    # Test the decoded tile cache, used when GDAL blocks do not match tiles
+    def read_shifted():
+        ds = gdal.OpenEx(filename_st, open_options=["MINX=-160", "MAXY=80"])
+        return ds.ReadRaster()
+
+    with gdal.config_option("GPKG_DECODED_TILE_CACHE_SIZE", "0"):
+        expected_data = read_shifted()
+    assert read_shifted() == expected_data
@@ -3133,6 +3133,184 @@ def test_ogr_csv_force_opening(tmp_vsimem):
     assert ds.GetDriver().GetDescription() == "CSV"
 
 
+###############################################################################
+# Test that reading by chunks gives the same result as reading line by line
+
+
+@pytest.mark.parametrize(
+    "chunk_size,num_threads", [("1", "1"), ("100", "1"), (None, "1"), (None, "4")]
+)
+def test_ogr_csv_chunked_reading(tmp_vsimem, chunk_size, num_threads):
+
+    filename = str(tmp_vsimem / "test_ogr_csv_chunked_reading.csv")
+    content = b"\xef\xbb\xbfid,str,other\r\n"
+    content += b'1,"multi\nline",a\r\n'
+    content += b"\r\n"
+    content += b'2,"with ""quotes""","crlf\r\ninside"\n'
+    content += b'3,mid"quo"te,\n'
+    content += b"".join(b"%d,val%d,x\n" % (i, i) for i in range(4, 5000))
+    content += b'5000,"last",no_newline'
+    gdal.FileFromMemBuffer(filename, content)
+
+    def read_all():
+        ds = gdal.OpenEx(filename, open_options=["NUM_THREADS=" + num_threads])
+        lyr = ds.GetLayer(0)
+        ret = [(f.GetFID(), f["id"], f["str"], f["other"]) for f in lyr]
+        lyr.ResetReading()
+        assert lyr.GetFeatureCount() == len(ret)
+        assert lyr.GetFeature(3)["str"] == ret[2][2]
+        return ret
+
+    with gdal.config_option("OGR_CSV_CHUNK_SIZE", "0"):
+        expected = read_all()
+    assert len(expected) == 5000
+    assert expected[0] == (1, "1", "multi\nline", "a")
+    assert expected[1] == (2, "2", 'with "quotes"', "crlf\ninside")
+    assert expected[2] == (3, "3", 'mid"quo"te', "")
+
+    with gdal.config_option("OGR_CSV_CHUNK_SIZE", chunk_size):
+        assert read_all() == expected
+
+
+###############################################################################
+# Test that records that cannot be read by chunks are read line by line
+
+
+def test_ogr_csv_chunked_reading_fallback(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_ogr_csv_chunked_reading_fallback.csv")
+    gdal.FileFromMemBuffer(filename, b"id,str\n1,a\n2,b\x00c\n3,d\n")
+
+    for chunk_size in ("0", "1", None):
+        with gdal.config_option("OGR_CSV_CHUNK_SIZE", chunk_size):
+            ds = ogr.Open(filename)
+            lyr = ds.GetLayer(0)
+            assert [f["str"] for f in lyr] == ["a", "b", "d"]
+
+    gdal.FileFromMemBuffer(filename, b"id,s\n1,a\n2,too_long\n3,d\n")
+    with gdal.config_option("OGR_CSV_CHUNK_SIZE", "1"):
+        ds = gdal.OpenEx(filename, open_options=["MAX_LINE_SIZE=5"])
+        lyr = ds.GetLayer(0)
+        with gdal.quiet_errors():
+            assert [f["s"] for f in lyr] == ["a"]
+        assert "Maximum number of characters allowed reached" in (
+            gdal.GetLastErrorMsg()
+        )
+
+
+###############################################################################
+# Test the optimized GetArrowStream() implementation against the generic one
+
+
+@pytest.mark.parametrize("with_z", [False, True])
+def test_ogr_csv_arrow_stream_optimized_vs_generic(tmp_vsimem, with_z):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_csv_arrow_stream_optimized.csv")
+    gdal.FileFromMemBuffer(
+        filename,
+        "str,int,int64,real,bool,x,y,z\n"
+        + '"h\u00e9llo\nworld",-123,1234567890123,1.5,true,2,49,10\n'
+        + ",,,,,,,\n"
+        + 'x,1.5,1,"2,5",0,-1.25,0,\n'
+        + "y,1,2,3,1,foo,0,1\n"
+        + "z\n",
+    )
+    gdal.FileFromMemBuffer(
+        filename[0:-3] + "csvt",
+        "String,Integer,Integer64,Real,Integer(Boolean),Real,Real,Real",
+    )
+
+    open_options = ["X_POSSIBLE_NAMES=x", "Y_POSSIBLE_NAMES=y"]
+    if with_z:
+        open_options.append("Z_POSSIBLE_NAMES=z")
+    ds = gdal.OpenEx(filename, open_options=open_options)
+    lyr = ds.GetLayer(0)
+
+    def get_batches():
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=2"])
+        return [{k: v.tolist() for k, v in batch.items()} for batch in stream]
+
+    for ignored_fields in ([], ["str", "bool"], ["OGR_GEOMETRY", "int"]):
+        lyr.SetIgnoredFields(ignored_fields)
+
+        with gdal.quiet_errors():
+            optimized = get_batches()
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "YES"
+        )
+
+        lyr.SetAttributeFilter("1 = 1")
+        with gdal.quiet_errors():
+            generic = get_batches()
+        lyr.SetAttributeFilter(None)
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "NO"
+        )
+
+        assert len(optimized) == 3
+        assert optimized[0]["OGC_FID"] == [1, 2]
+        assert optimized[2]["OGC_FID"] == [5]
+        assert optimized == generic
+
+
+###############################################################################
+# Test that ogr2ogr reading a CSV file, which recycles the source features
+# through GetNextFeatureInto(), does not leak values from a feature into the
+# next one
+
+
+@pytest.mark.parametrize(
+    "where,spat", [(None, None), ("id <> '3'", None), (None, [0.5, 0.5, 4.5, 4.5])]
+)
+def test_ogr_csv_ogr2ogr_recycled_features(tmp_vsimem, where, spat):
+
+    filename = str(tmp_vsimem / "test.csv")
+    gdal.FileFromMemBuffer(
+        filename,
+        """id,str,int,WKT
+1,foo,1,POINT (1 1)
+2,,,
+3,bar,,"LINESTRING (1 1,2 2,3 3)"
+4,,4,POINT (4 4)
+5,baz,5,"POLYGON ((0 0,0 1,1 1,0 0))"
+6,,,POINT (6 6)
+""",
+    )
+
+    out_ds = gdal.VectorTranslate(
+        "", filename, format="Memory", where=where, spatFilter=spat
+    )
+    out_lyr = out_ds.GetLayer(0)
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetAttributeFilter(where)
+    if spat:
+        lyr.SetSpatialFilterRect(*spat)
+    expected = [
+        (f["id"], f["str"], f["int"], f.GetGeometryRef().ExportToWkt())
+        if f.GetGeometryRef()
+        else (f["id"], f["str"], f["int"], None)
+        for f in lyr
+    ]
+    assert expected
+    got = [
+        (f["id"], f["str"], f["int"], f.GetGeometryRef().ExportToWkt())
+        if f.GetGeometryRef()
+        else (f["id"], f["str"], f["int"], None)
+        for f in out_lyr
+    ]
+    assert got == expected
+
+
 ###############################################################################
 
 
@@ -1419,3 +1419,133 @@ def test_ogr_flatgeobuf_write_mismatch_geom_type(tmp_vsimem):
         match="ICreateFeature: Mismatched geometry type. Feature geometry type is Line String, expected layer geometry type is Point",
     ):
         lyr.CreateFeature(f)
+
+
+###############################################################################
+# Test that external sorting of the spatial index items, when they do not
+# fit in OGR_FLATGEOBUF_SORT_MAX_MEMORY, gives the same file as in-memory
+# sorting
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_flatgeobuf_write_external_sort(tmp_vsimem, num_threads):
+    def create(filename):
+        ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+        lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+        for i in range(1000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["id"] = i
+            # Make sure to have several features at the same location
+            x = (i * 37) % 101
+            y = (i * 53) % 97
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({x} {y})"))
+            lyr.CreateFeature(f)
+        ds = None
+
+    filename_ref = str(tmp_vsimem / "ref.fgb")
+    with gdaltest.config_option("OGR_FLATGEOBUF_NUM_THREADS", num_threads):
+        create(filename_ref)
+
+    filename = str(tmp_vsimem / "test.fgb")
+    # About 190 items per run
+    with gdaltest.config_options(
+        {
+            "OGR_FLATGEOBUF_NUM_THREADS": num_threads,
+            "OGR_FLATGEOBUF_SORT_MAX_MEMORY": "0.01",
+        }
+    ):
+        create(filename)
+
+    assert gdal.VSIStatL(filename).size == gdal.VSIStatL(filename_ref).size
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, gdal.VSIStatL(filename).size, f)
+    gdal.VSIFCloseL(f)
+    f = gdal.VSIFOpenL(filename_ref, "rb")
+    data_ref = gdal.VSIFReadL(1, gdal.VSIStatL(filename_ref).size, f)
+    gdal.VSIFCloseL(f)
+    assert data == data_ref
+
+    # Temporary files have been removed
+    assert sorted(gdal.ReadDir(str(tmp_vsimem))) == ["ref.fgb", "test.fgb"]
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 1000
+    lyr.SetSpatialFilterRect(10, 10, 20, 20)
+    ids = sorted(f["id"] for f in lyr)
+    assert ids == sorted(
+        i
+        for i in range(1000)
+        if 10 <= (i * 37) % 101 <= 20 and 10 <= (i * 53) % 97 <= 20
+    )
+
+
+###############################################################################
+# Test that reading features with several threads gives the same result as
+# with a single thread
+
+
+@pytest.mark.parametrize("spatial_index", ["YES", "NO"])
+def test_ogr_flatgeobuf_read_multithreaded(tmp_vsimem, spatial_index):
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer(
+        "test",
+        geom_type=ogr.wkbLineString,
+        options=["SPATIAL_INDEX=" + spatial_index],
+    )
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(3000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f["str"] = "x" * (i % 10)
+        x = i % 100
+        y = i // 100
+        wkt = f"LINESTRING ({x} {y},{x + 1} {y + 1})"
+        f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    ds = None
+
+    def read(num_threads, spat_filter=None, attr_filter=None):
+        with gdaltest.config_option("OGR_FLATGEOBUF_NUM_THREADS", num_threads):
+            ds = ogr.Open(filename)
+            lyr = ds.GetLayer(0)
+            if spat_filter:
+                lyr.SetSpatialFilterRect(*spat_filter)
+            if attr_filter:
+                lyr.SetAttributeFilter(attr_filter)
+            ret = [
+                (f.GetFID(), f["id"], f["str"], f.GetGeometryRef().ExportToWkt())
+                for f in lyr
+            ]
+            # Iterate again after ResetReading()
+            assert [f.GetFID() for f in lyr] == [x[0] for x in ret]
+            return ret
+
+    for spat_filter, attr_filter in [
+        (None, None),
+        ((10.5, 3.5, 20.5, 25.5), None),
+        (None, "id % 7 = 0"),
+        ((10.5, 3.5, 20.5, 25.5), "id % 7 = 0"),
+    ]:
+        ref = read("1", spat_filter, attr_filter)
+        assert ref
+        assert read("4", spat_filter, attr_filter) == ref
+
+    with gdaltest.config_option("OGR_FLATGEOBUF_NUM_THREADS", "4"):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        # Interleave sequential reading with GetFeature()
+        f = lyr.GetNextFeature()
+        assert f.GetFID() == 0
+        if spatial_index == "YES":
+            assert lyr.GetFeature(1234)["id"] == 1234
+            # GetFeature() resets sequential reading
+            f = lyr.GetNextFeature()
+            assert f.GetFID() == 0
+        else:
+            f = lyr.GetNextFeature()
+            assert f.GetFID() == 1
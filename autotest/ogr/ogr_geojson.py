@@ -5300,3 +5300,94 @@ def test_ogr_geojson_force_opening_stacta():
 
     ds = gdal.OpenEx("../gdrivers/data/stacta/test.json", allowed_drivers=["GeoJSON"])
     assert ds.GetDriver().GetDescription() == "GeoJSON"
+
+
+###############################################################################
+# Test that features built directly from the streaming parser events are the
+# same as the ones built from json-c objects
+
+
+@gdaltest.disable_exceptions()
+@pytest.mark.parametrize(
+    "open_options",
+    [
+        [],
+        ["NATIVE_DATA=YES"],
+        ["FLATTEN_NESTED_ATTRIBUTES=YES"],
+        ["ARRAY_AS_STRING=YES"],
+    ],
+)
+def test_ogr_geojson_read_features_without_jsonc(tmp_vsimem, open_options):
+
+    filename = str(tmp_vsimem / "test.json")
+    gdal.FileFromMemBuffer(
+        filename,
+        """{"type": "FeatureCollection", "features": [
+{"type": "Feature", "id": 1, "properties": {"int": 1, "int64": 1234567890123,
+ "real": 1.5, "str": "foo", "bool": true, "list": [1, 2], "obj": {"a": 1},
+ "date": "2024-01-02", "strlist": ["a", "b"], "reallist": [1.5, 2]},
+ "geometry": {"type": "Point", "coordinates": [1, 2]}},
+{"type": "Feature", "id": 2, "properties": {"int": 12345678901234567890,
+ "int64": -9223372036854775808, "real": 1e300, "str": 1.25, "bool": false,
+ "list": 3, "obj": null, "date": null, "strlist": "c", "reallist": 3},
+ "geometry": {"type": "LineString", "coordinates": [[1, 2], [3, 4, 5]]}},
+{"type": "Feature", "id": 3, "properties": {"int": 1.5, "int64": "12",
+ "real": 2, "str": true, "bool": 1, "list": [true, null], "obj": [1],
+ "reallist": [-0.0, 1e-5, 123456789.123456789]},
+ "geometry": {"type": "Polygon", "coordinates": [[[0, 0], [0, 1], [1, 1], [0, 0]],
+ [[0.1, 0.1], [0.1, 0.2, 3], [0.2, 0.2], [0.1, 0.1]]]}},
+{"type": "Feature", "id": "4", "properties": {"int": null, "real": "1.5",
+ "str": {"x": "y"}, "unknown": 1},
+ "geometry": {"type": "MultiPoint", "coordinates": [[1, 2], [3, 4, 5]]}},
+{"type": "Feature", "properties": {"str": "\\u00e9\\n"},
+ "geometry": {"type": "MultiLineString", "coordinates": [[[1, 2], [3, 4]], []]}},
+{"type": "Feature", "properties": {},
+ "geometry": {"type": "MultiPolygon",
+ "coordinates": [[[[0, 0], [0, 1], [1, 1], [0, 0]]], []]}},
+{"type": "Feature", "properties": {},
+ "geometry": {"type": "GeometryCollection", "geometries": [
+ {"type": "Point", "coordinates": [1, 2]}]}},
+{"type": "Feature", "properties": {},
+ "geometry": {"type": "Point", "coordinates": [1, 2],
+ "crs": {"type": "name", "properties": {"name": "EPSG:32631"}}}},
+{"type": "Feature", "properties": {},
+ "geometry": {"type": "Point", "coordinates": [1, "2"]}},
+{"type": "Feature", "properties": {},
+ "geometry": {"type": "LineString", "coordinates": [[1, 2], null]}},
+{"type": "Feature", "properties": {}, "geometry": {"type": "Point"}},
+{"type": "Feature", "properties": {}, "geometry": {"type": "Unknown"}},
+{"type": "Feature", "properties": {}, "geometry": null},
+{"type": "Feature", "properties": {}},
+{"type": "Feature", "properties": null, "geometry": null},
+{"type": "Feature", "properties": {"str": "a"}, "properties": {"str": "b"},
+ "geometry": null},
+{"type": "Feature", "Geometry": {"type": "Point", "coordinates": [5, 6]},
+ "properties": {"str": "c", "str": "d"}},
+{"type": "Feature", "properties": {"int": 5}, "type": "NotAFeature"}
+]}""",
+    )
+
+    def get_features():
+        ret = []
+        with gdal.quiet_errors():
+            ds = gdal.OpenEx(filename, open_options=open_options)
+            lyr = ds.GetLayer(0)
+            for f in lyr:
+                g = f.GetGeometryRef()
+                ret.append(
+                    (
+                        f.GetFID(),
+                        [f.GetField(i) for i in range(f.GetFieldCount())],
+                        [f.IsFieldNull(i) for i in range(f.GetFieldCount())],
+                        g.ExportToIsoWkt() if g else None,
+                        g.GetSpatialReference().ExportToWkt() if g else None,
+                        f.GetNativeData(),
+                    )
+                )
+        return ret
+
+    with gdaltest.config_option("OGR_GEOJSON_READ_FEATURES_WITHOUT_JSONC", "NO"):
+        ref_features = get_features()
+    assert len(ref_features) == 17
+
+    assert get_features() == ref_features
@@ -515,3 +515,57 @@ def test_ogr_geojsonseq_force_opening(tmp_vsimem):
 
     drv = gdal.IdentifyDriverEx("http://example.com", allowed_drivers=["GeoJSONSeq"])
     assert drv.GetDescription() == "GeoJSONSeq"
+
+
+###############################################################################
+# Test NUM_THREADS open option
+
+
+@gdaltest.disable_exceptions()
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_ogr_geojsonseq_num_threads(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test.geojsonl")
+    with gdaltest.vsi_open(filename, "wb") as f:
+        for i in range(2500):
+            if i == 1000:
+                f.write(b"foo\n")
+            elif i % 100 == 7:
+                f.write(b'{"type":"Point","coordinates":[%d,%d]}\n' % (i, -i))
+            else:
+                f.write(
+                    b'{"type":"Feature","properties":{"int":%d,"str":"s%d",'
+                    b'"real":%d.5,"list":[%d,%d]},'
+                    b'"geometry":{"type":"LineString","coordinates":'
+                    b"[[%d,%d],[%d.25,%d,%d]]}}\n" % (i, i, i, i, i, i, i, i, i, i)
+                )
+
+    def get_features_and_errors(open_options):
+        errors = []
+
+        def error_handler(eclass, code, msg):
+            if eclass != gdal.CE_Debug:
+                errors.append(msg)
+
+        ret = []
+        with gdaltest.error_handler(error_handler):
+            ds = gdal.OpenEx(filename, open_options=open_options)
+            lyr = ds.GetLayer(0)
+            errors.clear()
+            for f in lyr:
+                ret.append(
+                    (
+                        f.GetFID(),
+                        [f.GetField(i) for i in range(f.GetFieldCount())],
+                        f.GetGeometryRef().ExportToIsoWkt(),
+                    )
+                )
+        return ret, errors
+
+    ref_features, ref_errors = get_features_and_errors(["NUM_THREADS=1"])
+    assert len(ref_features) == 2499
+    assert len(ref_errors) == 1
+
+    features, errors = get_features_and_errors(["NUM_THREADS=" + num_threads])
+    assert features == ref_features
+    assert errors == ref_errors
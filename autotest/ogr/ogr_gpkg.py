@@ -8408,6 +8408,69 @@ def test_ogr_gpkg_arrow_stream_numpy_multi_threading(
     assert i == num_features
 
 
+###############################################################################
+# Test multi-threaded Arrow interface with holes in FID numbering, attribute
+# filter and PRESERVE_ORDER=NO
+
+
+@pytest.mark.parametrize("attr_filter", [None, "val % 2 = 0"])
+@pytest.mark.parametrize("preserve_order", ["YES", "NO"])
+def test_ogr_gpkg_arrow_stream_numpy_multi_threading_fid_holes(
+    tmp_vsimem, attr_filter, preserve_order
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    lyr.StartTransaction()
+    for i in range(1, 1001):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["val"] = i
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    # Delete every third feature, and a whole range of features
+    ds.ExecuteSQL("DELETE FROM test WHERE fid % 3 = 0 OR fid BETWEEN 200 AND 350")
+    ds = None
+
+    expected_fids = [i for i in range(1, 1001) if i % 3 != 0 and not (200 <= i <= 350)]
+    if attr_filter:
+        expected_fids = [i for i in expected_fids if i % 2 == 0]
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    if attr_filter:
+        lyr.SetAttributeFilter(attr_filter)
+    with gdaltest.config_option("OGR_GPKG_NUM_THREADS", "4"):
+        stream = lyr.GetArrowStreamAsNumPy(
+            options=[
+                "USE_MASKED_ARRAYS=NO",
+                "MAX_FEATURES_IN_BATCH=50",
+                f"PRESERVE_ORDER={preserve_order}",
+            ]
+        )
+
+    got_fids = []
+    for batch in stream:
+        assert len(batch["fid"]) > 0
+        for fid, val, wkb in zip(batch["fid"], batch["val"], batch["geom"]):
+            assert val == fid
+            assert (
+                ogr.CreateGeometryFromWkb(wkb).ExportToIsoWkt()
+                == f"POINT ({fid} {fid})"
+            )
+            got_fids.append(fid)
+
+    if preserve_order == "YES":
+        assert got_fids == expected_fids
+    else:
+        assert sorted(got_fids) == expected_fids
+
+
 ###############################################################################
 # Test Arrow interface with bool fields
 
@@ -9980,6 +10043,171 @@ def test_ogr_gpkg_write_arrow_fallback_types(tmp_vsimem):
     assert f.GetGeometryRef().ExportToIsoWkt() == "POINT (1 2)"
 
 
+###############################################################################
+# Test native WriteArrowBatch() implementation, against the generic one
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("base_impl", [False, True])
+def test_ogr_gpkg_write_arrow_native(tmp_vsimem, base_impl):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test")
+    src_lyr.CreateField(ogr.FieldDefn("string", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    src_lyr.CreateField(fld_defn)
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+    wkts = [
+        "POINT (1 2)",
+        "LINESTRING Z (1 2 3,4 5 6)",
+        "POLYGON ((0 0,0 1,1 1,0 0))",
+        "MULTIPOLYGON M (((0 0 1,0 -1 2,-1 -1 3,0 0 1)))",
+        "POINT EMPTY",
+        "CIRCULARSTRING (0 0,1 1,2 0)",
+        "GEOMETRYCOLLECTION (POINT (10 20))",
+        None,
+    ]
+    for i, wkt in enumerate(wkts):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        if i != 3:
+            f["string"] = f"foo{i}"
+            f["int"] = i
+            f["bool"] = i % 2
+            f["int64"] = 12345678901234 + i
+            f["real"] = 1.5 + i
+            f.SetField("binary", b"\x01\x23" * i)
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    filename = tmp_vsimem / "test_ogr_gpkg_write_arrow_native.gpkg"
+    with ogr.GetDriverByName("GPKG").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer("test")
+
+        stream = src_lyr.GetArrowStream(["INCLUDE_FID=NO"])
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() != "wkb_geometry":
+                lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+
+        with gdaltest.config_option(
+            "OGR_GPKG_WRITE_ARROW_BATCH_BASE_IMPL", "YES" if base_impl else "NO"
+        ):
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                lyr.WriteArrowBatch(schema, array)
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == len(wkts)
+        assert lyr.GetExtent() == (-1, 10, -1, 20)
+        assert lyr.GetLayerDefn().GetFieldDefn(2).GetSubType() == ogr.OFSTBoolean
+        for i, f in enumerate(lyr):
+            assert f.GetFID() == i + 1
+            if i == 3:
+                assert f.IsFieldNull("string")
+                assert f.IsFieldNull("int")
+                assert f.IsFieldNull("bool")
+                assert f.IsFieldNull("int64")
+                assert f.IsFieldNull("real")
+                assert f.IsFieldNull("binary")
+            else:
+                assert f["string"] == f"foo{i}"
+                assert f["int"] == i
+                assert f["bool"] == i % 2
+                assert f["int64"] == 12345678901234 + i
+                assert f["real"] == 1.5 + i
+                assert f.GetFieldAsBinary("binary") == b"\x01\x23" * i
+            g = f.GetGeometryRef()
+            if wkts[i]:
+                assert g.ExportToIsoWkt() == wkts[i]
+            else:
+                assert g is None
+
+        # Check that the spatial index has been correctly filled
+        lyr.SetSpatialFilterRect(3.9, 4.9, 4.1, 5.1)
+        assert [f.GetFID() for f in lyr] == [2]
+        lyr.SetSpatialFilterRect(9, 19, 11, 21)
+        assert [f.GetFID() for f in lyr] == [7]
+        lyr.SetSpatialFilter(None)
+
+        # Check the GeoPackage geometry blob headers: flags for a XYZ envelope
+        # and for an empty geometry, and envelope values
+        with ds.ExecuteSQL(
+            "SELECT hex(substr(geom, 1, 4)), ST_MinX(geom), ST_MaxY(geom) "
+            "FROM test WHERE fid IN (2, 5) ORDER BY fid"
+        ) as sql_lyr:
+            f = sql_lyr.GetNextFeature()
+            assert f.GetField(0) == "47500005"
+            assert f.GetField(1) == 1
+            assert f.GetField(2) == 5
+            f = sql_lyr.GetNextFeature()
+            assert f.GetField(0) == "47500011"
+
+        with ds.ExecuteSQL(
+            "SELECT extension_name FROM gpkg_extensions "
+            "WHERE extension_name = 'gpkg_geom_CIRCULARSTRING'"
+        ) as sql_lyr:
+            assert sql_lyr.GetFeatureCount() == 1
+
+
+###############################################################################
+# Test native WriteArrowBatch() implementation with a FID column, and the
+# rollback of a failed batch
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("fid_type", ["int32", "int64"])
+def test_ogr_gpkg_write_arrow_native_fid(tmp_vsimem, fid_type):
+    pa = pytest.importorskip("pyarrow")
+
+    def make_table(fids, coords):
+        fid = pa.array(fids, type=getattr(pa, fid_type)())
+        geom = pa.array(
+            [
+                ogr.CreateGeometryFromWkt(f"POINT ({x} {x})").ExportToWkb()
+                for x in coords
+            ],
+            type=pa.binary(),
+        )
+        int_ = pa.array(coords, type=pa.int32())
+        return fid, pa.table([fid, geom, int_], names=["fid", "geom", "int"])
+
+    filename = tmp_vsimem / "test_ogr_gpkg_write_arrow_native_fid.gpkg"
+    with ogr.GetDriverByName("GPKG").CreateDataSource(filename) as ds:
+        with gdaltest.config_option("OGR_GPKG_THREADED_RTREE_AT_FIRST_FEATURE", "YES"):
+            lyr = ds.CreateLayer("test")
+        lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+
+        fid, table = make_table([None, 10, None], [0, 1, 2])
+        lyr.WritePyArrow(table)
+        # FIDs of the created features are written back into the array
+        assert fid.to_pylist() == [1, 10, 11]
+        assert lyr.GetFeatureCount() == 3
+
+        # The second row fails because of a duplicated FID: the first row
+        # must not be counted nor be in the spatial index
+        _, table = make_table([None, 10], [100, 101])
+        with pytest.raises(Exception, match="failed to execute insert"):
+            lyr.WritePyArrow(table)
+        assert lyr.GetFeatureCount() == 3
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 3
+        assert [f["int"] for f in lyr] == [0, 1, 2]
+        lyr.SetSpatialFilterRect(-0.5, -0.5, 2.5, 2.5)
+        assert [f.GetFID() for f in lyr] == [1, 10, 11]
+        lyr.SetSpatialFilterRect(99, 99, 102, 102)
+        assert [f.GetFID() for f in lyr] == []
+
+
 ###############################################################################
 # Test a SQL request with the geometry in the first row being null
 
@@ -10549,3 +10777,62 @@ def test_gpkg_rename_hidden_table(tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert "hidden_foo_table" not in content
+
+
+###############################################################################
+# Test that features recycled by ogr2ogr when reading a GeoPackage layer
+# (GetNextFeatureInto()) do not leak values from one feature to the next
+
+
+def test_gpkg_ogr2ogr_recycled_features(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test_gpkg_ogr2ogr_recycled_features.gpkg")
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    wkts = [
+        "POINT (1 2)",
+        "POINT (3 4)",
+        None,
+        "LINESTRING (1 2,3 4,5 6)",
+        "POLYGON ((0 0,0 1,1 1,0 0))",
+        "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 2,2 2,1 1))",
+        "POLYGON ((0 0,0 1,1 1,0 0))",
+        "MULTIPOINT ((1 2),(3 4))",
+        "MULTIPOINT ((5 6))",
+    ]
+    for i, wkt in enumerate(wkts):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 2 == 0:
+            f["int"] = i
+        else:
+            f["str"] = "str%d" % i
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    ds = None
+
+    for where in (None, "fid % 3 != 0"):
+        out_ds = gdal.VectorTranslate(
+            "", filename, format="Memory", where=where, layerName="test"
+        )
+        out_lyr = out_ds.GetLayer(0)
+        expected_fids = [
+            i + 1 for i in range(len(wkts)) if where is None or (i + 1) % 3 != 0
+        ]
+        assert out_lyr.GetFeatureCount() == len(expected_fids)
+        for fid, f in zip(expected_fids, out_lyr):
+            i = fid - 1
+            if i % 2 == 0:
+                assert f["int"] == i
+                assert f.IsFieldNull("str")
+            else:
+                assert f.IsFieldNull("int")
+                assert f["str"] == "str%d" % i
+            g = f.GetGeometryRef()
+            if wkts[i]:
+                assert g.ExportToWkt() == wkts[i]
+            else:
+                assert g is None
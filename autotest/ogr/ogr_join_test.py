@@ -28,6 +28,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -547,3 +548,146 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test joins resolved with a hash table, and compare with the attribute
+# filter based approach
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        {"OGR_SQL_HASH_JOIN": "YES"},
+        {"OGR_SQL_HASH_JOIN": "NO"},
+        {"OGR_SQL_MAX_RAM_USAGE_HASH_JOIN": "1"},
+    ],
+)
+def test_ogr_join_hash_join(options):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr1 = ds.CreateLayer("lyr1")
+    lyr1.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr1.CreateField(ogr.FieldDefn("code", ogr.OFTString))
+    lyr1.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    for id, code, real in [
+        (1, "a", 1.0),
+        (2, "B", 2.5),
+        (3, "c", 3.0),
+        (None, "d", None),
+        (2, None, 2.5),
+    ]:
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        f["id"] = id
+        f["code"] = code
+        f["real"] = real
+        lyr1.CreateFeature(f)
+
+    lyr2 = ds.CreateLayer("lyr2")
+    lyr2.CreateField(ogr.FieldDefn("id", ogr.OFTInteger64))
+    lyr2.CreateField(ogr.FieldDefn("code", ogr.OFTString))
+    lyr2.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for id, code, val in [
+        (2, "b", "first_2"),
+        (1, "A", "first_1"),
+        (2, "B", "second_2"),
+        (None, "c", "null_id"),
+        (3, "C", "first_3"),
+    ]:
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        f["id"] = id
+        f["code"] = code
+        f["val"] = val
+        lyr2.CreateFeature(f)
+
+    with gdal.config_options(options):
+        with ds.ExecuteSQL(
+            "SELECT lyr2.val FROM lyr1 LEFT JOIN lyr2 ON lyr1.id = lyr2.id"
+        ) as sql_lyr:
+            assert [f["lyr2.val"] for f in sql_lyr] == [
+                "first_1",
+                "first_2",
+                "first_3",
+                None,
+                "first_2",
+            ]
+
+        # String comparisons are case insensitive
+        with ds.ExecuteSQL(
+            "SELECT lyr2.val FROM lyr1 LEFT JOIN lyr2 ON lyr2.code = lyr1.code"
+        ) as sql_lyr:
+            assert [f["lyr2.val"] for f in sql_lyr] == [
+                "first_1",
+                "first_2",
+                "null_id",
+                None,
+                None,
+            ]
+
+        # Integer vs real comparison
+        with ds.ExecuteSQL(
+            "SELECT lyr2.val FROM lyr1 LEFT JOIN lyr2 ON lyr1.real = lyr2.id"
+        ) as sql_lyr:
+            assert [f["lyr2.val"] for f in sql_lyr] == [
+                "first_1",
+                None,
+                "first_3",
+                None,
+                None,
+            ]
+
+        # Multiple keys
+        with ds.ExecuteSQL(
+            "SELECT lyr2.val FROM lyr1 LEFT JOIN lyr2 ON "
+            "lyr1.id = lyr2.id AND lyr1.code = lyr2.code"
+        ) as sql_lyr:
+            assert [f["lyr2.val"] for f in sql_lyr] == [
+                "first_1",
+                "first_2",
+                "first_3",
+                None,
+                None,
+            ]
+
+
+###############################################################################
+# Test that no hash table is built when the secondary layer evaluates
+# attribute filters natively
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize("driver_name", ["Memory", "GPKG"])
+def test_ogr_join_hash_join_native_attribute_filter(tmp_vsimem, driver_name):
+
+    ds = ogr.GetDriverByName(driver_name).CreateDataSource(
+        str(tmp_vsimem / "test.gpkg") if driver_name == "GPKG" else ""
+    )
+    lyr1 = ds.CreateLayer("lyr1", geom_type=ogr.wkbNone)
+    lyr1.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr2 = ds.CreateLayer("lyr2", geom_type=ogr.wkbNone)
+    lyr2.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr2.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for i in range(3):
+        f = ogr.Feature(lyr1.GetLayerDefn())
+        f["id"] = i
+        lyr1.CreateFeature(f)
+        f = ogr.Feature(lyr2.GetLayerDefn())
+        f["id"] = i
+        f["val"] = "val%d" % i
+        lyr2.CreateFeature(f)
+
+    debug_msgs = []
+
+    def debug_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    with gdal.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(debug_handler):
+        with ds.ExecuteSQL(
+            "SELECT lyr2.val FROM lyr1 LEFT JOIN lyr2 ON lyr1.id = lyr2.id",
+            dialect="OGRSQL",
+        ) as sql_lyr:
+            assert [f["lyr2.val"] for f in sql_lyr] == ["val0", "val1", "val2"]
+
+    hash_table_built = any("Building hash table for JOIN" in msg for msg in debug_msgs)
+    assert hash_table_built == (driver_name == "Memory")
@@ -33,7 +33,7 @@
 import ogrtest
 import pytest
 
-from osgeo import ogr
+from osgeo import gdal, ogr
 
 pytestmark = pytest.mark.require_geos
 
@@ -609,3 +609,56 @@ def test_algebra_erase_5(A, empty, C):
     assert C.GetFeatureCount() == A.GetFeatureCount(), (
         "Layer.Erase returned " + str(C.GetFeatureCount()) + " features"
     )
+
+
+###############################################################################
+# Test that the in-memory spatial index and worker threads give the same
+# results, in the same order, as setting a spatial filter on the method layer
+
+
+@pytest.mark.parametrize(
+    "method",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+def test_algebra_spatial_index_and_threads(mem_ds, method):
+    def create_grid(name, n, size, offset):
+        lyr = mem_ds.CreateLayer(name)
+        lyr.CreateField(ogr.FieldDefn(name, ogr.OFTInteger))
+        for j in range(n):
+            for i in range(n):
+                x = offset + i * size
+                y = offset + j * size
+                feat = ogr.Feature(lyr.GetLayerDefn())
+                feat.SetField(name, j * n + i)
+                x2 = x + size
+                y2 = y + size
+                wkt = f"POLYGON(({x} {y},{x} {y2},{x2} {y2},{x2} {y},{x} {y}))"
+                feat.SetGeometryDirectly(ogr.Geometry(wkt=wkt))
+                lyr.CreateFeature(feat)
+        return lyr
+
+    input_lyr = create_grid("input", 20, 1, 0)
+    method_lyr = create_grid("method", 12, 1.5, 0.25)
+    method_lyr.SetSpatialFilterRect(0, 0, 15, 12)
+
+    results = []
+    for options, max_ram_usage in (
+        (["USE_SPATIAL_INDEX=NO"], None),
+        ([], None),
+        (["NUM_THREADS=4"], None),
+        (["NUM_THREADS=4", "USE_PREPARED_GEOMETRIES=NO"], None),
+        # Too low to index the layers in memory
+        (["NUM_THREADS=4"], "1000"),
+    ):
+        result_lyr = mem_ds.CreateLayer(f"result_{len(results)}")
+        with gdal.config_option("OGR_OVERLAY_MAX_RAM_USAGE", max_ram_usage):
+            ret = getattr(input_lyr, method)(method_lyr, result_lyr, options=options)
+        assert ret == 0
+        results.append(result_lyr)
+
+    assert results[0].GetFeatureCount() > 0
+    for result_lyr in results[1:]:
+        assert is_same(results[0], result_lyr)
+
+    # The original spatial filter of the method layer is preserved
+    assert method_lyr.GetSpatialFilter() is not None
@@ -1562,7 +1562,7 @@ def test_ogr_mvt_write_errors():
         )
     assert ds is None
 
-    # Cannot create temporary database
+    # Cannot create temporary file
     gdal.RmdirRecursive("/vsimem/foo")
     with gdal.quiet_errors():
         ds = ogr.GetDriverByName("MVT").CreateDataSource(
@@ -1658,41 +1658,6 @@ def test_ogr_mvt_write_errors():
     assert gdal.GetLastErrorMsg() != ""
     gdal.RmdirRecursive("tmp/tmpmvt")
 
-    # Test failure in writing in temp db (multi-threaded)
-    gdal.RmdirRecursive("/vsimem/foo")
-    with gdaltest.config_option("OGR_MVT_REMOVE_TEMP_FILE", "NO"):
-        ds = ogr.GetDriverByName("MVT").CreateDataSource("/vsimem/foo")
-    temp_ds = ogr.Open("/vsimem/foo.temp.db", update=1)
-    temp_ds.ExecuteSQL("DROP TABLE temp")
-    temp_ds = None
-    gdal.Unlink("/vsimem/foo.temp.db")
-    lyr = ds.CreateLayer("test")
-    f = ogr.Feature(lyr.GetLayerDefn())
-    f.SetGeometry(ogr.CreateGeometryFromWkt("GEOMETRYCOLLECTION(POINT(0 0))"))
-    with gdal.quiet_errors():
-        lyr.CreateFeature(f)
-        ds = None
-    assert gdal.GetLastErrorMsg() != ""
-    gdal.RmdirRecursive("tmp/tmpmvt")
-
-    # Test failure in writing in temp db (single-threaded)
-    gdal.RmdirRecursive("/vsimem/foo")
-    with gdaltest.config_option("OGR_MVT_REMOVE_TEMP_FILE", "NO"):
-        with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
-            ds = ogr.GetDriverByName("MVT").CreateDataSource("/vsimem/foo")
-    temp_ds = ogr.Open("/vsimem/foo.temp.db", update=1)
-    temp_ds.ExecuteSQL("DROP TABLE temp")
-    temp_ds = None
-    gdal.Unlink("/vsimem/foo.temp.db")
-    lyr = ds.CreateLayer("test")
-    f = ogr.Feature(lyr.GetLayerDefn())
-    f.SetGeometry(ogr.CreateGeometryFromWkt("GEOMETRYCOLLECTION(POINT(0 0))"))
-    with gdal.quiet_errors():
-        lyr.CreateFeature(f)
-        ds = None
-    assert gdal.GetLastErrorMsg() != ""
-    gdal.RmdirRecursive("tmp/tmpmvt")
-
     # Test reprojection failure
     gdal.RmdirRecursive("/vsimem/foo")
     ds = ogr.GetDriverByName("MVT").CreateDataSource("/vsimem/foo")
@@ -1712,34 +1677,58 @@ def test_ogr_mvt_write_errors():
 
 @pytest.mark.require_driver("SQLite")
 @pytest.mark.require_geos
-def test_ogr_mvt_write_reuse_temp_db():
+def test_ogr_mvt_write_temp_file_spilling():
 
     src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
     lyr = src_ds.CreateLayer("mylayer")
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                "LINESTRING(%d %d,%d %d)"
+                % (i * 100000, -i * 50000, i * 100000 + 20000, -i * 50000 + 10000)
+            )
+        )
+        lyr.CreateFeature(f)
 
-    f = ogr.Feature(lyr.GetLayerDefn())
-    f.SetGeometry(ogr.CreateGeometryFromWkt("LINESTRING(0 0,100000 100000,200000 0)"))
-    lyr.CreateFeature(f)
-
-    with gdaltest.config_option("OGR_MVT_REMOVE_TEMP_FILE", "NO"):
-        gdal.VectorTranslate("/vsimem/out", src_ds, format="MVT")
-
-    assert gdal.VSIStatL("/vsimem/out.temp.db") is not None
-
-    gdal.RmdirRecursive("/vsimem/out")
+    gdal.VectorTranslate(
+        "/vsimem/out_ref",
+        src_ds,
+        format="MVT",
+        datasetCreationOptions=["MAXZOOM=3", "NAME=test"],
+    )
 
-    with gdaltest.config_option("OGR_MVT_REUSE_TEMP_FILE", "YES"):
-        gdal.VectorTranslate("/vsimem/out", src_ds, format="MVT")
+    # Force the temporary features to be sorted in several runs
+    with gdaltest.config_option("OGR_MVT_TEMP_MAX_MEMORY", "0.001"):
+        gdal.VectorTranslate(
+            "/vsimem/out",
+            src_ds,
+            format="MVT",
+            datasetCreationOptions=["MAXZOOM=3", "NAME=test"],
+        )
 
-    out_ds = ogr.Open("/vsimem/out/5")
-    assert out_ds is not None
-    out_lyr = out_ds.GetLayerByName("mylayer")
-    out_f = out_lyr.GetNextFeature()
-    assert out_f is not None
-    out_ds = None
+    def read(filename):
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f
+        data = gdal.VSIFReadL(1, 1000000, f)
+        gdal.VSIFCloseL(f)
+        return data
 
-    gdal.RmdirRecursive("/vsimem/out")
-    gdal.Unlink("/vsimem/out.temp.db")
+    try:
+        ref_files = sorted(gdal.ReadDirRecursive("/vsimem/out_ref"))
+        assert ref_files
+        assert sorted(gdal.ReadDirRecursive("/vsimem/out")) == ref_files
+        for filename in ref_files:
+            if filename.endswith("/"):
+                continue
+            assert read("/vsimem/out/" + filename) == read(
+                "/vsimem/out_ref/" + filename
+            ), filename
+    finally:
+        gdal.RmdirRecursive("/vsimem/out_ref")
+        gdal.RmdirRecursive("/vsimem/out")
 
 
 ###############################################################################
@@ -2849,3 +2849,87 @@ def test_ogr_openfilegdb_read_objectid_64bit_sparse_test_ogrsf(ogrsf_path):
 
     success = "INFO" in ret and "ERROR" not in ret
     assert success
+
+
+###############################################################################
+# Test that the optimized GetArrowStream() code path returns the same content
+# as the generic one
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/filegdb/testopenfilegdb.gdb.zip",
+        "data/filegdb/arcgis_pro_32_types.gdb",
+        "data/filegdb/curves.gdb",
+    ],
+)
+def test_ogr_openfilegdb_arrow_stream_optimized_vs_generic(filename, num_threads):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    ds = ogr.Open(filename)
+
+    def get_batches(lyr):
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=3"])
+        return [{k: v.tolist() for k, v in batch.items()} for batch in stream]
+
+    for lyr in ds:
+        # e.g. layers with a non-nullable geometry field
+        if not lyr.TestCapability(ogr.OLCFastGetArrowStream):
+            continue
+
+        with gdal.config_option("OGR_OPENFILEGDB_NUM_THREADS", num_threads):
+            optimized = get_batches(lyr)
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "YES"
+        ), lyr.GetName()
+
+        with gdal.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+            generic = get_batches(lyr)
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "NO"
+        )
+
+        assert optimized == generic, lyr.GetName()
+
+        # Ignore the geometry and the first field
+        ignored_fields = ["OGR_GEOMETRY"]
+        if lyr.GetLayerDefn().GetFieldCount() > 0:
+            ignored_fields.append(lyr.GetLayerDefn().GetFieldDefn(0).GetName())
+        lyr.SetIgnoredFields(ignored_fields)
+
+        with gdal.config_option("OGR_OPENFILEGDB_NUM_THREADS", num_threads):
+            optimized = get_batches(lyr)
+        with gdal.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+            generic = get_batches(lyr)
+        assert optimized == generic, lyr.GetName()
+
+        # Interrupted stream, while worker threads may still be running
+        with gdal.config_option("OGR_OPENFILEGDB_NUM_THREADS", num_threads):
+            stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=1"])
+            for batch in stream:
+                break
+        lyr.ResetReading()
+        del stream
+
+        # Repositioning in a stream, while worker threads may have decoded
+        # rows after the current one
+        if lyr.GetFeatureCount() >= 4 and lyr.TestCapability(ogr.OLCFastSetNextByIndex):
+            lyr.SetNextByIndex(2)
+            expected_fid = lyr.GetNextFeature().GetFID()
+            fid_name = lyr.GetFIDColumn() or "OGC_FID"
+            with gdal.config_option("OGR_OPENFILEGDB_NUM_THREADS", num_threads):
+                stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=1"])
+                stream.GetNextRecordBatch()
+                assert lyr.SetNextByIndex(2) == ogr.OGRERR_NONE
+                batch = stream.GetNextRecordBatch()
+            assert batch[fid_name].tolist() == [expected_fid], lyr.GetName()
+            del stream
@@ -1481,6 +1481,10 @@ def test_ogr_parquet_multiple_geom_columns():
         "string LIKE 'D'",
         "string ILIKE 'D'",
         "string LIKE 'f'",
+        "uint8 IN (1, 5)",
+        "uint8 IN (-1, 200)",
+        "string IN ('d', 'z')",
+        "float64 IN (2.5, 1e10)",
         "timestamp_ms_gmt = '2019/01/01 14:00:00.500Z'",
         "timestamp_ms_gmt < '2019/01/01 14:00:00.500Z'",
         "timestamp_s_no_tz = '2019/01/01 14:00:00'",
@@ -2368,6 +2372,59 @@ def test_ogr_parquet_arrow_stream_numpy_fast_attribute_filter(filter):
         assert fc != 0
 
 
+###############################################################################
+# Test filters that are evaluated directly on the Arrow columns
+
+
+@pytest.mark.parametrize(
+    "filter",
+    [
+        "boolean",
+        "NOT boolean",
+        "int8 IN (-1, 1)",
+        "int8 IN (-1, NULL)",
+        "int8 NOT IN (-1, NULL)",
+        "uint16 BETWEEN 10000 AND 10002",
+        "uint32 > 1000000001 OR int8 IS NULL",
+        "NOT (int32 = -1000000000 OR int8 IS NULL)",
+        "int64 < 0 AND float64 >= 2.5",
+        "uint64 IN (100000000001, 100000000003)",
+        "float32 BETWEEN 1.5 AND 3.5",
+        "float64 IN (2.5, 3.5)",
+        "int8 = 1.5",
+        "string IN ('c', 'D')",
+        "string > 'b' AND large_string < 'e'",
+        "large_string BETWEEN 'B' AND 'D'",
+        "string = NULL",
+        "struct_field.a > 1",
+        "struct_field.c.d IS NULL",
+    ],
+)
+def test_ogr_parquet_arrow_stream_numpy_columnar_attribute_filter(filter):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    ds = ogr.Open("data/parquet/test.parquet")
+    lyr = ds.GetLayer(0)
+    ignored_fields = ["decimal128", "decimal256", "time64_ns"]
+    lyr_defn = lyr.GetLayerDefn()
+    for i in range(lyr_defn.GetFieldCount()):
+        fld_defn = lyr_defn.GetFieldDefn(i)
+        if fld_defn.GetName().startswith("map_"):
+            ignored_fields.append(fld_defn.GetNameRef())
+    lyr.SetIgnoredFields(ignored_fields)
+    lyr.SetAttributeFilter(filter)
+
+    expected_fc = len([f for f in lyr])
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    fc = 0
+    for batch in stream:
+        fc += len(batch["uint8"])
+    assert fc == expected_fc
+
+
 ###############################################################################
 
 
@@ -3311,6 +3368,64 @@ def test_ogr_parquet_bbox_double():
         ds = None
 
 
+###############################################################################
+# Test that row groups selected by spatial and attribute filters give the same
+# result whether they are decoded in parallel or not
+
+
+@pytest.mark.parametrize("max_ram_usage", [None, "1"])
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_parquet_row_group_pruning_parallel_decoding(
+    tmp_vsimem, num_threads, max_ram_usage
+):
+
+    outfilename = str(tmp_vsimem / "test.parquet")
+    ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+    lyr = ds.CreateLayer(
+        "test", geom_type=ogr.wkbPoint, options=["FID=fid", "ROW_GROUP_SIZE=10"]
+    )
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(i)
+        f["val"] = i
+        f["str"] = "%03d" % i
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_fids(spatial_filter, attr_filter):
+        ds = ogr.Open(outfilename)
+        lyr = ds.GetLayer(0)
+        if spatial_filter:
+            lyr.SetSpatialFilterRect(*spatial_filter)
+        lyr.SetAttributeFilter(attr_filter)
+        fids = []
+        for f in lyr:
+            fids.append(f.GetFID())
+            # Random read while the next row groups may be being decoded
+            assert lyr.GetFeature(f.GetFID())["val"] == f["val"]
+        return fids
+
+    for spatial_filter, attr_filter, expected in [
+        ((5, 5, 34.5, 34.5), None, list(range(5, 35))),
+        ((5, 5, 34.5, 34.5), "val >= 25", list(range(25, 35))),
+        (None, "val < 15 OR val >= 95", list(range(15)) + list(range(95, 100))),
+        (None, "val IN (3, 42, 87)", [3, 42, 87]),
+        (None, "str >= '050' AND str < '073'", list(range(50, 73))),
+        ((1000, 1000, 2000, 2000), None, []),
+    ]:
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": num_threads,
+                "OGR_PARQUET_USE_THREADS": "YES",
+                "OGR_PARQUET_PREFETCH_MAX_RAM_USAGE": max_ram_usage,
+            }
+        ):
+            assert get_fids(spatial_filter, attr_filter) == expected
+
+
 ###############################################################################
 # Test GetExtent() using bbox.minx, bbox.miny, bbox.maxx, bbox.maxy fields
 # as in Overture Maps datasets 2024-04-16-beta.0
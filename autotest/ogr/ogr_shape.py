@@ -5883,7 +5883,7 @@ def test_ogr_shape_arrow_stream():
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 5
@@ -5980,7 +5980,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     )
     assert len(batches) == 0
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[0:-1])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -5989,14 +5989,14 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
     assert len(batches[0]["OGC_FID"]) == 10
     assert list(batches[0]["OGC_FID"]) == [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
 
-    # Regular code path
+    # Optimized code path
     lyr.SetIgnoredFields(ignored_fields[1:])
     stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
     batches = [batch for batch in stream]
@@ -6005,7 +6005,7 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
         lyr.GetMetadataItem(
             "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
         )
-        == "NO"
+        == "YES"
     )
     assert len(batches) == 1
     assert len(batches[0]) == 2
@@ -6077,6 +6077,110 @@ def test_ogr_shape_arrow_stream_fid_optim(tmp_vsimem):
     assert len(batches) == 0
 
 
+###############################################################################
+# Test that the optimized GetArrowStream() code path returns the same content
+# as the generic one
+
+
+@pytest.mark.parametrize(
+    "geom_type,wkt",
+    [
+        (ogr.wkbPoint, "POINT (1 2)"),
+        (ogr.wkbPoint25D, "POINT Z (1 2 3)"),
+        (ogr.wkbPointM, "POINT M (1 2 4)"),
+        (ogr.wkbPointZM, "POINT ZM (1 2 3 4)"),
+        (ogr.wkbMultiPoint, "MULTIPOINT ((1 2),(3 4))"),
+        (ogr.wkbMultiPointZM, "MULTIPOINT ZM ((1 2 3 4),(5 6 7 8))"),
+        (ogr.wkbLineString, "LINESTRING (1 2,3 4)"),
+        (ogr.wkbLineStringM, "LINESTRING M (1 2 3,4 5 6)"),
+        (
+            ogr.wkbMultiLineString25D,
+            "MULTILINESTRING Z ((1 2 3,4 5 6),(7 8 9,10 11 12))",
+        ),
+        (ogr.wkbPolygon, "POLYGON ((0 0,0 1,1 1,0 0))"),
+        (ogr.wkbPolygonZM, "POLYGON ZM ((0 0 1 2,0 1 3 4,1 1 5 6,0 0 1 2))"),
+        (
+            ogr.wkbMultiPolygon,
+            "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 0,10 1,11 1,10 0)))",
+        ),
+    ],
+)
+def test_ogr_shape_arrow_stream_optimized_vs_generic(tmp_vsimem, geom_type, wkt):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_optimized.shp")
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=geom_type, options=["AUTO_REPACK=NO"])
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+    fld_defn = ogr.FieldDefn("bool", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["str"] = "h\u00e9llo world"
+    f["int"] = -123
+    f["int64"] = 1234567890123
+    f["real"] = 1.5
+    f["date"] = "2024/03/15"
+    f["bool"] = True
+    f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+    lyr.CreateFeature(f)
+
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["str"] = "deleted"
+    lyr.CreateFeature(f)
+
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["str"] = "x"
+    f["bool"] = False
+    f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+    lyr.CreateFeature(f)
+
+    lyr.DeleteFeature(2)
+    ds.Close()
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+
+    def get_batches():
+        stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=2"])
+        return [{k: v.tolist() for k, v in batch.items()} for batch in stream]
+
+    for ignored_fields in ([], ["str", "date"], ["OGR_GEOMETRY", "int"]):
+        lyr.SetIgnoredFields(ignored_fields)
+
+        optimized = get_batches()
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "YES"
+        )
+
+        lyr.SetAttributeFilter("1 = 1")
+        generic = get_batches()
+        lyr.SetAttributeFilter(None)
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "NO"
+        )
+
+        assert len(optimized) == 2
+        assert optimized[0]["OGC_FID"] == [0, 1]
+        assert optimized[1]["OGC_FID"] == [3]
+        assert optimized == generic
+
+
 ###############################################################################
 # Test DBF Logical field type
 
@@ -2001,6 +2001,58 @@ def test_ogr_sql_on_null(where, feature_count, dialect, ds_for_test_ogr_sql_on_n
             assert sql_lyr.GetFeatureCount() == feature_count
 
 
+###############################################################################
+# Test that the compiled evaluation of attribute filters gives the same
+# results as the evaluation of the expression tree
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "intfield = 1",
+        "intfield + 1 = 2",
+        "intfield * 3 - 1 > 1",
+        "intfield / 0 = 2147483647",
+        "intfield % 2 = 1",
+        "intfield BETWEEN 0 AND 2",
+        "intfield IN (1, 2, 3)",
+        "intfield NOT IN (2, NULL)",
+        "intfield > 0 OR strfield = 'foo'",
+        "intfield > 0 OR intfield IS NULL",
+        "NOT (intfield > 0 OR realfield > 0)",
+        "intfield > 0 AND NOT intfield IS NULL",
+        "intfield + realfield > 1.5",
+        "realfield / 0 > 1",
+        "realfield IN (1.5, 2.5)",
+        "realfield BETWEEN 0.5 AND 1.5",
+        "strfield = 'FOO'",
+        "strfield <> 'foo'",
+        "strfield > 'bar'",
+        "strfield BETWEEN 'a' AND 'z'",
+        "strfield IN ('bar', 'Foo')",
+        "datetimefield IS NULL",
+        "OGR_GEOMETRY IS NULL",
+        "FID = 1",
+        "intfield * 9223372036854775807 > 0",
+    ],
+)
+def test_ogr_sql_compiled_where(where, ds_for_test_ogr_sql_on_null):
+
+    lyr = ds_for_test_ogr_sql_on_null.GetLayer(0)
+
+    def get_fids():
+        lyr.SetAttributeFilter(where)
+        ret = [f.GetFID() for f in lyr]
+        lyr.SetAttributeFilter(None)
+        return ret
+
+    with gdal.quiet_errors():
+        with gdal.config_option("OGR_SQL_COMPILED_WHERE", "NO"):
+            expected = get_fids()
+        got = get_fids()
+    assert got == expected
+
+
 def test_ogr_sql_ogr_style_hidden():
 
     ds = ogr.GetDriverByName("Memory").CreateDataSource("test_ogr_sql_ogr_style_hidden")
@@ -2102,3 +2154,246 @@ def test_ogr_sql_identifier_hidden():
     with ds.ExecuteSQL("SELECT 'foo' AS hidden FROM hidden") as sql_lyr:
         f = sql_lyr.GetNextFeature()
         assert f["hidden"] == "foo"
+
+
+###############################################################################
+# Test GROUP BY and HAVING
+
+
+@pytest.fixture()
+def group_by_ds():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("cat", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("sub", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+    for cat, sub, val in [
+        ("a", 1, 1.0),
+        ("b", 1, 10.0),
+        ("a", 2, 3.0),
+        (None, 1, 5.0),
+        ("b", 1, 20.0),
+        ("c", 2, None),
+        ("a", 1, 2.0),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["cat"] = cat
+        f["sub"] = sub
+        f["val"] = val
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (1 2)"))
+        lyr.CreateFeature(f)
+    return ds
+
+
+def _get_group_by_result(sql_lyr):
+    lyr_defn = sql_lyr.GetLayerDefn()
+    return [
+        tuple(f.GetField(i) for i in range(lyr_defn.GetFieldCount())) for f in sql_lyr
+    ]
+
+
+def test_ogr_sql_group_by_single_key(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, COUNT(*), COUNT(val), SUM(val), AVG(val), MIN(val), "
+        "MAX(val) FROM test GROUP BY cat ORDER BY cat"
+    ) as sql_lyr:
+        assert sql_lyr.GetLayerDefn().GetGeomFieldCount() == 0
+        assert sql_lyr.GetFeatureCount() == 4
+        assert _get_group_by_result(sql_lyr) == [
+            (None, 1, 1, 5.0, 5.0, 5.0, 5.0),
+            ("a", 3, 3, 6.0, 2.0, 1.0, 3.0),
+            ("b", 2, 2, 30.0, 15.0, 10.0, 20.0),
+            ("c", 1, 0, None, None, None, None),
+        ]
+
+
+def test_ogr_sql_group_by_multiple_keys(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT sub, cat, COUNT(*) FROM test WHERE cat IS NOT NULL "
+        "GROUP BY cat, sub ORDER BY sub DESC, cat"
+    ) as sql_lyr:
+        assert _get_group_by_result(sql_lyr) == [
+            (2, "a", 1),
+            (2, "c", 1),
+            (1, "a", 2),
+            (1, "b", 2),
+        ]
+
+
+def test_ogr_sql_group_by_having(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, COUNT(*) AS cnt FROM test GROUP BY cat "
+        "HAVING cnt >= 2 ORDER BY cat"
+    ) as sql_lyr:
+        assert _get_group_by_result(sql_lyr) == [("a", 3), ("b", 2)]
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat FROM test GROUP BY cat "
+        "HAVING MAX(val) > 4 AND cat <> 'a' ORDER BY cat"
+    ) as sql_lyr:
+        assert _get_group_by_result(sql_lyr) == [("b",)]
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, SUM(val) FROM test GROUP BY cat HAVING COUNT(*) = 1 "
+        "ORDER BY cat DESC LIMIT 1"
+    ) as sql_lyr:
+        assert _get_group_by_result(sql_lyr) == [("c", None)]
+
+
+def test_ogr_sql_group_by_unsorted(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT sub, COUNT(*) FROM test GROUP BY sub"
+    ) as sql_lyr:
+        assert sorted(_get_group_by_result(sql_lyr)) == [(1, 5), (2, 2)]
+        assert sql_lyr.TestCapability(ogr.OLCFastSetNextByIndex)
+        sql_lyr.SetNextByIndex(1)
+        f = sql_lyr.GetNextFeature()
+        assert f is not None
+        assert sql_lyr.GetNextFeature() is None
+
+
+@pytest.mark.parametrize("order_by", ["", " ORDER BY k DESC"])
+def test_ogr_sql_group_by_spill_to_disk(order_by):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("k", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["k"] = (i * 37) % 100
+        f["s"] = "val%03d" % i
+        lyr.CreateFeature(f)
+
+    with gdal.config_option("OGR_SQL_MAX_RAM_USAGE_GROUP_BY", "1000"):
+        with ds.ExecuteSQL(
+            "SELECT k, COUNT(*), MIN(s), MAX(s), SUM(k) FROM test GROUP BY k" + order_by
+        ) as sql_lyr:
+            res = _get_group_by_result(sql_lyr)
+
+    if order_by:
+        assert [x[0] for x in res] == list(range(99, -1, -1))
+    res = sorted(res)
+    assert len(res) == 100
+    for k, (key, count, min_s, max_s, sum_k) in enumerate(res):
+        assert key == k
+        assert count == 10
+        values = sorted("val%03d" % i for i in range(1000) if (i * 37) % 100 == k)
+        assert min_s == values[0]
+        assert max_s == values[-1]
+        assert sum_k == 10 * k
+
+
+@pytest.mark.parametrize(
+    "sql",
+    [
+        "SELECT cat, val FROM test GROUP BY cat",
+        "SELECT DISTINCT cat FROM test GROUP BY cat",
+        "SELECT cat FROM test GROUP BY cat ORDER BY sub",
+        "SELECT cat, COUNT(DISTINCT sub) FROM test GROUP BY cat",
+        "SELECT cat FROM test GROUP BY cat HAVING val > 1",
+        "SELECT cat FROM test GROUP BY non_existing",
+        "SELECT cat FROM test GROUP BY cat HAVING",
+        "SELECT cat FROM test WHERE COUNT(*) > 1",
+        "SELECT COUNT(*) + 1 FROM test",
+    ],
+)
+def test_ogr_sql_group_by_errors(group_by_ds, sql):
+
+    with pytest.raises(Exception):
+        group_by_ds.ExecuteSQL(sql)
+
+
+###############################################################################
+# Test ORDER BY with an external sort of the features
+
+
+@pytest.mark.parametrize("max_ram_usage", ["1000", "30000"])
+def test_ogr_sql_order_by_external_sort(max_ram_usage):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("dt_field", ogr.OFTDateTime))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_field"] = (i * 7) % 10
+        if i % 11 != 0:
+            f["str_field"] = "val%03d" % ((i * 13) % 100)
+        f["real_field"] = -0.5 * ((i * 17) % 50)
+        f["dt_field"] = "2024/%02d/01 12:34:%02d" % (1 + i % 12, i % 60)
+        f.SetStyleString("SYMBOL(c:#%06d)" % i)
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % i))
+        lyr.CreateFeature(f)
+
+    def get_features(sql_lyr):
+        return [
+            (
+                f.GetFID(),
+                f["int_field"],
+                f["str_field"],
+                f["real_field"],
+                f["dt_field"],
+                f.GetStyleString(),
+                f.GetGeometryRef().ExportToWkt(),
+            )
+            for f in sql_lyr
+        ]
+
+    for sql in [
+        "SELECT * FROM test ORDER BY int_field, str_field DESC",
+        "SELECT * FROM test ORDER BY real_field DESC, dt_field",
+        "SELECT * FROM test ORDER BY str_field",
+        "SELECT * FROM test WHERE int_field < 5 ORDER BY dt_field DESC, FID "
+        "LIMIT 20 OFFSET 10",
+    ]:
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            expected = get_features(sql_lyr)
+        assert expected
+
+        with gdal.config_option("OGR_SQL_MAX_RAM_USAGE_ORDER_BY", max_ram_usage):
+            with ds.ExecuteSQL(sql) as sql_lyr:
+                assert get_features(sql_lyr) == expected
+                assert get_features(sql_lyr) == expected
+
+                sql_lyr.SetNextByIndex(3)
+                f = sql_lyr.GetNextFeature()
+                assert f.GetFID() == expected[3][0]
+                f = sql_lyr.GetNextFeature()
+                assert f.GetFID() == expected[4][0]
+                sql_lyr.SetNextByIndex(1)
+                f = sql_lyr.GetNextFeature()
+                assert f.GetFID() == expected[1][0]
+
+
+###############################################################################
+# Test ORDER BY on a layer without random read
+
+
+def test_ogr_sql_order_by_no_random_read(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.geojsonl")
+    ds = ogr.GetDriverByName("GeoJSONSeq").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_field"] = (i * 3) % 10
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % i))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    assert not ds.GetLayer(0).TestCapability(ogr.OLCRandomRead)
+    with ds.ExecuteSQL("SELECT * FROM test ORDER BY int_field DESC") as sql_lyr:
+        assert [f["int_field"] for f in sql_lyr] == list(range(9, -1, -1))
+        assert [f.GetGeometryRef().GetX() for f in sql_lyr] == [
+            (x * 7) % 10 for x in range(9, -1, -1)
+        ]
@@ -3355,3 +3355,149 @@ def test_ogr_vrt_geom_coordinate_precision():
     assert prec.GetXYResolution() == 1e-5
     assert prec.GetZResolution() == 1e-3
     assert prec.GetMResolution() == 1e-2
+
+
+###############################################################################
+# Test OGRVRTSpatialIndexedLayer
+
+
+def test_ogr_vrt_spatial_indexed_layer(tmp_path):
+
+    # GeoJSON has no spatial index of its own
+    src_filename = str(tmp_path / "points.geojson")
+    with open(src_filename, "wt") as f:
+        f.write('{"type": "FeatureCollection", "features": [\n')
+        f.write(
+            ",\n".join(
+                '{"type": "Feature", "id": %d, "properties": {"val": %d}, '
+                '"geometry": {"type": "Point", "coordinates": [%d, %d]}}'
+                % (i + 1, i, i % 100, i // 100)
+                for i in range(10000)
+            )
+        )
+        f.write("]}\n")
+
+    index_filename = str(tmp_path / "points.idx")
+    vrt = f"""<OGRVRTDataSource>
+  <OGRVRTSpatialIndexedLayer>
+    <OGRVRTLayer name="points">
+      <SrcDataSource>{src_filename}</SrcDataSource>
+    </OGRVRTLayer>
+    <IndexFile>{index_filename}</IndexFile>
+  </OGRVRTSpatialIndexedLayer>
+</OGRVRTDataSource>"""
+
+    def expected_fids(bbox, attr_filter=None):
+        minx, miny, maxx, maxy = bbox
+        return [
+            i + 1
+            for i in range(10000)
+            if minx <= i % 100 <= maxx
+            and miny <= i // 100 <= maxy
+            and (attr_filter is None or attr_filter(i))
+        ]
+
+    debug_msgs = []
+
+    def debug_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    for i in range(2):
+        debug_msgs.clear()
+        with gdal.config_options(
+            {"OGR_VRT_WRITE_SPATIAL_INDEX_FILE": "YES", "CPL_DEBUG": "ON"}
+        ), gdaltest.error_handler(debug_handler):
+            ds = ogr.Open(vrt)
+            lyr = ds.GetLayer(0)
+            assert lyr.GetName() == "points"
+            assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+            assert lyr.GetFeatureCount() == 10000
+
+            for bbox in [
+                (10.5, 20.5, 12.5, 21.5),
+                (-1, -1, 0, 0),
+                (95, 95, 1000, 1000),
+                (1000, 1000, 2000, 2000),
+            ]:
+                lyr.SetSpatialFilterRect(*bbox)
+                assert [f.GetFID() for f in lyr] == expected_fids(bbox)
+                assert lyr.GetFeatureCount() == len(expected_fids(bbox))
+
+                lyr.SetAttributeFilter("val % 2 = 0")
+                assert [f.GetFID() for f in lyr] == expected_fids(
+                    bbox, lambda i: i % 2 == 0
+                )
+                lyr.SetAttributeFilter(None)
+
+            lyr.SetSpatialFilter(None)
+            assert lyr.GetFeatureCount() == 10000
+            ds = None
+
+        if i == 0:
+            # The index is built on first use, and saved
+            assert any("Building spatial index" in msg for msg in debug_msgs)
+            assert os.path.exists(index_filename)
+        else:
+            # and reused by later openings
+            assert not any("Building spatial index" in msg for msg in debug_msgs)
+            assert any("read from " + index_filename in msg for msg in debug_msgs)
+
+    # The index file is ignored once the source file has changed
+    os.utime(src_filename, (0, 0))
+    debug_msgs.clear()
+    with gdal.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(debug_handler):
+        ds = ogr.Open(vrt)
+        lyr = ds.GetLayer(0)
+        bbox = (10.5, 20.5, 12.5, 21.5)
+        lyr.SetSpatialFilterRect(*bbox)
+        assert [f.GetFID() for f in lyr] == expected_fids(bbox)
+        ds = None
+    assert any("Building spatial index" in msg for msg in debug_msgs)
+
+
+###############################################################################
+# Test that OGRVRTSpatialIndexedLayer only writes its index file when allowed,
+# and never overwrites a file that is not an index file
+
+
+def test_ogr_vrt_spatial_indexed_layer_index_file_write(tmp_path):
+
+    index_filename = str(tmp_path / "poly.idx")
+    vrt = f"""<OGRVRTDataSource>
+  <OGRVRTSpatialIndexedLayer>
+    <OGRVRTLayer name="poly">
+      <SrcDataSource>{os.path.join(os.getcwd(), "data", "poly.shp")}</SrcDataSource>
+    </OGRVRTLayer>
+    <IndexFile>{index_filename}</IndexFile>
+  </OGRVRTSpatialIndexedLayer>
+</OGRVRTDataSource>"""
+
+    def query(ds):
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(479750, 4764000, 480500, 4765000)
+        return [f.GetFID() for f in lyr]
+
+    # Not written by default
+    ds = ogr.Open(vrt)
+    assert query(ds)
+    ds = None
+    assert not os.path.exists(index_filename)
+
+    # An existing file that is not an index file is left untouched
+    open(index_filename, "wb").write(b"precious content")
+    with gdal.config_option("OGR_VRT_WRITE_SPATIAL_INDEX_FILE", "YES"):
+        ds = ogr.Open(vrt)
+        with gdal.quiet_errors():
+            assert query(ds)
+        assert "not a spatial index file" in gdal.GetLastErrorMsg()
+        ds = None
+    assert open(index_filename, "rb").read() == b"precious content"
+
+    # Written when allowed
+    os.unlink(index_filename)
+    with gdal.config_option("OGR_VRT_WRITE_SPATIAL_INDEX_FILE", "YES"):
+        ds = ogr.Open(vrt)
+        assert query(ds)
+        ds = None
+    assert open(index_filename, "rb").read(8) == b"OGRSPIDX"
@@ -2806,3 +2806,118 @@ def test_ogr2ogr_lib_two_gcps():
     f = out_lyr.GetNextFeature()
     assert f.GetGeometryRef().GetX(0) == pytest.approx(250)
     assert f.GetGeometryRef().GetY(0) == pytest.approx(350)
+
+
+###############################################################################
+# Test that processing geometries in worker threads gives the same result,
+# in the same order, as in a single thread
+
+
+@pytest.mark.parametrize("explodeCollections", [False, True])
+def test_ogr2ogr_lib_multithreaded_geometry_processing(explodeCollections):
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(3000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        x = (i % 100) * 0.1
+        y = (i // 100) * 0.1
+        if i % 3 == 0:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(f"MULTIPOINT ({x} {y},{x + 0.05} {y})")
+            )
+        elif i % 3 == 1:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({x} {y})"))
+        src_lyr.CreateFeature(f)
+
+    def get_features(ds):
+        lyr = ds.GetLayer(0)
+        return [
+            (
+                f.GetFID(),
+                f["id"],
+                f.GetGeometryRef().ExportToIsoWkt() if f.GetGeometryRef() else None,
+            )
+            for f in lyr
+        ]
+
+    options = {
+        "format": "Memory",
+        "dstSRS": "EPSG:3857",
+        "reproject": True,
+        "clipSrc": [0, 0, 5, 5],
+        "explodeCollections": explodeCollections,
+    }
+    with gdaltest.config_option("GDAL_NUM_THREADS", "1"):
+        ref_ds = gdal.VectorTranslate("", src_ds, **options)
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.VectorTranslate("", src_ds, **options)
+
+    ref_features = get_features(ref_ds)
+    assert len(ref_features) > 0
+    assert get_features(ds) == ref_features
+
+
+###############################################################################
+# Test that reprojecting geometries by batches gives the same result as
+# reprojecting them one by one
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr2ogr_lib_batch_reprojection(num_threads):
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    wkts = [
+        "POINT (2 49)",
+        "POINT Z (2 49 10)",
+        None,
+        "LINESTRING (2 49,3 50)",
+        "POLYGON ((2 49,2 50,3 50,2 49))",
+        "MULTIPOLYGON (((2 49,2 50,3 50,2 49)),((4 49,4 50,5 50,4 49)))",
+        "CIRCULARSTRING (2 49,2.5 49.5,3 49)",
+        "GEOMETRYCOLLECTION (POINT (2 49),LINESTRING (2 49,3 50))",
+        "POINT (2 91)",
+    ]
+    for i in range(1000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        wkt = wkts[i % len(wkts)]
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    dst_srs = osr.SpatialReference()
+    dst_srs.ImportFromEPSG(32631)
+    dst_srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    ct = osr.CoordinateTransformation(srs, dst_srs)
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+        with gdal.quiet_errors():
+            ds = gdal.VectorTranslate(
+                "",
+                src_ds,
+                format="Memory",
+                dstSRS="EPSG:32631",
+                reproject=True,
+                skipFailures=True,
+            )
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 1000
+    for i, f in enumerate(lyr):
+        wkt = wkts[i % len(wkts)]
+        g = f.GetGeometryRef()
+        if wkt is None or wkt == "POINT (2 91)":
+            assert g is None
+            continue
+        expected = ogr.CreateGeometryFromWkt(wkt)
+        assert expected.Transform(ct) == ogr.OGRERR_NONE
+        assert g.GetSpatialReference().IsSame(dst_srs)
+        assert g.GetGeometryType() == expected.GetGeometryType()
+        ogrtest.check_feature_geometry(g, expected, max_error=1e-6)
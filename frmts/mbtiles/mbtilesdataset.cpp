@@ -129,6 +129,14 @@ class MBTilesDataset final : public GDALPamDataset,
     virtual const char *GetMetadataItem(const char *pszName,
                                         const char *pszDomain = "") override;
 
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                             int nXSize, int nYSize, void *pData,
+                             int nBufXSize, int nBufYSize,
+                             GDALDataType eBufType, int nBandCount,
+                             BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                             GSpacing nLineSpace, GSpacing nBandSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
+
     virtual CPLErr IBuildOverviews(const char *pszResampling, int nOverviews,
                                    const int *panOverviewList, int nBandsIn,
                                    const int * /* panBandList */,
@@ -1014,6 +1022,40 @@ bool MBTilesDataset::ICanIWriteBlock()
     return true;
 }
 
+/************************************************************************/
+/*                            IRasterIO()                               */
+/************************************************************************/
+
+CPLErr MBTilesDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, int nBandCount,
+                                 BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace, GSpacing nBandSpace,
+                                 GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read && CanUseParallelDecoding(nXSize, nYSize, nBufXSize,
+                                                     nBufYSize, psExtraArg))
+    {
+        return ReadWithParallelDecoding(
+            nXOff, nYOff, nXSize, nYSize, static_cast<GByte *>(pData),
+            nLineSpace,
+            [&](int nStripYOff, int nStripYSize, GByte *pabyStripData)
+            {
+                return GDALPamDataset::IRasterIO(
+                    GF_Read, nXOff, nStripYOff, nXSize, nStripYSize,
+                    pabyStripData, nBufXSize, nStripYSize, eBufType,
+                    nBandCount, panBandMap, nPixelSpace, nLineSpace,
+                    nBandSpace, psExtraArg);
+            });
+    }
+
+    return GDALPamDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nBandCount, panBandMap, nPixelSpace,
+                                     nLineSpace, nBandSpace, psExtraArg);
+}
+
 /************************************************************************/
 /*                         IFlushCacheWithErrCode()                     */
 /************************************************************************/
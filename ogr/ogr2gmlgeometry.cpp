@@ -67,16 +67,35 @@ enum GMLSRSNameFormat
     SRSNAME_OGC_URL
 };
 
+/************************************************************************/
+/*                        MakeWktCoordinate()                           */
+/************************************************************************/
+
+static void MakeWktCoordinate(char *pszTarget, size_t nTargetSize, double x,
+                              double y, double z, bool b3D,
+                              const OGRWktOptions &coordOpts)
+
+{
+    if (OGRMakeWktCoordinateToBuffer(pszTarget, nTargetSize, x, y, z,
+                                     b3D ? 3 : 2, coordOpts) == 0)
+    {
+        // Only happens with a huge precision
+        const std::string wkt =
+            OGRMakeWktCoordinate(x, y, z, b3D ? 3 : 2, coordOpts);
+        CPLStrlcpy(pszTarget, wkt.c_str(), nTargetSize);
+    }
+}
+
 /************************************************************************/
 /*                        MakeGMLCoordinate()                           */
 /************************************************************************/
 
-static void MakeGMLCoordinate(char *pszTarget, double x, double y, double z,
-                              bool b3D, const OGRWktOptions &coordOpts)
+static void MakeGMLCoordinate(char *pszTarget, size_t nTargetSize, double x,
+                              double y, double z, bool b3D,
+                              const OGRWktOptions &coordOpts)
 
 {
-    std::string wkt = OGRMakeWktCoordinate(x, y, z, b3D ? 3 : 2, coordOpts);
-    memcpy(pszTarget, wkt.data(), wkt.size() + 1);
+    MakeWktCoordinate(pszTarget, nTargetSize, x, y, z, b3D, coordOpts);
 
     while (*pszTarget != '\0')
     {
@@ -134,9 +153,9 @@ static void AppendCoordinateList(const OGRLineString *poLine, char **ppszText,
     char szCoordinate[256] = {};
     for (int iPoint = 0; iPoint < poLine->getNumPoints(); iPoint++)
     {
-        MakeGMLCoordinate(szCoordinate, poLine->getX(iPoint),
-                          poLine->getY(iPoint), poLine->getZ(iPoint), b3D,
-                          coordOpts);
+        MakeGMLCoordinate(szCoordinate, sizeof(szCoordinate),
+                          poLine->getX(iPoint), poLine->getY(iPoint),
+                          poLine->getZ(iPoint), b3D, coordOpts);
         _GrowBuffer(*pnLength + strlen(szCoordinate) + 1, ppszText,
                     pnMaxLength);
 
@@ -211,8 +230,8 @@ static bool OGR2GMLGeometryAppend(const OGRGeometry *poGeometry,
         const auto poPoint = poGeometry->toPoint();
 
         char szCoordinate[256] = {};
-        MakeGMLCoordinate(szCoordinate, poPoint->getX(), poPoint->getY(), 0.0,
-                          false, coordOpts);
+        MakeGMLCoordinate(szCoordinate, sizeof(szCoordinate), poPoint->getX(),
+                          poPoint->getY(), 0.0, false, coordOpts);
 
         _GrowBuffer(*pnLength + strlen(szCoordinate) + 60 + nAttrsLength,
                     ppszText, pnMaxLength);
@@ -232,8 +251,8 @@ static bool OGR2GMLGeometryAppend(const OGRGeometry *poGeometry,
         const auto poPoint = poGeometry->toPoint();
 
         char szCoordinate[256] = {};
-        MakeGMLCoordinate(szCoordinate, poPoint->getX(), poPoint->getY(),
-                          poPoint->getZ(), true, coordOpts);
+        MakeGMLCoordinate(szCoordinate, sizeof(szCoordinate), poPoint->getX(),
+                          poPoint->getY(), poPoint->getZ(), true, coordOpts);
 
         _GrowBuffer(*pnLength + strlen(szCoordinate) + 70 + nAttrsLength,
                     ppszText, pnMaxLength);
@@ -456,8 +475,8 @@ CPLXMLNode *OGR_G_ExportEnvelopeToGMLTree(OGRGeometryH hGeometry)
     OGRWktOptions coordOpts;
 
     char szCoordinate[256] = {};
-    MakeGMLCoordinate(szCoordinate, sEnvelope.MinX, sEnvelope.MinY, 0.0, false,
-                      coordOpts);
+    MakeGMLCoordinate(szCoordinate, sizeof(szCoordinate), sEnvelope.MinX,
+                      sEnvelope.MinY, 0.0, false, coordOpts);
     char *pszY = strstr(szCoordinate, ",");
     // There must be more after the comma or we have an internal consistency
     // bug in MakeGMLCoordinate.
@@ -477,8 +496,8 @@ CPLXMLNode *OGR_G_ExportEnvelopeToGMLTree(OGRGeometryH hGeometry)
     /* -------------------------------------------------------------------- */
     psCoord = CPLCreateXMLNode(psBox, CXT_Element, "gml:coord");
 
-    MakeGMLCoordinate(szCoordinate, sEnvelope.MaxX, sEnvelope.MaxY, 0.0, false,
-                      coordOpts);
+    MakeGMLCoordinate(szCoordinate, sizeof(szCoordinate), sEnvelope.MaxX,
+                      sEnvelope.MaxY, 0.0, false, coordOpts);
     pszY = strstr(szCoordinate, ",") + 1;
     pszY[-1] = '\0';
 
@@ -516,17 +535,15 @@ static void AppendGML3CoordinateList(const OGRSimpleCurve *poLine,
     {
         if (bCoordSwap)
         {
-            const std::string wkt = OGRMakeWktCoordinate(
-                poLine->getY(iPoint), poLine->getX(iPoint),
-                poLine->getZ(iPoint), b3D ? 3 : 2, coordOpts);
-            memcpy(szCoordinate, wkt.data(), wkt.size() + 1);
+            MakeWktCoordinate(szCoordinate, sizeof(szCoordinate),
+                              poLine->getY(iPoint), poLine->getX(iPoint),
+                              poLine->getZ(iPoint), b3D, coordOpts);
         }
         else
         {
-            const std::string wkt = OGRMakeWktCoordinate(
-                poLine->getX(iPoint), poLine->getY(iPoint),
-                poLine->getZ(iPoint), b3D ? 3 : 2, coordOpts);
-            memcpy(szCoordinate, wkt.data(), wkt.size() + 1);
+            MakeWktCoordinate(szCoordinate, sizeof(szCoordinate),
+                              poLine->getX(iPoint), poLine->getY(iPoint),
+                              poLine->getZ(iPoint), b3D, coordOpts);
         }
         _GrowBuffer(*pnLength + strlen(szCoordinate) + 1, ppszText,
                     pnMaxLength);
@@ -647,15 +664,15 @@ static bool OGR2GML3GeometryAppend(
         char szCoordinate[256] = {};
         if (bCoordSwap)
         {
-            const auto wkt = OGRMakeWktCoordinate(
-                poPoint->getY(), poPoint->getX(), 0.0, 2, coordOpts);
-            memcpy(szCoordinate, wkt.data(), wkt.size() + 1);
+            MakeWktCoordinate(szCoordinate, sizeof(szCoordinate),
+                              poPoint->getY(), poPoint->getX(), 0.0, false,
+                              coordOpts);
         }
         else
         {
-            const auto wkt = OGRMakeWktCoordinate(
-                poPoint->getX(), poPoint->getY(), 0.0, 2, coordOpts);
-            memcpy(szCoordinate, wkt.data(), wkt.size() + 1);
+            MakeWktCoordinate(szCoordinate, sizeof(szCoordinate),
+                              poPoint->getX(), poPoint->getY(), 0.0, false,
+                              coordOpts);
         }
         _GrowBuffer(*pnLength + strlen(szCoordinate) + 60 + nAttrsLength,
                     ppszText, pnMaxLength);
@@ -676,17 +693,15 @@ static bool OGR2GML3GeometryAppend(
         char szCoordinate[256] = {};
         if (bCoordSwap)
         {
-            const auto wkt =
-                OGRMakeWktCoordinate(poPoint->getY(), poPoint->getX(),
-                                     poPoint->getZ(), 3, coordOpts);
-            memcpy(szCoordinate, wkt.data(), wkt.size() + 1);
+            MakeWktCoordinate(szCoordinate, sizeof(szCoordinate),
+                              poPoint->getY(), poPoint->getX(),
+                              poPoint->getZ(), true, coordOpts);
         }
         else
         {
-            const auto wkt =
-                OGRMakeWktCoordinate(poPoint->getX(), poPoint->getY(),
-                                     poPoint->getZ(), 3, coordOpts);
-            memcpy(szCoordinate, wkt.data(), wkt.size() + 1);
+            MakeWktCoordinate(szCoordinate, sizeof(szCoordinate),
+                              poPoint->getX(), poPoint->getY(),
+                              poPoint->getZ(), true, coordOpts);
         }
 
         _GrowBuffer(*pnLength + strlen(szCoordinate) + 70 + nAttrsLength,
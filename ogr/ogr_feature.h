@@ -1950,6 +1950,7 @@ class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
+class OGRFeatureQueryProgram;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1957,6 +1958,7 @@ class CPL_DLL OGRFeatureQuery
     OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    OGRFeatureQueryProgram *m_poProgram = nullptr;
 
     char **FieldCollector(void *, char **);
 
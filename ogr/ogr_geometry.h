@@ -62,9 +62,12 @@ typedef void *OGRGeometryH;
 /// WKT Output formatting options.
 enum class OGRWktFormat
 {
-    F,       ///< F-type formatting.
-    G,       ///< G-type formatting.
-    Default  ///< Format as F when abs(value) < 1, otherwise as G.
+    F,        ///< F-type formatting.
+    G,        ///< G-type formatting.
+    Default,  ///< Format as F when abs(value) < 1, otherwise as G.
+    /** Shortest representation that converts back to the same value. The
+     * precision is ignored. (GDAL >= 3.10) */
+    RoundTrip
 };
 
 /// Options for formatting WKT output
@@ -526,6 +529,11 @@ class CPL_DLL OGRGeometry
     GEOSGeom
     exportToGEOS(GEOSContextHandle_t hGEOSCtxt,
                  bool bRemoveEmptyParts = false) const CPL_WARN_UNUSED_RESULT;
+    //! @cond Doxygen_Suppress
+    static GEOSGeom exportToGEOSDirect(GEOSContextHandle_t hGEOSCtxt,
+                                       const OGRGeometry *poGeom,
+                                       bool &bSupported);
+    //! @endcond
     virtual OGRBoolean hasCurveGeometry(int bLookForNonLinear = FALSE) const;
     virtual OGRGeometry *getCurveGeometry(
         const char *const *papszOptions = nullptr) const CPL_WARN_UNUSED_RESULT;
@@ -4259,6 +4267,13 @@ class CPL_DLL OGRGeometryFactory
         char **papszOptions,
         const TransformWithOptionsCache &cache = TransformWithOptionsCache());
 
+    static bool transformGeometries(OGRCoordinateTransformation *poCT,
+                                    int nGeomCount,
+                                    OGRGeometry *const *papoGeoms,
+                                    OGRErr *paeErrors = nullptr,
+                                    int nThreads = 1,
+                                    bool bFallbackOnFailure = true);
+
     static OGRGeometry *
     approximateArcAngles(double dfX, double dfY, double dfZ,
                          double dfPrimaryRadius, double dfSecondaryAxis,
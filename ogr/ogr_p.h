@@ -94,6 +94,15 @@ void CPL_DLL OGRMakeWktCoordinateM(char *, double, double, double, double,
 std::string CPL_DLL OGRMakeWktCoordinateM(double, double, double, double,
                                           OGRBoolean, OGRBoolean,
                                           const OGRWktOptions &opts);
+size_t CPL_DLL OGRMakeWktCoordinateToBuffer(char *pszBuffer,
+                                            size_t nBufferSize, double, double,
+                                            double, int,
+                                            const OGRWktOptions &opts);
+size_t CPL_DLL OGRMakeWktCoordinateMToBuffer(char *pszBuffer,
+                                             size_t nBufferSize, double,
+                                             double, double, double,
+                                             OGRBoolean, OGRBoolean,
+                                             const OGRWktOptions &opts);
 
 #endif
 
@@ -104,6 +113,9 @@ void CPL_DLL OGRFormatDouble(char *pszBuffer, int nBufferLen, double dfVal,
 #ifdef OGR_GEOMETRY_H_INCLUDED
 std::string CPL_DLL OGRFormatDouble(double val, const OGRWktOptions &opts,
                                     int nDimIdx);
+size_t CPL_DLL OGRFormatDoubleToBuffer(char *pszBuffer, size_t nBufferSize,
+                                       double dfVal, const OGRWktOptions &opts,
+                                       int nDimIdx);
 #endif
 
 int OGRFormatFloat(char *pszBuffer, int nBufferLen, float fVal, int nPrecision,
@@ -43,6 +43,7 @@
 #endif
 #endif
 
+#include <atomic>
 #include <mutex>
 #include <vector>
 
@@ -336,10 +337,143 @@ OSRProjTLSCache *OSRGetProjTLSCache()
     return &l_projContext.oCache;
 }
 
+/************************************************************************/
+/*                          OSRSharedCRSCache                           */
+/************************************************************************/
+
+namespace
+{
+struct OSRSharedCRSCachePJDeleter
+{
+    void operator()(PJ *pj) const
+    {
+        proj_destroy(pj);
+    }
+};
+
+/* Process-wide cache of CRS objects, consulted when the per-thread
+ * OSRProjTLSCache misses, so that a CRS built by one thread is reused by
+ * the other ones. The cached PJ objects belong to a dedicated PROJ context,
+ * and are only accessed with the mutex held. proj_clone() shares the
+ * underlying immutable PROJ object, so handing out clones is cheap.
+ */
+struct OSRSharedCRSCache
+{
+    std::mutex oMutex{};
+    PJ_CONTEXT *ctx = nullptr;
+    bool bInit = false;
+    std::unique_ptr<lru11::Cache<
+        std::string, std::unique_ptr<PJ, OSRSharedCRSCachePJDeleter>>>
+        poCache{};
+
+    // Must be called with the mutex held. Returns false if disabled.
+    bool Init()
+    {
+        if (!bInit)
+        {
+            bInit = true;
+            const int nSize =
+                atoi(CPLGetConfigOption("OSR_CRS_CACHE_SIZE", "1000"));
+            if (nSize > 0)
+            {
+                poCache = std::make_unique<lru11::Cache<
+                    std::string,
+                    std::unique_ptr<PJ, OSRSharedCRSCachePJDeleter>>>(
+                    static_cast<size_t>(nSize), 0);
+            }
+        }
+        return poCache != nullptr;
+    }
+
+    // Must be called with the mutex held.
+    void Cleanup()
+    {
+        if (poCache)
+            poCache->clear();
+        poCache.reset();
+        if (ctx)
+            proj_context_destroy(ctx);
+        ctx = nullptr;
+        bInit = false;
+    }
+
+    ~OSRSharedCRSCache()
+    {
+        Cleanup();
+    }
+};
+}  // namespace
+
+static OSRSharedCRSCache g_oSharedCRSCache;
+static std::atomic<unsigned> g_nCRSCacheGeneration{0};
+// Statistics of the process-wide cache only: hits in the per-thread caches
+// are not counted.
+static std::atomic<GIntBig> g_nCRSCacheHits{0};
+static std::atomic<GIntBig> g_nCRSCacheMisses{0};
+
+static PJ *OSRGetPJFromSharedCache(PJ_CONTEXT *ctx, const std::string &osKey)
+{
+    std::lock_guard<std::mutex> oLock(g_oSharedCRSCache.oMutex);
+    if (!g_oSharedCRSCache.Init())
+        return nullptr;
+    auto cached = g_oSharedCRSCache.poCache->getPtr(osKey);
+    if (!cached)
+        return nullptr;
+    return proj_clone(ctx, cached->get());
+}
+
+static void OSRInsertPJInSharedCache(const std::string &osKey, const PJ *pj)
+{
+    std::lock_guard<std::mutex> oLock(g_oSharedCRSCache.oMutex);
+    if (!g_oSharedCRSCache.Init())
+        return;
+    if (!g_oSharedCRSCache.ctx)
+    {
+        g_oSharedCRSCache.ctx = proj_context_create();
+        proj_log_func(g_oSharedCRSCache.ctx, nullptr, osr_proj_logger);
+    }
+    PJ *pjClone = proj_clone(g_oSharedCRSCache.ctx, pj);
+    if (pjClone)
+    {
+        g_oSharedCRSCache.poCache->insert(
+            osKey,
+            std::unique_ptr<PJ, OSRSharedCRSCachePJDeleter>(pjClone));
+    }
+}
+
+/************************************************************************/
+/*                      OSRCleanupSharedCRSCache()                      */
+/************************************************************************/
+
+void OSRCleanupSharedCRSCache()
+{
+    std::lock_guard<std::mutex> oLock(g_oSharedCRSCache.oMutex);
+    g_oSharedCRSCache.Cleanup();
+    ++g_nCRSCacheGeneration;
+}
+
+// Discard the cached CRS objects of the process-wide cache, and of the
+// per-thread caches at their next use.
+static void OSRInvalidateCRSCache()
+{
+    std::lock_guard<std::mutex> oLock(g_oSharedCRSCache.oMutex);
+    if (g_oSharedCRSCache.poCache)
+        g_oSharedCRSCache.poCache->clear();
+    // Re-read OSR_CRS_CACHE_SIZE at next use
+    g_oSharedCRSCache.poCache.reset();
+    g_oSharedCRSCache.bInit = false;
+    ++g_nCRSCacheGeneration;
+}
+
+/************************************************************************/
+/*                           OSRProjTLSCache                            */
+/************************************************************************/
+
 void OSRProjTLSCache::clear()
 {
     m_oCacheEPSG.clear();
     m_oCacheWKT.clear();
+    m_oCacheDefinition.clear();
     m_tlsContext = nullptr;
 }
 
@@ -350,38 +484,107 @@ PJ_CONTEXT *OSRProjTLSCache::GetPJContext()
     return m_tlsContext;
 }
 
+// Discard the content of the cache if OSRClearCRSCache() has been called
+// since the last use.
+void OSRProjTLSCache::CheckGeneration()
+{
+    const unsigned nGeneration = g_nCRSCacheGeneration;
+    if (nGeneration != m_nGeneration)
+    {
+        m_oCacheEPSG.clear();
+        m_oCacheWKT.clear();
+        m_oCacheDefinition.clear();
+        m_nGeneration = nGeneration;
+    }
+}
+
+static std::string OSRGetEPSGSharedCacheKey(int nCode, bool bUseNonDeprecated,
+                                            bool bAddTOWGS84)
+{
+    return CPLSPrintf("EPSG:%d:%d:%d", nCode, bUseNonDeprecated ? 1 : 0,
+                      bAddTOWGS84 ? 1 : 0);
+}
+
 PJ *OSRProjTLSCache::GetPJForEPSGCode(int nCode, bool bUseNonDeprecated,
                                       bool bAddTOWGS84)
 {
+    CheckGeneration();
     const EPSGCacheKey key(nCode, bUseNonDeprecated, bAddTOWGS84);
     auto cached = m_oCacheEPSG.getPtr(key);
     if (cached)
-    {
         return proj_clone(GetPJContext(), cached->get());
+    PJ *pj = OSRGetPJFromSharedCache(
+        GetPJContext(),
+        OSRGetEPSGSharedCacheKey(nCode, bUseNonDeprecated, bAddTOWGS84));
+    if (pj)
+    {
+        ++g_nCRSCacheHits;
+        m_oCacheEPSG.insert(key, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+        return pj;
     }
+    ++g_nCRSCacheMisses;
     return nullptr;
 }
 
 void OSRProjTLSCache::CachePJForEPSGCode(int nCode, bool bUseNonDeprecated,
                                          bool bAddTOWGS84, PJ *pj)
 {
+    CheckGeneration();
     const EPSGCacheKey key(nCode, bUseNonDeprecated, bAddTOWGS84);
     m_oCacheEPSG.insert(key, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+    OSRInsertPJInSharedCache(
+        OSRGetEPSGSharedCacheKey(nCode, bUseNonDeprecated, bAddTOWGS84), pj);
 }
 
 PJ *OSRProjTLSCache::GetPJForWKT(const std::string &wkt)
 {
+    CheckGeneration();
     auto cached = m_oCacheWKT.getPtr(wkt);
     if (cached)
-    {
         return proj_clone(GetPJContext(), cached->get());
+    PJ *pj = OSRGetPJFromSharedCache(GetPJContext(), "WKT:" + wkt);
+    if (pj)
+    {
+        ++g_nCRSCacheHits;
+        m_oCacheWKT.insert(wkt, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+        return pj;
     }
+    ++g_nCRSCacheMisses;
     return nullptr;
 }
 
 void OSRProjTLSCache::CachePJForWKT(const std::string &wkt, PJ *pj)
 {
+    CheckGeneration();
     m_oCacheWKT.insert(wkt, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+    OSRInsertPJInSharedCache("WKT:" + wkt, pj);
+}
+
+PJ *OSRProjTLSCache::GetPJForDefinition(const std::string &osDefinition)
+{
+    CheckGeneration();
+    auto cached = m_oCacheDefinition.getPtr(osDefinition);
+    if (cached)
+        return proj_clone(GetPJContext(), cached->get());
+    PJ *pj = OSRGetPJFromSharedCache(GetPJContext(), "DEF:" + osDefinition);
+    if (pj)
+    {
+        ++g_nCRSCacheHits;
+        m_oCacheDefinition.insert(
+            osDefinition, UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+        return pj;
+    }
+    ++g_nCRSCacheMisses;
+    return nullptr;
+}
+
+void OSRProjTLSCache::CachePJForDefinition(const std::string &osDefinition,
+                                           PJ *pj)
+{
+    CheckGeneration();
+    m_oCacheDefinition.insert(osDefinition,
+                              UniquePtrPJ(proj_clone(GetPJContext(), pj)));
+    OSRInsertPJInSharedCache("DEF:" + osDefinition, pj);
 }
 
 /************************************************************************/
@@ -409,6 +612,7 @@ void OSRCleanupTLSContext()
  */
 void OSRSetPROJSearchPaths(const char *const *papszPaths)
 {
+    OSRInvalidateCRSCache();
     std::lock_guard<std::mutex> oLock(g_oSearchPathMutex);
     g_searchPathGenerationCounter++;
     g_aosSearchpaths.Assign(CSLDuplicate(papszPaths), true);
@@ -456,6 +660,7 @@ char **OSRGetPROJSearchPaths()
  */
 void OSRSetPROJAuxDbPaths(const char *const *papszAux)
 {
+    OSRInvalidateCRSCache();
     std::lock_guard<std::mutex> oLock(g_oSearchPathMutex);
     g_auxDbPathsGenerationCounter++;
     g_aosAuxDbPaths.Assign(CSLDuplicate(papszAux), true);
@@ -559,3 +764,69 @@ void OSRGetPROJVersion(int *pnMajor, int *pnMinor, int *pnPatch)
     if (pnPatch)
         *pnPatch = info.patch;
 }
+
+/************************************************************************/
+/*                          OSRClearCRSCache()                          */
+/************************************************************************/
+
+/** \brief Clear the cache of CRS objects.
+ *
+ * OGRSpatialReference::importFromEPSG(), importFromWkt() and
+ * SetFromUserInput() (for URNs, CRS URLs, PROJJSON and compound EPSG codes)
+ * cache the CRS objects they build, per thread and process-wide, so that
+ * importing the same definition again only requires cloning the cached
+ * object. Derived properties, such as the exported WKT, the axis mapping
+ * or the linear units, are not cached since they depend on the options
+ * and state of each OGRSpatialReference and are cheap to compute from the
+ * cloned object. The process-wide cache is bounded to the number of entries
+ * specified by the OSR_CRS_CACHE_SIZE configuration option (default 1000,
+ * 0 to disable it).
+ *
+ * This function discards the content of those caches, for all threads,
+ * and resets the statistics returned by OSRGetCRSCacheStatistics().
+ * It is automatically called when the PROJ search paths or auxiliary
+ * databases are changed.
+ *
+ * @since GDAL 3.10
+ */
+void OSRClearCRSCache(void)
+{
+    OSRInvalidateCRSCache();
+    g_nCRSCacheHits = 0;
+    g_nCRSCacheMisses = 0;
+}
+
+/************************************************************************/
+/*                      OSRGetCRSCacheStatistics()                      */
+/************************************************************************/
+
+/** \brief Get statistics on the cache of CRS objects.
+ *
+ * The hit and miss counts only cover lookups in the process-wide cache,
+ * that is imports that were not served by the per-thread cache of the
+ * calling thread.
+ *
+ * @param pnHits Pointer to the number of imports served from the
+ *               process-wide cache, or NULL.
+ * @param pnMisses Pointer to the number of cacheable imports that required
+ *                 building the object with PROJ, or NULL.
+ * @param pnEntries Pointer to the number of entries in the process-wide
+ *                  cache, or NULL.
+ * @see OSRClearCRSCache()
+ * @since GDAL 3.10
+ */
+void OSRGetCRSCacheStatistics(GIntBig *pnHits, GIntBig *pnMisses,
+                              int *pnEntries)
+{
+    if (pnHits)
+        *pnHits = g_nCRSCacheHits;
+    if (pnMisses)
+        *pnMisses = g_nCRSCacheMisses;
+    if (pnEntries)
+    {
+        std::lock_guard<std::mutex> oLock(g_oSharedCRSCache.oMutex);
+        *pnEntries = g_oSharedCRSCache.poCache
+                         ? static_cast<int>(g_oSharedCRSCache.poCache->size())
+                         : 0;
+    }
+}
@@ -92,8 +92,11 @@ class OSRProjTLSCache
                                     EPSGCacheKeyHasher>>
         m_oCacheEPSG{};
     lru11::Cache<std::string, UniquePtrPJ> m_oCacheWKT{};
+    lru11::Cache<std::string, UniquePtrPJ> m_oCacheDefinition{};
+    unsigned m_nGeneration = 0;
 
     PJ_CONTEXT *GetPJContext();
+    void CheckGeneration();
 
     OSRProjTLSCache(const OSRProjTLSCache &) = delete;
     OSRProjTLSCache &operator=(const OSRProjTLSCache &) = delete;
@@ -111,10 +114,15 @@ class OSRProjTLSCache
 
     PJ *GetPJForWKT(const std::string &wkt);
     void CachePJForWKT(const std::string &wkt, PJ *pj);
+
+    PJ *GetPJForDefinition(const std::string &osDefinition);
+    void CachePJForDefinition(const std::string &osDefinition, PJ *pj);
 };
 
 OSRProjTLSCache *OSRGetProjTLSCache();
 
+void OSRCleanupSharedCRSCache();
+
 void OGRCTDumpStatistics();
 
 void OSRCTCleanCache();
@@ -462,6 +462,10 @@ void CPL_DLL OSRSetPROJEnableNetwork(int enabled);
 int CPL_DLL OSRGetPROJEnableNetwork(void);
 void CPL_DLL OSRGetPROJVersion(int *pnMajor, int *pnMinor, int *pnPatch);
 
+void CPL_DLL OSRClearCRSCache(void);
+void CPL_DLL OSRGetCRSCacheStatistics(GIntBig *pnHits, GIntBig *pnMisses,
+                                      int *pnEntries);
+
 OGRSpatialReferenceH CPL_DLL CPL_STDCALL
 OSRNewSpatialReference(const char * /* = NULL */);
 OGRSpatialReferenceH CPL_DLL CPL_STDCALL OSRCloneGeogCS(OGRSpatialReferenceH);
@@ -244,8 +244,8 @@ class CPL_UNSTABLE_API swq_parse_context
   public:
     swq_parse_context()
         : nStartToken(0), pszInput(nullptr), pszNext(nullptr),
-          pszLastValid(nullptr), bAcceptCustomFuncs(FALSE), poRoot(nullptr),
-          poCurSelect(nullptr)
+          pszLastValid(nullptr), bAcceptCustomFuncs(FALSE), bInHaving(FALSE),
+          poRoot(nullptr), poCurSelect(nullptr)
     {
     }
 
@@ -254,6 +254,7 @@ class CPL_UNSTABLE_API swq_parse_context
     const char *pszNext;
     const char *pszLastValid;
     int bAcceptCustomFuncs;
+    int bInHaving;
 
     swq_expr_node *poRoot;
 
@@ -309,6 +310,7 @@ const char CPL_UNSTABLE_API *SWQFieldTypeToString(swq_field_type field_type);
 #define SWQM_SUMMARY_RECORD 1
 #define SWQM_RECORDSET 2
 #define SWQM_DISTINCT_LIST 3
+#define SWQM_GROUP_BY 4
 
 typedef enum
 {
@@ -376,6 +378,15 @@ typedef struct
     int ascending_flag;
 } swq_order_def;
 
+typedef struct
+{
+    char *table_name;
+    char *field_name;
+    int table_index;
+    int field_index;
+    swq_field_type field_type;
+} swq_group_by_def;
+
 typedef struct
 {
     int secondary_table;
@@ -441,6 +452,12 @@ class CPL_UNSTABLE_API swq_select
 
     swq_expr_node *where_expr = nullptr;
 
+    void PushGroupBy(const char *pszTableName, const char *pszFieldName);
+    int group_by_specs = 0;
+    swq_group_by_def *group_by_defs = nullptr;
+    swq_expr_node *having_expr = nullptr;
+    bool IsGroupByField(int table_index, int field_index) const;
+
     void PushOrderBy(const char *pszTableName, const char *pszFieldName,
                      int bAscending);
     int order_specs = 0;
@@ -468,6 +485,9 @@ class CPL_UNSTABLE_API swq_select
 
   private:
     bool IsFieldExcluded(int src_index, const char *table, const char *field);
+    CPLErr ParseGroupBy(swq_field_list *field_list);
+    bool ResolveHavingExpr(swq_expr_node *&poNode, swq_field_list *field_list,
+                           bool bInAggregate, bool bAllowAlias);
 
     // map of EXCLUDE columns keyed according to the index of the
     // asterisk with which it should be associated. key of -1 is
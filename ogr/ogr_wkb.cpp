@@ -1072,6 +1072,1110 @@ void OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb, size_t nWKBSize)
         pabyWkb, nWKBSize, iOffsetInOut, /* nRec = */ 0);
 }
 
+/************************************************************************/
+/*                       OGRWKBIsCollectionType()                       */
+/************************************************************************/
+
+/* Whether the geometry type is made of sub-geometries with their own WKB
+ * header. */
+static bool OGRWKBIsCollectionType(OGRwkbGeometryType eFlatType)
+{
+    return eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+           eFlatType == wkbMultiPolygon ||
+           eFlatType == wkbGeometryCollection ||
+           eFlatType == wkbCompoundCurve || eFlatType == wkbCurvePolygon ||
+           eFlatType == wkbMultiCurve || eFlatType == wkbMultiSurface ||
+           eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN;
+}
+
+/************************************************************************/
+/*                        OGRWKBGetGeometrySize()                       */
+/************************************************************************/
+
+/* Validates the structure of the WKB geometry at the start of data, and
+ * returns its size in nGeomSize. Coordinates are not read. */
+static bool OGRWKBGetGeometrySize(const GByte *data, size_t size,
+                                  size_t &nGeomSize, int nRec)
+{
+    if (size < MIN_WKB_SIZE)
+        return false;
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(data[0]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+        return false;
+    const bool bNeedSwap = OGR_SWAP(static_cast<OGRwkbByteOrder>(nByteOrder));
+
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    if (OGRReadWKBGeometryType(data, wkbVariantIso, &eGeometryType) !=
+        OGRERR_NONE)
+        return false;
+    const auto eFlatType = wkbFlatten(eGeometryType);
+    const size_t nPointSize = sizeof(double) *
+                              (2 + (OGR_GT_HasZ(eGeometryType) ? 1 : 0) +
+                               (OGR_GT_HasM(eGeometryType) ? 1 : 0));
+
+    if (eFlatType == wkbPoint)
+    {
+        if (size - WKB_PREFIX_SIZE < nPointSize)
+            return false;
+        nGeomSize = WKB_PREFIX_SIZE + nPointSize;
+        return true;
+    }
+
+    const uint32_t nCount = OGRWKBReadUInt32(data + WKB_PREFIX_SIZE, bNeedSwap);
+    size_t iOffset = MIN_WKB_SIZE;
+
+    if (eFlatType == wkbLineString || eFlatType == wkbCircularString)
+    {
+        if (nCount > (size - iOffset) / nPointSize)
+            return false;
+        nGeomSize = iOffset + nCount * nPointSize;
+        return true;
+    }
+
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        if (nCount > (size - iOffset) / sizeof(uint32_t))
+            return false;
+        for (uint32_t i = 0; i < nCount; ++i)
+        {
+            if (size - iOffset < sizeof(uint32_t))
+                return false;
+            const uint32_t nPoints =
+                OGRWKBReadUInt32(data + iOffset, bNeedSwap);
+            iOffset += sizeof(uint32_t);
+            if (nPoints > (size - iOffset) / nPointSize)
+                return false;
+            iOffset += nPoints * nPointSize;
+        }
+        nGeomSize = iOffset;
+        return true;
+    }
+
+    if (OGRWKBIsCollectionType(eFlatType))
+    {
+        if (nRec == 128)
+            return false;
+        if (nCount > (size - iOffset) / MIN_WKB_SIZE)
+            return false;
+        for (uint32_t i = 0; i < nCount; ++i)
+        {
+            size_t nSubGeomSize = 0;
+            if (!OGRWKBGetGeometrySize(data + iOffset, size - iOffset,
+                                       nSubGeomSize, nRec + 1))
+                return false;
+            iOffset += nSubGeomSize;
+        }
+        nGeomSize = iOffset;
+        return true;
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                     OGRWKBGeometryView::Init()                       */
+/************************************************************************/
+
+/** Initialize the view on a WKB geometry.
+ *
+ * The structure of the geometry is validated against the buffer size.
+ * Trailing bytes after the geometry are allowed.
+ *
+ * @param pabyWkb WKB geometry. Must remain valid during the lifetime of the
+ *                view.
+ * @param nWKBSize Size in bytes of pabyWkb.
+ * @return true in case of success.
+ */
+bool OGRWKBGeometryView::Init(const GByte *pabyWkb, size_t nWKBSize)
+{
+    m_pabyData = nullptr;
+    m_nSize = 0;
+    m_eType = wkbUnknown;
+    m_nCount = 0;
+
+    size_t nGeomSize = 0;
+    if (!OGRWKBGetGeometrySize(pabyWkb, nWKBSize, nGeomSize, 0))
+        return false;
+
+    m_bNeedSwap = OGRWKBNeedSwap(DB2_V72_FIX_BYTE_ORDER(pabyWkb[0]));
+    OGRReadWKBGeometryType(pabyWkb, wkbVariantIso, &m_eType);
+    if (wkbFlatten(m_eType) == wkbPoint)
+    {
+        const double dfX =
+            OGRWKBReadFloat64(pabyWkb + WKB_PREFIX_SIZE, m_bNeedSwap);
+        m_nCount = std::isnan(dfX) ? 0 : 1;
+    }
+    else
+    {
+        m_nCount = OGRWKBReadUInt32(pabyWkb + WKB_PREFIX_SIZE, m_bNeedSwap);
+    }
+    m_pabyData = pabyWkb;
+    m_nSize = nGeomSize;
+    return true;
+}
+
+/************************************************************************/
+/*                   OGRWKBGeometryView::IsEmpty()                      */
+/************************************************************************/
+
+/** Return whether the geometry is empty */
+bool OGRWKBGeometryView::IsEmpty() const
+{
+    if (!OGRWKBIsCollectionType(wkbFlatten(m_eType)))
+        return m_nCount == 0;
+    for (const auto &oPart : GetParts())
+    {
+        if (!oPart.IsEmpty())
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::GetPoints()                     */
+/************************************************************************/
+
+/** Return the points of a point, line string or circular string.
+ *
+ * An empty sequence is returned for other geometry types, and for an empty
+ * point.
+ */
+OGRWKBPointSequence OGRWKBGeometryView::GetPoints() const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (eFlatType == wkbPoint)
+        return OGRWKBPointSequence(m_pabyData + WKB_PREFIX_SIZE, m_nCount,
+                                   Is3D(), IsMeasured(), m_bNeedSwap);
+    if (eFlatType == wkbLineString || eFlatType == wkbCircularString)
+        return OGRWKBPointSequence(m_pabyData + MIN_WKB_SIZE, m_nCount,
+                                   Is3D(), IsMeasured(), m_bNeedSwap);
+    return OGRWKBPointSequence();
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::GetNumRings()                   */
+/************************************************************************/
+
+/** Return the number of rings of a polygon or triangle, or 0 for other
+ * geometry types. */
+uint32_t OGRWKBGeometryView::GetNumRings() const
+{
+    const auto eFlatType = wkbFlatten(m_eType);
+    return (eFlatType == wkbPolygon || eFlatType == wkbTriangle) ? m_nCount
+                                                                 : 0;
+}
+
+/************************************************************************/
+/*                   OGRWKBGeometryView::GetRings()                     */
+/************************************************************************/
+
+/** Return an iterable range over the rings of a polygon or triangle.
+ *
+ * The range is empty for other geometry types.
+ */
+OGRWKBGeometryView::Range<OGRWKBGeometryView::ConstRingIterator>
+OGRWKBGeometryView::GetRings() const
+{
+    const uint32_t nRings = GetNumRings();
+    return {ConstRingIterator(nRings ? m_pabyData + MIN_WKB_SIZE : nullptr,
+                              nRings, Is3D(), IsMeasured(), m_bNeedSwap),
+            ConstRingIterator(nullptr, 0, false, false, false)};
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::GetNumParts()                   */
+/************************************************************************/
+
+/** Return the number of sub-geometries of a multi geometry, geometry
+ * collection, compound curve, curve polygon, polyhedral surface or TIN,
+ * or 0 for other geometry types. */
+uint32_t OGRWKBGeometryView::GetNumParts() const
+{
+    return OGRWKBIsCollectionType(wkbFlatten(m_eType)) ? m_nCount : 0;
+}
+
+/************************************************************************/
+/*                   OGRWKBGeometryView::GetParts()                     */
+/************************************************************************/
+
+/** Return an iterable range over the sub-geometries of a multi geometry,
+ * geometry collection, compound curve, curve polygon, polyhedral surface or
+ * TIN.
+ *
+ * The range is empty for other geometry types.
+ */
+OGRWKBGeometryView::Range<OGRWKBGeometryView::ConstPartIterator>
+OGRWKBGeometryView::GetParts() const
+{
+    const uint32_t nParts = GetNumParts();
+    return {ConstPartIterator(nParts ? m_pabyData + MIN_WKB_SIZE : nullptr,
+                              m_pabyData + m_nSize, nParts),
+            ConstPartIterator(nullptr, nullptr, 0)};
+}
+
+/************************************************************************/
+/*                         ConstRingIterator                            */
+/************************************************************************/
+
+OGRWKBPointSequence OGRWKBGeometryView::ConstRingIterator::operator*() const
+{
+    return OGRWKBPointSequence(m_pabyData + sizeof(uint32_t),
+                               OGRWKBReadUInt32(m_pabyData, m_bNeedSwap),
+                               m_bHasZ, m_bHasM, m_bNeedSwap);
+}
+
+OGRWKBGeometryView::ConstRingIterator &
+OGRWKBGeometryView::ConstRingIterator::operator++()
+{
+    const OGRWKBPointSequence oRing(**this);
+    m_pabyData += sizeof(uint32_t) + static_cast<size_t>(oRing.size()) *
+                                         oRing.GetDimension() * sizeof(double);
+    --m_nRemaining;
+    return *this;
+}
+
+/************************************************************************/
+/*                         ConstPartIterator                            */
+/************************************************************************/
+
+OGRWKBGeometryView::ConstPartIterator::ConstPartIterator(
+    const GByte *pabyData, const GByte *pabyEnd, uint32_t nRemaining)
+    : m_pabyEnd(pabyEnd), m_nRemaining(nRemaining)
+{
+    if (m_nRemaining)
+    {
+        // Cannot fail as the parent geometry has been validated
+        CPL_IGNORE_RET_VAL(m_oCurrent.Init(
+            pabyData, static_cast<size_t>(m_pabyEnd - pabyData)));
+    }
+}
+
+OGRWKBGeometryView::ConstPartIterator &
+OGRWKBGeometryView::ConstPartIterator::operator++()
+{
+    --m_nRemaining;
+    if (m_nRemaining)
+    {
+        const GByte *pabyNext = m_oCurrent.GetData() + m_oCurrent.GetSize();
+        CPL_IGNORE_RET_VAL(m_oCurrent.Init(
+            pabyNext, static_cast<size_t>(m_pabyEnd - pabyNext)));
+    }
+    return *this;
+}
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::GetEnvelope()                   */
+/************************************************************************/
+
+/** Compute the 2D envelope of the vertices of the geometry.
+ *
+ * For curves, the envelope of the control points is returned.
+ */
+bool OGRWKBGeometryView::GetEnvelope(OGREnvelope &sEnvelope) const
+{
+    return IsValid() &&
+           OGRWKBGetBoundingBox(m_pabyData, m_nSize, sEnvelope);
+}
+
+/** Compute the 3D envelope of the vertices of the geometry.
+ *
+ * For curves, the envelope of the control points is returned.
+ */
+bool OGRWKBGeometryView::GetEnvelope(OGREnvelope3D &sEnvelope) const
+{
+    return IsValid() &&
+           OGRWKBGetBoundingBox(m_pabyData, m_nSize, sEnvelope);
+}
+
+/************************************************************************/
+/*                   OGRWKBGeometryView::GetLength()                    */
+/************************************************************************/
+
+/** Compute the length of the geometry.
+ *
+ * Same semantics as OGR_G_Length(): the length of curves is returned, and
+ * the sum of the length of curve members for multi curves and geometry
+ * collections. Other geometries have a zero length.
+ */
+bool OGRWKBGeometryView::GetLength(double &dfLength) const
+{
+    dfLength = 0;
+    if (!IsValid())
+        return false;
+
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (eFlatType == wkbLineString)
+    {
+        const auto oPoints = GetPoints();
+        for (uint32_t i = 1; i < oPoints.size(); ++i)
+        {
+            const double dfDeltaX = oPoints.GetX(i) - oPoints.GetX(i - 1);
+            const double dfDeltaY = oPoints.GetY(i) - oPoints.GetY(i - 1);
+            dfLength += sqrt(dfDeltaX * dfDeltaX + dfDeltaY * dfDeltaY);
+        }
+    }
+    else if (eFlatType == wkbCircularString)
+    {
+        // Cf OGRCircularString::get_Length()
+        const auto oPoints = GetPoints();
+        for (uint32_t i = 0; i + 2 < oPoints.size(); i += 2)
+        {
+            const double x0 = oPoints.GetX(i);
+            const double y0 = oPoints.GetY(i);
+            const double x1 = oPoints.GetX(i + 1);
+            const double y1 = oPoints.GetY(i + 1);
+            const double x2 = oPoints.GetX(i + 2);
+            const double y2 = oPoints.GetY(i + 2);
+            double R = 0.0;
+            double cx = 0.0;
+            double cy = 0.0;
+            double alpha0 = 0.0;
+            double alpha1 = 0.0;
+            double alpha2 = 0.0;
+            if (OGRGeometryFactory::GetCurveParameters(
+                    x0, y0, x1, y1, x2, y2, R, cx, cy, alpha0, alpha1, alpha2))
+            {
+                dfLength += fabs(alpha2 - alpha0) * R;
+            }
+            else
+            {
+                dfLength += sqrt((x2 - x0) * (x2 - x0) + (y2 - y0) * (y2 - y0));
+            }
+        }
+    }
+    else if (eFlatType == wkbCompoundCurve || eFlatType == wkbMultiLineString ||
+             eFlatType == wkbMultiCurve || eFlatType == wkbGeometryCollection)
+    {
+        for (const auto &oPart : GetParts())
+        {
+            const auto ePartType = wkbFlatten(oPart.GetGeometryType());
+            if (OGR_GT_IsCurve(ePartType) ||
+                OGR_GT_IsSubClassOf(ePartType, wkbMultiCurve) ||
+                ePartType == wkbGeometryCollection)
+            {
+                double dfPartLength = 0;
+                oPart.GetLength(dfPartLength);
+                dfLength += dfPartLength;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRWKBRingSignedArea2()                        */
+/************************************************************************/
+
+/* Twice the signed area of a ring, positive for counter-clockwise rings.
+ * The ring is implicitly closed. */
+static double OGRWKBRingSignedArea2(const OGRWKBPointSequence &oRing)
+{
+    const uint32_t nPoints = oRing.size();
+    if (nPoints < 3)
+        return 0;
+    // Coordinates are taken relative to the first point for better precision
+    const double dfX0 = oRing.GetX(0);
+    const double dfY0 = oRing.GetY(0);
+    double dfSum = 0;
+    double dfPrevX = 0;
+    double dfPrevY = 0;
+    for (uint32_t i = 1; i < nPoints; ++i)
+    {
+        const double dfX = oRing.GetX(i) - dfX0;
+        const double dfY = oRing.GetY(i) - dfY0;
+        dfSum += dfPrevX * dfY - dfX * dfPrevY;
+        dfPrevX = dfX;
+        dfPrevY = dfY;
+    }
+    return dfSum;
+}
+
+/************************************************************************/
+/*                    OGRWKBIsClosedPointSequence()                     */
+/************************************************************************/
+
+static bool OGRWKBIsClosedPointSequence(const OGRWKBPointSequence &oPoints)
+{
+    const uint32_t nPoints = oPoints.size();
+    return nPoints >= 2 && oPoints.GetX(0) == oPoints.GetX(nPoints - 1) &&
+           oPoints.GetY(0) == oPoints.GetY(nPoints - 1);
+}
+
+/************************************************************************/
+/*                    OGRWKBGeometryView::GetArea()                     */
+/************************************************************************/
+
+/** Compute the area of the geometry.
+ *
+ * Same semantics as OGR_G_Area(), except that false is returned for
+ * geometries with circular arcs.
+ */
+bool OGRWKBGeometryView::GetArea(double &dfArea) const
+{
+    dfArea = 0;
+    if (!IsValid())
+        return false;
+
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        // Cf OGRCurvePolygon::get_Area()
+        bool bExterior = true;
+        for (const auto &oRing : GetRings())
+        {
+            const double dfRingArea = 0.5 * fabs(OGRWKBRingSignedArea2(oRing));
+            dfArea += bExterior ? dfRingArea : -dfRingArea;
+            bExterior = false;
+        }
+        return true;
+    }
+    if (eFlatType == wkbLineString)
+    {
+        // Cf OGRSimpleCurve::get_LinearArea()
+        const auto oPoints = GetPoints();
+        if (OGRWKBIsClosedPointSequence(oPoints))
+            dfArea = 0.5 * fabs(OGRWKBRingSignedArea2(oPoints));
+        return true;
+    }
+    if (eFlatType == wkbCircularString || eFlatType == wkbCompoundCurve ||
+        eFlatType == wkbCurvePolygon)
+    {
+        return false;
+    }
+    if (OGR_GT_IsSubClassOf(eFlatType, wkbMultiSurface) ||
+        eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+    {
+        // Cf OGRGeometryCollection::get_Area()
+        for (const auto &oPart : GetParts())
+        {
+            const auto ePartType = wkbFlatten(oPart.GetGeometryType());
+            if (OGR_GT_IsSurface(ePartType) || OGR_GT_IsCurve(ePartType) ||
+                OGR_GT_IsSubClassOf(ePartType, wkbMultiSurface) ||
+                ePartType == wkbGeometryCollection)
+            {
+                double dfPartArea = 0;
+                if (!oPart.GetArea(dfPartArea))
+                    return false;
+                dfArea += dfPartArea;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      OGRWKBCentroidAccumulator                       */
+/************************************************************************/
+
+namespace
+{
+/* Accumulates the contributions of the components of each dimension, the
+ * centroid being the one of the highest dimension components, as in GEOS.
+ */
+struct OGRWKBCentroidAccumulator
+{
+    bool bHasBasePoint = false;
+    double dfBaseX = 0;
+    double dfBaseY = 0;
+
+    double dfArea = 0;
+    double dfAreaSumX = 0;
+    double dfAreaSumY = 0;
+
+    double dfLength = 0;
+    double dfLengthSumX = 0;
+    double dfLengthSumY = 0;
+
+    double dfPointCount = 0;
+    double dfPointSumX = 0;
+    double dfPointSumY = 0;
+
+    void AddPoint(double dfX, double dfY)
+    {
+        dfPointCount += 1;
+        dfPointSumX += dfX;
+        dfPointSumY += dfY;
+    }
+
+    void AddLine(const OGRWKBPointSequence &oPoints)
+    {
+        double dfLineLength = 0;
+        for (uint32_t i = 1; i < oPoints.size(); ++i)
+        {
+            const double dfX1 = oPoints.GetX(i - 1);
+            const double dfY1 = oPoints.GetY(i - 1);
+            const double dfX2 = oPoints.GetX(i);
+            const double dfY2 = oPoints.GetY(i);
+            const double dfSegLength = sqrt((dfX2 - dfX1) * (dfX2 - dfX1) +
+                                            (dfY2 - dfY1) * (dfY2 - dfY1));
+            dfLineLength += dfSegLength;
+            dfLengthSumX += dfSegLength * (dfX1 + dfX2) / 2;
+            dfLengthSumY += dfSegLength * (dfY1 + dfY2) / 2;
+        }
+        dfLength += dfLineLength;
+        if (dfLineLength == 0 && oPoints.size() > 0)
+            AddPoint(oPoints.GetX(0), oPoints.GetY(0));
+    }
+
+    void AddRing(const OGRWKBPointSequence &oRing, bool bExterior)
+    {
+        AddLine(oRing);
+
+        const uint32_t nPoints = oRing.size();
+        if (nPoints < 3)
+            return;
+        if (!bHasBasePoint)
+        {
+            bHasBasePoint = true;
+            dfBaseX = oRing.GetX(0);
+            dfBaseY = oRing.GetY(0);
+        }
+        double dfArea2 = 0;
+        double dfSumX = 0;
+        double dfSumY = 0;
+        double dfPrevX = oRing.GetX(nPoints - 1) - dfBaseX;
+        double dfPrevY = oRing.GetY(nPoints - 1) - dfBaseY;
+        for (uint32_t i = 0; i < nPoints; ++i)
+        {
+            const double dfX = oRing.GetX(i) - dfBaseX;
+            const double dfY = oRing.GetY(i) - dfBaseY;
+            const double dfCross = dfPrevX * dfY - dfX * dfPrevY;
+            dfArea2 += dfCross;
+            dfSumX += (dfPrevX + dfX) * dfCross;
+            dfSumY += (dfPrevY + dfY) * dfCross;
+            dfPrevX = dfX;
+            dfPrevY = dfY;
+        }
+        // Exterior rings contribute positively, and holes negatively,
+        // whatever their orientation.
+        const double dfSign =
+            ((dfArea2 < 0) ? -1.0 : 1.0) * (bExterior ? 1.0 : -1.0);
+        dfArea += dfSign * dfArea2 / 2;
+        dfAreaSumX += dfSign * dfSumX / 6;
+        dfAreaSumY += dfSign * dfSumY / 6;
+    }
+
+    bool Add(const OGRWKBGeometryView &oView)
+    {
+        const auto eFlatType = wkbFlatten(oView.GetGeometryType());
+        if (eFlatType == wkbPoint)
+        {
+            const auto oPoints = oView.GetPoints();
+            if (oPoints.size())
+                AddPoint(oPoints.GetX(0), oPoints.GetY(0));
+            return true;
+        }
+        if (eFlatType == wkbLineString)
+        {
+            AddLine(oView.GetPoints());
+            return true;
+        }
+        if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+        {
+            bool bExterior = true;
+            for (const auto &oRing : oView.GetRings())
+            {
+                AddRing(oRing, bExterior);
+                bExterior = false;
+            }
+            return true;
+        }
+        if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+            eFlatType == wkbMultiPolygon ||
+            eFlatType == wkbGeometryCollection ||
+            eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN ||
+            eFlatType == wkbMultiCurve || eFlatType == wkbMultiSurface)
+        {
+            for (const auto &oPart : oView.GetParts())
+            {
+                if (!Add(oPart))
+                    return false;
+            }
+            return true;
+        }
+        return false;
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                  OGRWKBGeometryView::GetCentroid()                   */
+/************************************************************************/
+
+/** Compute the centroid of the geometry.
+ *
+ * As with OGRGeometry::Centroid(), only the components of highest
+ * dimension contribute to the centroid. Returns false for empty geometries
+ * and for geometries with circular arcs.
+ */
+bool OGRWKBGeometryView::GetCentroid(double &dfX, double &dfY) const
+{
+    if (!IsValid())
+        return false;
+    OGRWKBCentroidAccumulator oAcc;
+    if (!oAcc.Add(*this))
+        return false;
+    if (oAcc.dfArea != 0)
+    {
+        dfX = oAcc.dfBaseX + oAcc.dfAreaSumX / oAcc.dfArea;
+        dfY = oAcc.dfBaseY + oAcc.dfAreaSumY / oAcc.dfArea;
+    }
+    else if (oAcc.dfLength > 0)
+    {
+        dfX = oAcc.dfLengthSumX / oAcc.dfLength;
+        dfY = oAcc.dfLengthSumY / oAcc.dfLength;
+    }
+    else if (oAcc.dfPointCount > 0)
+    {
+        dfX = oAcc.dfPointSumX / oAcc.dfPointCount;
+        dfY = oAcc.dfPointSumY / oAcc.dfPointCount;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRWKBPointOnSegment()                        */
+/************************************************************************/
+
+static bool OGRWKBPointOnSegment(double dfX, double dfY, double dfX1,
+                                 double dfY1, double dfX2, double dfY2)
+{
+    return dfX >= std::min(dfX1, dfX2) && dfX <= std::max(dfX1, dfX2) &&
+           dfY >= std::min(dfY1, dfY2) && dfY <= std::max(dfY1, dfY2) &&
+           (dfX2 - dfX1) * (dfY - dfY1) == (dfY2 - dfY1) * (dfX - dfX1);
+}
+
+/************************************************************************/
+/*                         OGRWKBPointInRing()                          */
+/************************************************************************/
+
+/* Returns 1 if the point is strictly inside the ring, 0 if it is on its
+ * boundary and -1 if it is outside. The ring is implicitly closed. */
+static int OGRWKBPointInRing(const OGRWKBPointSequence &oRing, double dfX,
+                             double dfY)
+{
+    const uint32_t nPoints = oRing.size();
+    if (nPoints == 0)
+        return -1;
+    bool bInside = false;
+    double dfX1 = oRing.GetX(nPoints - 1);
+    double dfY1 = oRing.GetY(nPoints - 1);
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        const double dfX2 = oRing.GetX(i);
+        const double dfY2 = oRing.GetY(i);
+        if (OGRWKBPointOnSegment(dfX, dfY, dfX1, dfY1, dfX2, dfY2))
+            return 0;
+        if ((dfY2 > dfY) != (dfY1 > dfY) &&
+            dfX < dfX1 + (dfY - dfY1) * (dfX2 - dfX1) / (dfY2 - dfY1))
+        {
+            bInside = !bInside;
+        }
+        dfX1 = dfX2;
+        dfY1 = dfY2;
+    }
+    return bInside ? 1 : -1;
+}
+
+/************************************************************************/
+/*                        OGRWKBPointInPolygon()                        */
+/************************************************************************/
+
+/* Returns whether the point is inside or on the boundary of the polygon */
+static bool OGRWKBPointInPolygon(const OGRWKBGeometryView &oPolygon,
+                                 double dfX, double dfY)
+{
+    bool bExterior = true;
+    for (const auto &oRing : oPolygon.GetRings())
+    {
+        const int nRet = OGRWKBPointInRing(oRing, dfX, dfY);
+        if (nRet == 0)
+            return true;
+        if (bExterior && nRet < 0)
+            return false;
+        if (!bExterior && nRet > 0)
+            return false;
+        bExterior = false;
+    }
+    return !bExterior;
+}
+
+/************************************************************************/
+/*                OGRWKBGeometryView::IntersectsPoint()                 */
+/************************************************************************/
+
+/** Test whether the geometry intersects a point.
+ *
+ * Points on the boundary of polygons are considered as intersecting.
+ *
+ * @param dfX X coordinate of the point.
+ * @param dfY Y coordinate of the point.
+ * @param[out] bIntersects Result of the test.
+ * @return false if the test could not be done (geometry with circular arcs).
+ */
+bool OGRWKBGeometryView::IntersectsPoint(double dfX, double dfY,
+                                         bool &bIntersects) const
+{
+    bIntersects = false;
+    if (!IsValid())
+        return false;
+
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (eFlatType == wkbPoint)
+    {
+        const auto oPoints = GetPoints();
+        bIntersects = oPoints.size() == 1 && oPoints.GetX(0) == dfX &&
+                      oPoints.GetY(0) == dfY;
+        return true;
+    }
+    if (eFlatType == wkbLineString)
+    {
+        const auto oPoints = GetPoints();
+        if (oPoints.size() == 1)
+        {
+            bIntersects = oPoints.GetX(0) == dfX && oPoints.GetY(0) == dfY;
+        }
+        for (uint32_t i = 1; !bIntersects && i < oPoints.size(); ++i)
+        {
+            bIntersects = OGRWKBPointOnSegment(
+                dfX, dfY, oPoints.GetX(i - 1), oPoints.GetY(i - 1),
+                oPoints.GetX(i), oPoints.GetY(i));
+        }
+        return true;
+    }
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        bIntersects = OGRWKBPointInPolygon(*this, dfX, dfY);
+        return true;
+    }
+    if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+        eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN ||
+        eFlatType == wkbMultiCurve || eFlatType == wkbMultiSurface)
+    {
+        bool bUnsupportedPart = false;
+        for (const auto &oPart : GetParts())
+        {
+            bool bPartIntersects = false;
+            if (!oPart.IntersectsPoint(dfX, dfY, bPartIntersects))
+                bUnsupportedPart = true;
+            else if (bPartIntersects)
+            {
+                bIntersects = true;
+                return true;
+            }
+        }
+        return !bUnsupportedPart;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     OGRWKBSegmentIntersectsEnvelope()                */
+/************************************************************************/
+
+/* Liang-Barsky clipping of the segment against the closed envelope */
+static bool OGRWKBSegmentIntersectsEnvelope(double dfX1, double dfY1,
+                                            double dfX2, double dfY2,
+                                            const OGREnvelope &sEnvelope)
+{
+    const double dfDX = dfX2 - dfX1;
+    const double dfDY = dfY2 - dfY1;
+    const double adfP[] = {-dfDX, dfDX, -dfDY, dfDY};
+    const double adfQ[] = {dfX1 - sEnvelope.MinX, sEnvelope.MaxX - dfX1,
+                           dfY1 - sEnvelope.MinY, sEnvelope.MaxY - dfY1};
+    double dfT0 = 0;
+    double dfT1 = 1;
+    for (int i = 0; i < 4; ++i)
+    {
+        if (adfP[i] == 0)
+        {
+            if (adfQ[i] < 0)
+                return false;
+        }
+        else
+        {
+            const double dfR = adfQ[i] / adfP[i];
+            if (adfP[i] < 0)
+            {
+                if (dfR > dfT1)
+                    return false;
+                dfT0 = std::max(dfT0, dfR);
+            }
+            else
+            {
+                if (dfR < dfT0)
+                    return false;
+                dfT1 = std::min(dfT1, dfR);
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 OGRWKBPointSequenceIntersectsEnvelope()              */
+/************************************************************************/
+
+static bool
+OGRWKBPointSequenceIntersectsEnvelope(const OGRWKBPointSequence &oPoints,
+                                      const OGREnvelope &sEnvelope,
+                                      bool bClose)
+{
+    const uint32_t nPoints = oPoints.size();
+    if (nPoints == 0)
+        return false;
+    double dfX1 = oPoints.GetX(0);
+    double dfY1 = oPoints.GetY(0);
+    if (dfX1 >= sEnvelope.MinX && dfX1 <= sEnvelope.MaxX &&
+        dfY1 >= sEnvelope.MinY && dfY1 <= sEnvelope.MaxY)
+    {
+        return true;
+    }
+    for (uint32_t i = 1; i <= nPoints; ++i)
+    {
+        if (i == nPoints && !bClose)
+            break;
+        const uint32_t j = i < nPoints ? i : 0;
+        const double dfX2 = oPoints.GetX(j);
+        const double dfY2 = oPoints.GetY(j);
+        if (OGRWKBSegmentIntersectsEnvelope(dfX1, dfY1, dfX2, dfY2, sEnvelope))
+            return true;
+        dfX1 = dfX2;
+        dfY1 = dfY2;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*               OGRWKBGeometryView::IntersectsEnvelope()               */
+/************************************************************************/
+
+/** Test whether the geometry intersects a (closed) envelope.
+ *
+ * Contrary to OGRWKBIntersectsPessimistic(), the test is exact for
+ * geometries made of linear components.
+ *
+ * @param sEnvelope Envelope.
+ * @param[out] bIntersects Result of the test.
+ * @return false if the test could not be done (geometry with circular arcs).
+ */
+bool OGRWKBGeometryView::IntersectsEnvelope(const OGREnvelope &sEnvelope,
+                                            bool &bIntersects) const
+{
+    bIntersects = false;
+    if (!IsValid())
+        return false;
+
+    const auto eFlatType = wkbFlatten(m_eType);
+    if (eFlatType == wkbPoint || eFlatType == wkbLineString)
+    {
+        bIntersects = OGRWKBPointSequenceIntersectsEnvelope(
+            GetPoints(), sEnvelope, /* bClose = */ false);
+        return true;
+    }
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        for (const auto &oRing : GetRings())
+        {
+            if (OGRWKBPointSequenceIntersectsEnvelope(oRing, sEnvelope,
+                                                      /* bClose = */ true))
+            {
+                bIntersects = true;
+                return true;
+            }
+        }
+        // No edge crosses the envelope: it is either completely inside
+        // or completely outside of the polygon.
+        bIntersects =
+            OGRWKBPointInPolygon(*this, sEnvelope.MinX, sEnvelope.MinY);
+        return true;
+    }
+    if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+        eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN ||
+        eFlatType == wkbMultiCurve || eFlatType == wkbMultiSurface)
+    {
+        bool bUnsupportedPart = false;
+        for (const auto &oPart : GetParts())
+        {
+            bool bPartIntersects = false;
+            if (!oPart.IntersectsEnvelope(sEnvelope, bPartIntersects))
+                bUnsupportedPart = true;
+            else if (bPartIntersects)
+            {
+                bIntersects = true;
+                return true;
+            }
+        }
+        return !bUnsupportedPart;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     OGRWKBForEachPointSequence()                     */
+/************************************************************************/
+
+/* Calls the callback on each point sequence of the geometry, with a
+ * pointer to its first coordinate, its number of points, whether it has
+ * a Z component, its number of coordinates per point and whether values
+ * need to be byte-swapped. */
+template <class Func>
+static bool OGRWKBForEachPointSequence(const OGRWKBGeometryView &oView,
+                                       Func &&func)
+{
+    const auto eFlatType = wkbFlatten(oView.GetGeometryType());
+    const bool bHasZ = oView.Is3D();
+    const int nDim = 2 + (bHasZ ? 1 : 0) + (oView.IsMeasured() ? 1 : 0);
+    const bool bNeedSwap =
+        OGRWKBNeedSwap(DB2_V72_FIX_BYTE_ORDER(oView.GetData()[0]));
+    if (eFlatType == wkbPoint)
+    {
+        const auto oPoints = oView.GetPoints();
+        return oPoints.size() == 0 ||
+               func(oView.GetData() + WKB_PREFIX_SIZE, 1, bHasZ, nDim,
+                    bNeedSwap);
+    }
+    if (eFlatType == wkbLineString || eFlatType == wkbCircularString)
+    {
+        return func(oView.GetData() + MIN_WKB_SIZE, oView.GetPoints().size(),
+                    bHasZ, nDim, bNeedSwap);
+    }
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        const GByte *pabyData = oView.GetData() + MIN_WKB_SIZE;
+        for (uint32_t i = 0; i < oView.GetNumRings(); ++i)
+        {
+            const uint32_t nPoints = OGRWKBReadUInt32(pabyData, bNeedSwap);
+            pabyData += sizeof(uint32_t);
+            if (!func(pabyData, nPoints, bHasZ, nDim, bNeedSwap))
+                return false;
+            pabyData += static_cast<size_t>(nPoints) * nDim * sizeof(double);
+        }
+        return true;
+    }
+    for (const auto &oPart : oView.GetParts())
+    {
+        if (!OGRWKBForEachPointSequence(oPart, func))
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            OGRWKBSwapXY()                            */
+/************************************************************************/
+
+/** Swap in place the X and Y coordinates of a WKB geometry.
+ *
+ * @return false if the WKB geometry is invalid.
+ * @since GDAL 3.10
+ */
+bool OGRWKBSwapXY(GByte *pabyWkb, size_t nWKBSize)
+{
+    OGRWKBGeometryView oView;
+    if (!oView.Init(pabyWkb, nWKBSize))
+        return false;
+    return OGRWKBForEachPointSequence(
+        oView,
+        [pabyWkb](const GByte *pabyPoints, uint32_t nPoints, bool, int nDim,
+                  bool)
+        {
+            // The view is on pabyWkb, so this is safe
+            GByte *pabyIter = pabyWkb + (pabyPoints - pabyWkb);
+            for (uint32_t i = 0; i < nPoints; ++i)
+            {
+                GByte abyTmp[sizeof(double)];
+                memcpy(abyTmp, pabyIter, sizeof(double));
+                memcpy(pabyIter, pabyIter + sizeof(double), sizeof(double));
+                memcpy(pabyIter + sizeof(double), abyTmp, sizeof(double));
+                pabyIter += nDim * sizeof(double);
+            }
+            return true;
+        });
+}
+
+/************************************************************************/
+/*                          OGRWKBTransform()                           */
+/************************************************************************/
+
+/** Transform in place the coordinates of a WKB geometry.
+ *
+ * Coordinates are transformed by batches, without allocating a temporary
+ * geometry. Circular arcs are transformed as their control points.
+ *
+ * @return false if the WKB geometry is invalid or if the transformation of
+ * a point failed, in which case the geometry may be partially transformed.
+ * @since GDAL 3.10
+ */
+bool OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
+                     OGRCoordinateTransformation *poCT)
+{
+    OGRWKBGeometryView oView;
+    if (!oView.Init(pabyWkb, nWKBSize))
+        return false;
+    return OGRWKBForEachPointSequence(
+        oView,
+        [pabyWkb, poCT](const GByte *pabyPoints, uint32_t nPoints, bool bHasZ,
+                        int nDim, bool bNeedSwap)
+        {
+            constexpr uint32_t CHUNK_SIZE = 64;
+            double adfX[CHUNK_SIZE];
+            double adfY[CHUNK_SIZE];
+            double adfZ[CHUNK_SIZE];
+            int abSuccess[CHUNK_SIZE];
+            GByte *pabyIter = pabyWkb + (pabyPoints - pabyWkb);
+            const size_t nPointSize = nDim * sizeof(double);
+            for (uint32_t iStart = 0; iStart < nPoints; iStart += CHUNK_SIZE)
+            {
+                const uint32_t nChunk =
+                    std::min(CHUNK_SIZE, nPoints - iStart);
+                for (uint32_t i = 0; i < nChunk; ++i)
+                {
+                    const GByte *pabyPoint = pabyIter + i * nPointSize;
+                    adfX[i] = OGRWKBReadFloat64(pabyPoint, bNeedSwap);
+                    adfY[i] = OGRWKBReadFloat64(pabyPoint + sizeof(double),
+                                                bNeedSwap);
+                    if (bHasZ)
+                        adfZ[i] = OGRWKBReadFloat64(
+                            pabyPoint + 2 * sizeof(double), bNeedSwap);
+                }
+                if (!poCT->Transform(nChunk, adfX, adfY,
+                                     bHasZ ? adfZ : nullptr, abSuccess))
+                {
+                    return false;
+                }
+                for (uint32_t i = 0; i < nChunk; ++i)
+                {
+                    if (!abSuccess[i])
+                        return false;
+                    GByte *pabyPoint = pabyIter + i * nPointSize;
+                    if (bNeedSwap)
+                    {
+                        CPL_SWAP64PTR(&adfX[i]);
+                        CPL_SWAP64PTR(&adfY[i]);
+                        if (bHasZ)
+                            CPL_SWAP64PTR(&adfZ[i]);
+                    }
+                    memcpy(pabyPoint, &adfX[i], sizeof(double));
+                    memcpy(pabyPoint + sizeof(double), &adfY[i],
+                           sizeof(double));
+                    if (bHasZ)
+                        memcpy(pabyPoint + 2 * sizeof(double), &adfZ[i],
+                               sizeof(double));
+                }
+                pabyIter += nChunk * nPointSize;
+            }
+            return true;
+        });
+}
+
 /************************************************************************/
 /*                         OGRAppendBuffer()                            */
 /************************************************************************/
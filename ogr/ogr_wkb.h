@@ -62,6 +62,282 @@ void CPL_DLL OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb,
 const GByte CPL_DLL *WKBFromEWKB(GByte *pabyEWKB, size_t nEWKBSize,
                                  size_t &nWKBSizeOut, int *pnSRIDOut);
 
+class OGRCoordinateTransformation;
+
+bool CPL_DLL OGRWKBSwapXY(GByte *pabyWkb, size_t nWKBSize);
+
+bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
+                             OGRCoordinateTransformation *poCT);
+
+/************************************************************************/
+/*                        OGRWKBPointSequence                           */
+/************************************************************************/
+
+/** Read-only view of a sequence of points stored in a WKB buffer, that is
+ * the points of a line string, a circular string or a polygon ring.
+ *
+ * No copy of the coordinates is done.
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL OGRWKBPointSequence
+{
+  public:
+    /** Constructor of an empty sequence */
+    OGRWKBPointSequence() = default;
+
+    /** Constructor.
+     *
+     * @param pabyData Pointer to the first coordinate of the first point.
+     * @param nPoints Number of points.
+     * @param bHasZ Whether points have a Z component.
+     * @param bHasM Whether points have a M component.
+     * @param bNeedSwap Whether coordinates must be byte-swapped.
+     */
+    OGRWKBPointSequence(const GByte *pabyData, uint32_t nPoints, bool bHasZ,
+                        bool bHasM, bool bNeedSwap)
+        : m_pabyData(pabyData), m_nPoints(nPoints),
+          m_nDim(2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0)), m_bHasZ(bHasZ),
+          m_bHasM(bHasM), m_bNeedSwap(bNeedSwap)
+    {
+    }
+
+    /** Return the number of points */
+    inline uint32_t size() const
+    {
+        return m_nPoints;
+    }
+
+    /** Return the number of coordinates per point (2, 3 or 4) */
+    inline int GetDimension() const
+    {
+        return m_nDim;
+    }
+
+    /** Return the X coordinate of point i */
+    inline double GetX(uint32_t i) const
+    {
+        return Read(i, 0);
+    }
+
+    /** Return the Y coordinate of point i */
+    inline double GetY(uint32_t i) const
+    {
+        return Read(i, 1);
+    }
+
+    /** Return the Z coordinate of point i, or 0 if there is no Z */
+    inline double GetZ(uint32_t i) const
+    {
+        return m_bHasZ ? Read(i, 2) : 0.0;
+    }
+
+    /** Return the M coordinate of point i, or 0 if there is no M */
+    inline double GetM(uint32_t i) const
+    {
+        return m_bHasM ? Read(i, m_bHasZ ? 3 : 2) : 0.0;
+    }
+
+  private:
+    const GByte *m_pabyData = nullptr;
+    uint32_t m_nPoints = 0;
+    int m_nDim = 2;
+    bool m_bHasZ = false;
+    bool m_bHasM = false;
+    bool m_bNeedSwap = false;
+
+    inline double Read(uint32_t i, int iOrdinate) const
+    {
+        double dfVal;
+        memcpy(&dfVal,
+               m_pabyData + (static_cast<size_t>(i) * m_nDim + iOrdinate) *
+                                sizeof(double),
+               sizeof(double));
+        if (m_bNeedSwap)
+            CPL_SWAP64PTR(&dfVal);
+        return dfVal;
+    }
+};
+
+/************************************************************************/
+/*                        OGRWKBGeometryView                            */
+/************************************************************************/
+
+/** Read-only view of a WKB geometry.
+ *
+ * The structure of the WKB geometry is validated once by Init(), after which
+ * parts, rings and points can be iterated over without any allocation or
+ * copy. Computational methods work directly on the WKB buffer, which must
+ * remain valid during the lifetime of the view.
+ *
+ * Methods returning a bool and an output value return false when the
+ * computation is not supported on the geometry type (typically for
+ * geometries with curve components), in which case the caller should
+ * fall back to instantiating a OGRGeometry.
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL OGRWKBGeometryView
+{
+  public:
+    /** Constructor of an invalid view. Init() must be called. */
+    OGRWKBGeometryView() = default;
+
+    bool Init(const GByte *pabyWkb, size_t nWKBSize);
+
+    /** Return whether Init() has succeeded */
+    inline bool IsValid() const
+    {
+        return m_pabyData != nullptr;
+    }
+
+    /** Return the start of the WKB geometry */
+    inline const GByte *GetData() const
+    {
+        return m_pabyData;
+    }
+
+    /** Return the size in bytes of the WKB geometry, which might be less
+     * than the size of the buffer passed to Init() */
+    inline size_t GetSize() const
+    {
+        return m_nSize;
+    }
+
+    /** Return the geometry type */
+    inline OGRwkbGeometryType GetGeometryType() const
+    {
+        return m_eType;
+    }
+
+    /** Return whether the geometry has a Z component */
+    inline bool Is3D() const
+    {
+        return CPL_TO_BOOL(OGR_GT_HasZ(m_eType));
+    }
+
+    /** Return whether the geometry has a M component */
+    inline bool IsMeasured() const
+    {
+        return CPL_TO_BOOL(OGR_GT_HasM(m_eType));
+    }
+
+    bool IsEmpty() const;
+
+    /** Iterator over the rings of a polygon or triangle */
+    class CPL_DLL ConstRingIterator
+    {
+      public:
+        //! @cond Doxygen_Suppress
+        ConstRingIterator(const GByte *pabyData, uint32_t nRemaining,
+                          bool bHasZ, bool bHasM, bool bNeedSwap)
+            : m_pabyData(pabyData), m_nRemaining(nRemaining), m_bHasZ(bHasZ),
+              m_bHasM(bHasM), m_bNeedSwap(bNeedSwap)
+        {
+        }
+
+        //! @endcond
+
+        /** Return the point sequence of the current ring */
+        OGRWKBPointSequence operator*() const;
+
+        /** Advance to the next ring */
+        ConstRingIterator &operator++();
+
+        /** Compare iterators */
+        inline bool operator!=(const ConstRingIterator &other) const
+        {
+            return m_nRemaining != other.m_nRemaining;
+        }
+
+      private:
+        const GByte *m_pabyData;
+        uint32_t m_nRemaining;
+        bool m_bHasZ;
+        bool m_bHasM;
+        bool m_bNeedSwap;
+    };
+
+    class ConstPartIterator;
+
+    //! @cond Doxygen_Suppress
+    template <class Iterator> struct Range
+    {
+        Iterator m_oBegin;
+        Iterator m_oEnd;
+
+        Iterator begin() const
+        {
+            return m_oBegin;
+        }
+
+        Iterator end() const
+        {
+            return m_oEnd;
+        }
+    };
+
+    //! @endcond
+
+    OGRWKBPointSequence GetPoints() const;
+
+    uint32_t GetNumRings() const;
+    Range<ConstRingIterator> GetRings() const;
+
+    uint32_t GetNumParts() const;
+    Range<ConstPartIterator> GetParts() const;
+
+    bool GetEnvelope(OGREnvelope &sEnvelope) const;
+    bool GetEnvelope(OGREnvelope3D &sEnvelope) const;
+
+    bool GetLength(double &dfLength) const;
+    bool GetArea(double &dfArea) const;
+    bool GetCentroid(double &dfX, double &dfY) const;
+
+    bool IntersectsPoint(double dfX, double dfY, bool &bIntersects) const;
+    bool IntersectsEnvelope(const OGREnvelope &sEnvelope,
+                            bool &bIntersects) const;
+
+  private:
+    const GByte *m_pabyData = nullptr;
+    size_t m_nSize = 0;
+    OGRwkbGeometryType m_eType = wkbUnknown;
+    bool m_bNeedSwap = false;
+    uint32_t m_nCount = 0;
+};
+
+/** Iterator over the parts of a multi geometry, geometry collection,
+ * compound curve, curve polygon, polyhedral surface or TIN */
+class CPL_DLL OGRWKBGeometryView::ConstPartIterator
+{
+  public:
+    //! @cond Doxygen_Suppress
+    ConstPartIterator(const GByte *pabyData, const GByte *pabyEnd,
+                      uint32_t nRemaining);
+
+    //! @endcond
+
+    /** Return a view of the current part */
+    inline const OGRWKBGeometryView &operator*() const
+    {
+        return m_oCurrent;
+    }
+
+    /** Advance to the next part */
+    ConstPartIterator &operator++();
+
+    /** Compare iterators */
+    inline bool operator!=(const ConstPartIterator &other) const
+    {
+        return m_nRemaining != other.m_nRemaining;
+    }
+
+  private:
+    const GByte *m_pabyEnd;
+    uint32_t m_nRemaining;
+    OGRWKBGeometryView m_oCurrent{};
+};
+
 /************************************************************************/
 /*                       OGRAppendBuffer                                */
 /************************************************************************/
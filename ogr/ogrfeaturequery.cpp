@@ -32,12 +32,17 @@
 #include "ogr_feature.h"
 #include "ogr_swq.h"
 
+#include <climits>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_safemaths.hpp"
 #include "cpl_string.h"
 #include "ogr_attrind.h"
 #include "ogr_core.h"
@@ -56,6 +61,871 @@ const char *const SpecialFieldNames[SPECIAL_FIELD_COUNT] = {
 const swq_field_type SpecialFieldTypes[SPECIAL_FIELD_COUNT] = {
     SWQ_INTEGER, SWQ_STRING, SWQ_STRING, SWQ_STRING, SWQ_FLOAT};
 
+/************************************************************************/
+/*                    OGRFeatureFetcherFixFieldIndex()                  */
+/************************************************************************/
+
+static int OGRFeatureFetcherFixFieldIndex(OGRFeatureDefn *poFDefn, int nIdx)
+{
+    /* Nastry trick: if we inserted the FID column as an extra column, it is */
+    /* after regular fields, special fields and geometry fields */
+    if (nIdx == poFDefn->GetFieldCount() + SPECIAL_FIELD_COUNT +
+                    poFDefn->GetGeomFieldCount())
+    {
+        return poFDefn->GetFieldCount() + SPF_FID;
+    }
+    return nIdx;
+}
+
+/************************************************************************/
+/*                        OGRFeatureQueryProgram                        */
+/*                                                                      */
+/*      Flattened form of a checked expression: every node gets a       */
+/*      preallocated value slot and the nodes are evaluated in          */
+/*      post-order by a linear list of instructions, so that            */
+/*      evaluating a feature does not allocate any swq_expr_node.       */
+/*      Only the operations whose SWQGeneralEvaluator() semantics are   */
+/*      reproduced here are handled: Build() returns nullptr for        */
+/*      anything else, and the tree evaluator is used instead.          */
+/************************************************************************/
+
+class OGRFeatureQueryProgram
+{
+  public:
+    static std::unique_ptr<OGRFeatureQueryProgram>
+    Build(const swq_expr_node *poExpr, OGRFeatureDefn *poDefn);
+
+    int Evaluate(OGRFeature *poFeature);
+
+  private:
+    enum class Kind
+    {
+        LOAD_INTEGER,
+        LOAD_INTEGER64,
+        LOAD_FLOAT,
+        LOAD_STRING,
+        FIELD_IS_NULL,
+        GEOMETRY_IS_NULL,
+        INTEGER_OP,
+        FLOAT_OP,
+        STRING_OP,
+    };
+
+    struct Instruction
+    {
+        Kind eKind;
+        int nOperation;  // swq_op, for the *_OP kinds.
+        int iDst;
+        int iFirstArg;  // Index in m_anArgs.
+        int nArgCount;
+        int iField;  // For the load kinds.
+    };
+
+    struct Value
+    {
+        GIntBig nInt = 0;
+        double dfFloat = 0;
+        const char *pszString = nullptr;
+        bool bNull = false;
+    };
+
+    std::vector<Instruction> m_aoInstructions{};
+    std::vector<int> m_anArgs{};
+    std::vector<Value> m_aoValues{};
+    std::vector<swq_field_type> m_aeTypes{};
+    CPLStringList m_aosConstants{};
+    int m_iResult = -1;
+
+    OGRFeatureQueryProgram() = default;
+
+    int AddSlot(swq_field_type eType);
+    int BuildNode(const swq_expr_node *poNode, OGRFeatureDefn *poDefn,
+                  int nLevel);
+    int BuildOperation(const swq_expr_node *poNode, OGRFeatureDefn *poDefn,
+                       int nLevel);
+
+    const Value &GetArg(const Instruction &oInstr, int i) const
+    {
+        return m_aoValues[m_anArgs[oInstr.iFirstArg + i]];
+    }
+
+    double GetArgAsDouble(const Instruction &oInstr, int i) const
+    {
+        const int iSlot = m_anArgs[oInstr.iFirstArg + i];
+        return SWQ_IS_INTEGER(m_aeTypes[iSlot])
+                   ? static_cast<double>(m_aoValues[iSlot].nInt)
+                   : m_aoValues[iSlot].dfFloat;
+    }
+
+    void EvaluateIntegerOp(const Instruction &oInstr, Value &oDst) const;
+    void EvaluateFloatOp(const Instruction &oInstr, Value &oDst) const;
+    void EvaluateStringOp(const Instruction &oInstr, Value &oDst) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRFeatureQueryProgram)
+};
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+std::unique_ptr<OGRFeatureQueryProgram>
+OGRFeatureQueryProgram::Build(const swq_expr_node *poExpr,
+                              OGRFeatureDefn *poDefn)
+{
+    std::unique_ptr<OGRFeatureQueryProgram> poProgram(
+        new OGRFeatureQueryProgram());
+    poProgram->m_iResult = poProgram->BuildNode(poExpr, poDefn, 0);
+    if (poProgram->m_iResult < 0)
+        return nullptr;
+    return poProgram;
+}
+
+/************************************************************************/
+/*                              AddSlot()                               */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::AddSlot(swq_field_type eType)
+{
+    m_aoValues.emplace_back();
+    m_aeTypes.push_back(eType);
+    return static_cast<int>(m_aoValues.size()) - 1;
+}
+
+/************************************************************************/
+/*                             BuildNode()                              */
+/*                                                                      */
+/*      Returns the index of the slot holding the value of the node,    */
+/*      or -1 if the node cannot be compiled.                           */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::BuildNode(const swq_expr_node *poNode,
+                                      OGRFeatureDefn *poDefn, int nLevel)
+{
+    // Same limit as swq_expr_node::Evaluate(), which errors out beyond it.
+    if (nLevel >= 31)
+        return -1;
+
+    if (poNode->eNodeType == SNT_CONSTANT)
+    {
+        const int iSlot = AddSlot(poNode->field_type);
+        Value &oValue = m_aoValues[iSlot];
+        oValue.bNull = poNode->is_null != 0;
+        switch (poNode->field_type)
+        {
+            case SWQ_INTEGER:
+            case SWQ_INTEGER64:
+            case SWQ_BOOLEAN:
+                oValue.nInt = poNode->int_value;
+                break;
+
+            case SWQ_FLOAT:
+                oValue.dfFloat = poNode->float_value;
+                break;
+
+            case SWQ_STRING:
+                if (poNode->string_value)
+                {
+                    // The strings of a CPLStringList are not moved when it
+                    // grows.
+                    m_aosConstants.AddString(poNode->string_value);
+                    oValue.pszString =
+                        m_aosConstants[m_aosConstants.size() - 1];
+                }
+                break;
+
+            default:
+                return -1;
+        }
+        return iSlot;
+    }
+
+    if (poNode->eNodeType == SNT_COLUMN)
+    {
+        if (poNode->table_index != 0)
+            return -1;
+
+        Instruction oInstr;
+        switch (poNode->field_type)
+        {
+            case SWQ_INTEGER:
+            case SWQ_BOOLEAN:
+                oInstr.eKind = Kind::LOAD_INTEGER;
+                break;
+
+            case SWQ_INTEGER64:
+                oInstr.eKind = Kind::LOAD_INTEGER64;
+                break;
+
+            case SWQ_FLOAT:
+                oInstr.eKind = Kind::LOAD_FLOAT;
+                break;
+
+            case SWQ_STRING:
+                // GetFieldAsString() on special fields returns a buffer that
+                // the next call overwrites.
+                if (poNode->field_index >= poDefn->GetFieldCount())
+                    return -1;
+                oInstr.eKind = Kind::LOAD_STRING;
+                break;
+
+            default:
+                return -1;
+        }
+        oInstr.nOperation = 0;
+        oInstr.iDst = AddSlot(poNode->field_type);
+        oInstr.iFirstArg = 0;
+        oInstr.nArgCount = 0;
+        oInstr.iField =
+            OGRFeatureFetcherFixFieldIndex(poDefn, poNode->field_index);
+        m_aoInstructions.push_back(oInstr);
+        return oInstr.iDst;
+    }
+
+    if (poNode->eNodeType == SNT_OPERATION)
+        return BuildOperation(poNode, poDefn, nLevel);
+
+    return -1;
+}
+
+/************************************************************************/
+/*                           BuildOperation()                           */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::BuildOperation(const swq_expr_node *poNode,
+                                           OGRFeatureDefn *poDefn, int nLevel)
+{
+    const int nOp = poNode->nOperation;
+    const int nSubExprCount = poNode->nSubExprCount;
+    if (nSubExprCount < 1)
+        return -1;
+
+    int nExpectedCount = 2;
+    switch (nOp)
+    {
+        case SWQ_NOT:
+        case SWQ_ISNULL:
+            nExpectedCount = 1;
+            break;
+
+        case SWQ_BETWEEN:
+            nExpectedCount = 3;
+            break;
+
+        case SWQ_IN:
+            nExpectedCount = std::max(2, nSubExprCount);
+            break;
+
+        default:
+            break;
+    }
+    if (nSubExprCount != nExpectedCount)
+        return -1;
+
+    // IS NULL on a column only needs the null flag of the field, whatever
+    // its type, and the geometry is not cloned as the fetcher would do.
+    const swq_expr_node *poSub0 = poNode->papoSubExpr[0];
+    if (nOp == SWQ_ISNULL && poSub0->eNodeType == SNT_COLUMN &&
+        poSub0->table_index == 0)
+    {
+        Instruction oInstr;
+        const int nFirstGeomField =
+            poDefn->GetFieldCount() + SPECIAL_FIELD_COUNT;
+        if (poSub0->field_type == SWQ_GEOMETRY)
+        {
+            oInstr.eKind = Kind::GEOMETRY_IS_NULL;
+            oInstr.iField = poSub0->field_index - nFirstGeomField;
+        }
+        else
+        {
+            oInstr.eKind = Kind::FIELD_IS_NULL;
+            oInstr.iField =
+                OGRFeatureFetcherFixFieldIndex(poDefn, poSub0->field_index);
+        }
+        oInstr.nOperation = nOp;
+        oInstr.iDst = AddSlot(poNode->field_type);
+        oInstr.iFirstArg = 0;
+        oInstr.nArgCount = 0;
+        m_aoInstructions.push_back(oInstr);
+        return oInstr.iDst;
+    }
+
+    // Select the same code path as SWQGeneralEvaluator(), from the types
+    // of the first two arguments.
+    const swq_field_type eType0 = poSub0->field_type;
+    const swq_field_type eType1 = nSubExprCount > 1
+                                      ? poNode->papoSubExpr[1]->field_type
+                                      : SWQ_OTHER;
+    Kind eKind;
+    if (eType0 == SWQ_FLOAT || eType1 == SWQ_FLOAT)
+    {
+        eKind = Kind::FLOAT_OP;
+        switch (nOp)
+        {
+            case SWQ_EQ:
+            case SWQ_NE:
+            case SWQ_GT:
+            case SWQ_LT:
+            case SWQ_GE:
+            case SWQ_LE:
+            case SWQ_IN:
+            case SWQ_BETWEEN:
+            case SWQ_ISNULL:
+            case SWQ_ADD:
+            case SWQ_SUBTRACT:
+            case SWQ_MULTIPLY:
+            case SWQ_DIVIDE:
+            case SWQ_MODULUS:
+                break;
+            default:
+                return -1;
+        }
+        for (int i = 0; i < nSubExprCount; ++i)
+        {
+            // Only the first two arguments are converted from integer to
+            // floating point by the tree evaluator.
+            const swq_field_type eType = poNode->papoSubExpr[i]->field_type;
+            if (eType != SWQ_FLOAT && (i >= 2 || !SWQ_IS_INTEGER(eType)))
+                return -1;
+        }
+    }
+    else if (SWQ_IS_INTEGER(eType0) || eType0 == SWQ_BOOLEAN)
+    {
+        eKind = Kind::INTEGER_OP;
+        switch (nOp)
+        {
+            case SWQ_AND:
+            case SWQ_OR:
+            case SWQ_NOT:
+            case SWQ_EQ:
+            case SWQ_NE:
+            case SWQ_GT:
+            case SWQ_LT:
+            case SWQ_GE:
+            case SWQ_LE:
+            case SWQ_IN:
+            case SWQ_BETWEEN:
+            case SWQ_ISNULL:
+            case SWQ_ADD:
+            case SWQ_SUBTRACT:
+            case SWQ_MULTIPLY:
+            case SWQ_DIVIDE:
+            case SWQ_MODULUS:
+                break;
+            default:
+                return -1;
+        }
+        for (int i = 0; i < nSubExprCount; ++i)
+        {
+            const swq_field_type eType = poNode->papoSubExpr[i]->field_type;
+            if (!SWQ_IS_INTEGER(eType) && eType != SWQ_BOOLEAN)
+                return -1;
+        }
+    }
+    else if (eType0 == SWQ_STRING)
+    {
+        eKind = Kind::STRING_OP;
+        switch (nOp)
+        {
+            case SWQ_EQ:
+            {
+                // The tree evaluator has special rules when comparing
+                // values that look like timestamps with and without a +00
+                // timezone. They cannot apply if one of the operands is a
+                // constant that looks like neither.
+                bool bSafeConstant = false;
+                for (int i = 0; i < 2; ++i)
+                {
+                    const swq_expr_node *poSub = poNode->papoSubExpr[i];
+                    if (poSub->eNodeType != SNT_CONSTANT ||
+                        poSub->string_value == nullptr)
+                        continue;
+                    const char *pszVal = poSub->string_value;
+                    const size_t nLen = strlen(pszVal);
+                    if (nLen <= 3 || (strcmp(pszVal + nLen - 3, "+00") != 0 &&
+                                      pszVal[nLen - 3] != ':'))
+                    {
+                        bSafeConstant = true;
+                    }
+                }
+                if (!bSafeConstant)
+                    return -1;
+                break;
+            }
+
+            case SWQ_NE:
+            case SWQ_GT:
+            case SWQ_LT:
+            case SWQ_GE:
+            case SWQ_LE:
+            case SWQ_IN:
+            case SWQ_BETWEEN:
+            case SWQ_ISNULL:
+                break;
+            default:
+                return -1;
+        }
+        for (int i = 0; i < nSubExprCount; ++i)
+        {
+            if (poNode->papoSubExpr[i]->field_type != SWQ_STRING)
+                return -1;
+        }
+    }
+    else
+    {
+        return -1;
+    }
+
+    std::vector<int> anArgSlots;
+    anArgSlots.reserve(nSubExprCount);
+    for (int i = 0; i < nSubExprCount; ++i)
+    {
+        const int iSlot = BuildNode(poNode->papoSubExpr[i], poDefn, nLevel + 1);
+        if (iSlot < 0)
+            return -1;
+        anArgSlots.push_back(iSlot);
+    }
+
+    Instruction oInstr;
+    oInstr.eKind = eKind;
+    oInstr.nOperation = nOp;
+    oInstr.iDst = AddSlot(poNode->field_type);
+    oInstr.iFirstArg = static_cast<int>(m_anArgs.size());
+    oInstr.nArgCount = nSubExprCount;
+    oInstr.iField = -1;
+    m_anArgs.insert(m_anArgs.end(), anArgSlots.begin(), anArgSlots.end());
+    m_aoInstructions.push_back(oInstr);
+    return oInstr.iDst;
+}
+
+/************************************************************************/
+/*                         EvaluateIntegerOp()                          */
+/************************************************************************/
+
+void OGRFeatureQueryProgram::EvaluateIntegerOp(const Instruction &oInstr,
+                                               Value &oDst) const
+{
+    const int nOp = oInstr.nOperation;
+    if (nOp != SWQ_ISNULL && nOp != SWQ_OR && nOp != SWQ_IN)
+    {
+        for (int i = 0; i < oInstr.nArgCount; i++)
+        {
+            if (GetArg(oInstr, i).bNull)
+            {
+                oDst.bNull = true;
+                return;
+            }
+        }
+    }
+
+    const GIntBig nVal0 = GetArg(oInstr, 0).nInt;
+    const GIntBig nVal1 = oInstr.nArgCount > 1 ? GetArg(oInstr, 1).nInt : 0;
+    switch (nOp)
+    {
+        case SWQ_AND:
+            oDst.nInt = nVal0 && nVal1;
+            break;
+
+        case SWQ_OR:
+            oDst.nInt = nVal0 || nVal1;
+            oDst.bNull = GetArg(oInstr, 0).bNull || GetArg(oInstr, 1).bNull;
+            break;
+
+        case SWQ_NOT:
+            oDst.nInt = !nVal0;
+            break;
+
+        case SWQ_EQ:
+            oDst.nInt = nVal0 == nVal1;
+            break;
+
+        case SWQ_NE:
+            oDst.nInt = nVal0 != nVal1;
+            break;
+
+        case SWQ_GT:
+            oDst.nInt = nVal0 > nVal1;
+            break;
+
+        case SWQ_LT:
+            oDst.nInt = nVal0 < nVal1;
+            break;
+
+        case SWQ_GE:
+            oDst.nInt = nVal0 >= nVal1;
+            break;
+
+        case SWQ_LE:
+            oDst.nInt = nVal0 <= nVal1;
+            break;
+
+        case SWQ_IN:
+        {
+            if (GetArg(oInstr, 0).bNull)
+            {
+                oDst.bNull = true;
+                break;
+            }
+            bool bNullFound = false;
+            for (int i = 1; i < oInstr.nArgCount; i++)
+            {
+                const Value &oArg = GetArg(oInstr, i);
+                if (oArg.bNull)
+                {
+                    bNullFound = true;
+                }
+                else if (nVal0 == oArg.nInt)
+                {
+                    oDst.nInt = 1;
+                    break;
+                }
+            }
+            oDst.bNull = bNullFound && !oDst.nInt;
+            break;
+        }
+
+        case SWQ_BETWEEN:
+            oDst.nInt = nVal0 >= nVal1 && nVal0 <= GetArg(oInstr, 2).nInt;
+            break;
+
+        case SWQ_ISNULL:
+            oDst.nInt = GetArg(oInstr, 0).bNull;
+            break;
+
+        case SWQ_ADD:
+            try
+            {
+                oDst.nInt = (CPLSM(nVal0) + CPLSM(nVal1)).v();
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "Int overflow");
+                oDst.bNull = true;
+            }
+            break;
+
+        case SWQ_SUBTRACT:
+            try
+            {
+                oDst.nInt = (CPLSM(nVal0) - CPLSM(nVal1)).v();
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "Int overflow");
+                oDst.bNull = true;
+            }
+            break;
+
+        case SWQ_MULTIPLY:
+            try
+            {
+                oDst.nInt = (CPLSM(nVal0) * CPLSM(nVal1)).v();
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "Int overflow");
+                oDst.bNull = true;
+            }
+            break;
+
+        case SWQ_DIVIDE:
+            if (nVal1 == 0)
+                oDst.nInt = INT_MAX;
+            else
+            {
+                try
+                {
+                    oDst.nInt = (CPLSM(nVal0) / CPLSM(nVal1)).v();
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined, "Int overflow");
+                    oDst.bNull = true;
+                }
+            }
+            break;
+
+        case SWQ_MODULUS:
+            if (nVal1 == 0)
+                oDst.nInt = INT_MAX;
+            else
+                oDst.nInt = nVal0 % nVal1;
+            break;
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                          EvaluateFloatOp()                           */
+/************************************************************************/
+
+void OGRFeatureQueryProgram::EvaluateFloatOp(const Instruction &oInstr,
+                                             Value &oDst) const
+{
+    const int nOp = oInstr.nOperation;
+    if (nOp != SWQ_ISNULL && nOp != SWQ_IN)
+    {
+        for (int i = 0; i < oInstr.nArgCount; i++)
+        {
+            if (GetArg(oInstr, i).bNull)
+            {
+                oDst.bNull = true;
+                return;
+            }
+        }
+    }
+
+    const double dfVal0 = GetArgAsDouble(oInstr, 0);
+    const double dfVal1 =
+        oInstr.nArgCount > 1 ? GetArgAsDouble(oInstr, 1) : 0.0;
+    switch (nOp)
+    {
+        case SWQ_EQ:
+            oDst.nInt = dfVal0 == dfVal1;
+            break;
+
+        case SWQ_NE:
+            oDst.nInt = dfVal0 != dfVal1;
+            break;
+
+        case SWQ_GT:
+            oDst.nInt = dfVal0 > dfVal1;
+            break;
+
+        case SWQ_LT:
+            oDst.nInt = dfVal0 < dfVal1;
+            break;
+
+        case SWQ_GE:
+            oDst.nInt = dfVal0 >= dfVal1;
+            break;
+
+        case SWQ_LE:
+            oDst.nInt = dfVal0 <= dfVal1;
+            break;
+
+        case SWQ_IN:
+        {
+            if (GetArg(oInstr, 0).bNull)
+            {
+                oDst.bNull = true;
+                break;
+            }
+            bool bNullFound = false;
+            for (int i = 1; i < oInstr.nArgCount; i++)
+            {
+                if (GetArg(oInstr, i).bNull)
+                {
+                    bNullFound = true;
+                }
+                else if (dfVal0 == GetArgAsDouble(oInstr, i))
+                {
+                    oDst.nInt = 1;
+                    break;
+                }
+            }
+            oDst.bNull = bNullFound && !oDst.nInt;
+            break;
+        }
+
+        case SWQ_BETWEEN:
+            oDst.nInt =
+                dfVal0 >= dfVal1 && dfVal0 <= GetArgAsDouble(oInstr, 2);
+            break;
+
+        case SWQ_ISNULL:
+            oDst.nInt = GetArg(oInstr, 0).bNull;
+            break;
+
+        case SWQ_ADD:
+            oDst.dfFloat = dfVal0 + dfVal1;
+            break;
+
+        case SWQ_SUBTRACT:
+            oDst.dfFloat = dfVal0 - dfVal1;
+            break;
+
+        case SWQ_MULTIPLY:
+            oDst.dfFloat = dfVal0 * dfVal1;
+            break;
+
+        case SWQ_DIVIDE:
+            if (dfVal1 == 0)
+                oDst.dfFloat = INT_MAX;
+            else
+                oDst.dfFloat = dfVal0 / dfVal1;
+            break;
+
+        case SWQ_MODULUS:
+            if (dfVal1 == 0)
+                oDst.dfFloat = INT_MAX;
+            else
+                oDst.dfFloat = fmod(dfVal0, dfVal1);
+            break;
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                          EvaluateStringOp()                          */
+/************************************************************************/
+
+void OGRFeatureQueryProgram::EvaluateStringOp(const Instruction &oInstr,
+                                              Value &oDst) const
+{
+    const int nOp = oInstr.nOperation;
+    if (nOp != SWQ_ISNULL && nOp != SWQ_IN)
+    {
+        for (int i = 0; i < oInstr.nArgCount; i++)
+        {
+            if (GetArg(oInstr, i).bNull)
+            {
+                oDst.bNull = true;
+                return;
+            }
+        }
+    }
+
+    const char *pszVal0 = GetArg(oInstr, 0).pszString;
+    const char *pszVal1 =
+        oInstr.nArgCount > 1 ? GetArg(oInstr, 1).pszString : nullptr;
+    if (nOp != SWQ_ISNULL && nOp != SWQ_IN && pszVal1 == nullptr)
+        return;
+
+    switch (nOp)
+    {
+        case SWQ_EQ:
+            oDst.nInt = STRCASECMP(pszVal0, pszVal1) == 0;
+            break;
+
+        case SWQ_NE:
+            oDst.nInt = STRCASECMP(pszVal0, pszVal1) != 0;
+            break;
+
+        case SWQ_GT:
+            oDst.nInt = STRCASECMP(pszVal0, pszVal1) > 0;
+            break;
+
+        case SWQ_LT:
+            oDst.nInt = STRCASECMP(pszVal0, pszVal1) < 0;
+            break;
+
+        case SWQ_GE:
+            oDst.nInt = STRCASECMP(pszVal0, pszVal1) >= 0;
+            break;
+
+        case SWQ_LE:
+            oDst.nInt = STRCASECMP(pszVal0, pszVal1) <= 0;
+            break;
+
+        case SWQ_IN:
+        {
+            if (GetArg(oInstr, 0).bNull)
+            {
+                oDst.bNull = true;
+                break;
+            }
+            bool bNullFound = false;
+            for (int i = 1; i < oInstr.nArgCount; i++)
+            {
+                const Value &oArg = GetArg(oInstr, i);
+                if (oArg.bNull || oArg.pszString == nullptr)
+                {
+                    bNullFound = true;
+                }
+                else if (STRCASECMP(pszVal0, oArg.pszString) == 0)
+                {
+                    oDst.nInt = 1;
+                    break;
+                }
+            }
+            oDst.bNull = bNullFound && !oDst.nInt;
+            break;
+        }
+
+        case SWQ_BETWEEN:
+            oDst.nInt = STRCASECMP(pszVal0, pszVal1) >= 0 &&
+                        STRCASECMP(pszVal0, GetArg(oInstr, 2).pszString) <= 0;
+            break;
+
+        case SWQ_ISNULL:
+            oDst.nInt = GetArg(oInstr, 0).bNull;
+            break;
+
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+int OGRFeatureQueryProgram::Evaluate(OGRFeature *poFeature)
+{
+    for (const Instruction &oInstr : m_aoInstructions)
+    {
+        Value &oDst = m_aoValues[oInstr.iDst];
+        oDst.nInt = 0;
+        oDst.dfFloat = 0;
+        oDst.bNull = false;
+        switch (oInstr.eKind)
+        {
+            case Kind::LOAD_INTEGER:
+                oDst.nInt = poFeature->GetFieldAsInteger(oInstr.iField);
+                oDst.bNull = !poFeature->IsFieldSetAndNotNull(oInstr.iField);
+                break;
+
+            case Kind::LOAD_INTEGER64:
+                oDst.nInt = poFeature->GetFieldAsInteger64(oInstr.iField);
+                oDst.bNull = !poFeature->IsFieldSetAndNotNull(oInstr.iField);
+                break;
+
+            case Kind::LOAD_FLOAT:
+                oDst.dfFloat = poFeature->GetFieldAsDouble(oInstr.iField);
+                oDst.bNull = !poFeature->IsFieldSetAndNotNull(oInstr.iField);
+                break;
+
+            case Kind::LOAD_STRING:
+                oDst.pszString = poFeature->GetFieldAsString(oInstr.iField);
+                oDst.bNull = !poFeature->IsFieldSetAndNotNull(oInstr.iField);
+                break;
+
+            case Kind::FIELD_IS_NULL:
+                oDst.nInt = !poFeature->IsFieldSetAndNotNull(oInstr.iField);
+                break;
+
+            case Kind::GEOMETRY_IS_NULL:
+                oDst.nInt =
+                    poFeature->GetGeomFieldRef(oInstr.iField) == nullptr;
+                break;
+
+            case Kind::INTEGER_OP:
+                EvaluateIntegerOp(oInstr, oDst);
+                break;
+
+            case Kind::FLOAT_OP:
+                EvaluateFloatOp(oInstr, oDst);
+                break;
+
+            case Kind::STRING_OP:
+                EvaluateStringOp(oInstr, oDst);
+                break;
+        }
+    }
+
+    const swq_field_type eType = m_aeTypes[m_iResult];
+    if (!SWQ_IS_INTEGER(eType) && eType != SWQ_BOOLEAN)
+        return FALSE;
+    return CPL_TO_BOOL(static_cast<int>(m_aoValues[m_iResult].nInt));
+}
+
 /************************************************************************/
 /*                          OGRFeatureQuery()                           */
 /************************************************************************/
@@ -73,6 +943,7 @@ OGRFeatureQuery::OGRFeatureQuery()
 OGRFeatureQuery::~OGRFeatureQuery()
 
 {
+    delete m_poProgram;
     delete m_psContext;
     delete static_cast<swq_expr_node *>(pSWQExpr);
 }
@@ -117,6 +988,8 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
                          swq_custom_func_registrar *poCustomFuncRegistrar)
 {
     // Clear any existing expression.
+    delete m_poProgram;
+    m_poProgram = nullptr;
     if (pSWQExpr != nullptr)
     {
         delete static_cast<swq_expr_node *>(pSWQExpr);
@@ -243,6 +1116,14 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else if (bCheck &&
+             CPLTestBool(CPLGetConfigOption("OGR_SQL_COMPILED_WHERE", "YES")))
+    {
+        // Types are only known when the expression has been checked.
+        m_poProgram = OGRFeatureQueryProgram::Build(
+                          static_cast<swq_expr_node *>(pSWQExpr), poDefn)
+                          .release();
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -250,22 +1131,6 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
     return eErr;
 }
 
-/************************************************************************/
-/*                    OGRFeatureFetcherFixFieldIndex()                  */
-/************************************************************************/
-
-static int OGRFeatureFetcherFixFieldIndex(OGRFeatureDefn *poFDefn, int nIdx)
-{
-    /* Nastry trick: if we inserted the FID column as an extra column, it is */
-    /* after regular fields, special fields and geometry fields */
-    if (nIdx == poFDefn->GetFieldCount() + SPECIAL_FIELD_COUNT +
-                    poFDefn->GetGeomFieldCount())
-    {
-        return poFDefn->GetFieldCount() + SPF_FID;
-    }
-    return nIdx;
-}
-
 /************************************************************************/
 /*                         OGRFeatureFetcher()                          */
 /************************************************************************/
@@ -328,6 +1193,9 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    if (m_poProgram != nullptr && poFeature->GetDefnRef() == poTargetDefn)
+        return m_poProgram->Evaluate(poFeature);
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -3245,7 +3245,12 @@ void OGRGeometry::freeGEOSContext(
 static GEOSGeom convertToGEOSGeom(GEOSContextHandle_t hGEOSCtxt,
                                   OGRGeometry *poGeom)
 {
-    GEOSGeom hGeom = nullptr;
+    bool bSupported = true;
+    GEOSGeom hGeom =
+        OGRGeometry::exportToGEOSDirect(hGEOSCtxt, poGeom, bSupported);
+    if (bSupported)
+        return hGeom;
+
     const size_t nDataSize = poGeom->WkbSize();
     unsigned char *pabyData =
         static_cast<unsigned char *>(CPLMalloc(nDataSize));
@@ -3262,6 +3267,185 @@ static GEOSGeom convertToGEOSGeom(GEOSContextHandle_t hGEOSCtxt,
 }
 #endif
 
+/************************************************************************/
+/*                        exportToGEOSDirect()                          */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+// Builds a GEOS geometry from the coordinate arrays of a linear geometry,
+// without going through WKB. bSupported is set to false if the geometry must
+// be exported through WKB instead.
+GEOSGeom OGRGeometry::exportToGEOSDirect(GEOSContextHandle_t hGEOSCtxt,
+                                         const OGRGeometry *poGeom,
+                                         bool &bSupported)
+{
+#if defined(HAVE_GEOS) &&                                                      \
+    (GEOS_VERSION_MAJOR > 3 ||                                                 \
+     (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10))
+    bSupported = true;
+    const bool bHasZ = CPL_TO_BOOL(poGeom->Is3D());
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 12)
+    const bool bHasM = CPL_TO_BOOL(poGeom->IsMeasured());
+#else
+    // GEOS < 3.12 doesn't support M dimension
+    const bool bHasM = false;
+#endif
+
+    // Let the WKB path deal with the dimensionality of empty geometries
+    if ((bHasZ || bHasM) && poGeom->IsEmpty())
+    {
+        bSupported = false;
+        return nullptr;
+    }
+
+    const auto CreateCoordSeq =
+        [hGEOSCtxt, bHasZ, bHasM](
+            const OGRSimpleCurve *poCurve) -> GEOSCoordSequence *
+    {
+        const unsigned nPoints = static_cast<unsigned>(poCurve->nPointCount);
+        if (!bHasZ && !bHasM)
+        {
+            // The x,y array of the curve has the layout expected by GEOS
+            return GEOSCoordSeq_copyFromBuffer_r(
+                hGEOSCtxt, reinterpret_cast<const double *>(poCurve->paoPoints),
+                nPoints, false, false);
+        }
+        const size_t nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+        std::vector<double> adfBuffer;
+        try
+        {
+            adfBuffer.resize(nPoints * nDim);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in exportToGEOS()");
+            return nullptr;
+        }
+        double *padfOut = adfBuffer.data();
+        for (unsigned i = 0; i < nPoints; ++i)
+        {
+            *(padfOut++) = poCurve->paoPoints[i].x;
+            *(padfOut++) = poCurve->paoPoints[i].y;
+            if (bHasZ)
+                *(padfOut++) = poCurve->padfZ ? poCurve->padfZ[i] : 0.0;
+            if (bHasM)
+                *(padfOut++) = poCurve->padfM ? poCurve->padfM[i] : 0.0;
+        }
+        return GEOSCoordSeq_copyFromBuffer_r(hGEOSCtxt, adfBuffer.data(),
+                                             nPoints, bHasZ, bHasM);
+    };
+
+    const auto CreateRing = [hGEOSCtxt, &CreateCoordSeq](
+                                const OGRSimpleCurve *poRing) -> GEOSGeom
+    {
+        GEOSCoordSequence *hSeq = CreateCoordSeq(poRing);
+        return hSeq ? GEOSGeom_createLinearRing_r(hGEOSCtxt, hSeq) : nullptr;
+    };
+
+    switch (wkbFlatten(poGeom->getGeometryType()))
+    {
+        case wkbPoint:
+        {
+            const OGRPoint *poPoint = poGeom->toPoint();
+            if (poPoint->IsEmpty())
+                return GEOSGeom_createEmptyPoint_r(hGEOSCtxt);
+            double adfCoords[4];
+            unsigned nDim = 0;
+            adfCoords[nDim++] = poPoint->getX();
+            adfCoords[nDim++] = poPoint->getY();
+            if (bHasZ)
+                adfCoords[nDim++] = poPoint->getZ();
+            if (bHasM)
+                adfCoords[nDim++] = poPoint->getM();
+            GEOSCoordSequence *hSeq = GEOSCoordSeq_copyFromBuffer_r(
+                hGEOSCtxt, adfCoords, 1, bHasZ, bHasM);
+            return hSeq ? GEOSGeom_createPoint_r(hGEOSCtxt, hSeq) : nullptr;
+        }
+
+        case wkbLineString:
+        {
+            const OGRSimpleCurve *poLS = poGeom->toSimpleCurve();
+            if (poLS->IsEmpty())
+                return GEOSGeom_createEmptyLineString_r(hGEOSCtxt);
+            GEOSCoordSequence *hSeq = CreateCoordSeq(poLS);
+            return hSeq ? GEOSGeom_createLineString_r(hGEOSCtxt, hSeq)
+                        : nullptr;
+        }
+
+        case wkbPolygon:
+        {
+            const OGRPolygon *poPoly = poGeom->toPolygon();
+            if (poPoly->IsEmpty())
+                return GEOSGeom_createEmptyPolygon_r(hGEOSCtxt);
+            GEOSGeom hShell = CreateRing(poPoly->getExteriorRing());
+            if (!hShell)
+                return nullptr;
+            std::vector<GEOSGeom> ahHoles;
+            for (int i = 0; i < poPoly->getNumInteriorRings(); ++i)
+            {
+                GEOSGeom hHole = CreateRing(poPoly->getInteriorRing(i));
+                if (!hHole)
+                {
+                    GEOSGeom_destroy_r(hGEOSCtxt, hShell);
+                    for (GEOSGeom hOtherHole : ahHoles)
+                        GEOSGeom_destroy_r(hGEOSCtxt, hOtherHole);
+                    return nullptr;
+                }
+                ahHoles.push_back(hHole);
+            }
+            return GEOSGeom_createPolygon_r(
+                hGEOSCtxt, hShell, ahHoles.empty() ? nullptr : ahHoles.data(),
+                static_cast<unsigned>(ahHoles.size()));
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbGeometryCollection:
+        {
+            const auto eType = wkbFlatten(poGeom->getGeometryType());
+            const int nGEOSType = eType == wkbMultiPoint ? GEOS_MULTIPOINT
+                                  : eType == wkbMultiLineString
+                                      ? GEOS_MULTILINESTRING
+                                  : eType == wkbMultiPolygon
+                                      ? GEOS_MULTIPOLYGON
+                                      : GEOS_GEOMETRYCOLLECTION;
+            const OGRGeometryCollection *poGC = poGeom->toGeometryCollection();
+            std::vector<GEOSGeom> ahGeoms;
+            for (const auto *poPart : *poGC)
+            {
+                GEOSGeom hPart =
+                    exportToGEOSDirect(hGEOSCtxt, poPart, bSupported);
+                if (!hPart)
+                {
+                    for (GEOSGeom hOtherPart : ahGeoms)
+                        GEOSGeom_destroy_r(hGEOSCtxt, hOtherPart);
+                    return nullptr;
+                }
+                ahGeoms.push_back(hPart);
+            }
+            if (ahGeoms.empty())
+                return GEOSGeom_createEmptyCollection_r(hGEOSCtxt, nGEOSType);
+            return GEOSGeom_createCollection_r(
+                hGEOSCtxt, nGEOSType, ahGeoms.data(),
+                static_cast<unsigned>(ahGeoms.size()));
+        }
+
+        default:
+            break;
+    }
+#else
+    CPL_IGNORE_RET_VAL(hGEOSCtxt);
+    CPL_IGNORE_RET_VAL(poGeom);
+#endif
+    bSupported = false;
+    return nullptr;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                            exportToGEOS()                            */
 /************************************************************************/
@@ -6897,6 +7081,10 @@ int OGRHasPreparedGeometrySupport()
  *
  * To free with OGRDestroyPreparedGeometry()
  *
+ * The prepared geometry keeps its own GEOS representation of the input
+ * geometry, so that testing it against many geometries does not convert it
+ * again. It is not updated if the input geometry is modified afterwards.
+ *
  * @param hGeom input geometry to prepare.
  * @return handle to a prepared geometry.
  * @since GDAL 3.3
@@ -32,7 +32,10 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_quad_tree.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_geometry.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
@@ -55,6 +58,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <new>
 #include <utility>
 #include <vector>
@@ -1489,6 +1493,10 @@ struct sPolyExtended
     OGRPoint poAPoint{};
     int nInitialIndex = 0;
     OGRCurvePolygon *poEnclosingPolygon = nullptr;
+    // Index (in the array sorted by descending area) of the smallest polygon
+    // enclosing this one, or of a polygon overlapping it.
+    int nEnclosingIdx = -1;
+    int nOverlappingIdx = -1;
     double dfArea = 0.0;
     bool bIsTopLevel = false;
     bool bIsCW = false;
@@ -1517,6 +1525,228 @@ enum OrganizePolygonMethod
     METHOD_CCW_INNER_JUST_AFTER_CW_OUTER
 };
 
+/************************************************************************/
+/*                     OGRIsPolyInsideOtherFast()                       */
+/************************************************************************/
+
+// Tests if polygon i is inside polygon j, by testing a point of the exterior
+// ring of i that is not on the boundary of j.
+static bool OGRIsPolyInsideOtherFast(const sPolyExtended &sPolyI,
+                                     const sPolyExtended &sPolyJ)
+{
+    if (!sPolyI.bIsPolygon || !sPolyJ.bIsPolygon)
+        return false;
+
+    const OGRLinearRing *poLR_i = sPolyI.poExteriorRing->toLinearRing();
+    const OGRLinearRing *poLR_j = sPolyJ.poExteriorRing->toLinearRing();
+
+    // Note that isPointInRing only test strict inclusion in the ring.
+    if (!poLR_j->isPointOnRingBoundary(&sPolyI.poAPoint, FALSE))
+        return CPL_TO_BOOL(poLR_j->isPointInRing(&sPolyI.poAPoint, FALSE));
+
+    // If the point of i is on the boundary of j, we will iterate over the
+    // other points of i.
+    const int nPoints = poLR_i->getNumPoints();
+    int k = 1;  // Used after for.
+    OGRPoint previousPoint = sPolyI.poAPoint;
+    for (; k < nPoints; k++)
+    {
+        OGRPoint point;
+        poLR_i->getPoint(k, &point);
+        if (point.getX() == previousPoint.getX() &&
+            point.getY() == previousPoint.getY())
+        {
+            continue;
+        }
+        if (poLR_j->isPointOnRingBoundary(&point, FALSE))
+        {
+            // If it is on the boundary of j, iterate again.
+        }
+        else if (poLR_j->isPointInRing(&point, FALSE))
+        {
+            // If then point is strictly included in j, then i is considered
+            // inside j.
+            return true;
+        }
+        else
+        {
+            // If it is outside, then i cannot be inside j.
+            return false;
+        }
+        previousPoint = point;
+    }
+    if (nPoints > 2)
+    {
+        // All points of i are on the boundary of j.
+        // Take a point in the middle of a segment of i and test it against j.
+        poLR_i->getPoint(0, &previousPoint);
+        for (k = 1; k < nPoints; k++)
+        {
+            OGRPoint point;
+            poLR_i->getPoint(k, &point);
+            if (point.getX() == previousPoint.getX() &&
+                point.getY() == previousPoint.getY())
+            {
+                continue;
+            }
+            OGRPoint pointMiddle;
+            pointMiddle.setX((point.getX() + previousPoint.getX()) / 2);
+            pointMiddle.setY((point.getY() + previousPoint.getY()) / 2);
+            if (poLR_j->isPointOnRingBoundary(&pointMiddle, FALSE))
+            {
+                // If it is on the boundary of j, iterate again.
+            }
+            else if (poLR_j->isPointInRing(&pointMiddle, FALSE))
+            {
+                // If then point is strictly included in j, then i is
+                // considered inside j.
+                return true;
+            }
+            else
+            {
+                // If it is outside, then i cannot be inside j.
+                return false;
+            }
+            previousPoint = point;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     OGROrganizePolygonsContext                       */
+/************************************************************************/
+
+// State shared by the jobs that look for the enclosing polygon of each
+// polygon. Each job only writes the nEnclosingIdx and nOverlappingIdx members
+// of the polygons of its own range.
+struct OGROrganizePolygonsContext
+{
+    std::vector<sPolyExtended> *pasPolyEx = nullptr;
+    CPLQuadTree *hQuadTree = nullptr;
+    OrganizePolygonMethod method = METHOD_NORMAL;
+    bool bUseFastVersion = true;
+};
+
+struct OGROrganizePolygonsJob
+{
+    const OGROrganizePolygonsContext *psContext = nullptr;
+    int nStart = 0;
+    int nEnd = 0;
+};
+
+/************************************************************************/
+/*                  OGROrganizePolygonsFindEnclosing()                  */
+/************************************************************************/
+
+// Finds the polygon of highest rank j < i (that is the smallest one, as
+// polygons are sorted by descending area) that contains polygon i. In the
+// slow version, stops at the first polygon of higher rank that overlaps i.
+static void OGROrganizePolygonsFindEnclosing(
+    const OGROrganizePolygonsContext &sContext, int i,
+    std::vector<int> &anCandidates)
+{
+    auto &asPolyEx = *(sContext.pasPolyEx);
+    auto &sPolyI = asPolyEx[i];
+    const auto method = sContext.method;
+
+    if (method == METHOD_ONLY_CCW && sPolyI.bIsCW)
+        return;
+
+    // Only polygons whose envelope intersects the one of i can contain or
+    // overlap it.
+    anCandidates.clear();
+    if (sContext.hQuadTree)
+    {
+        CPLRectObj sAoi;
+        sAoi.minx = sPolyI.sEnvelope.MinX;
+        sAoi.miny = sPolyI.sEnvelope.MinY;
+        sAoi.maxx = sPolyI.sEnvelope.MaxX;
+        sAoi.maxy = sPolyI.sEnvelope.MaxY;
+        int nCount = 0;
+        void **papResults =
+            CPLQuadTreeSearch(sContext.hQuadTree, &sAoi, &nCount);
+        for (int k = 0; k < nCount; ++k)
+        {
+            const int j = static_cast<int>(
+                static_cast<const sPolyExtended *>(papResults[k]) -
+                asPolyEx.data());
+            if (j < i)
+                anCandidates.push_back(j);
+        }
+        CPLFree(papResults);
+        std::sort(anCandidates.begin(), anCandidates.end(),
+                  [](int a, int b) { return a > b; });
+    }
+    else
+    {
+        for (int j = i - 1; j >= 0; j--)
+            anCandidates.push_back(j);
+    }
+
+    for (const int j : anCandidates)
+    {
+        const auto &sPolyJ = asPolyEx[j];
+        bool b_i_inside_j = false;
+
+        if (method == METHOD_ONLY_CCW && sPolyJ.bIsCW == false)
+        {
+            // In that mode, i which is CCW if we reach here can only be
+            // included in a CW polygon.
+            continue;
+        }
+
+        if (sPolyJ.sEnvelope.Contains(sPolyI.sEnvelope))
+        {
+            if (sContext.bUseFastVersion)
+            {
+                if (method == METHOD_ONLY_CCW && j == 0)
+                {
+                    // We are testing if a CCW ring is in the biggest CW ring.
+                    // It *must* be inside as this is the last candidate,
+                    // otherwise the winding order rules is broken.
+                    b_i_inside_j = true;
+                }
+                else
+                {
+                    b_i_inside_j = OGRIsPolyInsideOtherFast(sPolyI, sPolyJ);
+                }
+            }
+            else if (sPolyJ.poPolygon->Contains(sPolyI.poPolygon))
+            {
+                b_i_inside_j = true;
+            }
+        }
+
+        if (b_i_inside_j)
+        {
+            sPolyI.nEnclosingIdx = j;
+            return;
+        }
+        // Use Overlaps instead of Intersects to be more
+        // tolerant about touching polygons.
+        else if (!sContext.bUseFastVersion &&
+                 sPolyI.sEnvelope.Intersects(sPolyJ.sEnvelope) &&
+                 sPolyI.poPolygon->Overlaps(sPolyJ.poPolygon))
+        {
+            sPolyI.nOverlappingIdx = j;
+            return;
+        }
+    }
+}
+
+/************************************************************************/
+/*                    OGROrganizePolygonsJobFunc()                      */
+/************************************************************************/
+
+static void OGROrganizePolygonsJobFunc(void *pData)
+{
+    const auto psJob = static_cast<const OGROrganizePolygonsJob *>(pData);
+    std::vector<int> anCandidates;
+    for (int i = psJob->nStart; i < psJob->nEnd; ++i)
+        OGROrganizePolygonsFindEnclosing(*(psJob->psContext), i, anCandidates);
+}
+
 /**
  * \brief Organize polygons based on geometries.
  *
@@ -1538,7 +1768,7 @@ enum OrganizePolygonMethod
  * relationships is used if GEOS is available.)
  *
  * In cases where a big number of polygons is passed to this function, the
- * default processing may be really slow. You can skip the processing by adding
+ * default processing may be slow. You can skip the processing by adding
  * METHOD=SKIP to the option list (the result of the function will be a
  * multi-polygon with all polygons as toplevel polygons) or only make it analyze
  * counterclockwise polygons by adding METHOD=ONLY_CCW to the option list if you
@@ -1557,6 +1787,12 @@ enum OrganizePolygonMethod
  * override the value of the METHOD option of papszOptions (useful to modify the
  * behavior of the shapefile driver)
  *
+ * When many polygons are passed, their envelopes are indexed so that each
+ * polygon is only tested against the polygons whose envelope intersects its
+ * own one. Starting with GDAL 3.10, the NUM_THREADS=number|ALL_CPUS option
+ * (defaulting to the value of the GDAL_NUM_THREADS configuration option) may
+ * be set to run those tests in several threads.
+ *
  * @param papoPolygons array of geometry pointers - should all be OGRPolygons
  * or OGRCurvePolygons. Ownership of the geometries is passed, but not of the
  * array itself.
@@ -1836,8 +2072,10 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
     // Emits a warning if the number of parts is sufficiently big to anticipate
     // for very long computation time, and the user didn't specify an explicit
     // method.
+    // (The default fast version uses a spatial index, so this is only
+    // relevant to the slower OGR_DEBUG_ORGANIZE_POLYGONS mode.)
     if (nPolygonCount > N_CRITICAL_PART_NUMBER && method == METHOD_NORMAL &&
-        pszMethodValue == nullptr)
+        pszMethodValue == nullptr && !bUseFastVersion)
     {
         static int firstTime = 1;
         if (firstTime)
@@ -1879,7 +2117,11 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
           outer ring
        5) Add the top-level polygons to the multipolygon
 
-       Complexity : O(nPolygonCount^2)
+       Complexity : O(nPolygonCount^2) in the worst case. When there are many
+       polygons, their envelopes are indexed in a quad tree, so that step 2
+       only considers the polygons whose envelope intersects the one of the
+       polygon of rank i, and step 2 is run in parallel if NUM_THREADS or
+       GDAL_NUM_THREADS is set.
     */
 
     /* Compute how each polygon relate to the other ones
@@ -1917,171 +2159,92 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
     int nCountTopLevel = 1;
 
     // STEP 2.
-    for (int i = 1; !bMixedUpGeometries && bValidTopology &&
-                    i < static_cast<int>(asPolyEx.size());
-         i++)
+    if (!bMixedUpGeometries && asPolyEx.size() > 1)
     {
-        if (method == METHOD_ONLY_CCW && asPolyEx[i].bIsCW)
-        {
-            nCountTopLevel++;
-            asPolyEx[i].bIsTopLevel = true;
-            asPolyEx[i].poEnclosingPolygon = nullptr;
-            continue;
-        }
+        const int nPolys = static_cast<int>(asPolyEx.size());
 
-        int j = i - 1;  // Used after for.
-        for (; bValidTopology && j >= 0; j--)
-        {
-            bool b_i_inside_j = false;
+        OGROrganizePolygonsContext sContext;
+        sContext.pasPolyEx = &asPolyEx;
+        sContext.method = method;
+        sContext.bUseFastVersion = bUseFastVersion;
 
-            if (method == METHOD_ONLY_CCW && asPolyEx[j].bIsCW == false)
+        // Index the envelopes of the polygons, so that each polygon is only
+        // tested against the polygons whose envelope intersects its own one.
+        if (nPolys > N_CRITICAL_PART_NUMBER)
+        {
+            OGREnvelope sGlobalEnvelope;
+            for (const auto &sPolyEx : asPolyEx)
+                sGlobalEnvelope.Merge(sPolyEx.sEnvelope);
+            CPLRectObj sGlobalBounds;
+            sGlobalBounds.minx = sGlobalEnvelope.MinX;
+            sGlobalBounds.miny = sGlobalEnvelope.MinY;
+            sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+            sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+            sContext.hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+            CPLQuadTreeSetMaxDepth(sContext.hQuadTree,
+                                   CPLQuadTreeGetAdvisedMaxDepth(nPolys));
+            for (auto &sPolyEx : asPolyEx)
             {
-                // In that mode, i which is CCW if we reach here can only be
-                // included in a CW polygon.
-                continue;
+                CPLRectObj sBounds;
+                sBounds.minx = sPolyEx.sEnvelope.MinX;
+                sBounds.miny = sPolyEx.sEnvelope.MinY;
+                sBounds.maxx = sPolyEx.sEnvelope.MaxX;
+                sBounds.maxy = sPolyEx.sEnvelope.MaxY;
+                CPLQuadTreeInsertWithBounds(sContext.hQuadTree, &sPolyEx,
+                                            &sBounds);
             }
+        }
 
-            if (asPolyEx[j].sEnvelope.Contains(asPolyEx[i].sEnvelope))
+        // The search of the enclosing polygon of each polygon only depends
+        // on the geometries, and can thus be done in parallel.
+        const int nMaxThreads = CPLParseNumThreads(
+            CSLFetchNameValueDef(
+                papszOptions, "NUM_THREADS",
+                CPLGetConfigOption("GDAL_NUM_THREADS", nullptr)),
+            1);
+        constexpr int MIN_POLYGONS_PER_THREAD = 1000;
+        int nThreads = std::max(
+            1, std::min(nMaxThreads, (nPolys - 1) / MIN_POLYGONS_PER_THREAD));
+        CPLWorkerThreadPool *poThreadPool =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+        if (!poThreadPool)
+            nThreads = 1;
+
+        std::vector<OGROrganizePolygonsJob> asJobs(nThreads);
+        const int nPolysPerJob = (nPolys - 1 + nThreads - 1) / nThreads;
+        for (int iJob = 0; iJob < nThreads; ++iJob)
+        {
+            asJobs[iJob].psContext = &sContext;
+            asJobs[iJob].nStart = std::min(nPolys, 1 + iJob * nPolysPerJob);
+            asJobs[iJob].nEnd =
+                std::min(nPolys, asJobs[iJob].nStart + nPolysPerJob);
+        }
+        if (poThreadPool)
+        {
+            auto poJobQueue = poThreadPool->CreateJobQueue();
+            for (int iJob = 1; iJob < nThreads; ++iJob)
             {
-                if (bUseFastVersion)
-                {
-                    if (method == METHOD_ONLY_CCW && j == 0)
-                    {
-                        // We are testing if a CCW ring is in the biggest CW
-                        // ring It *must* be inside as this is the last
-                        // candidate, otherwise the winding order rules is
-                        // broken.
-                        b_i_inside_j = true;
-                    }
-                    else if (asPolyEx[i].bIsPolygon && asPolyEx[j].bIsPolygon &&
-                             asPolyEx[j]
-                                 .poExteriorRing->toLinearRing()
-                                 ->isPointOnRingBoundary(&asPolyEx[i].poAPoint,
-                                                         FALSE))
-                    {
-                        OGRLinearRing *poLR_i =
-                            asPolyEx[i].poExteriorRing->toLinearRing();
-                        OGRLinearRing *poLR_j =
-                            asPolyEx[j].poExteriorRing->toLinearRing();
-
-                        // If the point of i is on the boundary of j, we will
-                        // iterate over the other points of i.
-                        const int nPoints = poLR_i->getNumPoints();
-                        int k = 1;  // Used after for.
-                        OGRPoint previousPoint = asPolyEx[i].poAPoint;
-                        for (; k < nPoints; k++)
-                        {
-                            OGRPoint point;
-                            poLR_i->getPoint(k, &point);
-                            if (point.getX() == previousPoint.getX() &&
-                                point.getY() == previousPoint.getY())
-                            {
-                                continue;
-                            }
-                            if (poLR_j->isPointOnRingBoundary(&point, FALSE))
-                            {
-                                // If it is on the boundary of j, iterate again.
-                            }
-                            else if (poLR_j->isPointInRing(&point, FALSE))
-                            {
-                                // If then point is strictly included in j, then
-                                // i is considered inside j.
-                                b_i_inside_j = true;
-                                break;
-                            }
-                            else
-                            {
-                                // If it is outside, then i cannot be inside j.
-                                break;
-                            }
-                            previousPoint = point;
-                        }
-                        if (!b_i_inside_j && k == nPoints && nPoints > 2)
-                        {
-                            // All points of i are on the boundary of j.
-                            // Take a point in the middle of a segment of i and
-                            // test it against j.
-                            poLR_i->getPoint(0, &previousPoint);
-                            for (k = 1; k < nPoints; k++)
-                            {
-                                OGRPoint point;
-                                poLR_i->getPoint(k, &point);
-                                if (point.getX() == previousPoint.getX() &&
-                                    point.getY() == previousPoint.getY())
-                                {
-                                    continue;
-                                }
-                                OGRPoint pointMiddle;
-                                pointMiddle.setX(
-                                    (point.getX() + previousPoint.getX()) / 2);
-                                pointMiddle.setY(
-                                    (point.getY() + previousPoint.getY()) / 2);
-                                if (poLR_j->isPointOnRingBoundary(&pointMiddle,
-                                                                  FALSE))
-                                {
-                                    // If it is on the boundary of j, iterate
-                                    // again.
-                                }
-                                else if (poLR_j->isPointInRing(&pointMiddle,
-                                                               FALSE))
-                                {
-                                    // If then point is strictly included in j,
-                                    // then i is considered inside j.
-                                    b_i_inside_j = true;
-                                    break;
-                                }
-                                else
-                                {
-                                    // If it is outside, then i cannot be inside
-                                    // j.
-                                    break;
-                                }
-                                previousPoint = point;
-                            }
-                        }
-                    }
-                    // Note that isPointInRing only test strict inclusion in the
-                    // ring.
-                    else if (asPolyEx[i].bIsPolygon && asPolyEx[j].bIsPolygon &&
-                             asPolyEx[j]
-                                 .poExteriorRing->toLinearRing()
-                                 ->isPointInRing(&asPolyEx[i].poAPoint, FALSE))
-                    {
-                        b_i_inside_j = true;
-                    }
-                }
-                else if (asPolyEx[j].poPolygon->Contains(asPolyEx[i].poPolygon))
-                {
-                    b_i_inside_j = true;
-                }
+                if (!poJobQueue->SubmitJob(OGROrganizePolygonsJobFunc,
+                                           &asJobs[iJob]))
+                    OGROrganizePolygonsJobFunc(&asJobs[iJob]);
             }
+            OGROrganizePolygonsJobFunc(&asJobs[0]);
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            OGROrganizePolygonsJobFunc(&asJobs[0]);
+        }
 
-            if (b_i_inside_j)
-            {
-                if (asPolyEx[j].bIsTopLevel)
-                {
-                    // We are a lake.
-                    asPolyEx[i].bIsTopLevel = false;
-                    asPolyEx[i].poEnclosingPolygon = asPolyEx[j].poPolygon;
-                }
-                else
-                {
-                    // We are included in a something not toplevel (a lake),
-                    // so in OGCSF we are considered as toplevel too.
-                    nCountTopLevel++;
-                    asPolyEx[i].bIsTopLevel = true;
-                    asPolyEx[i].poEnclosingPolygon = nullptr;
-                }
-                break;
-            }
-            // Use Overlaps instead of Intersects to be more
-            // tolerant about touching polygons.
-            else if (bUseFastVersion ||
-                     !asPolyEx[i].sEnvelope.Intersects(asPolyEx[j].sEnvelope) ||
-                     !asPolyEx[i].poPolygon->Overlaps(asPolyEx[j].poPolygon))
-            {
-            }
-            else
+        if (sContext.hQuadTree)
+            CPLQuadTreeDestroy(sContext.hQuadTree);
+
+        // Deduce the top-level status of each polygon from the one of its
+        // enclosing polygon, which has a lower rank.
+        for (int i = 1; bValidTopology && i < nPolys; i++)
+        {
+            auto &sPolyEx = asPolyEx[i];
+            if (sPolyEx.nOverlappingIdx >= 0)
             {
                 // Bad... The polygons are intersecting but no one is
                 // contained inside the other one. This is a really broken
@@ -2089,29 +2252,37 @@ OGRGeometry *OGRGeometryFactory::organizePolygons(OGRGeometry **papoPolygons,
                 // polygons.
                 bValidTopology = false;
 #ifdef DEBUG
+                const int j = sPolyEx.nOverlappingIdx;
                 char *wkt1 = nullptr;
                 char *wkt2 = nullptr;
-                asPolyEx[i].poPolygon->exportToWkt(&wkt1);
+                sPolyEx.poPolygon->exportToWkt(&wkt1);
                 asPolyEx[j].poPolygon->exportToWkt(&wkt2);
                 CPLDebug("OGR",
                          "Bad intersection for polygons %d and %d\n"
                          "geom %d: %s\n"
                          "geom %d: %s",
-                         static_cast<int>(i), j, static_cast<int>(i), wkt1, j,
-                         wkt2);
+                         i, j, i, wkt1, j, wkt2);
                 CPLFree(wkt1);
                 CPLFree(wkt2);
 #endif
             }
-        }
-
-        if (j < 0)
-        {
-            // We come here because we are not included in anything.
-            // We are toplevel.
-            nCountTopLevel++;
-            asPolyEx[i].bIsTopLevel = true;
-            asPolyEx[i].poEnclosingPolygon = nullptr;
+            else if (sPolyEx.nEnclosingIdx >= 0 &&
+                     asPolyEx[sPolyEx.nEnclosingIdx].bIsTopLevel)
+            {
+                // We are a lake.
+                sPolyEx.bIsTopLevel = false;
+                sPolyEx.poEnclosingPolygon =
+                    asPolyEx[sPolyEx.nEnclosingIdx].poPolygon;
+            }
+            else
+            {
+                // We are not included in anything, or included in something
+                // not toplevel (a lake), so in OGCSF we are considered as
+                // toplevel too.
+                nCountTopLevel++;
+                sPolyEx.bIsTopLevel = true;
+                sPolyEx.poEnclosingPolygon = nullptr;
+            }
         }
     }
 
@@ -2219,6 +2390,221 @@ OGRGeometry *OGRGeometryFactory::createFromGML(const char *pszData)
     return OGRGeometry::FromHandle(hGeom);
 }
 
+#if defined(HAVE_GEOS) &&                                                      \
+    (GEOS_VERSION_MAJOR > 3 ||                                                 \
+     (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10))
+
+/************************************************************************/
+/*                      OGRSetPointsFromGEOSSeq()                       */
+/************************************************************************/
+
+// Copies the coordinates of a GEOS coordinate sequence into a curve.
+static bool OGRSetPointsFromGEOSSeq(GEOSContextHandle_t hGEOSCtxt,
+                                    const GEOSCoordSequence *hSeq,
+                                    OGRSimpleCurve *poCurve, bool bHasZ,
+                                    bool bHasM)
+{
+    unsigned nPoints = 0;
+    if (!GEOSCoordSeq_getSize_r(hGEOSCtxt, hSeq, &nPoints) ||
+        nPoints > static_cast<unsigned>(std::numeric_limits<int>::max()))
+        return false;
+    if (nPoints == 0)
+    {
+        poCurve->empty();
+        return true;
+    }
+
+    std::vector<OGRRawPoint> aoPoints;
+    std::vector<double> adfBuffer, adfZ, adfM;
+    try
+    {
+        aoPoints.resize(nPoints);
+        if (bHasZ || bHasM)
+        {
+            adfBuffer.resize((2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0)) *
+                             static_cast<size_t>(nPoints));
+            adfZ.resize(bHasZ ? nPoints : 0);
+            adfM.resize(bHasM ? nPoints : 0);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in createFromGEOS()");
+        return false;
+    }
+
+    if (!bHasZ && !bHasM)
+    {
+        // The x,y buffer of GEOS has the layout of an OGRRawPoint array
+        if (!GEOSCoordSeq_copyToBuffer_r(
+                hGEOSCtxt, hSeq, reinterpret_cast<double *>(aoPoints.data()),
+                false, false))
+            return false;
+        poCurve->setPoints(static_cast<int>(nPoints), aoPoints.data());
+    }
+    else
+    {
+        if (!GEOSCoordSeq_copyToBuffer_r(hGEOSCtxt, hSeq, adfBuffer.data(),
+                                         bHasZ, bHasM))
+            return false;
+        const double *padfIn = adfBuffer.data();
+        for (unsigned i = 0; i < nPoints; ++i)
+        {
+            aoPoints[i].x = *(padfIn++);
+            aoPoints[i].y = *(padfIn++);
+            if (bHasZ)
+                adfZ[i] = *(padfIn++);
+            if (bHasM)
+                adfM[i] = *(padfIn++);
+        }
+        poCurve->setPoints(static_cast<int>(nPoints), aoPoints.data(),
+                           bHasZ ? adfZ.data() : nullptr,
+                           bHasM ? adfM.data() : nullptr);
+    }
+    return static_cast<unsigned>(poCurve->getNumPoints()) == nPoints;
+}
+
+/************************************************************************/
+/*                     OGRCreateFromGEOSDirect()                        */
+/************************************************************************/
+
+// Builds an OGR geometry from the coordinate sequences of a GEOS geometry,
+// without going through WKB. bSupported is set to false if the geometry
+// must be imported through WKB instead.
+static std::unique_ptr<OGRGeometry>
+OGRCreateFromGEOSDirect(GEOSContextHandle_t hGEOSCtxt,
+                        const GEOSGeometry *hGeom, bool bHasZ, bool bHasM,
+                        bool &bSupported)
+{
+    const auto CreateCurve =
+        [hGEOSCtxt, bHasZ, bHasM](const GEOSGeometry *hLine,
+                                  OGRSimpleCurve *poCurve) -> bool
+    {
+        const GEOSCoordSequence *hSeq =
+            GEOSGeom_getCoordSeq_r(hGEOSCtxt, hLine);
+        if (!hSeq)
+            return false;
+        if (bHasZ)
+            poCurve->set3D(TRUE);
+        if (bHasM)
+            poCurve->setMeasured(TRUE);
+        return OGRSetPointsFromGEOSSeq(hGEOSCtxt, hSeq, poCurve, bHasZ,
+                                       bHasM);
+    };
+
+    std::unique_ptr<OGRGeometry> poRet;
+    const int nGEOSType = GEOSGeomTypeId_r(hGEOSCtxt, hGeom);
+    switch (nGEOSType)
+    {
+        case GEOS_POINT:
+        {
+            auto poPoint = std::make_unique<OGRPoint>();
+            if (bHasZ)
+                poPoint->set3D(TRUE);
+            if (bHasM)
+                poPoint->setMeasured(TRUE);
+            if (!GEOSisEmpty_r(hGEOSCtxt, hGeom))
+            {
+                const GEOSCoordSequence *hSeq =
+                    GEOSGeom_getCoordSeq_r(hGEOSCtxt, hGeom);
+                double adfCoords[4] = {0, 0, 0, 0};
+                if (!hSeq || !GEOSCoordSeq_copyToBuffer_r(
+                                 hGEOSCtxt, hSeq, adfCoords, bHasZ, bHasM))
+                    return nullptr;
+                int iDim = 0;
+                poPoint->setX(adfCoords[iDim++]);
+                poPoint->setY(adfCoords[iDim++]);
+                if (bHasZ)
+                    poPoint->setZ(adfCoords[iDim++]);
+                if (bHasM)
+                    poPoint->setM(adfCoords[iDim++]);
+            }
+            poRet = std::move(poPoint);
+            break;
+        }
+
+        case GEOS_LINESTRING:
+        case GEOS_LINEARRING:
+        {
+            auto poLS = std::make_unique<OGRLineString>();
+            if (!CreateCurve(hGeom, poLS.get()))
+                return nullptr;
+            poRet = std::move(poLS);
+            break;
+        }
+
+        case GEOS_POLYGON:
+        {
+            auto poPoly = std::make_unique<OGRPolygon>();
+            if (!GEOSisEmpty_r(hGEOSCtxt, hGeom))
+            {
+                const GEOSGeometry *hShell =
+                    GEOSGetExteriorRing_r(hGEOSCtxt, hGeom);
+                auto poShell = std::make_unique<OGRLinearRing>();
+                if (!hShell || !CreateCurve(hShell, poShell.get()))
+                    return nullptr;
+                poPoly->addRingDirectly(poShell.release());
+                const int nHoles = GEOSGetNumInteriorRings_r(hGEOSCtxt, hGeom);
+                for (int i = 0; i < nHoles; ++i)
+                {
+                    const GEOSGeometry *hHole =
+                        GEOSGetInteriorRingN_r(hGEOSCtxt, hGeom, i);
+                    auto poHole = std::make_unique<OGRLinearRing>();
+                    if (!hHole || !CreateCurve(hHole, poHole.get()))
+                        return nullptr;
+                    poPoly->addRingDirectly(poHole.release());
+                }
+            }
+            poRet = std::move(poPoly);
+            break;
+        }
+
+        case GEOS_MULTIPOINT:
+        case GEOS_MULTILINESTRING:
+        case GEOS_MULTIPOLYGON:
+        case GEOS_GEOMETRYCOLLECTION:
+        {
+            std::unique_ptr<OGRGeometryCollection> poGC;
+            if (nGEOSType == GEOS_MULTIPOINT)
+                poGC = std::make_unique<OGRMultiPoint>();
+            else if (nGEOSType == GEOS_MULTILINESTRING)
+                poGC = std::make_unique<OGRMultiLineString>();
+            else if (nGEOSType == GEOS_MULTIPOLYGON)
+                poGC = std::make_unique<OGRMultiPolygon>();
+            else
+                poGC = std::make_unique<OGRGeometryCollection>();
+            const int nParts = GEOSGetNumGeometries_r(hGEOSCtxt, hGeom);
+            for (int i = 0; i < nParts; ++i)
+            {
+                const GEOSGeometry *hPart =
+                    GEOSGetGeometryN_r(hGEOSCtxt, hGeom, i);
+                if (!hPart)
+                    return nullptr;
+                auto poPart = OGRCreateFromGEOSDirect(hGEOSCtxt, hPart, bHasZ,
+                                                      bHasM, bSupported);
+                if (!poPart ||
+                    poGC->addGeometryDirectly(poPart.release()) != OGRERR_NONE)
+                    return nullptr;
+            }
+            poRet = std::move(poGC);
+            break;
+        }
+
+        default:
+            bSupported = false;
+            return nullptr;
+    }
+
+    if (bHasZ)
+        poRet->set3D(TRUE);
+    if (bHasM)
+        poRet->setMeasured(TRUE);
+    return poRet;
+}
+
+#endif
+
 /************************************************************************/
 /*                           createFromGEOS()                           */
 /************************************************************************/
@@ -2251,6 +2637,29 @@ OGRGeometry *OGRGeometryFactory::createFromGEOS(
 
     const int nCoordDim =
         GEOSGeom_getCoordinateDimension_r(hGEOSCtxt, geosGeom);
+
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10)
+    {
+        // Read the coordinate sequences directly when possible, which
+        // avoids the cost of a WKB serialization and parsing.
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 12)
+        const bool bHasM = GEOSHasM_r(hGEOSCtxt, geosGeom) == 1;
+#else
+        const bool bHasM = false;
+#endif
+        const bool bHasZ = nCoordDim - (bHasM ? 1 : 0) >= 3;
+        bool bSupported = true;
+        auto poDirect = OGRCreateFromGEOSDirect(hGEOSCtxt, geosGeom, bHasZ,
+                                                bHasM, bSupported);
+        if (poDirect)
+            return poDirect.release();
+        if (bSupported)
+            return nullptr;
+    }
+#endif
+
     GEOSWKBWriter *wkbwriter = GEOSWKBWriter_create_r(hGEOSCtxt);
     GEOSWKBWriter_setOutputDimension_r(hGEOSCtxt, wkbwriter, nCoordDim);
     pabyBuf = GEOSWKBWriter_write_r(hGEOSCtxt, wkbwriter, geosGeom, &nSize);
@@ -4005,6 +4414,381 @@ OGRGeometry *OGRGeometryFactory::transformWithOptions(
     return poDstGeom;
 }
 
+/************************************************************************/
+/*                        transformGeometries()                         */
+/************************************************************************/
+
+namespace
+{
+
+/** Leaf geometry of a batch, with the position of its coordinates in the
+ * gathered arrays. */
+struct OGRBatchTransformPart
+{
+    OGRGeometry *poGeom = nullptr;
+    size_t nFirstPoint = 0;
+    int nTopLevelIdx = 0;
+    bool bClosedRing = false;
+};
+
+/** Collect the points and simple curves of a geometry. Returns false if the
+ * geometry contains a part that must be transformed by its own transform()
+ * method.
+ */
+bool OGRBatchTransformCollect(OGRGeometry *poGeom, int nTopLevelIdx,
+                              size_t &nPoints,
+                              std::vector<OGRBatchTransformPart> &aoParts)
+{
+    const auto eFlatType = wkbFlatten(poGeom->getGeometryType());
+    switch (eFlatType)
+    {
+        case wkbPoint:
+        {
+            // OGRPoint::transform() on an empty point is not pointwise.
+            if (poGeom->IsEmpty())
+                return false;
+            OGRBatchTransformPart oPart;
+            oPart.poGeom = poGeom;
+            oPart.nFirstPoint = nPoints;
+            oPart.nTopLevelIdx = nTopLevelIdx;
+            aoParts.push_back(oPart);
+            ++nPoints;
+            return true;
+        }
+
+        case wkbLineString:
+        case wkbCircularString:
+        {
+            auto poSC = poGeom->toSimpleCurve();
+            OGRBatchTransformPart oPart;
+            oPart.poGeom = poGeom;
+            oPart.nFirstPoint = nPoints;
+            oPart.nTopLevelIdx = nTopLevelIdx;
+            // Same safety belt as OGRLinearRing::transform()
+            oPart.bClosedRing =
+                EQUAL(poSC->getGeometryName(), "LINEARRING") &&
+                poSC->getNumPoints() > 2 && CPL_TO_BOOL(poSC->get_IsClosed());
+            aoParts.push_back(oPart);
+            nPoints += poSC->getNumPoints();
+            return true;
+        }
+
+        case wkbCompoundCurve:
+        {
+            for (auto *poSubGeom : *(poGeom->toCompoundCurve()))
+            {
+                if (!OGRBatchTransformCollect(poSubGeom, nTopLevelIdx, nPoints,
+                                              aoParts))
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbPolygon:
+        case wkbCurvePolygon:
+        case wkbTriangle:
+        {
+            for (auto *poRing : *(poGeom->toCurvePolygon()))
+            {
+                if (!OGRBatchTransformCollect(poRing, nTopLevelIdx, nPoints,
+                                              aoParts))
+                    return false;
+            }
+            return true;
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbMultiCurve:
+        case wkbMultiSurface:
+        case wkbGeometryCollection:
+        {
+            for (auto *poSubGeom : *(poGeom->toGeometryCollection()))
+            {
+                if (!OGRBatchTransformCollect(poSubGeom, nTopLevelIdx, nPoints,
+                                              aoParts))
+                    return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/** Chunk of coordinates transformed by a worker thread */
+struct OGRBatchTransformJob
+{
+    OGRCoordinateTransformation *poCT = nullptr;
+    size_t nCount = 0;
+    double *padfX = nullptr;
+    double *padfY = nullptr;
+    double *padfZ = nullptr;
+    int *pabSuccess = nullptr;
+};
+
+void OGRBatchTransformJobFunc(void *pData)
+{
+    auto psJob = static_cast<OGRBatchTransformJob *>(pData);
+    // Failed geometries are transformed again by their own transform()
+    // method, which reports the errors.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    psJob->poCT->Transform(psJob->nCount, psJob->padfX, psJob->padfY,
+                           psJob->padfZ, nullptr, psJob->pabSuccess);
+}
+
+}  // namespace
+
+/** Transform several geometries in place with the same coordinate
+ * transformation.
+ *
+ * This has the same effect as calling OGRGeometry::transform() on each
+ * geometry, but the coordinates of all geometries are gathered in
+ * contiguous arrays and transformed with a single call to
+ * OGRCoordinateTransformation::Transform(), which avoids the per-call
+ * overhead when transforming many small geometries.
+ *
+ * Geometries for which at least one point fails to transform, as well as
+ * polyhedral surfaces, TINs and empty points, are by default transformed
+ * with OGRGeometry::transform(), so that OGR_ENABLE_PARTIAL_REPROJECTION and
+ * error reporting work as usual.
+ *
+ * @param poCT coordinate transformation object. Must not be NULL.
+ * @param nGeomCount number of geometries.
+ * @param papoGeoms array of nGeomCount geometries. May contain NULL pointers.
+ * @param paeErrors array of nGeomCount values, set to the result of the
+ *                  transformation of each geometry (OGRERR_NONE for NULL
+ *                  geometries), or NULL.
+ * @param nThreads maximum number of threads among which coordinates are
+ *                 dispatched. Each thread uses a clone of poCT, which must
+ *                 then support Clone(). Only used for batches of at least a
+ *                 few ten thousands of points.
+ * @param bFallbackOnFailure if false, the geometries that would need to be
+ *                 transformed with OGRGeometry::transform() are left
+ *                 unmodified, and their error code is set to
+ *                 OGRERR_FAILURE, without any error being emitted.
+ * @return true if all geometries have been successfully transformed.
+ * @since GDAL 3.10
+ */
+bool OGRGeometryFactory::transformGeometries(OGRCoordinateTransformation *poCT,
+                                             int nGeomCount,
+                                             OGRGeometry *const *papoGeoms,
+                                             OGRErr *paeErrors, int nThreads,
+                                             bool bFallbackOnFailure)
+{
+    std::vector<OGRBatchTransformPart> aoParts;
+    std::vector<bool> abFallback(nGeomCount);
+    size_t nPoints = 0;
+    for (int i = 0; i < nGeomCount; ++i)
+    {
+        if (paeErrors)
+            paeErrors[i] = OGRERR_NONE;
+        if (papoGeoms[i] == nullptr)
+            continue;
+        const size_t nPartsBefore = aoParts.size();
+        const size_t nPointsBefore = nPoints;
+        if (!OGRBatchTransformCollect(papoGeoms[i], i, nPoints, aoParts))
+        {
+            aoParts.resize(nPartsBefore);
+            nPoints = nPointsBefore;
+            abFallback[i] = true;
+        }
+    }
+
+    std::vector<double> adfX, adfY, adfZ;
+    std::vector<int> abSuccess;
+    try
+    {
+        adfX.resize(nPoints);
+        adfY.resize(nPoints);
+        adfZ.resize(nPoints);
+        abSuccess.resize(nPoints);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for batch transformation");
+        for (int i = 0; i < nGeomCount; ++i)
+        {
+            if (papoGeoms[i] && paeErrors)
+                paeErrors[i] = OGRERR_NOT_ENOUGH_MEMORY;
+        }
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Gather coordinates.                                             */
+    /* -------------------------------------------------------------------- */
+    for (const auto &oPart : aoParts)
+    {
+        const size_t iFirst = oPart.nFirstPoint;
+        if (wkbFlatten(oPart.poGeom->getGeometryType()) == wkbPoint)
+        {
+            const auto poPoint = oPart.poGeom->toPoint();
+            adfX[iFirst] = poPoint->getX();
+            adfY[iFirst] = poPoint->getY();
+            adfZ[iFirst] = poPoint->getZ();
+        }
+        else
+        {
+            const auto poSC = oPart.poGeom->toSimpleCurve();
+            const int nCount = poSC->getNumPoints();
+            if (nCount == 0)
+                continue;
+            if (poSC->Is3D())
+            {
+                poSC->getPoints(&adfX[iFirst], sizeof(double), &adfY[iFirst],
+                                sizeof(double), &adfZ[iFirst], sizeof(double));
+            }
+            else
+            {
+                poSC->getPoints(&adfX[iFirst], sizeof(double), &adfY[iFirst],
+                                sizeof(double));
+                std::fill_n(adfZ.begin() + iFirst, nCount, 0.0);
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform them, possibly in several threads.                    */
+    /* -------------------------------------------------------------------- */
+    constexpr size_t MIN_POINTS_PER_THREAD = 10000;
+    nThreads = static_cast<int>(std::max<size_t>(
+        1, std::min(static_cast<size_t>(std::max(1, nThreads)),
+                    nPoints / MIN_POINTS_PER_THREAD)));
+    std::vector<std::unique_ptr<OGRCoordinateTransformation>> apoClonedCT;
+    for (int i = 1; i < nThreads; ++i)
+    {
+        apoClonedCT.emplace_back(poCT->Clone());
+        if (!apoClonedCT.back())
+        {
+            CPLDebug("OGR", "Cannot clone coordinate transformation. "
+                            "Transforming in a single thread");
+            apoClonedCT.clear();
+            nThreads = 1;
+            break;
+        }
+    }
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+        nThreads = 1;
+
+    std::vector<OGRBatchTransformJob> asJobs(nThreads);
+    const size_t nPointsPerJob = (nPoints + nThreads - 1) / nThreads;
+    for (int i = 0; i < nThreads; ++i)
+    {
+        auto &sJob = asJobs[i];
+        const size_t nStart =
+            std::min(nPoints, static_cast<size_t>(i) * nPointsPerJob);
+        sJob.poCT = i == 0 ? poCT : apoClonedCT[i - 1].get();
+        sJob.nCount = std::min(nPointsPerJob, nPoints - nStart);
+        sJob.padfX = adfX.data() + nStart;
+        sJob.padfY = adfY.data() + nStart;
+        sJob.padfZ = adfZ.data() + nStart;
+        sJob.pabSuccess = abSuccess.data() + nStart;
+    }
+    if (poThreadPool)
+    {
+        auto poJobQueue = poThreadPool->CreateJobQueue();
+        for (int i = 1; i < nThreads; ++i)
+        {
+            if (!poJobQueue->SubmitJob(OGRBatchTransformJobFunc, &asJobs[i]))
+                OGRBatchTransformJobFunc(&asJobs[i]);
+        }
+        OGRBatchTransformJobFunc(&asJobs[0]);
+        poJobQueue->WaitCompletion();
+    }
+    else if (nPoints > 0)
+    {
+        OGRBatchTransformJobFunc(&asJobs[0]);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Find geometries with failed points.                             */
+    /* -------------------------------------------------------------------- */
+    {
+        size_t iPart = 0;
+        while (iPart < aoParts.size())
+        {
+            const int nTopLevelIdx = aoParts[iPart].nTopLevelIdx;
+            const size_t nFirstPoint = aoParts[iPart].nFirstPoint;
+            while (iPart < aoParts.size() &&
+                   aoParts[iPart].nTopLevelIdx == nTopLevelIdx)
+                ++iPart;
+            const size_t nEndPoint =
+                iPart < aoParts.size() ? aoParts[iPart].nFirstPoint : nPoints;
+            for (size_t j = nFirstPoint; j < nEndPoint; ++j)
+            {
+                if (!abSuccess[j])
+                {
+                    abFallback[nTopLevelIdx] = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Scatter coordinates back.                                       */
+    /* -------------------------------------------------------------------- */
+    for (const auto &oPart : aoParts)
+    {
+        if (abFallback[oPart.nTopLevelIdx])
+            continue;
+        const size_t iFirst = oPart.nFirstPoint;
+        if (wkbFlatten(oPart.poGeom->getGeometryType()) == wkbPoint)
+        {
+            auto poPoint = oPart.poGeom->toPoint();
+            poPoint->setX(adfX[iFirst]);
+            poPoint->setY(adfY[iFirst]);
+            if (poPoint->Is3D())
+                poPoint->setZ(adfZ[iFirst]);
+        }
+        else
+        {
+            auto poSC = oPart.poGeom->toSimpleCurve();
+            const int nCount = poSC->getNumPoints();
+            if (nCount == 0)
+                continue;
+            poSC->setPoints(nCount, &adfX[iFirst], &adfY[iFirst],
+                            poSC->Is3D() ? &adfZ[iFirst] : nullptr);
+            if (oPart.bClosedRing && !poSC->get_IsClosed())
+            {
+                CPLDebug("OGR", "Linearring is not closed after coordinate "
+                                "transformation. Forcing last point to be "
+                                "identical to first one");
+                OGRPoint oStartPoint;
+                poSC->StartPoint(&oStartPoint);
+                poSC->setPoint(nCount - 1, &oStartPoint);
+            }
+        }
+    }
+
+    bool bRet = true;
+    for (int i = 0; i < nGeomCount; ++i)
+    {
+        if (papoGeoms[i] == nullptr)
+            continue;
+        OGRErr eErr = OGRERR_NONE;
+        if (abFallback[i])
+        {
+            eErr = bFallbackOnFailure ? papoGeoms[i]->transform(poCT)
+                                      : OGRERR_FAILURE;
+        }
+        else
+            papoGeoms[i]->assignSpatialReference(poCT->GetTargetCS());
+        if (paeErrors)
+            paeErrors[i] = eErr;
+        if (eErr != OGRERR_NONE)
+            bRet = false;
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                         OGRGeomTransformer()                         */
 /************************************************************************/
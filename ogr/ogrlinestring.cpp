@@ -1881,7 +1881,7 @@ OGRErr OGRSimpleCurve::importFromWKTListOnly(const char **ppszInput, int bHasZ,
 /*                            exportToWkt()                             */
 /*                                                                      */
 /*      Translate this structure into its well known text format       */
-/*      equivalent.  This could be made a lot more CPU efficient.       */
+/*      equivalent.                                                     */
 /************************************************************************/
 
 std::string OGRSimpleCurve::exportToWkt(const OGRWktOptions &opts,
@@ -1911,14 +1911,23 @@ std::string OGRSimpleCurve::exportToWkt(const OGRWktOptions &opts,
             wkt.reserve(wkt.size() + 2 * static_cast<size_t>(nPointCount) *
                                          nOrdinatesPerVertex);
 
+            char szCoordinate[256];
             for (int i = 0; i < nPointCount; i++)
             {
                 if (i > 0)
                     wkt += ',';
 
-                wkt += OGRMakeWktCoordinateM(
-                    paoPoints[i].x, paoPoints[i].y, padfZ ? padfZ[i] : 0.0,
-                    padfM ? padfM[i] : 0.0, hasZ, hasM, opts);
+                const double dfZ = padfZ ? padfZ[i] : 0.0;
+                const double dfM = padfM ? padfM[i] : 0.0;
+                const size_t nLen = OGRMakeWktCoordinateMToBuffer(
+                    szCoordinate, sizeof(szCoordinate), paoPoints[i].x,
+                    paoPoints[i].y, dfZ, dfM, hasZ, hasM, opts);
+                if (nLen > 0)
+                    wkt.append(szCoordinate, nLen);
+                else
+                    wkt += OGRMakeWktCoordinateM(paoPoints[i].x,
+                                                 paoPoints[i].y, dfZ, dfM,
+                                                 hasZ, hasM, opts);
             }
             wkt += ')';
         }
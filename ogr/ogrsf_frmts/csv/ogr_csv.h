@@ -33,7 +33,10 @@
 
 #include "ogrsf_frmts.h"
 
+#include <memory>
 #include <set>
+#include <string>
+#include <vector>
 
 typedef enum
 {
@@ -60,6 +63,85 @@ void OGRCSVDriverRemoveFromMap(const char *pszName, GDALDataset *poDS);
 // by STRINGIFY(x) to generate open option description.
 #define OGR_CSV_DEFAULT_MAX_LINE_SIZE 10000000
 
+/************************************************************************/
+/*                         OGRCSVChunkedReader                          */
+/************************************************************************/
+
+// Reads a CSV file by large chunks, splits them into records (taking into
+// account line breaks inside quoted fields) and tokenizes the records,
+// possibly using several threads. Records that cannot be safely handled
+// (NUL characters, lines longer than the maximum line size) cause the
+// reader to return FALLBACK, in which case the caller should seek back to
+// GetFallbackOffset() and continue with CSVReadParseLine3L().
+class OGRCSVChunkedReader
+{
+  public:
+    enum class Status
+    {
+        RECORD,
+        END,
+        FALLBACK
+    };
+
+    OGRCSVChunkedReader(VSILFILE *fp, char chDelimiter, bool bMergeDelimiter,
+                        int nMaxLineSize, size_t nChunkSize, int nNumThreads);
+    ~OGRCSVChunkedReader();
+
+    // On RECORD, papszTokens is owned by the reader and remains valid
+    // until the next call.
+    Status GetNextRecord(char **&papszTokens);
+
+    vsi_l_offset GetFallbackOffset() const
+    {
+        return m_nFallbackOffset;
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGRCSVChunkedReader)
+
+    struct Record
+    {
+        size_t nStart = 0;
+        size_t nEnd = 0;
+        bool bHasQuotes = false;
+        bool bHasLineBreaks = false;
+    };
+
+    struct TokenizedRange
+    {
+        std::string osTokens{};
+        std::vector<size_t> anTokenOffsets{};
+        std::vector<size_t> anRecordFirstToken{};
+    };
+
+    VSILFILE *m_fp = nullptr;
+    const char m_chDelimiter;
+    const bool m_bMergeDelimiter;
+    const int m_nMaxLineSize;
+    const size_t m_nChunkSize;
+    const int m_nNumThreads;
+
+    std::vector<char> m_abyBuffer{};
+    size_t m_nBufferSize = 0;
+    size_t m_nConsumed = 0;
+    vsi_l_offset m_nBufferFileOffset = 0;
+    bool m_bEOF = false;
+    bool m_bFallback = false;
+    vsi_l_offset m_nFallbackOffset = 0;
+
+    std::vector<Record> m_asRecords{};
+    std::vector<TokenizedRange> m_asRanges{};
+    size_t m_iCurRange = 0;
+    size_t m_iCurRecordInRange = 0;
+    std::vector<char *> m_apszCurTokens{};
+
+    bool ProcessNextChunk();
+    void FindRecords();
+    void TokenizeRange(size_t iRange, size_t iFirstRecord, size_t nRecords);
+    void TokenizeRecord(const Record &sRecord, TokenizedRange &sRange,
+                        std::string &osTmp) const;
+};
+
 /************************************************************************/
 /*                             OGRCSVLayer                              */
 /************************************************************************/
@@ -97,7 +179,8 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     bool bHasFieldNames;
 
-    OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *
+    GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse = nullptr);
 
     bool bNew;
     bool bInWriteMode;
@@ -148,7 +231,19 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     StringQuoting m_eStringQuoting = StringQuoting::IF_AMBIGUOUS;
 
+    std::unique_ptr<OGRCSVChunkedReader> m_poChunkedReader{};
+    bool m_bTryChunkedReader = true;
+    bool m_bTokensOwnedByChunkedReader = false;
+    int m_nNumThreads = 1;
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    // Record read by GetNextArrowArray() that did not fit in the batch
+    CPLStringList m_aosPendingTokens{};
+
     char **GetNextLineTokens();
+    void ReleaseLineTokens(char **papszTokens);
+    int ParseBooleanToken(const char *pszToken,
+                          const OGRFieldDefn *poFieldDefn);
+    bool CheckNumericToken(char *pszToken, const OGRFieldDefn *poFieldDefn);
 
     static bool Matches(const char *pszFieldName, char **papszPossibleNames);
 
@@ -226,6 +321,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeatureUniquePtr &poFeature) override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
 
     OGRFeatureDefn *GetLayerDefn() override
@@ -233,6 +329,12 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
         return poFeatureDefn;
     }
 
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
     int TestCapability(const char *) override;
 
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
@@ -0,0 +1,513 @@
+/******************************************************************************
+ *
+ * Project:  CSV Translator
+ * Purpose:  Implements OGRCSVChunkedReader class.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, Even Rouault <even dot rouault at spatialys.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "ogr_csv.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define OGR_CSV_USE_SSE2
+#endif
+
+#include "cpl_error.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+
+// Minimum number of records per tokenizing job
+constexpr size_t MIN_RECORDS_PER_JOB = 1000;
+
+/************************************************************************/
+/*                         OGRCSVChunkedReader()                        */
+/************************************************************************/
+
+OGRCSVChunkedReader::OGRCSVChunkedReader(VSILFILE *fp, char chDelimiter,
+                                         bool bMergeDelimiter,
+                                         int nMaxLineSize, size_t nChunkSize,
+                                         int nNumThreads)
+    : m_fp(fp), m_chDelimiter(chDelimiter), m_bMergeDelimiter(bMergeDelimiter),
+      m_nMaxLineSize(nMaxLineSize),
+      m_nChunkSize(std::max<size_t>(1, nChunkSize)), m_nNumThreads(nNumThreads),
+      m_nBufferFileOffset(VSIFTellL(fp))
+{
+}
+
+/************************************************************************/
+/*                        ~OGRCSVChunkedReader()                        */
+/************************************************************************/
+
+OGRCSVChunkedReader::~OGRCSVChunkedReader() = default;
+
+/************************************************************************/
+/*                          IsSpecialChar()                             */
+/************************************************************************/
+
+// Characters that must be looked at when searching for record boundaries.
+static inline bool IsSpecialChar(char ch)
+{
+    return ch == '"' || ch == '\r' || ch == '\n' || ch == '\0';
+}
+
+/************************************************************************/
+/*                        SkipOrdinaryChars()                           */
+/************************************************************************/
+
+// Returns the index of the first special character at or after i, or nSize.
+static size_t SkipOrdinaryChars(const char *pabyData, size_t i, size_t nSize)
+{
+#ifdef OGR_CSV_USE_SSE2
+    const __m128i chQuote = _mm_set1_epi8('"');
+    const __m128i chCR = _mm_set1_epi8('\r');
+    const __m128i chLF = _mm_set1_epi8('\n');
+    const __m128i chZero = _mm_setzero_si128();
+    while (i + sizeof(__m128i) <= nSize)
+    {
+        const __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pabyData + i));
+        const __m128i mask =
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, chQuote),
+                                      _mm_cmpeq_epi8(v, chCR)),
+                         _mm_or_si128(_mm_cmpeq_epi8(v, chLF),
+                                      _mm_cmpeq_epi8(v, chZero)));
+        if (_mm_movemask_epi8(mask) != 0)
+            break;
+        i += sizeof(__m128i);
+    }
+#endif
+    while (i < nSize && !IsSpecialChar(pabyData[i]))
+        ++i;
+    return i;
+}
+
+/************************************************************************/
+/*                            FindRecords()                             */
+/************************************************************************/
+
+// Split the buffer into records, in a way consistent with
+// CSVReadParseLine3L(): a line is terminated by CR, LF, CR+LF or LF+CR, and
+// a record extends over several lines as long as the number of double quote
+// characters it contains is odd.
+void OGRCSVChunkedReader::FindRecords()
+{
+    m_asRecords.clear();
+
+    const char *pabyData = m_abyBuffer.data();
+    const size_t nSize = m_nBufferSize;
+    size_t nRecordStart = 0;
+    size_t nLineStart = 0;
+    size_t nLastLineEnd = 0;
+    bool bOddQuotes = false;
+    bool bHasQuotes = false;
+    bool bHasLineBreaks = false;
+    m_nConsumed = 0;
+
+    const auto CheckLineSize = [this, &nLineStart](size_t nLineEnd)
+    {
+        return m_nMaxLineSize <= 0 ||
+               nLineEnd - nLineStart < static_cast<size_t>(m_nMaxLineSize);
+    };
+
+    const auto AddRecord = [this, &nRecordStart, &bHasQuotes,
+                            &bHasLineBreaks](size_t nEnd)
+    {
+        size_t nStart = nRecordStart;
+        // Skip UTF-8 BOM
+        if (nEnd - nStart >= 3 &&
+            static_cast<GByte>(m_abyBuffer[nStart]) == 0xEF &&
+            static_cast<GByte>(m_abyBuffer[nStart + 1]) == 0xBB &&
+            static_cast<GByte>(m_abyBuffer[nStart + 2]) == 0xBF)
+        {
+            nStart += 3;
+        }
+        // Empty lines are skipped by the layer anyway
+        if (nEnd > nStart)
+        {
+            Record sRecord;
+            sRecord.nStart = nStart;
+            sRecord.nEnd = nEnd;
+            sRecord.bHasQuotes = bHasQuotes;
+            sRecord.bHasLineBreaks = bHasLineBreaks;
+            m_asRecords.push_back(sRecord);
+        }
+    };
+
+    size_t i = 0;
+    while (true)
+    {
+        i = SkipOrdinaryChars(pabyData, i, nSize);
+        if (i == nSize)
+            break;
+        const char ch = pabyData[i];
+        if (ch == '"')
+        {
+            bOddQuotes = !bOddQuotes;
+            bHasQuotes = true;
+            ++i;
+            continue;
+        }
+        if (ch == '\0' || !CheckLineSize(i))
+        {
+            // Let the regular code path deal with (and report) that
+            m_bFallback = true;
+            m_nFallbackOffset = m_nBufferFileOffset + nRecordStart;
+            return;
+        }
+
+        // End of line
+        size_t nTerminatorSize = 1;
+        if (i + 1 == nSize)
+        {
+            if (!m_bEOF)
+                break;  // we need to know the next character
+        }
+        else if ((ch == '\r' && pabyData[i + 1] == '\n') ||
+                 (ch == '\n' && pabyData[i + 1] == '\r'))
+        {
+            nTerminatorSize = 2;
+        }
+
+        if (!bOddQuotes)
+        {
+            AddRecord(i);
+            nRecordStart = i + nTerminatorSize;
+            m_nConsumed = nRecordStart;
+            bHasQuotes = false;
+            bHasLineBreaks = false;
+        }
+        else
+        {
+            bHasLineBreaks = true;
+            nLastLineEnd = i;
+        }
+        i += nTerminatorSize;
+        nLineStart = i;
+    }
+
+    // Avoid accumulating an arbitrary large amount of data for a line that
+    // would be rejected anyway.
+    if (nRecordStart < nSize && !CheckLineSize(nSize))
+    {
+        m_bFallback = true;
+        m_nFallbackOffset = m_nBufferFileOffset + nRecordStart;
+        return;
+    }
+
+    if (m_bEOF && nRecordStart < nSize)
+    {
+        // A quoted field that is not closed extends to the end of file,
+        // except for the final line terminator.
+        AddRecord(bOddQuotes && nLineStart == nSize ? nLastLineEnd : nSize);
+        m_nConsumed = nSize;
+    }
+}
+
+/************************************************************************/
+/*                          TokenizeRecord()                            */
+/************************************************************************/
+
+// Consistent with CSVSplitLine() of cpl_csv.cpp with
+// bKeepLeadingAndClosingQuotes = false, applied on the record where line
+// terminators are replaced by a single LF character.
+void OGRCSVChunkedReader::TokenizeRecord(const Record &sRecord,
+                                         TokenizedRange &sRange,
+                                         std::string &osTmp) const
+{
+    const char *pszIter = m_abyBuffer.data() + sRecord.nStart;
+    const char *pszEnd = m_abyBuffer.data() + sRecord.nEnd;
+    const char chDelimiter = m_chDelimiter;
+
+    sRange.anRecordFirstToken.push_back(sRange.anTokenOffsets.size());
+
+    // Fast path when there are no quotes: just split on the delimiter
+    if (!sRecord.bHasQuotes && !m_bMergeDelimiter)
+    {
+        while (true)
+        {
+            const char *pszDelim = static_cast<const char *>(
+                memchr(pszIter, chDelimiter, pszEnd - pszIter));
+            const char *pszTokenEnd = pszDelim ? pszDelim : pszEnd;
+            sRange.anTokenOffsets.push_back(sRange.osTokens.size());
+            sRange.osTokens.append(pszIter, pszTokenEnd - pszIter);
+            sRange.osTokens.push_back('\0');
+            if (pszDelim == nullptr)
+                break;
+            pszIter = pszDelim + 1;
+        }
+        return;
+    }
+
+    if (sRecord.bHasLineBreaks)
+    {
+        osTmp.clear();
+        for (const char *pszCur = pszIter; pszCur < pszEnd; ++pszCur)
+        {
+            if (*pszCur == '\r' || *pszCur == '\n')
+            {
+                if (pszCur + 1 < pszEnd &&
+                    ((*pszCur == '\r' && pszCur[1] == '\n') ||
+                     (*pszCur == '\n' && pszCur[1] == '\r')))
+                {
+                    ++pszCur;
+                }
+                osTmp.push_back('\n');
+            }
+            else
+            {
+                osTmp.push_back(*pszCur);
+            }
+        }
+        pszIter = osTmp.data();
+        pszEnd = pszIter + osTmp.size();
+    }
+
+    const char *const pszString = pszIter;
+    while (pszIter < pszEnd)
+    {
+        bool bInString = false;
+        size_t nTokenLen = 0;
+        sRange.anTokenOffsets.push_back(sRange.osTokens.size());
+
+        // Try to find the next delimiter, marking end of token.
+        do
+        {
+            if (!bInString && *pszIter == chDelimiter)
+            {
+                ++pszIter;
+                if (m_bMergeDelimiter)
+                {
+                    while (pszIter < pszEnd && *pszIter == chDelimiter)
+                        ++pszIter;
+                }
+                break;
+            }
+
+            if (*pszIter == '"')
+            {
+                if (!bInString && nTokenLen > 0)
+                {
+                    // do not treat in a special way double quotes that appear
+                    // in the middle of a field (similarly to OpenOffice)
+                }
+                else if (!bInString || pszIter + 1 == pszEnd ||
+                         pszIter[1] != '"')
+                {
+                    bInString = !bInString;
+                    continue;
+                }
+                else  // Doubled quotes in string resolve to one quote.
+                {
+                    ++pszIter;
+                }
+            }
+
+            sRange.osTokens.push_back(*pszIter);
+            ++nTokenLen;
+        } while (++pszIter < pszEnd);
+
+        sRange.osTokens.push_back('\0');
+
+        // If the last token is an empty token, then we have to catch
+        // it now, otherwise we won't reenter the loop and it will be lost.
+        if (pszIter == pszEnd && pszIter > pszString &&
+            pszIter[-1] == chDelimiter)
+        {
+            sRange.anTokenOffsets.push_back(sRange.osTokens.size());
+            sRange.osTokens.push_back('\0');
+        }
+    }
+}
+
+/************************************************************************/
+/*                          TokenizeRange()                             */
+/************************************************************************/
+
+void OGRCSVChunkedReader::TokenizeRange(size_t iRange, size_t iFirstRecord,
+                                        size_t nRecords)
+{
+    auto &sRange = m_asRanges[iRange];
+    sRange.osTokens.clear();
+    sRange.anTokenOffsets.clear();
+    sRange.anRecordFirstToken.clear();
+    std::string osTmp;
+    for (size_t i = iFirstRecord; i < iFirstRecord + nRecords; ++i)
+    {
+        TokenizeRecord(m_asRecords[i], sRange, osTmp);
+    }
+    sRange.anRecordFirstToken.push_back(sRange.anTokenOffsets.size());
+}
+
+/************************************************************************/
+/*                         ProcessNextChunk()                           */
+/************************************************************************/
+
+bool OGRCSVChunkedReader::ProcessNextChunk()
+{
+    m_asRecords.clear();
+    for (auto &sRange : m_asRanges)
+    {
+        sRange.anRecordFirstToken.clear();
+    }
+    m_iCurRange = 0;
+    m_iCurRecordInRange = 0;
+
+    // Move unconsumed bytes at the beginning of the buffer
+    if (m_nConsumed > 0)
+    {
+        memmove(m_abyBuffer.data(), m_abyBuffer.data() + m_nConsumed,
+                m_nBufferSize - m_nConsumed);
+        m_nBufferSize -= m_nConsumed;
+        m_nBufferFileOffset += m_nConsumed;
+        m_nConsumed = 0;
+    }
+
+    while (true)
+    {
+        if (m_bEOF && m_nBufferSize == 0)
+            return false;
+
+        if (!m_bEOF)
+        {
+            // Grow the read size when a single record does not fit in the
+            // buffer, to avoid quadratic behavior.
+            const size_t nToRead = std::max(m_nChunkSize, m_nBufferSize);
+            try
+            {
+                m_abyBuffer.resize(m_nBufferSize + nToRead);
+            }
+            catch (const std::exception &e)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+                m_bFallback = true;
+                m_nFallbackOffset = m_nBufferFileOffset;
+                return false;
+            }
+            const size_t nRead = VSIFReadL(m_abyBuffer.data() + m_nBufferSize,
+                                           1, nToRead, m_fp);
+            m_nBufferSize += nRead;
+            if (nRead < nToRead)
+                m_bEOF = true;
+        }
+
+        FindRecords();
+        if (!m_asRecords.empty() || m_bFallback || m_bEOF)
+            break;
+    }
+
+    if (m_asRecords.empty())
+        return false;
+
+    // Tokenize records, in parallel if there are enough of them
+    const size_t nRecords = m_asRecords.size();
+    const size_t nJobs = std::max<size_t>(
+        1, std::min(static_cast<size_t>(m_nNumThreads),
+                    nRecords / MIN_RECORDS_PER_JOB));
+    if (m_asRanges.size() < nJobs)
+        m_asRanges.resize(nJobs);
+    const size_t nRecordsPerJob = DIV_ROUND_UP(nRecords, nJobs);
+    CPLWorkerThreadPool *poThreadPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    if (poThreadPool)
+    {
+        struct JobData
+        {
+            OGRCSVChunkedReader *poReader;
+            size_t iRange;
+            size_t iFirstRecord;
+            size_t nRecords;
+        };
+
+        std::vector<JobData> asJobs(nJobs);
+        auto poQueue = poThreadPool->CreateJobQueue();
+        for (size_t i = 0; i < nJobs; ++i)
+        {
+            asJobs[i].poReader = this;
+            asJobs[i].iRange = i;
+            asJobs[i].iFirstRecord = i * nRecordsPerJob;
+            asJobs[i].nRecords =
+                std::min(nRecordsPerJob, nRecords - asJobs[i].iFirstRecord);
+            poQueue->SubmitJob(
+                [](void *pData)
+                {
+                    auto psJob = static_cast<JobData *>(pData);
+                    psJob->poReader->TokenizeRange(
+                        psJob->iRange, psJob->iFirstRecord, psJob->nRecords);
+                },
+                &asJobs[i]);
+        }
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        TokenizeRange(0, 0, nRecords);
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                           GetNextRecord()                            */
+/************************************************************************/
+
+OGRCSVChunkedReader::Status
+OGRCSVChunkedReader::GetNextRecord(char **&papszTokens)
+{
+    papszTokens = nullptr;
+    while (true)
+    {
+        while (m_iCurRange < m_asRanges.size())
+        {
+            auto &sRange = m_asRanges[m_iCurRange];
+            if (m_iCurRecordInRange + 1 < sRange.anRecordFirstToken.size())
+            {
+                const size_t iFirstToken =
+                    sRange.anRecordFirstToken[m_iCurRecordInRange];
+                const size_t iLastToken =
+                    sRange.anRecordFirstToken[m_iCurRecordInRange + 1];
+                ++m_iCurRecordInRange;
+                m_apszCurTokens.clear();
+                for (size_t i = iFirstToken; i < iLastToken; ++i)
+                {
+                    m_apszCurTokens.push_back(
+                        &sRange.osTokens[sRange.anTokenOffsets[i]]);
+                }
+                m_apszCurTokens.push_back(nullptr);
+                papszTokens = m_apszCurTokens.data();
+                return Status::RECORD;
+            }
+            ++m_iCurRange;
+            m_iCurRecordInRange = 0;
+        }
+
+        if (m_bFallback)
+            return Status::FALLBACK;
+        if (!ProcessNextChunk())
+            return m_bFallback ? Status::FALLBACK : Status::END;
+    }
+}
@@ -57,6 +57,7 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
+#include "ograrrowarrayhelper.h"
 
 #define DIGIT_ZERO '0'
 
@@ -159,6 +160,11 @@ void OGRCSVLayer::BuildFeatureDefn(const char *pszNfdcGeomField,
     bEmptyStringNull =
         CPLFetchBool(papszOpenOptions, "EMPTY_STRING_AS_NULL", false);
 
+    m_nNumThreads = CPLParseNumThreads(
+        CSLFetchNameValueDef(papszOpenOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", nullptr)),
+        1);
+
     // If this is not a new file, read ahead to establish if it is
     // already in CRLF (DOS) mode, or just a normal unix CR mode.
     if (!bNew && bInWriteMode)
@@ -1298,6 +1304,10 @@ void OGRCSVLayer::ResetReading()
 
     bNeedRewindBeforeRead = false;
 
+    m_poChunkedReader.reset();
+    m_bTryChunkedReader = true;
+    m_aosPendingTokens.Clear();
+
     nNextFID = 1;
 }
 
@@ -1307,6 +1317,53 @@ void OGRCSVLayer::ResetReading()
 
 char **OGRCSVLayer::GetNextLineTokens()
 {
+    m_bTokensOwnedByChunkedReader = false;
+
+    if (!m_aosPendingTokens.empty())
+        return m_aosPendingTokens.StealList();
+
+    if (m_bTryChunkedReader)
+    {
+        m_bTryChunkedReader = false;
+        // The chunked reader reads ahead and must be able to seek back
+        // when it cannot handle a record, so it is not suitable for
+        // streaming.
+        const bool bStreaming =
+            STARTS_WITH(pszFilename, "/vsistdin") ||
+            CPLTestBool(CPLGetConfigOption("OGR_CSV_SIMULATE_VSISTDIN", "NO"));
+        const size_t nChunkSize = static_cast<size_t>(std::strtoull(
+            CPLGetConfigOption("OGR_CSV_CHUNK_SIZE", "8388608"), nullptr, 10));
+        if (fpCSV && !bInWriteMode && bHonourStrings && !bStreaming &&
+            nChunkSize > 0)
+        {
+            m_poChunkedReader = std::make_unique<OGRCSVChunkedReader>(
+                fpCSV, szDelimiter[0], bMergeDelimiter, m_nMaxLineSize,
+                nChunkSize, m_nNumThreads);
+        }
+    }
+
+    if (m_poChunkedReader)
+    {
+        char **papszTokens = nullptr;
+        switch (m_poChunkedReader->GetNextRecord(papszTokens))
+        {
+            case OGRCSVChunkedReader::Status::RECORD:
+                m_bTokensOwnedByChunkedReader = true;
+                return papszTokens;
+
+            case OGRCSVChunkedReader::Status::END:
+                return nullptr;
+
+            case OGRCSVChunkedReader::Status::FALLBACK:
+                // Go on with the line-based reader from the first record
+                // that has not been returned.
+                VSIFSeekL(fpCSV, m_poChunkedReader->GetFallbackOffset(),
+                          SEEK_SET);
+                m_poChunkedReader.reset();
+                break;
+        }
+    }
+
     while (true)
     {
         // Read the CSV record.
@@ -1326,6 +1383,16 @@ char **OGRCSVLayer::GetNextLineTokens()
     }
 }
 
+/************************************************************************/
+/*                        ReleaseLineTokens()                           */
+/************************************************************************/
+
+void OGRCSVLayer::ReleaseLineTokens(char **papszTokens)
+{
+    if (!m_bTokensOwnedByChunkedReader)
+        CSLDestroy(papszTokens);
+}
+
 /************************************************************************/
 /*                             GetFeature()                             */
 /************************************************************************/
@@ -1341,17 +1408,134 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
         char **papszTokens = GetNextLineTokens();
         if (papszTokens == nullptr)
             return nullptr;
-        CSLDestroy(papszTokens);
+        ReleaseLineTokens(papszTokens);
         nNextFID++;
     }
     return GetNextUnfilteredFeature();
 }
 
+/************************************************************************/
+/*                        IsCPLAtofMParsable()                          */
+/************************************************************************/
+
+// Is it a numeric value parsable by local-aware CPLAtofM()
+static bool IsCPLAtofMParsable(char *pszVal)
+{
+    auto l_eType = CPLGetValueType(pszVal);
+    if (l_eType == CPL_VALUE_INTEGER || l_eType == CPL_VALUE_REAL)
+        return true;
+    char *pszComma = strchr(pszVal, ',');
+    if (pszComma)
+    {
+        *pszComma = '.';
+        l_eType = CPLGetValueType(pszVal);
+        *pszComma = ',';
+    }
+    return l_eType == CPL_VALUE_REAL;
+}
+
+/************************************************************************/
+/*                         ParseBooleanToken()                          */
+/************************************************************************/
+
+// Returns 0 or 1, or -1 if the (non-empty) token is not a valid boolean.
+int OGRCSVLayer::ParseBooleanToken(const char *pszToken,
+                                   const OGRFieldDefn *poFieldDefn)
+{
+    if (OGRCSVIsTrue(pszToken) || strcmp(pszToken, "1") == 0)
+        return 1;
+    if (OGRCSVIsFalse(pszToken) || strcmp(pszToken, "0") == 0)
+        return 0;
+    if (!bWarningBadTypeOrWidth)
+    {
+        bWarningBadTypeOrWidth = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value type found in record %d for field %s. "
+                 "This warning will no longer be emitted",
+                 nNextFID, poFieldDefn->GetNameRef());
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                         CheckNumericToken()                          */
+/************************************************************************/
+
+// Checks that the (non-empty) token is a number, and warns if it does not
+// match the field type, width or precision. For Real fields, a decimal comma
+// is replaced by a dot in place. Returns false if the field must be left
+// unset.
+bool OGRCSVLayer::CheckNumericToken(char *pszToken,
+                                    const OGRFieldDefn *poFieldDefn)
+{
+    const OGRFieldType eFieldType = poFieldDefn->GetType();
+    if (eFieldType == OFTReal)
+    {
+        char *chComma = strchr(pszToken, ',');
+        if (chComma)
+            *chComma = '.';
+    }
+    const CPLValueType eType = CPLGetValueType(pszToken);
+    if (eType == CPL_VALUE_INTEGER || eType == CPL_VALUE_REAL)
+    {
+        if (!bWarningBadTypeOrWidth &&
+            (eFieldType == OFTInteger || eFieldType == OFTInteger64) &&
+            eType == CPL_VALUE_REAL)
+        {
+            bWarningBadTypeOrWidth = true;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Invalid value type found in record %d for "
+                     "field %s. "
+                     "This warning will no longer be emitted",
+                     nNextFID, poFieldDefn->GetNameRef());
+        }
+        else if (!bWarningBadTypeOrWidth && poFieldDefn->GetWidth() > 0 &&
+                 static_cast<int>(strlen(pszToken)) > poFieldDefn->GetWidth())
+        {
+            bWarningBadTypeOrWidth = true;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Value with a width greater than field width "
+                     "found in record %d for field %s. "
+                     "This warning will no longer be emitted",
+                     nNextFID, poFieldDefn->GetNameRef());
+        }
+        else if (!bWarningBadTypeOrWidth && eType == CPL_VALUE_REAL &&
+                 poFieldDefn->GetWidth() > 0)
+        {
+            const char *pszDot = strchr(pszToken, '.');
+            const int nPrecision =
+                pszDot != nullptr ? static_cast<int>(strlen(pszDot + 1)) : 0;
+            if (nPrecision > poFieldDefn->GetPrecision())
+            {
+                bWarningBadTypeOrWidth = true;
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Value with a precision greater than "
+                         "field precision found in record %d for "
+                         "field %s. "
+                         "This warning will no longer be emitted",
+                         nNextFID, poFieldDefn->GetNameRef());
+            }
+        }
+        return true;
+    }
+
+    if (!bWarningBadTypeOrWidth)
+    {
+        bWarningBadTypeOrWidth = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value type found in record %d for field "
+                 "%s. This warning will no longer be emitted.",
+                 nNextFID, poFieldDefn->GetNameRef());
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                      GetNextUnfilteredFeature()                      */
 /************************************************************************/
 
-OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
+OGRFeature *
+OGRCSVLayer::GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse)
 
 {
     if (fpCSV == nullptr)
@@ -1362,8 +1546,12 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
-    // Create the OGR feature.
-    OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
+    // Create the OGR feature, or recycle the one provided by the caller.
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(poFeatureDefn);
 
     // Set attributes for any indicated attribute records.
     int iOGRField = 0;
@@ -1434,99 +1622,19 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         {
             if (papszTokens[iAttr][0] != '\0' && !poFieldDefn->IsIgnored())
             {
-                if (OGRCSVIsTrue(papszTokens[iAttr]) ||
-                    strcmp(papszTokens[iAttr], "1") == 0)
-                {
-                    poFeature->SetField(iOGRField, 1);
-                }
-                else if (OGRCSVIsFalse(papszTokens[iAttr]) ||
-                         strcmp(papszTokens[iAttr], "0") == 0)
-                {
-                    poFeature->SetField(iOGRField, 0);
-                }
-                else if (!bWarningBadTypeOrWidth)
-                {
-                    bWarningBadTypeOrWidth = true;
-                    CPLError(
-                        CE_Warning, CPLE_AppDefined,
-                        "Invalid value type found in record %d for field %s. "
-                        "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
-                }
+                const int nVal =
+                    ParseBooleanToken(papszTokens[iAttr], poFieldDefn);
+                if (nVal >= 0)
+                    poFeature->SetField(iOGRField, nVal);
             }
         }
         else if (eFieldType == OFTReal || eFieldType == OFTInteger ||
                  eFieldType == OFTInteger64)
         {
-            if (papszTokens[iAttr][0] != '\0' && !poFieldDefn->IsIgnored())
+            if (papszTokens[iAttr][0] != '\0' && !poFieldDefn->IsIgnored() &&
+                CheckNumericToken(papszTokens[iAttr], poFieldDefn))
             {
-                if (eFieldType == OFTReal)
-                {
-                    char *chComma = strchr(papszTokens[iAttr], ',');
-                    if (chComma)
-                        *chComma = '.';
-                }
-                CPLValueType eType = CPLGetValueType(papszTokens[iAttr]);
-                if (eType == CPL_VALUE_INTEGER || eType == CPL_VALUE_REAL)
-                {
-                    poFeature->SetField(iOGRField, papszTokens[iAttr]);
-                    if (!bWarningBadTypeOrWidth &&
-                        (eFieldType == OFTInteger ||
-                         eFieldType == OFTInteger64) &&
-                        eType == CPL_VALUE_REAL)
-                    {
-                        bWarningBadTypeOrWidth = true;
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Invalid value type found in record %d for "
-                                 "field %s. "
-                                 "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
-                    }
-                    else if (!bWarningBadTypeOrWidth &&
-                             poFieldDefn->GetWidth() > 0 &&
-                             static_cast<int>(strlen(papszTokens[iAttr])) >
-                                 poFieldDefn->GetWidth())
-                    {
-                        bWarningBadTypeOrWidth = true;
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Value with a width greater than field width "
-                                 "found in record %d for field %s. "
-                                 "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
-                    }
-                    else if (!bWarningBadTypeOrWidth &&
-                             eType == CPL_VALUE_REAL &&
-                             poFieldDefn->GetWidth() > 0)
-                    {
-                        const char *pszDot = strchr(papszTokens[iAttr], '.');
-                        const int nPrecision =
-                            pszDot != nullptr
-                                ? static_cast<int>(strlen(pszDot + 1))
-                                : 0;
-                        if (nPrecision > poFieldDefn->GetPrecision())
-                        {
-                            bWarningBadTypeOrWidth = true;
-                            CPLError(CE_Warning, CPLE_AppDefined,
-                                     "Value with a precision greater than "
-                                     "field precision found in record %d for "
-                                     "field %s. "
-                                     "This warning will no longer be emitted",
-                                     nNextFID, poFieldDefn->GetNameRef());
-                        }
-                    }
-                }
-                else
-                {
-                    if (!bWarningBadTypeOrWidth)
-                    {
-                        bWarningBadTypeOrWidth = true;
-                        CPLError(
-                            CE_Warning, CPLE_AppDefined,
-                            "Invalid value type found in record %d for field "
-                            "%s. This warning will no longer be emitted.",
-                            nNextFID, poFieldDefn->GetNameRef());
-                    }
-                }
+                poFeature->SetField(iOGRField, papszTokens[iAttr]);
             }
         }
         else if (eFieldType != OFTString)
@@ -1626,22 +1734,6 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    // Is it a numeric value parsable by local-aware CPLAtofM()
-    const auto IsCPLAtofMParsable = [](char *pszVal)
-    {
-        auto l_eType = CPLGetValueType(pszVal);
-        if (l_eType == CPL_VALUE_INTEGER || l_eType == CPL_VALUE_REAL)
-            return true;
-        char *pszComma = strchr(pszVal, ',');
-        if (pszComma)
-        {
-            *pszComma = '.';
-            l_eType = CPLGetValueType(pszVal);
-            *pszComma = ',';
-        }
-        return l_eType == CPL_VALUE_REAL;
-    };
-
     // http://www.faa.gov/airports/airport_safety/airportdata_5010/menu/index.cfm
     // specific
 
@@ -1689,7 +1781,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    CSLDestroy(papszTokens);
+    ReleaseLineTokens(papszTokens);
 
     // Translate the record id.
     poFeature->SetFID(nNextFID++);
@@ -1726,6 +1818,35 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                        GetNextFeatureInto()                          */
+/************************************************************************/
+
+bool OGRCSVLayer::GetNextFeatureInto(OGRFeatureUniquePtr &poFeature)
+
+{
+    if (!poFeature || poFeature->GetDefnRef() != poFeatureDefn)
+        return OGRLayer::GetNextFeatureInto(poFeature);
+
+    if (bNeedRewindBeforeRead)
+        ResetReading();
+
+    while (true)
+    {
+        if (GetNextUnfilteredFeature(poFeature.get()) == nullptr)
+        {
+            poFeature.reset();
+            return false;
+        }
+
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
+            (m_poAttrQuery == nullptr ||
+             m_poAttrQuery->Evaluate(poFeature.get())))
+            return true;
+    }
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -2266,26 +2387,31 @@ OGRErr OGRCSVLayer::ICreateFeature(OGRFeature *poNewFeature)
         {
             const auto poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(0);
             const OGRPoint *poPoint = poGeom->toPoint();
+            const bool bSwap = eGeometryFormat == OGR_CSV_GEOM_AS_YX;
+            const double dfX = bSwap ? poPoint->getY() : poPoint->getX();
+            const double dfY = bSwap ? poPoint->getX() : poPoint->getY();
+            const int nDim = eGeometryFormat == OGR_CSV_GEOM_AS_XYZ ? 3 : 2;
+            const double dfZ = nDim == 3 ? poPoint->getZ() : 0;
+            const auto wktOptions = GetWktOptions(poGeomFieldDefn);
+
+            char szCoord[256];
             std::string osCoord;
-            if (eGeometryFormat == OGR_CSV_GEOM_AS_XYZ)
-                osCoord = OGRMakeWktCoordinate(poPoint->getX(), poPoint->getY(),
-                                               poPoint->getZ(), 3,
-                                               GetWktOptions(poGeomFieldDefn));
-            else if (eGeometryFormat == OGR_CSV_GEOM_AS_XY)
-                osCoord =
-                    OGRMakeWktCoordinate(poPoint->getX(), poPoint->getY(), 0, 2,
-                                         GetWktOptions(poGeomFieldDefn));
-            else
-                osCoord =
-                    OGRMakeWktCoordinate(poPoint->getY(), poPoint->getX(), 0, 2,
-                                         GetWktOptions(poGeomFieldDefn));
+            char *pszCoord = szCoord;
+            size_t nLen = OGRMakeWktCoordinateToBuffer(
+                szCoord, sizeof(szCoord), dfX, dfY, dfZ, nDim, wktOptions);
+            if (nLen == 0)
+            {
+                osCoord = OGRMakeWktCoordinate(dfX, dfY, dfZ, nDim, wktOptions);
+                pszCoord = &osCoord[0];
+                nLen = osCoord.size();
+            }
 
-            for (char &ch : osCoord)
+            for (size_t i = 0; i < nLen; ++i)
             {
-                if (ch == ' ')
-                    ch = szDelimiter[0];
+                if (pszCoord[i] == ' ')
+                    pszCoord[i] = szDelimiter[0];
             }
-            bRet &= VSIFPrintfL(fpCSV, "%s", osCoord.c_str()) > 0;
+            bRet &= VSIFWriteL(pszCoord, 1, nLen, fpCSV) == nLen;
         }
         else
         {
@@ -2497,6 +2623,332 @@ void OGRCSVLayer::SetWriteBOM(bool bWriteBOMIn)
     bWriteBOM = bWriteBOMIn;
 }
 
+/************************************************************************/
+/*                        GetNextArrowArray()                           */
+/************************************************************************/
+
+int OGRCSVLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                   struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (fpCSV == nullptr || bInWriteMode || m_poAttrQuery != nullptr ||
+        m_poFilterGeom != nullptr || bIsEurostatTSV || iNfdcLatitudeS >= 0 ||
+        bHiddenWKTColumn || bKeepSourceColumns)
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    // Only XY(Z) columns are supported as a geometry source
+    const int nGeomFieldCount = poFeatureDefn->GetGeomFieldCount();
+    const bool bXYGeom = iLongitudeField >= 0 && iLatitudeField >= 0;
+    if (nGeomFieldCount > 1 ||
+        (nGeomFieldCount == 1 &&
+         (!bXYGeom || !poFeatureDefn->GetGeomFieldDefn(0)->IsNullable())))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    // Map OGR fields to CSV columns
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    std::vector<int> anFieldToAttr;
+    for (int iAttr = 0; iAttr < nCSVFieldCount; ++iAttr)
+    {
+        if (panGeomFieldIndex[iAttr] >= 0)
+            return OGRLayer::GetNextArrowArray(stream, out_array);
+        if ((iAttr == iLongitudeField || iAttr == iLatitudeField ||
+             iAttr == iZField) &&
+            !bKeepGeomColumns)
+        {
+            continue;
+        }
+        anFieldToAttr.push_back(iAttr);
+    }
+    if (static_cast<int>(anFieldToAttr.size()) != nFieldCount)
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        const auto poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const auto eType = poFieldDefn->GetType();
+        const auto eSubType = poFieldDefn->GetSubType();
+        if (!((eType == OFTInteger &&
+               (eSubType == OFSTNone || eSubType == OFSTBoolean)) ||
+              ((eType == OFTInteger64 || eType == OFTReal ||
+                eType == OFTString) &&
+               eSubType == OFSTNone)))
+        {
+            return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
+    }
+
+    if (bNeedRewindBeforeRead)
+        ResetReading();
+
+    OGRArrowArrayHelper sHelper(m_poDS, poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    if (sHelper.m_nChildren == 0)
+    {
+        out_array->release(out_array);
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    const int iGeomArrowField =
+        nGeomFieldCount == 1 ? sHelper.m_mapOGRGeomFieldToArrowField[0] : -1;
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    const bool bWarn = CPLTestBool(
+        CPLGetConfigOption("OGR_SETFIELD_NUMERIC_WARNING", "YES"));
+    constexpr size_t MAX_POINT_WKB_SIZE = 1 + sizeof(uint32_t) + 3 * 8;
+
+    char **papszTokens = nullptr;
+    const auto ReturnError = [this, out_array, &papszTokens](int nErrno)
+    {
+        ReleaseLineTokens(papszTokens);
+        out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+        return nErrno;
+    };
+
+    int iFeat = 0;
+    for (; iFeat < sHelper.m_nMaxBatchSize; ++iFeat)
+    {
+        papszTokens = GetNextLineTokens();
+        if (papszTokens == nullptr)
+            break;
+        const int nAttrCount = std::min(CSLCount(papszTokens), nCSVFieldCount);
+
+        // A record cannot be partially written, so check beforehand that
+        // its variable-length values fit within the memory limit.
+        if (iFeat > 0)
+        {
+            const auto WouldExceedMemLimit =
+                [out_array, iFeat, nMemLimit](int iArrowField, size_t nLen)
+            {
+                const auto panOffsets = static_cast<const int32_t *>(
+                    out_array->children[iArrowField]->buffers[1]);
+                const uint32_t nCurLength =
+                    static_cast<uint32_t>(panOffsets[iFeat]);
+                return nLen <= nMemLimit && nLen > nMemLimit - nCurLength;
+            };
+
+            bool bMemLimitReached =
+                iGeomArrowField >= 0 &&
+                WouldExceedMemLimit(iGeomArrowField, MAX_POINT_WKB_SIZE);
+            for (int iField = 0; !bMemLimitReached && iField < nFieldCount;
+                 ++iField)
+            {
+                const int iArrowField =
+                    sHelper.m_mapOGRFieldToArrowField[iField];
+                const int iAttr = anFieldToAttr[iField];
+                if (iArrowField >= 0 && iAttr < nAttrCount &&
+                    poFeatureDefn->GetFieldDefn(iField)->GetType() ==
+                        OFTString)
+                {
+                    bMemLimitReached = WouldExceedMemLimit(
+                        iArrowField, strlen(papszTokens[iAttr]));
+                }
+            }
+            if (bMemLimitReached)
+            {
+                // Will be returned by the next GetNextLineTokens() call
+                m_aosPendingTokens =
+                    CPLStringList(static_cast<CSLConstList>(papszTokens));
+                ReleaseLineTokens(papszTokens);
+                break;
+            }
+        }
+
+        for (int iField = 0; iField < nFieldCount; ++iField)
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+            if (iArrowField < 0)
+                continue;
+            const int iAttr = anFieldToAttr[iField];
+            char *pszToken =
+                iAttr < nAttrCount ? papszTokens[iAttr] : nullptr;
+            const auto poFieldDefn = poFeatureDefn->GetFieldDefn(iField);
+            const auto eType = poFieldDefn->GetType();
+            auto psArray = out_array->children[iArrowField];
+
+            if (eType == OFTString)
+            {
+                if (pszToken == nullptr ||
+                    (bEmptyStringNull && pszToken[0] == '\0'))
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                        return ReturnError(ENOMEM);
+                    continue;
+                }
+                const size_t nLen = strlen(pszToken);
+                GByte *outPtr =
+                    sHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nLen);
+                if (outPtr == nullptr)
+                    return ReturnError(ENOMEM);
+                memcpy(outPtr, pszToken, nLen);
+                if (!bWarningBadTypeOrWidth && poFieldDefn->GetWidth() > 0 &&
+                    static_cast<int>(nLen) > poFieldDefn->GetWidth())
+                {
+                    bWarningBadTypeOrWidth = true;
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "Value with a width greater than field width "
+                             "found in record %d for field %s. "
+                             "This warning will no longer be emitted",
+                             nNextFID, poFieldDefn->GetNameRef());
+                }
+                continue;
+            }
+
+            bool bSet = false;
+            if (pszToken != nullptr && pszToken[0] != '\0')
+            {
+                if (eType == OFTInteger &&
+                    poFieldDefn->GetSubType() == OFSTBoolean)
+                {
+                    const int nVal = ParseBooleanToken(pszToken, poFieldDefn);
+                    if (nVal >= 0)
+                    {
+                        if (nVal)
+                            OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                        bSet = true;
+                    }
+                }
+                else if (CheckNumericToken(pszToken, poFieldDefn))
+                {
+                    // Same conversions as OGRFeature::SetField(int,
+                    // const char*)
+                    bSet = true;
+                    char *pszLast = nullptr;
+                    if (eType == OFTInteger)
+                    {
+                        errno = 0;
+                        const long long nVal64 =
+                            std::strtoll(pszToken, &pszLast, 10);
+                        const int nVal32 =
+                            nVal64 > INT_MAX   ? INT_MAX
+                            : nVal64 < INT_MIN ? INT_MIN
+                                               : static_cast<int>(nVal64);
+                        if (bWarn && (errno == ERANGE || nVal32 != nVal64 ||
+                                      *pszLast))
+                        {
+                            CPLError(CE_Warning, CPLE_AppDefined,
+                                     "Value '%s' of field %s.%s parsed "
+                                     "incompletely to integer %d.",
+                                     pszToken, poFeatureDefn->GetName(),
+                                     poFieldDefn->GetNameRef(), nVal32);
+                        }
+                        OGRArrowArrayHelper::SetInt32(psArray, iFeat, nVal32);
+                    }
+                    else if (eType == OFTInteger64)
+                    {
+                        OGRArrowArrayHelper::SetInt64(
+                            psArray, iFeat,
+                            CPLAtoGIntBigEx(pszToken, bWarn, nullptr));
+                    }
+                    else
+                    {
+                        const double dfVal = CPLStrtod(pszToken, &pszLast);
+                        if (bWarn && *pszLast)
+                        {
+                            CPLError(CE_Warning, CPLE_AppDefined,
+                                     "Value '%s' of field %s.%s parsed "
+                                     "incompletely to real %.16g.",
+                                     pszToken, poFeatureDefn->GetName(),
+                                     poFieldDefn->GetNameRef(), dfVal);
+                        }
+                        OGRArrowArrayHelper::SetDouble(psArray, iFeat, dfVal);
+                    }
+                }
+            }
+            if (!bSet && !sHelper.SetNull(iArrowField, iFeat))
+                return ReturnError(ENOMEM);
+        }
+
+        if (iGeomArrowField >= 0)
+        {
+            bool bHasPoint = false;
+            if (nAttrCount > iLatitudeField && nAttrCount > iLongitudeField &&
+                papszTokens[iLongitudeField][0] != 0 &&
+                papszTokens[iLatitudeField][0] != 0 &&
+                IsCPLAtofMParsable(papszTokens[iLongitudeField]) &&
+                IsCPLAtofMParsable(papszTokens[iLatitudeField]) &&
+                (!m_bIsGNIS ||
+                 // GNIS specific: some records have dummy 0,0 value.
+                 (papszTokens[iLongitudeField][0] != DIGIT_ZERO ||
+                  papszTokens[iLongitudeField][1] != '\0' ||
+                  papszTokens[iLatitudeField][0] != DIGIT_ZERO ||
+                  papszTokens[iLatitudeField][1] != '\0')))
+            {
+                const bool bHasZ = iZField >= 0 && nAttrCount > iZField &&
+                                   papszTokens[iZField][0] != 0 &&
+                                   IsCPLAtofMParsable(papszTokens[iZField]);
+                const double adfXYZ[] = {
+                    CPLAtofM(papszTokens[iLongitudeField]),
+                    CPLAtofM(papszTokens[iLatitudeField]),
+                    bHasZ ? CPLAtofM(papszTokens[iZField]) : 0.0};
+                const int nDims = bHasZ ? 3 : 2;
+                const size_t nWKBSize = 1 + sizeof(uint32_t) + nDims * 8;
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                    return ReturnError(ENOMEM);
+                // ISO WKB, little endian
+                *outPtr = wkbNDR;
+                uint32_t nGeomType = bHasZ ? wkbPoint + 1000 : wkbPoint;
+                CPL_LSBPTR32(&nGeomType);
+                memcpy(outPtr + 1, &nGeomType, sizeof(uint32_t));
+                for (int i = 0; i < nDims; ++i)
+                {
+                    double dfVal = adfXYZ[i];
+                    CPL_LSBPTR64(&dfVal);
+                    memcpy(outPtr + 1 + sizeof(uint32_t) + i * 8, &dfVal, 8);
+                }
+                bHasPoint = true;
+            }
+            if (!bHasPoint && !sHelper.SetNull(iGeomArrowField, iFeat))
+                return ReturnError(ENOMEM);
+        }
+
+        ReleaseLineTokens(papszTokens);
+        papszTokens = nullptr;
+
+        if (sHelper.m_bIncludeFID)
+            sHelper.m_panFIDValues[iFeat] = nNextFID;
+        nNextFID++;
+        m_nFeaturesRead++;
+    }
+
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
+    {
+        out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                        GetMetadataItem()                             */
+/************************************************************************/
+
+const char *OGRCSVLayer::GetMetadataItem(const char *pszName,
+                                         const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
+
 /************************************************************************/
 /*                        GetFeatureCount()                             */
 /************************************************************************/
@@ -2558,7 +3010,7 @@ GIntBig OGRCSVLayer::GetFeatureCount(int bForce)
 
             nTotalFeatures++;
 
-            CSLDestroy(papszTokens);
+            ReleaseLineTokens(papszTokens);
         }
     }
 
@@ -32,6 +32,7 @@
 #include "ogrsf_frmts.h"
 #include "ogr_p.h"
 #include "ogreditablelayer.h"
+#include "cpl_error_internal.h"
 
 #include "header_generated.h"
 #include "feature_generated.h"
@@ -39,6 +40,8 @@
 
 #include <deque>
 #include <limits>
+#include <memory>
+#include <vector>
 
 class OGRFlatGeobufDataset;
 
@@ -55,6 +58,7 @@ static constexpr uint32_t feature_max_buffer_size =
 struct FeatureItem : FlatGeobuf::Item
 {
     uint32_t size;
+    uint32_t hilbertValue;  // computed at close time
     uint64_t offset;
 };
 
@@ -102,6 +106,19 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
 
+    // features read ahead by GetNextFeature() and decoded in parallel
+    struct ReadAheadFeature
+    {
+        std::vector<GByte> abyBuffer{};
+        std::unique_ptr<OGRFeature> poFeature{};
+        OGRErr eErr = OGRERR_NONE;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    std::deque<ReadAheadFeature> m_readAheadFeatures{};
+    size_t m_readAheadBatchSize = 0;
+    int m_readThreads = -1;  // from OGR_FLATGEOBUF_NUM_THREADS
+
     // creation
     GDALDataset *m_poDS = nullptr;  // parent dataset to get metadata from it
     bool m_create = false;
@@ -120,6 +137,10 @@ class OGRFlatGeobufLayer final : public OGRLayer,
         m_osTempFile;  // holds generated temp file name for two pass writing
     uint32_t m_maxFeatureSize = 0;
     std::vector<uint8_t> m_writeProperties{};
+    size_t m_maxFeatureItemsInMemory = 0;  // before spilling them to disk
+    VSILFILE *m_poFpItems = nullptr;  // spilled feature items, if any
+    uint64_t m_spilledItemsCount = 0;
+    FlatGeobuf::NodeItem m_itemsExtent = FlatGeobuf::NodeItem::create(0);
 
     // shared
     GByte *m_featureBuf = nullptr;  // reusable/resizable feature data buffer
@@ -128,7 +149,11 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     // deserialize
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
+    OGRErr readFeatureBuffer(GIntBig &fid, uint32_t &featureSize, bool &bEOF);
+    OGRErr decodeFeature(const GByte *buf, uint32_t featureSize,
+                         OGRFeature *poFeature) const;
     OGRErr parseFeature(OGRFeature *poFeature);
+    void readAheadFeatures();
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
@@ -137,6 +162,12 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     // serialize
     bool CreateFinalFile();
+    bool spillFeatureItems();
+    bool sortSpilledFeatureItems(VSILFILE *poFpSorted,
+                                 FlatGeobuf::PackedRTreeNodesBuilder &builder);
+    bool writeSortedFeatures(
+        uint64_t nTempFileSize,
+        const std::function<bool(FeatureItem &)> &getNextItem);
     void writeHeader(VSILFILE *poFp, uint64_t featuresCount,
                      std::vector<double> *extentVector);
 
@@ -35,6 +35,8 @@
 #include "ogr_p.h"
 #include "ograrrowarrayhelper.h"
 #include "ogr_recordbatch.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_flatgeobuf.h"
 #include "cplerrors.h"
@@ -42,8 +44,10 @@
 #include "geometrywriter.h"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <new>
+#include <queue>
 #include <stdexcept>
 
 using namespace flatbuffers;
@@ -64,6 +68,208 @@ static OGRErr CPLErrorIO(const char *message)
     return OGRERR_FAILURE;
 }
 
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+static int GetNumThreads()
+{
+    return CPLParseNumThreads(
+        CPLGetConfigOption("OGR_FLATGEOBUF_NUM_THREADS", nullptr),
+        std::min(4, CPLGetNumCPUs()));
+}
+
+/************************************************************************/
+/*                            RunParallel()                             */
+/************************************************************************/
+
+// Runs func(0), ..., func(nTasks - 1), on the global thread pool when
+// nThreads >= 2, or sequentially in the calling thread otherwise.
+static void RunParallel(int nTasks, int nThreads,
+                        const std::function<void(int)> &func)
+{
+    CPLWorkerThreadPool *poThreadPool =
+        (nTasks >= 2 && nThreads >= 2)
+            ? GDALGetGlobalThreadPool(std::min(nTasks, nThreads))
+            : nullptr;
+    if (poThreadPool == nullptr)
+    {
+        for (int i = 0; i < nTasks; ++i)
+            func(i);
+        return;
+    }
+
+    struct Job
+    {
+        const std::function<void(int)> *pFunc;
+        int iTask;
+    };
+
+    std::vector<Job> asJobs(nTasks);
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (int i = 0; i < nTasks; ++i)
+    {
+        asJobs[i].pFunc = &func;
+        asJobs[i].iTask = i;
+        if (!poJobQueue->SubmitJob(
+                [](void *pData)
+                {
+                    const Job *psJob = static_cast<const Job *>(pData);
+                    (*psJob->pFunc)(psJob->iTask);
+                },
+                &asJobs[i]))
+        {
+            func(i);
+        }
+    }
+    poJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                         SortFeatureItems()                           */
+/************************************************************************/
+
+// Order by decreasing Hilbert value. Ties are broken by increasing offset
+// in the temporary file, so that the output does not depend on the sort
+// algorithm.
+static bool FeatureItemLess(const FeatureItem &a, const FeatureItem &b)
+{
+    if (a.hilbertValue != b.hilbertValue)
+        return a.hilbertValue > b.hilbertValue;
+    return a.offset < b.offset;
+}
+
+// Computes the Hilbert value of each item, and sorts them. Chunks of items
+// are sorted in parallel and then merged.
+template <class Iterator>
+static void SortFeatureItems(Iterator begin, Iterator end,
+                             const NodeItem &extent, int nThreads)
+{
+    const size_t nItems = static_cast<size_t>(end - begin);
+    constexpr size_t MIN_ITEMS_PER_TASK = 100 * 1000;
+    const int nTasks = static_cast<int>(std::max<size_t>(
+        1, std::min<size_t>(nThreads, nItems / MIN_ITEMS_PER_TASK)));
+
+    std::vector<Iterator> aoBounds;
+    for (int i = 0; i <= nTasks; ++i)
+        aoBounds.push_back(begin + nItems * i / nTasks);
+
+    const double minX = extent.minX;
+    const double minY = extent.minY;
+    const double width = extent.width();
+    const double height = extent.height();
+    RunParallel(nTasks, nThreads,
+                [&aoBounds, minX, minY, width, height](int iTask)
+                {
+                    for (auto it = aoBounds[iTask]; it != aoBounds[iTask + 1];
+                         ++it)
+                    {
+                        it->hilbertValue =
+                            hilbert(it->nodeItem, HILBERT_MAX, minX, minY,
+                                    width, height);
+                    }
+                    std::sort(aoBounds[iTask], aoBounds[iTask + 1],
+                              FeatureItemLess);
+                });
+
+    for (int nStep = 1; nStep < nTasks; nStep *= 2)
+    {
+        const int nMerges = (nTasks + 2 * nStep - 1) / (2 * nStep);
+        RunParallel(nMerges, nThreads,
+                    [&aoBounds, nStep, nTasks](int iMerge)
+                    {
+                        const int iFirst = 2 * nStep * iMerge;
+                        const int iMiddle = iFirst + nStep;
+                        if (iMiddle >= nTasks)
+                            return;
+                        const int iLast = std::min(iMiddle + nStep, nTasks);
+                        std::inplace_merge(aoBounds[iFirst], aoBounds[iMiddle],
+                                           aoBounds[iLast], FeatureItemLess);
+                    });
+    }
+}
+
+/************************************************************************/
+/*                         FeatureItemReader                            */
+/************************************************************************/
+
+// Buffered sequential reader of the FeatureItem records stored in a
+// temporary file. Several readers may share the same file handle.
+class FeatureItemReader
+{
+    VSILFILE *m_fp;
+    uint64_t m_offset;
+    uint64_t m_remaining;
+    const size_t m_bufferSize;
+    std::vector<FeatureItem> m_items{};
+    size_t m_pos = 0;
+    bool m_error = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(FeatureItemReader)
+
+  public:
+    FeatureItemReader(VSILFILE *fp, uint64_t offset, uint64_t count,
+                      size_t bufferSize)
+        : m_fp(fp), m_offset(offset), m_remaining(count),
+          m_bufferSize(std::max<size_t>(1, bufferSize))
+    {
+    }
+
+    bool next(FeatureItem &item)
+    {
+        if (m_pos == m_items.size())
+        {
+            if (m_remaining == 0 || m_error)
+                return false;
+            const size_t n = static_cast<size_t>(
+                std::min<uint64_t>(m_bufferSize, m_remaining));
+            m_items.resize(n);
+            if (VSIFSeekL(m_fp, m_offset, SEEK_SET) != 0 ||
+                VSIFReadL(m_items.data(), sizeof(FeatureItem), n, m_fp) != n)
+            {
+                CPLErrorIO("reading temporary feature items");
+                m_error = true;
+                return false;
+            }
+            m_offset += n * sizeof(FeatureItem);
+            m_remaining -= n;
+            m_pos = 0;
+        }
+        item = m_items[m_pos++];
+        return true;
+    }
+
+    bool error() const
+    {
+        return m_error;
+    }
+};
+
+/************************************************************************/
+/*                    GetMaxFeatureItemsInMemory()                      */
+/************************************************************************/
+
+static size_t GetMaxFeatureItemsInMemory()
+{
+    double dfMaxMemory;
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_FLATGEOBUF_SORT_MAX_MEMORY", nullptr);
+    if (pszMaxMemory)
+    {
+        dfMaxMemory = CPLAtof(pszMaxMemory) * 1024 * 1024;
+    }
+    else
+    {
+        const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+        dfMaxMemory = nUsableRAM > 0 ? static_cast<double>(nUsableRAM) / 4
+                                     : 1024.0 * 1024 * 1024;
+    }
+    const double dfMaxItems = std::min(
+        dfMaxMemory / sizeof(FeatureItem),
+        static_cast<double>(std::numeric_limits<size_t>::max() / 2));
+    return std::max<size_t>(16, static_cast<size_t>(dfMaxItems));
+}
+
 OGRFlatGeobufLayer::OGRFlatGeobufLayer(const Header *poHeader, GByte *headerBuf,
                                        const char *pszFilename, VSILFILE *poFp,
                                        uint64_t offset)
@@ -223,6 +429,8 @@ OGRFlatGeobufLayer::OGRFlatGeobufLayer(
     SetDescription(m_poFeatureDefn->GetName());
     m_poFeatureDefn->SetGeomType(eGType);
     m_poFeatureDefn->Reference();
+
+    m_maxFeatureItemsInMemory = GetMaxFeatureItemsInMemory();
 }
 
 OGRwkbGeometryType OGRFlatGeobufLayer::getOGRwkbGeometryType()
@@ -605,13 +813,101 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
         return false;
     }
 
-    NodeItem extent = calcExtent(m_featureItems);
+    NodeItem extent = m_itemsExtent;
     auto extentVector = extent.toVector();
 
     writeHeader(m_poFp, m_featuresCount, &extentVector);
 
+    if (m_poFpItems != nullptr)
+    {
+        // Too many features to sort their index items in memory: they
+        // have been spilled to a temporary file, that we sort externally.
+        const std::string osSortedFile = m_osTempFile + ".sorted";
+        VSILFILE *poFpSorted = VSIFOpenL(osSortedFile.c_str(), "w+b");
+        if (poFpSorted == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OpenFailed, "Failed to create %s",
+                     osSortedFile.c_str());
+            return false;
+        }
+        VSIUnlink(osSortedFile.c_str());
+
+        bool bRet = false;
+        try
+        {
+            PackedRTreeNodesBuilder builder(m_featuresCount, m_indexNodeSize);
+            if (sortSpilledFeatureItems(poFpSorted, builder))
+            {
+                builder.finish();
+                c = 0;
+                builder.streamWriteNonLeafNodes(
+                    [this, &c](uint8_t *data, size_t size)
+                    { c += VSIFWriteL(data, 1, size, m_poFp); });
+
+                // Write leaf nodes
+                const size_t nBufferSize = static_cast<size_t>(
+                    std::min<uint64_t>(m_maxFeatureItemsInMemory,
+                                       m_featuresCount));
+                FeatureItemReader oLeavesReader(poFpSorted, 0,
+                                                m_featuresCount, nBufferSize);
+                std::vector<NodeItem> nodes;
+                nodes.reserve(nBufferSize);
+                const auto flushNodes = [this, &nodes, &c]()
+                {
+#if !CPL_IS_LSB
+                    for (auto &nodeItem : nodes)
+                    {
+                        CPL_LSBPTR64(&nodeItem.minX);
+                        CPL_LSBPTR64(&nodeItem.minY);
+                        CPL_LSBPTR64(&nodeItem.maxX);
+                        CPL_LSBPTR64(&nodeItem.maxY);
+                        CPL_LSBPTR64(&nodeItem.offset);
+                    }
+#endif
+                    c += VSIFWriteL(nodes.data(), 1,
+                                    nodes.size() * sizeof(NodeItem), m_poFp);
+                    nodes.clear();
+                };
+                FeatureItem item;
+                while (oLeavesReader.next(item))
+                {
+                    nodes.push_back(item.nodeItem);
+                    if (nodes.size() == nBufferSize)
+                        flushNodes();
+                }
+                flushNodes();
+                CPLDebugOnly("FlatGeobuf", "Wrote tree (%lu bytes)",
+                             static_cast<long unsigned int>(c));
+                m_writeOffset += c;
+
+                if (!oLeavesReader.error() &&
+                    c == PackedRTree::size(m_featuresCount, m_indexNodeSize))
+                {
+                    FeatureItemReader oItemsReader(poFpSorted, 0,
+                                                   m_featuresCount,
+                                                   nBufferSize);
+                    bRet = writeSortedFeatures(
+                        nTempFileSize, [&oItemsReader](FeatureItem &itemOut)
+                        { return oItemsReader.next(itemOut); });
+                }
+                else if (!oLeavesReader.error())
+                {
+                    CPLErrorIO("writing spatial index");
+                }
+            }
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Create: %s", e.what());
+        }
+        VSIFCloseL(poFpSorted);
+        VSIUnlink(osSortedFile.c_str());
+        return bRet;
+    }
+
     CPLDebugOnly("FlatGeobuf", "Sorting items for Packed R-tree");
-    hilbertSort(m_featureItems);
+    SortFeatureItems(m_featureItems.begin(), m_featureItems.end(), extent,
+                     GetNumThreads());
     CPLDebugOnly("FlatGeobuf", "Calc new feature offsets");
     uint64_t featureOffset = 0;
     for (auto &item : m_featureItems)
@@ -632,7 +928,8 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
                 ++i;
             }
         };
-        PackedRTree tree(fillNodeItems, m_featureItems.size(), extent);
+        PackedRTree tree(fillNodeItems, m_featureItems.size(), extent,
+                         m_indexNodeSize);
         CPLDebugOnly("FlatGeobuf", "PackedRTree extent %f, %f, %f, %f",
                      extentVector[0], extentVector[1], extentVector[2],
                      extentVector[3]);
@@ -648,10 +945,219 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
                  static_cast<long unsigned int>(c));
     m_writeOffset += c;
 
+    size_t iItem = 0;
+    return writeSortedFeatures(nTempFileSize,
+                               [this, &iItem](FeatureItem &item)
+                               {
+                                   item = m_featureItems[iItem++];
+                                   return true;
+                               });
+}
+
+/************************************************************************/
+/*                         spillFeatureItems()                          */
+/************************************************************************/
+
+// Appends the feature items currently in memory to a temporary file, to
+// bound the memory used when writing a file with a spatial index.
+bool OGRFlatGeobufLayer::spillFeatureItems()
+{
+    if (m_poFpItems == nullptr)
+    {
+        const std::string osItemsFile = m_osTempFile + ".items";
+        CPLDebug("FlatGeobuf",
+                 "Spilling feature items to %s, and using external sorting",
+                 osItemsFile.c_str());
+        m_poFpItems = VSIFOpenL(osItemsFile.c_str(), "w+b");
+        if (m_poFpItems == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OpenFailed, "Failed to create %s",
+                     osItemsFile.c_str());
+            return false;
+        }
+        // Unlink it now to avoid stale temporary file if killing the process
+        // (only works on Unix)
+        VSIUnlink(osItemsFile.c_str());
+    }
+
+    if (VSIFSeekL(m_poFpItems, m_spilledItemsCount * sizeof(FeatureItem),
+                  SEEK_SET) != 0)
+    {
+        CPLErrorIO("seeking in temporary feature items file");
+        return false;
+    }
+    constexpr size_t BUFFER_SIZE = 65536;
+    std::vector<FeatureItem> items;
+    items.reserve(std::min(BUFFER_SIZE, m_featureItems.size()));
+    const auto flush = [this, &items]()
+    {
+        if (VSIFWriteL(items.data(), sizeof(FeatureItem), items.size(),
+                       m_poFpItems) != items.size())
+        {
+            CPLErrorIO("writing temporary feature items");
+            return false;
+        }
+        m_spilledItemsCount += items.size();
+        items.clear();
+        return true;
+    };
+    for (const auto &item : m_featureItems)
+    {
+        items.push_back(item);
+        if (items.size() == BUFFER_SIZE && !flush())
+            return false;
+    }
+    if (!flush())
+        return false;
+    m_featureItems.clear();
+    m_featureItems.shrink_to_fit();
+    return true;
+}
+
+/************************************************************************/
+/*                      sortSpilledFeatureItems()                       */
+/************************************************************************/
+
+// External sort of the spilled feature items: runs of at most
+// m_maxFeatureItemsInMemory items are sorted in memory and written to a
+// temporary file, and then merged. The merged items, with their final
+// feature offset, are written to poFpSorted and fed to the R-tree builder.
+bool OGRFlatGeobufLayer::sortSpilledFeatureItems(
+    VSILFILE *poFpSorted, PackedRTreeNodesBuilder &builder)
+{
+    if (!m_featureItems.empty() && !spillFeatureItems())
+        return false;
+    CPLAssert(m_spilledItemsCount == m_featuresCount);
+
+    const std::string osRunsFile = m_osTempFile + ".runs";
+    VSILFILE *poFpRuns = VSIFOpenL(osRunsFile.c_str(), "w+b");
+    if (poFpRuns == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed, "Failed to create %s",
+                 osRunsFile.c_str());
+        return false;
+    }
+    VSIUnlink(osRunsFile.c_str());
+
+    const auto closeRunsFile = [poFpRuns, &osRunsFile]()
+    {
+        VSIFCloseL(poFpRuns);
+        VSIUnlink(osRunsFile.c_str());
+    };
+
+    CPLDebugOnly("FlatGeobuf", "Sorting runs of feature items");
+    const int nThreads = GetNumThreads();
+    const size_t nRunSize = m_maxFeatureItemsInMemory;
+    std::vector<uint64_t> anRunCounts;
+    {
+        std::vector<FeatureItem> items;
+        for (uint64_t i = 0; i < m_spilledItemsCount; i += nRunSize)
+        {
+            const size_t n = static_cast<size_t>(
+                std::min<uint64_t>(nRunSize, m_spilledItemsCount - i));
+            items.resize(n);
+            if (VSIFSeekL(m_poFpItems, i * sizeof(FeatureItem), SEEK_SET) !=
+                    0 ||
+                VSIFReadL(items.data(), sizeof(FeatureItem), n, m_poFpItems) !=
+                    n)
+            {
+                CPLErrorIO("reading temporary feature items");
+                closeRunsFile();
+                return false;
+            }
+            SortFeatureItems(items.begin(), items.end(), m_itemsExtent,
+                             nThreads);
+            if (VSIFWriteL(items.data(), sizeof(FeatureItem), n, poFpRuns) !=
+                n)
+            {
+                CPLErrorIO("writing temporary feature items");
+                closeRunsFile();
+                return false;
+            }
+            anRunCounts.push_back(n);
+        }
+    }
+
+    CPLDebugOnly("FlatGeobuf", "Merging %d runs of feature items",
+                 static_cast<int>(anRunCounts.size()));
+    const size_t nBufferSize =
+        std::max<size_t>(1, nRunSize / (anRunCounts.size() + 1));
+    std::vector<std::unique_ptr<FeatureItemReader>> apoReaders;
+    std::vector<FeatureItem> heads(anRunCounts.size());
+    const auto cmp = [&heads](size_t a, size_t b)
+    { return FeatureItemLess(heads[b], heads[a]); };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(cmp)> oQueue(
+        cmp);
+    uint64_t nRunOffset = 0;
+    for (size_t i = 0; i < anRunCounts.size(); ++i)
+    {
+        apoReaders.emplace_back(std::make_unique<FeatureItemReader>(
+            poFpRuns, nRunOffset, anRunCounts[i], nBufferSize));
+        nRunOffset += anRunCounts[i] * sizeof(FeatureItem);
+        if (apoReaders[i]->next(heads[i]))
+            oQueue.push(i);
+    }
+
+    std::vector<FeatureItem> items;
+    items.reserve(nBufferSize);
+    const auto flush = [poFpSorted, &items]()
+    {
+        if (VSIFWriteL(items.data(), sizeof(FeatureItem), items.size(),
+                       poFpSorted) != items.size())
+        {
+            CPLErrorIO("writing temporary feature items");
+            return false;
+        }
+        items.clear();
+        return true;
+    };
+
+    bool bRet = true;
+    uint64_t featureOffset = 0;
+    try
+    {
+        while (bRet && !oQueue.empty())
+        {
+            const size_t iRun = oQueue.top();
+            oQueue.pop();
+            FeatureItem item = heads[iRun];
+            item.nodeItem.offset = featureOffset;
+            featureOffset += item.size;
+            builder.addLeaf(item.nodeItem);
+            items.push_back(item);
+            if (items.size() == nBufferSize)
+                bRet = flush();
+            if (apoReaders[iRun]->next(heads[iRun]))
+                oQueue.push(iRun);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Create: %s", e.what());
+        bRet = false;
+    }
+    bRet = bRet && flush();
+    for (const auto &poReader : apoReaders)
+        bRet = bRet && !poReader->error();
+
+    closeRunsFile();
+    return bRet;
+}
+
+/************************************************************************/
+/*                        writeSortedFeatures()                         */
+/************************************************************************/
+
+// Copies the features from the temporary file to the final file, in the
+// order given by getNextItem.
+bool OGRFlatGeobufLayer::writeSortedFeatures(
+    uint64_t nTempFileSize,
+    const std::function<bool(FeatureItem &)> &getNextItem)
+{
     CPLDebugOnly("FlatGeobuf", "Writing feature buffers at offset %lu",
                  static_cast<long unsigned int>(m_writeOffset));
 
-    c = 0;
+    size_t c = 0;
 
     // For temporary files not in memory, we use a batch strategy to write the
     // final file. That is to say we try to separate reads in the source
@@ -671,7 +1177,8 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
 
         struct BatchItem
         {
-            size_t featureIdx;  // index of m_featureItems[]
+            uint64_t offset;  // offset in the temporary file
+            uint32_t size;
             uint32_t offsetInBuffer;
         };
 
@@ -681,23 +1188,20 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
         {
             // Sort by increasing source offset
             std::sort(batch.begin(), batch.end(),
-                      [this](const BatchItem &a, const BatchItem &b)
-                      {
-                          return m_featureItems[a.featureIdx].offset <
-                                 m_featureItems[b.featureIdx].offset;
-                      });
+                      [](const BatchItem &a, const BatchItem &b)
+                      { return a.offset < b.offset; });
 
             // Read source features
             for (const auto &batchItem : batch)
             {
-                const auto &item = m_featureItems[batchItem.featureIdx];
-                if (VSIFSeekL(m_poFpWrite, item.offset, SEEK_SET) == -1)
+                if (VSIFSeekL(m_poFpWrite, batchItem.offset, SEEK_SET) == -1)
                 {
                     CPLErrorIO("seeking to temp feature location");
                     return false;
                 }
                 if (VSIFReadL(m_featureBuf + batchItem.offsetInBuffer, 1,
-                              item.size, m_poFpWrite) != item.size)
+                              batchItem.size,
+                              m_poFpWrite) != batchItem.size)
                 {
                     CPLErrorIO("reading temp feature");
                     return false;
@@ -718,9 +1222,11 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
             return true;
         };
 
-        for (size_t i = 0; i < m_featuresCount; i++)
+        FeatureItem featureItem;
+        for (uint64_t i = 0; i < m_featuresCount; i++)
         {
-            const auto &featureItem = m_featureItems[i];
+            if (!getNextItem(featureItem))
+                return false;
             const auto featureSize = featureItem.size;
 
             if (offsetInBuffer + featureSize > m_featureBufSize)
@@ -732,8 +1238,9 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
             }
 
             BatchItem bachItem;
+            bachItem.offset = featureItem.offset;
+            bachItem.size = featureSize;
             bachItem.offsetInBuffer = offsetInBuffer;
-            bachItem.featureIdx = i;
             batch.emplace_back(bachItem);
             offsetInBuffer += featureSize;
             c += featureSize;
@@ -750,8 +1257,11 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
         if (err != OGRERR_NONE)
             return false;
 
-        for (const auto &featureItem : m_featureItems)
+        FeatureItem featureItem;
+        for (uint64_t i = 0; i < m_featuresCount; i++)
         {
+            if (!getNextItem(featureItem))
+                return false;
             const auto featureSize = featureItem.size;
 
             // CPLDebugOnly("FlatGeobuf", "featureItem.offset: %lu",
@@ -791,6 +1301,9 @@ OGRFlatGeobufLayer::~OGRFlatGeobufLayer()
 {
     OGRFlatGeobufLayer::Close();
 
+    // Must be done before releasing m_poFeatureDefn
+    m_readAheadFeatures.clear();
+
     if (m_poFeatureDefn)
         m_poFeatureDefn->Release();
 
@@ -829,6 +1342,13 @@ CPLErr OGRFlatGeobufLayer::Close()
         m_poFpWrite = nullptr;
     }
 
+    if (m_poFpItems)
+    {
+        VSIFCloseL(m_poFpItems);
+        m_poFpItems = nullptr;
+        VSIUnlink((m_osTempFile + ".items").c_str());
+    }
+
     if (!m_osTempFile.empty())
     {
         VSIUnlink(m_osTempFile.c_str());
@@ -995,41 +1515,69 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
     if (m_create)
         return nullptr;
 
+    if (m_readThreads < 0)
+        m_readThreads = GetNumThreads();
+    // GetFeature() reads a single feature: no need to read ahead
+    const bool bReadAhead = m_readThreads >= 2 && !m_ignoreSpatialFilter;
+
     while (true)
     {
-        if (m_featuresCount > 0 && m_featuresPos >= m_featuresCount)
+        std::unique_ptr<OGRFeature> poFeature;
+        if (bReadAhead)
         {
-            CPLDebugOnly("FlatGeobuf", "GetNextFeature: iteration end at %lu",
-                         static_cast<long unsigned int>(m_featuresPos));
-            return nullptr;
+            if (m_readAheadFeatures.empty())
+            {
+                readAheadFeatures();
+                if (m_readAheadFeatures.empty())
+                    return nullptr;
+            }
+            auto oItem = std::move(m_readAheadFeatures.front());
+            m_readAheadFeatures.pop_front();
+            for (const auto &oError : oItem.aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            if (oItem.eErr != OGRERR_NONE)
+                return nullptr;
+            poFeature = std::move(oItem.poFeature);
         }
-
-        if (readIndex() != OGRERR_NONE)
+        else
         {
-            return nullptr;
-        }
+            if (m_featuresCount > 0 && m_featuresPos >= m_featuresCount)
+            {
+                CPLDebugOnly("FlatGeobuf",
+                             "GetNextFeature: iteration end at %lu",
+                             static_cast<long unsigned int>(m_featuresPos));
+                return nullptr;
+            }
 
-        if (m_queriedSpatialIndex && m_featuresCount == 0)
-        {
-            CPLDebugOnly("FlatGeobuf", "GetNextFeature: no features found");
-            return nullptr;
-        }
+            if (readIndex() != OGRERR_NONE)
+            {
+                return nullptr;
+            }
 
-        auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
-        if (parseFeature(poFeature.get()) != OGRERR_NONE)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Fatal error parsing feature");
-            return nullptr;
-        }
+            if (m_queriedSpatialIndex && m_featuresCount == 0)
+            {
+                CPLDebugOnly("FlatGeobuf",
+                             "GetNextFeature: no features found");
+                return nullptr;
+            }
 
-        if (VSIFEofL(m_poFp) || VSIFErrorL(m_poFp))
-        {
-            CPLDebug("FlatGeobuf", "GetNextFeature: iteration end due to EOF");
-            return nullptr;
-        }
+            poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+            if (parseFeature(poFeature.get()) != OGRERR_NONE)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Fatal error parsing feature");
+                return nullptr;
+            }
 
-        m_featuresPos++;
+            if (VSIFEofL(m_poFp) || VSIFErrorL(m_poFp))
+            {
+                CPLDebug("FlatGeobuf",
+                         "GetNextFeature: iteration end due to EOF");
+                return nullptr;
+            }
+
+            m_featuresPos++;
+        }
 
         if ((m_poFilterGeom == nullptr || m_ignoreSpatialFilter ||
              FilterGeometry(poFeature->GetGeometryRef())) &&
@@ -1039,6 +1587,109 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                         readAheadFeatures()                          */
+/************************************************************************/
+
+// Reads the buffers of the next features, and decodes them in parallel.
+// The number of features read at once grows from 16 to 1024, so that
+// callers reading only a few features do not pay for a large read-ahead.
+void OGRFlatGeobufLayer::readAheadFeatures()
+{
+    m_readAheadBatchSize =
+        m_readAheadBatchSize == 0
+            ? 16
+            : std::min<size_t>(1024, m_readAheadBatchSize * 2);
+
+    bool bEOF = false;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+    CPLInstallErrorHandlerAccumulator(aoErrors);
+    for (size_t i = 0; i < m_readAheadBatchSize; ++i)
+    {
+        if (m_featuresCount > 0 && m_featuresPos >= m_featuresCount)
+            break;
+
+        ReadAheadFeature oItem;
+        if (readIndex() != OGRERR_NONE)
+        {
+            oItem.eErr = OGRERR_FAILURE;
+        }
+        else if (m_queriedSpatialIndex && m_featuresCount == 0)
+        {
+            break;
+        }
+        else
+        {
+            GIntBig fid = 0;
+            uint32_t featureSize = 0;
+            oItem.eErr = readFeatureBuffer(fid, featureSize, bEOF);
+            if (oItem.eErr != OGRERR_NONE)
+            {
+                aoErrors.emplace_back(CE_Failure, CPLE_AppDefined,
+                                      "Fatal error parsing feature");
+            }
+            else if (bEOF || VSIFEofL(m_poFp) || VSIFErrorL(m_poFp))
+            {
+                bEOF = true;
+                break;
+            }
+            else
+            {
+                oItem.abyBuffer.assign(m_featureBuf,
+                                       m_featureBuf + featureSize);
+                oItem.poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+                oItem.poFeature->SetFID(fid);
+                m_featuresPos++;
+            }
+        }
+        oItem.aoErrors = std::move(aoErrors);
+        aoErrors.clear();
+        const bool bError = oItem.eErr != OGRERR_NONE;
+        m_readAheadFeatures.emplace_back(std::move(oItem));
+        if (bError)
+            break;
+    }
+    CPLUninstallErrorHandlerAccumulator();
+    for (const auto &oError : aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    if (bEOF)
+        CPLDebug("FlatGeobuf", "GetNextFeature: iteration end due to EOF");
+
+    const size_t nFeatures = m_readAheadFeatures.size();
+    const int nTasks =
+        static_cast<int>(std::min<size_t>(m_readThreads, nFeatures));
+    RunParallel(
+        nTasks, m_readThreads,
+        [this, nFeatures, nTasks](int iTask)
+        {
+            const size_t iStart = nFeatures * iTask / nTasks;
+            const size_t iEnd = nFeatures * (iTask + 1) / nTasks;
+            for (size_t i = iStart; i < iEnd; ++i)
+            {
+                auto &oItem = m_readAheadFeatures[i];
+                if (!oItem.poFeature)
+                    continue;
+                std::vector<CPLErrorHandlerAccumulatorStruct> aoDecodeErrors;
+                CPLInstallErrorHandlerAccumulator(aoDecodeErrors);
+                oItem.eErr =
+                    decodeFeature(oItem.abyBuffer.data(),
+                                  static_cast<uint32_t>(oItem.abyBuffer.size()),
+                                  oItem.poFeature.get());
+                CPLUninstallErrorHandlerAccumulator();
+                if (oItem.eErr != OGRERR_NONE)
+                {
+                    aoDecodeErrors.emplace_back(CE_Failure, CPLE_AppDefined,
+                                                "Fatal error parsing feature");
+                    oItem.poFeature.reset();
+                }
+                oItem.aoErrors.insert(oItem.aoErrors.end(),
+                                      aoDecodeErrors.begin(),
+                                      aoDecodeErrors.end());
+                oItem.abyBuffer = std::vector<GByte>();
+            }
+        });
+}
+
 OGRErr OGRFlatGeobufLayer::ensureFeatureBuf(uint32_t featureSize)
 {
     if (m_featureBufSize == 0)
@@ -1070,7 +1721,26 @@ OGRErr OGRFlatGeobufLayer::ensureFeatureBuf(uint32_t featureSize)
 
 OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
 {
-    GIntBig fid;
+    GIntBig fid = 0;
+    uint32_t featureSize = 0;
+    bool bEOF = false;
+    const auto err = readFeatureBuffer(fid, featureSize, bEOF);
+    poFeature->SetFID(fid);
+    if (err != OGRERR_NONE || bEOF)
+        return err;
+    return decodeFeature(m_featureBuf, featureSize, poFeature);
+}
+
+/************************************************************************/
+/*                         readFeatureBuffer()                          */
+/************************************************************************/
+
+// Reads the next feature into m_featureBuf. bEOF is set if the end of file
+// is reached before any feature data.
+OGRErr OGRFlatGeobufLayer::readFeatureBuffer(GIntBig &fid,
+                                             uint32_t &featureSize, bool &bEOF)
+{
+    bEOF = false;
     auto seek = false;
     if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
     {
@@ -1083,7 +1753,6 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     {
         fid = m_featuresPos;
     }
-    poFeature->SetFID(fid);
 
     // CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu", static_cast<long
     // unsigned int>(m_featuresPos));
@@ -1094,14 +1763,19 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     if (seek && VSIFSeekL(m_poFp, m_offset, SEEK_SET) == -1)
     {
         if (VSIFEofL(m_poFp))
+        {
+            bEOF = true;
             return OGRERR_NONE;
+        }
         return CPLErrorIO("seeking to feature location");
     }
-    uint32_t featureSize;
     if (VSIFReadL(&featureSize, sizeof(featureSize), 1, m_poFp) != 1)
     {
         if (VSIFEofL(m_poFp))
+        {
+            bEOF = true;
             return OGRERR_NONE;
+        }
         return CPLErrorIO("reading feature size");
     }
     CPL_LSBPTR32(&featureSize);
@@ -1133,24 +1807,34 @@ OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
     if (VSIFReadL(m_featureBuf, 1, featureSize, m_poFp) != featureSize)
         return CPLErrorIO("reading feature");
     m_offset += featureSize + sizeof(featureSize);
+    return OGRERR_NONE;
+}
 
+/************************************************************************/
+/*                           decodeFeature()                            */
+/************************************************************************/
+
+// Decodes a feature buffer into poFeature. This does not modify the layer
+// state, and may be called from several threads at once.
+OGRErr OGRFlatGeobufLayer::decodeFeature(const GByte *buf,
+                                         uint32_t featureSize,
+                                         OGRFeature *poFeature) const
+{
     if (m_bVerifyBuffers)
     {
-        Verifier v(m_featureBuf, featureSize);
+        Verifier v(buf, featureSize);
         const auto ok = VerifyFeatureBuffer(v);
         if (!ok)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Buffer verification failed");
-            CPLDebugOnly("FlatGeobuf", "m_offset: %lu",
-                         static_cast<long unsigned int>(m_offset));
-            CPLDebugOnly("FlatGeobuf", "m_featuresPos: %lu",
-                         static_cast<long unsigned int>(m_featuresPos));
+            CPLDebugOnly("FlatGeobuf", "FID: " CPL_FRMT_GIB,
+                         poFeature->GetFID());
             CPLDebugOnly("FlatGeobuf", "featureSize: %d", featureSize);
             return OGRERR_CORRUPT_DATA;
         }
     }
 
-    const auto feature = GetRoot<Feature>(m_featureBuf);
+    const auto feature = GetRoot<Feature>(buf);
     const auto geometry = feature->geometry();
     if (!m_poFeatureDefn->IsGeometryIgnored() && geometry != nullptr)
     {
@@ -2371,10 +3055,17 @@ OGRErr OGRFlatGeobufLayer::ICreateFeature(OGRFeature *poNewFeature)
         {
             FeatureItem item;
             item.size = static_cast<uint32_t>(fbb.GetSize());
+            item.hilbertValue = 0;
             item.offset = m_writeOffset;
             item.nodeItem = {psEnvelope.MinX, psEnvelope.MinY, psEnvelope.MaxX,
                              psEnvelope.MaxY, 0};
+            m_itemsExtent.expand(item.nodeItem);
             m_featureItems.emplace_back(std::move(item));
+            if (m_featureItems.size() >= m_maxFeatureItemsInMemory &&
+                !spillFeatureItems())
+            {
+                return OGRERR_FAILURE;
+            }
         }
         m_writeOffset += c;
 
@@ -2438,6 +3129,9 @@ void OGRFlatGeobufLayer::ResetReading()
     m_bEOF = false;
     m_featuresPos = 0;
     m_foundItems.clear();
+    m_readAheadFeatures.clear();
+    m_readAheadBatchSize = 0;
+    m_readThreads = -1;
     m_featuresCount = m_poHeader ? m_poHeader->features_count() : 0;
     m_queriedSpatialIndex = false;
     m_ignoreSpatialFilter = false;
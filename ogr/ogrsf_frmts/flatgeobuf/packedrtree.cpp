@@ -476,4 +476,82 @@ NodeItem PackedRTree::getExtent() const
     return _extent;
 }
 
+PackedRTreeNodesBuilder::PackedRTreeNodesBuilder(const uint64_t numItems,
+                                                 const uint16_t nodeSize)
+    : _numItems(numItems),
+      _nodeSize(std::min(std::max(nodeSize, static_cast<uint16_t>(2)),
+                         static_cast<uint16_t>(65535))),
+      _levelBounds(PackedRTree::generateLevelBounds(numItems, _nodeSize)),
+      _extent(NodeItem::create(0))
+{
+    // Leaf nodes are the last ones in storage order
+    _nodeItems.resize(static_cast<size_t>(_levelBounds.front().first));
+}
+
+void PackedRTreeNodesBuilder::addLeaf(const NodeItem &item)
+{
+    if (_numLeaves == _numItems)
+        throw std::out_of_range("Too many leaf nodes");
+    const uint64_t pos = _levelBounds[0].first + _numLeaves;
+    auto &parent = _nodeItems[static_cast<size_t>(
+        _levelBounds[1].first + _numLeaves / _nodeSize)];
+    if ((_numLeaves % _nodeSize) == 0)
+        parent = NodeItem::create(pos);
+    parent.expand(item);
+    _extent.expand(item);
+    ++_numLeaves;
+}
+
+void PackedRTreeNodesBuilder::finish()
+{
+    if (_numLeaves != _numItems)
+        throw std::logic_error("Missing leaf nodes");
+    // Same as PackedRTree::generateNodes(), from the second level
+    for (size_t i = 1; i < _levelBounds.size() - 1; i++)
+    {
+        auto pos = _levelBounds[i].first;
+        auto end = _levelBounds[i].second;
+        auto newpos = _levelBounds[i + 1].first;
+        while (pos < end)
+        {
+            NodeItem node = NodeItem::create(pos);
+            for (uint32_t j = 0; j < _nodeSize && pos < end; j++)
+                node.expand(_nodeItems[static_cast<size_t>(pos++)]);
+            _nodeItems[static_cast<size_t>(newpos++)] = node;
+        }
+    }
+}
+
+NodeItem PackedRTreeNodesBuilder::getExtent() const
+{
+    return _extent;
+}
+
+void PackedRTreeNodesBuilder::streamWriteNonLeafNodes(
+    const std::function<void(uint8_t *, size_t)> &writeData)
+{
+#if !CPL_IS_LSB
+    for (auto &nodeItem : _nodeItems)
+    {
+        CPL_LSBPTR64(&nodeItem.minX);
+        CPL_LSBPTR64(&nodeItem.minY);
+        CPL_LSBPTR64(&nodeItem.maxX);
+        CPL_LSBPTR64(&nodeItem.maxY);
+        CPL_LSBPTR64(&nodeItem.offset);
+    }
+#endif
+    writeData(reinterpret_cast<uint8_t *>(_nodeItems.data()),
+              _nodeItems.size() * sizeof(NodeItem));
+#if !CPL_IS_LSB
+    for (auto &nodeItem : _nodeItems)
+    {
+        CPL_LSBPTR64(&nodeItem.minX);
+        CPL_LSBPTR64(&nodeItem.minY);
+        CPL_LSBPTR64(&nodeItem.maxX);
+        CPL_LSBPTR64(&nodeItem.maxY);
+        CPL_LSBPTR64(&nodeItem.offset);
+    }
+#endif
+}
+
 }  // namespace FlatGeobuf
@@ -167,6 +167,30 @@ class PackedRTree
     void streamWrite(const std::function<void(uint8_t *, size_t)> &writeData);
 };
 
+/**
+ * Incremental computation of the non-leaf nodes of a packed R-tree, from
+ * leaf nodes provided one at a time in their final order. Only the non-leaf
+ * nodes, that is about 1/nodeSize of the tree, are held in memory.
+ */
+class PackedRTreeNodesBuilder
+{
+    uint64_t _numItems;
+    uint16_t _nodeSize;
+    std::vector<std::pair<uint64_t, uint64_t>> _levelBounds;
+    std::vector<NodeItem> _nodeItems;  // non-leaf nodes, in storage order
+    uint64_t _numLeaves = 0;
+    NodeItem _extent;
+
+  public:
+    explicit PackedRTreeNodesBuilder(const uint64_t numItems,
+                                     const uint16_t nodeSize = 16);
+    void addLeaf(const NodeItem &item);
+    void finish();
+    NodeItem getExtent() const;
+    void streamWriteNonLeafNodes(
+        const std::function<void(uint8_t *, size_t)> &writeData);
+};
+
 }  // namespace FlatGeobuf
 
 #endif
@@ -33,8 +33,13 @@
 #include "cpl_string.h"
 #include "ogr_api.h"
 #include "cpl_time.h"
+#include "ogr_attrind.h"
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
 #include <limits>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -82,6 +87,1686 @@ static bool OGRGenSQLResultsLayerHasSpecialField(swq_expr_node *expr,
     return false;
 }
 
+/************************************************************************/
+/*                        GetMaxRAMUsageAllowed()                       */
+/************************************************************************/
+
+static size_t GetMaxRAMUsageAllowed(const char *pszConfigOption)
+{
+    const uint64_t nUsableRAM = CPLGetUsablePhysicalRAM();
+    uint64_t nMaxRAMUsageAllowed =
+        (nUsableRAM ? nUsableRAM / 10 : 100 * 1024 * 1024);
+    const char *pszMaxRAMUsageAllowed =
+        CPLGetConfigOption(pszConfigOption, nullptr);
+    if (pszMaxRAMUsageAllowed)
+    {
+        nMaxRAMUsageAllowed = static_cast<uint64_t>(
+            std::strtoull(pszMaxRAMUsageAllowed, nullptr, 10));
+    }
+    if (nMaxRAMUsageAllowed > std::numeric_limits<size_t>::max() - 1U)
+    {
+        nMaxRAMUsageAllowed = std::numeric_limits<size_t>::max() - 1U;
+    }
+    return static_cast<size_t>(nMaxRAMUsageAllowed);
+}
+
+/************************************************************************/
+/*                       EstimateFeatureRAMUsage()                      */
+/************************************************************************/
+
+static size_t EstimateFeatureRAMUsage(const OGRFeature *poFeature)
+{
+    const OGRFeatureDefn *poDefn = poFeature->GetDefnRef();
+    const int nFieldCount = poDefn->GetFieldCount();
+    size_t nSize = sizeof(OGRFeature) + nFieldCount * sizeof(OGRField);
+    for (int iField = 0; iField < nFieldCount; iField++)
+    {
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+        const OGRField *psField = poFeature->GetRawFieldRef(iField);
+        switch (poDefn->GetFieldDefn(iField)->GetType())
+        {
+            case OFTString:
+                nSize += strlen(psField->String) + 1;
+                break;
+            case OFTBinary:
+                nSize += psField->Binary.nCount;
+                break;
+            case OFTIntegerList:
+                nSize += psField->IntegerList.nCount * sizeof(int);
+                break;
+            case OFTInteger64List:
+                nSize += psField->Integer64List.nCount * sizeof(GIntBig);
+                break;
+            case OFTRealList:
+                nSize += psField->RealList.nCount * sizeof(double);
+                break;
+            case OFTStringList:
+                for (int i = 0; i < psField->StringList.nCount; i++)
+                    nSize += sizeof(char *) +
+                             strlen(psField->StringList.paList[i]) + 1;
+                break;
+            default:
+                break;
+        }
+    }
+    for (int iGeomField = 0; iGeomField < poDefn->GetGeomFieldCount();
+         iGeomField++)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+        if (poGeom)
+            nSize += poGeom->WkbSize();
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                        OGRGenSQLJoinHashTable                        */
+/************************************************************************/
+
+/* In-memory hash table used to resolve a JOIN whose expression is made of */
+/* equality comparisons between fields of the primary and secondary tables */
+/* (possibly combined with AND). It maps each key of the secondary layer to */
+/* the first feature having it, which is the one that the attribute filter */
+/* based approach would return. */
+
+class OGRGenSQLJoinHashTable
+{
+    struct KeyField
+    {
+        int iPrimaryField = -1;
+        int iSecondaryField = -1;
+        // OFTInteger64, OFTReal or OFTString
+        OGRFieldType eType = OFTString;
+    };
+
+    std::vector<KeyField> m_aoKeyFields{};
+    std::unordered_map<std::string, std::unique_ptr<OGRFeature>> m_oMap{};
+    mutable std::string m_osKey{};
+
+    bool CollectKeyFields(const swq_expr_node *poExpr, int nSecondaryTable,
+                          const OGRFeatureDefn *poPrimaryDefn,
+                          const OGRFeatureDefn *poSecondaryDefn);
+    bool ComputeKey(const OGRFeature *poFeature, bool bPrimary,
+                    std::string &osKey) const;
+
+    static bool HasNativeAttributeFilter(OGRLayer *poLayer);
+
+  public:
+    OGRGenSQLJoinHashTable() = default;
+
+    static std::unique_ptr<OGRGenSQLJoinHashTable>
+    Build(const swq_join_def *psJoinInfo, OGRLayer *poPrimaryLayer,
+          OGRLayer *poJoinLayer, size_t nMaxRAMUsage);
+
+    OGRFeature *GetMatchingFeature(const OGRFeature *poSrcFeat) const;
+};
+
+/************************************************************************/
+/*                          CollectKeyFields()                          */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::CollectKeyFields(
+    const swq_expr_node *poExpr, int nSecondaryTable,
+    const OGRFeatureDefn *poPrimaryDefn, const OGRFeatureDefn *poSecondaryDefn)
+{
+    if (poExpr->eNodeType != SNT_OPERATION)
+        return false;
+
+    if (poExpr->nOperation == SWQ_AND)
+    {
+        for (int i = 0; i < poExpr->nSubExprCount; i++)
+        {
+            if (!CollectKeyFields(poExpr->papoSubExpr[i], nSecondaryTable,
+                                  poPrimaryDefn, poSecondaryDefn))
+                return false;
+        }
+        return true;
+    }
+
+    if (poExpr->nOperation != SWQ_EQ || poExpr->nSubExprCount != 2)
+        return false;
+
+    const swq_expr_node *poPrimary = poExpr->papoSubExpr[0];
+    const swq_expr_node *poSecondary = poExpr->papoSubExpr[1];
+    if (poPrimary->eNodeType != SNT_COLUMN ||
+        poSecondary->eNodeType != SNT_COLUMN)
+        return false;
+    if (poPrimary->table_index == nSecondaryTable)
+        std::swap(poPrimary, poSecondary);
+    if (poPrimary->table_index != 0 ||
+        poSecondary->table_index != nSecondaryTable)
+        return false;
+
+    // Special fields (FID, OGR_GEOM_AREA, etc.) are not handled.
+    if (poPrimary->field_index < 0 ||
+        poPrimary->field_index >= poPrimaryDefn->GetFieldCount() ||
+        poSecondary->field_index < 0 ||
+        poSecondary->field_index >= poSecondaryDefn->GetFieldCount())
+        return false;
+
+    const auto IsInteger = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+
+    const OGRFieldType ePrimaryType =
+        poPrimaryDefn->GetFieldDefn(poPrimary->field_index)->GetType();
+    const OGRFieldType eSecondaryType =
+        poSecondaryDefn->GetFieldDefn(poSecondary->field_index)->GetType();
+
+    KeyField oKeyField;
+    oKeyField.iPrimaryField = poPrimary->field_index;
+    oKeyField.iSecondaryField = poSecondary->field_index;
+    if (ePrimaryType == OFTString && eSecondaryType == OFTString)
+        oKeyField.eType = OFTString;
+    else if (IsInteger(ePrimaryType) && IsInteger(eSecondaryType))
+        oKeyField.eType = OFTInteger64;
+    else if ((IsInteger(ePrimaryType) || ePrimaryType == OFTReal) &&
+             (IsInteger(eSecondaryType) || eSecondaryType == OFTReal))
+        oKeyField.eType = OFTReal;
+    else
+        return false;
+
+    m_aoKeyFields.push_back(oKeyField);
+    return true;
+}
+
+/************************************************************************/
+/*                             ComputeKey()                             */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::ComputeKey(const OGRFeature *poFeature,
+                                        bool bPrimary,
+                                        std::string &osKey) const
+{
+    osKey.clear();
+    for (const auto &oKeyField : m_aoKeyFields)
+    {
+        const int iField =
+            bPrimary ? oKeyField.iPrimaryField : oKeyField.iSecondaryField;
+
+        // Null values never match.
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            return false;
+
+        switch (oKeyField.eType)
+        {
+            case OFTInteger64:
+            {
+                const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+                osKey.append(reinterpret_cast<const char *>(&nVal),
+                             sizeof(nVal));
+                break;
+            }
+
+            case OFTReal:
+            {
+                // Adding 0 turns -0 into +0, so that they hash the same.
+                const double dfVal = poFeature->GetFieldAsDouble(iField) + 0.0;
+                if (std::isnan(dfVal))
+                    return false;
+                osKey.append(reinterpret_cast<const char *>(&dfVal),
+                             sizeof(dfVal));
+                break;
+            }
+
+            default:
+            {
+                // String equality is case insensitive in OGR SQL.
+                for (const char *pszIter = poFeature->GetFieldAsString(iField);
+                     *pszIter; ++pszIter)
+                {
+                    osKey += static_cast<char>(
+                        CPLToupper(static_cast<unsigned char>(*pszIter)));
+                }
+                osKey += '\0';
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      HasNativeAttributeFilter()                      */
+/************************************************************************/
+
+/* Whether attribute filters set on the layer are translated into queries of
+ * a database engine, instead of being evaluated on each feature. */
+bool OGRGenSQLJoinHashTable::HasNativeAttributeFilter(OGRLayer *poLayer)
+{
+    GDALDataset *poDS = poLayer->GetDataset();
+    const char *pszDriverName = poDS ? poDS->GetDriverName() : nullptr;
+    if (!pszDriverName)
+        return false;
+    for (const char *pszNativeDriver :
+         {"GPKG", "SQLite", "PostgreSQL", "MySQL", "MSSQLSpatial", "OCI"})
+    {
+        if (EQUAL(pszDriverName, pszNativeDriver))
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+std::unique_ptr<OGRGenSQLJoinHashTable>
+OGRGenSQLJoinHashTable::Build(const swq_join_def *psJoinInfo,
+                              OGRLayer *poPrimaryLayer, OGRLayer *poJoinLayer,
+                              size_t nMaxRAMUsage)
+{
+    auto poHashTable = std::make_unique<OGRGenSQLJoinHashTable>();
+    if (!poHashTable->CollectKeyFields(
+            psJoinInfo->poExpr, psJoinInfo->secondary_table,
+            poPrimaryLayer->GetLayerDefn(), poJoinLayer->GetLayerDefn()))
+    {
+        return nullptr;
+    }
+
+    // If the secondary layer evaluates attribute filters natively (database
+    // drivers, which may use their own indexes), or has an attribute index on
+    // one of the key fields, attribute filters are fast enough.
+    if (HasNativeAttributeFilter(poJoinLayer))
+        return nullptr;
+    OGRLayerAttrIndex *poAttrIndex = poJoinLayer->GetIndex();
+    if (poAttrIndex)
+    {
+        for (const auto &oKeyField : poHashTable->m_aoKeyFields)
+        {
+            if (poAttrIndex->GetFieldIndex(oKeyField.iSecondaryField))
+                return nullptr;
+        }
+    }
+
+    CPLDebug("GenSQL", "Building hash table for JOIN on layer '%s'",
+             poJoinLayer->GetName());
+
+    size_t nRAMUsage = 0;
+    std::string osKey;
+    poJoinLayer->SetAttributeFilter(nullptr);
+    poJoinLayer->ResetReading();
+    while (true)
+    {
+        std::unique_ptr<OGRFeature> poFeature(poJoinLayer->GetNextFeature());
+        if (!poFeature)
+            break;
+        if (!poHashTable->ComputeKey(poFeature.get(), false, osKey))
+            continue;
+
+        // Only the first matching secondary feature is used by a JOIN.
+        if (poHashTable->m_oMap.find(osKey) != poHashTable->m_oMap.end())
+            continue;
+
+        nRAMUsage += 4 * sizeof(void *) + osKey.size() +
+                     EstimateFeatureRAMUsage(poFeature.get());
+        if (nRAMUsage > nMaxRAMUsage)
+        {
+            CPLDebug("GenSQL",
+                     "Hash table for JOIN on layer '%s' would exceed "
+                     "OGR_SQL_MAX_RAM_USAGE_HASH_JOIN = " CPL_FRMT_GUIB
+                     " bytes. Using attribute filters instead",
+                     poJoinLayer->GetName(),
+                     static_cast<GUIntBig>(nMaxRAMUsage));
+            poJoinLayer->ResetReading();
+            return nullptr;
+        }
+        poHashTable->m_oMap.emplace(osKey, std::move(poFeature));
+    }
+    poJoinLayer->ResetReading();
+
+    return poHashTable;
+}
+
+/************************************************************************/
+/*                         GetMatchingFeature()                         */
+/************************************************************************/
+
+OGRFeature *
+OGRGenSQLJoinHashTable::GetMatchingFeature(const OGRFeature *poSrcFeat) const
+{
+    if (!ComputeKey(poSrcFeat, true, m_osKey))
+        return nullptr;
+    const auto oIter = m_oMap.find(m_osKey);
+    return oIter == m_oMap.end() ? nullptr : oIter->second.get();
+}
+
+/************************************************************************/
+/*                          OGRGenSQLTempFile                           */
+/************************************************************************/
+
+/* Temporary file used to spill data that does not fit in the RAM budget.  */
+/* It is removed as soon as it is opened when the filesystem allows it.    */
+
+class OGRGenSQLTempFile
+{
+    std::string m_osFilename{};
+    VSILFILE *m_fp = nullptr;
+    bool m_bMustUnlink = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLTempFile)
+
+  public:
+    OGRGenSQLTempFile() = default;
+    ~OGRGenSQLTempFile();
+
+    static std::unique_ptr<OGRGenSQLTempFile> Create();
+
+    VSILFILE *GetHandle()
+    {
+        return m_fp;
+    }
+};
+
+/************************************************************************/
+/*                         ~OGRGenSQLTempFile()                         */
+/************************************************************************/
+
+OGRGenSQLTempFile::~OGRGenSQLTempFile()
+{
+    if (m_fp)
+        VSIFCloseL(m_fp);
+    if (m_bMustUnlink)
+        VSIUnlink(m_osFilename.c_str());
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+std::unique_ptr<OGRGenSQLTempFile> OGRGenSQLTempFile::Create()
+{
+    auto poFile = std::make_unique<OGRGenSQLTempFile>();
+    poFile->m_osFilename = CPLGenerateTempFilename("ogr_gensql");
+    poFile->m_fp = VSIFOpenL(poFile->m_osFilename.c_str(), "wb+");
+    if (poFile->m_fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create temporary file %s",
+                 poFile->m_osFilename.c_str());
+        return nullptr;
+    }
+
+    // On Unix filesystems, you can remove a file even if it is opened.
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    poFile->m_bMustUnlink = VSIUnlink(poFile->m_osFilename.c_str()) != 0;
+    CPLPopErrorHandler();
+
+    return poFile;
+}
+
+/************************************************************************/
+/*                         OGRGenSQLRecordStore                         */
+/************************************************************************/
+
+/* Array of serialized records with random access, kept in RAM until its   */
+/* size exceeds the RAM budget, and then moved to a temporary file.        */
+
+class OGRGenSQLRecordStore
+{
+    const size_t m_nMaxRAMUsage;
+    size_t m_nRAMUsage = 0;
+    std::vector<std::string> m_aosRecords{};
+    std::unique_ptr<OGRGenSQLTempFile> m_poFile{};
+    std::vector<vsi_l_offset> m_anOffsets{};
+    vsi_l_offset m_nFileSize = 0;
+
+    bool Write(const std::string &osRecord);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLRecordStore)
+
+  public:
+    explicit OGRGenSQLRecordStore(size_t nMaxRAMUsage)
+        : m_nMaxRAMUsage(nMaxRAMUsage)
+    {
+    }
+
+    bool Add(const std::string &osRecord);
+    bool Get(size_t nIdx, std::string &osRecord);
+
+    size_t size() const
+    {
+        return m_poFile ? m_anOffsets.size() : m_aosRecords.size();
+    }
+};
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+bool OGRGenSQLRecordStore::Write(const std::string &osRecord)
+{
+    VSILFILE *fp = m_poFile->GetHandle();
+    if (VSIFSeekL(fp, m_nFileSize, SEEK_SET) != 0 ||
+        VSIFWriteL(osRecord.data(), 1, osRecord.size(), fp) != osRecord.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write temporary file");
+        return false;
+    }
+    m_anOffsets.push_back(m_nFileSize);
+    m_nFileSize += osRecord.size();
+    return true;
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+bool OGRGenSQLRecordStore::Add(const std::string &osRecord)
+{
+    if (m_poFile)
+        return Write(osRecord);
+
+    m_nRAMUsage += sizeof(std::string) + osRecord.capacity();
+    if (m_nRAMUsage > m_nMaxRAMUsage)
+    {
+        CPLDebug("GenSQL", "Moving %d result records to a temporary file",
+                 static_cast<int>(m_aosRecords.size()));
+        m_poFile = OGRGenSQLTempFile::Create();
+        if (!m_poFile)
+            return false;
+        for (const auto &osOtherRecord : m_aosRecords)
+        {
+            if (!Write(osOtherRecord))
+                return false;
+        }
+        m_aosRecords.clear();
+        m_aosRecords.shrink_to_fit();
+        return Write(osRecord);
+    }
+
+    try
+    {
+        m_aosRecords.push_back(osRecord);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+bool OGRGenSQLRecordStore::Get(size_t nIdx, std::string &osRecord)
+{
+    if (!m_poFile)
+    {
+        if (nIdx >= m_aosRecords.size())
+            return false;
+        osRecord = m_aosRecords[nIdx];
+        return true;
+    }
+
+    if (nIdx >= m_anOffsets.size())
+        return false;
+    const vsi_l_offset nEnd =
+        nIdx + 1 < m_anOffsets.size() ? m_anOffsets[nIdx + 1] : m_nFileSize;
+    osRecord.resize(static_cast<size_t>(nEnd - m_anOffsets[nIdx]));
+    VSILFILE *fp = m_poFile->GetHandle();
+    if (VSIFSeekL(fp, m_anOffsets[nIdx], SEEK_SET) != 0 ||
+        VSIFReadL(&osRecord[0], 1, osRecord.size(), fp) != osRecord.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read temporary file");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       AppendSortableInteger()                        */
+/*                                                                      */
+/*      Append a value to a binary key, so that byte-wise comparison    */
+/*      of keys is consistent with the comparison of values.           */
+/************************************************************************/
+
+static void AppendSortableInteger(std::string &osKey, GIntBig nValue)
+{
+    // Big-endian with flipped sign bit to sort as unsigned.
+    const uint64_t nVal =
+        static_cast<uint64_t>(nValue) ^ (static_cast<uint64_t>(1) << 63);
+    for (int i = 7; i >= 0; --i)
+        osKey += static_cast<char>((nVal >> (8 * i)) & 0xff);
+}
+
+/************************************************************************/
+/*                         AppendSortableReal()                         */
+/************************************************************************/
+
+static void AppendSortableReal(std::string &osKey, double dfValue)
+{
+    // Adding 0 turns -0 into +0, so that they compare equal.
+    const double dfVal = dfValue + 0.0;
+    uint64_t nVal;
+    memcpy(&nVal, &dfVal, sizeof(nVal));
+    if (nVal & (static_cast<uint64_t>(1) << 63))
+        nVal = ~nVal;
+    else
+        nVal ^= static_cast<uint64_t>(1) << 63;
+    for (int i = 7; i >= 0; --i)
+        osKey += static_cast<char>((nVal >> (8 * i)) & 0xff);
+}
+
+/************************************************************************/
+/*                           OGRGenSQLGroupBy                           */
+/************************************************************************/
+
+/* Hash aggregation operator used for GROUP BY queries.                    */
+/*                                                                         */
+/* Groups are identified by a binary key made of the values of the GROUP   */
+/* BY fields, encoded so that comparing keys byte-wise gives the order     */
+/* requested by the ORDER BY clause (whose fields are put first). When the */
+/* hash table exceeds the RAM budget, its groups are sorted by key and     */
+/* written to a temporary file (a "run"), and runs are merged at the end,  */
+/* combining the partial aggregates of groups found in several runs.      */
+/*                                                                         */
+/* A group is serialized as: key size (uint32), key, and for each column   */
+/* function: count (int64), numeric value (double), string value size     */
+/* (uint32) and string value.                                              */
+
+class OGRGenSQLGroupBy
+{
+  public:
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    struct KeyField
+    {
+        int iField = -1;  // may be a special field
+        KeyType eType = KeyType::STRING;
+        bool bDescending = false;
+    };
+
+    struct Aggregate
+    {
+        swq_col_func eFunc = SWQCF_COUNT;
+        int iField = -1;      // -1 for COUNT(*) and COUNT(geometry)
+        int iGeomField = -1;  // for COUNT(geometry)
+        swq_field_type eFieldType = SWQ_OTHER;
+    };
+
+    struct State
+    {
+        GIntBig nCount = 0;
+        double dfValue = 0;
+        std::string osValue{};
+    };
+
+    struct KeyValue
+    {
+        bool bNull = true;
+        GIntBig nValue = 0;
+        double dfValue = 0;
+        std::string osValue{};
+    };
+
+    OGRGenSQLGroupBy(const std::vector<KeyField> &aoKeyFields,
+                     const std::vector<Aggregate> &aoAggregates,
+                     size_t nMaxRAMUsage, bool bSortGroups);
+
+    bool AddFeature(const OGRFeature *poFeature);
+    bool Finish(const std::function<bool(const std::string &)> &fnEmit);
+
+    bool DecodeRecord(const std::string &osRecord,
+                      std::vector<KeyValue> &aoKeyValues,
+                      std::vector<State> &aoStates) const;
+
+    static bool IsStringAggregate(const Aggregate &oAgg);
+
+    const std::vector<KeyField> &GetKeyFields() const
+    {
+        return m_aoKeyFields;
+    }
+
+    const std::vector<Aggregate> &GetAggregates() const
+    {
+        return m_aoAggregates;
+    }
+
+  private:
+    const std::vector<KeyField> m_aoKeyFields;
+    const std::vector<Aggregate> m_aoAggregates;
+    const size_t m_nMaxRAMUsage;
+    const bool m_bSortGroups;
+
+    // Map from a key to the index of its group
+    std::unordered_map<std::string, size_t> m_oMapKeyToGroup{};
+    // Keys of the groups, in the order they were found.
+    std::vector<const std::string *> m_apoGroupKeys{};
+    // Aggregate states, m_aoAggregates.size() per group.
+    std::vector<State> m_aoStates{};
+    size_t m_nRAMUsage = 0;
+
+    std::vector<std::unique_ptr<OGRGenSQLTempFile>> m_apoRuns{};
+
+    std::string m_osKey{};
+    std::string m_osRecord{};
+
+    void InitState(State &oState, const Aggregate &oAgg) const;
+    void ComputeKey(const OGRFeature *poFeature, std::string &osKey) const;
+    static void Accumulate(const OGRFeature *poFeature, const Aggregate &oAgg,
+                           State &oState);
+    static void Merge(State &oState, const State &oOther,
+                      const Aggregate &oAgg);
+    void Serialize(const std::string &osKey, const State *poStates,
+                   std::string &osRecord) const;
+    bool DecodeStates(const std::string &osRecord,
+                      std::vector<State> &aoStates) const;
+    bool SpillRun();
+    bool MergeRuns(std::vector<std::unique_ptr<OGRGenSQLTempFile>> &apoRuns,
+                   const std::function<bool(const std::string &)> &fnEmit);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLGroupBy)
+};
+
+/************************************************************************/
+/*                          OGRGenSQLGroupBy()                          */
+/************************************************************************/
+
+OGRGenSQLGroupBy::OGRGenSQLGroupBy(const std::vector<KeyField> &aoKeyFields,
+                                   const std::vector<Aggregate> &aoAggregates,
+                                   size_t nMaxRAMUsage, bool bSortGroups)
+    : m_aoKeyFields(aoKeyFields), m_aoAggregates(aoAggregates),
+      m_nMaxRAMUsage(nMaxRAMUsage), m_bSortGroups(bSortGroups)
+{
+}
+
+/************************************************************************/
+/*                         IsStringAggregate()                          */
+/*                                                                      */
+/*      Whether MIN() / MAX() compare values as strings, as done by     */
+/*      swq_select_summarize().                                         */
+/************************************************************************/
+
+bool OGRGenSQLGroupBy::IsStringAggregate(const Aggregate &oAgg)
+{
+    return (oAgg.eFunc == SWQCF_MIN || oAgg.eFunc == SWQCF_MAX) &&
+           (oAgg.eFieldType == SWQ_DATE || oAgg.eFieldType == SWQ_TIME ||
+            oAgg.eFieldType == SWQ_TIMESTAMP || oAgg.eFieldType == SWQ_STRING);
+}
+
+/************************************************************************/
+/*                             InitState()                              */
+/************************************************************************/
+
+void OGRGenSQLGroupBy::InitState(State &oState, const Aggregate &oAgg) const
+{
+    oState.nCount = 0;
+    oState.osValue.clear();
+    if (oAgg.eFunc == SWQCF_MIN)
+        oState.dfValue = std::numeric_limits<double>::infinity();
+    else if (oAgg.eFunc == SWQCF_MAX)
+        oState.dfValue = -std::numeric_limits<double>::infinity();
+    else
+        oState.dfValue = 0;
+}
+
+/************************************************************************/
+/*                             ComputeKey()                             */
+/************************************************************************/
+
+void OGRGenSQLGroupBy::ComputeKey(const OGRFeature *poFeature,
+                                  std::string &osKey) const
+{
+    const int nFieldCount = poFeature->GetFieldCount();
+    osKey.clear();
+    for (const auto &oKeyField : m_aoKeyFields)
+    {
+        const size_t nStart = osKey.size();
+        const int iField = oKeyField.iField;
+        // Null values come first, as in Compare()
+        if (iField < nFieldCount && !poFeature->IsFieldSetAndNotNull(iField))
+        {
+            osKey += '\0';
+        }
+        else
+        {
+            osKey += '\1';
+            switch (oKeyField.eType)
+            {
+                case KeyType::INTEGER:
+                    AppendSortableInteger(
+                        osKey, poFeature->GetFieldAsInteger64(iField));
+                    break;
+
+                case KeyType::REAL:
+                    AppendSortableReal(osKey,
+                                       poFeature->GetFieldAsDouble(iField));
+                    break;
+
+                case KeyType::STRING:
+                {
+                    // Nul terminated, so that byte-wise comparison of keys
+                    // is consistent with strcmp().
+                    osKey += poFeature->GetFieldAsString(iField);
+                    osKey += '\0';
+                    break;
+                }
+            }
+        }
+        if (oKeyField.bDescending)
+        {
+            for (size_t i = nStart; i < osKey.size(); ++i)
+                osKey[i] = static_cast<char>(~osKey[i]);
+        }
+    }
+}
+
+/************************************************************************/
+/*                             Accumulate()                             */
+/************************************************************************/
+
+void OGRGenSQLGroupBy::Accumulate(const OGRFeature *poFeature,
+                                  const Aggregate &oAgg, State &oState)
+{
+    if (oAgg.eFunc == SWQCF_COUNT)
+    {
+        if (oAgg.iGeomField >= 0)
+        {
+            if (poFeature->GetGeomFieldRef(oAgg.iGeomField) != nullptr)
+                oState.nCount++;
+        }
+        else if (oAgg.iField < 0 ||
+                 poFeature->IsFieldSetAndNotNull(oAgg.iField))
+        {
+            oState.nCount++;
+        }
+        return;
+    }
+
+    if (!poFeature->IsFieldSetAndNotNull(oAgg.iField))
+        return;
+
+    if (IsStringAggregate(oAgg))
+    {
+        const char *pszVal = poFeature->GetFieldAsString(oAgg.iField);
+        if (pszVal[0] == '\0')
+            return;
+        const int nCmp = strcmp(pszVal, oState.osValue.c_str());
+        if (oState.nCount == 0 ||
+            (oAgg.eFunc == SWQCF_MIN ? nCmp < 0 : nCmp > 0))
+        {
+            oState.osValue = pszVal;
+        }
+        oState.nCount++;
+        return;
+    }
+
+    double dfVal;
+    if (oAgg.eFieldType == SWQ_DATE || oAgg.eFieldType == SWQ_TIME ||
+        oAgg.eFieldType == SWQ_TIMESTAMP)
+    {
+        // Only AVG() and SUM() here.
+        OGRField sField;
+        if (!OGRParseDate(poFeature->GetFieldAsString(oAgg.iField), &sField,
+                          0))
+            return;
+        struct tm brokendowntime;
+        brokendowntime.tm_year = sField.Date.Year - 1900;
+        brokendowntime.tm_mon = sField.Date.Month - 1;
+        brokendowntime.tm_mday = sField.Date.Day;
+        brokendowntime.tm_hour = sField.Date.Hour;
+        brokendowntime.tm_min = sField.Date.Minute;
+        brokendowntime.tm_sec = static_cast<int>(sField.Date.Second);
+        dfVal = static_cast<double>(CPLYMDHMSToUnixTime(&brokendowntime)) +
+                fmod(static_cast<double>(sField.Date.Second), 1.0);
+    }
+    else if (oAgg.eFieldType == SWQ_INTEGER ||
+             oAgg.eFieldType == SWQ_INTEGER64 ||
+             oAgg.eFieldType == SWQ_FLOAT || oAgg.eFieldType == SWQ_BOOLEAN)
+    {
+        dfVal = poFeature->GetFieldAsDouble(oAgg.iField);
+    }
+    else
+    {
+        const char *pszVal = poFeature->GetFieldAsString(oAgg.iField);
+        if (pszVal[0] == '\0')
+            return;
+        dfVal = CPLAtof(pszVal);
+    }
+
+    oState.nCount++;
+    if (oAgg.eFunc == SWQCF_MIN)
+        oState.dfValue = std::min(oState.dfValue, dfVal);
+    else if (oAgg.eFunc == SWQCF_MAX)
+        oState.dfValue = std::max(oState.dfValue, dfVal);
+    else
+        oState.dfValue += dfVal;
+}
+
+/************************************************************************/
+/*                               Merge()                                */
+/************************************************************************/
+
+void OGRGenSQLGroupBy::Merge(State &oState, const State &oOther,
+                             const Aggregate &oAgg)
+{
+    if (oOther.nCount == 0)
+        return;
+    if (IsStringAggregate(oAgg))
+    {
+        if (oState.nCount == 0 ||
+            (oAgg.eFunc == SWQCF_MIN ? oOther.osValue < oState.osValue
+                                     : oOther.osValue > oState.osValue))
+        {
+            oState.osValue = oOther.osValue;
+        }
+    }
+    else if (oAgg.eFunc == SWQCF_MIN)
+        oState.dfValue = std::min(oState.dfValue, oOther.dfValue);
+    else if (oAgg.eFunc == SWQCF_MAX)
+        oState.dfValue = std::max(oState.dfValue, oOther.dfValue);
+    else
+        oState.dfValue += oOther.dfValue;
+    oState.nCount += oOther.nCount;
+}
+
+/************************************************************************/
+/*                             AddFeature()                             */
+/************************************************************************/
+
+bool OGRGenSQLGroupBy::AddFeature(const OGRFeature *poFeature)
+{
+    const size_t nAggCount = m_aoAggregates.size();
+    ComputeKey(poFeature, m_osKey);
+
+    try
+    {
+        size_t iGroup;
+        const auto oIter = m_oMapKeyToGroup.find(m_osKey);
+        if (oIter == m_oMapKeyToGroup.end())
+        {
+            iGroup = m_apoGroupKeys.size();
+            const auto oRes = m_oMapKeyToGroup.emplace(m_osKey, iGroup);
+            m_apoGroupKeys.push_back(&(oRes.first->first));
+            m_aoStates.resize(m_aoStates.size() + nAggCount);
+            for (size_t i = 0; i < nAggCount; ++i)
+            {
+                InitState(m_aoStates[iGroup * nAggCount + i],
+                          m_aoAggregates[i]);
+            }
+            // Rough estimate of the hash table node overhead
+            m_nRAMUsage += 4 * sizeof(void *) + sizeof(std::string) +
+                           m_osKey.size() + sizeof(const std::string *) +
+                           nAggCount * sizeof(State);
+        }
+        else
+        {
+            iGroup = oIter->second;
+        }
+
+        for (size_t i = 0; i < nAggCount; ++i)
+        {
+            State &oState = m_aoStates[iGroup * nAggCount + i];
+            const size_t nOldSize = oState.osValue.size();
+            Accumulate(poFeature, m_aoAggregates[i], oState);
+            if (oState.osValue.size() > nOldSize)
+                m_nRAMUsage += oState.osValue.size() - nOldSize;
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GROUP BY processing");
+        return false;
+    }
+
+    if (m_nRAMUsage > m_nMaxRAMUsage)
+        return SpillRun();
+    return true;
+}
+
+/************************************************************************/
+/*                             Serialize()                              */
+/************************************************************************/
+
+void OGRGenSQLGroupBy::Serialize(const std::string &osKey,
+                                 const State *poStates,
+                                 std::string &osRecord) const
+{
+    const auto AppendUInt32 = [&osRecord](uint32_t nVal)
+    {
+        osRecord.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+
+    osRecord.clear();
+    AppendUInt32(static_cast<uint32_t>(osKey.size()));
+    osRecord += osKey;
+    for (size_t i = 0; i < m_aoAggregates.size(); ++i)
+    {
+        const State &oState = poStates[i];
+        osRecord.append(reinterpret_cast<const char *>(&oState.nCount),
+                        sizeof(oState.nCount));
+        osRecord.append(reinterpret_cast<const char *>(&oState.dfValue),
+                        sizeof(oState.dfValue));
+        AppendUInt32(static_cast<uint32_t>(oState.osValue.size()));
+        osRecord += oState.osValue;
+    }
+}
+
+/************************************************************************/
+/*                            DecodeStates()                            */
+/************************************************************************/
+
+bool OGRGenSQLGroupBy::DecodeStates(const std::string &osRecord,
+                                    std::vector<State> &aoStates) const
+{
+    size_t nPos = 0;
+    const auto Read = [&osRecord, &nPos](void *pDst, size_t nSize)
+    {
+        if (nSize > osRecord.size() - nPos)
+            return false;
+        memcpy(pDst, osRecord.data() + nPos, nSize);
+        nPos += nSize;
+        return true;
+    };
+
+    uint32_t nKeySize = 0;
+    if (!Read(&nKeySize, sizeof(nKeySize)) ||
+        nKeySize > osRecord.size() - nPos)
+        return false;
+    nPos += nKeySize;
+
+    aoStates.resize(m_aoAggregates.size());
+    for (auto &oState : aoStates)
+    {
+        uint32_t nStrSize = 0;
+        if (!Read(&oState.nCount, sizeof(oState.nCount)) ||
+            !Read(&oState.dfValue, sizeof(oState.dfValue)) ||
+            !Read(&nStrSize, sizeof(nStrSize)) ||
+            nStrSize > osRecord.size() - nPos)
+            return false;
+        oState.osValue.assign(osRecord.data() + nPos, nStrSize);
+        nPos += nStrSize;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            DecodeRecord()                            */
+/************************************************************************/
+
+bool OGRGenSQLGroupBy::DecodeRecord(const std::string &osRecord,
+                                    std::vector<KeyValue> &aoKeyValues,
+                                    std::vector<State> &aoStates) const
+{
+    if (!DecodeStates(osRecord, aoStates))
+        return false;
+
+    uint32_t nKeySize = 0;
+    memcpy(&nKeySize, osRecord.data(), sizeof(nKeySize));
+    const GByte *pabyKey =
+        reinterpret_cast<const GByte *>(osRecord.data()) + sizeof(nKeySize);
+    const GByte *const pabyKeyEnd = pabyKey + nKeySize;
+
+    aoKeyValues.resize(m_aoKeyFields.size());
+    for (size_t iKey = 0; iKey < m_aoKeyFields.size(); ++iKey)
+    {
+        const auto &oKeyField = m_aoKeyFields[iKey];
+        auto &oValue = aoKeyValues[iKey];
+        const GByte byMask = oKeyField.bDescending ? 0xff : 0;
+        if (pabyKey == pabyKeyEnd)
+            return false;
+        oValue.bNull = ((*pabyKey) ^ byMask) == 0;
+        ++pabyKey;
+        if (oValue.bNull)
+            continue;
+
+        if (oKeyField.eType == KeyType::STRING)
+        {
+            oValue.osValue.clear();
+            while (true)
+            {
+                if (pabyKey == pabyKeyEnd)
+                    return false;
+                const char ch = static_cast<char>((*pabyKey) ^ byMask);
+                ++pabyKey;
+                if (ch == '\0')
+                    break;
+                oValue.osValue += ch;
+            }
+        }
+        else
+        {
+            if (pabyKeyEnd - pabyKey < 8)
+                return false;
+            uint64_t nVal = 0;
+            for (int i = 0; i < 8; ++i)
+                nVal = (nVal << 8) | static_cast<GByte>(pabyKey[i] ^ byMask);
+            pabyKey += 8;
+            if (oKeyField.eType == KeyType::INTEGER)
+            {
+                oValue.nValue = static_cast<GIntBig>(
+                    nVal ^ (static_cast<uint64_t>(1) << 63));
+            }
+            else
+            {
+                if (nVal & (static_cast<uint64_t>(1) << 63))
+                    nVal ^= static_cast<uint64_t>(1) << 63;
+                else
+                    nVal = ~nVal;
+                memcpy(&oValue.dfValue, &nVal, sizeof(nVal));
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                              SpillRun()                              */
+/************************************************************************/
+
+bool OGRGenSQLGroupBy::SpillRun()
+{
+    CPLDebug("GenSQL",
+             "GROUP BY: writing %d groups to temporary file, as "
+             "OGR_SQL_MAX_RAM_USAGE_GROUP_BY = " CPL_FRMT_GUIB " is exceeded",
+             static_cast<int>(m_apoGroupKeys.size()),
+             static_cast<GUIntBig>(m_nMaxRAMUsage));
+
+    auto poRun = OGRGenSQLTempFile::Create();
+    if (!poRun)
+        return false;
+
+    std::vector<size_t> anOrder(m_apoGroupKeys.size());
+    for (size_t i = 0; i < anOrder.size(); ++i)
+        anOrder[i] = i;
+    std::sort(anOrder.begin(), anOrder.end(),
+              [this](size_t a, size_t b)
+              { return *(m_apoGroupKeys[a]) < *(m_apoGroupKeys[b]); });
+
+    VSILFILE *fp = poRun->GetHandle();
+    const size_t nAggCount = m_aoAggregates.size();
+    for (const size_t iGroup : anOrder)
+    {
+        Serialize(*(m_apoGroupKeys[iGroup]),
+                  m_aoStates.data() + iGroup * nAggCount, m_osRecord);
+        const uint32_t nSize = static_cast<uint32_t>(m_osRecord.size());
+        if (VSIFWriteL(&nSize, sizeof(nSize), 1, fp) != 1 ||
+            VSIFWriteL(m_osRecord.data(), 1, m_osRecord.size(), fp) !=
+                m_osRecord.size())
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write temporary file");
+            return false;
+        }
+    }
+    m_apoRuns.push_back(std::move(poRun));
+
+    m_oMapKeyToGroup.clear();
+    m_apoGroupKeys.clear();
+    m_aoStates.clear();
+    m_nRAMUsage = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                             MergeRuns()                              */
+/************************************************************************/
+
+bool OGRGenSQLGroupBy::MergeRuns(
+    std::vector<std::unique_ptr<OGRGenSQLTempFile>> &apoRuns,
+    const std::function<bool(const std::string &)> &fnEmit)
+{
+    struct RunReader
+    {
+        VSILFILE *fp = nullptr;
+        std::string osRecord{};
+        std::string osKey{};
+    };
+
+    std::vector<RunReader> aoReaders(apoRuns.size());
+    const auto ReadNext = [](RunReader &oReader)
+    {
+        uint32_t nSize = 0;
+        if (VSIFReadL(&nSize, sizeof(nSize), 1, oReader.fp) != 1)
+            return false;
+        oReader.osRecord.resize(nSize);
+        if (VSIFReadL(&oReader.osRecord[0], 1, nSize, oReader.fp) != nSize ||
+            nSize < sizeof(uint32_t))
+            return false;
+        uint32_t nKeySize = 0;
+        memcpy(&nKeySize, oReader.osRecord.data(), sizeof(nKeySize));
+        if (nKeySize > nSize - sizeof(uint32_t))
+            return false;
+        oReader.osKey.assign(oReader.osRecord.data() + sizeof(uint32_t),
+                             nKeySize);
+        return true;
+    };
+
+    // Min-heap of readers on their current key.
+    const auto Greater = [&aoReaders](size_t a, size_t b)
+    { return aoReaders[a].osKey > aoReaders[b].osKey; };
+    std::vector<size_t> anHeap;
+    for (size_t i = 0; i < apoRuns.size(); ++i)
+    {
+        aoReaders[i].fp = apoRuns[i]->GetHandle();
+        VSIFSeekL(aoReaders[i].fp, 0, SEEK_SET);
+        if (ReadNext(aoReaders[i]))
+            anHeap.push_back(i);
+    }
+    std::make_heap(anHeap.begin(), anHeap.end(), Greater);
+
+    const size_t nAggCount = m_aoAggregates.size();
+    std::string osCurKey;
+    std::vector<State> aoCurStates;
+    std::vector<State> aoStates;
+    bool bHasCur = false;
+    const auto EmitCur = [this, &osCurKey, &aoCurStates, &fnEmit]()
+    {
+        Serialize(osCurKey, aoCurStates.data(), m_osRecord);
+        return fnEmit(m_osRecord);
+    };
+
+    while (!anHeap.empty())
+    {
+        std::pop_heap(anHeap.begin(), anHeap.end(), Greater);
+        RunReader &oReader = aoReaders[anHeap.back()];
+
+        if (!DecodeStates(oReader.osRecord, aoStates))
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Corrupted GROUP BY temporary file");
+            return false;
+        }
+        if (bHasCur && oReader.osKey == osCurKey)
+        {
+            for (size_t i = 0; i < nAggCount; ++i)
+                Merge(aoCurStates[i], aoStates[i], m_aoAggregates[i]);
+        }
+        else
+        {
+            if (bHasCur && !EmitCur())
+                return false;
+            osCurKey = oReader.osKey;
+            std::swap(aoCurStates, aoStates);
+            bHasCur = true;
+        }
+
+        if (ReadNext(oReader))
+            std::push_heap(anHeap.begin(), anHeap.end(), Greater);
+        else
+            anHeap.pop_back();
+    }
+
+    return !bHasCur || EmitCur();
+}
+
+/************************************************************************/
+/*                               Finish()                               */
+/*                                                                      */
+/*      Call fnEmit() with the serialized record of each group, in      */
+/*      key order if sorting is requested.                              */
+/************************************************************************/
+
+bool OGRGenSQLGroupBy::Finish(
+    const std::function<bool(const std::string &)> &fnEmit)
+{
+    const size_t nAggCount = m_aoAggregates.size();
+
+    if (m_apoRuns.empty())
+    {
+        std::vector<size_t> anOrder(m_apoGroupKeys.size());
+        for (size_t i = 0; i < anOrder.size(); ++i)
+            anOrder[i] = i;
+        if (m_bSortGroups)
+        {
+            std::sort(anOrder.begin(), anOrder.end(),
+                      [this](size_t a, size_t b)
+                      { return *(m_apoGroupKeys[a]) < *(m_apoGroupKeys[b]); });
+        }
+        for (const size_t iGroup : anOrder)
+        {
+            Serialize(*(m_apoGroupKeys[iGroup]),
+                      m_aoStates.data() + iGroup * nAggCount, m_osRecord);
+            if (!fnEmit(m_osRecord))
+                return false;
+        }
+    }
+    else
+    {
+        if (!m_apoGroupKeys.empty() && !SpillRun())
+            return false;
+
+        // Limit the number of simultaneously opened files by merging
+        // runs by batches first.
+        constexpr size_t MAX_MERGED_RUNS = 64;
+        while (m_apoRuns.size() > MAX_MERGED_RUNS)
+        {
+            std::vector<std::unique_ptr<OGRGenSQLTempFile>> apoBatch;
+            for (size_t i = 0; i < MAX_MERGED_RUNS; ++i)
+                apoBatch.push_back(std::move(m_apoRuns[i]));
+            m_apoRuns.erase(m_apoRuns.begin(),
+                            m_apoRuns.begin() + MAX_MERGED_RUNS);
+
+            auto poRun = OGRGenSQLTempFile::Create();
+            if (!poRun)
+                return false;
+            VSILFILE *fp = poRun->GetHandle();
+            if (!MergeRuns(apoBatch,
+                           [fp](const std::string &osRecord)
+                           {
+                               const uint32_t nSize =
+                                   static_cast<uint32_t>(osRecord.size());
+                               return VSIFWriteL(&nSize, sizeof(nSize), 1,
+                                                 fp) == 1 &&
+                                      VSIFWriteL(osRecord.data(), 1,
+                                                 osRecord.size(),
+                                                 fp) == osRecord.size();
+                           }))
+            {
+                return false;
+            }
+            m_apoRuns.push_back(std::move(poRun));
+        }
+
+        if (!MergeRuns(m_apoRuns, fnEmit))
+            return false;
+    }
+
+    m_oMapKeyToGroup.clear();
+    m_apoGroupKeys.clear();
+    m_aoStates.clear();
+    m_apoRuns.clear();
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRGenSQLFeatureSorter                        */
+/************************************************************************/
+
+/* External merge sort of the source features of an ORDER BY query, used  */
+/* when the source layer has no efficient random read, or when the        */
+/* in-memory index of sort keys would use too much RAM.                   */
+/*                                                                         */
+/* A record is made of: key size (uint32), key (encoded so that byte-wise  */
+/* comparison gives the ORDER BY order), style string size (uint32), style */
+/* string, and the OGRFeature::SerializeToBinary() encoding of the        */
+/* feature. Records are accumulated in RAM, and written as sorted runs to  */
+/* temporary files when the RAM budget is exceeded. Runs are merged while  */
+/* features are read, so that features are streamed in sorted order       */
+/* without random access to the source layer. Sorting is stable.          */
+
+class OGRGenSQLFeatureSorter
+{
+  public:
+    explicit OGRGenSQLFeatureSorter(size_t nMaxRAMUsage)
+        : m_nMaxRAMUsage(nMaxRAMUsage)
+    {
+    }
+
+    bool Add(const std::string &osKey, const OGRFeature *poFeature);
+    bool Finish();
+
+    // Whether features were added in sorted order.
+    bool IsAlreadySorted() const
+    {
+        return m_bAlreadySorted;
+    }
+
+    bool IsInMemory() const
+    {
+        return m_apoRuns.empty();
+    }
+
+    std::unique_ptr<OGRFeature> GetFeature(size_t nIdx,
+                                           OGRFeatureDefn *poDefn);
+
+  private:
+    struct RunReader
+    {
+        VSILFILE *fp = nullptr;
+        std::string osRecord{};
+    };
+
+    const size_t m_nMaxRAMUsage;
+    std::vector<std::string> m_aosRecords{};
+    size_t m_nRAMUsage = 0;
+    std::string m_osLastKey{};
+    bool m_bAlreadySorted = true;
+
+    std::vector<std::unique_ptr<OGRGenSQLTempFile>> m_apoRuns{};
+    std::vector<RunReader> m_aoReaders{};
+    std::vector<size_t> m_anHeap{};
+    size_t m_nNextIdx = 0;
+
+    std::vector<GByte> m_abyBuffer{};
+    std::string m_osRecord{};
+
+    static int CompareKeys(const std::string &osA, const std::string &osB);
+    static bool ReadRecord(VSILFILE *fp, std::string &osRecord);
+    static bool WriteRecord(VSILFILE *fp, const std::string &osRecord);
+    static std::unique_ptr<OGRFeature> DecodeRecord(const std::string &osRecord,
+                                                    OGRFeatureDefn *poDefn);
+    bool SpillRun();
+    bool HeapGreater(size_t a, size_t b) const;
+    bool StartMerge(std::vector<std::unique_ptr<OGRGenSQLTempFile>> &apoRuns);
+    bool NextMergedRecord(std::string &osRecord);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLFeatureSorter)
+};
+
+/************************************************************************/
+/*                            CompareKeys()                             */
+/************************************************************************/
+
+int OGRGenSQLFeatureSorter::CompareKeys(const std::string &osA,
+                                        const std::string &osB)
+{
+    uint32_t nKeySizeA = 0;
+    uint32_t nKeySizeB = 0;
+    memcpy(&nKeySizeA, osA.data(), sizeof(nKeySizeA));
+    memcpy(&nKeySizeB, osB.data(), sizeof(nKeySizeB));
+    return osA.compare(sizeof(uint32_t), nKeySizeA, osB, sizeof(uint32_t),
+                       nKeySizeB);
+}
+
+/************************************************************************/
+/*                             ReadRecord()                             */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::ReadRecord(VSILFILE *fp, std::string &osRecord)
+{
+    uint32_t nSize = 0;
+    if (VSIFReadL(&nSize, sizeof(nSize), 1, fp) != 1)
+        return false;
+    osRecord.resize(nSize);
+    if (VSIFReadL(&osRecord[0], 1, nSize, fp) != nSize)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read ORDER BY temporary file");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            WriteRecord()                             */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::WriteRecord(VSILFILE *fp,
+                                         const std::string &osRecord)
+{
+    const uint32_t nSize = static_cast<uint32_t>(osRecord.size());
+    if (VSIFWriteL(&nSize, sizeof(nSize), 1, fp) != 1 ||
+        VSIFWriteL(osRecord.data(), 1, osRecord.size(), fp) != osRecord.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot write ORDER BY temporary file");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::Add(const std::string &osKey,
+                                 const OGRFeature *poFeature)
+{
+    if (!poFeature->SerializeToBinary(m_abyBuffer))
+        return false;
+
+    if (m_bAlreadySorted)
+    {
+        if (!m_aosRecords.empty() || !m_apoRuns.empty())
+            m_bAlreadySorted = !(osKey < m_osLastKey);
+        m_osLastKey = osKey;
+    }
+
+    const char *pszStyle = poFeature->GetStyleString();
+    const uint32_t nKeySize = static_cast<uint32_t>(osKey.size());
+    const uint32_t nStyleSize =
+        pszStyle ? static_cast<uint32_t>(strlen(pszStyle)) : 0;
+    try
+    {
+        std::string osRecord;
+        osRecord.reserve(2 * sizeof(uint32_t) + nKeySize + nStyleSize +
+                         m_abyBuffer.size());
+        osRecord.append(reinterpret_cast<const char *>(&nKeySize),
+                        sizeof(nKeySize));
+        osRecord += osKey;
+        osRecord.append(reinterpret_cast<const char *>(&nStyleSize),
+                        sizeof(nStyleSize));
+        if (nStyleSize)
+            osRecord.append(pszStyle, nStyleSize);
+        osRecord.append(reinterpret_cast<const char *>(m_abyBuffer.data()),
+                        m_abyBuffer.size());
+        m_nRAMUsage += sizeof(std::string) + osRecord.capacity();
+        m_aosRecords.push_back(std::move(osRecord));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in ORDER BY processing");
+        return false;
+    }
+
+    if (m_nRAMUsage > m_nMaxRAMUsage)
+        return SpillRun();
+    return true;
+}
+
+/************************************************************************/
+/*                              SpillRun()                              */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::SpillRun()
+{
+    CPLDebug("GenSQL",
+             "ORDER BY: writing %d features to temporary file, as "
+             "OGR_SQL_MAX_RAM_USAGE_ORDER_BY = " CPL_FRMT_GUIB " is exceeded",
+             static_cast<int>(m_aosRecords.size()),
+             static_cast<GUIntBig>(m_nMaxRAMUsage));
+
+    auto poRun = OGRGenSQLTempFile::Create();
+    if (!poRun)
+        return false;
+
+    std::stable_sort(m_aosRecords.begin(), m_aosRecords.end(),
+                     [](const std::string &a, const std::string &b)
+                     { return CompareKeys(a, b) < 0; });
+    for (const auto &osRecord : m_aosRecords)
+    {
+        if (!WriteRecord(poRun->GetHandle(), osRecord))
+            return false;
+    }
+    m_apoRuns.push_back(std::move(poRun));
+
+    m_aosRecords.clear();
+    m_nRAMUsage = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                            HeapGreater()                             */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::HeapGreater(size_t a, size_t b) const
+{
+    const int nCmp =
+        CompareKeys(m_aoReaders[a].osRecord, m_aoReaders[b].osRecord);
+    // On ties, take the record of the earliest run, for a stable sort.
+    return nCmp > 0 || (nCmp == 0 && a > b);
+}
+
+/************************************************************************/
+/*                             StartMerge()                             */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::StartMerge(
+    std::vector<std::unique_ptr<OGRGenSQLTempFile>> &apoRuns)
+{
+    m_aoReaders.clear();
+    m_aoReaders.resize(apoRuns.size());
+    m_anHeap.clear();
+    for (size_t i = 0; i < apoRuns.size(); ++i)
+    {
+        m_aoReaders[i].fp = apoRuns[i]->GetHandle();
+        if (VSIFSeekL(m_aoReaders[i].fp, 0, SEEK_SET) != 0)
+            return false;
+        if (ReadRecord(m_aoReaders[i].fp, m_aoReaders[i].osRecord))
+            m_anHeap.push_back(i);
+    }
+    std::make_heap(m_anHeap.begin(), m_anHeap.end(),
+                   [this](size_t a, size_t b) { return HeapGreater(a, b); });
+    m_nNextIdx = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                          NextMergedRecord()                          */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::NextMergedRecord(std::string &osRecord)
+{
+    if (m_anHeap.empty())
+        return false;
+    const auto Greater = [this](size_t a, size_t b)
+    { return HeapGreater(a, b); };
+    std::pop_heap(m_anHeap.begin(), m_anHeap.end(), Greater);
+    RunReader &oReader = m_aoReaders[m_anHeap.back()];
+    std::swap(osRecord, oReader.osRecord);
+    if (ReadRecord(oReader.fp, oReader.osRecord))
+        std::push_heap(m_anHeap.begin(), m_anHeap.end(), Greater);
+    else
+        m_anHeap.pop_back();
+    m_nNextIdx++;
+    return true;
+}
+
+/************************************************************************/
+/*                               Finish()                               */
+/************************************************************************/
+
+bool OGRGenSQLFeatureSorter::Finish()
+{
+    if (m_apoRuns.empty())
+    {
+        if (!m_bAlreadySorted)
+        {
+            std::stable_sort(m_aosRecords.begin(), m_aosRecords.end(),
+                             [](const std::string &a, const std::string &b)
+                             { return CompareKeys(a, b) < 0; });
+        }
+        return true;
+    }
+
+    if (!m_aosRecords.empty() && !SpillRun())
+        return false;
+
+    // Limit the number of simultaneously opened files by merging
+    // consecutive runs by batches first, which preserves stability.
+    constexpr size_t MAX_MERGED_RUNS = 64;
+    while (m_apoRuns.size() > MAX_MERGED_RUNS)
+    {
+        std::vector<std::unique_ptr<OGRGenSQLTempFile>> apoNewRuns;
+        for (size_t i = 0; i < m_apoRuns.size(); i += MAX_MERGED_RUNS)
+        {
+            std::vector<std::unique_ptr<OGRGenSQLTempFile>> apoBatch;
+            for (size_t j = i;
+                 j < std::min(m_apoRuns.size(), i + MAX_MERGED_RUNS); ++j)
+            {
+                apoBatch.push_back(std::move(m_apoRuns[j]));
+            }
+            auto poRun = OGRGenSQLTempFile::Create();
+            if (!poRun || !StartMerge(apoBatch))
+                return false;
+            while (NextMergedRecord(m_osRecord))
+            {
+                if (!WriteRecord(poRun->GetHandle(), m_osRecord))
+                    return false;
+            }
+            apoNewRuns.push_back(std::move(poRun));
+        }
+        m_apoRuns = std::move(apoNewRuns);
+    }
+
+    return StartMerge(m_apoRuns);
+}
+
+/************************************************************************/
+/*                            DecodeRecord()                            */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLFeatureSorter::DecodeRecord(const std::string &osRecord,
+                                     OGRFeatureDefn *poDefn)
+{
+    const GByte *pabyData = reinterpret_cast<const GByte *>(osRecord.data());
+    size_t nRemaining = osRecord.size();
+    uint32_t nSize = 0;
+    for (int i = 0; i < 2; ++i)
+    {
+        if (nRemaining < sizeof(nSize))
+            return nullptr;
+        memcpy(&nSize, pabyData, sizeof(nSize));
+        pabyData += sizeof(nSize);
+        nRemaining -= sizeof(nSize);
+        if (nSize > nRemaining)
+            return nullptr;
+        if (i == 0)
+        {
+            // Skip key
+            pabyData += nSize;
+            nRemaining -= nSize;
+        }
+    }
+
+    auto poFeature = std::make_unique<OGRFeature>(poDefn);
+    if (nSize)
+    {
+        poFeature->SetStyleString(
+            std::string(reinterpret_cast<const char *>(pabyData), nSize)
+                .c_str());
+    }
+    if (!poFeature->DeserializeFromBinary(pabyData + nSize,
+                                          nRemaining - nSize))
+    {
+        return nullptr;
+    }
+    return poFeature;
+}
+
+/************************************************************************/
+/*                             GetFeature()                             */
+/*                                                                      */
+/*      Return the feature at index nIdx in the sorted sequence. This   */
+/*      is efficient for sequential access only when runs are merged.   */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLFeatureSorter::GetFeature(size_t nIdx, OGRFeatureDefn *poDefn)
+{
+    if (m_apoRuns.empty())
+    {
+        if (nIdx >= m_aosRecords.size())
+            return nullptr;
+        return DecodeRecord(m_aosRecords[nIdx], poDefn);
+    }
+
+    if (nIdx < m_nNextIdx && !StartMerge(m_apoRuns))
+        return nullptr;
+    while (m_nNextIdx <= nIdx)
+    {
+        if (!NextMergedRecord(m_osRecord))
+            return nullptr;
+    }
+    auto poFeature = DecodeRecord(m_osRecord, poDefn);
+    if (!poFeature)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Corrupted ORDER BY temporary file");
+    }
+    return poFeature;
+}
+
 /************************************************************************/
 /*                       OGRGenSQLResultsLayer()                        */
 /************************************************************************/
@@ -94,6 +1779,9 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
 {
     swq_select *psSelectInfo = m_pSelectInfo.get();
 
+    m_apoJoinHashTables.resize(psSelectInfo->join_count);
+    m_abJoinHashTableTried.resize(psSelectInfo->join_count, false);
+
     /* -------------------------------------------------------------------- */
     /*      Identify all the layers involved in the SELECT.                 */
     /* -------------------------------------------------------------------- */
@@ -491,6 +2179,11 @@ OGRGenSQLResultsLayer::~OGRGenSQLResultsLayer()
     {
         m_poDefn->Release();
     }
+
+    if (m_poHavingDefn != nullptr)
+    {
+        m_poHavingDefn->Release();
+    }
 }
 
 /************************************************************************/
@@ -637,7 +2330,9 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
         return OGRERR_FAILURE;
     }
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || !m_anFIDIndex.empty())
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+        psSelectInfo->query_mode == SWQM_GROUP_BY || !m_anFIDIndex.empty() ||
+        m_poOrderBySorter)
     {
         m_nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -709,6 +2404,13 @@ GIntBig OGRGenSQLResultsLayer::GetFeatureCount(int bForce)
 
         nRet = psSelectInfo->column_summary[0].count;
     }
+    else if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (!PrepareGroupBy())
+            return 0;
+
+        nRet = static_cast<GIntBig>(m_poGroupByRecords->size());
+    }
     else if (psSelectInfo->query_mode != SWQM_RECORDSET)
         return 1;
     else if (m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL())
@@ -741,7 +2443,9 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap)
     {
         if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
             psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
-            !m_anFIDIndex.empty())
+            psSelectInfo->query_mode == SWQM_GROUP_BY ||
+            !m_anFIDIndex.empty() ||
+            (m_poOrderBySorter && m_poOrderBySorter->IsInMemory()))
             return TRUE;
         else
             return m_poSrcLayer->TestCapability(pszCap);
@@ -790,15 +2494,72 @@ int OGRGenSQLResultsLayer::ContainGeomSpecialField(swq_expr_node *expr)
             return FALSE;
         }
     }
-    else if (expr->eNodeType == SNT_OPERATION)
+    else if (expr->eNodeType == SNT_OPERATION)
+    {
+        for (int i = 0; i < expr->nSubExprCount; i++)
+        {
+            if (ContainGeomSpecialField(expr->papoSubExpr[i]))
+                return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/************************************************************************/
+/*                        SummaryNeedsGeometry()                        */
+/*                                                                      */
+/*      Geometry reading can be skipped when computing summaries if     */
+/*      there is no spatial filter in place, and that the where clause, */
+/*      the columns, the GROUP BY fields and the HAVING clause do not   */
+/*      reference OGR_GEOMETRY, OGR_GEOM_WKT or OGR_GEOM_AREA special   */
+/*      fields, or the geometry.                                        */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::SummaryNeedsGeometry()
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+
+    if (m_poFilterGeom != nullptr ||
+        (psSelectInfo->where_expr != nullptr &&
+         ContainGeomSpecialField(psSelectInfo->where_expr)) ||
+        (psSelectInfo->having_expr != nullptr &&
+         ContainGeomSpecialField(psSelectInfo->having_expr)))
+    {
+        return true;
+    }
+
+    OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
+    const auto IsGeomRelatedField = [poSrcDefn](int iField)
+    {
+        const int nSpecialFieldIdx = iField - poSrcDefn->GetFieldCount();
+        return nSpecialFieldIdx == SPF_OGR_GEOMETRY ||
+               nSpecialFieldIdx == SPF_OGR_GEOM_WKT ||
+               nSpecialFieldIdx == SPF_OGR_GEOM_AREA ||
+               iField == GEOM_FIELD_INDEX_TO_ALL_FIELD_INDEX(poSrcDefn, 0);
+    };
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (psColDef->table_index == 0 && psColDef->field_index != -1 &&
+            IsGeomRelatedField(psColDef->field_index))
+        {
+            return true;
+        }
+        if (psColDef->expr != nullptr &&
+            ContainGeomSpecialField(psColDef->expr))
+        {
+            return true;
+        }
+    }
+
+    for (int i = 0; i < psSelectInfo->group_by_specs; i++)
     {
-        for (int i = 0; i < expr->nSubExprCount; i++)
-        {
-            if (ContainGeomSpecialField(expr->papoSubExpr[i]))
-                return TRUE;
-        }
+        if (IsGeomRelatedField(psSelectInfo->group_by_defs[i].field_index))
+            return true;
     }
-    return FALSE;
+
+    return false;
 }
 
 /************************************************************************/
@@ -828,44 +2589,8 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
     /*      OGR_GEOM_WKT or OGR_GEOM_AREA special fields.                   */
     /* -------------------------------------------------------------------- */
     int bSaveIsGeomIgnored = m_poSrcLayer->GetLayerDefn()->IsGeometryIgnored();
-    if (m_poFilterGeom == nullptr &&
-        (psSelectInfo->where_expr == nullptr ||
-         !ContainGeomSpecialField(psSelectInfo->where_expr)))
-    {
-        int bFoundGeomExpr = FALSE;
-        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
-        {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-            if (psColDef->table_index == 0 && psColDef->field_index != -1)
-            {
-                OGRLayer *poLayer = m_apoTableLayers[psColDef->table_index];
-                int nSpecialFieldIdx = psColDef->field_index -
-                                       poLayer->GetLayerDefn()->GetFieldCount();
-                if (nSpecialFieldIdx == SPF_OGR_GEOMETRY ||
-                    nSpecialFieldIdx == SPF_OGR_GEOM_WKT ||
-                    nSpecialFieldIdx == SPF_OGR_GEOM_AREA)
-                {
-                    bFoundGeomExpr = TRUE;
-                    break;
-                }
-                if (psColDef->field_index ==
-                    GEOM_FIELD_INDEX_TO_ALL_FIELD_INDEX(poLayer->GetLayerDefn(),
-                                                        0))
-                {
-                    bFoundGeomExpr = TRUE;
-                    break;
-                }
-            }
-            if (psColDef->expr != nullptr &&
-                ContainGeomSpecialField(psColDef->expr))
-            {
-                bFoundGeomExpr = TRUE;
-                break;
-            }
-        }
-        if (!bFoundGeomExpr)
-            m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(TRUE);
-    }
+    if (!SummaryNeedsGeometry())
+        m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(TRUE);
 
     /* -------------------------------------------------------------------- */
     /*      We treat COUNT(*) as a special case, and fill with              */
@@ -930,129 +2655,562 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
                 else
                     pszError = nullptr;
             }
-            else
+            else
+            {
+                const char *pszVal = nullptr;
+                if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
+                    pszVal =
+                        poSrcFeature->GetFieldAsString(psColDef->field_index);
+                pszError = swq_select_summarize(psSelectInfo, iField, pszVal);
+            }
+
+            if (pszError != nullptr)
+            {
+                m_poSummaryFeature.reset();
+
+                m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(
+                    bSaveIsGeomIgnored);
+
+                CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+                return false;
+            }
+        }
+    }
+
+    m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+
+    /* -------------------------------------------------------------------- */
+    /*      Clear away the filters we have installed till a next run through*/
+    /*      the features.                                                   */
+    /* -------------------------------------------------------------------- */
+    ClearFilters();
+
+    /* -------------------------------------------------------------------- */
+    /*      Now apply the values to the summary feature.  If we are in      */
+    /*      DISTINCT_LIST mode we don't do this step.                       */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD)
+    {
+        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        {
+            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+            if (!psSelectInfo->column_summary.empty())
+            {
+                const swq_summary &oSummary =
+                    psSelectInfo->column_summary[iField];
+                if (psColDef->col_func == SWQCF_COUNT)
+                {
+                    if (CPL_INT64_FITS_ON_INT32(oSummary.count))
+                    {
+                        m_poSummaryFeature.reset();
+                        m_poDefn->GetFieldDefn(iField)->SetType(OFTInteger);
+                    }
+                }
+            }
+        }
+
+        if (!m_poSummaryFeature)
+        {
+            m_poSummaryFeature = std::make_unique<OGRFeature>(m_poDefn);
+            m_poSummaryFeature->SetFID(0);
+        }
+
+        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        {
+            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+            if (!psSelectInfo->column_summary.empty())
+            {
+                const swq_summary &oSummary =
+                    psSelectInfo->column_summary[iField];
+
+                if (psColDef->col_func == SWQCF_AVG && oSummary.count > 0)
+                {
+                    if (psColDef->field_type == SWQ_DATE ||
+                        psColDef->field_type == SWQ_TIME ||
+                        psColDef->field_type == SWQ_TIMESTAMP)
+                    {
+                        struct tm brokendowntime;
+                        double dfAvg = oSummary.sum / oSummary.count;
+                        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
+                                            &brokendowntime);
+                        m_poSummaryFeature->SetField(
+                            iField, brokendowntime.tm_year + 1900,
+                            brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
+                            brokendowntime.tm_hour, brokendowntime.tm_min,
+                            static_cast<float>(brokendowntime.tm_sec +
+                                               fmod(dfAvg, 1)),
+                            0);
+                    }
+                    else
+                        m_poSummaryFeature->SetField(
+                            iField, oSummary.sum / oSummary.count);
+                }
+                else if (psColDef->col_func == SWQCF_MIN && oSummary.count > 0)
+                {
+                    if (psColDef->field_type == SWQ_DATE ||
+                        psColDef->field_type == SWQ_TIME ||
+                        psColDef->field_type == SWQ_TIMESTAMP ||
+                        psColDef->field_type == SWQ_STRING)
+                        m_poSummaryFeature->SetField(iField,
+                                                     oSummary.osMin.c_str());
+                    else
+                        m_poSummaryFeature->SetField(iField, oSummary.min);
+                }
+                else if (psColDef->col_func == SWQCF_MAX && oSummary.count > 0)
+                {
+                    if (psColDef->field_type == SWQ_DATE ||
+                        psColDef->field_type == SWQ_TIME ||
+                        psColDef->field_type == SWQ_TIMESTAMP ||
+                        psColDef->field_type == SWQ_STRING)
+                        m_poSummaryFeature->SetField(iField,
+                                                     oSummary.osMax.c_str());
+                    else
+                        m_poSummaryFeature->SetField(iField, oSummary.max);
+                }
+                else if (psColDef->col_func == SWQCF_COUNT)
+                    m_poSummaryFeature->SetField(iField, oSummary.count);
+                else if (psColDef->col_func == SWQCF_SUM && oSummary.count > 0)
+                    m_poSummaryFeature->SetField(iField, oSummary.sum);
+            }
+            else if (psColDef->col_func == SWQCF_COUNT)
+                m_poSummaryFeature->SetField(iField, 0);
+        }
+    }
+
+    return TRUE;
+}
+
+/************************************************************************/
+/*                         SetGroupByKeyField()                         */
+/************************************************************************/
+
+static void SetGroupByKeyField(OGRFeature *poFeature, int iField,
+                               const OGRGenSQLGroupBy::KeyField &oKeyField,
+                               const OGRGenSQLGroupBy::KeyValue &oValue)
+{
+    if (oValue.bNull)
+    {
+        poFeature->SetFieldNull(iField);
+        return;
+    }
+    switch (oKeyField.eType)
+    {
+        case OGRGenSQLGroupBy::KeyType::INTEGER:
+            poFeature->SetField(iField, oValue.nValue);
+            break;
+        case OGRGenSQLGroupBy::KeyType::REAL:
+            poFeature->SetField(iField, oValue.dfValue);
+            break;
+        case OGRGenSQLGroupBy::KeyType::STRING:
+            poFeature->SetField(iField, oValue.osValue.c_str());
+            break;
+    }
+}
+
+/************************************************************************/
+/*                      SetGroupByAggregateField()                      */
+/*                                                                      */
+/*      Same logic as for the summary record in PrepareSummary().       */
+/************************************************************************/
+
+static void
+SetGroupByAggregateField(OGRFeature *poFeature, int iField,
+                         const OGRGenSQLGroupBy::Aggregate &oAgg,
+                         const OGRGenSQLGroupBy::State &oState)
+{
+    if (oAgg.eFunc == SWQCF_COUNT)
+    {
+        poFeature->SetField(iField, oState.nCount);
+        return;
+    }
+    if (oState.nCount == 0)
+        return;
+
+    if (oAgg.eFunc == SWQCF_AVG)
+    {
+        const double dfAvg = oState.dfValue / oState.nCount;
+        if (oAgg.eFieldType == SWQ_DATE || oAgg.eFieldType == SWQ_TIME ||
+            oAgg.eFieldType == SWQ_TIMESTAMP)
+        {
+            struct tm brokendowntime;
+            CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg), &brokendowntime);
+            poFeature->SetField(
+                iField, brokendowntime.tm_year + 1900,
+                brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
+                brokendowntime.tm_hour, brokendowntime.tm_min,
+                static_cast<float>(brokendowntime.tm_sec + fmod(dfAvg, 1)), 0);
+        }
+        else
+        {
+            poFeature->SetField(iField, dfAvg);
+        }
+    }
+    else if (OGRGenSQLGroupBy::IsStringAggregate(oAgg))
+    {
+        poFeature->SetField(iField, oState.osValue.c_str());
+    }
+    else
+    {
+        poFeature->SetField(iField, oState.dfValue);
+    }
+}
+
+/************************************************************************/
+/*                            InitGroupBy()                             */
+/*                                                                      */
+/*      Set up the GROUP BY keys and column functions, and compile the  */
+/*      HAVING clause against a feature definition made of them.        */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::InitGroupBy()
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    OGRFeatureDefn *poSrcDefn = m_poSrcLayer->GetLayerDefn();
+
+    /* -------------------------------------------------------------------- */
+    /*      ORDER BY fields come first in keys, so that sorting keys        */
+    /*      gives the requested order.                                      */
+    /* -------------------------------------------------------------------- */
+    std::vector<OGRGenSQLGroupBy::KeyField> aoKeyFields;
+    const auto AddKeyField = [this, poSrcDefn, &aoKeyFields](int iField,
+                                                            bool bDescending)
+    {
+        for (const auto &oKeyField : aoKeyFields)
+        {
+            if (oKeyField.iField == iField)
+                return;
+        }
+        OGRGenSQLGroupBy::KeyField oKeyField;
+        oKeyField.iField = iField;
+        oKeyField.bDescending = bDescending;
+        if (iField >= m_iFIDFieldIndex)
+        {
+            switch (SpecialFieldTypes[iField - m_iFIDFieldIndex])
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    oKeyField.eType = OGRGenSQLGroupBy::KeyType::INTEGER;
+                    break;
+                case SWQ_FLOAT:
+                    oKeyField.eType = OGRGenSQLGroupBy::KeyType::REAL;
+                    break;
+                default:
+                    oKeyField.eType = OGRGenSQLGroupBy::KeyType::STRING;
+                    break;
+            }
+        }
+        else
+        {
+            switch (poSrcDefn->GetFieldDefn(iField)->GetType())
+            {
+                case OFTInteger:
+                case OFTInteger64:
+                    oKeyField.eType = OGRGenSQLGroupBy::KeyType::INTEGER;
+                    break;
+                case OFTReal:
+                    oKeyField.eType = OGRGenSQLGroupBy::KeyType::REAL;
+                    break;
+                default:
+                    oKeyField.eType = OGRGenSQLGroupBy::KeyType::STRING;
+                    break;
+            }
+        }
+        aoKeyFields.push_back(oKeyField);
+    };
+    for (int i = 0; i < psSelectInfo->order_specs; i++)
+    {
+        AddKeyField(psSelectInfo->order_defs[i].field_index,
+                    !psSelectInfo->order_defs[i].ascending_flag);
+    }
+    for (int i = 0; i < psSelectInfo->group_by_specs; i++)
+    {
+        AddKeyField(psSelectInfo->group_by_defs[i].field_index, false);
+    }
+    const auto GetKeyIndex = [&aoKeyFields](int iField)
+    {
+        for (int i = 0; i < static_cast<int>(aoKeyFields.size()); i++)
+        {
+            if (aoKeyFields[i].iField == iField)
+                return i;
+        }
+        CPLAssert(false);
+        return 0;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Column functions of the result columns and HAVING clause.       */
+    /* -------------------------------------------------------------------- */
+    std::vector<OGRGenSQLGroupBy::Aggregate> aoAggregates;
+    const auto GetAggregateIndex =
+        [poSrcDefn, &aoAggregates](swq_col_func eFunc, int iField,
+                                   swq_field_type eFieldType)
+    {
+        OGRGenSQLGroupBy::Aggregate oAgg;
+        oAgg.eFunc = eFunc;
+        oAgg.eFieldType = eFieldType;
+        if (iField >= 0 && IS_GEOM_FIELD_INDEX(poSrcDefn, iField))
+            oAgg.iGeomField =
+                ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(poSrcDefn, iField);
+        else
+            oAgg.iField = iField;
+        for (int i = 0; i < static_cast<int>(aoAggregates.size()); i++)
+        {
+            if (aoAggregates[i].eFunc == oAgg.eFunc &&
+                aoAggregates[i].iField == oAgg.iField &&
+                aoAggregates[i].iGeomField == oAgg.iGeomField)
+                return i;
+        }
+        aoAggregates.push_back(oAgg);
+        return static_cast<int>(aoAggregates.size()) - 1;
+    };
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (psColDef->bHidden)
+            continue;
+        if (psColDef->col_func == SWQCF_NONE)
+        {
+            // Either a GROUP BY field, or a CAST of it.
+            const int iSrcField =
+                psColDef->expr->eNodeType == SNT_COLUMN
+                    ? psColDef->field_index
+                    : psColDef->expr->papoSubExpr[0]->field_index;
+            m_aoGroupByOutputFields.emplace_back(true, GetKeyIndex(iSrcField));
+        }
+        else
+        {
+            m_aoGroupByOutputFields.emplace_back(
+                false, GetAggregateIndex(psColDef->col_func,
+                                         psColDef->field_index,
+                                         psColDef->field_type));
+        }
+    }
+
+    if (psSelectInfo->having_expr != nullptr)
+    {
+        // Replace column functions and GROUP BY fields by references to
+        // the fields of m_poHavingDefn.
+        std::unique_ptr<swq_expr_node> poHaving(
+            psSelectInfo->having_expr->Clone());
+        std::function<void(swq_expr_node *&)> Rewrite;
+        Rewrite = [&Rewrite, &GetKeyIndex,
+                   &GetAggregateIndex](swq_expr_node *&poNode)
+        {
+            if (poNode->eNodeType == SNT_OPERATION &&
+                poNode->nOperation >= SWQ_AVG && poNode->nOperation <= SWQ_SUM)
+            {
+                const swq_expr_node *poArg = poNode->papoSubExpr[0];
+                const int iAgg = GetAggregateIndex(
+                    static_cast<swq_col_func>(poNode->nOperation),
+                    poArg->field_index, poArg->field_type);
+                auto poColumn = new swq_expr_node();
+                poColumn->eNodeType = SNT_COLUMN;
+                poColumn->string_value =
+                    CPLStrdup(CPLSPrintf("agg_%d", iAgg));
+                poColumn->table_index = -1;
+                poColumn->field_index = -1;
+                delete poNode;
+                poNode = poColumn;
+            }
+            else if (poNode->eNodeType == SNT_OPERATION)
             {
-                const char *pszVal = nullptr;
-                if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
-                    pszVal =
-                        poSrcFeature->GetFieldAsString(psColDef->field_index);
-                pszError = swq_select_summarize(psSelectInfo, iField, pszVal);
+                for (int i = 0; i < poNode->nSubExprCount; i++)
+                    Rewrite(poNode->papoSubExpr[i]);
             }
-
-            if (pszError != nullptr)
+            else if (poNode->eNodeType == SNT_COLUMN)
             {
-                m_poSummaryFeature.reset();
-
-                m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(
-                    bSaveIsGeomIgnored);
-
-                CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
-                return false;
+                const int iKey = GetKeyIndex(poNode->field_index);
+                CPLFree(poNode->table_name);
+                poNode->table_name = nullptr;
+                CPLFree(poNode->string_value);
+                poNode->string_value = CPLStrdup(CPLSPrintf("key_%d", iKey));
+                poNode->table_index = -1;
+                poNode->field_index = -1;
+            }
+        };
+        swq_expr_node *poHavingRaw = poHaving.release();
+        Rewrite(poHavingRaw);
+        poHaving.reset(poHavingRaw);
+
+        m_poHavingDefn = new OGRFeatureDefn("having");
+        m_poHavingDefn->Reference();
+        m_poHavingDefn->SetGeomType(wkbNone);
+        for (int i = 0; i < static_cast<int>(aoKeyFields.size()); i++)
+        {
+            OGRFieldType eType = OFTString;
+            const int iSrcField = aoKeyFields[i].iField;
+            if (aoKeyFields[i].eType == OGRGenSQLGroupBy::KeyType::INTEGER)
+                eType = OFTInteger64;
+            else if (aoKeyFields[i].eType == OGRGenSQLGroupBy::KeyType::REAL)
+                eType = OFTReal;
+            else if (iSrcField < m_iFIDFieldIndex)
+            {
+                const OGRFieldType eSrcType =
+                    poSrcDefn->GetFieldDefn(iSrcField)->GetType();
+                if (eSrcType == OFTDate || eSrcType == OFTTime ||
+                    eSrcType == OFTDateTime)
+                    eType = eSrcType;
+            }
+            OGRFieldDefn oFieldDefn(CPLSPrintf("key_%d", i), eType);
+            m_poHavingDefn->AddFieldDefn(&oFieldDefn);
+        }
+        for (int i = 0; i < static_cast<int>(aoAggregates.size()); i++)
+        {
+            const auto &oAgg = aoAggregates[i];
+            const bool bIsDate = oAgg.eFieldType == SWQ_DATE ||
+                                 oAgg.eFieldType == SWQ_TIME ||
+                                 oAgg.eFieldType == SWQ_TIMESTAMP;
+            OGRFieldType eType = OFTReal;
+            if (oAgg.eFunc == SWQCF_COUNT)
+                eType = OFTInteger64;
+            else if (oAgg.eFunc == SWQCF_AVG && bIsDate)
+                eType = OFTDateTime;
+            else if (OGRGenSQLGroupBy::IsStringAggregate(oAgg))
+            {
+                eType = oAgg.eFieldType == SWQ_DATE   ? OFTDate
+                        : oAgg.eFieldType == SWQ_TIME ? OFTTime
+                        : oAgg.eFieldType == SWQ_TIMESTAMP ? OFTDateTime
+                                                           : OFTString;
             }
+            OGRFieldDefn oFieldDefn(CPLSPrintf("agg_%d", i), eType);
+            m_poHavingDefn->AddFieldDefn(&oFieldDefn);
+        }
+
+        char *pszHaving = poHaving->Unparse(nullptr, '"');
+        m_poHavingQuery = std::make_unique<OGRFeatureQuery>();
+        const OGRErr eErr = m_poHavingQuery->Compile(m_poHavingDefn, pszHaving);
+        CPLFree(pszHaving);
+        if (eErr != OGRERR_NONE)
+        {
+            m_poHavingQuery.reset();
+            return false;
         }
     }
 
-    m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+    m_poGroupBy = std::make_unique<OGRGenSQLGroupBy>(
+        aoKeyFields, aoAggregates,
+        GetMaxRAMUsageAllowed("OGR_SQL_MAX_RAM_USAGE_GROUP_BY"),
+        psSelectInfo->order_specs > 0);
+    return true;
+}
 
-    /* -------------------------------------------------------------------- */
-    /*      Clear away the filters we have installed till a next run through*/
-    /*      the features.                                                   */
-    /* -------------------------------------------------------------------- */
-    ClearFilters();
+/************************************************************************/
+/*                           PrepareGroupBy()                           */
+/*                                                                      */
+/*      Aggregate all source features into groups, and store the        */
+/*      groups that pass the HAVING clause.                             */
+/************************************************************************/
 
-    /* -------------------------------------------------------------------- */
-    /*      Now apply the values to the summary feature.  If we are in      */
-    /*      DISTINCT_LIST mode we don't do this step.                       */
-    /* -------------------------------------------------------------------- */
-    if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD)
+bool OGRGenSQLResultsLayer::PrepareGroupBy()
+{
+    if (m_bGroupByPrepared)
+        return m_poGroupByRecords != nullptr;
+    m_bGroupByPrepared = true;
+
+    if (!InitGroupBy())
+        return false;
+
+    ApplyFiltersToSource();
+
+    const int bSaveIsGeomIgnored =
+        m_poSrcLayer->GetLayerDefn()->IsGeometryIgnored();
+    if (!SummaryNeedsGeometry())
+        m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(TRUE);
+
+    bool bRet = true;
+    for (auto &&poSrcFeature : *m_poSrcLayer)
     {
-        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        if (!m_poGroupBy->AddFeature(poSrcFeature.get()))
         {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-            if (!psSelectInfo->column_summary.empty())
-            {
-                const swq_summary &oSummary =
-                    psSelectInfo->column_summary[iField];
-                if (psColDef->col_func == SWQCF_COUNT)
-                {
-                    if (CPL_INT64_FITS_ON_INT32(oSummary.count))
-                    {
-                        m_poSummaryFeature.reset();
-                        m_poDefn->GetFieldDefn(iField)->SetType(OFTInteger);
-                    }
-                }
-            }
+            bRet = false;
+            break;
         }
+    }
 
-        if (!m_poSummaryFeature)
-        {
-            m_poSummaryFeature = std::make_unique<OGRFeature>(m_poDefn);
-            m_poSummaryFeature->SetFID(0);
-        }
+    m_poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+    ClearFilters();
 
-        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    if (!bRet)
+        return false;
+
+    auto poRecords = std::make_unique<OGRGenSQLRecordStore>(
+        GetMaxRAMUsageAllowed("OGR_SQL_MAX_RAM_USAGE_GROUP_BY"));
+    const auto &aoKeyFields = m_poGroupBy->GetKeyFields();
+    const auto &aoAggregates = m_poGroupBy->GetAggregates();
+    std::vector<OGRGenSQLGroupBy::KeyValue> aoKeyValues;
+    std::vector<OGRGenSQLGroupBy::State> aoStates;
+    bRet = m_poGroupBy->Finish(
+        [this, &poRecords, &aoKeyFields, &aoAggregates, &aoKeyValues,
+         &aoStates](const std::string &osRecord)
         {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-            if (!psSelectInfo->column_summary.empty())
+            if (m_poHavingQuery)
             {
-                const swq_summary &oSummary =
-                    psSelectInfo->column_summary[iField];
-
-                if (psColDef->col_func == SWQCF_AVG && oSummary.count > 0)
-                {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP)
-                    {
-                        struct tm brokendowntime;
-                        double dfAvg = oSummary.sum / oSummary.count;
-                        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
-                                            &brokendowntime);
-                        m_poSummaryFeature->SetField(
-                            iField, brokendowntime.tm_year + 1900,
-                            brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
-                            brokendowntime.tm_hour, brokendowntime.tm_min,
-                            static_cast<float>(brokendowntime.tm_sec +
-                                               fmod(dfAvg, 1)),
-                            0);
-                    }
-                    else
-                        m_poSummaryFeature->SetField(
-                            iField, oSummary.sum / oSummary.count);
-                }
-                else if (psColDef->col_func == SWQCF_MIN && oSummary.count > 0)
+                if (!m_poGroupBy->DecodeRecord(osRecord, aoKeyValues,
+                                               aoStates))
+                    return false;
+                OGRFeature oFeature(m_poHavingDefn);
+                const int nKeyCount = static_cast<int>(aoKeyFields.size());
+                for (int i = 0; i < nKeyCount; i++)
                 {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP ||
-                        psColDef->field_type == SWQ_STRING)
-                        m_poSummaryFeature->SetField(iField,
-                                                     oSummary.osMin.c_str());
-                    else
-                        m_poSummaryFeature->SetField(iField, oSummary.min);
+                    SetGroupByKeyField(&oFeature, i, aoKeyFields[i],
+                                       aoKeyValues[i]);
                 }
-                else if (psColDef->col_func == SWQCF_MAX && oSummary.count > 0)
+                for (int i = 0; i < static_cast<int>(aoAggregates.size()); i++)
                 {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP ||
-                        psColDef->field_type == SWQ_STRING)
-                        m_poSummaryFeature->SetField(iField,
-                                                     oSummary.osMax.c_str());
-                    else
-                        m_poSummaryFeature->SetField(iField, oSummary.max);
+                    SetGroupByAggregateField(&oFeature, nKeyCount + i,
+                                             aoAggregates[i], aoStates[i]);
                 }
-                else if (psColDef->col_func == SWQCF_COUNT)
-                    m_poSummaryFeature->SetField(iField, oSummary.count);
-                else if (psColDef->col_func == SWQCF_SUM && oSummary.count > 0)
-                    m_poSummaryFeature->SetField(iField, oSummary.sum);
+                if (!m_poHavingQuery->Evaluate(&oFeature))
+                    return true;
             }
-            else if (psColDef->col_func == SWQCF_COUNT)
-                m_poSummaryFeature->SetField(iField, 0);
+            return poRecords->Add(osRecord);
+        });
+    if (!bRet)
+        return false;
+
+    m_poGroupByRecords = std::move(poRecords);
+    return true;
+}
+
+/************************************************************************/
+/*                         GetGroupByFeature()                          */
+/************************************************************************/
+
+OGRFeature *OGRGenSQLResultsLayer::GetGroupByFeature(GIntBig nFID)
+{
+    if (!PrepareGroupBy() || nFID < 0 ||
+        static_cast<GUIntBig>(nFID) >= m_poGroupByRecords->size())
+        return nullptr;
+
+    std::string osRecord;
+    std::vector<OGRGenSQLGroupBy::KeyValue> aoKeyValues;
+    std::vector<OGRGenSQLGroupBy::State> aoStates;
+    if (!m_poGroupByRecords->Get(static_cast<size_t>(nFID), osRecord) ||
+        !m_poGroupBy->DecodeRecord(osRecord, aoKeyValues, aoStates))
+        return nullptr;
+
+    const auto &aoKeyFields = m_poGroupBy->GetKeyFields();
+    const auto &aoAggregates = m_poGroupBy->GetAggregates();
+    auto poFeature = std::make_unique<OGRFeature>(m_poDefn);
+    for (int iField = 0;
+         iField < static_cast<int>(m_aoGroupByOutputFields.size()); iField++)
+    {
+        const int iIdx = m_aoGroupByOutputFields[iField].second;
+        if (m_aoGroupByOutputFields[iField].first)
+        {
+            SetGroupByKeyField(poFeature.get(), iField, aoKeyFields[iIdx],
+                               aoKeyValues[iIdx]);
+        }
+        else
+        {
+            SetGroupByAggregateField(poFeature.get(), iField,
+                                     aoAggregates[iIdx], aoStates[iIdx]);
         }
     }
+    poFeature->SetFID(nFID);
 
-    return TRUE;
+    return poFeature.release();
 }
 
 /************************************************************************/
@@ -1060,13 +3218,13 @@ bool OGRGenSQLResultsLayer::PrepareSummary()
 /************************************************************************/
 
 typedef std::vector<std::unique_ptr<OGRFeature>> VectorOfUniquePtrFeature;
+typedef std::vector<OGRFeature *> VectorOfFeaturePtr;
 
 static swq_expr_node *OGRMultiFeatureFetcher(swq_expr_node *op,
                                              void *pFeatureList)
 
 {
-    auto &apoFeatures =
-        *(static_cast<VectorOfUniquePtrFeature *>(pFeatureList));
+    auto &apoFeatures = *(static_cast<VectorOfFeaturePtr *>(pFeatureList));
     swq_expr_node *poRetNode = nullptr;
 
     CPLAssert(op->eNodeType == SNT_COLUMN);
@@ -1083,7 +3241,7 @@ static swq_expr_node *OGRMultiFeatureFetcher(swq_expr_node *op,
         return nullptr;
     }
 
-    OGRFeature *poFeature = apoFeatures[op->table_index].get();
+    OGRFeature *poFeature = apoFeatures[op->table_index];
 
     /* -------------------------------------------------------------------- */
     /*      Fetch the value.                                                */
@@ -1318,6 +3476,33 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                          GetJoinHashTable()                          */
+/************************************************************************/
+
+OGRGenSQLJoinHashTable *OGRGenSQLResultsLayer::GetJoinHashTable(int iJoin)
+{
+    if (m_abJoinHashTableTried[iJoin])
+        return m_apoJoinHashTables[iJoin].get();
+    m_abJoinHashTableTried[iJoin] = true;
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")))
+        return nullptr;
+
+    const swq_join_def *psJoinInfo = m_pSelectInfo->join_defs + iJoin;
+    OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+
+    // Iterating over the secondary layer would disturb the reading of the
+    // primary one.
+    if (poJoinLayer == m_poSrcLayer)
+        return nullptr;
+
+    m_apoJoinHashTables[iJoin] = OGRGenSQLJoinHashTable::Build(
+        psJoinInfo, m_poSrcLayer, poJoinLayer,
+        GetMaxRAMUsageAllowed("OGR_SQL_MAX_RAM_USAGE_HASH_JOIN"));
+    return m_apoJoinHashTables[iJoin].get();
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1327,15 +3512,20 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
 
 {
     swq_select *psSelectInfo = m_pSelectInfo.get();
-    VectorOfUniquePtrFeature apoFeatures;
 
     if (poSrcFeatUniquePtr == nullptr)
         return nullptr;
 
     m_nFeaturesRead++;
 
-    apoFeatures.push_back(std::move(poSrcFeatUniquePtr));
-    auto poSrcFeat = apoFeatures.front().get();
+    // Primary feature followed by the joined ones (or nullptr). Joined
+    // features coming from a hash table are owned by it, the other ones by
+    // apoJoinFeaturesHolder.
+    VectorOfFeaturePtr apoFeatures;
+    VectorOfUniquePtrFeature apoJoinFeaturesHolder;
+
+    auto poSrcFeat = poSrcFeatUniquePtr.get();
+    apoFeatures.push_back(poSrcFeat);
 
     /* -------------------------------------------------------------------- */
     /*      Fetch the corresponding features from any jointed tables.       */
@@ -1349,6 +3539,12 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        if (const auto poHashTable = GetJoinHashTable(iJoin))
+        {
+            apoFeatures.push_back(poHashTable->GetMatchingFeature(poSrcFeat));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
@@ -1369,7 +3565,8 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         if (poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
             poJoinFeature.reset(poJoinLayer->GetNextFeature());
 
-        apoFeatures.push_back(std::move(poJoinFeature));
+        apoFeatures.push_back(poJoinFeature.get());
+        apoJoinFeaturesHolder.push_back(std::move(poJoinFeature));
     }
 
     /* -------------------------------------------------------------------- */
@@ -1656,7 +3853,7 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
     for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
     {
         const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
-        const OGRFeature *poJoinFeature = apoFeatures[iJoin + 1].get();
+        const OGRFeature *poJoinFeature = apoFeatures[iJoin + 1];
 
         if (poJoinFeature == nullptr)
             continue;
@@ -1705,8 +3902,9 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return nullptr;
 
     CreateOrderByIndex();
-    if (m_anFIDIndex.empty() && m_nIteratedFeatures < 0 &&
-        psSelectInfo->offset > 0 && psSelectInfo->query_mode == SWQM_RECORDSET)
+    if (m_anFIDIndex.empty() && !m_poOrderBySorter &&
+        m_nIteratedFeatures < 0 && psSelectInfo->offset > 0 &&
+        psSelectInfo->query_mode == SWQM_RECORDSET)
     {
         m_poSrcLayer->SetNextByIndex(psSelectInfo->offset);
     }
@@ -1717,7 +3915,8 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
     /*      Handle summary sets.                                            */
     /* -------------------------------------------------------------------- */
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST)
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+        psSelectInfo->query_mode == SWQM_GROUP_BY)
     {
         m_nIteratedFeatures++;
         return GetFeature(m_nNextIndexFID++);
@@ -1731,7 +3930,14 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
     while (true)
     {
         std::unique_ptr<OGRFeature> poSrcFeat;
-        if (!m_anFIDIndex.empty())
+        if (m_poOrderBySorter)
+        {
+            poSrcFeat = m_poOrderBySorter->GetFeature(
+                static_cast<size_t>(m_nNextIndexFID),
+                m_poSrcLayer->GetLayerDefn());
+            m_nNextIndexFID++;
+        }
+        else if (!m_anFIDIndex.empty())
         {
             /* --------------------------------------------------------------------
              */
@@ -1795,6 +4001,12 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
             return m_poSummaryFeature->Clone();
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle request for a group of a GROUP BY query.                 */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+        return GetGroupByFeature(nFID);
+
     /* -------------------------------------------------------------------- */
     /*      Handle request for distinct list record.                        */
     /* -------------------------------------------------------------------- */
@@ -2040,7 +4252,10 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*      required index.                                                 */
 /*                                                                      */
 /*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      very large input datasets, and fetching features by FID is      */
+/*      slow for some drivers. So if the source layer has no efficient  */
+/*      random read, or if the key values exceed the RAM budget, the    */
+/*      features themselves are sorted by CreateOrderBySorter().        */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2057,6 +4272,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     m_bOrderByValid = true;
     m_anFIDIndex.clear();
+    m_poOrderBySorter.reset();
 
     ResetReading();
 
@@ -2100,6 +4316,14 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
     }
 
+    const size_t nMaxRAMUsage =
+        GetMaxRAMUsageAllowed("OGR_SQL_MAX_RAM_USAGE_ORDER_BY");
+    if (!m_poSrcLayer->TestCapability(OLCRandomRead))
+    {
+        CreateOrderBySorter(nMaxRAMUsage);
+        return;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate set of key values, and the output index.               */
     /* -------------------------------------------------------------------- */
@@ -2136,10 +4360,24 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nIndexSize);
 
+    std::vector<bool> abIsStringKey;
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    {
+        const int iField = psSelectInfo->order_defs[iKey].field_index;
+        abIsStringKey.push_back(
+            iField >= m_iFIDFieldIndex
+                ? SpecialFieldTypes[iField - m_iFIDFieldIndex] == SWQ_STRING
+                : m_poSrcLayer->GetLayerDefn()
+                          ->GetFieldDefn(iField)
+                          ->GetType() == OFTString);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
 
+    size_t nRAMUsage = 0;
+    bool bExceedsRAMUsage = false;
     for (auto &&poSrcFeat : *m_poSrcLayer)
     {
         if (nIndexSize == nFeaturesAlloc)
@@ -2186,7 +4424,40 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
         anFIDList.push_back(poSrcFeat->GetFID());
 
+        const OGRField *pasRow =
+            asIndexFields.data() + nIndexSize * nOrderItems;
+        nRAMUsage += sizeof(OGRField) * nOrderItems + 2 * sizeof(GIntBig);
+        for (int iKey = 0; iKey < nOrderItems; iKey++)
+        {
+            if (abIsStringKey[iKey] && !OGR_RawField_IsUnset(&pasRow[iKey]) &&
+                !OGR_RawField_IsNull(&pasRow[iKey]))
+            {
+                nRAMUsage += strlen(pasRow[iKey].String) + 1;
+            }
+        }
+
         nIndexSize++;
+
+        if (nRAMUsage > nMaxRAMUsage)
+        {
+            bExceedsRAMUsage = true;
+            break;
+        }
+    }
+
+    if (bExceedsRAMUsage)
+    {
+        CPLDebug("GenSQL",
+                 "ORDER BY: switching to external sort, as "
+                 "OGR_SQL_MAX_RAM_USAGE_ORDER_BY = " CPL_FRMT_GUIB
+                 " is exceeded",
+                 static_cast<GUIntBig>(nMaxRAMUsage));
+        FreeIndexFields(asIndexFields.data(), nIndexSize);
+        nIndexSize = 0;
+        asIndexFields.clear();
+        anFIDList.clear();
+        CreateOrderBySorter(nMaxRAMUsage);
+        return;
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
@@ -2247,6 +4518,131 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     ResetReading();
 }
 
+/************************************************************************/
+/*                         CreateOrderBySorter()                        */
+/*                                                                      */
+/*      Sort the source features with an external merge sort, so that  */
+/*      GetNextFeature() can stream them without random access.         */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::CreateOrderBySorter(size_t nMaxRAMUsage)
+
+{
+    auto poSorter = std::make_unique<OGRGenSQLFeatureSorter>(nMaxRAMUsage);
+    std::string osKey;
+    for (auto &&poSrcFeat : *m_poSrcLayer)
+    {
+        ComputeOrderByKey(poSrcFeat.get(), osKey);
+        if (!poSorter->Add(osKey, poSrcFeat.get()))
+            return;
+    }
+    if (!poSorter->Finish())
+        return;
+
+    /* If it is already sorted, then read the source layer sequentially */
+    if (!poSorter->IsAlreadySorted())
+        m_poOrderBySorter = std::move(poSorter);
+
+    ResetReading();
+}
+
+/************************************************************************/
+/*                         ComputeOrderByKey()                          */
+/*                                                                      */
+/*      Compute a key whose byte-wise comparison gives the same order   */
+/*      as Compare() on the values read by ReadIndexFields().           */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::ComputeOrderByKey(const OGRFeature *poSrcFeat,
+                                              std::string &osKey)
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+
+    osKey.clear();
+    for (int iKey = 0; iKey < psSelectInfo->order_specs; iKey++)
+    {
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        const int iField = psKeyDef->field_index;
+        const size_t nStart = osKey.size();
+
+        if (iField >= m_iFIDFieldIndex)
+        {
+            osKey += '\1';
+            switch (SpecialFieldTypes[iField - m_iFIDFieldIndex])
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    AppendSortableInteger(
+                        osKey, poSrcFeat->GetFieldAsInteger64(iField));
+                    break;
+
+                case SWQ_FLOAT:
+                    AppendSortableReal(osKey,
+                                       poSrcFeat->GetFieldAsDouble(iField));
+                    break;
+
+                default:
+                    osKey += poSrcFeat->GetFieldAsString(iField);
+                    osKey += '\0';
+                    break;
+            }
+        }
+        else if (!poSrcFeat->IsFieldSetAndNotNull(iField))
+        {
+            // Null values come first, as in Compare()
+            osKey += '\0';
+        }
+        else
+        {
+            osKey += '\1';
+            const OGRField *psField = poSrcFeat->GetRawFieldRef(iField);
+            switch (poSrcFeat->GetFieldDefnRef(iField)->GetType())
+            {
+                case OFTInteger:
+                    AppendSortableInteger(osKey, psField->Integer);
+                    break;
+
+                case OFTInteger64:
+                    AppendSortableInteger(osKey, psField->Integer64);
+                    break;
+
+                case OFTReal:
+                    AppendSortableReal(osKey, psField->Real);
+                    break;
+
+                case OFTString:
+                    // Nul terminated, so that byte-wise comparison of keys
+                    // is consistent with strcmp().
+                    osKey += psField->String;
+                    osKey += '\0';
+                    break;
+
+                case OFTDate:
+                case OFTTime:
+                case OFTDateTime:
+                    // Same order as OGRCompareDate()
+                    AppendSortableInteger(osKey, psField->Date.Year);
+                    osKey += static_cast<char>(psField->Date.Month);
+                    osKey += static_cast<char>(psField->Date.Day);
+                    osKey += static_cast<char>(psField->Date.Hour);
+                    osKey += static_cast<char>(psField->Date.Minute);
+                    AppendSortableReal(osKey, psField->Date.Second);
+                    break;
+
+                default:
+                    // Other types are not compared by Compare() either
+                    break;
+            }
+        }
+
+        if (!psKeyDef->ascending_flag)
+        {
+            for (size_t i = nStart; i < osKey.size(); ++i)
+                osKey[i] = static_cast<char>(~osKey[i]);
+        }
+    }
+}
+
 /************************************************************************/
 /*                          SortIndexSection()                          */
 /*                                                                      */
@@ -2489,6 +4885,16 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
                           hSet);
     }
 
+    for (int iGroup = 0; iGroup < psSelectInfo->group_by_specs; iGroup++)
+    {
+        swq_group_by_def *psGroupByDef = psSelectInfo->group_by_defs + iGroup;
+        AddFieldDefnToSet(psGroupByDef->table_index, psGroupByDef->field_index,
+                          hSet);
+    }
+
+    if (psSelectInfo->having_expr)
+        ExploreExprForIgnoredFields(psSelectInfo->having_expr, hSet);
+
     /* -------------------------------------------------------------------- */
     /*      2nd phase : now, we can exclude the unused fields               */
     /* -------------------------------------------------------------------- */
@@ -2525,6 +4931,7 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
 void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
 {
     m_anFIDIndex.clear();
+    m_poOrderBySorter.reset();
     m_bOrderByValid = false;
 }
 
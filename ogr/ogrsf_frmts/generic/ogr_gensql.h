@@ -36,6 +36,8 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -56,6 +58,10 @@
 /************************************************************************/
 
 class swq_select;
+class OGRGenSQLJoinHashTable;
+class OGRGenSQLGroupBy;
+class OGRGenSQLRecordStore;
+class OGRGenSQLFeatureSorter;
 
 class OGRGenSQLResultsLayer final : public OGRLayer
 {
@@ -80,6 +86,8 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     std::vector<int> m_anGeomFieldToSrcGeomField{};
 
     std::vector<GIntBig> m_anFIDIndex{};
+    // Used instead of m_anFIDIndex when sorting the features themselves.
+    std::unique_ptr<OGRGenSQLFeatureSorter> m_poOrderBySorter{};
     bool m_bOrderByValid = false;
 
     GIntBig m_nNextIndexFID = 0;
@@ -90,10 +98,33 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // Hash tables used to resolve JOINs, indexed by join number. A null
+    // entry means that the JOIN is resolved with attribute filters on the
+    // secondary layer.
+    std::vector<std::unique_ptr<OGRGenSQLJoinHashTable>> m_apoJoinHashTables{};
+    std::vector<bool> m_abJoinHashTableTried{};
+
+    // GROUP BY processing. Each output field is either a GROUP BY key
+    // (first = true) or a column function (first = false), given by its
+    // index in m_poGroupBy.
+    std::unique_ptr<OGRGenSQLGroupBy> m_poGroupBy{};
+    std::vector<std::pair<bool, int>> m_aoGroupByOutputFields{};
+    OGRFeatureDefn *m_poHavingDefn = nullptr;
+    std::unique_ptr<OGRFeatureQuery> m_poHavingQuery{};
+    std::unique_ptr<OGRGenSQLRecordStore> m_poGroupByRecords{};
+    bool m_bGroupByPrepared = false;
+
+    bool SummaryNeedsGeometry();
     bool PrepareSummary();
+    bool InitGroupBy();
+    bool PrepareGroupBy();
+    OGRFeature *GetGroupByFeature(GIntBig nFID);
+    OGRGenSQLJoinHashTable *GetJoinHashTable(int iJoin);
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
+    void CreateOrderBySorter(size_t nMaxRAMUsage);
+    void ComputeOrderByKey(const OGRFeature *poSrcFeat, std::string &osKey);
     void ReadIndexFields(OGRFeature *poSrcFeat, int nOrderItems,
                          OGRField *pasIndexFields);
     void SortIndexSection(const OGRField *pasIndexFields, GIntBig *panMerged,
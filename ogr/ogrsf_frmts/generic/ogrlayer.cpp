@@ -36,8 +36,15 @@
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
 
+#include "cpl_error_internal.h"
+#include "cpl_quad_tree.h"
 #include "cpl_time.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <functional>
 #include <limits>
 #include <set>
 
@@ -650,6 +657,37 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                        GetNextFeatureInto()                          */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature, possibly recycling an existing one.
+
+ This method is similar to GetNextFeature(), except that the caller may pass
+ in poFeature a feature previously returned by this layer, and that it does
+ not need anymore. Drivers that support it will then fill that feature with
+ the content of the next feature, instead of allocating a new one, which
+ saves the allocation of the feature, of its field array and, in some
+ drivers, of its geometry.
+
+ The default implementation just replaces poFeature with the result of
+ GetNextFeature().
+
+ @param poFeature On input, null or a feature to recycle. Features that do
+ not use the layer definition of this layer are just destroyed. On output,
+ the next feature, or null at the end of the layer or in case of error.
+ @return true if a feature is returned.
+
+ @since GDAL 3.10
+*/
+
+bool OGRLayer::GetNextFeatureInto(OGRFeatureUniquePtr &poFeature)
+{
+    poFeature.reset(GetNextFeature());
+    return poFeature != nullptr;
+}
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -1879,7 +1917,29 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
             {
                 return true;
             }
-            else if (OGRGeometryFactory::haveGEOS())
+
+            // Exact tests directly on the WKB geometry, for rectangular
+            // and point filters, when it has no circular arcs.
+            const auto eFilterType =
+                wkbFlatten(poFilterGeom->getGeometryType());
+            if (bFilterIsEnvelope ||
+                (eFilterType == wkbPoint && !poFilterGeom->IsEmpty()))
+            {
+                OGRWKBGeometryView oView;
+                bool bIntersects = false;
+                if (oView.Init(pabyWKB, nWKBSize) &&
+                    (bFilterIsEnvelope
+                         ? oView.IntersectsEnvelope(sFilterEnvelope,
+                                                    bIntersects)
+                         : oView.IntersectsPoint(
+                               poFilterGeom->toPoint()->getX(),
+                               poFilterGeom->toPoint()->getY(), bIntersects)))
+                {
+                    return bIntersects;
+                }
+            }
+
+            if (OGRGeometryFactory::haveGEOS())
             {
                 OGRGeometry *poGeom = nullptr;
                 int ret = FALSE;
@@ -2561,6 +2621,457 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
         return poGeom;
 }
 
+static int get_num_threads(CSLConstList papszOptions)
+{
+    return CPLParseNumThreads(
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", nullptr)),
+        1);
+}
+
+namespace
+{
+
+/************************************************************************/
+/*                         OGROverlayLayerIndex                         */
+/************************************************************************/
+
+// Returns the features of a layer that intersect the geometry of a feature
+// of the other layer of an overlay operation.
+//
+// By default, the features of the layer are loaded once in memory and
+// indexed with a quad tree, which can be queried from several threads, and
+// the candidates are tested against a prepared geometry of the query
+// geometry. With USE_SPATIAL_INDEX=NO, or if the features would use more RAM
+// than allowed by OGR_OVERLAY_MAX_RAM_USAGE, a spatial filter is set on the
+// layer for each query, and the layer is read again.
+class OGROverlayLayerIndex
+{
+    struct Item
+    {
+        OGRFeatureUniquePtr poFeature{};
+        OGREnvelope sEnvelope{};
+    };
+
+    OGRLayer *const m_poLayer;
+    // Spatial filter of m_poLayer before the operation
+    const OGRGeometry *const m_poLayerFilter;
+    bool m_bInMemory;
+    const bool m_bUsePreparedGeometries;
+    std::vector<Item> m_aoItems{};
+    CPLQuadTree *m_hQuadTree = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGROverlayLayerIndex)
+
+  public:
+    OGROverlayLayerIndex(OGRLayer *poLayer, const OGRGeometry *poLayerFilter,
+                         CSLConstList papszOptions)
+        : m_poLayer(poLayer), m_poLayerFilter(poLayerFilter),
+          m_bInMemory(CPLTestBool(CSLFetchNameValueDef(
+              papszOptions, "USE_SPATIAL_INDEX", "YES"))),
+          m_bUsePreparedGeometries(CPLTestBool(CSLFetchNameValueDef(
+              papszOptions, "USE_PREPARED_GEOMETRIES", "YES")))
+    {
+    }
+
+    ~OGROverlayLayerIndex()
+    {
+        if (m_hQuadTree)
+            CPLQuadTreeDestroy(m_hQuadTree);
+    }
+
+    bool IsThreadSafe() const
+    {
+        return m_bInMemory;
+    }
+
+    void Build();
+
+    const OGRGeometry *
+    GetIntersectingFeatures(const OGRFeature *poFeature,
+                            std::vector<const OGRFeature *> &apoFeatures,
+                            std::vector<OGRFeatureUniquePtr> &apoOwned);
+};
+
+/************************************************************************/
+/*                  OGROverlayLayerIndex::Build()                       */
+/************************************************************************/
+
+void OGROverlayLayerIndex::Build()
+{
+    if (!m_bInMemory || m_hQuadTree)
+        return;
+
+    uint64_t nMaxRAMUsage = CPLGetUsablePhysicalRAM() / 10;
+    if (nMaxRAMUsage == 0)
+        nMaxRAMUsage = 100 * 1024 * 1024;
+    const char *pszMaxRAMUsage =
+        CPLGetConfigOption("OGR_OVERLAY_MAX_RAM_USAGE", nullptr);
+    if (pszMaxRAMUsage)
+        nMaxRAMUsage = std::strtoull(pszMaxRAMUsage, nullptr, 10);
+    uint64_t nRAMUsage = 0;
+
+    // The layer still has its original spatial filter at that point.
+    OGREnvelope sGlobalEnvelope;
+    for (auto &&poFeature : m_poLayer)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        // A feature without geometry never passes a spatial filter
+        if (!poGeom || poGeom->IsEmpty())
+            continue;
+
+        // Rough estimate, dominated by the geometry.
+        nRAMUsage += sizeof(Item) + sizeof(OGRFeature) +
+                     poFeature->GetFieldCount() * sizeof(OGRField) +
+                     poGeom->WkbSize();
+        if (nRAMUsage > nMaxRAMUsage)
+        {
+            CPLDebug("OGR",
+                     "Not indexing layer %s in memory, since it would use "
+                     "more than OGR_OVERLAY_MAX_RAM_USAGE = " CPL_FRMT_GUIB
+                     " bytes",
+                     m_poLayer->GetName(),
+                     static_cast<GUIntBig>(nMaxRAMUsage));
+            m_aoItems.clear();
+            m_bInMemory = false;
+            return;
+        }
+
+        Item oItem;
+        poGeom->getEnvelope(&oItem.sEnvelope);
+        sGlobalEnvelope.Merge(oItem.sEnvelope);
+        oItem.poFeature = std::move(poFeature);
+        m_aoItems.push_back(std::move(oItem));
+    }
+
+    if (!sGlobalEnvelope.IsInit())
+    {
+        sGlobalEnvelope.MinX = 0;
+        sGlobalEnvelope.MinY = 0;
+        sGlobalEnvelope.MaxX = 0;
+        sGlobalEnvelope.MaxY = 0;
+    }
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sGlobalEnvelope.MinX;
+    sGlobalBounds.miny = sGlobalEnvelope.MinY;
+    sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+    sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+    m_hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    CPLQuadTreeSetMaxDepth(
+        m_hQuadTree,
+        CPLQuadTreeGetAdvisedMaxDepth(static_cast<int>(std::min<size_t>(
+            INT_MAX, m_aoItems.size()))));
+    for (auto &oItem : m_aoItems)
+    {
+        CPLRectObj sBounds;
+        sBounds.minx = oItem.sEnvelope.MinX;
+        sBounds.miny = oItem.sEnvelope.MinY;
+        sBounds.maxx = oItem.sEnvelope.MaxX;
+        sBounds.maxy = oItem.sEnvelope.MaxY;
+        CPLQuadTreeInsertWithBounds(m_hQuadTree, &oItem, &sBounds);
+    }
+}
+
+/************************************************************************/
+/*           OGROverlayLayerIndex::GetIntersectingFeatures()            */
+/************************************************************************/
+
+// Equivalent of set_filter_from() followed by an iteration over the layer.
+// Returns the geometry of poFeature, or nullptr if it has no geometry or
+// if it does not intersect the original spatial filter of the layer.
+// apoFeatures receives the features of the layer, in the layer order,
+// whose geometry intersects the one of poFeature.
+const OGRGeometry *OGROverlayLayerIndex::GetIntersectingFeatures(
+    const OGRFeature *poFeature, std::vector<const OGRFeature *> &apoFeatures,
+    std::vector<OGRFeatureUniquePtr> &apoOwned)
+{
+    apoFeatures.clear();
+    apoOwned.clear();
+
+    if (!m_bInMemory)
+    {
+        const OGRGeometry *geom = set_filter_from(
+            m_poLayer, const_cast<OGRGeometry *>(m_poLayerFilter),
+            const_cast<OGRFeature *>(poFeature));
+        if (!geom)
+            return nullptr;
+        for (auto &&y : m_poLayer)
+        {
+            if (y->GetGeometryRef())
+            {
+                apoFeatures.push_back(y.get());
+                apoOwned.push_back(std::move(y));
+            }
+        }
+        return geom;
+    }
+
+    const OGRGeometry *geom = poFeature->GetGeometryRef();
+    if (!geom)
+        return nullptr;
+    OGRGeometryUniquePtr poIntersection;
+    const OGRGeometry *poFilter = geom;
+    if (m_poLayerFilter)
+    {
+        if (!geom->Intersects(m_poLayerFilter))
+            return nullptr;
+        poIntersection.reset(geom->Intersection(m_poLayerFilter));
+        if (!poIntersection)
+            return nullptr;
+        poFilter = poIntersection.get();
+    }
+    if (poFilter->IsEmpty())
+        return geom;
+
+    OGREnvelope sFilterEnvelope;
+    poFilter->getEnvelope(&sFilterEnvelope);
+    CPLRectObj sAoi;
+    sAoi.minx = sFilterEnvelope.MinX;
+    sAoi.miny = sFilterEnvelope.MinY;
+    sAoi.maxx = sFilterEnvelope.MaxX;
+    sAoi.maxy = sFilterEnvelope.MaxY;
+    int nCount = 0;
+    Item **papsItems = reinterpret_cast<Item **>(
+        CPLQuadTreeSearch(m_hQuadTree, &sAoi, &nCount));
+    // Items are stored in layer order in m_aoItems
+    std::sort(papsItems, papsItems + nCount);
+
+    OGRPreparedGeometryUniquePtr poPreparedFilter;
+    if (m_bUsePreparedGeometries && nCount > 1)
+    {
+        poPreparedFilter.reset(
+            OGRCreatePreparedGeometry(OGRGeometry::ToHandle(
+                const_cast<OGRGeometry *>(poFilter))));
+    }
+    for (int i = 0; i < nCount; ++i)
+    {
+        const Item *psItem = papsItems[i];
+        if (!sFilterEnvelope.Intersects(psItem->sEnvelope))
+            continue;
+        OGRGeometry *y_geom = psItem->poFeature->GetGeometryRef();
+        const bool bIntersects =
+            poPreparedFilter
+                ? CPL_TO_BOOL(OGRPreparedGeometryIntersects(
+                      poPreparedFilter.get(), OGRGeometry::ToHandle(y_geom)))
+                : CPL_TO_BOOL(poFilter->Intersects(y_geom));
+        if (bIntersects)
+            apoFeatures.push_back(psItem->poFeature.get());
+    }
+    CPLFree(papsItems);
+    return geom;
+}
+
+/************************************************************************/
+/*                            OGROverlayTask                            */
+/************************************************************************/
+
+// Processing of one feature of the layer being iterated over by an overlay
+// operation.
+struct OGROverlayTask
+{
+    OGRFeatureUniquePtr poFeature{};
+    std::vector<OGRFeatureUniquePtr> apoResults{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    // Set to stop the operation once apoResults have been written, with
+    // eErr as the return code.
+    bool bStop = false;
+    OGRErr eErr = OGRERR_NONE;
+};
+
+using OGROverlayFunc = std::function<void(OGROverlayTask &)>;
+
+/************************************************************************/
+/*                      get_intersecting_features()                     */
+/************************************************************************/
+
+// Calls oIndex.GetIntersectingFeatures() on the feature of oTask, and
+// handles errors. Returns nullptr if the feature must be skipped, or if the
+// operation must be stopped, in which case oTask.bStop is set.
+static const OGRGeometry *
+get_intersecting_features(OGROverlayLayerIndex &oIndex, OGROverlayTask &oTask,
+                          bool bSkipFailures,
+                          std::vector<const OGRFeature *> &apoFeatures,
+                          std::vector<OGRFeatureUniquePtr> &apoOwned)
+{
+    CPLErrorReset();
+    const OGRGeometry *x_geom = oIndex.GetIntersectingFeatures(
+        oTask.poFeature.get(), apoFeatures, apoOwned);
+    if (CPLGetLastErrorType() != CE_None)
+    {
+        if (!bSkipFailures)
+        {
+            oTask.bStop = true;
+            oTask.eErr = OGRERR_FAILURE;
+            return nullptr;
+        }
+        CPLErrorReset();
+    }
+    return x_geom;
+}
+
+/************************************************************************/
+/*                           OGROverlayRunner                           */
+/************************************************************************/
+
+// Iterates over a layer, computes the result features of each feature,
+// possibly in worker threads, and writes them in the result layer in the
+// order of the source features.
+class OGROverlayRunner
+{
+    OGRLayer *const m_poResultLayer;
+    const bool m_bSkipFailures;
+    const int m_nThreads;
+    GDALProgressFunc const m_pfnProgress;
+    void *const m_pProgressArg;
+    const double m_dfProgressMax;
+    double m_dfProgressCounter = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGROverlayRunner)
+
+    struct Job
+    {
+        const OGROverlayFunc *pfnProcess = nullptr;
+        OGROverlayTask *psTask = nullptr;
+    };
+
+    static void JobFunc(void *pData)
+    {
+        Job *psJob = static_cast<Job *>(pData);
+        // Errors are emitted later by the calling thread, in the order of
+        // the features.
+        CPLInstallErrorHandlerAccumulator(psJob->psTask->aoErrors);
+        (*psJob->pfnProcess)(*psJob->psTask);
+        CPLUninstallErrorHandlerAccumulator();
+    }
+
+    OGRErr Write(OGROverlayTask &oTask);
+
+  public:
+    OGROverlayRunner(OGRLayer *poResultLayer, bool bSkipFailures,
+                     int nThreads, GDALProgressFunc pfnProgress,
+                     void *pProgressArg, double dfProgressMax)
+        : m_poResultLayer(poResultLayer), m_bSkipFailures(bSkipFailures),
+          m_nThreads(nThreads), m_pfnProgress(pfnProgress),
+          m_pProgressArg(pProgressArg), m_dfProgressMax(dfProgressMax)
+    {
+    }
+
+    OGRErr Run(OGRLayer *poSrcLayer, bool bThreadSafe,
+               const OGROverlayFunc &pfnProcess);
+    OGRErr Finish();
+};
+
+/************************************************************************/
+/*                     OGROverlayRunner::Write()                        */
+/************************************************************************/
+
+OGRErr OGROverlayRunner::Write(OGROverlayTask &oTask)
+{
+    if (m_pfnProgress)
+    {
+        double p = m_dfProgressCounter / m_dfProgressMax;
+        if (p > 0 && !m_pfnProgress(p, "", m_pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return OGRERR_FAILURE;
+        }
+        m_dfProgressCounter += 1.0;
+    }
+
+    for (const auto &oError : oTask.aoErrors)
+    {
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    for (auto &poResult : oTask.apoResults)
+    {
+        OGRErr ret = m_poResultLayer->CreateFeature(poResult.get());
+        if (ret != OGRERR_NONE)
+        {
+            if (!m_bSkipFailures)
+                return ret;
+            CPLErrorReset();
+        }
+    }
+
+    return oTask.bStop ? oTask.eErr : OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                      OGROverlayRunner::Run()                         */
+/************************************************************************/
+
+OGRErr OGROverlayRunner::Run(OGRLayer *poSrcLayer, bool bThreadSafe,
+                             const OGROverlayFunc &pfnProcess)
+{
+    CPLWorkerThreadPool *poThreadPool =
+        bThreadSafe && m_nThreads > 1 ? GDALGetGlobalThreadPool(m_nThreads)
+                                      : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    // Without worker threads, each feature is written before the next one
+    // is read, as the layer we iterate over may be read again by pfnProcess.
+    std::vector<OGROverlayTask> aoTasks(poQueue ? 16 * m_nThreads : 1);
+    std::vector<Job> asJobs(aoTasks.size());
+
+    poSrcLayer->ResetReading();
+    bool bEOF = false;
+    while (!bEOF)
+    {
+        size_t nTasks = 0;
+        for (; nTasks < aoTasks.size(); ++nTasks)
+        {
+            auto &oTask = aoTasks[nTasks];
+            if (!poSrcLayer->GetNextFeatureInto(oTask.poFeature))
+            {
+                bEOF = true;
+                break;
+            }
+            oTask.apoResults.clear();
+            oTask.aoErrors.clear();
+            oTask.bStop = false;
+            oTask.eErr = OGRERR_NONE;
+        }
+
+        if (poQueue)
+        {
+            for (size_t i = 0; i < nTasks; ++i)
+            {
+                asJobs[i].pfnProcess = &pfnProcess;
+                asJobs[i].psTask = &aoTasks[i];
+                poQueue->SubmitJob(JobFunc, &asJobs[i]);
+            }
+            poQueue->WaitCompletion();
+        }
+
+        for (size_t i = 0; i < nTasks; ++i)
+        {
+            if (!poQueue)
+                pfnProcess(aoTasks[i]);
+            const OGRErr ret = Write(aoTasks[i]);
+            if (ret != OGRERR_NONE || aoTasks[i].bStop)
+                return ret;
+        }
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                     OGROverlayRunner::Finish()                       */
+/************************************************************************/
+
+OGRErr OGROverlayRunner::Finish()
+{
+    if (m_pfnProgress && !m_pfnProgress(1.0, "", m_pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                          Intersection()                              */
 /************************************************************************/
@@ -2615,6 +3126,18 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Intersection().
@@ -2654,8 +3177,6 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGREnvelope sEnvelopeMethod;
     GBool bEnvelopeSet;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
@@ -2702,174 +3223,131 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
-    for (auto &&x : this)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+        OGROverlayLayerIndex oMethodIndex(pLayerMethod, pGeometryMethodFilter,
+                                          papszOptions);
+        oMethodIndex.Build();
+
+        OGROverlayRunner oRunner(pLayerResult, bSkipFailures,
+                                 get_num_threads(papszOptions), pfnProgress,
+                                 pProgressArg, progress_max);
+        ret = oRunner.Run(
+            this, oMethodIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
+                const OGRFeature *x = oTask.poFeature.get();
 
-        // is it worth to proceed?
-        if (bEnvelopeSet)
-        {
-            OGRGeometry *x_geom = x->GetGeometryRef();
-            if (x_geom)
-            {
-                OGREnvelope x_env;
-                x_geom->getEnvelope(&x_env);
-                if (x_env.MaxX < sEnvelopeMethod.MinX ||
-                    x_env.MaxY < sEnvelopeMethod.MinY ||
-                    sEnvelopeMethod.MaxX < x_env.MinX ||
-                    sEnvelopeMethod.MaxY < x_env.MinY)
+                // is it worth to proceed?
+                if (bEnvelopeSet)
                 {
-                    continue;
+                    const OGRGeometry *x_geom = x->GetGeometryRef();
+                    if (x_geom)
+                    {
+                        OGREnvelope x_env;
+                        x_geom->getEnvelope(&x_env);
+                        if (x_env.MaxX < sEnvelopeMethod.MinX ||
+                            x_env.MaxY < sEnvelopeMethod.MinY ||
+                            sEnvelopeMethod.MaxX < x_env.MinX ||
+                            sEnvelopeMethod.MaxY < x_env.MinY)
+                        {
+                            return;
+                        }
+                    }
+                    else
+                    {
+                        return;
+                    }
                 }
-            }
-            else
-            {
-                continue;
-            }
-        }
-
-        // set up the filter for method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
 
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
-        if (bUsePreparedGeometries)
-        {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
-            if (!x_prepared_geom)
-            {
-                goto done;
-            }
-        }
-
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            OGRGeometryUniquePtr z_geom;
-
-            if (x_prepared_geom)
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-                if (bPretestContainment &&
-                    OGRPreparedGeometryContains(x_prepared_geom.get(),
-                                                OGRGeometry::ToHandle(y_geom)))
+                // get the features of the method layer intersecting x
+                std::vector<const OGRFeature *> apoMethodFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oMethodIndex, oTask, bSkipFailures, apoMethodFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    if (CPLGetLastErrorType() == CE_None)
-                        z_geom.reset(y_geom->clone());
+                    return;
                 }
-                else if (!(OGRPreparedGeometryIntersects(
-                             x_prepared_geom.get(),
-                             OGRGeometry::ToHandle(y_geom))))
+
+                OGRPreparedGeometryUniquePtr x_prepared_geom;
+                if (bUsePreparedGeometries && bPretestContainment)
                 {
-                    if (CPLGetLastErrorType() == CE_None)
+                    x_prepared_geom.reset(OGRCreatePreparedGeometry(
+                        OGRGeometry::ToHandle(
+                            const_cast<OGRGeometry *>(x_geom))));
+                    if (!x_prepared_geom)
                     {
-                        continue;
+                        oTask.bStop = true;
+                        return;
                     }
                 }
-                if (CPLGetLastErrorType() != CE_None)
+
+                for (const OGRFeature *y : apoMethodFeatures)
                 {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+                    OGRGeometryUniquePtr z_geom;
+
+                    if (x_prepared_geom)
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
-                        continue;
-                    }
-                }
-            }
-            if (!z_geom)
-            {
-                CPLErrorReset();
-                z_geom.reset(x_geom->Intersection(y_geom));
-                if (CPLGetLastErrorType() != CE_None || z_geom == nullptr)
-                {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        if (OGRPreparedGeometryContains(
+                                x_prepared_geom.get(),
+                                OGRGeometry::ToHandle(
+                                    const_cast<OGRGeometry *>(y_geom))) &&
+                            CPLGetLastErrorType() == CE_None)
+                        {
+                            z_geom.reset(y_geom->clone());
+                        }
+                        if (CPLGetLastErrorType() != CE_None)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                            continue;
+                        }
                     }
-                    else
+                    if (!z_geom)
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
-                        continue;
+                        z_geom.reset(x_geom->Intersection(y_geom));
+                        if (CPLGetLastErrorType() != CE_None ||
+                            z_geom == nullptr)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                            continue;
+                        }
+                        if (z_geom->IsEmpty() ||
+                            (!bKeepLowerDimGeom &&
+                             (x_geom->getDimension() ==
+                                  y_geom->getDimension() &&
+                              z_geom->getDimension() <
+                                  x_geom->getDimension())))
+                        {
+                            continue;
+                        }
                     }
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapInput);
+                    z->SetFieldsFrom(y, mapMethod);
+                    if (bPromoteToMulti)
+                        z_geom.reset(promote_to_multi(z_geom.release()));
+                    z->SetGeometryDirectly(z_geom.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-                if (z_geom->IsEmpty() ||
-                    (!bKeepLowerDimGeom &&
-                     (x_geom->getDimension() == y_geom->getDimension() &&
-                      z_geom->getDimension() < x_geom->getDimension())))
-                {
-                    continue;
-                }
-            }
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            z->SetFieldsFrom(y.get(), mapMethod);
-            if (bPromoteToMulti)
-                z_geom.reset(promote_to_multi(z_geom.release()));
-            z->SetGeometryDirectly(z_geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        ret = OGRERR_FAILURE;
-        goto done;
+            });
+        if (ret == OGRERR_NONE)
+            ret = oRunner.Finish();
     }
 done:
     // release resources
@@ -2937,6 +3415,18 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -3033,6 +3523,18 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -3073,14 +3575,10 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     double progress_max =
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
-    const bool bUsePreparedGeometries = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "USE_PREPARED_GEOMETRIES", "YES"));
     bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
@@ -3121,304 +3619,183 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
-    // add features based on input layer
-    for (auto &&x : this)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+        OGROverlayLayerIndex oMethodIndex(pLayerMethod, pGeometryMethodFilter,
+                                          papszOptions);
+        oMethodIndex.Build();
+
+        OGROverlayRunner oRunner(pLayerResult, bSkipFailures,
+                                 get_num_threads(papszOptions), pfnProgress,
+                                 pProgressArg, progress_max);
+
+        // add features based on input layer
+        ret = oRunner.Run(
+            this, oMethodIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!pfnProgress(p, "", pProgressArg))
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the method layer intersecting x
+                std::vector<const OGRFeature *> apoMethodFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oMethodIndex, oTask, bSkipFailures, apoMethodFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return;
                 }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
-        if (bUsePreparedGeometries)
-        {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
-            if (!x_prepared_geom)
-            {
-                goto done;
-            }
-        }
 
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-            {
-                continue;
-            }
-
-            CPLErrorReset();
-            if (x_prepared_geom &&
-                !(OGRPreparedGeometryIntersects(x_prepared_geom.get(),
-                                                OGRGeometry::ToHandle(y_geom))))
-            {
-                if (CPLGetLastErrorType() == CE_None)
-                {
-                    continue;
-                }
-            }
-            if (CPLGetLastErrorType() != CE_None)
-            {
-                if (!bSkipFailures)
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr x_geom_diff(x_geom->clone());
+                for (const OGRFeature *y : apoMethodFeatures)
                 {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
 
-            CPLErrorReset();
-            OGRGeometryUniquePtr poIntersection(x_geom->Intersection(y_geom));
-            if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                    continue;
-                }
-            }
-            if (poIntersection->IsEmpty() ||
-                (!bKeepLowerDimGeom &&
-                 (x_geom->getDimension() == y_geom->getDimension() &&
-                  poIntersection->getDimension() < x_geom->getDimension())))
-            {
-                // ok
-            }
-            else
-            {
-                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
-                if (bPromoteToMulti)
-                    poIntersection.reset(
-                        promote_to_multi(poIntersection.release()));
-                z->SetGeometryDirectly(poIntersection.release());
-
-                if (x_geom_diff)
-                {
                     CPLErrorReset();
-                    OGRGeometryUniquePtr x_geom_diff_new(
-                        x_geom_diff->Difference(y_geom));
+                    OGRGeometryUniquePtr poIntersection(
+                        x_geom->Intersection(y_geom));
                     if (CPLGetLastErrorType() != CE_None ||
-                        x_geom_diff_new == nullptr)
+                        poIntersection == nullptr)
                     {
                         if (!bSkipFailures)
                         {
-                            ret = OGRERR_FAILURE;
-                            goto done;
+                            oTask.bStop = true;
+                            oTask.eErr = OGRERR_FAILURE;
+                            return;
                         }
-                        else
-                        {
-                            CPLErrorReset();
-                        }
-                    }
-                    else
-                    {
-                        x_geom_diff.swap(x_geom_diff_new);
+                        CPLErrorReset();
+                        continue;
                     }
-                }
-
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
+                    if (poIntersection->IsEmpty() ||
+                        (!bKeepLowerDimGeom &&
+                         (x_geom->getDimension() == y_geom->getDimension() &&
+                          poIntersection->getDimension() <
+                              x_geom->getDimension())))
                     {
-                        goto done;
+                        // ok
                     }
                     else
                     {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                        z->SetFieldsFrom(x, mapInput);
+                        z->SetFieldsFrom(y, mapMethod);
+                        if (bPromoteToMulti)
+                            poIntersection.reset(
+                                promote_to_multi(poIntersection.release()));
+                        z->SetGeometryDirectly(poIntersection.release());
+
+                        if (x_geom_diff)
+                        {
+                            CPLErrorReset();
+                            OGRGeometryUniquePtr x_geom_diff_new(
+                                x_geom_diff->Difference(y_geom));
+                            if (CPLGetLastErrorType() != CE_None ||
+                                x_geom_diff_new == nullptr)
+                            {
+                                if (!bSkipFailures)
+                                {
+                                    oTask.bStop = true;
+                                    oTask.eErr = OGRERR_FAILURE;
+                                    return;
+                                }
+                                CPLErrorReset();
+                            }
+                            else
+                            {
+                                x_geom_diff.swap(x_geom_diff_new);
+                            }
+                        }
+
+                        oTask.apoResults.push_back(std::move(z));
                     }
                 }
-            }
-        }
-        x_prepared_geom.reset();
 
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
-        {
-            // ok
-        }
-        else
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
+                if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
                 {
-                    goto done;
+                    // ok
                 }
                 else
                 {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapInput);
+                    if (bPromoteToMulti)
+                        x_geom_diff.reset(
+                            promote_to_multi(x_geom_diff.release()));
+                    z->SetGeometryDirectly(x_geom_diff.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-            }
-        }
-    }
-
-    // restore filter on method layer and add features based on it
-    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
-    for (auto &&x : pLayerMethod)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+            });
+        if (ret != OGRERR_NONE)
+            goto done;
+
+        // restore filter on method layer and add features based on it
+        pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+        OGROverlayLayerIndex oInputIndex(this, pGeometryInputFilter,
+                                         papszOptions);
+        oInputIndex.Build();
+        ret = oRunner.Run(
+            pLayerMethod, oInputIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!pfnProgress(p, "", pProgressArg))
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the input layer intersecting x
+                std::vector<const OGRFeature *> apoInputFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oInputIndex, oTask, bSkipFailures, apoInputFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return;
                 }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on input layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-            {
-                continue;
-            }
 
-            if (x_geom_diff)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr x_geom_diff_new(
-                    x_geom_diff->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None ||
-                    x_geom_diff_new == nullptr)
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr x_geom_diff(x_geom->clone());
+                for (const OGRFeature *y : apoInputFeatures)
                 {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+                    if (x_geom_diff)
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRGeometryUniquePtr x_geom_diff_new(
+                            x_geom_diff->Difference(y_geom));
+                        if (CPLGetLastErrorType() != CE_None ||
+                            x_geom_diff_new == nullptr)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                        }
+                        else
+                        {
+                            x_geom_diff.swap(x_geom_diff_new);
+                        }
                     }
                 }
-                else
-                {
-                    x_geom_diff.swap(x_geom_diff_new);
-                }
-            }
-        }
 
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
-        {
-            // ok
-        }
-        else
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapMethod);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
+                if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
                 {
-                    goto done;
+                    // ok
                 }
                 else
                 {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapMethod);
+                    if (bPromoteToMulti)
+                        x_geom_diff.reset(
+                            promote_to_multi(x_geom_diff.release()));
+                    z->SetGeometryDirectly(x_geom_diff.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-            }
-        }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        ret = OGRERR_FAILURE;
-        goto done;
+            });
+        if (ret == OGRERR_NONE)
+            ret = oRunner.Finish();
     }
 done:
     // release resources
@@ -3487,6 +3864,18 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -3570,6 +3959,18 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -3610,8 +4011,6 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     double progress_max =
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
@@ -3644,209 +4043,138 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
-    // add features based on input layer
-    for (auto &&x : this)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+        OGROverlayLayerIndex oMethodIndex(pLayerMethod, pGeometryMethodFilter,
+                                          papszOptions);
+        oMethodIndex.Build();
+
+        OGROverlayRunner oRunner(pLayerResult, bSkipFailures,
+                                 get_num_threads(papszOptions), pfnProgress,
+                                 pProgressArg, progress_max);
+
+        // add features based on input layer
+        ret = oRunner.Run(
+            this, oMethodIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!pfnProgress(p, "", pProgressArg))
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the method layer intersecting x
+                std::vector<const OGRFeature *> apoMethodFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oMethodIndex, oTask, bSkipFailures, apoMethodFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return;
                 }
-            }
-            progress_counter += 1.0;
-        }
 
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRGeometryUniquePtr geom(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-            {
-                continue;
-            }
-            if (geom)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr geom(x_geom->clone());
+                for (const OGRFeature *y : apoMethodFeatures)
                 {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+                    if (geom)
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
+                        if (CPLGetLastErrorType() != CE_None ||
+                            geom_new == nullptr)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                        }
+                        else
+                        {
+                            geom.swap(geom_new);
+                        }
                     }
+                    if (geom == nullptr || geom->IsEmpty())
+                        break;
                 }
-                else
-                {
-                    geom.swap(geom_new);
-                }
-            }
-            if (geom && geom->IsEmpty())
-                break;
-        }
 
-        if (geom && !geom->IsEmpty())
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                geom.reset(promote_to_multi(geom.release()));
-            z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
+                if (geom && !geom->IsEmpty())
                 {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapInput);
+                    if (bPromoteToMulti)
+                        geom.reset(promote_to_multi(geom.release()));
+                    z->SetGeometryDirectly(geom.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-            }
-        }
-    }
-
-    // restore filter on method layer and add features based on it
-    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
-    for (auto &&x : pLayerMethod)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+            });
+        if (ret != OGRERR_NONE)
+            goto done;
+
+        // restore filter on method layer and add features based on it
+        pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+        OGROverlayLayerIndex oInputIndex(this, pGeometryInputFilter,
+                                         papszOptions);
+        oInputIndex.Build();
+        ret = oRunner.Run(
+            pLayerMethod, oInputIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!pfnProgress(p, "", pProgressArg))
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the input layer intersecting x
+                std::vector<const OGRFeature *> apoInputFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oInputIndex, oTask, bSkipFailures, apoInputFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return;
                 }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on input layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
 
-        OGRGeometryUniquePtr geom(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            if (geom)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr geom(x_geom->clone());
+                for (const OGRFeature *y : apoInputFeatures)
                 {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+                    if (geom)
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
+                        if (CPLGetLastErrorType() != CE_None ||
+                            geom_new == nullptr)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                        }
+                        else
+                        {
+                            geom.swap(geom_new);
+                        }
                     }
+                    if (geom == nullptr || geom->IsEmpty())
+                        break;
                 }
-                else
-                {
-                    geom.swap(geom_new);
-                }
-            }
-            if (geom == nullptr || geom->IsEmpty())
-                break;
-        }
 
-        if (geom && !geom->IsEmpty())
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapMethod);
-            if (bPromoteToMulti)
-                geom.reset(promote_to_multi(geom.release()));
-            z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
+                if (geom && !geom->IsEmpty())
                 {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapMethod);
+                    if (bPromoteToMulti)
+                        geom.reset(promote_to_multi(geom.release()));
+                    z->SetGeometryDirectly(geom.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-            }
-        }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        ret = OGRERR_FAILURE;
-        goto done;
+            });
+        if (ret == OGRERR_NONE)
+            ret = oRunner.Finish();
     }
 done:
     // release resources
@@ -3905,6 +4233,18 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -4000,6 +4340,18 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -4037,14 +4389,10 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
         CSLFetchNameValueDef(papszOptions, "PROMOTE_TO_MULTI", "NO"));
-    const bool bUsePreparedGeometries = CPLTestBool(
-        CSLFetchNameValueDef(papszOptions, "USE_PREPARED_GEOMETRIES", "YES"));
     bool bKeepLowerDimGeom = CPLTestBool(CSLFetchNameValueDef(
         papszOptions, "KEEP_LOWER_DIMENSION_GEOMETRIES", "YES"));
 
@@ -4073,204 +4421,122 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     ret = create_field_map(poDefnInput, &mapInput);
     if (ret != OGRERR_NONE)
         goto done;
-    ret = create_field_map(poDefnMethod, &mapMethod);
-    if (ret != OGRERR_NONE)
-        goto done;
-    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
-                            mapMethod, true, papszOptions);
-    if (ret != OGRERR_NONE)
-        goto done;
-    poDefnResult = pLayerResult->GetLayerDefn();
-
-    // split the features in input layer to the result layer
-    for (auto &&x : this)
-    {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
-        if (bUsePreparedGeometries)
-        {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
-            if (!x_prepared_geom)
-            {
-                goto done;
-            }
-        }
-
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-
-            CPLErrorReset();
-            if (x_prepared_geom &&
-                !(OGRPreparedGeometryIntersects(x_prepared_geom.get(),
-                                                OGRGeometry::ToHandle(y_geom))))
-            {
-                if (CPLGetLastErrorType() == CE_None)
-                {
-                    continue;
-                }
-            }
-            if (CPLGetLastErrorType() != CE_None)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
+    ret = create_field_map(poDefnMethod, &mapMethod);
+    if (ret != OGRERR_NONE)
+        goto done;
+    ret = set_result_schema(pLayerResult, poDefnInput, poDefnMethod, mapInput,
+                            mapMethod, true, papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
+    poDefnResult = pLayerResult->GetLayerDefn();
 
-            CPLErrorReset();
-            OGRGeometryUniquePtr poIntersection(x_geom->Intersection(y_geom));
-            if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
+    {
+        OGROverlayLayerIndex oMethodIndex(pLayerMethod, pGeometryMethodFilter,
+                                          papszOptions);
+        oMethodIndex.Build();
+
+        OGROverlayRunner oRunner(pLayerResult, bSkipFailures,
+                                 get_num_threads(papszOptions), pfnProgress,
+                                 pProgressArg, progress_max);
+
+        // split the features in input layer to the result layer
+        ret = oRunner.Run(
+            this, oMethodIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the method layer intersecting x
+                std::vector<const OGRFeature *> apoMethodFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oMethodIndex, oTask, bSkipFailures, apoMethodFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
+                    return;
                 }
-            }
-            else if (poIntersection->IsEmpty() ||
-                     (!bKeepLowerDimGeom &&
-                      (x_geom->getDimension() == y_geom->getDimension() &&
-                       poIntersection->getDimension() <
-                           x_geom->getDimension())))
-            {
-                /* ok*/
-            }
-            else
-            {
-                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
-                if (bPromoteToMulti)
-                    poIntersection.reset(
-                        promote_to_multi(poIntersection.release()));
-                z->SetGeometryDirectly(poIntersection.release());
-                if (x_geom_diff)
+
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr x_geom_diff(x_geom->clone());
+                for (const OGRFeature *y : apoMethodFeatures)
                 {
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+
                     CPLErrorReset();
-                    OGRGeometryUniquePtr x_geom_diff_new(
-                        x_geom_diff->Difference(y_geom));
+                    OGRGeometryUniquePtr poIntersection(
+                        x_geom->Intersection(y_geom));
                     if (CPLGetLastErrorType() != CE_None ||
-                        x_geom_diff_new == nullptr)
+                        poIntersection == nullptr)
                     {
                         if (!bSkipFailures)
                         {
-                            ret = OGRERR_FAILURE;
-                            goto done;
+                            oTask.bStop = true;
+                            oTask.eErr = OGRERR_FAILURE;
+                            return;
                         }
-                        else
-                        {
-                            CPLErrorReset();
-                        }
-                    }
-                    else
-                    {
-                        x_geom_diff.swap(x_geom_diff_new);
+                        CPLErrorReset();
                     }
-                }
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
+                    else if (poIntersection->IsEmpty() ||
+                             (!bKeepLowerDimGeom &&
+                              (x_geom->getDimension() ==
+                                   y_geom->getDimension() &&
+                               poIntersection->getDimension() <
+                                   x_geom->getDimension())))
                     {
-                        goto done;
+                        /* ok*/
                     }
                     else
                     {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                        z->SetFieldsFrom(x, mapInput);
+                        z->SetFieldsFrom(y, mapMethod);
+                        if (bPromoteToMulti)
+                            poIntersection.reset(
+                                promote_to_multi(poIntersection.release()));
+                        z->SetGeometryDirectly(poIntersection.release());
+                        if (x_geom_diff)
+                        {
+                            CPLErrorReset();
+                            OGRGeometryUniquePtr x_geom_diff_new(
+                                x_geom_diff->Difference(y_geom));
+                            if (CPLGetLastErrorType() != CE_None ||
+                                x_geom_diff_new == nullptr)
+                            {
+                                if (!bSkipFailures)
+                                {
+                                    oTask.bStop = true;
+                                    oTask.eErr = OGRERR_FAILURE;
+                                    return;
+                                }
+                                CPLErrorReset();
+                            }
+                            else
+                            {
+                                x_geom_diff.swap(x_geom_diff_new);
+                            }
+                        }
+                        oTask.apoResults.push_back(std::move(z));
                     }
                 }
-            }
-        }
 
-        x_prepared_geom.reset();
-
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
-        {
-            /* ok */
-        }
-        else
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
+                if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
                 {
-                    goto done;
+                    /* ok */
                 }
                 else
                 {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapInput);
+                    if (bPromoteToMulti)
+                        x_geom_diff.reset(
+                            promote_to_multi(x_geom_diff.release()));
+                    z->SetGeometryDirectly(x_geom_diff.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-            }
-        }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        ret = OGRERR_FAILURE;
-        goto done;
+            });
+        if (ret == OGRERR_NONE)
+            ret = oRunner.Finish();
     }
 done:
     // release resources
@@ -4334,6 +4600,18 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -4418,6 +4696,18 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -4457,8 +4747,6 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     double progress_max =
         static_cast<double>(GetFeatureCount(FALSE)) +
         static_cast<double>(pLayerMethod->GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
@@ -4488,153 +4776,91 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
-    // add clipped features from the input layer
-    for (auto &&x : this)
     {
-
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+        OGROverlayLayerIndex oMethodIndex(pLayerMethod, pGeometryMethodFilter,
+                                          papszOptions);
+        oMethodIndex.Build();
+
+        OGROverlayRunner oRunner(pLayerResult, bSkipFailures,
+                                 get_num_threads(papszOptions), pfnProgress,
+                                 pProgressArg, progress_max);
+
+        // add clipped features from the input layer
+        ret = oRunner.Run(
+            this, oMethodIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!pfnProgress(p, "", pProgressArg))
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the method layer intersecting x
+                std::vector<const OGRFeature *> apoMethodFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oMethodIndex, oTask, bSkipFailures, apoMethodFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return;
                 }
-            }
-            progress_counter += 1.0;
-        }
 
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
-
-        OGRGeometryUniquePtr x_geom_diff(
-            x_geom->clone());  // this will be the geometry of a result feature
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            if (x_geom_diff)
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr x_geom_diff_new(
-                    x_geom_diff->Difference(y_geom));
-                if (CPLGetLastErrorType() != CE_None ||
-                    x_geom_diff_new == nullptr)
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr geom(x_geom->clone());
+                for (const OGRFeature *y : apoMethodFeatures)
                 {
-                    if (!bSkipFailures)
-                    {
-                        ret = OGRERR_FAILURE;
-                        goto done;
-                    }
-                    else
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+                    if (geom)
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
+                        if (CPLGetLastErrorType() != CE_None ||
+                            geom_new == nullptr)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                        }
+                        else
+                        {
+                            geom.swap(geom_new);
+                        }
                     }
                 }
-                else
-                {
-                    x_geom_diff.swap(x_geom_diff_new);
-                }
-            }
-        }
-
-        if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
-        {
-            /* ok */
-        }
-        else
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
-            z->SetGeometryDirectly(x_geom_diff.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
-                {
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-        }
-    }
-
-    // restore the original filter and add features from the update layer
-    pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
-    for (auto &&y : pLayerMethod)
-    {
 
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
+                if (geom && !geom->IsEmpty())
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapInput);
+                    if (bPromoteToMulti)
+                        geom.reset(promote_to_multi(geom.release()));
+                    z->SetGeometryDirectly(geom.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-            }
-            progress_counter += 1.0;
-        }
-
-        OGRGeometry *y_geom = y->StealGeometry();
-        if (!y_geom)
-            continue;
-        OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-        if (mapMethod)
-            z->SetFieldsFrom(y.get(), mapMethod);
-        z->SetGeometryDirectly(y_geom);
-        ret = pLayerResult->CreateFeature(z.get());
+            });
         if (ret != OGRERR_NONE)
-        {
-            if (!bSkipFailures)
-            {
-                goto done;
-            }
-            else
+            goto done;
+
+        // restore the original filter and add features from the update layer
+        pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+        ret = oRunner.Run(
+            pLayerMethod, /* bThreadSafe = */ true,
+            [&](OGROverlayTask &oTask)
             {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        ret = OGRERR_FAILURE;
-        goto done;
+                OGRFeature *y = oTask.poFeature.get();
+                OGRGeometry *y_geom = y->StealGeometry();
+                if (!y_geom)
+                    return;
+                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                if (mapMethod)
+                    z->SetFieldsFrom(y, mapMethod);
+                z->SetGeometryDirectly(y_geom);
+                oTask.apoResults.push_back(std::move(z));
+            });
+        if (ret == OGRERR_NONE)
+            ret = oRunner.Finish();
     }
 done:
     // release resources
@@ -4690,6 +4916,18 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -4767,6 +5005,18 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -4802,8 +5052,6 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRGeometry *pGeometryMethodFilter = nullptr;
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
@@ -4829,130 +5077,95 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
 
     poDefnResult = pLayerResult->GetLayerDefn();
-    for (auto &&x : this)
     {
+        OGROverlayLayerIndex oMethodIndex(pLayerMethod, pGeometryMethodFilter,
+                                          papszOptions);
+        oMethodIndex.Build();
 
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
+        OGROverlayRunner oRunner(pLayerResult, bSkipFailures,
+                                 get_num_threads(papszOptions), pfnProgress,
+                                 pProgressArg, progress_max);
+
+        ret = oRunner.Run(
+            this, oMethodIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                if (!pfnProgress(p, "", pProgressArg))
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the method layer intersecting x
+                std::vector<const OGRFeature *> apoMethodFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oMethodIndex, oTask, bSkipFailures, apoMethodFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
+                    return;
                 }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
 
-        OGRGeometryUniquePtr
-            geom;  // this will be the geometry of the result feature
-        // incrementally add area from y to geom
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            if (!geom)
-            {
-                geom.reset(y_geom->clone());
-            }
-            else
-            {
-                CPLErrorReset();
-                OGRGeometryUniquePtr geom_new(geom->Union(y_geom));
-                if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr geom;
+                // incrementally add area from y to geom
+                for (const OGRFeature *y : apoMethodFeatures)
                 {
-                    if (!bSkipFailures)
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+                    if (!geom)
                     {
-                        ret = OGRERR_FAILURE;
-                        goto done;
+                        geom.reset(y_geom->clone());
                     }
                     else
                     {
                         CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRGeometryUniquePtr geom_new(geom->Union(y_geom));
+                        if (CPLGetLastErrorType() != CE_None ||
+                            geom_new == nullptr)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                        }
+                        else
+                        {
+                            geom.swap(geom_new);
+                        }
                     }
                 }
-                else
-                {
-                    geom.swap(geom_new);
-                }
-            }
-        }
 
-        // possibly add a new feature with area x intersection sum of y
-        if (geom)
-        {
-            CPLErrorReset();
-            OGRGeometryUniquePtr poIntersection(
-                x_geom->Intersection(geom.get()));
-            if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
+                // possibly add a new feature with area x intersection sum of y
+                if (geom)
                 {
                     CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-            else if (!poIntersection->IsEmpty())
-            {
-                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-                z->SetFieldsFrom(x.get(), mapInput);
-                if (bPromoteToMulti)
-                    poIntersection.reset(
-                        promote_to_multi(poIntersection.release()));
-                z->SetGeometryDirectly(poIntersection.release());
-                ret = pLayerResult->CreateFeature(z.get());
-                if (ret != OGRERR_NONE)
-                {
-                    if (!bSkipFailures)
+                    OGRGeometryUniquePtr poIntersection(
+                        x_geom->Intersection(geom.get()));
+                    if (CPLGetLastErrorType() != CE_None ||
+                        poIntersection == nullptr)
                     {
-                        goto done;
+                        if (!bSkipFailures)
+                        {
+                            oTask.bStop = true;
+                            oTask.eErr = OGRERR_FAILURE;
+                            return;
+                        }
+                        CPLErrorReset();
                     }
-                    else
+                    else if (!poIntersection->IsEmpty())
                     {
-                        CPLErrorReset();
-                        ret = OGRERR_NONE;
+                        OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                        z->SetFieldsFrom(x, mapInput);
+                        if (bPromoteToMulti)
+                            poIntersection.reset(
+                                promote_to_multi(poIntersection.release()));
+                        z->SetGeometryDirectly(poIntersection.release());
+                        oTask.apoResults.push_back(std::move(z));
                     }
                 }
-            }
-        }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        ret = OGRERR_FAILURE;
-        goto done;
+            });
+        if (ret == OGRERR_NONE)
+            ret = oRunner.Finish();
     }
 done:
     // release resources
@@ -4999,6 +5212,18 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -5076,6 +5301,18 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -5111,8 +5348,6 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRGeometry *pGeometryMethodFilter = nullptr;
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
-    double progress_counter = 0;
-    double progress_ticker = 0;
     const bool bSkipFailures =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_FAILURES", "NO"));
     const bool bPromoteToMulti = CPLTestBool(
@@ -5139,108 +5374,73 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
-    for (auto &&x : this)
     {
+        OGROverlayLayerIndex oMethodIndex(pLayerMethod, pGeometryMethodFilter,
+                                          papszOptions);
+        oMethodIndex.Build();
 
-        if (pfnProgress)
-        {
-            double p = progress_counter / progress_max;
-            if (p > progress_ticker)
-            {
-                if (!pfnProgress(p, "", pProgressArg))
-                {
-                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-            }
-            progress_counter += 1.0;
-        }
-
-        // set up the filter on the method layer
-        CPLErrorReset();
-        OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
-        if (CPLGetLastErrorType() != CE_None)
-        {
-            if (!bSkipFailures)
-            {
-                ret = OGRERR_FAILURE;
-                goto done;
-            }
-            else
-            {
-                CPLErrorReset();
-                ret = OGRERR_NONE;
-            }
-        }
-        if (!x_geom)
-        {
-            continue;
-        }
+        OGROverlayRunner oRunner(pLayerResult, bSkipFailures,
+                                 get_num_threads(papszOptions), pfnProgress,
+                                 pProgressArg, progress_max);
 
-        OGRGeometryUniquePtr geom(
-            x_geom
-                ->clone());  // this will be the geometry of the result feature
-        // incrementally erase y from geom
-        for (auto &&y : pLayerMethod)
-        {
-            OGRGeometry *y_geom = y->GetGeometryRef();
-            if (!y_geom)
-                continue;
-            CPLErrorReset();
-            OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
-            if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
-            {
-                if (!bSkipFailures)
-                {
-                    ret = OGRERR_FAILURE;
-                    goto done;
-                }
-                else
-                {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
-                }
-            }
-            else
+        ret = oRunner.Run(
+            this, oMethodIndex.IsThreadSafe(),
+            [&](OGROverlayTask &oTask)
             {
-                geom.swap(geom_new);
-                if (geom->IsEmpty())
+                const OGRFeature *x = oTask.poFeature.get();
+
+                // get the features of the method layer intersecting x
+                std::vector<const OGRFeature *> apoMethodFeatures;
+                std::vector<OGRFeatureUniquePtr> apoOwned;
+                const OGRGeometry *x_geom = get_intersecting_features(
+                    oMethodIndex, oTask, bSkipFailures, apoMethodFeatures,
+                    apoOwned);
+                if (!x_geom)
                 {
-                    break;
+                    return;
                 }
-            }
-        }
 
-        // add a new feature if there is remaining area
-        if (!geom->IsEmpty())
-        {
-            OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
-            z->SetFieldsFrom(x.get(), mapInput);
-            if (bPromoteToMulti)
-                geom.reset(promote_to_multi(geom.release()));
-            z->SetGeometryDirectly(geom.release());
-            ret = pLayerResult->CreateFeature(z.get());
-            if (ret != OGRERR_NONE)
-            {
-                if (!bSkipFailures)
+                // this will be the geometry of the result feature
+                OGRGeometryUniquePtr geom(x_geom->clone());
+                for (const OGRFeature *y : apoMethodFeatures)
                 {
-                    goto done;
+                    const OGRGeometry *y_geom = y->GetGeometryRef();
+                    if (geom)
+                    {
+                        CPLErrorReset();
+                        OGRGeometryUniquePtr geom_new(geom->Difference(y_geom));
+                        if (CPLGetLastErrorType() != CE_None ||
+                            geom_new == nullptr)
+                        {
+                            if (!bSkipFailures)
+                            {
+                                oTask.bStop = true;
+                                oTask.eErr = OGRERR_FAILURE;
+                                return;
+                            }
+                            CPLErrorReset();
+                        }
+                        else
+                        {
+                            geom.swap(geom_new);
+                        }
+                    }
+                    if (geom == nullptr || geom->IsEmpty())
+                        break;
                 }
-                else
+
+                if (geom && !geom->IsEmpty())
                 {
-                    CPLErrorReset();
-                    ret = OGRERR_NONE;
+                    OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                    z->SetFieldsFrom(x, mapInput);
+                    if (bPromoteToMulti)
+                        geom.reset(promote_to_multi(geom.release()));
+                    z->SetGeometryDirectly(geom.release());
+                    oTask.apoResults.push_back(std::move(z));
                 }
-            }
-        }
-    }
-    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        ret = OGRERR_FAILURE;
-        goto done;
+            });
+        if (ret == OGRERR_NONE)
+            ret = oRunner.Finish();
     }
 done:
     // release resources
@@ -5287,6 +5487,18 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>USE_SPATIAL_INDEX=YES/NO. (GDAL >= 3.10) Defaults to YES, in which
+ *     case the features of the method layer are loaded in memory and
+ *     indexed once, instead of setting a spatial filter on the method
+ *     layer for each feature of the input layer. Features are only loaded
+ *     if they fit within the OGR_OVERLAY_MAX_RAM_USAGE configuration option
+ *     (in bytes, 10% of the usable physical RAM by default).
+ * </li>
+ * <li>NUM_THREADS=number|ALL_CPUS. (GDAL >= 3.10) Number of threads used to
+ *     process the features. Defaults to the value of the GDAL_NUM_THREADS
+ *     configuration option, or 1. Requires USE_SPATIAL_INDEX=YES. The
+ *     result features are written in the same order as with one thread.
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
@@ -5397,7 +5609,8 @@ OGRFeatureUniquePtr &OGRLayer::FeatureIterator::operator*()
 
 OGRLayer::FeatureIterator &OGRLayer::FeatureIterator::operator++()
 {
-    m_poPrivate->m_poFeature.reset(m_poPrivate->m_poLayer->GetNextFeature());
+    // The previous feature is no longer accessible: recycle it
+    m_poPrivate->m_poLayer->GetNextFeatureInto(m_poPrivate->m_poFeature);
     m_poPrivate->m_bEOF = m_poPrivate->m_poFeature == nullptr;
     return *this;
 }
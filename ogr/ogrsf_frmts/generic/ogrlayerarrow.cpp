@@ -41,6 +41,7 @@
 #include "cpl_json.h"
 #include "cpl_time.h"
 #include <cassert>
+#include <cctype>
 #include <cinttypes>
 #include <limits>
 #include <utility>
@@ -2443,6 +2444,14 @@ From OGR using the Arrow C Stream data interface</a> tutorial.
  *     (possibly using GeoArrow encoding).</li>
  * </ul>
  *
+ * The GeoPackage driver recognizes the following option:
+ * <ul>
+ * <li>PRESERVE_ORDER=YES/NO (GDAL >= 3.10). Whether batches must be returned
+ *     in increasing order of feature ID when they are read by several worker
+ *     threads. Defaults to YES. Setting it to NO lets the driver return a
+ *     batch as soon as any worker thread has completed it.</li>
+ * </ul>
+ *
  * @param out_stream Output stream. Must *not* be NULL. The content of the
  *                  structure does not need to be initialized.
  * @param papszOptions NULL terminated list of key=value options.
@@ -2637,6 +2646,14 @@ YES.</li>
  *     (possibly using GeoArrow encoding).</li>
  * </ul>
  *
+ * The GeoPackage driver recognizes the following option:
+ * <ul>
+ * <li>PRESERVE_ORDER=YES/NO (GDAL >= 3.10). Whether batches must be returned
+ *     in increasing order of feature ID when they are read by several worker
+ *     threads. Defaults to YES. Setting it to NO lets the driver return a
+ *     batch as soon as any worker thread has completed it.</li>
+ * </ul>
+ *
  * @param hLayer Layer
  * @param out_stream Output stream. Must *not* be NULL. The content of the
  *                  structure does not need to be initialized.
@@ -4678,6 +4695,742 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                        OGRArrowColumnarFilter                        */
+/*                                                                      */
+/*      Evaluates attribute filters made of comparisons of columns      */
+/*      with constants, combined with AND, OR and NOT, directly on the  */
+/*      buffers of the Arrow columns, rather than by setting the fields */
+/*      of an OGRFeature for each row. The NULL semantics and the       */
+/*      integer, floating point and string code paths of                */
+/*      SWQGeneralEvaluator() are reproduced.                           */
+/************************************************************************/
+
+namespace
+{
+class OGRArrowColumnarFilter
+{
+  public:
+    OGRArrowColumnarFilter(
+        OGRFeatureDefn *poFeatureDefn,
+        const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath,
+        const struct ArrowSchema *schema, const struct ArrowArray *array)
+        : m_poFeatureDefn(poFeatureDefn),
+          m_oMapFieldNameToArrowPath(oMapFieldNameToArrowPath),
+          m_schema(schema), m_array(array),
+          m_nLength(static_cast<size_t>(array->length))
+    {
+    }
+
+    bool IsHandled(const swq_expr_node *poExpr) const;
+
+    size_t Evaluate(const swq_expr_node *poExpr,
+                    std::vector<bool> &abyValidityFromFilters) const;
+
+  private:
+    struct Leaf
+    {
+        const char *pszFormat = nullptr;
+        const struct ArrowArray *psArray = nullptr;
+        std::vector<const struct ArrowArray *> apsParents{};
+    };
+
+    // Value and nullness of a boolean expression for each row. As with the
+    // tree evaluator, the value of a null row is 0.
+    struct Logical
+    {
+        std::vector<uint8_t> abyVal{};
+        std::vector<uint8_t> abyNull{};
+    };
+
+    OGRFeatureDefn *const m_poFeatureDefn;
+    const std::map<std::string, std::vector<int>> &m_oMapFieldNameToArrowPath;
+    const struct ArrowSchema *const m_schema;
+    const struct ArrowArray *const m_array;
+    const size_t m_nLength;
+
+    bool GetLeaf(const swq_expr_node *poColumn, Leaf &sLeaf) const;
+    bool IsHandledColumn(const swq_expr_node *poColumn) const;
+    bool IsHandledComparison(const swq_expr_node *poNode) const;
+    bool IsHandledLogical(const swq_expr_node *poNode) const;
+
+    void GetNulls(const Leaf &sLeaf, std::vector<uint8_t> &abyNull) const;
+    void GetIntegers(const Leaf &sLeaf, std::vector<int64_t> &anVal) const;
+    void GetDoubles(const Leaf &sLeaf, std::vector<double> &adfVal) const;
+
+    void EvaluateLogical(const swq_expr_node *poNode, bool bTopLevel,
+                         Logical &sRes) const;
+    void EvaluateComparison(const swq_expr_node *poNode, Logical &sRes) const;
+    void EvaluateStringComparison(const swq_expr_node *poNode,
+                                  const Leaf &sLeaf, Logical &sRes) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRArrowColumnarFilter)
+};
+
+/************************************************************************/
+/*                              GetLeaf()                               */
+/************************************************************************/
+
+bool OGRArrowColumnarFilter::GetLeaf(const swq_expr_node *poColumn,
+                                     Leaf &sLeaf) const
+{
+    if (poColumn->eNodeType != SNT_COLUMN || poColumn->table_index != 0 ||
+        poColumn->field_index < 0 ||
+        poColumn->field_index >= m_poFeatureDefn->GetFieldCount())
+    {
+        return false;
+    }
+    const auto oIter = m_oMapFieldNameToArrowPath.find(
+        m_poFeatureDefn->GetFieldDefn(poColumn->field_index)->GetNameRef());
+    if (oIter == m_oMapFieldNameToArrowPath.end())
+        return false;
+
+    const struct ArrowSchema *psSchemaField = m_schema;
+    const struct ArrowArray *psArray = m_array;
+    for (size_t i = 0; i < oIter->second.size(); ++i)
+    {
+        // Same as FillValidityArrayFromAttrQuery(): a null structure makes
+        // its members null.
+        if (i > 0)
+            sLeaf.apsParents.push_back(psArray);
+        const int iChild = oIter->second[i];
+        psSchemaField = psSchemaField->children[iChild];
+        psArray = psArray->children[iChild];
+    }
+    sLeaf.pszFormat = psSchemaField->format;
+    sLeaf.psArray = psArray;
+    return true;
+}
+
+/************************************************************************/
+/*                          IsHandledColumn()                           */
+/*                                                                      */
+/*      Whether the column can be read, with the value the OGR field    */
+/*      would get in FillValidityArrayFromAttrQuery().                  */
+/************************************************************************/
+
+bool OGRArrowColumnarFilter::IsHandledColumn(
+    const swq_expr_node *poColumn) const
+{
+    Leaf sLeaf;
+    if (!GetLeaf(poColumn, sLeaf))
+        return false;
+    const char *format = sLeaf.pszFormat;
+    const bool bSmallInteger = IsBoolean(format) || IsInt8(format) ||
+                               IsUInt8(format) || IsInt16(format) ||
+                               IsUInt16(format) || IsInt32(format);
+    switch (poColumn->field_type)
+    {
+        case SWQ_INTEGER:
+        case SWQ_BOOLEAN:
+            return bSmallInteger;
+
+        case SWQ_INTEGER64:
+            return bSmallInteger || IsUInt32(format) || IsInt64(format);
+
+        case SWQ_FLOAT:
+            return bSmallInteger || IsUInt32(format) || IsInt64(format) ||
+                   IsUInt64(format) || IsFloat32(format) || IsFloat64(format);
+
+        case SWQ_STRING:
+            return IsString(format) || IsLargeString(format);
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                        IsHandledComparison()                         */
+/*                                                                      */
+/*      A column compared to constants, selecting the same code path of */
+/*      SWQGeneralEvaluator() as the tree evaluator would.              */
+/************************************************************************/
+
+bool OGRArrowColumnarFilter::IsHandledComparison(
+    const swq_expr_node *poNode) const
+{
+    const int nOp = poNode->nOperation;
+    const int nSubExprCount = poNode->nSubExprCount;
+    if (nOp == SWQ_IN ? nSubExprCount < 2
+        : nOp == SWQ_BETWEEN ? nSubExprCount != 3
+                             : nSubExprCount != 2)
+    {
+        return false;
+    }
+    if (!IsHandledColumn(poNode->papoSubExpr[0]))
+        return false;
+    for (int i = 1; i < nSubExprCount; ++i)
+    {
+        if (poNode->papoSubExpr[i]->eNodeType != SNT_CONSTANT)
+            return false;
+    }
+
+    const swq_field_type eType0 = poNode->papoSubExpr[0]->field_type;
+    const swq_field_type eType1 = poNode->papoSubExpr[1]->field_type;
+    if (eType0 == SWQ_FLOAT || eType1 == SWQ_FLOAT)
+    {
+        // Only the first two arguments are converted from integer to
+        // floating point by the tree evaluator.
+        for (int i = 0; i < nSubExprCount; ++i)
+        {
+            const swq_field_type eType = poNode->papoSubExpr[i]->field_type;
+            if (eType != SWQ_FLOAT && (i >= 2 || !SWQ_IS_INTEGER(eType)))
+                return false;
+        }
+        return true;
+    }
+    else if (SWQ_IS_INTEGER(eType0) || eType0 == SWQ_BOOLEAN)
+    {
+        for (int i = 1; i < nSubExprCount; ++i)
+        {
+            const swq_field_type eType = poNode->papoSubExpr[i]->field_type;
+            if (!SWQ_IS_INTEGER(eType) && eType != SWQ_BOOLEAN)
+                return false;
+        }
+        return true;
+    }
+    else if (eType0 == SWQ_STRING)
+    {
+        for (int i = 1; i < nSubExprCount; ++i)
+        {
+            const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+            if (poConstant->field_type != SWQ_STRING)
+                return false;
+            if (!poConstant->is_null && !poConstant->string_value)
+                return false;
+        }
+        if (nOp == SWQ_EQ)
+        {
+            // The tree evaluator has special rules for values that look
+            // like timestamps with and without a +00 timezone.
+            const char *pszVal = poNode->papoSubExpr[1]->string_value;
+            const size_t nLen = pszVal ? strlen(pszVal) : 0;
+            if (nLen > 3 && (strcmp(pszVal + nLen - 3, "+00") == 0 ||
+                             pszVal[nLen - 3] == ':'))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          IsHandledLogical()                          */
+/************************************************************************/
+
+bool OGRArrowColumnarFilter::IsHandledLogical(
+    const swq_expr_node *poNode) const
+{
+    if (poNode->eNodeType == SNT_COLUMN)
+    {
+        return (SWQ_IS_INTEGER(poNode->field_type) ||
+                poNode->field_type == SWQ_BOOLEAN) &&
+               IsHandledColumn(poNode);
+    }
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        case SWQ_NOT:
+        {
+            if (poNode->nSubExprCount !=
+                (poNode->nOperation == SWQ_NOT ? 1 : 2))
+                return false;
+            for (int i = 0; i < poNode->nSubExprCount; ++i)
+            {
+                const swq_expr_node *poSub = poNode->papoSubExpr[i];
+                if ((!SWQ_IS_INTEGER(poSub->field_type) &&
+                     poSub->field_type != SWQ_BOOLEAN) ||
+                    !IsHandledLogical(poSub))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        case SWQ_ISNULL:
+        {
+            Leaf sLeaf;
+            return poNode->nSubExprCount == 1 &&
+                   GetLeaf(poNode->papoSubExpr[0], sLeaf);
+        }
+
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_GT:
+        case SWQ_LT:
+        case SWQ_GE:
+        case SWQ_LE:
+        case SWQ_IN:
+        case SWQ_BETWEEN:
+            return IsHandledComparison(poNode);
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                             IsHandled()                              */
+/************************************************************************/
+
+bool OGRArrowColumnarFilter::IsHandled(const swq_expr_node *poExpr) const
+{
+    return IsHandledLogical(poExpr);
+}
+
+/************************************************************************/
+/*                              GetNulls()                              */
+/************************************************************************/
+
+void OGRArrowColumnarFilter::GetNulls(const Leaf &sLeaf,
+                                      std::vector<uint8_t> &abyNull) const
+{
+    abyNull.assign(m_nLength, 0);
+    const auto MarkNulls = [this, &abyNull](const struct ArrowArray *psArray)
+    {
+        if (psArray->null_count == 0 || psArray->buffers[0] == nullptr)
+            return;
+        const uint8_t *pabyValidity =
+            static_cast<const uint8_t *>(psArray->buffers[0]);
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+        {
+            if (!TestBit(pabyValidity, iRow + nOffset))
+                abyNull[iRow] = 1;
+        }
+    };
+    for (const auto *psParent : sLeaf.apsParents)
+        MarkNulls(psParent);
+    MarkNulls(sLeaf.psArray);
+}
+
+/************************************************************************/
+/*                            GetIntegers()                             */
+/************************************************************************/
+
+template <class ArrowType>
+static void CopyIntegers(const struct ArrowArray *psArray, size_t nLength,
+                         std::vector<int64_t> &anVal)
+{
+    for (size_t iRow = 0; iRow < nLength; ++iRow)
+        anVal[iRow] = static_cast<int64_t>(GetValue<ArrowType>(psArray, iRow));
+}
+
+void OGRArrowColumnarFilter::GetIntegers(const Leaf &sLeaf,
+                                         std::vector<int64_t> &anVal) const
+{
+    anVal.resize(m_nLength);
+    const char *format = sLeaf.pszFormat;
+    const struct ArrowArray *psArray = sLeaf.psArray;
+    // Dispatch once on the format, so that the per-row loops are tight
+    if (IsBoolean(format))
+        CopyIntegers<bool>(psArray, m_nLength, anVal);
+    else if (IsInt8(format))
+        CopyIntegers<int8_t>(psArray, m_nLength, anVal);
+    else if (IsUInt8(format))
+        CopyIntegers<uint8_t>(psArray, m_nLength, anVal);
+    else if (IsInt16(format))
+        CopyIntegers<int16_t>(psArray, m_nLength, anVal);
+    else if (IsUInt16(format))
+        CopyIntegers<uint16_t>(psArray, m_nLength, anVal);
+    else if (IsInt32(format))
+        CopyIntegers<int32_t>(psArray, m_nLength, anVal);
+    else if (IsUInt32(format))
+        CopyIntegers<uint32_t>(psArray, m_nLength, anVal);
+    else
+    {
+        const int64_t *panValues =
+            static_cast<const int64_t *>(psArray->buffers[1]) +
+            static_cast<size_t>(psArray->offset);
+        anVal.assign(panValues, panValues + m_nLength);
+    }
+}
+
+/************************************************************************/
+/*                             GetDoubles()                             */
+/************************************************************************/
+
+void OGRArrowColumnarFilter::GetDoubles(const Leaf &sLeaf,
+                                        std::vector<double> &adfVal) const
+{
+    const char *format = sLeaf.pszFormat;
+    const struct ArrowArray *psArray = sLeaf.psArray;
+    if (IsFloat64(format))
+    {
+        const double *padfValues =
+            static_cast<const double *>(psArray->buffers[1]) +
+            static_cast<size_t>(psArray->offset);
+        adfVal.assign(padfValues, padfValues + m_nLength);
+    }
+    else if (IsFloat32(format))
+    {
+        adfVal.resize(m_nLength);
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+            adfVal[iRow] = GetValue<float>(psArray, iRow);
+    }
+    else if (IsUInt64(format))
+    {
+        adfVal.resize(m_nLength);
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+        {
+            adfVal[iRow] =
+                static_cast<double>(GetValue<uint64_t>(psArray, iRow));
+        }
+    }
+    else
+    {
+        std::vector<int64_t> anVal;
+        GetIntegers(sLeaf, anVal);
+        adfVal.resize(m_nLength);
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+            adfVal[iRow] = static_cast<double>(anVal[iRow]);
+    }
+}
+
+/************************************************************************/
+/*                       CompareArrowStringCI()                         */
+/*                                                                      */
+/*      Same result as STRCASECMP() on the value of the OGR field,      */
+/*      which is truncated at the first nul character.                  */
+/************************************************************************/
+
+static int CompareArrowStringCI(const char *pachVal, size_t nLen,
+                                const char *pszOther)
+{
+    for (size_t i = 0;; ++i)
+    {
+        const int ch1 =
+            tolower(i < nLen ? static_cast<unsigned char>(pachVal[i]) : 0);
+        const int ch2 = tolower(static_cast<unsigned char>(pszOther[i]));
+        if (ch1 != ch2 || ch1 == 0)
+            return ch1 - ch2;
+    }
+}
+
+/************************************************************************/
+/*                     EvaluateStringComparison()                       */
+/************************************************************************/
+
+void OGRArrowColumnarFilter::EvaluateStringComparison(
+    const swq_expr_node *poNode, const Leaf &sLeaf, Logical &sRes) const
+{
+    const struct ArrowArray *psArray = sLeaf.psArray;
+    const bool bLarge = IsLargeString(sLeaf.pszFormat);
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+    const int nOp = poNode->nOperation;
+    for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+    {
+        if (sRes.abyNull[iRow])
+            continue;
+        size_t nStart, nEnd;
+        if (bLarge)
+        {
+            const auto *panOffsets =
+                static_cast<const uint64_t *>(psArray->buffers[1]);
+            nStart = static_cast<size_t>(panOffsets[iRow + nOffset]);
+            nEnd = static_cast<size_t>(panOffsets[iRow + nOffset + 1]);
+        }
+        else
+        {
+            const auto *panOffsets =
+                static_cast<const uint32_t *>(psArray->buffers[1]);
+            nStart = panOffsets[iRow + nOffset];
+            nEnd = panOffsets[iRow + nOffset + 1];
+        }
+        const char *pachVal = pachData + nStart;
+        const size_t nLen = nEnd - nStart;
+        const auto Compare = [pachVal, nLen, poNode](int i)
+        {
+            return CompareArrowStringCI(pachVal, nLen,
+                                        poNode->papoSubExpr[i]->string_value);
+        };
+
+        bool bRes = false;
+        switch (nOp)
+        {
+            case SWQ_EQ:
+                bRes = Compare(1) == 0;
+                break;
+            case SWQ_NE:
+                bRes = Compare(1) != 0;
+                break;
+            case SWQ_GT:
+                bRes = Compare(1) > 0;
+                break;
+            case SWQ_LT:
+                bRes = Compare(1) < 0;
+                break;
+            case SWQ_GE:
+                bRes = Compare(1) >= 0;
+                break;
+            case SWQ_LE:
+                bRes = Compare(1) <= 0;
+                break;
+            case SWQ_BETWEEN:
+                bRes = Compare(1) >= 0 && Compare(2) <= 0;
+                break;
+            case SWQ_IN:
+            {
+                bool bNullFound = false;
+                for (int i = 1; i < poNode->nSubExprCount; ++i)
+                {
+                    if (poNode->papoSubExpr[i]->is_null)
+                    {
+                        bNullFound = true;
+                    }
+                    else if (Compare(i) == 0)
+                    {
+                        bRes = true;
+                        break;
+                    }
+                }
+                if (!bRes && bNullFound)
+                    sRes.abyNull[iRow] = 1;
+                break;
+            }
+            default:
+                CPLAssert(false);
+                break;
+        }
+        sRes.abyVal[iRow] = bRes;
+    }
+}
+
+/************************************************************************/
+/*                        EvaluateComparison()                          */
+/************************************************************************/
+
+void OGRArrowColumnarFilter::EvaluateComparison(const swq_expr_node *poNode,
+                                                Logical &sRes) const
+{
+    const swq_expr_node *poColumn = poNode->papoSubExpr[0];
+    const int nOp = poNode->nOperation;
+    const int nSubExprCount = poNode->nSubExprCount;
+
+    Leaf sLeaf;
+    GetLeaf(poColumn, sLeaf);
+    GetNulls(sLeaf, sRes.abyNull);
+    sRes.abyVal.assign(m_nLength, 0);
+
+    // Apart from IN, a null constant makes the result null for all rows.
+    if (nOp != SWQ_IN)
+    {
+        for (int i = 1; i < nSubExprCount; ++i)
+        {
+            if (poNode->papoSubExpr[i]->is_null)
+            {
+                sRes.abyNull.assign(m_nLength, 1);
+                return;
+            }
+        }
+    }
+
+    if (poColumn->field_type == SWQ_STRING)
+    {
+        EvaluateStringComparison(poNode, sLeaf, sRes);
+        return;
+    }
+
+    std::vector<uint8_t> abyConstNull(nSubExprCount);
+    for (int i = 1; i < nSubExprCount; ++i)
+        abyConstNull[i] = poNode->papoSubExpr[i]->is_null != 0;
+
+    const auto Compare =
+        [this, nOp, nSubExprCount, &abyConstNull, &sRes](const auto &aVal,
+                                                        const auto &aConst)
+    {
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+        {
+            if (sRes.abyNull[iRow])
+                continue;
+            const auto v = aVal[iRow];
+            bool bRes = false;
+            switch (nOp)
+            {
+                case SWQ_EQ:
+                    bRes = v == aConst[1];
+                    break;
+                case SWQ_NE:
+                    bRes = v != aConst[1];
+                    break;
+                case SWQ_GT:
+                    bRes = v > aConst[1];
+                    break;
+                case SWQ_LT:
+                    bRes = v < aConst[1];
+                    break;
+                case SWQ_GE:
+                    bRes = v >= aConst[1];
+                    break;
+                case SWQ_LE:
+                    bRes = v <= aConst[1];
+                    break;
+                case SWQ_BETWEEN:
+                    bRes = v >= aConst[1] && v <= aConst[2];
+                    break;
+                case SWQ_IN:
+                {
+                    bool bNullFound = false;
+                    for (int i = 1; i < nSubExprCount; ++i)
+                    {
+                        if (abyConstNull[i])
+                        {
+                            bNullFound = true;
+                        }
+                        else if (v == aConst[i])
+                        {
+                            bRes = true;
+                            break;
+                        }
+                    }
+                    if (!bRes && bNullFound)
+                        sRes.abyNull[iRow] = 1;
+                    break;
+                }
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+            sRes.abyVal[iRow] = bRes;
+        }
+    };
+
+    const swq_field_type eType1 = poNode->papoSubExpr[1]->field_type;
+    if (poColumn->field_type == SWQ_FLOAT || eType1 == SWQ_FLOAT)
+    {
+        std::vector<double> adfVal;
+        GetDoubles(sLeaf, adfVal);
+        std::vector<double> adfConst(nSubExprCount);
+        for (int i = 1; i < nSubExprCount; ++i)
+        {
+            const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+            adfConst[i] = poConstant->field_type == SWQ_FLOAT
+                              ? poConstant->float_value
+                              : static_cast<double>(poConstant->int_value);
+        }
+        Compare(adfVal, adfConst);
+    }
+    else
+    {
+        std::vector<int64_t> anVal;
+        GetIntegers(sLeaf, anVal);
+        std::vector<int64_t> anConst(nSubExprCount);
+        for (int i = 1; i < nSubExprCount; ++i)
+            anConst[i] = poNode->papoSubExpr[i]->int_value;
+        Compare(anVal, anConst);
+    }
+}
+
+/************************************************************************/
+/*                          EvaluateLogical()                           */
+/************************************************************************/
+
+void OGRArrowColumnarFilter::EvaluateLogical(const swq_expr_node *poNode,
+                                             bool bTopLevel,
+                                             Logical &sRes) const
+{
+    if (poNode->eNodeType == SNT_COLUMN)
+    {
+        Leaf sLeaf;
+        GetLeaf(poNode, sLeaf);
+        GetNulls(sLeaf, sRes.abyNull);
+        std::vector<int64_t> anVal;
+        GetIntegers(sLeaf, anVal);
+        sRes.abyVal.resize(m_nLength);
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+        {
+            // OGRFeatureQuery::Evaluate() truncates the final result to int
+            sRes.abyVal[iRow] =
+                !sRes.abyNull[iRow] &&
+                (bTopLevel ? static_cast<int>(anVal[iRow]) != 0
+                           : anVal[iRow] != 0);
+        }
+        return;
+    }
+
+    switch (poNode->nOperation)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        {
+            Logical sOther;
+            EvaluateLogical(poNode->papoSubExpr[0], false, sRes);
+            EvaluateLogical(poNode->papoSubExpr[1], false, sOther);
+            const bool bAnd = poNode->nOperation == SWQ_AND;
+            for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+            {
+                const uint8_t bNull =
+                    sRes.abyNull[iRow] | sOther.abyNull[iRow];
+                if (bAnd)
+                    sRes.abyVal[iRow] =
+                        !bNull && sRes.abyVal[iRow] && sOther.abyVal[iRow];
+                else
+                    sRes.abyVal[iRow] =
+                        sRes.abyVal[iRow] || sOther.abyVal[iRow];
+                sRes.abyNull[iRow] = bNull;
+            }
+            break;
+        }
+
+        case SWQ_NOT:
+        {
+            EvaluateLogical(poNode->papoSubExpr[0], false, sRes);
+            for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+                sRes.abyVal[iRow] = !sRes.abyNull[iRow] && !sRes.abyVal[iRow];
+            break;
+        }
+
+        case SWQ_ISNULL:
+        {
+            Leaf sLeaf;
+            GetLeaf(poNode->papoSubExpr[0], sLeaf);
+            GetNulls(sLeaf, sRes.abyVal);
+            sRes.abyNull.assign(m_nLength, 0);
+            break;
+        }
+
+        default:
+            EvaluateComparison(poNode, sRes);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+size_t OGRArrowColumnarFilter::Evaluate(
+    const swq_expr_node *poExpr,
+    std::vector<bool> &abyValidityFromFilters) const
+{
+    Logical sRes;
+    EvaluateLogical(poExpr, true, sRes);
+    size_t nCountIntersecting = 0;
+    for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+    {
+        if (!abyValidityFromFilters[iRow])
+            continue;
+        if (sRes.abyVal[iRow])
+            nCountIntersecting++;
+        else
+            abyValidityFromFilters[iRow] = false;
+    }
+    return nCountIntersecting;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4696,6 +5449,14 @@ static size_t FillValidityArrayFromAttrQuery(
     BuildMapFieldNameToArrowPath(schema, oMapFieldNameToArrowPath,
                                  std::string(), anArrowPathTmp);
 
+    // Evaluate simple filters directly on the Arrow columns
+    const auto poExpr =
+        static_cast<const swq_expr_node *>(poAttrQuery->GetSWQExpr());
+    const OGRArrowColumnarFilter oColumnarFilter(
+        poFeatureDefn, oMapFieldNameToArrowPath, schema, array);
+    if (poExpr && oColumnarFilter.IsHandled(poExpr))
+        return oColumnarFilter.Evaluate(poExpr, abyValidityFromFilters);
+
     struct UsedFieldsInfo
     {
         int iOGRFieldIndex{};
@@ -0,0 +1,774 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRSpatialIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrspatialindexedlayer.h"
+
+#include "cpl_vsi_virtual.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+// Maximum number of children of a node of the R-tree
+constexpr size_t NODE_SIZE = 16;
+
+// Header of index files
+constexpr const char INDEX_FILE_MAGIC[] = "OGRSPIDX";
+constexpr size_t INDEX_FILE_MAGIC_SIZE = 8;
+constexpr uint32_t INDEX_FILE_VERSION = 1;
+constexpr size_t INDEX_FILE_HEADER_SIZE =
+    INDEX_FILE_MAGIC_SIZE + sizeof(uint32_t) + sizeof(int32_t) +
+    sizeof(uint64_t) + sizeof(int64_t) + sizeof(uint64_t);
+constexpr size_t INDEX_FILE_ITEM_SIZE =
+    4 * sizeof(double) + 2 * sizeof(int64_t);
+
+/************************************************************************/
+/*                       OGRSpatialIndexedLayer()                       */
+/************************************************************************/
+
+OGRSpatialIndexedLayer::OGRSpatialIndexedLayer(
+    OGRLayer *poDecoratedLayer, bool bTakeOwnership, int iGeomField,
+    const std::string &osIndexFilename, bool bWriteIndexFile,
+    const std::string &osSourceFilename)
+    : OGRLayerDecorator(poDecoratedLayer, bTakeOwnership),
+      m_iGeomField(iGeomField), m_osIndexFilename(osIndexFilename),
+      m_bWriteIndexFile(bWriteIndexFile), m_osSourceFilename(osSourceFilename),
+      m_bRandomRead(
+          CPL_TO_BOOL(poDecoratedLayer->TestCapability(OLCRandomRead))),
+      m_bFastSetNextByIndex(CPL_TO_BOOL(
+          poDecoratedLayer->TestCapability(OLCFastSetNextByIndex)))
+{
+    SetDescription(poDecoratedLayer->GetDescription());
+}
+
+/************************************************************************/
+/*                          IsIndexedQuery()                            */
+/************************************************************************/
+
+/** Whether the current spatial filter is evaluated with the index */
+bool OGRSpatialIndexedLayer::IsIndexedQuery() const
+{
+    return m_poFilterGeom != nullptr && m_iGeomFieldFilter == m_iGeomField &&
+           (m_bRandomRead || m_bFastSetNextByIndex) && !m_bIndexBuildFailed;
+}
+
+/************************************************************************/
+/*                          ForwardFilters()                            */
+/************************************************************************/
+
+/** Install the filters on the decorated layer, unless they are evaluated by
+ * this layer when reading through the index. */
+void OGRSpatialIndexedLayer::ForwardFilters()
+{
+    if (IsIndexedQuery())
+    {
+        m_poDecoratedLayer->SetSpatialFilter(nullptr);
+        m_poDecoratedLayer->SetAttributeFilter(nullptr);
+    }
+    else
+    {
+        m_poDecoratedLayer->SetSpatialFilter(m_iGeomFieldFilter,
+                                             m_poFilterGeom);
+        m_poDecoratedLayer->SetAttributeFilter(m_pszAttrQueryString);
+    }
+}
+
+/************************************************************************/
+/*                         GetSpatialFilter()                           */
+/************************************************************************/
+
+OGRGeometry *OGRSpatialIndexedLayer::GetSpatialFilter()
+{
+    return m_poFilterGeom;
+}
+
+/************************************************************************/
+/*                         SetSpatialFilter()                           */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::SetSpatialFilter(OGRGeometry *poGeom)
+{
+    SetSpatialFilter(0, poGeom);
+}
+
+/************************************************************************/
+/*                        SetSpatialFilterRect()                        */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::SetSpatialFilterRect(double dfMinX, double dfMinY,
+                                                  double dfMaxX, double dfMaxY)
+{
+    OGRLayer::SetSpatialFilterRect(dfMinX, dfMinY, dfMaxX, dfMaxY);
+}
+
+/************************************************************************/
+/*                         SetSpatialFilter()                           */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::SetSpatialFilter(int iGeomField,
+                                              OGRGeometry *poGeom)
+{
+    if (iGeomField < 0 ||
+        (iGeomField > 0 &&
+         iGeomField >= GetLayerDefn()->GetGeomFieldCount()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid geometry field index : %d", iGeomField);
+        return;
+    }
+
+    m_iGeomFieldFilter = iGeomField;
+    InstallFilter(poGeom);
+    m_bQueryDone = false;
+    ForwardFilters();
+    ResetReading();
+}
+
+/************************************************************************/
+/*                        SetSpatialFilterRect()                        */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::SetSpatialFilterRect(int iGeomField,
+                                                  double dfMinX, double dfMinY,
+                                                  double dfMaxX, double dfMaxY)
+{
+    OGRLayer::SetSpatialFilterRect(iGeomField, dfMinX, dfMinY, dfMaxX, dfMaxY);
+}
+
+/************************************************************************/
+/*                        SetAttributeFilter()                          */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::SetAttributeFilter(const char *pszFilter)
+{
+    const OGRErr eErr = OGRLayer::SetAttributeFilter(pszFilter);
+    if (eErr == OGRERR_NONE)
+        ForwardFilters();
+    return eErr;
+}
+
+/************************************************************************/
+/*                           ResetReading()                             */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::ResetReading()
+{
+    m_iNextCandidate = 0;
+    m_poDecoratedLayer->ResetReading();
+}
+
+/************************************************************************/
+/*                             Hilbert()                                */
+/************************************************************************/
+
+/** Distance along the Hilbert curve of order 16 of a point whose
+ * coordinates are in [0, 65535] */
+static uint32_t Hilbert(uint32_t x, uint32_t y)
+{
+    constexpr uint32_t N = 1U << 16;
+    uint32_t d = 0;
+    for (uint32_t s = N / 2; s > 0; s /= 2)
+    {
+        const uint32_t rx = (x & s) ? 1 : 0;
+        const uint32_t ry = (y & s) ? 1 : 0;
+        d += s * s * ((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = N - 1 - x;
+                y = N - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+/************************************************************************/
+/*                            BuildIndex()                              */
+/************************************************************************/
+
+/** Build the index on the first spatial query, or load it from the index
+ * file if it is up to date. */
+bool OGRSpatialIndexedLayer::BuildIndex()
+{
+    if (m_bIndexBuilt)
+        return true;
+
+    if (!m_bIndexFileStale && !m_osIndexFilename.empty() && ReadIndexFile())
+    {
+        BuildTree();
+        m_bIndexBuilt = true;
+        return true;
+    }
+
+    CPLDebug("OGR", "Building spatial index of layer %s", GetDescription());
+
+    m_aoItems.clear();
+    bool bOK = true;
+    try
+    {
+        GIntBig nIndex = 0;
+        for (auto &&poFeature : *m_poDecoratedLayer)
+        {
+            const OGRGeometry *poGeom =
+                poFeature->GetGeomFieldRef(m_iGeomField);
+            if (poGeom && !poGeom->IsEmpty())
+            {
+                Item oItem;
+                poGeom->getEnvelope(&oItem.sEnvelope);
+                oItem.nFID = poFeature->GetFID();
+                oItem.nIndex = nIndex;
+                if (oItem.nFID == OGRNullFID && !m_bFastSetNextByIndex)
+                {
+                    bOK = false;
+                    break;
+                }
+                m_aoItems.push_back(oItem);
+            }
+            ++nIndex;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot build spatial index: %s", e.what());
+        bOK = false;
+    }
+    m_poDecoratedLayer->ResetReading();
+
+    if (!bOK)
+    {
+        CPLDebug("OGR", "Spatial index of layer %s cannot be used",
+                 GetDescription());
+        m_aoItems.clear();
+        m_bIndexBuildFailed = true;
+        // Filters must now be evaluated by the decorated layer
+        ForwardFilters();
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Sort items along the Hilbert curve of their centers.            */
+    /* -------------------------------------------------------------------- */
+    OGREnvelope sExtent;
+    for (const auto &oItem : m_aoItems)
+        sExtent.Merge(oItem.sEnvelope);
+    const double dfWidth = sExtent.MaxX - sExtent.MinX;
+    const double dfHeight = sExtent.MaxY - sExtent.MinY;
+    constexpr double HILBERT_MAX = (1U << 16) - 1;
+    std::vector<std::pair<uint32_t, size_t>> anHilbert;
+    anHilbert.reserve(m_aoItems.size());
+    for (size_t i = 0; i < m_aoItems.size(); ++i)
+    {
+        const auto &sEnv = m_aoItems[i].sEnvelope;
+        const double dfX = (sEnv.MinX + sEnv.MaxX) / 2;
+        const double dfY = (sEnv.MinY + sEnv.MaxY) / 2;
+        const uint32_t nX =
+            dfWidth > 0 ? static_cast<uint32_t>(std::clamp(
+                              (dfX - sExtent.MinX) / dfWidth * HILBERT_MAX,
+                              0.0, HILBERT_MAX))
+                        : 0;
+        const uint32_t nY =
+            dfHeight > 0 ? static_cast<uint32_t>(std::clamp(
+                               (dfY - sExtent.MinY) / dfHeight * HILBERT_MAX,
+                               0.0, HILBERT_MAX))
+                         : 0;
+        anHilbert.emplace_back(Hilbert(nX, nY), i);
+    }
+    std::sort(anHilbert.begin(), anHilbert.end());
+    std::vector<Item> aoSortedItems;
+    aoSortedItems.reserve(m_aoItems.size());
+    for (const auto &oPair : anHilbert)
+        aoSortedItems.push_back(m_aoItems[oPair.second]);
+    m_aoItems = std::move(aoSortedItems);
+
+    BuildTree();
+    m_bIndexBuilt = true;
+    m_bIndexFileStale = false;
+
+    if (!m_osIndexFilename.empty() && m_bWriteIndexFile)
+        WriteIndexFile();
+
+    return true;
+}
+
+/************************************************************************/
+/*                            BuildTree()                               */
+/************************************************************************/
+
+/** Compute the extents of the nodes of the packed R-tree, level by level,
+ * from the sorted leaf items. */
+void OGRSpatialIndexedLayer::BuildTree()
+{
+    m_aoLevels.clear();
+    if (m_aoItems.empty())
+        return;
+
+    std::vector<OGREnvelope> aoLevel((m_aoItems.size() + NODE_SIZE - 1) /
+                                     NODE_SIZE);
+    for (size_t i = 0; i < m_aoItems.size(); ++i)
+        aoLevel[i / NODE_SIZE].Merge(m_aoItems[i].sEnvelope);
+    m_aoLevels.push_back(std::move(aoLevel));
+
+    while (m_aoLevels.back().size() > 1)
+    {
+        const auto &aoChildren = m_aoLevels.back();
+        std::vector<OGREnvelope> aoParents((aoChildren.size() + NODE_SIZE - 1) /
+                                           NODE_SIZE);
+        for (size_t i = 0; i < aoChildren.size(); ++i)
+            aoParents[i / NODE_SIZE].Merge(aoChildren[i]);
+        m_aoLevels.push_back(std::move(aoParents));
+    }
+}
+
+/************************************************************************/
+/*                             RunQuery()                               */
+/************************************************************************/
+
+/** Collect the items whose envelope intersects the spatial filter, in the
+ * order of sequential reading. */
+void OGRSpatialIndexedLayer::RunQuery()
+{
+    m_bQueryDone = true;
+    m_anCandidates.clear();
+    m_iNextCandidate = 0;
+    if (m_aoLevels.empty() ||
+        !m_aoLevels.back()[0].Intersects(m_sFilterEnvelope))
+    {
+        return;
+    }
+
+    // Stack of (level, index of node in level)
+    std::vector<std::pair<size_t, size_t>> aoStack;
+    aoStack.emplace_back(m_aoLevels.size() - 1, 0);
+    while (!aoStack.empty())
+    {
+        const auto [iLevel, iNode] = aoStack.back();
+        aoStack.pop_back();
+        const size_t iFirstChild = iNode * NODE_SIZE;
+        if (iLevel == 0)
+        {
+            const size_t iEnd =
+                std::min(iFirstChild + NODE_SIZE, m_aoItems.size());
+            for (size_t i = iFirstChild; i < iEnd; ++i)
+            {
+                if (m_aoItems[i].sEnvelope.Intersects(m_sFilterEnvelope))
+                    m_anCandidates.push_back(i);
+            }
+        }
+        else
+        {
+            const auto &aoChildren = m_aoLevels[iLevel - 1];
+            const size_t iEnd =
+                std::min(iFirstChild + NODE_SIZE, aoChildren.size());
+            for (size_t i = iFirstChild; i < iEnd; ++i)
+            {
+                if (aoChildren[i].Intersects(m_sFilterEnvelope))
+                    aoStack.emplace_back(iLevel - 1, i);
+            }
+        }
+    }
+
+    std::sort(m_anCandidates.begin(), m_anCandidates.end(),
+              [this](size_t a, size_t b)
+              { return m_aoItems[a].nIndex < m_aoItems[b].nIndex; });
+}
+
+/************************************************************************/
+/*                          GetNextFeature()                            */
+/************************************************************************/
+
+OGRFeature *OGRSpatialIndexedLayer::GetNextFeature()
+{
+    if (!IsIndexedQuery() || !BuildIndex())
+        return m_poDecoratedLayer->GetNextFeature();
+
+    if (!m_bQueryDone)
+        RunQuery();
+
+    while (m_iNextCandidate < m_anCandidates.size())
+    {
+        const Item &oItem = m_aoItems[m_anCandidates[m_iNextCandidate++]];
+        std::unique_ptr<OGRFeature> poFeature;
+        if (m_bRandomRead && oItem.nFID != OGRNullFID)
+        {
+            poFeature.reset(m_poDecoratedLayer->GetFeature(oItem.nFID));
+        }
+        else if (m_poDecoratedLayer->SetNextByIndex(oItem.nIndex) ==
+                 OGRERR_NONE)
+        {
+            poFeature.reset(m_poDecoratedLayer->GetNextFeature());
+        }
+
+        if (poFeature &&
+            FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter)) &&
+            (m_poAttrQuery == nullptr ||
+             m_poAttrQuery->Evaluate(poFeature.get())))
+        {
+            return poFeature.release();
+        }
+    }
+
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          SetNextByIndex()                            */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::SetNextByIndex(GIntBig nIndex)
+{
+    if (IsIndexedQuery())
+        return OGRLayer::SetNextByIndex(nIndex);
+    return m_poDecoratedLayer->SetNextByIndex(nIndex);
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRSpatialIndexedLayer::GetFeatureCount(int bForce)
+{
+    if (IsIndexedQuery())
+        return OGRLayer::GetFeatureCount(bForce);
+    return m_poDecoratedLayer->GetFeatureCount(bForce);
+}
+
+/************************************************************************/
+/*                         InvalidateIndex()                            */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::InvalidateIndex()
+{
+    m_bIndexBuilt = false;
+    m_bIndexFileStale = true;
+    m_bQueryDone = false;
+    m_aoItems.clear();
+    m_aoLevels.clear();
+    m_anCandidates.clear();
+    m_iNextCandidate = 0;
+}
+
+/************************************************************************/
+/*                            ISetFeature()                             */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::ISetFeature(OGRFeature *poFeature)
+{
+    InvalidateIndex();
+    return OGRLayerDecorator::ISetFeature(poFeature);
+}
+
+/************************************************************************/
+/*                          ICreateFeature()                            */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::ICreateFeature(OGRFeature *poFeature)
+{
+    InvalidateIndex();
+    return OGRLayerDecorator::ICreateFeature(poFeature);
+}
+
+/************************************************************************/
+/*                          IUpsertFeature()                            */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::IUpsertFeature(OGRFeature *poFeature)
+{
+    InvalidateIndex();
+    return OGRLayerDecorator::IUpsertFeature(poFeature);
+}
+
+/************************************************************************/
+/*                          IUpdateFeature()                            */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::IUpdateFeature(
+    OGRFeature *poFeature, int nUpdatedFieldsCount,
+    const int *panUpdatedFieldsIdx, int nUpdatedGeomFieldsCount,
+    const int *panUpdatedGeomFieldsIdx, bool bUpdateStyleString)
+{
+    InvalidateIndex();
+    return OGRLayerDecorator::IUpdateFeature(
+        poFeature, nUpdatedFieldsCount, panUpdatedFieldsIdx,
+        nUpdatedGeomFieldsCount, panUpdatedGeomFieldsIdx, bUpdateStyleString);
+}
+
+/************************************************************************/
+/*                           DeleteFeature()                            */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::DeleteFeature(GIntBig nFID)
+{
+    InvalidateIndex();
+    return OGRLayerDecorator::DeleteFeature(nFID);
+}
+
+/************************************************************************/
+/*                          TestCapability()                            */
+/************************************************************************/
+
+int OGRSpatialIndexedLayer::TestCapability(const char *pszCap)
+{
+    if (EQUAL(pszCap, OLCFastSpatialFilter) &&
+        (m_bRandomRead || m_bFastSetNextByIndex))
+    {
+        return TRUE;
+    }
+    if ((EQUAL(pszCap, OLCFastFeatureCount) ||
+         EQUAL(pszCap, OLCFastSetNextByIndex)) &&
+        IsIndexedQuery())
+    {
+        return FALSE;
+    }
+    return OGRLayerDecorator::TestCapability(pszCap);
+}
+
+/************************************************************************/
+/*                         GetSourceFileStat()                          */
+/************************************************************************/
+
+/** Size and modification time of the source file, used to check that an
+ * index file is up to date. */
+bool OGRSpatialIndexedLayer::GetSourceFileStat(GUIntBig &nSize,
+                                               GIntBig &nMTime)
+{
+    std::string osFilename(m_osSourceFilename);
+    if (osFilename.empty())
+    {
+        GDALDataset *poDS = m_poDecoratedLayer->GetDataset();
+        if (poDS == nullptr)
+            return false;
+        osFilename = poDS->GetDescription();
+    }
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0)
+        return false;
+    nSize = static_cast<GUIntBig>(sStat.st_size);
+    nMTime = static_cast<GIntBig>(sStat.st_mtime);
+    return true;
+}
+
+/************************************************************************/
+/*                           ReadIndexFile()                            */
+/************************************************************************/
+
+bool OGRSpatialIndexedLayer::ReadIndexFile()
+{
+    GUIntBig nSrcSize = 0;
+    GIntBig nSrcMTime = 0;
+    if (!GetSourceFileStat(nSrcSize, nSrcMTime))
+        return false;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(m_osIndexFilename.c_str(), &sStat) != 0 ||
+        static_cast<uint64_t>(sStat.st_size) < INDEX_FILE_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osIndexFilename.c_str(), "rb"));
+    if (!fp)
+        return false;
+
+    GByte abyHeader[INDEX_FILE_HEADER_SIZE];
+    if (fp->Read(abyHeader, INDEX_FILE_HEADER_SIZE, 1) != 1 ||
+        memcmp(abyHeader, INDEX_FILE_MAGIC, INDEX_FILE_MAGIC_SIZE) != 0)
+    {
+        return false;
+    }
+    size_t nOffset = INDEX_FILE_MAGIC_SIZE;
+    uint32_t nVersion;
+    memcpy(&nVersion, abyHeader + nOffset, sizeof(nVersion));
+    CPL_LSBPTR32(&nVersion);
+    nOffset += sizeof(nVersion);
+    int32_t iGeomField;
+    memcpy(&iGeomField, abyHeader + nOffset, sizeof(iGeomField));
+    CPL_LSBPTR32(&iGeomField);
+    nOffset += sizeof(iGeomField);
+    uint64_t nSize;
+    memcpy(&nSize, abyHeader + nOffset, sizeof(nSize));
+    CPL_LSBPTR64(&nSize);
+    nOffset += sizeof(nSize);
+    int64_t nMTime;
+    memcpy(&nMTime, abyHeader + nOffset, sizeof(nMTime));
+    CPL_LSBPTR64(&nMTime);
+    nOffset += sizeof(nMTime);
+    uint64_t nItems;
+    memcpy(&nItems, abyHeader + nOffset, sizeof(nItems));
+    CPL_LSBPTR64(&nItems);
+
+    if (nVersion != INDEX_FILE_VERSION || iGeomField != m_iGeomField ||
+        nSize != nSrcSize || nMTime != nSrcMTime ||
+        nItems > (static_cast<uint64_t>(sStat.st_size) -
+                  INDEX_FILE_HEADER_SIZE) /
+                     INDEX_FILE_ITEM_SIZE)
+    {
+        CPLDebug("OGR", "Index file %s is out of date or invalid",
+                 m_osIndexFilename.c_str());
+        return false;
+    }
+
+    std::vector<GByte> abyItems;
+    try
+    {
+        abyItems.resize(static_cast<size_t>(nItems) * INDEX_FILE_ITEM_SIZE);
+        m_aoItems.resize(static_cast<size_t>(nItems));
+    }
+    catch (const std::exception &)
+    {
+        m_aoItems.clear();
+        return false;
+    }
+    if (nItems && fp->Read(abyItems.data(), abyItems.size(), 1) != 1)
+    {
+        m_aoItems.clear();
+        return false;
+    }
+
+    const GByte *pabyItem = abyItems.data();
+    for (auto &oItem : m_aoItems)
+    {
+        double adfEnv[4];
+        memcpy(adfEnv, pabyItem, sizeof(adfEnv));
+        for (double &dfVal : adfEnv)
+            CPL_LSBPTR64(&dfVal);
+        oItem.sEnvelope.MinX = adfEnv[0];
+        oItem.sEnvelope.MinY = adfEnv[1];
+        oItem.sEnvelope.MaxX = adfEnv[2];
+        oItem.sEnvelope.MaxY = adfEnv[3];
+        int64_t anVals[2];
+        memcpy(anVals, pabyItem + sizeof(adfEnv), sizeof(anVals));
+        CPL_LSBPTR64(&anVals[0]);
+        CPL_LSBPTR64(&anVals[1]);
+        oItem.nFID = anVals[0];
+        oItem.nIndex = anVals[1];
+        pabyItem += INDEX_FILE_ITEM_SIZE;
+    }
+
+    CPLDebug("OGR", "Spatial index of layer %s read from %s", GetDescription(),
+             m_osIndexFilename.c_str());
+    return true;
+}
+
+/************************************************************************/
+/*                          WriteIndexFile()                            */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::WriteIndexFile()
+{
+    GUIntBig nSrcSize = 0;
+    GIntBig nSrcMTime = 0;
+    if (!GetSourceFileStat(nSrcSize, nSrcMTime))
+        return;
+
+    // The index filename may come from an untrusted VRT file: never
+    // overwrite a file that is not a previous index file.
+    VSIStatBufL sStat;
+    const bool bExists = VSIStatL(m_osIndexFilename.c_str(), &sStat) == 0;
+    if (bExists)
+    {
+        VSIVirtualHandleUniquePtr fpExisting(
+            VSIFOpenL(m_osIndexFilename.c_str(), "rb"));
+        GByte abyMagic[INDEX_FILE_MAGIC_SIZE];
+        if (!fpExisting || VSI_ISDIR(sStat.st_mode) ||
+            fpExisting->Read(abyMagic, INDEX_FILE_MAGIC_SIZE, 1) != 1 ||
+            memcmp(abyMagic, INDEX_FILE_MAGIC, INDEX_FILE_MAGIC_SIZE) != 0)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "%s exists and is not a spatial index file. "
+                     "Not overwriting it",
+                     m_osIndexFilename.c_str());
+            return;
+        }
+    }
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osIndexFilename.c_str(), "wb"));
+    if (!fp)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot create %s",
+                 m_osIndexFilename.c_str());
+        return;
+    }
+
+    GByte abyHeader[INDEX_FILE_HEADER_SIZE];
+    memcpy(abyHeader, INDEX_FILE_MAGIC, INDEX_FILE_MAGIC_SIZE);
+    size_t nOffset = INDEX_FILE_MAGIC_SIZE;
+    uint32_t nVersion = INDEX_FILE_VERSION;
+    CPL_LSBPTR32(&nVersion);
+    memcpy(abyHeader + nOffset, &nVersion, sizeof(nVersion));
+    nOffset += sizeof(nVersion);
+    int32_t iGeomField = m_iGeomField;
+    CPL_LSBPTR32(&iGeomField);
+    memcpy(abyHeader + nOffset, &iGeomField, sizeof(iGeomField));
+    nOffset += sizeof(iGeomField);
+    uint64_t nSize = nSrcSize;
+    CPL_LSBPTR64(&nSize);
+    memcpy(abyHeader + nOffset, &nSize, sizeof(nSize));
+    nOffset += sizeof(nSize);
+    int64_t nMTime = nSrcMTime;
+    CPL_LSBPTR64(&nMTime);
+    memcpy(abyHeader + nOffset, &nMTime, sizeof(nMTime));
+    nOffset += sizeof(nMTime);
+    uint64_t nItems = m_aoItems.size();
+    CPL_LSBPTR64(&nItems);
+    memcpy(abyHeader + nOffset, &nItems, sizeof(nItems));
+
+    bool bOK = fp->Write(abyHeader, INDEX_FILE_HEADER_SIZE, 1) == 1;
+    for (size_t i = 0; bOK && i < m_aoItems.size(); ++i)
+    {
+        const Item &oItem = m_aoItems[i];
+        GByte abyItem[INDEX_FILE_ITEM_SIZE];
+        double adfEnv[4] = {oItem.sEnvelope.MinX, oItem.sEnvelope.MinY,
+                            oItem.sEnvelope.MaxX, oItem.sEnvelope.MaxY};
+        for (double &dfVal : adfEnv)
+            CPL_LSBPTR64(&dfVal);
+        memcpy(abyItem, adfEnv, sizeof(adfEnv));
+        int64_t anVals[2] = {oItem.nFID, oItem.nIndex};
+        CPL_LSBPTR64(&anVals[0]);
+        CPL_LSBPTR64(&anVals[1]);
+        memcpy(abyItem + sizeof(adfEnv), anVals, sizeof(anVals));
+        bOK = fp->Write(abyItem, INDEX_FILE_ITEM_SIZE, 1) == 1;
+    }
+    if (fp->Close() != 0 || !bOK)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot write %s",
+                 m_osIndexFilename.c_str());
+        fp.reset();
+        // Only remove a file we have created. A truncated previous index
+        // file is rejected by ReadIndexFile() anyway.
+        if (!bExists)
+            VSIUnlink(m_osIndexFilename.c_str());
+    }
+}
+
+#endif /* #ifndef DOXYGEN_SKIP */
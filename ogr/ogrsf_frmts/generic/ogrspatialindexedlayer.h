@@ -0,0 +1,133 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Defines OGRSpatialIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef OGRSPATIALINDEXEDLAYER_H_INCLUDED
+#define OGRSPATIALINDEXEDLAYER_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrlayerdecorator.h"
+
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                        OGRSpatialIndexedLayer                        */
+/************************************************************************/
+
+/** Layer decorator that maintains an in-memory packed Hilbert R-tree of the
+ * feature envelopes of its source layer, built on the first spatial query.
+ *
+ * Spatially filtered reading then only fetches the features whose envelope
+ * intersects the filter, with GetFeature() if the source layer has the
+ * OLCRandomRead capability, or SetNextByIndex() if it has the
+ * OLCFastSetNextByIndex one. For other layers, this is a no-op decorator.
+ *
+ * If an index filename is provided, the index is read from it, as long as
+ * the size and modification time of the source file (by default the file of
+ * the dataset of the decorated layer) did not change since it was written.
+ * If bWriteIndexFile is set, a newly built index is saved in it. An existing
+ * file that is not an index file is never overwritten.
+ */
+class OGRSpatialIndexedLayer final : public OGRLayerDecorator
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRSpatialIndexedLayer)
+
+    /** Index entry of a feature */
+    struct Item
+    {
+        OGREnvelope sEnvelope{};
+        GIntBig nFID = OGRNullFID;
+        GIntBig nIndex = 0;  // Index of the feature in sequential reading
+    };
+
+    int m_iGeomField = 0;
+    std::string m_osIndexFilename{};
+    bool m_bWriteIndexFile = false;
+    std::string m_osSourceFilename{};
+    bool m_bRandomRead = false;
+    bool m_bFastSetNextByIndex = false;
+
+    bool m_bIndexBuilt = false;
+    bool m_bIndexBuildFailed = false;
+    bool m_bIndexFileStale = false;
+    // Leaf items, sorted along the Hilbert curve
+    std::vector<Item> m_aoItems{};
+    // m_aoLevels[0] are the extents of the nodes of the level just above
+    // the leaves, and the last level has a single node.
+    std::vector<std::vector<OGREnvelope>> m_aoLevels{};
+
+    bool m_bQueryDone = false;
+    std::vector<size_t> m_anCandidates{};  // indices in m_aoItems
+    size_t m_iNextCandidate = 0;
+
+    bool IsIndexedQuery() const;
+    void ForwardFilters();
+    bool BuildIndex();
+    bool ReadIndexFile();
+    void WriteIndexFile();
+    bool GetSourceFileStat(GUIntBig &nSize, GIntBig &nMTime);
+    void BuildTree();
+    void RunQuery();
+    void InvalidateIndex();
+
+  public:
+    OGRSpatialIndexedLayer(OGRLayer *poDecoratedLayer, bool bTakeOwnership,
+                           int iGeomField, const std::string &osIndexFilename,
+                           bool bWriteIndexFile,
+                           const std::string &osSourceFilename = std::string());
+
+    OGRGeometry *GetSpatialFilter() override;
+    void SetSpatialFilter(OGRGeometry *) override;
+    void SetSpatialFilterRect(double dfMinX, double dfMinY, double dfMaxX,
+                              double dfMaxY) override;
+    void SetSpatialFilter(int iGeomField, OGRGeometry *) override;
+    void SetSpatialFilterRect(int iGeomField, double dfMinX, double dfMinY,
+                              double dfMaxX, double dfMaxY) override;
+    OGRErr SetAttributeFilter(const char *) override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRErr SetNextByIndex(GIntBig nIndex) override;
+    GIntBig GetFeatureCount(int bForce = TRUE) override;
+
+    OGRErr ISetFeature(OGRFeature *poFeature) override;
+    OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    OGRErr IUpsertFeature(OGRFeature *poFeature) override;
+    OGRErr IUpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
+                          const int *panUpdatedFieldsIdx,
+                          int nUpdatedGeomFieldsCount,
+                          const int *panUpdatedGeomFieldsIdx,
+                          bool bUpdateStyleString) override;
+    OGRErr DeleteFeature(GIntBig nFID) override;
+
+    int TestCapability(const char *) override;
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif  //  OGRSPATIALINDEXEDLAYER_H_INCLUDED
@@ -30,6 +30,8 @@
 
 #include "ogrwarpedlayer.h"
 
+#include <algorithm>
+
 /************************************************************************/
 /*                          OGRWarpedLayer()                            */
 /************************************************************************/
@@ -98,6 +100,7 @@ void OGRWarpedLayer::SetSpatialFilter(int iGeomField, OGRGeometry *poGeom)
         return;
     }
 
+    ClearPendingFeatures();
     m_iGeomFieldFilter = iGeomField;
     if (InstallFilter(poGeom))
         ResetReading();
@@ -150,14 +153,25 @@ void OGRWarpedLayer::SetSpatialFilterRect(int iGeomField, double dfMinX,
 }
 
 /************************************************************************/
-/*                     SrcFeatureToWarpedFeature()                      */
+/*                           CopySrcFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRWarpedLayer::SrcFeatureToWarpedFeature(OGRFeature *poSrcFeature)
+/** Copy a feature of the decorated layer, without reprojecting it. */
+OGRFeature *OGRWarpedLayer::CopySrcFeature(OGRFeature *poSrcFeature)
 {
     OGRFeature *poFeature = new OGRFeature(GetLayerDefn());
     poFeature->SetFrom(poSrcFeature);
     poFeature->SetFID(poSrcFeature->GetFID());
+    return poFeature;
+}
+
+/************************************************************************/
+/*                     SrcFeatureToWarpedFeature()                      */
+/************************************************************************/
+
+OGRFeature *OGRWarpedLayer::SrcFeatureToWarpedFeature(OGRFeature *poSrcFeature)
+{
+    OGRFeature *poFeature = CopySrcFeature(poSrcFeature);
 
     OGRGeometry *poGeom = poFeature->GetGeomFieldRef(m_iGeomField);
     if (poGeom == nullptr)
@@ -201,6 +215,93 @@ OGRFeature *OGRWarpedLayer::WarpedFeatureToSrcFeature(OGRFeature *poFeature)
     return poSrcFeature;
 }
 
+/************************************************************************/
+/*                        ReadPendingFeatures()                         */
+/************************************************************************/
+
+/** Read a batch of features from the decorated layer and reproject their
+ * geometries with a single coordinate transformation call.
+ * The batch size grows from 1 to 256, so that callers reading only a few
+ * features do not move the cursor of the decorated layer much further.
+ */
+bool OGRWarpedLayer::ReadPendingFeatures()
+{
+    m_nPendingBatchSize = m_nPendingBatchSize == 0
+                              ? 1
+                              : std::min<size_t>(256, m_nPendingBatchSize * 2);
+
+    m_apoPendingFeatures.clear();
+    m_iNextPendingFeature = 0;
+    std::vector<OGRGeometry *> apoGeoms;
+    while (m_apoPendingFeatures.size() < m_nPendingBatchSize)
+    {
+        std::unique_ptr<OGRFeature> poSrcFeature(
+            m_poDecoratedLayer->GetNextFeature());
+        if (poSrcFeature == nullptr)
+            break;
+
+        std::unique_ptr<OGRFeature> poFeature(
+            CopySrcFeature(poSrcFeature.get()));
+        apoGeoms.push_back(poFeature->GetGeomFieldRef(m_iGeomField));
+        m_apoPendingFeatures.push_back(std::move(poFeature));
+    }
+
+    std::vector<OGRErr> aeErrors(apoGeoms.size());
+    if (!OGRGeometryFactory::transformGeometries(
+            m_poCT, static_cast<int>(apoGeoms.size()), apoGeoms.data(),
+            aeErrors.data()))
+    {
+        for (size_t i = 0; i < aeErrors.size(); ++i)
+        {
+            if (aeErrors[i] != OGRERR_NONE)
+                delete m_apoPendingFeatures[i]->StealGeometry(m_iGeomField);
+        }
+    }
+
+    return !m_apoPendingFeatures.empty();
+}
+
+/************************************************************************/
+/*                        ClearPendingFeatures()                        */
+/************************************************************************/
+
+void OGRWarpedLayer::ClearPendingFeatures()
+{
+    m_apoPendingFeatures.clear();
+    m_iNextPendingFeature = 0;
+    m_nPendingBatchSize = 0;
+}
+
+/************************************************************************/
+/*                           ResetReading()                             */
+/************************************************************************/
+
+void OGRWarpedLayer::ResetReading()
+{
+    ClearPendingFeatures();
+    OGRLayerDecorator::ResetReading();
+}
+
+/************************************************************************/
+/*                          SetNextByIndex()                            */
+/************************************************************************/
+
+OGRErr OGRWarpedLayer::SetNextByIndex(GIntBig nIndex)
+{
+    ClearPendingFeatures();
+    return OGRLayerDecorator::SetNextByIndex(nIndex);
+}
+
+/************************************************************************/
+/*                        SetAttributeFilter()                          */
+/************************************************************************/
+
+OGRErr OGRWarpedLayer::SetAttributeFilter(const char *pszFilter)
+{
+    ClearPendingFeatures();
+    return OGRLayerDecorator::SetAttributeFilter(pszFilter);
+}
+
 /************************************************************************/
 /*                          GetNextFeature()                            */
 /************************************************************************/
@@ -209,12 +310,14 @@ OGRFeature *OGRWarpedLayer::GetNextFeature()
 {
     while (true)
     {
-        OGRFeature *poFeature = m_poDecoratedLayer->GetNextFeature();
-        if (poFeature == nullptr)
+        if (m_iNextPendingFeature == m_apoPendingFeatures.size() &&
+            !ReadPendingFeatures())
+        {
             return nullptr;
+        }
 
-        OGRFeature *poFeatureNew = SrcFeatureToWarpedFeature(poFeature);
-        delete poFeature;
+        OGRFeature *poFeatureNew =
+            m_apoPendingFeatures[m_iNextPendingFeature++].release();
 
         OGRGeometry *poGeom = poFeatureNew->GetGeomFieldRef(m_iGeomField);
         if (m_poFilterGeom != nullptr && !FilterGeometry(poGeom))
@@ -34,6 +34,9 @@
 
 #include "ogrlayerdecorator.h"
 
+#include <memory>
+#include <vector>
+
 /************************************************************************/
 /*                           OGRWarpedLayer                             */
 /************************************************************************/
@@ -52,10 +55,19 @@ class OGRWarpedLayer : public OGRLayerDecorator
 
     OGREnvelope sStaticEnvelope{};
 
+    // Features read ahead from the decorated layer, so that their geometries
+    // are reprojected in a single batch.
+    std::vector<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
+    size_t m_iNextPendingFeature = 0;
+    size_t m_nPendingBatchSize = 0;
+
     static int ReprojectEnvelope(OGREnvelope *psEnvelope,
                                  OGRCoordinateTransformation *poCT);
 
+    OGRFeature *CopySrcFeature(OGRFeature *poSrcFeature);
     OGRFeature *SrcFeatureToWarpedFeature(OGRFeature *poFeature);
+    bool ReadPendingFeatures();
+    void ClearPendingFeatures();
     OGRFeature *WarpedFeatureToSrcFeature(OGRFeature *poFeature);
 
   public:
@@ -77,6 +89,10 @@ class OGRWarpedLayer : public OGRLayerDecorator
                                       double dfMinY, double dfMaxX,
                                       double dfMaxY) override;
 
+    virtual void ResetReading() override;
+    virtual OGRErr SetNextByIndex(GIntBig nIndex) override;
+    virtual OGRErr SetAttributeFilter(const char *) override;
+
     virtual OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
     virtual OGRErr ISetFeature(OGRFeature *poFeature) override;
@@ -33,9 +33,12 @@
 #include "ogrjsoncollectionstreamingparser.h"
 #include "ogr_api.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
+#include <memory>
 #include <set>
-#include <functional>
 
 /************************************************************************/
 /*                      OGRGeoJSONReaderStreamingParser                 */
@@ -57,12 +60,15 @@ class OGRGeoJSONReaderStreamingParser final
     gdal::DirectedAcyclicGraph<int, std::string> m_dag{};
 
     void AnalyzeFeature();
+    void StoreFeature(OGRFeature *poFeat);
 
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONReaderStreamingParser)
 
   protected:
     void GotFeature(json_object *poObj, bool bFirstPass,
                     const std::string &osJson) override;
+    void GotFeatureTape(const OGRJSONTape &oTape, bool bFirstPass,
+                        const std::string &osJson) override;
     void TooComplex() override;
 
   public:
@@ -250,6 +256,12 @@ OGRGeoJSONReaderStreamingParser::OGRGeoJSONReaderStreamingParser(
           OGRGeoJSONReaderStreamingParserGetMaxObjectSize()),
       m_oReader(oReader), m_poLayer(poLayer)
 {
+    // Features of the second pass are directly built from the parsing
+    // events, without intermediate json-c objects.
+    // Undocumented: for testing purposes only
+    SetUseTape(!bFirstPass &&
+               CPLTestBool(CPLGetConfigOption(
+                   "OGR_GEOJSON_READ_FEATURES_WITHOUT_JSONC", "YES")));
 }
 
 /************************************************************************/
@@ -298,42 +310,60 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
     }
     else
     {
-        OGRFeature *poFeat =
-            m_oReader.ReadFeature(m_poLayer, poObj, osJson.c_str());
-        if (poFeat)
+        StoreFeature(m_oReader.ReadFeature(m_poLayer, poObj, osJson.c_str()));
+    }
+}
+
+/************************************************************************/
+/*                          GotFeatureTape()                            */
+/************************************************************************/
+
+void OGRGeoJSONReaderStreamingParser::GotFeatureTape(
+    const OGRJSONTape &oTape, bool /* bFirstPass */, const std::string &osJson)
+{
+    // Only called for the second pass
+    StoreFeature(m_oReader.ReadFeature(m_poLayer, oTape, osJson.c_str()));
+}
+
+/************************************************************************/
+/*                          StoreFeature()                              */
+/************************************************************************/
+
+void OGRGeoJSONReaderStreamingParser::StoreFeature(OGRFeature *poFeat)
+{
+    if (poFeat)
+    {
+        GIntBig nFID = poFeat->GetFID();
+        if (nFID == OGRNullFID)
         {
-            GIntBig nFID = poFeat->GetFID();
-            if (nFID == OGRNullFID)
+            nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
+            while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
             {
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-                {
-                    ++nFID;
-                }
+                ++nFID;
             }
-            else if (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
+        }
+        else if (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
+        {
+            if (!m_bOriginalIdModifiedEmitted)
             {
-                if (!m_bOriginalIdModifiedEmitted)
-                {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Several features with id = " CPL_FRMT_GIB " have "
-                             "been found. Altering it to be unique. "
-                             "This warning will not be emitted anymore for "
-                             "this layer",
-                             nFID);
-                    m_bOriginalIdModifiedEmitted = true;
-                }
-                nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
-                while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
-                {
-                    ++nFID;
-                }
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Several features with id = " CPL_FRMT_GIB " have "
+                         "been found. Altering it to be unique. "
+                         "This warning will not be emitted anymore for "
+                         "this layer",
+                         nFID);
+                m_bOriginalIdModifiedEmitted = true;
+            }
+            nFID = static_cast<GIntBig>(m_oSetUsedFIDs.size());
+            while (m_oSetUsedFIDs.find(nFID) != m_oSetUsedFIDs.end())
+            {
+                ++nFID;
             }
-            m_oSetUsedFIDs.insert(nFID);
-            poFeat->SetFID(nFID);
-
-            m_apoFeatures.push_back(poFeat);
         }
+        m_oSetUsedFIDs.insert(nFID);
+        poFeat->SetFID(nFID);
+
+        m_apoFeatures.push_back(poFeat);
     }
 }
 
@@ -2008,8 +2038,16 @@ bool OGRGeoJSONReader::AddFeature(OGRGeoJSONLayer *poLayer,
 OGRGeometry *OGRGeoJSONBaseReader::ReadGeometry(json_object *poObj,
                                                 OGRSpatialReference *poLayerSRS)
 {
-    OGRGeometry *poGeometry = OGRGeoJSONReadGeometry(poObj, poLayerSRS);
+    return WrapGeometryIfNeeded(OGRGeoJSONReadGeometry(poObj, poLayerSRS));
+}
 
+/************************************************************************/
+/*                        WrapGeometryIfNeeded()                        */
+/************************************************************************/
+
+OGRGeometry *
+OGRGeoJSONBaseReader::WrapGeometryIfNeeded(OGRGeometry *poGeometry) const
+{
     /* -------------------------------------------------------------------- */
     /*      Wrap geometry with GeometryCollection as a common denominator.  */
     /*      Sometimes a GeoJSON text may consist of objects of different    */
@@ -2211,6 +2249,20 @@ void OGRGeoJSONReaderSetField(OGRLayer *poLayer, OGRFeature *poFeature,
     }
 }
 
+/************************************************************************/
+/*                OGRGeoJSONReaderWarnMissingGeometry()                 */
+/************************************************************************/
+
+static void OGRGeoJSONReaderWarnMissingGeometry()
+{
+    static std::atomic<bool> bWarned{false};
+    if (!bWarned.exchange(true))
+    {
+        CPLDebug("GeoJSON",
+                 "Non conformant Feature object. Missing \'geometry\' member.");
+    }
+}
+
 /************************************************************************/
 /*                           ReadFeature()                              */
 /************************************************************************/
@@ -2363,17 +2415,483 @@ OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
     }
     else
     {
-        static bool bWarned = false;
-        if (!bWarned)
+        OGRGeoJSONReaderWarnMissingGeometry();
+    }
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                   OGRGeoJSONReadPositionFromTape()                   */
+/************************************************************************/
+
+// Read a position made only of numbers. Returns false in all other cases,
+// which must be handled by OGRGeoJSONReadRawPoint()
+static bool OGRGeoJSONReadPositionFromTape(const OGRJSONTape &oTape,
+                                           size_t nIdx, double &dfX,
+                                           double &dfY, double &dfZ,
+                                           bool &bHasZ)
+{
+    const auto &oPos = oTape[nIdx];
+    if (oPos.eType != OGRJSONTape::Type::ARRAY ||
+        oPos.nVal < GeoJSONObject::eMinCoordinateDimension ||
+        oPos.nEnd != nIdx + 1 + oPos.nVal)
+    {
+        return false;
+    }
+    double adfCoords[GeoJSONObject::eMaxCoordinateDimension] = {0, 0, 0};
+    for (size_t i = 0; i < oPos.nVal; ++i)
+    {
+        const auto &oCoord = oTape[nIdx + 1 + i];
+        double dfVal;
+        if (oCoord.eType == OGRJSONTape::Type::REAL)
+            dfVal = oCoord.dfVal;
+        else if (oCoord.eType == OGRJSONTape::Type::INTEGER)
+            dfVal = static_cast<double>(oCoord.nIntVal);
+        else
+            return false;
+        if (i < GeoJSONObject::eMaxCoordinateDimension)
+            adfCoords[i] = dfVal;
+    }
+    dfX = adfCoords[0];
+    dfY = adfCoords[1];
+    dfZ = adfCoords[2];
+    bHasZ = oPos.nVal >= GeoJSONObject::eMaxCoordinateDimension;
+    return true;
+}
+
+/************************************************************************/
+/*                  OGRGeoJSONReadSimpleCurveFromTape()                 */
+/************************************************************************/
+
+static bool OGRGeoJSONReadSimpleCurveFromTape(const OGRJSONTape &oTape,
+                                              size_t nIdx,
+                                              OGRSimpleCurve *poCurve)
+{
+    const auto &oPoints = oTape[nIdx];
+    if (oPoints.eType != OGRJSONTape::Type::ARRAY ||
+        oPoints.nVal > static_cast<size_t>(INT_MAX))
+    {
+        return false;
+    }
+    poCurve->setNumPoints(static_cast<int>(oPoints.nVal));
+    int iPoint = 0;
+    for (size_t i = nIdx + 1; i < oPoints.nEnd; i = oTape.GetNext(i))
+    {
+        double dfX, dfY, dfZ;
+        bool bHasZ;
+        if (!OGRGeoJSONReadPositionFromTape(oTape, i, dfX, dfY, dfZ, bHasZ))
+            return false;
+        if (bHasZ)
+            poCurve->setPoint(iPoint, dfX, dfY, dfZ);
+        else
+            poCurve->setPoint(iPoint, dfX, dfY);
+        ++iPoint;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    OGRGeoJSONReadPolygonFromTape()                   */
+/************************************************************************/
+
+static OGRPolygon *OGRGeoJSONReadPolygonFromTape(const OGRJSONTape &oTape,
+                                                 size_t nIdx)
+{
+    const auto &oRings = oTape[nIdx];
+    if (oRings.eType != OGRJSONTape::Type::ARRAY)
+        return nullptr;
+    auto poPolygon = std::make_unique<OGRPolygon>();
+    for (size_t i = nIdx + 1; i < oRings.nEnd; i = oTape.GetNext(i))
+    {
+        auto poRing = std::make_unique<OGRLinearRing>();
+        if (!OGRGeoJSONReadSimpleCurveFromTape(oTape, i, poRing.get()))
+            return nullptr;
+        poPolygon->addRingDirectly(poRing.release());
+    }
+    return poPolygon.release();
+}
+
+/************************************************************************/
+/*                   OGRGeoJSONReadGeometryFromTape()                   */
+/************************************************************************/
+
+// Read the most common geometry objects directly from the tape.
+// Returns nullptr for anything else (GeometryCollection, "crs" member,
+// invalid or unusual content...), in which case the geometry must be read
+// through OGRGeoJSONReadGeometry(), so that error reporting and handling of
+// corner cases are the same.
+static OGRGeometry *OGRGeoJSONReadGeometryFromTape(const OGRJSONTape &oTape,
+                                                   size_t nIdx)
+{
+    const auto &oObj = oTape[nIdx];
+    if (oObj.eType != OGRJSONTape::Type::OBJECT)
+        return nullptr;
+
+    size_t nTypeIdx = 0;
+    size_t nCoordsIdx = 0;
+    for (size_t i = nIdx + 1; i < oObj.nEnd; i = oTape.GetNext(i + 1))
+    {
+        const char *pszKey = oTape.GetString(i);
+        if (EQUAL(pszKey, "type"))
         {
-            bWarned = true;
-            CPLDebug(
-                "GeoJSON",
-                "Non conformant Feature object. Missing \'geometry\' member.");
+            if (nTypeIdx)
+                return nullptr;
+            nTypeIdx = i + 1;
+        }
+        else if (EQUAL(pszKey, "coordinates"))
+        {
+            if (nCoordsIdx)
+                return nullptr;
+            nCoordsIdx = i + 1;
         }
+        else if (EQUAL(pszKey, "crs"))
+        {
+            return nullptr;
+        }
+    }
+    if (nTypeIdx == 0 || nCoordsIdx == 0 ||
+        oTape[nTypeIdx].eType != OGRJSONTape::Type::STRING ||
+        oTape[nCoordsIdx].eType != OGRJSONTape::Type::ARRAY)
+    {
+        return nullptr;
     }
 
-    return poFeature;
+    const char *pszType = oTape.GetString(nTypeIdx);
+    const auto &oCoords = oTape[nCoordsIdx];
+    if (EQUAL(pszType, "Point"))
+    {
+        double dfX, dfY, dfZ;
+        bool bHasZ;
+        if (!OGRGeoJSONReadPositionFromTape(oTape, nCoordsIdx, dfX, dfY, dfZ,
+                                            bHasZ))
+        {
+            return nullptr;
+        }
+        return bHasZ ? new OGRPoint(dfX, dfY, dfZ) : new OGRPoint(dfX, dfY);
+    }
+    else if (EQUAL(pszType, "LineString"))
+    {
+        auto poLine = std::make_unique<OGRLineString>();
+        if (!OGRGeoJSONReadSimpleCurveFromTape(oTape, nCoordsIdx,
+                                               poLine.get()))
+            return nullptr;
+        return poLine.release();
+    }
+    else if (EQUAL(pszType, "Polygon"))
+    {
+        return OGRGeoJSONReadPolygonFromTape(oTape, nCoordsIdx);
+    }
+    else if (EQUAL(pszType, "MultiPoint"))
+    {
+        auto poMP = std::make_unique<OGRMultiPoint>();
+        for (size_t i = nCoordsIdx + 1; i < oCoords.nEnd; i = oTape.GetNext(i))
+        {
+            double dfX, dfY, dfZ;
+            bool bHasZ;
+            if (!OGRGeoJSONReadPositionFromTape(oTape, i, dfX, dfY, dfZ,
+                                                bHasZ))
+            {
+                return nullptr;
+            }
+            if (bHasZ)
+                poMP->addGeometryDirectly(new OGRPoint(dfX, dfY, dfZ));
+            else
+                poMP->addGeometryDirectly(new OGRPoint(dfX, dfY));
+        }
+        return poMP.release();
+    }
+    else if (EQUAL(pszType, "MultiLineString"))
+    {
+        auto poMLS = std::make_unique<OGRMultiLineString>();
+        for (size_t i = nCoordsIdx + 1; i < oCoords.nEnd; i = oTape.GetNext(i))
+        {
+            auto poLine = std::make_unique<OGRLineString>();
+            if (!OGRGeoJSONReadSimpleCurveFromTape(oTape, i, poLine.get()))
+                return nullptr;
+            poMLS->addGeometryDirectly(poLine.release());
+        }
+        return poMLS.release();
+    }
+    else if (EQUAL(pszType, "MultiPolygon"))
+    {
+        auto poMP = std::make_unique<OGRMultiPolygon>();
+        for (size_t i = nCoordsIdx + 1; i < oCoords.nEnd; i = oTape.GetNext(i))
+        {
+            auto poPoly = OGRGeoJSONReadPolygonFromTape(oTape, i);
+            if (!poPoly)
+                return nullptr;
+            poMP->addGeometryDirectly(poPoly);
+        }
+        return poMP.release();
+    }
+
+    return nullptr;
+}
+
+/************************************************************************/
+/*                     ReadGeometry() (from tape)                       */
+/************************************************************************/
+
+OGRGeometry *OGRGeoJSONBaseReader::ReadGeometry(const OGRJSONTape &oTape,
+                                                size_t nIdx,
+                                                OGRSpatialReference *poLayerSRS)
+{
+    OGRGeometry *poGeometry = OGRGeoJSONReadGeometryFromTape(oTape, nIdx);
+    if (poGeometry)
+    {
+        // Same as OGRGeoJSONReadGeometry() when there is no "crs" member
+        poGeometry->assignSpatialReference(
+            poLayerSRS ? poLayerSRS : OGRSpatialReference::GetWGS84SRS());
+        return WrapGeometryIfNeeded(poGeometry);
+    }
+
+    json_object *poObj = oTape.ToJSONObject(nIdx);
+    poGeometry = ReadGeometry(poObj, poLayerSRS);
+    json_object_put(poObj);
+    return poGeometry;
+}
+
+/************************************************************************/
+/*                  OGRGeoJSONReaderSetFieldFromTape()                  */
+/************************************************************************/
+
+// Same as OGRGeoJSONReaderSetField() with bFlattenNestedAttributes = false,
+// but avoiding the creation of json-c objects for the most common cases.
+static void OGRGeoJSONReaderSetFieldFromTape(OGRLayer *poLayer,
+                                             OGRFeature *poFeature, int nField,
+                                             const OGRJSONTape &oTape,
+                                             size_t nIdx)
+{
+    const auto &oVal = oTape[nIdx];
+    const OGRFieldDefn *poFieldDefn = poFeature->GetFieldDefnRef(nField);
+    const OGRFieldType eType = poFieldDefn->GetType();
+
+    switch (oVal.eType)
+    {
+        case OGRJSONTape::Type::NULL_VALUE:
+            poFeature->SetFieldNull(nField);
+            return;
+
+        case OGRJSONTape::Type::STRING:
+            if (eType != OFTInteger && eType != OFTInteger64 &&
+                eType != OFTReal && eType != OFTIntegerList &&
+                eType != OFTInteger64List && eType != OFTRealList)
+            {
+                poFeature->SetField(nField, oTape.GetString(nIdx));
+                return;
+            }
+            break;
+
+        case OGRJSONTape::Type::INTEGER:
+        case OGRJSONTape::Type::BOOLEAN:
+        {
+            const GIntBig nVal = oVal.eType == OGRJSONTape::Type::INTEGER
+                                     ? oVal.nIntVal
+                                     : (oVal.bVal ? 1 : 0);
+            if (eType == OFTInteger)
+            {
+                // Same clamping as json_object_get_int()
+                const int nIntVal = static_cast<int>(
+                    std::clamp<GIntBig>(nVal, std::numeric_limits<int>::min(),
+                                        std::numeric_limits<int>::max()));
+                poFeature->SetField(nField, nIntVal);
+                if (EQUAL(poFieldDefn->GetNameRef(), poLayer->GetFIDColumn()))
+                    poFeature->SetFID(nIntVal);
+                return;
+            }
+            else if (eType == OFTInteger64)
+            {
+                poFeature->SetField(nField, nVal);
+                if (EQUAL(poFieldDefn->GetNameRef(), poLayer->GetFIDColumn()))
+                    poFeature->SetFID(nVal);
+                return;
+            }
+            else if (eType == OFTReal)
+            {
+                poFeature->SetField(nField, static_cast<double>(nVal));
+                return;
+            }
+            break;
+        }
+
+        case OGRJSONTape::Type::REAL:
+            if (eType == OFTReal)
+            {
+                poFeature->SetField(nField, oVal.dfVal);
+                return;
+            }
+            break;
+
+        case OGRJSONTape::Type::OBJECT:
+        case OGRJSONTape::Type::ARRAY:
+        case OGRJSONTape::Type::KEY:
+            break;
+    }
+
+    json_object *poVal = oTape.ToJSONObject(nIdx);
+    OGRGeoJSONReaderSetField(poLayer, poFeature, nField,
+                             poFieldDefn->GetNameRef(), poVal, false, 0);
+    json_object_put(poVal);
+}
+
+/************************************************************************/
+/*                     ReadFeature() (from tape)                        */
+/************************************************************************/
+
+/** Translate a Feature object recorded by OGRJSONCollectionStreamingParser.
+ *
+ * The result is the same as ReadFeature() on the corresponding json-c
+ * object. Uncommon constructs are handled by building the json-c object of
+ * the relevant sub-tree, or of the whole feature.
+ */
+OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
+                                              const OGRJSONTape &oTape,
+                                              const char *pszSerializedObj)
+{
+    CPLAssert(oTape.size() > 0 &&
+              oTape[0].eType == OGRJSONTape::Type::OBJECT);
+
+    // Members are looked up case-insensitively, as done by
+    // OGRGeoJSONFindMemberByName()
+    size_t nPropsIdx = 0;
+    size_t nIdIdx = 0;
+    size_t nGeomIdx = 0;
+    bool bUseJSONC = bIsGeocouchSpatiallistFormat || bFlattenNestedAttributes_;
+    const size_t nEnd = oTape[0].nEnd;
+    for (size_t i = 1; !bUseJSONC && i < nEnd; i = oTape.GetNext(i + 1))
+    {
+        const char *pszKey = oTape.GetString(i);
+        size_t *pnIdx = nullptr;
+        if (EQUAL(pszKey, "properties"))
+            pnIdx = &nPropsIdx;
+        else if (EQUAL(pszKey, "id"))
+            pnIdx = &nIdIdx;
+        else if (EQUAL(pszKey, "geometry"))
+            pnIdx = &nGeomIdx;
+        if (pnIdx)
+        {
+            // Duplicated members are subject to json-c merging rules
+            if (*pnIdx)
+                bUseJSONC = true;
+            *pnIdx = i + 1;
+        }
+    }
+    if (bUseJSONC || nPropsIdx == 0 ||
+        oTape[nPropsIdx].eType != OGRJSONTape::Type::OBJECT)
+    {
+        json_object *poObj = oTape.ToJSONObject(0);
+        OGRFeature *poFeature = ReadFeature(poLayer, poObj, pszSerializedObj);
+        json_object_put(poObj);
+        return poFeature;
+    }
+
+    OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
+    auto poFeature = std::make_unique<OGRFeature>(poFDefn);
+
+    if (bStoreNativeData_)
+    {
+        poFeature->SetNativeData(pszSerializedObj);
+        poFeature->SetNativeMediaType("application/vnd.geo+json");
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Translate GeoJSON "properties" object to feature attributes.    */
+    /* -------------------------------------------------------------------- */
+    if (!bAttributesSkip_)
+    {
+        // Properties generally come in the order of the layer fields, so
+        // check the field following the previous one before doing a full
+        // lookup.
+        const int nFieldCount = poFDefn->GetFieldCount();
+        int nNextField = 0;
+        const size_t nPropsEnd = oTape[nPropsIdx].nEnd;
+        for (size_t i = nPropsIdx + 1; i < nPropsEnd; i = oTape.GetNext(i + 1))
+        {
+            const char *pszKey = oTape.GetString(i);
+            int nField;
+            if (nNextField < nFieldCount &&
+                strcmp(poFDefn->GetFieldDefn(nNextField)->GetNameRef(),
+                       pszKey) == 0)
+            {
+                nField = nNextField;
+            }
+            else
+            {
+                nField = poFDefn->GetFieldIndexCaseSensitive(pszKey);
+            }
+            nNextField = nField + 1;
+            if (nField < 0)
+            {
+                CPLDebug("GeoJSON", "Cannot find field %s", pszKey);
+            }
+            else
+            {
+                OGRGeoJSONReaderSetFieldFromTape(poLayer, poFeature.get(),
+                                                 nField, oTape, i + 1);
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Try to use feature-level ID if available.                       */
+    /* -------------------------------------------------------------------- */
+    if (nIdIdx > 0 && oTape[nIdIdx].eType != OGRJSONTape::Type::NULL_VALUE)
+    {
+        if (bFeatureLevelIdAsFID_)
+        {
+            if (oTape[nIdIdx].eType == OGRJSONTape::Type::INTEGER)
+            {
+                poFeature->SetFID(oTape[nIdIdx].nIntVal);
+            }
+            else
+            {
+                json_object *poObjId = oTape.ToJSONObject(nIdIdx);
+                poFeature->SetFID(
+                    static_cast<GIntBig>(json_object_get_int64(poObjId)));
+                json_object_put(poObjId);
+            }
+        }
+        else
+        {
+            const int nIdx = poFDefn->GetFieldIndexCaseSensitive("id");
+            if (nIdx >= 0 && !poFeature->IsFieldSet(nIdx))
+            {
+                if (oTape[nIdIdx].eType == OGRJSONTape::Type::STRING)
+                {
+                    poFeature->SetField(nIdx, oTape.GetString(nIdIdx));
+                }
+                else
+                {
+                    json_object *poObjId = oTape.ToJSONObject(nIdIdx);
+                    poFeature->SetField(nIdx, json_object_get_string(poObjId));
+                    json_object_put(poObjId);
+                }
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Translate geometry sub-object of GeoJSON Feature.               */
+    /* -------------------------------------------------------------------- */
+    if (nGeomIdx > 0)
+    {
+        if (oTape[nGeomIdx].eType != OGRJSONTape::Type::NULL_VALUE)
+        {
+            OGRGeometry *poGeometry =
+                ReadGeometry(oTape, nGeomIdx, poLayer->GetSpatialRef());
+            if (nullptr != poGeometry)
+            {
+                poFeature->SetGeometryDirectly(poGeometry);
+            }
+        }
+    }
+    else
+    {
+        OGRGeoJSONReaderWarnMissingGeometry();
+    }
+
+    return poFeature.release();
 }
 
 /************************************************************************/
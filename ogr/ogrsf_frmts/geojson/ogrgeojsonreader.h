@@ -60,6 +60,7 @@ class OGRGeometryCollection;
 class OGRFeature;
 class OGRGeoJSONLayer;
 class OGRSpatialReference;
+class OGRJSONTape;
 
 /************************************************************************/
 /*                           GeoJSONObject                              */
@@ -116,6 +117,11 @@ class OGRGeoJSONBaseReader
     OGRFeature *ReadFeature(OGRLayer *poLayer, json_object *poObj,
                             const char *pszSerializedObj);
 
+    OGRGeometry *ReadGeometry(const OGRJSONTape &oTape, size_t nIdx,
+                              OGRSpatialReference *poLayerSRS);
+    OGRFeature *ReadFeature(OGRLayer *poLayer, const OGRJSONTape &oTape,
+                            const char *pszSerializedObj);
+
     bool ExtentRead() const;
 
     OGREnvelope3D GetExtent3D() const;
@@ -149,6 +155,8 @@ class OGRGeoJSONBaseReader
     bool m_bExtentRead = false;
     OGRwkbGeometryType m_eLayerGeomType = wkbUnknown;
 
+    OGRGeometry *WrapGeometryIfNeeded(OGRGeometry *poGeometry) const;
+
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONBaseReader)
 };
 
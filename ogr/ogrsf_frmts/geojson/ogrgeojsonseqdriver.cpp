@@ -28,8 +28,11 @@
 
 #include "cpl_port.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_error_internal.h"
 #include "cpl_http.h"
 #include "cpl_vsi_error.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geojson.h"
 #include "ogrgeojsonreader.h"
@@ -104,7 +107,30 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
+    // Parallel parsing of records
+    struct ParsedRecord
+    {
+        std::unique_ptr<OGRFeature> poFeature{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    struct ParseRecordsJob
+    {
+        OGRGeoJSONSeqLayer *poLayer = nullptr;
+        size_t nStart = 0;
+        size_t nEnd = 0;
+    };
+
+    int m_nNumThreads = 1;
+    std::vector<std::string> m_aosRecords{};
+    std::vector<ParsedRecord> m_aoParsedRecords{};
+    size_t m_nParsedRecordIdx = 0;
+
+    bool ReadNextRecord();
     json_object *GetNextObject(bool bLooseIdentification);
+    OGRFeature *TranslateObject(json_object *poObject, const char *pszRecord);
+    bool ParseNextRecords();
+    static void ParseRecordsJobFunc(void *pData);
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -118,6 +144,11 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
 
     bool Init(bool bLooseIdentification, bool bEstablishLayerDefn);
 
+    void SetNumThreads(int nNumThreads)
+    {
+        m_nNumThreads = nNumThreads;
+    }
+
     const char *GetName() override
     {
         return GetDescription();
@@ -492,13 +523,17 @@ void OGRGeoJSONSeqLayer::ResetReading()
     m_nPosInBuffer = nBufferSizeValidated;
     m_nBufferValidSize = nBufferSizeValidated;
     m_nNextFID = 0;
+    m_aosRecords.clear();
+    m_aoParsedRecords.clear();
+    m_nParsedRecordIdx = 0;
 }
 
 /************************************************************************/
-/*                           GetNextObject()                            */
+/*                          ReadNextRecord()                            */
 /************************************************************************/
 
-json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+/** Read the next non-empty record into m_osFeatureBuffer */
+bool OGRGeoJSONSeqLayer::ReadNextRecord()
 {
     m_osFeatureBuffer.clear();
     while (true)
@@ -508,7 +543,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         {
             if (m_nBufferValidSize < m_osBuffer.size())
             {
-                return nullptr;
+                return false;
             }
             m_nBufferValidSize =
                 VSIFReadL(&m_osBuffer[0], 1, m_osBuffer.size(), m_poDS->m_fp);
@@ -532,7 +567,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             }
             if (m_nPosInBuffer >= m_nBufferValidSize)
             {
-                return nullptr;
+                return false;
             }
         }
 
@@ -560,7 +595,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
                          "for larger features, or 0 to remove any size limit.",
                          static_cast<unsigned>(m_osFeatureBuffer.size() / 1024 /
                                                1024));
-                return nullptr;
+                return false;
             }
             m_nPosInBuffer = m_nBufferValidSize;
             if (m_nBufferValidSize == m_osBuffer.size())
@@ -577,23 +612,159 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         }
         if (!m_osFeatureBuffer.empty())
         {
-            json_object *poObject = nullptr;
-            CPL_IGNORE_RET_VAL(
-                OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
-            m_osFeatureBuffer.clear();
-            if (json_object_get_type(poObject) == json_type_object)
-            {
-                return poObject;
-            }
-            json_object_put(poObject);
-            if (bLooseIdentification)
-            {
-                return nullptr;
-            }
+            return true;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           GetNextObject()                            */
+/************************************************************************/
+
+json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
+{
+    while (ReadNextRecord())
+    {
+        json_object *poObject = nullptr;
+        CPL_IGNORE_RET_VAL(OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
+        m_osFeatureBuffer.clear();
+        if (json_object_get_type(poObject) == json_type_object)
+        {
+            return poObject;
+        }
+        json_object_put(poObject);
+        if (bLooseIdentification)
+        {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          TranslateObject()                           */
+/************************************************************************/
+
+/** Build a feature from a GeoJSON Feature or geometry object.
+ *
+ * Returns nullptr for objects that must be skipped. This method may be
+ * called concurrently from several threads.
+ */
+OGRFeature *OGRGeoJSONSeqLayer::TranslateObject(json_object *poObject,
+                                                const char *pszRecord)
+{
+    const auto type = OGRGeoJSONGetType(poObject);
+    if (type == GeoJSONObject::eFeature)
+    {
+        return m_oReader.ReadFeature(this, poObject, pszRecord);
+    }
+    else if (type == GeoJSONObject::eFeatureCollection ||
+             type == GeoJSONObject::eUnknown)
+    {
+        return nullptr;
+    }
+
+    OGRGeometry *poGeom = m_oReader.ReadGeometry(poObject, GetSpatialRef());
+    if (!poGeom)
+    {
+        return nullptr;
+    }
+    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    poFeature->SetGeometryDirectly(poGeom);
+    return poFeature;
+}
+
+/************************************************************************/
+/*                       ParseRecordsJobFunc()                          */
+/************************************************************************/
+
+void OGRGeoJSONSeqLayer::ParseRecordsJobFunc(void *pData)
+{
+    const ParseRecordsJob *psJob = static_cast<ParseRecordsJob *>(pData);
+    OGRGeoJSONSeqLayer *poLayer = psJob->poLayer;
+    for (size_t i = psJob->nStart; i < psJob->nEnd; ++i)
+    {
+        const std::string &osRecord = poLayer->m_aosRecords[i];
+        ParsedRecord &oParsed = poLayer->m_aoParsedRecords[i];
+
+        // Errors are emitted later by GetNextFeature(), so that they
+        // appear in the order of the records.
+        CPLInstallErrorHandlerAccumulator(oParsed.aoErrors);
+        json_object *poObject = nullptr;
+        CPL_IGNORE_RET_VAL(OGRJSonParse(osRecord.c_str(), &poObject));
+        if (json_object_get_type(poObject) == json_type_object)
+        {
+            oParsed.poFeature.reset(
+                poLayer->TranslateObject(poObject, osRecord.c_str()));
         }
+        json_object_put(poObject);
+        CPLUninstallErrorHandlerAccumulator();
     }
 }
 
+/************************************************************************/
+/*                         ParseNextRecords()                           */
+/************************************************************************/
+
+/** Read the next batch of records and translate them to features using
+ * several threads. Returns false when there is no more record. */
+bool OGRGeoJSONSeqLayer::ParseNextRecords()
+{
+    constexpr size_t RECORDS_PER_JOB = 256;
+    constexpr size_t MAX_BATCH_BYTES = 64 * 1024 * 1024;
+
+    m_aosRecords.clear();
+    m_aoParsedRecords.clear();
+    m_nParsedRecordIdx = 0;
+
+    const size_t nMaxRecords =
+        static_cast<size_t>(m_nNumThreads) * RECORDS_PER_JOB;
+    size_t nBatchBytes = 0;
+    while (m_aosRecords.size() < nMaxRecords &&
+           nBatchBytes < MAX_BATCH_BYTES && ReadNextRecord())
+    {
+        nBatchBytes += m_osFeatureBuffer.size();
+        m_aosRecords.emplace_back(std::move(m_osFeatureBuffer));
+        m_osFeatureBuffer.clear();
+    }
+    if (m_aosRecords.empty())
+        return false;
+    m_aoParsedRecords.resize(m_aosRecords.size());
+
+    const size_t nRecords = m_aosRecords.size();
+    const size_t nJobs = std::min(
+        static_cast<size_t>(m_nNumThreads),
+        (nRecords + RECORDS_PER_JOB - 1) / RECORDS_PER_JOB);
+    std::vector<ParseRecordsJob> asJobs(nJobs);
+    for (size_t i = 0; i < nJobs; ++i)
+    {
+        asJobs[i].poLayer = this;
+        asJobs[i].nStart = i * nRecords / nJobs;
+        asJobs[i].nEnd = (i + 1) * nRecords / nJobs;
+    }
+
+    CPLWorkerThreadPool *poPool =
+        nJobs > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        for (auto &sJob : asJobs)
+            ParseRecordsJobFunc(&sJob);
+    }
+    else
+    {
+        for (auto &sJob : asJobs)
+        {
+            if (!poQueue->SubmitJob(ParseRecordsJobFunc, &sJob))
+                ParseRecordsJobFunc(&sJob);
+        }
+        poQueue->WaitCompletion();
+    }
+
+    m_aosRecords.clear();
+    return true;
+}
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -614,35 +785,32 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     GetLayerDefn();  // force scan if not already done
     while (true)
     {
-        auto poObject = GetNextObject(false);
-        if (!poObject)
-            return nullptr;
         OGRFeature *poFeature;
-        auto type = OGRGeoJSONGetType(poObject);
-        if (type == GeoJSONObject::eFeature)
-        {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
-            json_object_put(poObject);
-        }
-        else if (type == GeoJSONObject::eFeatureCollection ||
-                 type == GeoJSONObject::eUnknown)
+        if (m_nNumThreads > 1)
         {
-            json_object_put(poObject);
-            continue;
+            if (m_nParsedRecordIdx == m_aoParsedRecords.size() &&
+                !ParseNextRecords())
+            {
+                return nullptr;
+            }
+            ParsedRecord &oParsed = m_aoParsedRecords[m_nParsedRecordIdx];
+            ++m_nParsedRecordIdx;
+            for (const auto &oError : oParsed.aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            poFeature = oParsed.poFeature.release();
         }
         else
         {
-            OGRGeometry *poGeom =
-                m_oReader.ReadGeometry(poObject, GetSpatialRef());
+            auto poObject = GetNextObject(false);
+            if (!poObject)
+                return nullptr;
+            poFeature = TranslateObject(poObject, m_osFeatureBuffer.c_str());
             json_object_put(poObject);
-            if (!poGeom)
-            {
-                continue;
-            }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
         }
+        if (!poFeature)
+            continue;
 
         if (poFeature->GetFID() == OGRNullFID)
         {
@@ -884,6 +1052,11 @@ bool OGRGeoJSONSeqDataSource::Open(GDALOpenInfo *poOpenInfo,
     }
     SetDescription(poOpenInfo->pszFilename);
     auto poLayer = new OGRGeoJSONSeqLayer(this, osLayerName.c_str());
+
+    poLayer->SetNumThreads(CPLParseNumThreads(
+        CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", nullptr)),
+        1));
     const bool bLooseIdentification =
         nSrcType == eGeoJSONSourceService &&
         !STARTS_WITH_CI(poOpenInfo->pszFilename, "GeoJSONSeq:");
@@ -1058,6 +1231,13 @@ void RegisterOGRGeoJSONSeq()
         "  </Option>"
         "</LayerCreationOptionList>");
 
+    poDriver->SetMetadataItem(
+        GDAL_DMD_OPENOPTIONLIST,
+        "<OpenOptionList>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "threads used to parse records. Integer or ALL_CPUS' default='1'/>"
+        "</OpenOptionList>");
+
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONFIELDDATATYPES,
                               "Integer Integer64 Real String IntegerList "
@@ -1628,19 +1628,31 @@ static int OGR_json_double_with_precision_to_string(struct json_object *jso,
     const uintptr_t nPrecision = reinterpret_cast<uintptr_t>(userData);
     char szBuffer[75] = {};
     const double dfVal = json_object_get_double(jso);
+    size_t nLen = 0;
     if (fabs(dfVal) > 1e50 && !CPLIsInf(dfVal))
     {
         CPLsnprintf(szBuffer, sizeof(szBuffer), "%.18g", dfVal);
+        nLen = strlen(szBuffer);
     }
     else
     {
         const bool bPrecisionIsNegative =
             (nPrecision >> (8 * sizeof(nPrecision) - 1)) != 0;
-        OGRFormatDouble(szBuffer, sizeof(szBuffer), dfVal, '.',
-                        bPrecisionIsNegative ? 15
-                                             : static_cast<int>(nPrecision));
+        OGRWktOptions opts;
+        opts.format = OGRWktFormat::F;
+        opts.xyPrecision =
+            bPrecisionIsNegative ? 15 : static_cast<int>(nPrecision);
+        nLen = OGRFormatDoubleToBuffer(szBuffer, sizeof(szBuffer), dfVal, opts,
+                                       1);
+        if (nLen == 0)
+        {
+            // Very large precision
+            const std::string osVal = OGRFormatDouble(dfVal, opts, 1);
+            return printbuf_memappend(pb, osVal.c_str(),
+                                      static_cast<int>(osVal.size()));
+        }
     }
-    return printbuf_memappend(pb, szBuffer, static_cast<int>(strlen(szBuffer)));
+    return printbuf_memappend(pb, szBuffer, static_cast<int>(nLen));
 }
 
 /************************************************************************/
@@ -61,6 +61,380 @@ const size_t ESTIMATE_OBJECT_SIZE =
     ESTIMATE_BASE_OBJECT_SIZE + sizeof(struct lh_table) +
     JSON_OBJECT_DEF_HASH_ENTRIES * ESTIMATE_OBJECT_ELT_SIZE;
 
+/************************************************************************/
+/*                      OGRJSONParseNumberFast()                        */
+/************************************************************************/
+
+// Parse a number token that strictly follows the JSON grammar, with an
+// exponent of at most 3 characters, in the cases where the result can be
+// computed exactly without calling strtod(). Returns false otherwise, in
+// which case the caller must use the generic path.
+static bool OGRJSONParseNumberFast(const char *pszValue, size_t nLen,
+                                   bool &bIsInteger, GIntBig &nIntVal,
+                                   double &dfVal)
+{
+    const char *pszIter = pszValue;
+    const char *const pszEnd = pszValue + nLen;
+    bool bNegative = false;
+    if (pszIter < pszEnd && *pszIter == '-')
+    {
+        bNegative = true;
+        ++pszIter;
+    }
+    if (pszIter == pszEnd || !(*pszIter >= '0' && *pszIter <= '9'))
+        return false;
+    if (*pszIter == '0' && pszIter + 1 < pszEnd && pszIter[1] >= '0' &&
+        pszIter[1] <= '9')
+    {
+        return false;
+    }
+
+    // Significant digits, accumulated in a 64 bit integer as long as they
+    // fit (19 digits)
+    uint64_t nMantissa = 0;
+    int nDigits = 0;
+    int nExp10 = 0;
+    for (; pszIter < pszEnd && *pszIter >= '0' && *pszIter <= '9'; ++pszIter)
+    {
+        if (nDigits == 0 && *pszIter == '0')
+            continue;
+        if (++nDigits > 19)
+            return false;
+        nMantissa = nMantissa * 10 + (*pszIter - '0');
+    }
+    const int nIntDigits = nDigits;
+
+    bool bHasFraction = false;
+    if (pszIter < pszEnd && *pszIter == '.')
+    {
+        ++pszIter;
+        if (pszIter == pszEnd || !(*pszIter >= '0' && *pszIter <= '9'))
+            return false;
+        bHasFraction = true;
+        for (; pszIter < pszEnd && *pszIter >= '0' && *pszIter <= '9';
+             ++pszIter)
+        {
+            --nExp10;
+            if (nDigits == 0 && *pszIter == '0')
+                continue;
+            if (++nDigits > 19)
+                return false;
+            nMantissa = nMantissa * 10 + (*pszIter - '0');
+        }
+    }
+
+    bool bHasExponent = false;
+    if (pszIter < pszEnd && (*pszIter == 'e' || *pszIter == 'E'))
+    {
+        ++pszIter;
+        // CPLGetValueType() handles specifically exponents longer than
+        // 3 characters.
+        if (pszEnd - pszIter > 3 || pszIter == pszEnd)
+            return false;
+        bool bNegativeExp = false;
+        if (*pszIter == '+' || *pszIter == '-')
+        {
+            bNegativeExp = *pszIter == '-';
+            ++pszIter;
+        }
+        if (pszIter == pszEnd)
+            return false;
+        int nExp = 0;
+        for (; pszIter < pszEnd; ++pszIter)
+        {
+            if (!(*pszIter >= '0' && *pszIter <= '9'))
+                return false;
+            nExp = nExp * 10 + (*pszIter - '0');
+        }
+        nExp10 += bNegativeExp ? -nExp : nExp;
+        bHasExponent = true;
+    }
+    if (pszIter != pszEnd)
+        return false;
+
+    if (!bHasFraction && !bHasExponent)
+    {
+        if (nIntDigits > 18)
+            return false;
+        bIsInteger = true;
+        nIntVal = bNegative ? -static_cast<GIntBig>(nMantissa)
+                            : static_cast<GIntBig>(nMantissa);
+        return true;
+    }
+
+    // Clinger's fast path: both the mantissa and the power of ten are
+    // exactly representable as doubles, so a single multiplication or
+    // division gives the correctly rounded result.
+    constexpr uint64_t MAX_EXACT_MANTISSA = static_cast<uint64_t>(1) << 53;
+    if (nMantissa > MAX_EXACT_MANTISSA || nExp10 < -22 || nExp10 > 22)
+        return false;
+    static const double adfPow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    dfVal = static_cast<double>(nMantissa);
+    if (nExp10 < 0)
+        dfVal /= adfPow10[-nExp10];
+    else
+        dfVal *= adfPow10[nExp10];
+    if (bNegative)
+        dfVal = -dfVal;
+    bIsInteger = false;
+    return true;
+}
+
+/************************************************************************/
+/*                       OGRJSONParseNumber()                           */
+/************************************************************************/
+
+// Same semantics as the json-c objects created by
+// OGRJSONCollectionStreamingParser::Number()
+static void OGRJSONParseNumber(const char *pszValue, size_t nLen,
+                               bool &bIsInteger, GIntBig &nIntVal,
+                               double &dfVal)
+{
+    if (OGRJSONParseNumberFast(pszValue, nLen, bIsInteger, nIntVal, dfVal))
+        return;
+
+    bIsInteger = false;
+    if (CPLGetValueType(pszValue) == CPL_VALUE_REAL)
+    {
+        dfVal = CPLAtof(pszValue);
+    }
+    else if (nLen == strlen("Infinity") && EQUAL(pszValue, "Infinity"))
+    {
+        dfVal = std::numeric_limits<double>::infinity();
+    }
+    else if (nLen == strlen("-Infinity") && EQUAL(pszValue, "-Infinity"))
+    {
+        dfVal = -std::numeric_limits<double>::infinity();
+    }
+    else if (nLen == strlen("NaN") && EQUAL(pszValue, "NaN"))
+    {
+        dfVal = std::numeric_limits<double>::quiet_NaN();
+    }
+    else
+    {
+        bIsInteger = true;
+        nIntVal = CPLAtoGIntBig(pszValue);
+    }
+}
+
+/************************************************************************/
+/*                         OGRJSONTape::Clear()                         */
+/************************************************************************/
+
+void OGRJSONTape::Clear()
+{
+    m_aoEntries.clear();
+    m_osStrings.clear();
+    m_anStack.clear();
+}
+
+/************************************************************************/
+/*                        OGRJSONTape::AddValue()                       */
+/************************************************************************/
+
+void OGRJSONTape::AddValue(const Entry &oEntry)
+{
+    if (!m_anStack.empty())
+    {
+        auto &oParent = m_aoEntries[m_anStack.back()];
+        if (oParent.eType == Type::ARRAY)
+            oParent.nVal++;
+    }
+    m_aoEntries.push_back(oEntry);
+}
+
+/************************************************************************/
+/*                       OGRJSONTape::AddString()                       */
+/************************************************************************/
+
+size_t OGRJSONTape::AddString(const char *pszValue, size_t nLen)
+{
+    const size_t nOffset = m_osStrings.size();
+    m_osStrings.append(pszValue, nLen);
+    m_osStrings.push_back('\0');
+    return nOffset;
+}
+
+/************************************************************************/
+/*                     OGRJSONTape::StartObject()                       */
+/************************************************************************/
+
+void OGRJSONTape::StartObject()
+{
+    Entry oEntry;
+    oEntry.eType = Type::OBJECT;
+    AddValue(oEntry);
+    m_anStack.push_back(m_aoEntries.size() - 1);
+}
+
+/************************************************************************/
+/*                      OGRJSONTape::EndObject()                        */
+/************************************************************************/
+
+void OGRJSONTape::EndObject()
+{
+    CPLAssert(!m_anStack.empty());
+    m_aoEntries[m_anStack.back()].nEnd = m_aoEntries.size();
+    m_anStack.pop_back();
+}
+
+/************************************************************************/
+/*                      OGRJSONTape::StartArray()                       */
+/************************************************************************/
+
+void OGRJSONTape::StartArray()
+{
+    Entry oEntry;
+    oEntry.eType = Type::ARRAY;
+    AddValue(oEntry);
+    m_anStack.push_back(m_aoEntries.size() - 1);
+}
+
+/************************************************************************/
+/*                       OGRJSONTape::EndArray()                        */
+/************************************************************************/
+
+void OGRJSONTape::EndArray()
+{
+    CPLAssert(!m_anStack.empty());
+    m_aoEntries[m_anStack.back()].nEnd = m_aoEntries.size();
+    m_anStack.pop_back();
+}
+
+/************************************************************************/
+/*                         OGRJSONTape::Key()                           */
+/************************************************************************/
+
+void OGRJSONTape::Key(const char *pszKey, size_t nLen)
+{
+    CPLAssert(!m_anStack.empty());
+    m_aoEntries[m_anStack.back()].nVal++;
+    Entry oEntry;
+    oEntry.eType = Type::KEY;
+    oEntry.nVal = AddString(pszKey, nLen);
+    m_aoEntries.push_back(oEntry);
+}
+
+/************************************************************************/
+/*                        OGRJSONTape::String()                         */
+/************************************************************************/
+
+void OGRJSONTape::String(const char *pszValue, size_t nLen)
+{
+    Entry oEntry;
+    oEntry.eType = Type::STRING;
+    oEntry.nVal = AddString(pszValue, nLen);
+    AddValue(oEntry);
+}
+
+/************************************************************************/
+/*                        OGRJSONTape::Number()                         */
+/************************************************************************/
+
+void OGRJSONTape::Number(const char *pszValue, size_t nLen)
+{
+    Entry oEntry;
+    bool bIsInteger = false;
+    OGRJSONParseNumber(pszValue, nLen, bIsInteger, oEntry.nIntVal,
+                       oEntry.dfVal);
+    oEntry.eType = bIsInteger ? Type::INTEGER : Type::REAL;
+    AddValue(oEntry);
+}
+
+/************************************************************************/
+/*                       OGRJSONTape::Boolean()                         */
+/************************************************************************/
+
+void OGRJSONTape::Boolean(bool bVal)
+{
+    Entry oEntry;
+    oEntry.eType = Type::BOOLEAN;
+    oEntry.bVal = bVal;
+    AddValue(oEntry);
+}
+
+/************************************************************************/
+/*                         OGRJSONTape::Null()                          */
+/************************************************************************/
+
+void OGRJSONTape::Null()
+{
+    Entry oEntry;
+    oEntry.eType = Type::NULL_VALUE;
+    AddValue(oEntry);
+}
+
+/************************************************************************/
+/*                      OGRJSONTape::FindMember()                       */
+/************************************************************************/
+
+size_t OGRJSONTape::FindMember(size_t nObjIdx, const char *pszKey) const
+{
+    CPLAssert(m_aoEntries[nObjIdx].eType == Type::OBJECT);
+    size_t nRet = 0;
+    const size_t nEnd = m_aoEntries[nObjIdx].nEnd;
+    for (size_t i = nObjIdx + 1; i < nEnd; i = GetNext(i + 1))
+    {
+        if (strcmp(GetString(i), pszKey) == 0)
+            nRet = i + 1;
+    }
+    return nRet;
+}
+
+/************************************************************************/
+/*                     OGRJSONTape::ToJSONObject()                      */
+/************************************************************************/
+
+/** Build the json-c object corresponding to the value at nIdx. */
+json_object *OGRJSONTape::ToJSONObject(size_t nIdx) const
+{
+    const auto &oEntry = m_aoEntries[nIdx];
+    switch (oEntry.eType)
+    {
+        case Type::OBJECT:
+        {
+            json_object *poObj = json_object_new_object();
+            for (size_t i = nIdx + 1; i < oEntry.nEnd; i = GetNext(i + 1))
+            {
+                json_object_object_add(poObj, GetString(i),
+                                       ToJSONObject(i + 1));
+            }
+            return poObj;
+        }
+
+        case Type::ARRAY:
+        {
+            json_object *poObj = json_object_new_array();
+            for (size_t i = nIdx + 1; i < oEntry.nEnd; i = GetNext(i))
+            {
+                json_object_array_add(poObj, ToJSONObject(i));
+            }
+            return poObj;
+        }
+
+        case Type::KEY:
+            break;
+
+        case Type::STRING:
+            return json_object_new_string(GetString(nIdx));
+
+        case Type::INTEGER:
+            return json_object_new_int64(oEntry.nIntVal);
+
+        case Type::REAL:
+            return json_object_new_double(oEntry.dfVal);
+
+        case Type::BOOLEAN:
+            return json_object_new_boolean(oEntry.bVal);
+
+        case Type::NULL_VALUE:
+            break;
+    }
+    return nullptr;
+}
+
 /************************************************************************/
 /*                     OGRJSONCollectionStreamingParser()                */
 /************************************************************************/
@@ -132,8 +506,17 @@ void OGRJSONCollectionStreamingParser::StartObject()
 
     if (m_bInFeaturesArray && m_nDepth == 2)
     {
-        m_poCurObj = json_object_new_object();
-        m_apoCurObj.push_back(m_poCurObj);
+        if (m_bUseTape && !m_bFirstPass)
+        {
+            m_bInTapeFeature = true;
+            m_oTape.Clear();
+            m_oTape.StartObject();
+        }
+        else
+        {
+            m_poCurObj = json_object_new_object();
+            m_apoCurObj.push_back(m_poCurObj);
+        }
         if (m_bStoreNativeData)
         {
             m_osJson = "{";
@@ -141,7 +524,7 @@ void OGRJSONCollectionStreamingParser::StartObject()
         }
         m_bStartFeature = true;
     }
-    else if (m_poCurObj)
+    else if (m_poCurObj || m_bInTapeFeature)
     {
         if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
         {
@@ -151,9 +534,16 @@ void OGRJSONCollectionStreamingParser::StartObject()
 
         m_nCurObjMemEstimate += ESTIMATE_OBJECT_SIZE;
 
-        json_object *poNewObj = json_object_new_object();
-        AppendObject(poNewObj);
-        m_apoCurObj.push_back(poNewObj);
+        if (m_bInTapeFeature)
+        {
+            m_oTape.StartObject();
+        }
+        else
+        {
+            json_object *poNewObj = json_object_new_object();
+            AppendObject(poNewObj);
+            m_apoCurObj.push_back(poNewObj);
+        }
     }
     else if (m_bFirstPass && m_nDepth == 0)
     {
@@ -179,7 +569,34 @@ void OGRJSONCollectionStreamingParser::EndObject()
 
     m_nDepth--;
 
-    if (m_bInFeaturesArray && m_nDepth == 2 && m_poCurObj)
+    if (m_bInFeaturesArray && m_nDepth == 2 && m_bInTapeFeature)
+    {
+        if (m_bStoreNativeData)
+        {
+            m_abFirstMember.pop_back();
+            m_osJson += "}";
+            m_nTotalOGRFeatureMemEstimate +=
+                m_osJson.size() + strlen("application/vnd.geo+json");
+        }
+
+        m_oTape.EndObject();
+        const size_t nTypeIdx = m_oTape.FindMember(0, "type");
+        if (nTypeIdx > 0 &&
+            m_oTape[nTypeIdx].eType == OGRJSONTape::Type::STRING &&
+            strcmp(m_oTape.GetString(nTypeIdx), "Feature") == 0)
+        {
+            GotFeatureTape(m_oTape, m_bFirstPass, m_osJson);
+        }
+
+        m_bInTapeFeature = false;
+        m_nCurObjMemEstimate = 0;
+        m_bInCoordinates = false;
+        m_nTotalOGRFeatureMemEstimate += sizeof(OGRFeature);
+        m_osJson.clear();
+        m_abFirstMember.clear();
+        m_bEndFeature = true;
+    }
+    else if (m_bInFeaturesArray && m_nDepth == 2 && m_poCurObj)
     {
         if (m_bStoreNativeData)
         {
@@ -211,7 +628,7 @@ void OGRJSONCollectionStreamingParser::EndObject()
         m_abFirstMember.clear();
         m_bEndFeature = true;
     }
-    else if (m_poCurObj)
+    else if (m_poCurObj || m_bInTapeFeature)
     {
         if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
         {
@@ -219,7 +636,10 @@ void OGRJSONCollectionStreamingParser::EndObject()
             m_osJson += "}";
         }
 
-        m_apoCurObj.pop_back();
+        if (m_bInTapeFeature)
+            m_oTape.EndObject();
+        else
+            m_apoCurObj.pop_back();
     }
     else if (m_nDepth == 1)
     {
@@ -265,7 +685,7 @@ void OGRJSONCollectionStreamingParser::StartObjectMember(const char *pszKey,
                            strcmp(pszKey, "geometries") == 0;
     }
 
-    if (m_poCurObj)
+    if (m_poCurObj || m_bInTapeFeature)
     {
         if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
         {
@@ -277,8 +697,15 @@ void OGRJSONCollectionStreamingParser::StartObjectMember(const char *pszKey,
         }
 
         m_nCurObjMemEstimate += ESTIMATE_OBJECT_ELT_SIZE;
-        m_osCurKey.assign(pszKey, nKeyLen);
-        m_bKeySet = true;
+        if (m_bInTapeFeature)
+        {
+            m_oTape.Key(pszKey, nKeyLen);
+        }
+        else
+        {
+            m_osCurKey.assign(pszKey, nKeyLen);
+            m_bKeySet = true;
+        }
     }
 }
 
@@ -298,7 +725,7 @@ void OGRJSONCollectionStreamingParser::StartArray()
     {
         m_bInFeaturesArray = true;
     }
-    else if (m_poCurObj)
+    else if (m_poCurObj || m_bInTapeFeature)
     {
         if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
         {
@@ -308,9 +735,16 @@ void OGRJSONCollectionStreamingParser::StartArray()
 
         m_nCurObjMemEstimate += ESTIMATE_ARRAY_SIZE;
 
-        json_object *poNewObj = json_object_new_array();
-        AppendObject(poNewObj);
-        m_apoCurObj.push_back(poNewObj);
+        if (m_bInTapeFeature)
+        {
+            m_oTape.StartArray();
+        }
+        else
+        {
+            json_object *poNewObj = json_object_new_array();
+            AppendObject(poNewObj);
+            m_apoCurObj.push_back(poNewObj);
+        }
     }
     m_nDepth++;
 }
@@ -321,7 +755,7 @@ void OGRJSONCollectionStreamingParser::StartArray()
 
 void OGRJSONCollectionStreamingParser::StartArrayMember()
 {
-    if (m_poCurObj)
+    if (m_poCurObj || m_bInTapeFeature)
     {
         m_nCurObjMemEstimate += ESTIMATE_ARRAY_ELT_SIZE;
 
@@ -351,7 +785,7 @@ void OGRJSONCollectionStreamingParser::EndArray()
     {
         m_bInFeaturesArray = false;
     }
-    else if (m_poCurObj)
+    else if (m_poCurObj || m_bInTapeFeature)
     {
         if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
         {
@@ -359,7 +793,10 @@ void OGRJSONCollectionStreamingParser::EndArray()
             m_osJson += "]";
         }
 
-        m_apoCurObj.pop_back();
+        if (m_bInTapeFeature)
+            m_oTape.EndArray();
+        else
+            m_apoCurObj.pop_back();
     }
 }
 
@@ -380,6 +817,14 @@ void OGRJSONCollectionStreamingParser::String(const char *pszValue, size_t nLen)
         m_bIsTypeKnown = true;
         m_bIsFeatureCollection = strcmp(pszValue, "FeatureCollection") == 0;
     }
+    else if (m_bInTapeFeature)
+    {
+        if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
+        {
+            m_osJson += CPLJSonStreamingParser::GetSerializedString(pszValue);
+        }
+        m_oTape.String(pszValue, nLen);
+    }
     else if (m_poCurObj)
     {
         if (m_bFirstPass)
@@ -410,7 +855,15 @@ void OGRJSONCollectionStreamingParser::Number(const char *pszValue, size_t nLen)
         return;
     }
 
-    if (m_poCurObj)
+    if (m_bInTapeFeature)
+    {
+        if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
+        {
+            m_osJson.append(pszValue, nLen);
+        }
+        m_oTape.Number(pszValue, nLen);
+    }
+    else if (m_poCurObj)
     {
         if (m_bFirstPass)
         {
@@ -429,29 +882,14 @@ void OGRJSONCollectionStreamingParser::Number(const char *pszValue, size_t nLen)
             m_osJson.append(pszValue, nLen);
         }
 
-        if (CPLGetValueType(pszValue) == CPL_VALUE_REAL)
-        {
-            AppendObject(json_object_new_double(CPLAtof(pszValue)));
-        }
-        else if (nLen == strlen("Infinity") && EQUAL(pszValue, "Infinity"))
-        {
-            AppendObject(json_object_new_double(
-                std::numeric_limits<double>::infinity()));
-        }
-        else if (nLen == strlen("-Infinity") && EQUAL(pszValue, "-Infinity"))
-        {
-            AppendObject(json_object_new_double(
-                -std::numeric_limits<double>::infinity()));
-        }
-        else if (nLen == strlen("NaN") && EQUAL(pszValue, "NaN"))
-        {
-            AppendObject(json_object_new_double(
-                std::numeric_limits<double>::quiet_NaN()));
-        }
+        bool bIsInteger = false;
+        GIntBig nIntVal = 0;
+        double dfVal = 0;
+        OGRJSONParseNumber(pszValue, nLen, bIsInteger, nIntVal, dfVal);
+        if (bIsInteger)
+            AppendObject(json_object_new_int64(nIntVal));
         else
-        {
-            AppendObject(json_object_new_int64(CPLAtoGIntBig(pszValue)));
-        }
+            AppendObject(json_object_new_double(dfVal));
     }
 }
 
@@ -467,7 +905,15 @@ void OGRJSONCollectionStreamingParser::Boolean(bool bVal)
         return;
     }
 
-    if (m_poCurObj)
+    if (m_bInTapeFeature)
+    {
+        if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
+        {
+            m_osJson += bVal ? "true" : "false";
+        }
+        m_oTape.Boolean(bVal);
+    }
+    else if (m_poCurObj)
     {
         if (m_bFirstPass)
         {
@@ -497,7 +943,7 @@ void OGRJSONCollectionStreamingParser::Null()
         return;
     }
 
-    if (m_poCurObj)
+    if (m_poCurObj || m_bInTapeFeature)
     {
         if (m_bInFeaturesArray && m_bStoreNativeData && m_nDepth >= 3)
         {
@@ -505,10 +951,31 @@ void OGRJSONCollectionStreamingParser::Null()
         }
 
         m_nCurObjMemEstimate += ESTIMATE_BASE_OBJECT_SIZE;
-        AppendObject(nullptr);
+        if (m_bInTapeFeature)
+            m_oTape.Null();
+        else
+            AppendObject(nullptr);
     }
 }
 
+/************************************************************************/
+/*                          GotFeatureTape()                            */
+/************************************************************************/
+
+/** Called instead of GotFeature() when SetUseTape(true) has been called.
+ *
+ * The default implementation builds the json-c object and forwards it to
+ * GotFeature().
+ */
+void OGRJSONCollectionStreamingParser::GotFeatureTape(const OGRJSONTape &oTape,
+                                                      bool bFirstPass,
+                                                      const std::string &osJson)
+{
+    json_object *poObj = oTape.ToJSONObject(0);
+    GotFeature(poObj, bFirstPass, osJson);
+    json_object_put(poObj);
+}
+
 /************************************************************************/
 /*                             Exception()                              */
 /************************************************************************/
@@ -33,6 +33,99 @@
 
 #include <json.h>  // JSON-C
 
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                             OGRJSONTape                              */
+/************************************************************************/
+
+/** Flat recording of the parsing events of a JSON value.
+ *
+ * Containers store the index of the entry following them, so that a reader
+ * can skip a whole sub-tree. Object members are stored as a KEY entry
+ * followed by the entries of the value. Strings are stored NUL-terminated
+ * in a single pool.
+ */
+class OGRJSONTape
+{
+  public:
+    enum class Type
+    {
+        OBJECT,
+        ARRAY,
+        KEY,
+        STRING,
+        INTEGER,
+        REAL,
+        BOOLEAN,
+        NULL_VALUE
+    };
+
+    struct Entry
+    {
+        Type eType = Type::NULL_VALUE;
+        bool bVal = false;
+        // OBJECT: number of members. ARRAY: number of elements.
+        // KEY, STRING: offset in the string pool.
+        size_t nVal = 0;
+        // OBJECT, ARRAY: index of the entry following the container.
+        size_t nEnd = 0;
+        GIntBig nIntVal = 0;
+        double dfVal = 0;
+    };
+
+    void Clear();
+
+    void StartObject();
+    void EndObject();
+    void StartArray();
+    void EndArray();
+    void Key(const char *pszKey, size_t nLen);
+    void String(const char *pszValue, size_t nLen);
+    void Number(const char *pszValue, size_t nLen);
+    void Boolean(bool bVal);
+    void Null();
+
+    inline size_t size() const
+    {
+        return m_aoEntries.size();
+    }
+
+    inline const Entry &operator[](size_t nIdx) const
+    {
+        return m_aoEntries[nIdx];
+    }
+
+    inline const char *GetString(size_t nIdx) const
+    {
+        return m_osStrings.data() + m_aoEntries[nIdx].nVal;
+    }
+
+    /** Index of the entry following the value starting at nIdx */
+    inline size_t GetNext(size_t nIdx) const
+    {
+        const auto eType = m_aoEntries[nIdx].eType;
+        return (eType == Type::OBJECT || eType == Type::ARRAY)
+                   ? m_aoEntries[nIdx].nEnd
+                   : nIdx + 1;
+    }
+
+    /** Index of the value of the last member of the object at nObjIdx
+     * whose key is exactly pszKey, or 0 if there is none. */
+    size_t FindMember(size_t nObjIdx, const char *pszKey) const;
+
+    json_object *ToJSONObject(size_t nIdx) const;
+
+  private:
+    std::vector<Entry> m_aoEntries{};
+    std::string m_osStrings{};
+    std::vector<size_t> m_anStack{};
+
+    void AddValue(const Entry &oEntry);
+    size_t AddString(const char *pszValue, size_t nLen);
+};
+
 /************************************************************************/
 /*                      OGRJSONCollectionStreamingParser                */
 /************************************************************************/
@@ -67,6 +160,10 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
     bool m_bStartFeature = false;
     bool m_bEndFeature = false;
 
+    bool m_bUseTape = false;
+    bool m_bInTapeFeature = false;
+    OGRJSONTape m_oTape{};
+
     void AppendObject(json_object *poNewObj);
 
     CPL_DISALLOW_COPY_ASSIGN(OGRJSONCollectionStreamingParser)
@@ -77,8 +174,17 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
         return m_bFirstPass;
     }
 
+    /** Make features of the second pass be reported through
+     * GotFeatureTape() rather than being built as json-c objects. */
+    inline void SetUseTape(bool bUseTape)
+    {
+        m_bUseTape = bUseTape;
+    }
+
     virtual void GotFeature(json_object *poObj, bool bFirstPass,
                             const std::string &osJson) = 0;
+    virtual void GotFeatureTape(const OGRJSONTape &oTape, bool bFirstPass,
+                                const std::string &osJson);
     virtual void TooComplex() = 0;
 
   public:
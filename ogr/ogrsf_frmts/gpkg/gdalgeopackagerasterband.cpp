@@ -31,6 +31,8 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <limits>
@@ -39,6 +41,77 @@
 #define DEBUG_VERBOSE
 #endif
 
+/************************************************************************/
+/*                          GPKGTileEncodeJob                           */
+/************************************************************************/
+
+// Encoding of a tile into its PNG/JPEG/WEBP/TIFF blob, potentially done in
+// a worker thread, followed by its insertion into the database, always done
+// from the main thread.
+struct GPKGTileEncodeJob
+{
+    GDALGPKGMBTilesLikePseudoDataset *poTPD = nullptr;
+    int nRow = 0;
+    int nCol = 0;
+
+    // Inputs of the encoding. poMEMDS may point to abyTileData and
+    // pTempTileBuffer.
+    std::vector<GByte> abyTileData{};
+    GUInt16 *pTempTileBuffer = nullptr;
+    GDALDataset *poMEMDS = nullptr;
+    GDALDriver *poDriver = nullptr;
+    CPLStringList aosDriverOptions{};
+
+    // Tile statistics, for gpkg_2d_gridded_tile_ancillary
+    double dfTileOffset = 0.0;
+    double dfTileScale = 1.0;
+    double dfTileMin = 0.0;
+    double dfTileMax = 0.0;
+    double dfTileMean = 0.0;
+    double dfTileStdDev = 0.0;
+
+    // Outputs of the encoding
+    GByte *pabyBlob = nullptr;
+    vsi_l_offset nBlobSize = 0;
+    bool bDone = false;  // protected by poTPD->m_oTileEncodeJobMutex
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+    GPKGTileEncodeJob() = default;
+    GPKGTileEncodeJob(const GPKGTileEncodeJob &) = delete;
+    GPKGTileEncodeJob &operator=(const GPKGTileEncodeJob &) = delete;
+
+    ~GPKGTileEncodeJob()
+    {
+        delete poMEMDS;
+        CPLFree(pTempTileBuffer);
+        CPLFree(pabyBlob);
+    }
+
+    void Encode()
+    {
+        const std::string osMemFileName(
+            CPLSPrintf("/vsimem/gpkg_write_tile_%p", this));
+        GDALDataset *poOutDS =
+            poDriver->CreateCopy(osMemFileName.c_str(), poMEMDS, FALSE,
+                                 aosDriverOptions.List(), nullptr, nullptr);
+        if (poOutDS)
+        {
+            GDALClose(poOutDS);
+            pabyBlob =
+                VSIGetMemFileBuffer(osMemFileName.c_str(), &nBlobSize, TRUE);
+        }
+        VSIUnlink(osMemFileName.c_str());
+
+        // Release the source buffers as soon as possible
+        delete poMEMDS;
+        poMEMDS = nullptr;
+        CPLFree(pTempTileBuffer);
+        pTempTileBuffer = nullptr;
+        abyTileData.clear();
+        abyTileData.shrink_to_fit();
+    }
+};
+
 /************************************************************************/
 /*                    GDALGPKGMBTilesLikePseudoDataset()                */
 /************************************************************************/
@@ -47,6 +120,8 @@ GDALGPKGMBTilesLikePseudoDataset::GDALGPKGMBTilesLikePseudoDataset()
     : m_bForceTempDBCompaction(
           CPLTestBool(CPLGetConfigOption("GPKG_FORCE_TEMPDB_COMPACTION", "NO")))
 {
+    m_nNumThreads = CPLParseNumThreads(
+        CPLGetConfigOption("GDAL_NUM_THREADS", nullptr), m_nNumThreads);
     for (int i = 0; i < 4; i++)
     {
         m_asCachedTilesDesc[i].nRow = -1;
@@ -65,6 +140,11 @@ GDALGPKGMBTilesLikePseudoDataset::GDALGPKGMBTilesLikePseudoDataset()
 
 GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
 {
+    // Normally done by FlushTiles(). If not, wait for running jobs, so
+    // that they do not outlive us. Their result is discarded.
+    if (m_poTileEncodeJobQueue)
+        m_poTileEncodeJobQueue->WaitCompletion();
+
     if (m_poParentDS == nullptr && m_hTempDB != nullptr)
     {
         sqlite3_close(m_hTempDB);
@@ -168,6 +248,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushTiles()
         }
     }
 
+    if (FlushPendingTileEncodings(/* bWaitAll = */ true) != CE_None)
+        eErr = CE_Failure;
+
     if (poMainDS->m_nTileInsertionCount > 0)
     {
         if (poMainDS->ICommitTransaction() != OGRERR_NONE)
@@ -877,6 +960,42 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         return pabyData;
     }
 
+    // Tiles whose encoding is pending must be inserted before being read
+    if (FlushPendingTileEncodings(/* bWaitAll = */ true) != CE_None)
+        return nullptr;
+
+    // When GDAL blocks do not match tiles, each tile is needed by up to
+    // 4 blocks, so keep the most recently decoded ones (in read-only mode
+    // only, as we do not bother invalidating the cache on writes)
+    const bool bUseDecodedTileCache =
+        (m_nShiftXPixelsMod || m_nShiftYPixelsMod) && !IGetUpdate();
+    const GIntBig nTileKey =
+        static_cast<GIntBig>(nRow) * m_nTileMatrixWidth + nCol;
+    const size_t nTileDataSize =
+        (m_eDT == GDT_Byte ? 4 : 1) * nBandBlockSize;
+    if (bUseDecodedTileCache)
+    {
+        if (!m_poDecodedTileCache)
+        {
+            const int nCacheSize = std::max(
+                0, atoi(CPLGetConfigOption("GPKG_DECODED_TILE_CACHE_SIZE",
+                                           "16")));
+            m_poDecodedTileCache =
+                std::make_unique<lru11::Cache<GIntBig, GPKGDecodedTile>>(
+                    nCacheSize, 0);
+        }
+        const GPKGDecodedTile *psDecodedTile =
+            m_poDecodedTileCache->getPtr(nTileKey);
+        if (psDecodedTile)
+        {
+            CPLAssert(psDecodedTile->abyData.size() == nTileDataSize);
+            memcpy(pabyData, psDecodedTile->abyData.data(), nTileDataSize);
+            if (pbIsLossyFormat)
+                *pbIsLossyFormat = psDecodedTile->bIsLossyFormat;
+            return pabyData;
+        }
+    }
+
 #ifdef DEBUG_VERBOSE
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
@@ -921,10 +1040,22 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         double dfTileOffset = 0.0;
         double dfTileScale = 1.0;
         GetTileOffsetAndScale(nTileId, dfTileOffset, dfTileScale);
-        ReadTile(osMemFileName, pabyData, dfTileOffset, dfTileScale,
-                 pbIsLossyFormat);
+        bool bIsLossyFormat = false;
+        const CPLErr eErr = ReadTile(osMemFileName, pabyData, dfTileOffset,
+                                     dfTileScale, &bIsLossyFormat);
+        if (pbIsLossyFormat)
+            *pbIsLossyFormat = bIsLossyFormat;
         VSIUnlink(osMemFileName);
         sqlite3_finalize(hStmt);
+
+        if (bUseDecodedTileCache && eErr == CE_None &&
+            m_poDecodedTileCache->getMaxSize() > 0)
+        {
+            GPKGDecodedTile oDecodedTile;
+            oDecodedTile.abyData.assign(pabyData, pabyData + nTileDataSize);
+            oDecodedTile.bIsLossyFormat = bIsLossyFormat;
+            m_poDecodedTileCache->insert(nTileKey, std::move(oDecodedTile));
+        }
     }
     else if (rc == SQLITE_BUSY)
     {
@@ -1229,6 +1360,307 @@ retry:
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    if (eRWFlag == GF_Read &&
+        m_poTPD->CanUseParallelDecoding(nXSize, nYSize, nBufXSize, nBufYSize,
+                                        psExtraArg))
+    {
+        return m_poTPD->ReadWithParallelDecoding(
+            nXOff, nYOff, nXSize, nYSize, static_cast<GByte *>(pData),
+            nLineSpace,
+            [&](int nStripYOff, int nStripYSize, GByte *pabyStripData)
+            {
+                return GDALPamRasterBand::IRasterIO(
+                    GF_Read, nXOff, nStripYOff, nXSize, nStripYSize,
+                    pabyStripData, nBufXSize, nStripYSize, eBufType,
+                    nPixelSpace, nLineSpace, psExtraArg);
+            });
+    }
+
+    return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                        pData, nBufXSize, nBufYSize, eBufType,
+                                        nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                        CanUseParallelDecoding()                      */
+/************************************************************************/
+
+bool GDALGPKGMBTilesLikePseudoDataset::CanUseParallelDecoding(
+    int nXSize, int nYSize, int nBufXSize, int nBufYSize,
+    const GDALRasterIOExtraArg *psExtraArg)
+{
+    // Only handle the case where GDAL blocks exactly match tiles, and
+    // without resampling. Progress reporting would not make sense on the
+    // strips processed by ReadWithParallelDecoding().
+    return m_nNumThreads > 1 && m_pabyCachedTiles != nullptr &&
+           m_nShiftXPixelsMod == 0 && m_nShiftYPixelsMod == 0 &&
+           nXSize == nBufXSize && nYSize == nBufYSize &&
+           (psExtraArg == nullptr || psExtraArg->pfnProgress == nullptr);
+}
+
+/************************************************************************/
+/*                       ReadWithParallelDecoding()                     */
+/************************************************************************/
+
+/** Process a read request by strips of whole rows of tiles. The tiles of each
+ * strip are decoded in parallel and stored in the block cache, before
+ * fnReadStrip() is called to do the actual read from the block cache.
+ */
+CPLErr GDALGPKGMBTilesLikePseudoDataset::ReadWithParallelDecoding(
+    int nXOff, int nYOff, int nXSize, int nYSize, GByte *pabyData,
+    GSpacing nLineSpace,
+    const std::function<CPLErr(int nStripYOff, int nStripYSize,
+                               GByte *pabyStripData)> &fnReadStrip)
+{
+    int nBlockXSize, nBlockYSize;
+    IGetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlockXOff0 = nXOff / nBlockXSize;
+    const int nBlockXOff1 = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYOff0 = nYOff / nBlockYSize;
+    const int nBlockYOff1 = (nYOff + nYSize - 1) / nBlockYSize;
+    const int nBlocksPerRow = nBlockXOff1 - nBlockXOff0 + 1;
+
+    // Strips must contain enough tiles to keep the worker threads busy,
+    // but the tiles of a strip must fit in the block cache.
+    const GIntBig nBlockRowBytes = static_cast<GIntBig>(nBlocksPerRow) *
+                                   nBlockXSize * nBlockYSize * m_nDTSize *
+                                   IGetRasterCount();
+    const GIntBig nMaxStripBytes = GDALGetCacheMax64() / 4;
+    int nBlockRowsPerStrip =
+        std::max(1, DIV_ROUND_UP(4 * m_nNumThreads, nBlocksPerRow));
+    if (nBlockRowBytes * nBlockRowsPerStrip > nMaxStripBytes)
+    {
+        nBlockRowsPerStrip = static_cast<int>(
+            std::max<GIntBig>(1, nMaxStripBytes / nBlockRowBytes));
+    }
+
+    for (int nBlockYOff = nBlockYOff0; nBlockYOff <= nBlockYOff1;
+         nBlockYOff += nBlockRowsPerStrip)
+    {
+        const int nBlockYOffLast =
+            std::min(nBlockYOff1, nBlockYOff + nBlockRowsPerStrip - 1);
+        PreloadTiles(nBlockXOff0, nBlockYOff, nBlockXOff1, nBlockYOffLast);
+
+        const int nStripYOff = std::max(nYOff, nBlockYOff * nBlockYSize);
+        const int nStripYEnd = static_cast<int>(std::min<GIntBig>(
+            static_cast<GIntBig>(nYOff) + nYSize,
+            static_cast<GIntBig>(nBlockYOffLast + 1) * nBlockYSize));
+        const CPLErr eErr =
+            fnReadStrip(nStripYOff, nStripYEnd - nStripYOff,
+                        pabyData + (nStripYOff - nYOff) * nLineSpace);
+        if (eErr != CE_None)
+            return eErr;
+    }
+    return CE_None;
+}
+
+/************************************************************************/
+/*                            PreloadTiles()                            */
+/************************************************************************/
+
+/** Decode in parallel the tiles corresponding to the specified range of
+ * blocks (bounds included), and store them in the block cache. Blocks that
+ * are already in the block cache, or that cannot be handled, are left
+ * untouched, and will be dealt with by IReadBlock().
+ */
+void GDALGPKGMBTilesLikePseudoDataset::PreloadTiles(int nBlockXOff0,
+                                                    int nBlockYOff0,
+                                                    int nBlockXOff1,
+                                                    int nBlockYOff1)
+{
+    const int nBands = IGetRasterCount();
+
+    // Collect the blocks to load
+    std::vector<std::pair<int, int>> anBlocksToLoad;
+    for (int nBlockYOff = nBlockYOff0; nBlockYOff <= nBlockYOff1; ++nBlockYOff)
+    {
+        const int nRow = nBlockYOff + m_nShiftYTiles;
+        for (int nBlockXOff = nBlockXOff0; nBlockXOff <= nBlockXOff1;
+             ++nBlockXOff)
+        {
+            const int nCol = nBlockXOff + m_nShiftXTiles;
+            if (nRow < 0 || nCol < 0 || nRow >= m_nTileMatrixHeight ||
+                nCol >= m_nTileMatrixWidth)
+            {
+                continue;
+            }
+            // Tile being modified
+            if (m_asCachedTilesDesc[0].nRow == nRow &&
+                m_asCachedTilesDesc[0].nCol == nCol &&
+                m_asCachedTilesDesc[0].nIdxWithinTileData == 0)
+            {
+                continue;
+            }
+            bool bInBlockCache = false;
+            for (int iBand = 1; iBand <= nBands && !bInBlockCache; ++iBand)
+            {
+                auto poBand = cpl::down_cast<GDALGPKGMBTilesLikeRasterBand *>(
+                    IGetRasterBand(iBand));
+                GDALRasterBlock *poBlock =
+                    poBand->AccessibleTryGetLockedBlockRef(nBlockXOff,
+                                                           nBlockYOff);
+                if (poBlock)
+                {
+                    poBlock->DropLock();
+                    bInBlockCache = true;
+                }
+            }
+            if (!bInBlockCache)
+                anBlocksToLoad.emplace_back(nBlockXOff, nBlockYOff);
+        }
+    }
+    if (anBlocksToLoad.size() < 2)
+        return;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+    if (poThreadPool == nullptr)
+        return;
+
+    // Tiles whose encoding is pending must be inserted before being read
+    if (FlushPendingTileEncodings(/* bWaitAll = */ true) != CE_None)
+        return;
+
+    // Make sure the color table is established before the worker threads
+    // use it
+    if (nBands == 1)
+        IGetRasterBand(1)->GetColorTable();
+
+    int nBlockXSize, nBlockYSize;
+    IGetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const size_t nBandBlockSize =
+        static_cast<size_t>(nBlockXSize) * nBlockYSize * m_nDTSize;
+    const size_t nTileDataSize = (m_eDT == GDT_Byte ? 4 : 1) * nBandBlockSize;
+
+    struct DecodeJob
+    {
+        GDALGPKGMBTilesLikePseudoDataset *poTPD = nullptr;
+        int nBlockXOff = 0;
+        int nBlockYOff = 0;
+        std::vector<GByte> abyBlob{};
+        double dfTileOffset = 0.0;
+        double dfTileScale = 1.0;
+        std::vector<GByte> abyTileData{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    std::vector<std::unique_ptr<DecodeJob>> apoJobs;
+
+    // Fetch the compressed tiles from the database
+    char *pszSQL = sqlite3_mprintf(
+        "SELECT tile_data%s FROM \"%w\" "
+        "WHERE zoom_level = %d AND tile_row = ? AND tile_column = ?%s",
+        m_eDT != GDT_Byte ? ", id" : "",  // MBTiles do not have an id
+        m_osRasterTable.c_str(), m_nZoomLevel,
+        !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
+    sqlite3_stmt *hStmt = nullptr;
+    const int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    sqlite3_free(pszSQL);
+    if (rc != SQLITE_OK)
+    {
+        // Errors will be reported by IReadBlock()
+        sqlite3_finalize(hStmt);
+        return;
+    }
+    try
+    {
+        for (const auto &[nBlockXOff, nBlockYOff] : anBlocksToLoad)
+        {
+            const int nRow = nBlockYOff + m_nShiftYTiles;
+            const int nCol = nBlockXOff + m_nShiftXTiles;
+            sqlite3_reset(hStmt);
+            sqlite3_bind_int(hStmt, 1, GetRowFromIntoTopConvention(nRow));
+            sqlite3_bind_int(hStmt, 2, nCol);
+            if (sqlite3_step(hStmt) == SQLITE_ROW &&
+                sqlite3_column_type(hStmt, 0) == SQLITE_BLOB)
+            {
+                auto poJob = std::make_unique<DecodeJob>();
+                poJob->poTPD = this;
+                poJob->nBlockXOff = nBlockXOff;
+                poJob->nBlockYOff = nBlockYOff;
+                const GByte *pabyBlob =
+                    static_cast<const GByte *>(sqlite3_column_blob(hStmt, 0));
+                poJob->abyBlob.assign(pabyBlob,
+                                      pabyBlob +
+                                          sqlite3_column_bytes(hStmt, 0));
+                if (m_eDT != GDT_Byte)
+                {
+                    GetTileOffsetAndScale(sqlite3_column_int64(hStmt, 1),
+                                          poJob->dfTileOffset,
+                                          poJob->dfTileScale);
+                }
+                poJob->abyTileData.resize(nTileDataSize);
+                apoJobs.push_back(std::move(poJob));
+            }
+        }
+    }
+    catch (const std::exception &)
+    {
+        // Out of memory: let IReadBlock() do the job
+        sqlite3_finalize(hStmt);
+        return;
+    }
+    sqlite3_finalize(hStmt);
+    if (apoJobs.empty())
+        return;
+
+    // Decode them in parallel
+    const auto JobFunc = [](void *pData)
+    {
+        auto psJob = static_cast<DecodeJob *>(pData);
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        CPLString osMemFileName;
+        osMemFileName.Printf("/vsimem/gpkg_read_tile_%p", psJob);
+        VSIFCloseL(VSIFileFromMemBuffer(osMemFileName.c_str(),
+                                        psJob->abyBlob.data(),
+                                        psJob->abyBlob.size(), FALSE));
+        // On error, the tile is filled with the empty value, as done
+        // by the sequential code path.
+        psJob->poTPD->ReadTile(osMemFileName, psJob->abyTileData.data(),
+                               psJob->dfTileOffset, psJob->dfTileScale);
+        VSIUnlink(osMemFileName.c_str());
+        CPLUninstallErrorHandlerAccumulator();
+    };
+
+    auto poQueue = poThreadPool->CreateJobQueue();
+    for (auto &poJob : apoJobs)
+    {
+        if (!poQueue->SubmitJob(JobFunc, poJob.get()))
+            JobFunc(poJob.get());
+    }
+    poQueue->WaitCompletion();
+
+    // And store them in the block cache
+    for (const auto &poJob : apoJobs)
+    {
+        for (const auto &oError : poJob->aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        for (int iBand = 1; iBand <= nBands; ++iBand)
+        {
+            GDALRasterBlock *poBlock =
+                IGetRasterBand(iBand)->GetLockedBlockRef(
+                    poJob->nBlockXOff, poJob->nBlockYOff, TRUE);
+            if (poBlock == nullptr)
+                continue;
+            memcpy(poBlock->GetDataRef(),
+                   poJob->abyTileData.data() + (iBand - 1) * nBandBlockSize,
+                   nBandBlockSize);
+            poBlock->DropLock();
+        }
+    }
+}
+
 /************************************************************************/
 /*                       WEBPSupports4Bands()                           */
 /************************************************************************/
@@ -1280,6 +1712,9 @@ GIntBig GDALGPKGMBTilesLikePseudoDataset::GetTileId(int nRow, int nCol)
 
 bool GDALGPKGMBTilesLikePseudoDataset::DeleteTile(int nRow, int nCol)
 {
+    // Make sure a pending insertion of that tile does not happen after us
+    FlushPendingTileEncodings(/* bWaitAll = */ true);
+
     char *pszSQL =
         sqlite3_mprintf("DELETE FROM \"%w\" "
                         "WHERE zoom_level = %d AND tile_row = %d AND "
@@ -1682,8 +2117,6 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                  nRow, nCol, m_nZoomLevel);
     }
 
-    CPLString osMemFileName;
-    osMemFileName.Printf("/vsimem/gpkg_write_tile_%p", this);
     const char *pszDriverName = "PNG";
     bool bTileDriverSupports1Band = false;
     bool bTileDriverSupports2Bands = false;
@@ -1748,6 +2181,34 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
         GDALDriver::FromHandle(GDALGetDriverByName(pszDriverName));
     if (l_poDriver != nullptr)
     {
+        auto poJob = std::make_unique<GPKGTileEncodeJob>();
+        poJob->poTPD = this;
+        poJob->nRow = nRow;
+        poJob->nCol = nCol;
+        poJob->poDriver = l_poDriver;
+
+        // When the encoding is deferred to a worker thread, work on a copy
+        // of the tile, as m_pabyCachedTiles is going to be reused for the
+        // next one.
+        GByte *pabyTileData = m_pabyCachedTiles;
+        if (m_nNumThreads > 1)
+        {
+            try
+            {
+                poJob->abyTileData.assign(
+                    m_pabyCachedTiles,
+                    m_pabyCachedTiles +
+                        (m_eDT == GDT_Byte ? 4 : 1) * nBandBlockSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in WriteTileInternal()");
+                return CE_Failure;
+            }
+            pabyTileData = poJob->abyTileData.data();
+        }
+
         auto poMEMDS = MEMDataset::Create("", nBlockXSize, nBlockYSize, 0,
                                           eTileDT, nullptr);
         int nTileBands = nBands;
@@ -1801,11 +2262,11 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
         if (bPartialTile && (nTileBands == 2 || nTileBands == 4))
         {
             int nTargetAlphaBand = nTileBands;
-            memset(m_pabyCachedTiles + (nTargetAlphaBand - 1) * nBandBlockSize,
+            memset(pabyTileData + (nTargetAlphaBand - 1) * nBandBlockSize,
                    0, nBandBlockSize);
             for (GPtrDiff_t iY = iYOff; iY < iYOff + iYCount; iY++)
             {
-                memset(m_pabyCachedTiles +
+                memset(pabyTileData +
                            (static_cast<size_t>(nTargetAlphaBand - 1) *
                                 nBlockYSize +
                             iY) *
@@ -1831,7 +2292,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             if (m_eDT == GDT_Int16)
             {
                 ProcessInt16UInt16Tile<GInt16>(
-                    m_pabyCachedTiles,
+                    pabyTileData,
                     static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize, true,
                     CPL_TO_BOOL(bHasNoData), dfNoDataValue, m_usGPKGNull,
                     m_dfOffset, m_dfScale, pTempTileBuffer, dfTileOffset,
@@ -1841,7 +2302,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             else if (m_eDT == GDT_UInt16)
             {
                 ProcessInt16UInt16Tile<GUInt16>(
-                    m_pabyCachedTiles,
+                    pabyTileData,
                     static_cast<GPtrDiff_t>(nBlockXSize) * nBlockYSize, false,
                     CPL_TO_BOOL(bHasNoData), dfNoDataValue, m_usGPKGNull,
                     m_dfOffset, m_dfScale, pTempTileBuffer, dfTileOffset,
@@ -1851,7 +2312,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             else if (m_eDT == GDT_Float32)
             {
                 const float *pSrc =
-                    reinterpret_cast<float *>(m_pabyCachedTiles);
+                    reinterpret_cast<float *>(pabyTileData);
                 float fMin = 0.0f;
                 float fMax = 0.0f;
                 double dfM2 = 0.0;
@@ -1967,7 +2428,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
         }
         else if (m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
         {
-            const float *pSrc = reinterpret_cast<float *>(m_pabyCachedTiles);
+            const float *pSrc = reinterpret_cast<float *>(pabyTileData);
             float fMin = 0.0f;
             float fMax = 0.0f;
             double dfM2 = 0.0;
@@ -2006,7 +2467,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             if (nValidPixels)
                 dfTileStdDev = sqrt(dfM2 / nValidPixels);
 
-            auto hBand = MEMCreateRasterBandEx(poMEMDS, 1, m_pabyCachedTiles,
+            auto hBand = MEMCreateRasterBandEx(poMEMDS, 1, pabyTileData,
                                                GDT_Float32, 0, 0, false);
             poMEMDS->AddMEMBand(hBand);
         }
@@ -2026,7 +2487,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 
                 auto hBand = MEMCreateRasterBandEx(
                     poMEMDS, i + 1,
-                    m_pabyCachedTiles + iSrc * nBlockXSize * nBlockYSize,
+                    pabyTileData + iSrc * nBlockXSize * nBlockYSize,
                     GDT_Byte, 0, 0, false);
                 poMEMDS->AddMEMBand(hBand);
 
@@ -2040,6 +2501,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
         {
             // If tile is fully transparent, don't serialize it and remove
             // it if it exists.
+            FlushPendingTileEncodings(/* bWaitAll = */ true);
             GIntBig nId = GetTileId(nRow, nCol);
             if (nId > 0)
             {
@@ -2062,7 +2524,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             for (int i = 0; i < 3; i++)
             {
                 auto hBand = MEMCreateRasterBandEx(
-                    poMEMDS, i + 1, m_pabyCachedTiles + i * nBandBlockSize,
+                    poMEMDS, i + 1, pabyTileData + i * nBandBlockSize,
                     GDT_Byte, 0, 0, false);
                 poMEM_RGB_DS->AddMEMBand(hBand);
             }
@@ -2082,8 +2544,8 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 poMEM_RGB_DS->GetRasterBand(1), poMEM_RGB_DS->GetRasterBand(2),
                 poMEM_RGB_DS->GetRasterBand(3),
                 /*NULL, NULL, NULL,*/
-                m_pabyCachedTiles, m_pabyCachedTiles + nBandBlockSize,
-                m_pabyCachedTiles + 2 * nBandBlockSize, nullptr,
+                pabyTileData, pabyTileData + nBandBlockSize,
+                pabyTileData + 2 * nBandBlockSize, nullptr,
                 256, /* max colors */
                 8,   /* bit depth */
                 static_cast<GUInt32 *>(
@@ -2122,13 +2584,13 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             }
             if (iYOff > 0)
             {
-                memset(m_pabyCachedTiles + 0 * nBandBlockSize, 0,
+                memset(pabyTileData + 0 * nBandBlockSize, 0,
                        nBlockXSize * iYOff);
-                memset(m_pabyCachedTiles + 1 * nBandBlockSize, 0,
+                memset(pabyTileData + 1 * nBandBlockSize, 0,
                        nBlockXSize * iYOff);
-                memset(m_pabyCachedTiles + 2 * nBandBlockSize, 0,
+                memset(pabyTileData + 2 * nBandBlockSize, 0,
                        nBlockXSize * iYOff);
-                memset(m_pabyCachedTiles + 3 * nBandBlockSize, 0,
+                memset(pabyTileData + 3 * nBandBlockSize, 0,
                        nBlockXSize * iYOff);
             }
             for (GPtrDiff_t iY = iYOff; iY < iYOff + iYCount; iY++)
@@ -2136,225 +2598,304 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 if (iXOff > 0)
                 {
                     const GPtrDiff_t i = iY * nBlockXSize;
-                    memset(m_pabyCachedTiles + 0 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 0 * nBandBlockSize + i, 0,
                            iXOff);
-                    memset(m_pabyCachedTiles + 1 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 1 * nBandBlockSize + i, 0,
                            iXOff);
-                    memset(m_pabyCachedTiles + 2 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 2 * nBandBlockSize + i, 0,
                            iXOff);
-                    memset(m_pabyCachedTiles + 3 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 3 * nBandBlockSize + i, 0,
                            iXOff);
                 }
                 for (int iX = iXOff; iX < iXOff + iXCount; iX++)
                 {
                     const GPtrDiff_t i = iY * nBlockXSize + iX;
-                    GByte byVal = m_pabyCachedTiles[i];
-                    m_pabyCachedTiles[i] = abyCT[4 * byVal];
-                    m_pabyCachedTiles[i + 1 * nBandBlockSize] =
+                    GByte byVal = pabyTileData[i];
+                    pabyTileData[i] = abyCT[4 * byVal];
+                    pabyTileData[i + 1 * nBandBlockSize] =
                         abyCT[4 * byVal + 1];
-                    m_pabyCachedTiles[i + 2 * nBandBlockSize] =
+                    pabyTileData[i + 2 * nBandBlockSize] =
                         abyCT[4 * byVal + 2];
-                    m_pabyCachedTiles[i + 3 * nBandBlockSize] =
+                    pabyTileData[i + 3 * nBandBlockSize] =
                         abyCT[4 * byVal + 3];
                 }
                 if (iXOff + iXCount < nBlockXSize)
                 {
                     const GPtrDiff_t i = iY * nBlockXSize + iXOff + iXCount;
-                    memset(m_pabyCachedTiles + 0 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 0 * nBandBlockSize + i, 0,
                            nBlockXSize - (iXOff + iXCount));
-                    memset(m_pabyCachedTiles + 1 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 1 * nBandBlockSize + i, 0,
                            nBlockXSize - (iXOff + iXCount));
-                    memset(m_pabyCachedTiles + 2 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 2 * nBandBlockSize + i, 0,
                            nBlockXSize - (iXOff + iXCount));
-                    memset(m_pabyCachedTiles + 3 * nBandBlockSize + i, 0,
+                    memset(pabyTileData + 3 * nBandBlockSize + i, 0,
                            nBlockXSize - (iXOff + iXCount));
                 }
             }
             if (iYOff + iYCount < nBlockYSize)
             {
                 const GPtrDiff_t i = (iYOff + iYCount) * nBlockXSize;
-                memset(m_pabyCachedTiles + 0 * nBandBlockSize + i, 0,
+                memset(pabyTileData + 0 * nBandBlockSize + i, 0,
                        nBlockXSize * (nBlockYSize - (iYOff + iYCount)));
-                memset(m_pabyCachedTiles + 1 * nBandBlockSize + i, 0,
+                memset(pabyTileData + 1 * nBandBlockSize + i, 0,
                        nBlockXSize * (nBlockYSize - (iYOff + iYCount)));
-                memset(m_pabyCachedTiles + 2 * nBandBlockSize + i, 0,
+                memset(pabyTileData + 2 * nBandBlockSize + i, 0,
                        nBlockXSize * (nBlockYSize - (iYOff + iYCount)));
-                memset(m_pabyCachedTiles + 3 * nBandBlockSize + i, 0,
+                memset(pabyTileData + 3 * nBandBlockSize + i, 0,
                        nBlockXSize * (nBlockYSize - (iYOff + iYCount)));
             }
         }
 
-        char **papszDriverOptions =
-            CSLSetNameValue(nullptr, "_INTERNAL_DATASET", "YES");
+        CPLStringList &aosDriverOptions = poJob->aosDriverOptions;
+        aosDriverOptions.SetNameValue("_INTERNAL_DATASET", "YES");
         if (EQUAL(pszDriverName, "JPEG") || EQUAL(pszDriverName, "WEBP"))
         {
             // If not all bands are dirty, then use lossless WEBP
             if (!bAllDirty && EQUAL(pszDriverName, "WEBP"))
             {
-                papszDriverOptions =
-                    CSLSetNameValue(papszDriverOptions, "LOSSLESS", "YES");
+                aosDriverOptions.SetNameValue("LOSSLESS", "YES");
             }
             else
             {
-                papszDriverOptions =
-                    CSLSetNameValue(papszDriverOptions, "QUALITY",
-                                    CPLSPrintf("%d", m_nQuality));
+                aosDriverOptions.SetNameValue("QUALITY",
+                                              CPLSPrintf("%d", m_nQuality));
             }
         }
         else if (EQUAL(pszDriverName, "PNG"))
         {
-            papszDriverOptions = CSLSetNameValue(papszDriverOptions, "ZLEVEL",
-                                                 CPLSPrintf("%d", m_nZLevel));
+            aosDriverOptions.SetNameValue("ZLEVEL",
+                                          CPLSPrintf("%d", m_nZLevel));
         }
         else if (EQUAL(pszDriverName, "GTiff"))
         {
-            papszDriverOptions =
-                CSLSetNameValue(papszDriverOptions, "COMPRESS", "LZW");
+            aosDriverOptions.SetNameValue("COMPRESS", "LZW");
             if (nBlockXSize * nBlockYSize <= 512 * 512)
             {
                 // If tile is not too big, create it as single-strip TIFF
-                papszDriverOptions =
-                    CSLSetNameValue(papszDriverOptions, "BLOCKYSIZE",
-                                    CPLSPrintf("%d", nBlockYSize));
+                aosDriverOptions.SetNameValue("BLOCKYSIZE",
+                                              CPLSPrintf("%d", nBlockYSize));
             }
         }
-#ifdef DEBUG
-        VSIStatBufL sStat;
-        CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
-#endif
-        GDALDataset *poOutDS =
-            l_poDriver->CreateCopy(osMemFileName, poMEMDS, FALSE,
-                                   papszDriverOptions, nullptr, nullptr);
-        CSLDestroy(papszDriverOptions);
-        CPLFree(pTempTileBuffer);
 
-        if (poOutDS)
-        {
-            GDALClose(poOutDS);
-            vsi_l_offset nBlobSize = 0;
-            GByte *pabyBlob =
-                VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
+        poJob->poMEMDS = poMEMDS;
+        poJob->pTempTileBuffer = pTempTileBuffer;
+        poJob->dfTileOffset = dfTileOffset;
+        poJob->dfTileScale = dfTileScale;
+        poJob->dfTileMin = dfTileMin;
+        poJob->dfTileMax = dfTileMax;
+        poJob->dfTileMean = dfTileMean;
+        poJob->dfTileStdDev = dfTileStdDev;
+        eErr = EncodeAndInsertTile(std::move(poJob));
+    }
+    else
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Cannot find driver %s",
+                 pszDriverName);
+    }
 
-            /* Create or commit and recreate transaction */
-            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
-                m_poParentDS ? m_poParentDS : this;
-            if (poMainDS->m_nTileInsertionCount == 0)
-            {
-                poMainDS->IStartTransaction();
-            }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
+    return eErr;
+}
+
+/************************************************************************/
+/*                         EncodeAndInsertTile()                        */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikePseudoDataset::EncodeAndInsertTile(
+    std::unique_ptr<GPKGTileEncodeJob> poJob)
+{
+    if (m_nNumThreads > 1 && !m_poTileEncodeJobQueue)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+        if (poThreadPool)
+            m_poTileEncodeJobQueue = poThreadPool->CreateJobQueue();
+    }
+    if (!m_poTileEncodeJobQueue)
+    {
+        poJob->Encode();
+        return InsertEncodedTile(poJob.get());
+    }
+
+    const auto JobFunc = [](void *pData)
+    {
+        auto psJob = static_cast<GPKGTileEncodeJob *>(pData);
+        auto poTPD = psJob->poTPD;
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        psJob->Encode();
+        CPLUninstallErrorHandlerAccumulator();
+        std::lock_guard oLock(poTPD->m_oTileEncodeJobMutex);
+        psJob->bDone = true;
+        poTPD->m_oTileEncodeJobCV.notify_all();
+    };
+
+    auto psJob = poJob.get();
+    m_apoTileEncodeJobs.push_back(std::move(poJob));
+    if (!m_poTileEncodeJobQueue->SubmitJob(JobFunc, psJob))
+        JobFunc(psJob);
+
+    // Insert the tiles whose encoding is finished, in submission order, and
+    // wait if too many tiles are pending, to bound memory usage.
+    return FlushPendingTileEncodings(/* bWaitAll = */ false);
+}
+
+/************************************************************************/
+/*                      FlushPendingTileEncodings()                     */
+/************************************************************************/
+
+CPLErr
+GDALGPKGMBTilesLikePseudoDataset::FlushPendingTileEncodings(bool bWaitAll)
+{
+    CPLErr eErr = CE_None;
+    const size_t nMaxPendingJobs =
+        bWaitAll ? 0 : 2 * static_cast<size_t>(m_nNumThreads);
+    while (!m_apoTileEncodeJobs.empty())
+    {
+        GPKGTileEncodeJob *psJob = m_apoTileEncodeJobs.front().get();
+        {
+            std::unique_lock oLock(m_oTileEncodeJobMutex);
+            if (!psJob->bDone)
             {
-                if (poMainDS->ICommitTransaction() != OGRERR_NONE)
-                {
-                    poMainDS->m_nTileInsertionCount = -1;
-                    CPLFree(pabyBlob);
-                    VSIUnlink(osMemFileName);
-                    delete poMEMDS;
-                    return CE_Failure;
-                }
-                poMainDS->IStartTransaction();
-                poMainDS->m_nTileInsertionCount = 0;
+                if (m_apoTileEncodeJobs.size() <= nMaxPendingJobs)
+                    break;
+                m_oTileEncodeJobCV.wait(oLock,
+                                        [psJob] { return psJob->bDone; });
             }
-            poMainDS->m_nTileInsertionCount++;
+        }
+        auto poJob = std::move(m_apoTileEncodeJobs.front());
+        m_apoTileEncodeJobs.pop_front();
+        if (InsertEncodedTile(poJob.get()) != CE_None)
+            eErr = CE_Failure;
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                          InsertEncodedTile()                         */
+/************************************************************************/
+
+CPLErr
+GDALGPKGMBTilesLikePseudoDataset::InsertEncodedTile(GPKGTileEncodeJob *poJob)
+{
+    for (const auto &oError : poJob->aoErrors)
+    {
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poJob->pabyBlob == nullptr || poMainDS->m_nTileInsertionCount < 0)
+        return CE_Failure;
+
+    const int nRow = poJob->nRow;
+    const int nCol = poJob->nCol;
+    CPLErr eErr = CE_Failure;
 
-            char *pszSQL =
-                sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
-                                "(zoom_level, tile_row, tile_column, "
-                                "tile_data) VALUES (%d, %d, %d, ?)",
-                                m_osRasterTable.c_str(), m_nZoomLevel,
-                                GetRowFromIntoTopConvention(nRow), nCol);
+    /* Create or commit and recreate transaction */
+    if (poMainDS->m_nTileInsertionCount == 0)
+    {
+        poMainDS->IStartTransaction();
+    }
+    else if (poMainDS->m_nTileInsertionCount == 1000)
+    {
+        if (poMainDS->ICommitTransaction() != OGRERR_NONE)
+        {
+            poMainDS->m_nTileInsertionCount = -1;
+            return CE_Failure;
+        }
+        poMainDS->IStartTransaction();
+        poMainDS->m_nTileInsertionCount = 0;
+    }
+    poMainDS->m_nTileInsertionCount++;
+
+    char *pszSQL =
+        sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
+                        "(zoom_level, tile_row, tile_column, "
+                        "tile_data) VALUES (%d, %d, %d, ?)",
+                        m_osRasterTable.c_str(), m_nZoomLevel,
+                        GetRowFromIntoTopConvention(nRow), nCol);
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    if (rc != SQLITE_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "failed to prepare SQL %s: %s", pszSQL,
+                 sqlite3_errmsg(IGetDB()));
+    }
+    else
+    {
+        // Ownership of the blob is transferred to SQLite
+        sqlite3_bind_blob(hStmt, 1, poJob->pabyBlob,
+                          static_cast<int>(poJob->nBlobSize), CPLFree);
+        poJob->pabyBlob = nullptr;
+        rc = sqlite3_step(hStmt);
+        if (rc == SQLITE_DONE)
+            eErr = CE_None;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when inserting tile (row=%d,col=%d) at "
+                     "zoom_level=%d : %s",
+                     GetRowFromIntoTopConvention(nRow), nCol,
+                     m_nZoomLevel, sqlite3_errmsg(IGetDB()));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    sqlite3_free(pszSQL);
+
+    if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
+    {
+        GIntBig nTileId = GetTileId(nRow, nCol);
+        if (nTileId == 0)
+            eErr = CE_Failure;
+        else
+        {
+            DeleteFromGriddedTileAncillary(nTileId);
+
+            pszSQL = sqlite3_mprintf(
+                "INSERT INTO gpkg_2d_gridded_tile_ancillary "
+                "(tpudt_name, tpudt_id, scale, offset, min, max, "
+                "mean, std_dev) VALUES "
+                "('%q', ?, %.18g, %.18g, ?, ?, ?, ?)",
+                m_osRasterTable.c_str(), poJob->dfTileScale,
+                poJob->dfTileOffset);
 #ifdef DEBUG_VERBOSE
             CPLDebug("GPKG", "%s", pszSQL);
 #endif
-            sqlite3_stmt *hStmt = nullptr;
-            int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+            hStmt = nullptr;
+            rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
+                                    nullptr);
             if (rc != SQLITE_OK)
             {
+                eErr = CE_Failure;
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "failed to prepare SQL %s: %s", pszSQL,
                          sqlite3_errmsg(IGetDB()));
-                CPLFree(pabyBlob);
             }
             else
             {
-                sqlite3_bind_blob(hStmt, 1, pabyBlob,
-                                  static_cast<int>(nBlobSize), CPLFree);
+                sqlite3_bind_int64(hStmt, 1, nTileId);
+                sqlite3_bind_double(hStmt, 2, poJob->dfTileMin);
+                sqlite3_bind_double(hStmt, 3, poJob->dfTileMax);
+                sqlite3_bind_double(hStmt, 4, poJob->dfTileMean);
+                sqlite3_bind_double(hStmt, 5, poJob->dfTileStdDev);
                 rc = sqlite3_step(hStmt);
                 if (rc == SQLITE_DONE)
+                {
                     eErr = CE_None;
+                }
                 else
                 {
                     CPLError(CE_Failure, CPLE_AppDefined,
-                             "Failure when inserting tile (row=%d,col=%d) at "
-                             "zoom_level=%d : %s",
-                             GetRowFromIntoTopConvention(nRow), nCol,
-                             m_nZoomLevel, sqlite3_errmsg(IGetDB()));
+                             "Cannot insert into "
+                             "gpkg_2d_gridded_tile_ancillary");
+                    eErr = CE_Failure;
                 }
             }
             sqlite3_finalize(hStmt);
             sqlite3_free(pszSQL);
-
-            if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
-            {
-                GIntBig nTileId = GetTileId(nRow, nCol);
-                if (nTileId == 0)
-                    eErr = CE_Failure;
-                else
-                {
-                    DeleteFromGriddedTileAncillary(nTileId);
-
-                    pszSQL = sqlite3_mprintf(
-                        "INSERT INTO gpkg_2d_gridded_tile_ancillary "
-                        "(tpudt_name, tpudt_id, scale, offset, min, max, "
-                        "mean, std_dev) VALUES "
-                        "('%q', ?, %.18g, %.18g, ?, ?, ?, ?)",
-                        m_osRasterTable.c_str(), dfTileScale, dfTileOffset);
-#ifdef DEBUG_VERBOSE
-                    CPLDebug("GPKG", "%s", pszSQL);
-#endif
-                    hStmt = nullptr;
-                    rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt,
-                                            nullptr);
-                    if (rc != SQLITE_OK)
-                    {
-                        eErr = CE_Failure;
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "failed to prepare SQL %s: %s", pszSQL,
-                                 sqlite3_errmsg(IGetDB()));
-                    }
-                    else
-                    {
-                        sqlite3_bind_int64(hStmt, 1, nTileId);
-                        sqlite3_bind_double(hStmt, 2, dfTileMin);
-                        sqlite3_bind_double(hStmt, 3, dfTileMax);
-                        sqlite3_bind_double(hStmt, 4, dfTileMean);
-                        sqlite3_bind_double(hStmt, 5, dfTileStdDev);
-                        rc = sqlite3_step(hStmt);
-                        if (rc == SQLITE_DONE)
-                        {
-                            eErr = CE_None;
-                        }
-                        else
-                        {
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Cannot insert into "
-                                     "gpkg_2d_gridded_tile_ancillary");
-                            eErr = CE_Failure;
-                        }
-                    }
-                    sqlite3_finalize(hStmt);
-                    sqlite3_free(pszSQL);
-                }
-            }
         }
-
-        VSIUnlink(osMemFileName);
-        delete poMEMDS;
-    }
-    else
-    {
-        CPLError(CE_Failure, CPLE_NotSupported, "Cannot find driver %s",
-                 pszDriverName);
     }
 
     return eErr;
@@ -2370,6 +2911,10 @@ GDALGPKGMBTilesLikePseudoDataset::FlushRemainingShiftedTiles(bool bPartialFlush)
     if (m_hTempDB == nullptr)
         return CE_None;
 
+    // We may need to read back tiles of the main database below
+    if (FlushPendingTileEncodings(/* bWaitAll = */ true) != CE_None)
+        return CE_Failure;
+
     for (int i = 0; i <= 3; i++)
     {
         m_asCachedTilesDesc[i].nRow = -1;
@@ -30,10 +30,19 @@
 #ifndef GPKGMBTILESCOMMON_H_INCLUDED
 #define GPKGMBTILESCOMMON_H_INCLUDED
 
+#include "cpl_mem_cache.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 typedef struct
 {
     int nRow;
@@ -42,6 +51,15 @@ typedef struct
     bool abBandDirty[4];
 } CachedTileDesc;
 
+// Decoded content of a tile, as stored in the LRU cache of decoded tiles
+struct GPKGDecodedTile
+{
+    std::vector<GByte> abyData{};
+    bool bIsLossyFormat = false;
+};
+
+struct GPKGTileEncodeJob;
+
 typedef enum
 {
     GPKG_TF_PNG_JPEG,
@@ -112,9 +130,32 @@ class GDALGPKGMBTilesLikePseudoDataset
 
     GDALGPKGMBTilesLikePseudoDataset *m_poParentDS = nullptr;
 
+    // Number of threads used for tile encoding and decoding
+    // (GDAL_NUM_THREADS configuration option)
+    int m_nNumThreads = 1;
+
   private:
     bool m_bInWriteTile = false;
+
+    // Tiles whose encoding has been submitted to the thread pool, in the
+    // order in which they must be inserted in the database.
+    std::deque<std::unique_ptr<GPKGTileEncodeJob>> m_apoTileEncodeJobs{};
+    std::mutex m_oTileEncodeJobMutex{};
+    std::condition_variable m_oTileEncodeJobCV{};
+    // Must be declared after m_apoTileEncodeJobs, so that it is destroyed
+    // (which waits for the completion of running jobs) before it.
+    std::unique_ptr<CPLJobQueue> m_poTileEncodeJobQueue{};
+
+    // Only used in read-only mode, when GDAL blocks do not match tiles.
+    std::unique_ptr<lru11::Cache<GIntBig, GPKGDecodedTile>>
+        m_poDecodedTileCache{};
+
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
+    CPLErr EncodeAndInsertTile(std::unique_ptr<GPKGTileEncodeJob> poJob);
+    CPLErr InsertEncodedTile(GPKGTileEncodeJob *poJob);
+    CPLErr FlushPendingTileEncodings(bool bWaitAll);
+    void PreloadTiles(int nBlockXOff0, int nBlockYOff0, int nBlockXOff1,
+                      int nBlockYOff1);
     GIntBig GetTileId(int nRow, int nCol);
     bool DeleteTile(int nRow, int nCol);
     bool DeleteFromGriddedTileAncillary(GIntBig nTileId);
@@ -140,6 +181,15 @@ class GDALGPKGMBTilesLikePseudoDataset
 
     CPLErr WriteTile();
 
+    bool CanUseParallelDecoding(int nXSize, int nYSize, int nBufXSize,
+                                int nBufYSize,
+                                const GDALRasterIOExtraArg *psExtraArg);
+    CPLErr ReadWithParallelDecoding(
+        int nXOff, int nYOff, int nXSize, int nYSize, GByte *pabyData,
+        GSpacing nLineSpace,
+        const std::function<CPLErr(int nStripYOff, int nStripYSize,
+                                   GByte *pabyStripData)> &fnReadStrip);
+
     CPLErr FlushTiles();
     CPLErr FlushRemainingShiftedTiles(bool bPartialFlush);
     CPLErr WriteShiftedTile(int nRow, int nCol, int iBand, int nDstXOffset,
@@ -180,6 +230,12 @@ class GDALGPKGMBTilesLikeRasterBand : public GDALPamRasterBand
                               void *pData) override;
     virtual CPLErr IWriteBlock(int nBlockXOff, int nBlockYOff,
                                void *pData) override;
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                             int nXSize, int nYSize, void *pData,
+                             int nBufXSize, int nBufYSize,
+                             GDALDataType eBufType, GSpacing nPixelSpace,
+                             GSpacing nLineSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual CPLErr FlushCache(bool bAtClosing) override;
 
     virtual GDALColorTable *GetColorTable() override;
@@ -39,9 +39,9 @@
 #include "ogr_p.h"
 
 #include <condition_variable>
+#include <deque>
 #include <limits>
 #include <mutex>
-#include <queue>
 #include <vector>
 #include <set>
 #include <thread>
@@ -610,7 +610,9 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
 
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
-    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt,
+                                 OGRFeature *poFeatureToReuse = nullptr);
+    bool GetNextFeatureReusing(OGRFeatureUniquePtr &poFeature);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -729,6 +731,14 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     int m_nIsCompatOfOptimizedGetNextArrowArray = -1;
     bool m_bGetNextArrowArrayCalledSinceResetReading = false;
 
+    // Used when GetNextArrowArray() scans ranges of FID values:
+    // ]m_nArrowNextFIDRangeStart, m_nArrowNextFIDRangeStart + batch_size]
+    // is the next range to read, up to m_nArrowMaxFID.
+    bool m_bArrowFIDRangeScan = false;
+    bool m_bArrowPreserveOrder = true;
+    GIntBig m_nArrowNextFIDRangeStart = 0;
+    GIntBig m_nArrowMaxFID = 0;
+
     int m_nCountInsertInTransactionThreshold = -1;
     GIntBig m_nCountInsertInTransaction = 0;
     std::vector<CPLString> m_aoRTreeTriggersSQL{};
@@ -789,6 +799,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 #endif
 
     void CheckGeometryType(const OGRFeature *poFeature);
+    void CheckGeometryType(OGRwkbGeometryType eGeomType);
 
     OGRErr ReadTableDefinition();
     void InitView();
@@ -797,6 +808,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     bool StartDeferredSpatialIndexUpdate();
     bool FlushPendingSpatialIndexUpdate();
+    bool UpdateSpatialIndexAfterInsert(GIntBig nFID, const OGREnvelope &oEnv);
     void WorkaroundUpdate1TriggerIssue();
     void RevertWorkaroundUpdate1TriggerIssue();
 
@@ -809,7 +821,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoPackageTableLayer)
 
-    // Used when m_nIsCompatOfOptimizedGetNextArrowArray == TRUE
+    // Used when m_bArrowFIDRangeScan == true
     struct ArrowArrayPrefetchTask
     {
         std::thread m_oThread{};
@@ -822,14 +834,14 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
         std::string m_osErrorMsg{};
         std::unique_ptr<GDALGeoPackageDataset> m_poDS{};
         OGRGeoPackageTableLayer *m_poLayer{};
-        GIntBig m_iStartShapeId = 0;
+        GIntBig m_nFIDRangeStart = 0;
         std::unique_ptr<struct ArrowArray> m_psArrowArray = nullptr;
     };
 
-    std::queue<std::unique_ptr<ArrowArrayPrefetchTask>>
+    std::deque<std::unique_ptr<ArrowArrayPrefetchTask>>
         m_oQueueArrowArrayPrefetchTasks{};
 
-    // Used when m_nIsCompatOfOptimizedGetNextArrowArray == FALSE
+    // Used when m_bArrowFIDRangeScan == false
     std::thread m_oThreadNextArrowArray{};
     std::unique_ptr<OGRGPKGTableLayerFillArrowArray> m_poFillArrowArray{};
     std::unique_ptr<GDALGeoPackageDataset> m_poOtherDS{};
@@ -883,6 +895,9 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     void ResetReading() override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
     OGRErr ISetFeature(OGRFeature *poFeature) override;
     OGRErr IUpsertFeature(OGRFeature *poFeature) override;
     OGRErr IUpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
@@ -901,6 +916,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr SetAttributeFilter(const char *pszQuery) override;
     OGRErr SyncToDisk() override;
     OGRFeature *GetNextFeature() override;
+    bool GetNextFeatureInto(OGRFeatureUniquePtr &poFeature) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     OGRErr StartTransaction() override;
     OGRErr CommitTransaction() override;
@@ -1137,6 +1137,22 @@ CPLErr GDALGeoPackageDataset::IRasterIO(
     GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    if (eRWFlag == GF_Read && CanUseParallelDecoding(nXSize, nYSize, nBufXSize,
+                                                     nBufYSize, psExtraArg))
+    {
+        return ReadWithParallelDecoding(
+            nXOff, nYOff, nXSize, nYSize, static_cast<GByte *>(pData),
+            nLineSpace,
+            [&](int nStripYOff, int nStripYSize, GByte *pabyStripData)
+            {
+                return OGRSQLiteBaseDataSource::IRasterIO(
+                    GF_Read, nXOff, nStripYOff, nXSize, nStripYSize,
+                    pabyStripData, nBufXSize, nStripYSize, eBufType,
+                    nBandCount, panBandMap, nPixelSpace, nLineSpace,
+                    nBandSpace, psExtraArg);
+            });
+    }
+
     CPLErr eErr = OGRSQLiteBaseDataSource::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
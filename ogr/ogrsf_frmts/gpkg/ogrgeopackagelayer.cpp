@@ -93,14 +93,37 @@ void OGRGeoPackageLayer::ClearStatement()
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
 {
+    OGRFeatureUniquePtr poFeature;
+    GetNextFeatureReusing(poFeature);
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                       GetNextFeatureReusing()                        */
+/************************************************************************/
+
+/** Implementation of GetNextFeature() and GetNextFeatureInto(): poFeature
+ * may contain a feature to recycle. */
+bool OGRGeoPackageLayer::GetNextFeatureReusing(OGRFeatureUniquePtr &poFeature)
+
+{
+    if (poFeature && poFeature->GetDefnRef() != m_poFeatureDefn)
+        poFeature.reset();
+
     if (m_bEOF)
-        return nullptr;
+    {
+        poFeature.reset();
+        return false;
+    }
 
     if (m_poQueryStatement == nullptr)
     {
         ResetStatement();
         if (m_poQueryStatement == nullptr)
-            return nullptr;
+        {
+            poFeature.reset();
+            return false;
+        }
     }
 
     for (; true;)
@@ -126,7 +149,8 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
                 ClearStatement();
                 m_bEOF = true;
 
-                return nullptr;
+                poFeature.reset();
+                return false;
             }
         }
         else
@@ -134,14 +158,16 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        poFeature.reset(
+            TranslateFeature(m_poQueryStatement, poFeature.release()));
 
         if ((m_poFilterGeom == nullptr ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
-            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
-            return poFeature;
+            (m_poAttrQuery == nullptr ||
+             m_poAttrQuery->Evaluate(poFeature.get())))
+            return true;
 
-        delete poFeature;
+        // Feature not selected: it is recycled on next iteration
     }
 }
 
@@ -343,13 +369,26 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                         TranslateFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                 OGRFeature *poFeatureToReuse)
 
 {
     /* -------------------------------------------------------------------- */
-    /*      Create a feature from the current result.                       */
+    /*      Create a feature from the current result, or recycle the one    */
+    /*      provided by the caller, as well as its geometry.                */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    std::unique_ptr<OGRGeometry> poGeomToReuse;
+    if (poFeature)
+    {
+        if (m_iGeomCol >= 0)
+            poGeomToReuse.reset(poFeature->StealGeometry(0));
+        poFeature->Reset();
+    }
+    else
+    {
+        poFeature = new OGRFeature(m_poFeatureDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -385,8 +424,8 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
             // coverity[tainted_data_return]
             const GByte *pabyGpkg = static_cast<const GByte *>(
                 sqlite3_column_blob(hStmt, m_iGeomCol));
-            OGRGeometry *poGeom =
-                GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+            OGRGeometry *poGeom = GPkgGeometryToOGR(
+                pabyGpkg, iGpkgSize, nullptr, poGeomToReuse.release());
             if (poGeom == nullptr)
             {
                 // Try also spatialite geometry blobs
@@ -33,6 +33,7 @@
 #include "cpl_md5.h"
 #include "cpl_time.h"
 #include "ogr_p.h"
+#include "ogrlayerarrow.h"
 #include "sqlite_rtree_bulk_load/wrapper.h"
 #include "gdal_priv_templates.hpp"
 
@@ -1570,7 +1571,7 @@ void OGRGeoPackageTableLayer::CancelAsyncNextArrowArray()
     while (!m_oQueueArrowArrayPrefetchTasks.empty())
     {
         auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
-        m_oQueueArrowArrayPrefetchTasks.pop();
+        m_oQueueArrowArrayPrefetchTasks.pop_front();
 
         {
             std::lock_guard oLock(task->m_oMutex);
@@ -2115,16 +2116,23 @@ void OGRGeoPackageTableLayer::DisableFeatureCountTriggers(
  * reflect the dimensionality of feature geometries.
  */
 void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
+{
+    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+    CheckGeometryType(poGeom ? poGeom->getGeometryType() : wkbNone);
+}
+
+/** Same as above, with the geometry type of the feature geometry, or wkbNone
+ * if it has no geometry.
+ */
+void OGRGeoPackageTableLayer::CheckGeometryType(OGRwkbGeometryType eGeomTypeIn)
 {
     const OGRwkbGeometryType eLayerGeomType = GetGeomType();
     const OGRwkbGeometryType eFlattenLayerGeomType = wkbFlatten(eLayerGeomType);
-    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
     if (eFlattenLayerGeomType != wkbNone && eFlattenLayerGeomType != wkbUnknown)
     {
-        if (poGeom != nullptr)
+        if (eGeomTypeIn != wkbNone)
         {
-            OGRwkbGeometryType eGeomType =
-                wkbFlatten(poGeom->getGeometryType());
+            OGRwkbGeometryType eGeomType = wkbFlatten(eGeomTypeIn);
             if (!OGR_GT_IsSubClassOf(eGeomType, eFlattenLayerGeomType) &&
                 m_eSetBadGeomTypeWarned.find(eGeomType) ==
                     m_eSetBadGeomTypeWarned.end())
@@ -2150,10 +2158,10 @@ void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
     // if we have geometries with Z and M components
     if (m_nZFlag == 0 || m_nMFlag == 0)
     {
-        if (poGeom != nullptr)
+        if (eGeomTypeIn != wkbNone)
         {
             bool bUpdateGpkgGeometryColumnsTable = false;
-            const OGRwkbGeometryType eGeomType = poGeom->getGeometryType();
+            const OGRwkbGeometryType eGeomType = eGeomTypeIn;
             if (m_nZFlag == 0 && wkbHasZ(eGeomType))
             {
                 if (eLayerGeomType != wkbUnknown && !wkbHasZ(eLayerGeomType))
@@ -2538,79 +2546,8 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
             poGeom->getEnvelope(&oEnv);
             UpdateExtent(&oEnv);
 
-            if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
-                HasSpatialIndex() && m_poDS->IsInTransaction())
-            {
-                m_nCountInsertInTransaction++;
-                if (m_nCountInsertInTransactionThreshold < 0)
-                {
-                    m_nCountInsertInTransactionThreshold =
-                        atoi(CPLGetConfigOption(
-                            "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
-                }
-                if (m_nCountInsertInTransaction ==
-                    m_nCountInsertInTransactionThreshold)
-                {
-                    StartDeferredSpatialIndexUpdate();
-                }
-                else if (!m_aoRTreeTriggersSQL.empty())
-                {
-                    if (m_aoRTreeEntries.size() == 1000 * 1000)
-                    {
-                        if (!FlushPendingSpatialIndexUpdate())
-                            return OGRERR_FAILURE;
-                    }
-                    GPKGRTreeEntry sEntry;
-                    sEntry.nId = nFID;
-                    sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                    sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                    sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                    sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                    m_aoRTreeEntries.push_back(sEntry);
-                }
-            }
-            else if (!bUpsert && m_bAllowedRTreeThread &&
-                     !m_bErrorDuringRTreeThread)
-            {
-                GPKGRTreeEntry sEntry;
-#ifdef DEBUG_VERBOSE
-                if (m_aoRTreeEntries.empty())
-                    CPLDebug("GPKG",
-                             "Starting to fill m_aoRTreeEntries at "
-                             "FID " CPL_FRMT_GIB,
-                             nFID);
-#endif
-                sEntry.nId = nFID;
-                sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                try
-                {
-                    m_aoRTreeEntries.push_back(sEntry);
-                    if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
-                    {
-                        m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
-                        m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
-                    }
-                    if (!m_bThreadRTreeStarted &&
-                        m_oQueueRTreeEntries.size() ==
-                            m_nRTreeBatchesBeforeStart)
-                    {
-                        StartAsyncRTree();
-                    }
-                }
-                catch (const std::bad_alloc &)
-                {
-                    CPLDebug("GPKG",
-                             "Memory allocation error regarding RTree "
-                             "structures. Falling back to slower method");
-                    if (m_bThreadRTreeStarted)
-                        CancelAsyncRTree();
-                    else
-                        m_bAllowedRTreeThread = false;
-                }
-            }
+            if (!bUpsert && !UpdateSpatialIndexAfterInsert(nFID, oEnv))
+                return OGRERR_FAILURE;
         }
     }
 
@@ -2630,6 +2567,89 @@ OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
     return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
 }
 
+/************************************************************************/
+/*                    UpdateSpatialIndexAfterInsert()                   */
+/************************************************************************/
+
+/** Update the spatial index, or the structures used to update it in a
+ * deferred way, after the insertion of a feature with a non-empty geometry of
+ * envelope oEnv.
+ */
+bool OGRGeoPackageTableLayer::UpdateSpatialIndexAfterInsert(
+    GIntBig nFID, const OGREnvelope &oEnv)
+{
+    if (!m_bDeferredSpatialIndexCreation && HasSpatialIndex() &&
+        m_poDS->IsInTransaction())
+    {
+        m_nCountInsertInTransaction++;
+        if (m_nCountInsertInTransactionThreshold < 0)
+        {
+            m_nCountInsertInTransactionThreshold = atoi(CPLGetConfigOption(
+                "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
+        }
+        if (m_nCountInsertInTransaction ==
+            m_nCountInsertInTransactionThreshold)
+        {
+            StartDeferredSpatialIndexUpdate();
+        }
+        else if (!m_aoRTreeTriggersSQL.empty())
+        {
+            if (m_aoRTreeEntries.size() == 1000 * 1000)
+            {
+                if (!FlushPendingSpatialIndexUpdate())
+                    return false;
+            }
+            GPKGRTreeEntry sEntry;
+            sEntry.nId = nFID;
+            sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+            sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+            sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+            sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+            m_aoRTreeEntries.push_back(sEntry);
+        }
+    }
+    else if (m_bAllowedRTreeThread && !m_bErrorDuringRTreeThread)
+    {
+        GPKGRTreeEntry sEntry;
+#ifdef DEBUG_VERBOSE
+        if (m_aoRTreeEntries.empty())
+            CPLDebug("GPKG",
+                     "Starting to fill m_aoRTreeEntries at "
+                     "FID " CPL_FRMT_GIB,
+                     nFID);
+#endif
+        sEntry.nId = nFID;
+        sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+        sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+        sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+        sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+        try
+        {
+            m_aoRTreeEntries.push_back(sEntry);
+            if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
+            {
+                m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
+                m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
+            }
+            if (!m_bThreadRTreeStarted &&
+                m_oQueueRTreeEntries.size() == m_nRTreeBatchesBeforeStart)
+            {
+                StartAsyncRTree();
+            }
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLDebug("GPKG", "Memory allocation error regarding RTree "
+                             "structures. Falling back to slower method");
+            if (m_bThreadRTreeStarted)
+                CancelAsyncRTree();
+            else
+                m_bAllowedRTreeThread = false;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                  SetDeferredSpatialIndexCreation()                   */
 /************************************************************************/
@@ -3573,11 +3593,26 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 /************************************************************************/
 
 OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+{
+    OGRFeatureUniquePtr poFeature;
+    GetNextFeatureInto(poFeature);
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                        GetNextFeatureInto()                          */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::GetNextFeatureInto(
+    OGRFeatureUniquePtr &poFeature)
 {
     if (!m_bFeatureDefnCompleted)
         GetLayerDefn();
     if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
-        return nullptr;
+    {
+        poFeature.reset();
+        return false;
+    }
 
     CancelAsyncNextArrowArray();
 
@@ -3586,15 +3621,19 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
         // Both are exclusive
         CreateSpatialIndexIfNecessary();
         if (!RunDeferredSpatialIndexUpdate())
-            return nullptr;
+        {
+            poFeature.reset();
+            return false;
+        }
     }
 
-    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
-    if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
+    if (!GetNextFeatureReusing(poFeature))
+        return false;
+    if (m_iFIDAsRegularColumnIndex >= 0)
     {
         poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
     }
-    return poFeature;
+    return true;
 }
 
 /************************************************************************/
@@ -8562,40 +8601,51 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     }
 
     if (m_nIsCompatOfOptimizedGetNextArrowArray == FALSE ||
-        m_pszFidColumn == nullptr || !m_soFilter.empty() ||
+        m_pszFidColumn == nullptr || m_poFilterGeom != nullptr ||
         m_poFillArrowArray ||
-        (!m_bGetNextArrowArrayCalledSinceResetReading && m_iNextShapeId > 0))
+        (!m_bGetNextArrowArrayCalledSinceResetReading && m_iNextShapeId > 0) ||
+        (m_bGetNextArrowArrayCalledSinceResetReading && !m_bArrowFIDRangeScan))
     {
         return GetNextArrowArrayAsynchronous(stream, out_array);
     }
 
-    // We can use this optimized version only if there is no hole in FID
-    // numbering. That is min(fid) == 1 and max(fid) == m_nTotalFeatureCount
-    if (m_nIsCompatOfOptimizedGetNextArrowArray < 0)
+    // We can use this optimized version, which reads ranges of FID values,
+    // only if FID values are positive and if there are not too many holes in
+    // FID numbering, otherwise we would issue too many requests on empty
+    // ranges.
+    if (!m_bGetNextArrowArrayCalledSinceResetReading)
     {
-        m_nIsCompatOfOptimizedGetNextArrowArray = FALSE;
+        m_bArrowFIDRangeScan = false;
         const auto nTotalFeatureCount = GetTotalFeatureCount();
-        if (nTotalFeatureCount < 0)
+        if (nTotalFeatureCount <= 0)
             return GetNextArrowArrayAsynchronous(stream, out_array);
+        GIntBig nMinFID;
         {
-            char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
+            char *pszSQL = sqlite3_mprintf("SELECT MIN(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMaxFID != nTotalFeatureCount)
+            if (nMinFID < 1)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        GIntBig nMaxFID;
         {
-            char *pszSQL = sqlite3_mprintf("SELECT MIN(\"%w\") FROM \"%w\"",
+            char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMinFID != 1)
+            if (nMaxFID < nMinFID ||
+                nMaxFID - nMinFID >= 2 * nTotalFeatureCount)
                 return GetNextArrowArrayAsynchronous(stream, out_array);
         }
-        m_nIsCompatOfOptimizedGetNextArrowArray = TRUE;
+        m_bArrowFIDRangeScan = true;
+        m_nArrowNextFIDRangeStart = nMinFID - 1;
+        m_nArrowMaxFID = nMaxFID;
+        m_bArrowPreserveOrder = CPLTestBool(
+            m_aosArrowArrayStreamOptions.FetchNameValueDef("PRESERVE_ORDER",
+                                                           "YES"));
     }
 
     m_bGetNextArrowArrayCalledSinceResetReading = true;
@@ -8605,58 +8655,68 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
         m_aosArrowArrayStreamOptions);
 
-    // Fetch the answer from a potentially queued asynchronous task
-    if (!m_oQueueArrowArrayPrefetchTasks.empty())
+    const auto GetThreadsAvailable = []()
     {
-        const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
-        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
-        m_oQueueArrowArrayPrefetchTasks.pop();
+        const char *pszMaxThreads =
+            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+        if (pszMaxThreads == nullptr)
+            return std::min(4, CPLGetNumCPUs());
+        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+            return CPLGetNumCPUs();
+        else
+            return atoi(pszMaxThreads);
+    };
 
-        // Wait for thread to be ready
+    // Loop until we get a non-empty batch, or reach the end of the layer.
+    // Empty batches happen on FID ranges that only contain deleted features,
+    // or features that do not match the attribute filter.
+    while (true)
+    {
+        // Fetch the answer from a potentially queued asynchronous task
+        if (!m_oQueueArrowArrayPrefetchTasks.empty())
         {
-            std::unique_lock<std::mutex> oLock(task->m_oMutex);
-            while (!task->m_bArrayReady)
+            // If the order of features does not need to be preserved, take
+            // the first task that has completed, if any. Otherwise wait for
+            // the task with the lowest FID range.
+            auto iterTask = m_oQueueArrowArrayPrefetchTasks.begin();
+            if (!m_bArrowPreserveOrder)
             {
-                task->m_oCV.wait(oLock);
+                for (auto iter = m_oQueueArrowArrayPrefetchTasks.begin();
+                     iter != m_oQueueArrowArrayPrefetchTasks.end(); ++iter)
+                {
+                    // The worker thread holds the mutex while it is busy
+                    std::unique_lock oLock((*iter)->m_oMutex,
+                                           std::try_to_lock);
+                    if (oLock.owns_lock() && (*iter)->m_bArrayReady)
+                    {
+                        iterTask = iter;
+                        break;
+                    }
+                }
             }
-            task->m_bArrayReady = false;
-        }
-        if (!task->m_osErrorMsg.empty())
-            CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                     task->m_osErrorMsg.c_str());
+            auto task = std::move(*iterTask);
+            m_oQueueArrowArrayPrefetchTasks.erase(iterTask);
 
-        const auto stopThread = [&task]()
-        {
+            // Wait for thread to be ready
             {
-                std::lock_guard oLock(task->m_oMutex);
-                task->m_bStop = true;
-                task->m_oCV.notify_one();
+                std::unique_lock<std::mutex> oLock(task->m_oMutex);
+                while (!task->m_bArrayReady)
+                {
+                    task->m_oCV.wait(oLock);
+                }
+                task->m_bArrayReady = false;
             }
-            if (task->m_oThread.joinable())
-                task->m_oThread.join();
-        };
-
-        if (task->m_iStartShapeId != m_iNextShapeId)
-        {
-            // Should not normally happen, unless the user messes with
-            // GetNextFeature()
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Worker thread task has not expected m_iStartShapeId "
-                     "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
-                     task->m_iStartShapeId, m_iNextShapeId);
-            if (task->m_psArrowArray->release)
-                task->m_psArrowArray->release(task->m_psArrowArray.get());
-
-            stopThread();
-        }
-        else if (task->m_psArrowArray->release)
-        {
-            m_iNextShapeId += task->m_psArrowArray->length;
 
-            // Transfer the task ArrowArray to the client array
-            memcpy(out_array, task->m_psArrowArray.get(),
-                   sizeof(struct ArrowArray));
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+            const auto stopThread = [&task]()
+            {
+                {
+                    std::lock_guard oLock(task->m_oMutex);
+                    task->m_bStop = true;
+                    task->m_oCV.notify_one();
+                }
+                if (task->m_oThread.joinable())
+                    task->m_oThread.join();
+            };
 
             const bool bMemoryLimitReached = [&task]()
             {
@@ -8664,179 +8724,220 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                 return task->m_bMemoryLimitReached;
             }();
 
-            if (bMemoryLimitReached)
+            if (!task->m_osErrorMsg.empty() ||
+                (bMemoryLimitReached && !m_bArrowPreserveOrder))
             {
-                m_nIsCompatOfOptimizedGetNextArrowArray = false;
-                stopThread();
-                CancelAsyncNextArrowArray();
-                return 0;
-            }
-            // Are the records still available for reading beyond the current
-            // queued tasks ? If so, recycle this task to read them
-            else if (task->m_iStartShapeId +
-                         static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
-                     m_nTotalFeatureCount)
-            {
-                task->m_iStartShapeId +=
-                    static_cast<GIntBig>(nTasks) * nMaxBatchSize;
-                task->m_poLayer->m_iNextShapeId = task->m_iStartShapeId;
-                try
+                if (!task->m_osErrorMsg.empty())
                 {
-                    // Wake-up thread with new task
-                    {
-                        std::lock_guard oLock(task->m_oMutex);
-                        task->m_bFetchRows = true;
-                        task->m_oCV.notify_one();
-                    }
-                    m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
-                    return 0;
+                    CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                             task->m_osErrorMsg.c_str());
                 }
-                catch (const std::exception &e)
+                else
                 {
+                    // We cannot resume reading in a non-optimized way if
+                    // we have returned batches out of order.
                     CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot start worker thread: %s", e.what());
+                             "Memory limit reached while reading a batch. "
+                             "Retry with PRESERVE_ORDER=YES or a lower value "
+                             "of MAX_FEATURES_IN_BATCH");
                 }
-            }
-            else
-            {
+                if (task->m_psArrowArray->release)
+                    task->m_psArrowArray->release(task->m_psArrowArray.get());
                 stopThread();
-                return 0;
+                CancelAsyncNextArrowArray();
+                memset(out_array, 0, sizeof(*out_array));
+                return EIO;
             }
-        }
-
-        stopThread();
-    }
 
-    const auto GetThreadsAvailable = []()
-    {
-        const char *pszMaxThreads =
-            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
-        if (pszMaxThreads == nullptr)
-            return std::min(4, CPLGetNumCPUs());
-        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
-            return CPLGetNumCPUs();
-        else
-            return atoi(pszMaxThreads);
-    };
-
-    // Start asynchronous tasks to prefetch the next ArrowArray
-    if (m_poDS->GetAccess() == GA_ReadOnly &&
-        m_oQueueArrowArrayPrefetchTasks.empty() &&
-        m_iNextShapeId + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
-            m_nTotalFeatureCount &&
-        sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
-        CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
-    {
-        const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
-            DIV_ROUND_UP(m_nTotalFeatureCount - nMaxBatchSize - m_iNextShapeId,
-                         nMaxBatchSize),
-            GetThreadsAvailable()));
-        CPLDebug("GPKG", "Using %d threads", nMaxTasks);
-        GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
-        oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
-        oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
-        for (int iTask = 0; iTask < nMaxTasks; ++iTask)
-        {
-            auto task = std::make_unique<ArrowArrayPrefetchTask>();
-            task->m_iStartShapeId =
-                m_iNextShapeId +
-                static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
-            task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
-            if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
+            const bool bHasArray = task->m_psArrowArray->release != nullptr;
+            if (bHasArray)
             {
-                break;
-            }
-            auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
-                task->m_poDS->GetLayerByName(GetName()));
-            if (poOtherLayer == nullptr ||
-                poOtherLayer->GetLayerDefn()->GetFieldCount() !=
-                    m_poFeatureDefn->GetFieldCount())
-            {
-                break;
+                m_iNextShapeId += task->m_psArrowArray->length;
+
+                // Transfer the task ArrowArray to the client array
+                memcpy(out_array, task->m_psArrowArray.get(),
+                       sizeof(struct ArrowArray));
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
             }
 
-            // Install query logging callback
-            if (m_poDS->pfnQueryLoggerFunc)
+            if (bMemoryLimitReached)
             {
-                task->m_poDS->SetQueryLoggerFunc(m_poDS->pfnQueryLoggerFunc,
-                                                 m_poDS->poQueryLoggerArg);
+                m_nIsCompatOfOptimizedGetNextArrowArray = false;
+                stopThread();
+                CancelAsyncNextArrowArray();
+                return 0;
             }
 
-            task->m_poLayer = poOtherLayer;
-            task->m_psArrowArray = std::make_unique<struct ArrowArray>();
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
-
-            poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
-            poOtherLayer->m_aosArrowArrayStreamOptions =
-                m_aosArrowArrayStreamOptions;
-            auto poOtherFDefn = poOtherLayer->GetLayerDefn();
-            for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+            // Are there still FID ranges to read beyond the ones of the
+            // current queued tasks ? If so, recycle this task to read them
+            if (m_nArrowNextFIDRangeStart < m_nArrowMaxFID)
             {
-                poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+                task->m_nFIDRangeStart = m_nArrowNextFIDRangeStart;
+                task->m_poLayer->m_nArrowNextFIDRangeStart =
+                    m_nArrowNextFIDRangeStart;
+                m_nArrowNextFIDRangeStart += nMaxBatchSize;
+                // Wake-up thread with new task
+                {
+                    std::lock_guard oLock(task->m_oMutex);
+                    task->m_bFetchRows = true;
+                    task->m_oCV.notify_one();
+                }
+                m_oQueueArrowArrayPrefetchTasks.push_back(std::move(task));
             }
-            for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+            else
             {
-                poOtherFDefn->GetFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+                stopThread();
             }
 
-            poOtherLayer->m_iNextShapeId = task->m_iStartShapeId;
+            if (bHasArray)
+                return 0;
+            continue;
+        }
 
-            auto taskPtr = task.get();
-            auto taskRunner = [taskPtr]()
+        // Start asynchronous tasks to prefetch the next ArrowArray
+        if (m_poDS->GetAccess() == GA_ReadOnly &&
+            m_nArrowNextFIDRangeStart +
+                    2 * static_cast<GIntBig>(nMaxBatchSize) <=
+                m_nArrowMaxFID &&
+            sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
+            CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
+        {
+            const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
+                DIV_ROUND_UP(m_nArrowMaxFID - nMaxBatchSize -
+                                 m_nArrowNextFIDRangeStart,
+                             nMaxBatchSize),
+                GetThreadsAvailable()));
+            CPLDebug("GPKG", "Using %d threads", nMaxTasks);
+            GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
+            oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
+            oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+            // The first FID range is read by the current thread.
+            GIntBig nNextFIDRangeStart =
+                m_nArrowNextFIDRangeStart + nMaxBatchSize;
+            for (int iTask = 0; iTask < nMaxTasks; ++iTask)
             {
-                std::unique_lock oLock(taskPtr->m_oMutex);
-                do
+                auto task = std::make_unique<ArrowArrayPrefetchTask>();
+                task->m_nFIDRangeStart = nNextFIDRangeStart;
+                task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
+                if (!task->m_poDS->Open(&oOpenInfo,
+                                        m_poDS->m_osFilenameInZip))
                 {
-                    taskPtr->m_bFetchRows = false;
-                    taskPtr->m_poLayer->GetNextArrowArrayInternal(
-                        taskPtr->m_psArrowArray.get(), taskPtr->m_osErrorMsg,
-                        taskPtr->m_bMemoryLimitReached);
-                    taskPtr->m_bArrayReady = true;
-                    taskPtr->m_oCV.notify_one();
-                    if (taskPtr->m_bMemoryLimitReached)
-                        break;
-                    // cppcheck-suppress knownConditionTrueFalse
-                    // Coverity apparently is confused by the fact that we
-                    // use unique_lock here to guard access for m_bStop whereas
-                    // in other places we use a lock_guard, but there's nothing
-                    // wrong.
-                    // coverity[missing_lock:FALSE]
-                    while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                    break;
+                }
+                auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
+                    task->m_poDS->GetLayerByName(GetName()));
+                if (poOtherLayer == nullptr ||
+                    poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+                        m_poFeatureDefn->GetFieldCount())
+                {
+                    break;
+                }
+
+                // Install query logging callback
+                if (m_poDS->pfnQueryLoggerFunc)
+                {
+                    task->m_poDS->SetQueryLoggerFunc(
+                        m_poDS->pfnQueryLoggerFunc, m_poDS->poQueryLoggerArg);
+                }
+
+                task->m_poLayer = poOtherLayer;
+                task->m_psArrowArray = std::make_unique<struct ArrowArray>();
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+
+                if (m_pszAttrQueryString)
+                    poOtherLayer->SetAttributeFilter(m_pszAttrQueryString);
+                poOtherLayer->m_nArrowMaxFID = m_nArrowMaxFID;
+                poOtherLayer->m_aosArrowArrayStreamOptions =
+                    m_aosArrowArrayStreamOptions;
+                auto poOtherFDefn = poOtherLayer->GetLayerDefn();
+                for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+                }
+                for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+                }
+
+                poOtherLayer->m_nArrowNextFIDRangeStart =
+                    task->m_nFIDRangeStart;
+
+                auto taskPtr = task.get();
+                auto taskRunner = [taskPtr]()
+                {
+                    std::unique_lock oLock(taskPtr->m_oMutex);
+                    do
                     {
-                        taskPtr->m_oCV.wait(oLock);
-                    }
-                } while (!taskPtr->m_bStop);
-            };
+                        taskPtr->m_bFetchRows = false;
+                        taskPtr->m_poLayer->GetNextArrowArrayInternal(
+                            taskPtr->m_psArrowArray.get(),
+                            taskPtr->m_osErrorMsg,
+                            taskPtr->m_bMemoryLimitReached);
+                        taskPtr->m_bArrayReady = true;
+                        taskPtr->m_oCV.notify_one();
+                        if (taskPtr->m_bMemoryLimitReached)
+                            break;
+                        // cppcheck-suppress knownConditionTrueFalse
+                        // Coverity apparently is confused by the fact that we
+                        // use unique_lock here to guard access for m_bStop
+                        // whereas in other places we use a lock_guard, but
+                        // there's nothing wrong.
+                        // coverity[missing_lock:FALSE]
+                        while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                        {
+                            taskPtr->m_oCV.wait(oLock);
+                        }
+                    } while (!taskPtr->m_bStop);
+                };
 
-            task->m_bFetchRows = true;
-            try
-            {
-                task->m_oThread = std::thread(taskRunner);
-            }
-            catch (const std::exception &e)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot start worker thread: %s", e.what());
-                break;
+                task->m_bFetchRows = true;
+                try
+                {
+                    task->m_oThread = std::thread(taskRunner);
+                }
+                catch (const std::exception &e)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot start worker thread: %s", e.what());
+                    break;
+                }
+                m_oQueueArrowArrayPrefetchTasks.push_back(std::move(task));
+                nNextFIDRangeStart += nMaxBatchSize;
             }
-            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
         }
-    }
 
-    std::string osErrorMsg;
-    bool bMemoryLimitReached = false;
-    int ret =
-        GetNextArrowArrayInternal(out_array, osErrorMsg, bMemoryLimitReached);
-    if (!osErrorMsg.empty())
-        CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
-    if (bMemoryLimitReached)
-    {
-        CancelAsyncNextArrowArray();
-        m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        // Read the next FID range in the current thread. This advances
+        // m_nArrowNextFIDRangeStart by one batch.
+        std::string osErrorMsg;
+        bool bMemoryLimitReached = false;
+        const int ret = GetNextArrowArrayInternal(out_array, osErrorMsg,
+                                                  bMemoryLimitReached);
+        if (!m_oQueueArrowArrayPrefetchTasks.empty())
+        {
+            // Ranges before that one have been assigned to prefetch tasks
+            m_nArrowNextFIDRangeStart =
+                m_oQueueArrowArrayPrefetchTasks.back()->m_nFIDRangeStart +
+                nMaxBatchSize;
+        }
+        if (!osErrorMsg.empty())
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
+        if (bMemoryLimitReached)
+        {
+            CancelAsyncNextArrowArray();
+            m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        }
+        if (ret != 0 || out_array->release != nullptr ||
+            !osErrorMsg.empty() || bMemoryLimitReached ||
+            (m_oQueueArrowArrayPrefetchTasks.empty() &&
+             m_nArrowNextFIDRangeStart >= m_nArrowMaxFID))
+        {
+            return ret;
+        }
     }
-    return ret;
 }
 
 /************************************************************************/
@@ -8850,7 +8951,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     bMemoryLimitReached = false;
     memset(out_array, 0, sizeof(*out_array));
 
-    if (m_iNextShapeId >= m_nTotalFeatureCount)
+    if (m_nArrowNextFIDRangeStart >= m_nArrowMaxFID)
     {
         return 0;
     }
@@ -8926,10 +9027,18 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     osSQL += "\" WHERE \"";
     osSQL += SQLEscapeName(m_pszFidColumn);
     osSQL += "\" BETWEEN ";
-    osSQL += std::to_string(m_iNextShapeId + 1);
+    osSQL += std::to_string(m_nArrowNextFIDRangeStart + 1);
     osSQL += " AND ";
-    osSQL += std::to_string(m_iNextShapeId +
+    osSQL += std::to_string(m_nArrowNextFIDRangeStart +
                             sFillArrowArray.psHelper->m_nMaxBatchSize);
+    if (!m_soFilter.empty())
+    {
+        // Only an attribute filter, since this code path is not used when
+        // there is a spatial filter
+        osSQL += " AND (";
+        osSQL += m_soFilter;
+        osSQL += ')';
+    }
 
     // CPLDebug("GPKG", "%s", osSQL.c_str());
 
@@ -8965,10 +9074,573 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     }
 
     m_iNextShapeId += sFillArrowArray.nCountRows;
+    if (!bMemoryLimitReached)
+        m_nArrowNextFIDRangeStart += sFillArrowArray.psHelper->m_nMaxBatchSize;
 
     return 0;
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+namespace
+{
+/** Description of an Arrow column handled by the native WriteArrowBatch() */
+struct GPKGArrowColumn
+{
+    const struct ArrowArray *psArray = nullptr;
+    char chFormat = 0;
+    int iOGRField = -1;  // -1 for the FID and geometry columns
+};
+
+inline bool GPKGArrowIsNull(const struct ArrowArray *psArray, size_t iIdx)
+{
+    return psArray->null_count != 0 && psArray->buffers[0] &&
+           (static_cast<const uint8_t *>(psArray->buffers[0])[iIdx / 8] &
+            (1 << (iIdx % 8))) == 0;
+}
+
+template <class OffsetType>
+inline const GByte *GPKGArrowGetBinary(const struct ArrowArray *psArray,
+                                       size_t iIdx, size_t &nLen)
+{
+    const auto panOffsets =
+        static_cast<const OffsetType *>(psArray->buffers[1]);
+    nLen = static_cast<size_t>(panOffsets[iIdx + 1] - panOffsets[iIdx]);
+    return static_cast<const GByte *>(psArray->buffers[2]) + panOffsets[iIdx];
+}
+
+template <class T>
+inline T GPKGArrowGetValue(const struct ArrowArray *psArray, size_t iIdx)
+{
+    return static_cast<const T *>(psArray->buffers[1])[iIdx];
+}
+}  // namespace
+
+/** Native implementation of WriteArrowBatch(), that binds the values of the
+ * Arrow columns directly to a prepared INSERT statement, and converts WKB
+ * geometries into GeoPackage geometry blobs without going through
+ * OGRGeometry in most cases.
+ *
+ * Only Arrow columns of type boolean, integer, floating-point, string and
+ * binary are handled. In other cases, or if the layer has specificities that
+ * require going through CreateFeature(), the generic implementation is used.
+ */
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                              struct ArrowArray *array,
+                                              CSLConstList papszOptions)
+{
+    if (!m_bFeatureDefnCompleted)
+        GetLayerDefn();
+
+    const auto UseBaseImplementation = [this, schema, array, papszOptions]()
+    { return OGRLayer::WriteArrowBatch(schema, array, papszOptions); };
+
+    if (!m_poDS->GetUpdate() || !m_bIsTable || m_pszFidColumn == nullptr ||
+        m_iFIDAsRegularColumnIndex >= 0 ||
+        CPLTestBool(CPLGetConfigOption("OGR_GPKG_WRITE_ARROW_BATCH_BASE_IMPL",
+                                       "NO")) ||
+        strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != array->n_children || array->null_count != 0)
+    {
+        return UseBaseImplementation();
+    }
+
+    const auto poGeomFieldDefn = m_poFeatureDefn->GetGeomFieldCount()
+                                     ? m_poFeatureDefn->GetGeomFieldDefn(0)
+                                     : nullptr;
+    if (poGeomFieldDefn)
+    {
+        // Rounding of coordinates requires going through OGRGeometry
+        const auto &oCoordPrec = poGeomFieldDefn->GetCoordinatePrecision();
+        if (oCoordPrec.dfXYResolution != OGRGeomCoordinatePrecision::UNKNOWN ||
+            oCoordPrec.dfZResolution != OGRGeomCoordinatePrecision::UNKNOWN ||
+            oCoordPrec.dfMResolution != OGRGeomCoordinatePrecision::UNKNOWN)
+        {
+            return UseBaseImplementation();
+        }
+    }
+
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+    if (!pszFIDName || pszFIDName[0] == 0)
+        pszFIDName = DEFAULT_ARROW_FID_NAME;
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+    // Map Arrow columns to the FID, geometry and attribute columns
+    GPKGArrowColumn sFIDColumn;
+    GPKGArrowColumn sGeomColumn;
+    std::vector<GPKGArrowColumn> asFieldColumns;
+    std::vector<bool> abFieldUsed(m_poFeatureDefn->GetFieldCount(), false);
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        const struct ArrowSchema *psChildSchema = schema->children[i];
+        GPKGArrowColumn sColumn;
+        sColumn.psArray = array->children[i];
+        const char *pszFormat = psChildSchema->format;
+        if (psChildSchema->dictionary != nullptr || pszFormat[0] == 0 ||
+            pszFormat[1] != 0 || psChildSchema->name == nullptr)
+        {
+            return UseBaseImplementation();
+        }
+        sColumn.chFormat = pszFormat[0];
+
+        const char *pszName = psChildSchema->name;
+        if (strcmp(pszName, pszFIDName) == 0)
+        {
+            if (sColumn.chFormat != 'i' && sColumn.chFormat != 'l')
+                return UseBaseImplementation();
+            sFIDColumn = sColumn;
+            continue;
+        }
+
+        if (sColumn.chFormat == 'z' || sColumn.chFormat == 'Z')
+        {
+            bool bIsGeom = strcmp(pszName, pszGeomFieldName) == 0;
+            if (!bIsGeom && psChildSchema->metadata)
+            {
+                const auto oMetadata =
+                    OGRParseArrowMetadata(psChildSchema->metadata);
+                auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+                bIsGeom = oIter != oMetadata.end() &&
+                          (oIter->second == EXTENSION_NAME_OGC_WKB ||
+                           oIter->second == EXTENSION_NAME_GEOARROW_WKB);
+            }
+            if (bIsGeom)
+            {
+                if (!poGeomFieldDefn || sGeomColumn.psArray)
+                    return UseBaseImplementation();
+                sGeomColumn = sColumn;
+                continue;
+            }
+        }
+
+        sColumn.iOGRField = m_poFeatureDefn->GetFieldIndex(pszName);
+        if (sColumn.iOGRField < 0 || abFieldUsed[sColumn.iOGRField] ||
+            m_abGeneratedColumns[sColumn.iOGRField])
+        {
+            return UseBaseImplementation();
+        }
+        abFieldUsed[sColumn.iOGRField] = true;
+
+        // Only accept conversions that cannot be lossy, and that do not
+        // require any formatting.
+        const auto poFieldDefn =
+            m_poFeatureDefn->GetFieldDefnUnsafe(sColumn.iOGRField);
+        const auto eType = poFieldDefn->GetType();
+        bool bCompatible = false;
+        switch (sColumn.chFormat)
+        {
+            case 'b':
+            case 'c':
+            case 'C':
+            case 's':
+            case 'S':
+            case 'i':
+                bCompatible = eType == OFTInteger || eType == OFTInteger64 ||
+                              eType == OFTReal;
+                break;
+            case 'I':
+                bCompatible = eType == OFTInteger64 || eType == OFTReal;
+                break;
+            case 'l':
+                bCompatible = eType == OFTInteger64;
+                break;
+            case 'f':
+            case 'g':
+                bCompatible = eType == OFTReal;
+                break;
+            case 'u':
+            case 'U':
+                // Strings with a maximum width may need to be truncated
+                bCompatible =
+                    eType == OFTString && poFieldDefn->GetWidth() == 0;
+                break;
+            case 'z':
+            case 'Z':
+                bCompatible = eType == OFTBinary;
+                break;
+            default:
+                break;
+        }
+        if (!bCompatible)
+            return UseBaseImplementation();
+        asFieldColumns.push_back(sColumn);
+    }
+
+    if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+        return false;
+
+    CancelAsyncNextArrowArray();
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+    // To maximize performance of insertion, disable feature count triggers
+    if (m_bOGRFeatureCountTriggersEnabled)
+    {
+        DisableFeatureCountTriggers();
+    }
+#endif
+
+    // Build the INSERT statement
+    std::string osColumns;
+    std::string osValues;
+    const auto AddColumn = [&osColumns, &osValues](const char *pszColName)
+    {
+        if (!osColumns.empty())
+        {
+            osColumns += ", ";
+            osValues += ", ";
+        }
+        osColumns += '"';
+        osColumns += SQLEscapeName(pszColName);
+        osColumns += '"';
+        osValues += '?';
+    };
+    if (sFIDColumn.psArray)
+        AddColumn(m_pszFidColumn);
+    if (sGeomColumn.psArray)
+        AddColumn(poGeomFieldDefn->GetNameRef());
+    for (const auto &sColumn : asFieldColumns)
+    {
+        AddColumn(m_poFeatureDefn->GetFieldDefnUnsafe(sColumn.iOGRField)
+                      ->GetNameRef());
+    }
+    std::string osSQL("INSERT INTO \"");
+    osSQL += SQLEscapeName(m_pszTableName);
+    osSQL += '"';
+    if (osColumns.empty())
+    {
+        osSQL += " DEFAULT VALUES";
+    }
+    else
+    {
+        osSQL += " (";
+        osSQL += osColumns;
+        osSQL += ") VALUES (";
+        osSQL += osValues;
+        osSQL += ')';
+    }
+
+    sqlite3 *hDB = m_poDS->GetDB();
+    sqlite3_stmt *hStmt = nullptr;
+    if (sqlite3_prepare_v2(hDB, osSQL.c_str(), -1, &hStmt, nullptr) !=
+        SQLITE_OK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "failed to prepare SQL: %s - %s",
+                 osSQL.c_str(), sqlite3_errmsg(hDB));
+        return false;
+    }
+
+    bool bTransactionOK;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        bTransactionOK = StartTransaction() == OGRERR_NONE;
+    }
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+    const GIntBig nTotalFeatureCountBefore = m_nTotalFeatureCount;
+#endif
+
+    const auto Cleanup = [&](bool bOK)
+    {
+        sqlite3_finalize(hStmt);
+        hStmt = nullptr;
+        if (bTransactionOK)
+        {
+            if (bOK)
+            {
+                bOK = CommitTransaction() == OGRERR_NONE;
+            }
+            else
+            {
+                RollbackTransaction();
+
+                // Undo the side effects of the rows of this batch that have
+                // been rolled back.
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+                m_nTotalFeatureCount = nTotalFeatureCountBefore;
+#endif
+                // The rollback has discarded m_aoRTreeEntries, which may
+                // also hold entries of features inserted before this batch,
+                // while m_oQueueRTreeEntries may hold entries of this batch.
+                // Fall back to populating the RTree from the table content.
+                if (m_bAllowedRTreeThread && !m_bThreadRTreeStarted)
+                {
+                    m_oQueueRTreeEntries.clear();
+                    m_aoRTreeEntries.clear();
+                    m_bAllowedRTreeThread = false;
+                }
+            }
+        }
+        return bOK;
+    };
+
+    std::vector<GByte> abyGeomBlob;
+    OGREnvelope sBatchExtent;
+    const size_t nParentOffset = static_cast<size_t>(array->offset);
+    for (size_t iRow = 0; iRow < static_cast<size_t>(array->length); ++iRow)
+    {
+        int iCol = 1;
+        int err = SQLITE_OK;
+
+        bool bFIDIsNull = false;
+        if (sFIDColumn.psArray)
+        {
+            const auto psFIDArray = sFIDColumn.psArray;
+            const size_t iIdx =
+                nParentOffset + static_cast<size_t>(psFIDArray->offset) + iRow;
+            bFIDIsNull = GPKGArrowIsNull(psFIDArray, iIdx);
+            if (bFIDIsNull)
+                err = sqlite3_bind_null(hStmt, iCol++);
+            else if (sFIDColumn.chFormat == 'i')
+                err = sqlite3_bind_int64(
+                    hStmt, iCol++,
+                    GPKGArrowGetValue<int32_t>(psFIDArray, iIdx));
+            else
+                err = sqlite3_bind_int64(
+                    hStmt, iCol++,
+                    GPKGArrowGetValue<int64_t>(psFIDArray, iIdx));
+        }
+
+        OGREnvelope sEnvelope;
+        bool bHasNonEmptyGeom = false;
+        if (sGeomColumn.psArray && err == SQLITE_OK)
+        {
+            const auto psGeomArray = sGeomColumn.psArray;
+            const size_t iIdx =
+                nParentOffset + static_cast<size_t>(psGeomArray->offset) + iRow;
+            if (GPKGArrowIsNull(psGeomArray, iIdx))
+            {
+                err = sqlite3_bind_null(hStmt, iCol++);
+            }
+            else
+            {
+                size_t nWKBSize = 0;
+                const GByte *pabyWKB =
+                    sGeomColumn.chFormat == 'z'
+                        ? GPKGArrowGetBinary<int32_t>(psGeomArray, iIdx,
+                                                      nWKBSize)
+                        : GPKGArrowGetBinary<int64_t>(psGeomArray, iIdx,
+                                                      nWKBSize);
+                OGRwkbGeometryType eGeomType = wkbNone;
+                bool bEmpty = false;
+                if (GPkgGeometryFromWKB(pabyWKB, nWKBSize, m_iSrs, abyGeomBlob,
+                                        eGeomType, sEnvelope, bEmpty))
+                {
+                    CheckGeometryType(eGeomType);
+                    bHasNonEmptyGeom = !bEmpty;
+                    err = sqlite3_bind_blob(
+                        hStmt, iCol++, abyGeomBlob.data(),
+                        static_cast<int>(abyGeomBlob.size()), SQLITE_STATIC);
+                }
+                else
+                {
+                    // Geometry types (curves, collections) or WKB variants
+                    // not handled by GPkgGeometryFromWKB()
+                    OGRGeometry *poGeom = nullptr;
+                    if (OGRGeometryFactory::createFromWkb(
+                            pabyWKB, nullptr, &poGeom, nWKBSize) !=
+                        OGRERR_NONE)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Cannot parse WKB geometry at row %d",
+                                 static_cast<int>(iRow));
+                        return Cleanup(false);
+                    }
+                    std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+                    CheckGeometryType(poGeom->getGeometryType());
+                    size_t nBlobSize = 0;
+                    GByte *pabyBlob = GPkgGeometryFromOGR(
+                        poGeom, m_iSrs, &m_sBinaryPrecision, &nBlobSize);
+                    if (!pabyBlob)
+                        return Cleanup(false);
+                    err = sqlite3_bind_blob(hStmt, iCol++, pabyBlob,
+                                            static_cast<int>(nBlobSize),
+                                            CPLFree);
+                    CreateGeometryExtensionIfNecessary(poGeom);
+                    if (!poGeom->IsEmpty())
+                    {
+                        bHasNonEmptyGeom = true;
+                        poGeom->getEnvelope(&sEnvelope);
+                    }
+                }
+            }
+        }
+
+        for (size_t iField = 0;
+             iField < asFieldColumns.size() && err == SQLITE_OK; ++iField)
+        {
+            const auto &sColumn = asFieldColumns[iField];
+            const auto psChildArray = sColumn.psArray;
+            const size_t iIdx = nParentOffset +
+                                static_cast<size_t>(psChildArray->offset) +
+                                iRow;
+            if (GPKGArrowIsNull(psChildArray, iIdx))
+            {
+                err = sqlite3_bind_null(hStmt, iCol++);
+                continue;
+            }
+            switch (sColumn.chFormat)
+            {
+                case 'b':
+                {
+                    const auto pabyData =
+                        static_cast<const uint8_t *>(psChildArray->buffers[1]);
+                    err = sqlite3_bind_int(
+                        hStmt, iCol++, (pabyData[iIdx / 8] >> (iIdx % 8)) & 1);
+                    break;
+                }
+                case 'c':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<int8_t>(psChildArray, iIdx));
+                    break;
+                case 'C':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<uint8_t>(psChildArray, iIdx));
+                    break;
+                case 's':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<int16_t>(psChildArray, iIdx));
+                    break;
+                case 'S':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<uint16_t>(psChildArray, iIdx));
+                    break;
+                case 'i':
+                    err = sqlite3_bind_int(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<int32_t>(psChildArray, iIdx));
+                    break;
+                case 'I':
+                    err = sqlite3_bind_int64(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<uint32_t>(psChildArray, iIdx));
+                    break;
+                case 'l':
+                    err = sqlite3_bind_int64(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<int64_t>(psChildArray, iIdx));
+                    break;
+                case 'f':
+                    err = sqlite3_bind_double(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<float>(psChildArray, iIdx));
+                    break;
+                case 'g':
+                    err = sqlite3_bind_double(
+                        hStmt, iCol++,
+                        GPKGArrowGetValue<double>(psChildArray, iIdx));
+                    break;
+                case 'u':
+                case 'U':
+                case 'z':
+                case 'Z':
+                {
+                    size_t nLen = 0;
+                    const GByte *pabyData =
+                        (sColumn.chFormat == 'u' || sColumn.chFormat == 'z')
+                            ? GPKGArrowGetBinary<int32_t>(psChildArray, iIdx,
+                                                          nLen)
+                            : GPKGArrowGetBinary<int64_t>(psChildArray, iIdx,
+                                                          nLen);
+                    if (nLen > static_cast<size_t>(INT_MAX))
+                    {
+                        err = SQLITE_TOOBIG;
+                    }
+                    else if (sColumn.chFormat == 'u' ||
+                             sColumn.chFormat == 'U')
+                    {
+                        err = sqlite3_bind_text(
+                            hStmt, iCol++,
+                            reinterpret_cast<const char *>(pabyData),
+                            static_cast<int>(nLen), SQLITE_STATIC);
+                    }
+                    else
+                    {
+                        err = sqlite3_bind_blob(hStmt, iCol++, pabyData,
+                                                static_cast<int>(nLen),
+                                                SQLITE_STATIC);
+                    }
+                    break;
+                }
+                default:
+                    CPLAssert(false);
+                    break;
+            }
+        }
+        if (err != SQLITE_OK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "sqlite3_bind_() failed at row %d: %s",
+                     static_cast<int>(iRow), sqlite3_errmsg(hDB));
+            return Cleanup(false);
+        }
+
+        err = sqlite3_step(hStmt);
+        if (err != SQLITE_OK && err != SQLITE_DONE)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "failed to execute insert : %s", sqlite3_errmsg(hDB));
+            return Cleanup(false);
+        }
+        sqlite3_reset(hStmt);
+        sqlite3_clear_bindings(hStmt);
+
+        const GIntBig nFID = sqlite3_last_insert_rowid(hDB);
+        if (bFIDIsNull)
+        {
+            // Report the FID of the created feature, as the base
+            // implementation does
+            auto psFIDArray =
+                const_cast<struct ArrowArray *>(sFIDColumn.psArray);
+            const size_t iIdx =
+                nParentOffset + static_cast<size_t>(psFIDArray->offset) + iRow;
+            if (sFIDColumn.chFormat == 'l' ||
+                nFID <= std::numeric_limits<int32_t>::max())
+            {
+                auto pabyValidity = static_cast<uint8_t *>(
+                    const_cast<void *>(psFIDArray->buffers[0]));
+                pabyValidity[iIdx / 8] |= static_cast<uint8_t>(1 << (iIdx % 8));
+                --psFIDArray->null_count;
+                if (sFIDColumn.chFormat == 'l')
+                    static_cast<int64_t *>(
+                        const_cast<void *>(psFIDArray->buffers[1]))[iIdx] =
+                        nFID;
+                else
+                    static_cast<int32_t *>(
+                        const_cast<void *>(psFIDArray->buffers[1]))[iIdx] =
+                        static_cast<int32_t>(nFID);
+            }
+        }
+
+        if (bHasNonEmptyGeom)
+        {
+            sBatchExtent.Merge(sEnvelope);
+            if (!UpdateSpatialIndexAfterInsert(nFID, sEnvelope))
+                return Cleanup(false);
+        }
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+        if (m_nTotalFeatureCount >= 0)
+            m_nTotalFeatureCount++;
+#endif
+    }
+
+    if (sBatchExtent.IsInit())
+        UpdateExtent(&sBatchExtent);
+    m_bContentChanged = true;
+
+    return Cleanup(true);
+}
+
 /************************************************************************/
 /*               OGR_GPKG_GeometryExtent3DAggregate()                   */
 /************************************************************************/
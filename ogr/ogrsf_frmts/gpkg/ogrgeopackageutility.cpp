@@ -30,7 +30,9 @@
 #include "ogr_p.h"
 #include "ogr_wkb.h"
 #include "sqlite/ogrsqlitebase.h"
+#include <cmath>
 #include <limits>
+#include <memory>
 
 /* Requirement 20: A GeoPackage SHALL store feature table geometries */
 /* with the basic simple feature geometry types (Geometry, Point, */
@@ -365,6 +367,78 @@ GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
     return pabyWkb;
 }
 
+/** Build a GeoPackage geometry blob from a ISO WKB geometry, without
+ * instantiating a OGRGeometry.
+ *
+ * Only Point, LineString, Polygon, MultiPoint, MultiLineString and
+ * MultiPolygon geometries (with optional Z and/or M) are handled. For other
+ * geometry types, or if the WKB is invalid, false is returned and the caller
+ * should go through GPkgGeometryFromOGR().
+ *
+ * On success, eType is set to the geometry type, sEnvelope to the 2D
+ * envelope of the geometry, and bEmpty to whether it is empty.
+ */
+bool GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBSize, int iSrsId,
+                         std::vector<GByte> &abyGpkg, OGRwkbGeometryType &eType,
+                         OGREnvelope &sEnvelope, bool &bEmpty)
+{
+    bool bNeedSwap = false;
+    uint32_t nType = 0;
+    if (!OGRWKBGetGeomType(pabyWKB, nWKBSize, bNeedSwap, nType))
+        return false;
+    const uint32_t nFlatType = nType % 1000;
+    const uint32_t nDimType = nType / 1000;
+    if (nFlatType < wkbPoint || nFlatType > wkbMultiPolygon || nDimType > 3)
+        return false;
+    const bool bHasZ = nDimType == 1 || nDimType == 3;
+    const bool bHasM = nDimType == 2 || nDimType == 3;
+    eType = OGR_GT_SetModifier(static_cast<OGRwkbGeometryType>(nFlatType),
+                               bHasZ, bHasM);
+
+    OGREnvelope3D sEnvelope3D;
+    if (!OGRWKBGetBoundingBox(pabyWKB, nWKBSize, sEnvelope3D))
+        return false;
+    bEmpty = !sEnvelope3D.IsInit() || std::isnan(sEnvelope3D.MinX);
+    sEnvelope = sEnvelope3D;
+
+    // Same logic as GPkgGeometryFromOGR(): no envelope for points and empty
+    // geometries, 3D envelope for geometries with Z, and 2D otherwise.
+    GByte byFlags = static_cast<GByte>(CPL_IS_LSB);
+    int nEnvelopeValues = 0;
+    if (bEmpty)
+    {
+        byFlags |= (1 << 4);
+    }
+    else if (nFlatType != wkbPoint)
+    {
+        nEnvelopeValues = bHasZ ? 6 : 4;
+        byFlags |= static_cast<GByte>((bHasZ ? 2 : 1) << 1);
+    }
+
+    const size_t nHeaderLen = 8 + nEnvelopeValues * sizeof(double);
+    if (nWKBSize > static_cast<size_t>(std::numeric_limits<int>::max()) -
+                       nHeaderLen)
+    {
+        return false;
+    }
+    abyGpkg.resize(nHeaderLen + nWKBSize);
+    GByte *pabyGpkg = abyGpkg.data();
+    pabyGpkg[0] = 0x47;
+    pabyGpkg[1] = 0x50;
+    pabyGpkg[2] = 0;
+    pabyGpkg[3] = byFlags;
+    memcpy(pabyGpkg + 4, &iSrsId, 4);
+    if (nEnvelopeValues)
+    {
+        const double adfEnvelope[] = {sEnvelope3D.MinX, sEnvelope3D.MaxX,
+                                      sEnvelope3D.MinY, sEnvelope3D.MaxY,
+                                      sEnvelope3D.MinZ, sEnvelope3D.MaxZ};
+        memcpy(pabyGpkg + 8, adfEnvelope, nEnvelopeValues * sizeof(double));
+    }
+    memcpy(pabyGpkg + nHeaderLen, pabyWKB, nWKBSize);
+    return true;
+}
+
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader)
 {
@@ -487,11 +561,17 @@ OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
     return OGRERR_NONE;
 }
 
+// If poGeomToReuse is not null, ownership of it is taken, and it is
+// returned with the new content if the WKB geometry is of the same type,
+// which saves allocations. Otherwise it is destroyed.
 OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
-                               OGRSpatialReference *poSrs)
+                               OGRSpatialReference *poSrs,
+                               OGRGeometry *poGeomToReuse)
 {
     CPLAssert(pabyGpkg != nullptr);
 
+    std::unique_ptr<OGRGeometry> poRecycledGeom(poGeomToReuse);
+
     GPkgHeader oHeader;
 
     /* Read header */
@@ -503,6 +583,22 @@ OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
     const GByte *pabyWkb = pabyGpkg + oHeader.nHeaderLen;
     size_t nWkbLen = nGpkgLen - oHeader.nHeaderLen;
 
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if (poRecycledGeom && nWkbLen >= 5 &&
+        OGRReadWKBGeometryType(pabyWkb, wkbVariantIso, &eGeomType) ==
+            OGRERR_NONE &&
+        eGeomType == poRecycledGeom->getGeometryType())
+    {
+        size_t nBytesConsumed = 0;
+        if (poRecycledGeom->importFromWkb(pabyWkb, nWkbLen, wkbVariantIso,
+                                          nBytesConsumed) == OGRERR_NONE)
+        {
+            poRecycledGeom->assignSpatialReference(poSrs);
+            return poRecycledGeom.release();
+        }
+    }
+    poRecycledGeom.reset();
+
     /* Parse WKB */
     OGRGeometry *poGeom = nullptr;
     err = OGRGeometryFactory::createFromWkb(pabyWkb, poSrs, &poGeom,
@@ -30,6 +30,8 @@
 #include "ogrsf_frmts.h"
 #include <sqlite3.h>
 
+#include <vector>
+
 #ifndef OGR_GEOPACKAGEUTILITY_H_INCLUDED
 #define OGR_GEOPACKAGEUTILITY_H_INCLUDED
 
@@ -61,8 +63,12 @@ OGRwkbGeometryType GPkgGeometryTypeToWKB(const char *pszGpkgType, bool bHasZ,
 GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
                            const OGRGeomCoordinateBinaryPrecision *psPrecision,
                            size_t *pnWkbLen);
+bool GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBSize, int iSrsId,
+                         std::vector<GByte> &abyGpkg, OGRwkbGeometryType &eType,
+                         OGREnvelope &sEnvelope, bool &bEmpty);
 OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
-                               OGRSpatialReference *poSrs);
+                               OGRSpatialReference *poSrs,
+                               OGRGeometry *poGeomToReuse = nullptr);
 
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader);
@@ -121,17 +121,14 @@ static void MakeKMLCoordinate(char *pszTarget, size_t nTargetLen, double x,
         }
     }
 
-    OGRMakeWktCoordinate(pszTarget, x, y, z, b3D ? 3 : 2);
-    while (*pszTarget != '\0')
+    const size_t nLen = OGRMakeWktCoordinateToBuffer(
+        pszTarget, nTargetLen, x, y, z, b3D ? 3 : 2, OGRWktOptions());
+    for (size_t i = 0; i < nLen; ++i)
     {
-        if (*pszTarget == ' ')
-            *pszTarget = ',';
-        pszTarget++;
-        nTargetLen--;
+        if (pszTarget[i] == ' ')
+            pszTarget[i] = ',';
     }
 
-    CPL_IGNORE_RET_VAL(nTargetLen);
-
 #if 0
     if( !b3D )
     {
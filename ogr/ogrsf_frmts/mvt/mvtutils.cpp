@@ -273,3 +273,9 @@ OGRFeature *OGRMVTCreateFeatureFrom(OGRFeature *poSrcFeature,
         poGeom->assignSpatialReference(poSRS);
     return poFeature;
 }
+
+/************************************************************************/
+/*                          ~OGRMVTTileSink()                           */
+/************************************************************************/
+
+OGRMVTTileSink::~OGRMVTTileSink() = default;
@@ -32,6 +32,10 @@
 #include "cpl_json.h"
 #include "ogrsf_frmts.h"
 
+#include <cstdint>
+#include <memory>
+#include <string>
+
 #define MVT_LCO                                                                \
     "<LayerCreationOptionList>"                                                \
     "  <Option name='MINZOOM' type='int' min='0' max='22' "                    \
@@ -72,7 +76,7 @@
     "  <Option name='COMPRESS' scope='vector' type='boolean' description="     \
     "'Whether to GZip-compress tiles' default='YES'/>"                         \
     "  <Option name='TEMPORARY_DB' scope='vector' type='string' description='" \
-    "Filename with path for the temporary database'/>"
+    "Filename with path for the temporary file'/>"
 
 void OGRMVTInitFields(OGRFeatureDefn *poFeatureDefn,
                       const CPLJSONObject &oFields,
@@ -90,10 +94,37 @@ OGRFeature *OGRMVTCreateFeatureFrom(OGRFeature *poSrcFeature,
                                     bool bJsonField,
                                     OGRSpatialReference *poSRS);
 
+/************************************************************************/
+/*                            OGRMVTTileSink                            */
+/************************************************************************/
+
+/** Receives the tiles generated by the MVT writer, instead of them being
+ * written in a directory or a MBTiles file.
+ */
+class OGRMVTTileSink
+{
+  public:
+    virtual ~OGRMVTTileSink();
+
+    /** Returns the key by which tiles are sorted before being passed to
+     * WriteTile(). May be called concurrently from several threads. */
+    virtual uint64_t GetTileKey(int nZ, int nX, int nY) const = 0;
+
+    /** Receives a tile (GZip compressed, unless COMPRESS=NO), by ascending
+     * value of GetTileKey(). */
+    virtual bool WriteTile(int nZ, int nX, int nY,
+                           const std::string &osTileData) = 0;
+
+    /** Called once all tiles have been written, with the metadata items
+     * that would have been written in a metadata.json file. */
+    virtual bool Finish(const CPLJSONObject &oMetadata) = 0;
+};
+
 // #ifdef HAVE_MVT_WRITE_SUPPORT
-GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
-                                       int nYSize, int nBandsIn,
-                                       GDALDataType eDT, char **papszOptions);
+GDALDataset *OGRMVTWriterDatasetCreate(
+    const char *pszFilename, int nXSize, int nYSize, int nBandsIn,
+    GDALDataType eDT, char **papszOptions,
+    std::unique_ptr<OGRMVTTileSink> poTileSink = nullptr);
 // #endif
 
 #endif  // MVTUTILS_H
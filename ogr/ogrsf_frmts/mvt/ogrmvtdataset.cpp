@@ -75,8 +75,11 @@ constexpr int knMAX_FILES_PER_DIR = 10000;
 
 #include "../sqlite/ogrsqlitevfs.h"
 
+#include "cpl_vsi_virtual.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <condition_variable>
+#include <deque>
 #include <mutex>
 
 // Limitations from https://github.com/mapbox/mapbox-geostats
@@ -3266,6 +3269,470 @@ struct OGRMVTFeatureContent
     GIntBig nFID;
 };
 
+/************************************************************************/
+/*                           MVTTempFeature                             */
+/************************************************************************/
+
+// Feature clipped to a tile and encoded as a zlib compressed MVT layer with
+// a single feature, pending the generation of the tile.
+struct MVTTempFeature
+{
+    uint64_t nTileKey = 0;
+    int nZ = 0;
+    int nX = 0;
+    int nY = 0;
+    GIntBig nSerial = 0;
+    double dfAreaOrLength = 0;
+    std::string osLayerName{};
+    std::string osFeature{};
+
+    size_t GetMemoryUsage() const
+    {
+        return sizeof(*this) + osLayerName.capacity() + osFeature.capacity();
+    }
+};
+
+// Order in which features are assembled into tiles: by tile, then by layer
+// name, then by feature serial number.
+static bool MVTTempFeatureLess(const MVTTempFeature &a, const MVTTempFeature &b)
+{
+    if (a.nTileKey != b.nTileKey)
+        return a.nTileKey < b.nTileKey;
+    const int nCmp = a.osLayerName.compare(b.osLayerName);
+    if (nCmp != 0)
+        return nCmp < 0;
+    if (a.nSerial != b.nSerial)
+        return a.nSerial < b.nSerial;
+    // Parts of geometry collections share the same serial number
+    return a.osFeature < b.osFeature;
+}
+
+// Order in which features are retained in a tile that is too big: by
+// decreasing area or length.
+static bool MVTTempFeatureLargerThan(const MVTTempFeature &a,
+                                     const MVTTempFeature &b)
+{
+    if (a.dfAreaOrLength != b.dfAreaOrLength)
+        return a.dfAreaOrLength > b.dfAreaOrLength;
+    return MVTTempFeatureLess(a, b);
+}
+
+/************************************************************************/
+/*                          MVTTempFeatureStore                         */
+/************************************************************************/
+
+// Stores the features clipped to each tile, and returns them sorted with
+// MVTTempFeatureLess(). Features are accumulated in memory, and when the
+// memory limit is reached, sorted and written as a run in a temporary
+// file. Runs are merged when reading back.
+class MVTTempFeatureStore
+{
+    // Header of a feature serialized in the temporary file, followed by
+    // the layer name and the feature blob.
+    struct SerializedHeader
+    {
+        uint64_t nTileKey;
+        int32_t nZ;
+        int32_t nX;
+        int32_t nY;
+        uint32_t nLayerNameSize;
+        int64_t nSerial;
+        double dfAreaOrLength;
+        uint32_t nFeatureSize;
+        uint32_t nPadding;
+    };
+
+    struct Run
+    {
+        vsi_l_offset nOffset = 0;
+        vsi_l_offset nEndOffset = 0;
+        std::string osBuffer{};
+        size_t nBufferPos = 0;
+        MVTTempFeature sCurFeature{};
+    };
+
+    std::string m_osFilename{};
+    VSIVirtualHandleUniquePtr m_poFile{};
+    size_t m_nMaxMemory = 0;
+    size_t m_nMemoryUsage = 0;
+    GIntBig m_nCount = 0;
+    vsi_l_offset m_nFileSize = 0;
+    bool m_bError = false;
+
+    std::vector<MVTTempFeature> m_aoFeatures{};
+    size_t m_iNextFeature = 0;
+
+    std::vector<Run> m_aoRuns{};
+    // Heap of indices in m_aoRuns, whose top is the run with the smallest
+    // current feature.
+    std::vector<size_t> m_anRunHeap{};
+
+    bool FlushRun();
+    bool ReadRun(Run &oRun, void *pDest, size_t nSize);
+    bool ReadRunFeature(Run &oRun);
+    bool RunHeapLess(size_t i, size_t j) const
+    {
+        // std::push_heap() builds a max-heap
+        return MVTTempFeatureLess(m_aoRuns[j].sCurFeature,
+                                  m_aoRuns[i].sCurFeature);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(MVTTempFeatureStore)
+
+  public:
+    MVTTempFeatureStore() = default;
+
+    bool Create(const std::string &osFilename, bool bRemoveFile);
+
+    bool Add(MVTTempFeature &&sFeature);
+    bool FinishWriting();
+    bool GetNext(MVTTempFeature &sFeature);
+
+    void Close();
+
+    GIntBig GetCount() const
+    {
+        return m_nCount;
+    }
+
+    bool HasError() const
+    {
+        return m_bError;
+    }
+
+    const std::string &GetFilename() const
+    {
+        return m_osFilename;
+    }
+};
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+bool MVTTempFeatureStore::Create(const std::string &osFilename,
+                                 bool bRemoveFile)
+{
+    m_osFilename = osFilename;
+    m_poFile.reset(VSIFOpenL(osFilename.c_str(), "wb+"));
+    if (!m_poFile)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 osFilename.c_str());
+        return false;
+    }
+    // For Unix
+    if (bRemoveFile)
+        VSIUnlink(osFilename.c_str());
+
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_MVT_TEMP_MAX_MEMORY", nullptr);
+    double dfMaxMemory;
+    if (pszMaxMemory)
+    {
+        dfMaxMemory = CPLAtof(pszMaxMemory) * 1024 * 1024;
+    }
+    else
+    {
+        const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+        dfMaxMemory = nUsableRAM > 0 ? static_cast<double>(nUsableRAM) / 4
+                                     : 1024.0 * 1024 * 1024;
+    }
+    m_nMaxMemory = static_cast<size_t>(std::min(
+        dfMaxMemory,
+        static_cast<double>(std::numeric_limits<size_t>::max() / 2)));
+    return true;
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+bool MVTTempFeatureStore::Add(MVTTempFeature &&sFeature)
+{
+    if (m_bError)
+        return false;
+    m_nMemoryUsage += sFeature.GetMemoryUsage();
+    try
+    {
+        m_aoFeatures.emplace_back(std::move(sFeature));
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory storing temporary feature: %s", e.what());
+        m_bError = true;
+        return false;
+    }
+    ++m_nCount;
+    if (m_nMemoryUsage > m_nMaxMemory)
+        return FlushRun();
+    return true;
+}
+
+/************************************************************************/
+/*                              FlushRun()                              */
+/************************************************************************/
+
+bool MVTTempFeatureStore::FlushRun()
+{
+    std::sort(m_aoFeatures.begin(), m_aoFeatures.end(), MVTTempFeatureLess);
+
+    Run oRun;
+    oRun.nOffset = m_nFileSize;
+
+    constexpr size_t BUFFER_SIZE = 1024 * 1024;
+    std::string osBuffer;
+    osBuffer.reserve(BUFFER_SIZE);
+    const auto Flush = [this, &osBuffer]()
+    {
+        if (!osBuffer.empty() &&
+            (m_poFile->Seek(m_nFileSize, SEEK_SET) != 0 ||
+             m_poFile->Write(osBuffer.data(), osBuffer.size(), 1) != 1))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write in %s",
+                     m_osFilename.c_str());
+            m_bError = true;
+            return false;
+        }
+        m_nFileSize += osBuffer.size();
+        osBuffer.clear();
+        return true;
+    };
+
+    for (const auto &sFeature : m_aoFeatures)
+    {
+        SerializedHeader sHeader;
+        sHeader.nTileKey = sFeature.nTileKey;
+        sHeader.nZ = sFeature.nZ;
+        sHeader.nX = sFeature.nX;
+        sHeader.nY = sFeature.nY;
+        sHeader.nLayerNameSize =
+            static_cast<uint32_t>(sFeature.osLayerName.size());
+        sHeader.nSerial = sFeature.nSerial;
+        sHeader.dfAreaOrLength = sFeature.dfAreaOrLength;
+        sHeader.nFeatureSize = static_cast<uint32_t>(sFeature.osFeature.size());
+        sHeader.nPadding = 0;
+        osBuffer.append(reinterpret_cast<const char *>(&sHeader),
+                        sizeof(sHeader));
+        osBuffer += sFeature.osLayerName;
+        osBuffer += sFeature.osFeature;
+        if (osBuffer.size() >= BUFFER_SIZE && !Flush())
+            return false;
+    }
+    if (!Flush())
+        return false;
+
+    oRun.nEndOffset = m_nFileSize;
+    m_aoRuns.emplace_back(std::move(oRun));
+
+    CPLDebug("MVT", "Written run of " CPL_FRMT_GUIB " temporary features",
+             static_cast<GUIntBig>(m_aoFeatures.size()));
+    m_aoFeatures.clear();
+    m_aoFeatures.shrink_to_fit();
+    m_nMemoryUsage = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                           FinishWriting()                            */
+/************************************************************************/
+
+bool MVTTempFeatureStore::FinishWriting()
+{
+    if (m_bError)
+        return false;
+    if (m_aoRuns.empty())
+    {
+        // Everything fits in memory
+        std::sort(m_aoFeatures.begin(), m_aoFeatures.end(),
+                  MVTTempFeatureLess);
+        m_iNextFeature = 0;
+        return true;
+    }
+
+    if (!m_aoFeatures.empty() && !FlushRun())
+        return false;
+
+    // Prime the k-way merge of runs
+    const size_t nBufferSize = static_cast<size_t>(std::max<GUIntBig>(
+        64 * 1024, std::min<GUIntBig>(m_nMaxMemory / m_aoRuns.size(),
+                                      4 * 1024 * 1024)));
+    for (size_t i = 0; i < m_aoRuns.size(); ++i)
+    {
+        m_aoRuns[i].osBuffer.reserve(nBufferSize);
+        if (!ReadRunFeature(m_aoRuns[i]))
+            return false;
+        m_anRunHeap.push_back(i);
+        std::push_heap(m_anRunHeap.begin(), m_anRunHeap.end(),
+                       [this](size_t a, size_t b)
+                       { return RunHeapLess(a, b); });
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                              ReadRun()                               */
+/************************************************************************/
+
+bool MVTTempFeatureStore::ReadRun(Run &oRun, void *pDest, size_t nSize)
+{
+    GByte *pabyDest = static_cast<GByte *>(pDest);
+    while (nSize > 0)
+    {
+        if (oRun.nBufferPos == oRun.osBuffer.size())
+        {
+            const size_t nToRead = static_cast<size_t>(std::min<vsi_l_offset>(
+                oRun.osBuffer.capacity(), oRun.nEndOffset - oRun.nOffset));
+            if (nToRead == 0)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Unexpected end of run in %s", m_osFilename.c_str());
+                m_bError = true;
+                return false;
+            }
+            oRun.osBuffer.resize(nToRead);
+            if (m_poFile->Seek(oRun.nOffset, SEEK_SET) != 0 ||
+                m_poFile->Read(&oRun.osBuffer[0], nToRead, 1) != 1)
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot read in %s",
+                         m_osFilename.c_str());
+                m_bError = true;
+                return false;
+            }
+            oRun.nOffset += nToRead;
+            oRun.nBufferPos = 0;
+        }
+        const size_t nChunk =
+            std::min(nSize, oRun.osBuffer.size() - oRun.nBufferPos);
+        memcpy(pabyDest, oRun.osBuffer.data() + oRun.nBufferPos, nChunk);
+        oRun.nBufferPos += nChunk;
+        pabyDest += nChunk;
+        nSize -= nChunk;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           ReadRunFeature()                           */
+/************************************************************************/
+
+bool MVTTempFeatureStore::ReadRunFeature(Run &oRun)
+{
+    SerializedHeader sHeader;
+    if (!ReadRun(oRun, &sHeader, sizeof(sHeader)))
+        return false;
+    auto &sFeature = oRun.sCurFeature;
+    sFeature.nTileKey = sHeader.nTileKey;
+    sFeature.nZ = sHeader.nZ;
+    sFeature.nX = sHeader.nX;
+    sFeature.nY = sHeader.nY;
+    sFeature.nSerial = sHeader.nSerial;
+    sFeature.dfAreaOrLength = sHeader.dfAreaOrLength;
+    sFeature.osLayerName.resize(sHeader.nLayerNameSize);
+    sFeature.osFeature.resize(sHeader.nFeatureSize);
+    return (sHeader.nLayerNameSize == 0 ||
+            ReadRun(oRun, &sFeature.osLayerName[0],
+                    sHeader.nLayerNameSize)) &&
+           (sHeader.nFeatureSize == 0 ||
+            ReadRun(oRun, &sFeature.osFeature[0], sHeader.nFeatureSize));
+}
+
+/************************************************************************/
+/*                              GetNext()                               */
+/************************************************************************/
+
+bool MVTTempFeatureStore::GetNext(MVTTempFeature &sFeature)
+{
+    if (m_bError)
+        return false;
+    if (m_aoRuns.empty())
+    {
+        if (m_iNextFeature == m_aoFeatures.size())
+            return false;
+        sFeature = std::move(m_aoFeatures[m_iNextFeature++]);
+        return true;
+    }
+
+    if (m_anRunHeap.empty())
+        return false;
+    const auto oHeapLess = [this](size_t a, size_t b)
+    { return RunHeapLess(a, b); };
+    std::pop_heap(m_anRunHeap.begin(), m_anRunHeap.end(), oHeapLess);
+    const size_t iRun = m_anRunHeap.back();
+    auto &oRun = m_aoRuns[iRun];
+    std::swap(sFeature, oRun.sCurFeature);
+    if (oRun.nOffset == oRun.nEndOffset &&
+        oRun.nBufferPos == oRun.osBuffer.size())
+    {
+        // Run exhausted
+        m_anRunHeap.pop_back();
+        oRun.osBuffer.clear();
+        oRun.osBuffer.shrink_to_fit();
+    }
+    else
+    {
+        if (!ReadRunFeature(oRun))
+            return false;
+        std::push_heap(m_anRunHeap.begin(), m_anRunHeap.end(), oHeapLess);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+void MVTTempFeatureStore::Close()
+{
+    m_aoFeatures.clear();
+    m_aoRuns.clear();
+    m_anRunHeap.clear();
+    m_poFile.reset();
+}
+
+/************************************************************************/
+/*                          MVTTileLayerStats                           */
+/************************************************************************/
+
+// Properties of the features of a layer in a tile, collected while encoding
+// the tile, and merged into the per-layer properties in tile order.
+struct MVTTileLayerStats
+{
+    std::string osLayerName{};
+    std::map<MVTTileLayerFeature::GeomType, GIntBig> oCountGeomType{};
+    std::vector<std::pair<std::string, MVTTileLayerValue>> aoTags{};
+};
+
+/************************************************************************/
+/*                          MVTTileEncodingTask                         */
+/************************************************************************/
+
+class OGRMVTWriterDataset;
+
+// Features of a tile, and the result of its encoding.
+struct MVTTileEncodingTask
+{
+    const OGRMVTWriterDataset *poDS = nullptr;
+    int nZ = 0;
+    int nX = 0;
+    int nY = 0;
+    // Features of the tile, in MVTTempFeatureLess() order, limited to
+    // MAX_FEATURES.
+    std::vector<MVTTempFeature> aoFeatures{};
+    // When the tile has more than MAX_FEATURES features, heap of the
+    // MAX_FEATURES larger ones according to MVTTempFeatureLargerThan().
+    std::vector<MVTTempFeature> aoLargerFeatures{};
+    GIntBig nFeatureCount = 0;
+
+    std::string osTileData{};
+    std::vector<MVTTileLayerStats> aoLayerStats{};
+    bool bDone = false;
+
+    std::mutex *poMutex = nullptr;
+    std::condition_variable *poCV = nullptr;
+};
+
 class OGRMVTWriterDataset final : public GDALDataset
 {
     class MVTFieldProperties
@@ -3293,12 +3760,10 @@ class OGRMVTWriterDataset final : public GDALDataset
     };
 
     std::vector<std::unique_ptr<OGRMVTWriterLayer>> m_apoLayers;
-    CPLString m_osTempDB;
+    mutable MVTTempFeatureStore m_oTempStore;
     mutable std::mutex m_oDBMutex;
     mutable bool m_bWriteFeatureError = false;
     sqlite3_vfs *m_pMyVFS = nullptr;
-    sqlite3 *m_hDB = nullptr;
-    sqlite3_stmt *m_hInsertStmt = nullptr;
     int m_nMinZoom = 0;
     int m_nMaxZoom = 5;
     double m_dfSimplification = 0.0;
@@ -3311,7 +3776,6 @@ class OGRMVTWriterDataset final : public GDALDataset
     bool m_bGZip = true;
     mutable CPLWorkerThreadPool m_oThreadPool;
     bool m_bThreadPoolOK = false;
-    mutable GIntBig m_nTempTiles = 0;
     CPLString m_osName;
     CPLString m_osDescription;
     CPLString m_osType{"overlay"};
@@ -3328,7 +3792,7 @@ class OGRMVTWriterDataset final : public GDALDataset
     double m_dfTopX = 0.0;
     double m_dfTopY = 0.0;
     double m_dfTileDim0 = 0.0;
-    bool m_bReuseTempFile = false;  // debug only
+    std::unique_ptr<OGRMVTTileSink> m_poTileSink{};
 
     OGRErr PreGenerateForTile(
         int nZ, int nX, int nY, const CPLString &osTargetName,
@@ -3338,6 +3802,9 @@ class OGRMVTWriterDataset final : public GDALDataset
         const OGREnvelope &sEnvelope) const;
 
     static void WriterTaskFunc(void *pParam);
+    static void TileEncodingTaskFunc(void *pParam);
+
+    uint64_t GetTileKey(int nZ, int nX, int nY) const;
 
     OGRErr PreGenerateForTileReal(int nZ, int nX, int nY,
                                   const CPLString &osTargetName,
@@ -3368,22 +3835,26 @@ class OGRMVTWriterDataset final : public GDALDataset
                                       const std::string &osKey,
                                       const MVTTileLayerValue &oValue);
 
-    void EncodeFeature(const void *pabyBlob, int nBlobSize,
+    static void
+    MergeTileLayerStats(int nZ,
+                        const std::vector<MVTTileLayerStats> &aoLayerStats,
+                        std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
+                        std::set<CPLString> &oSetLayers);
+
+    void EncodeFeature(const std::string &osBlob,
                        std::shared_ptr<MVTTileLayer> &poTargetLayer,
                        std::map<CPLString, GUInt32> &oMapKeyToIdx,
                        std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx,
-                       MVTLayerProperties *poLayerProperties, GUInt32 nExtent,
-                       unsigned &nFeaturesInTile);
+                       MVTTileLayerStats *poLayerStats, GUInt32 nExtent,
+                       unsigned &nFeaturesInTile) const;
 
-    std::string
-    EncodeTile(int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer,
-               sqlite3_stmt *hStmtRows,
-               std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
-               std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead);
+    std::string EncodeTile(MVTTileEncodingTask &oTask) const;
 
-    std::string RecodeTileLowerResolution(int nZ, int nX, int nY, int nExtent,
-                                          sqlite3_stmt *hStmtLayer,
-                                          sqlite3_stmt *hStmtRows);
+    std::string RecodeTileLowerResolution(
+        GUInt32 nExtent, const std::vector<MVTTempFeature> &aoFeatures) const;
+
+    bool WriteTile(int nZ, int nX, int nY, const std::string &osTileData,
+                   sqlite3_stmt *hInsertStmt, int &nLastZ, int &nLastX);
 
     bool CreateOutput();
 
@@ -3409,6 +3880,11 @@ class OGRMVTWriterDataset final : public GDALDataset
                                int nBandsIn, GDALDataType eDT,
                                char **papszOptions);
 
+    static GDALDataset *
+    Create(const char *pszFilename, int nXSize, int nYSize, int nBandsIn,
+           GDALDataType eDT, char **papszOptions,
+           std::unique_ptr<OGRMVTTileSink> poTileSink);
+
     OGRSpatialReference *GetSRS()
     {
         return m_poSRS;
@@ -3583,22 +4059,17 @@ CPLErr OGRMVTWriterDataset::Close()
             if (!CreateOutput())
                 eErr = CE_Failure;
         }
-        if (m_hInsertStmt != nullptr)
-        {
-            sqlite3_finalize(m_hInsertStmt);
-        }
-        if (m_hDB)
-        {
-            sqlite3_close(m_hDB);
-        }
+        if (m_bThreadPoolOK)
+            m_oThreadPool.WaitCompletion();
+        m_oTempStore.Close();
         if (m_hDBMBTILES)
         {
             sqlite3_close(m_hDBMBTILES);
         }
-        if (!m_osTempDB.empty() && !m_bReuseTempFile &&
+        if (!m_oTempStore.GetFilename().empty() &&
             CPLTestBool(CPLGetConfigOption("OGR_MVT_REMOVE_TEMP_FILE", "YES")))
         {
-            VSIUnlink(m_osTempDB);
+            VSIUnlink(m_oTempStore.GetFilename().c_str());
         }
 
         if (GDALDataset::Close() != CE_None)
@@ -4262,45 +4733,44 @@ OGRErr OGRMVTWriterDataset::PreGenerateForTileReal(
     size_t nCompressedSize = 0;
     void *pCompressed = CPLZLibDeflate(oBuffer.data(), oBuffer.size(), -1,
                                        nullptr, 0, &nCompressedSize);
-    oBuffer.assign(static_cast<char *>(pCompressed), nCompressedSize);
-    CPLFree(pCompressed);
 
-    const auto InsertIntoDb = [&]()
-    {
-        m_nTempTiles++;
-        sqlite3_bind_int(m_hInsertStmt, 1, nZ);
-        sqlite3_bind_int(m_hInsertStmt, 2, nTileX);
-        sqlite3_bind_int(m_hInsertStmt, 3, nTileY);
-        sqlite3_bind_text(m_hInsertStmt, 4, osTargetName.c_str(), -1,
-                          SQLITE_STATIC);
-        sqlite3_bind_int64(m_hInsertStmt, 5, nSerial);
-        sqlite3_bind_blob(m_hInsertStmt, 6, oBuffer.data(),
-                          static_cast<int>(oBuffer.size()), SQLITE_STATIC);
-        sqlite3_bind_int(m_hInsertStmt, 7,
-                         static_cast<int>(poGPBFeature->getType()));
-        sqlite3_bind_double(m_hInsertStmt, 8, dfAreaOrLength);
-        int rc = sqlite3_step(m_hInsertStmt);
-        sqlite3_reset(m_hInsertStmt);
-        return rc;
-    };
+    MVTTempFeature sTempFeature;
+    sTempFeature.nTileKey = GetTileKey(nZ, nTileX, nTileY);
+    sTempFeature.nZ = nZ;
+    sTempFeature.nX = nTileX;
+    sTempFeature.nY = nTileY;
+    sTempFeature.nSerial = nSerial;
+    sTempFeature.dfAreaOrLength = dfAreaOrLength;
+    sTempFeature.osLayerName = osTargetName;
+    sTempFeature.osFeature.assign(static_cast<char *>(pCompressed),
+                                  nCompressedSize);
+    CPLFree(pCompressed);
 
-    int rc;
+    bool bOK;
     if (m_bThreadPoolOK)
     {
         std::lock_guard<std::mutex> oLock(m_oDBMutex);
-        rc = InsertIntoDb();
+        bOK = m_oTempStore.Add(std::move(sTempFeature));
     }
     else
     {
-        rc = InsertIntoDb();
+        bOK = m_oTempStore.Add(std::move(sTempFeature));
     }
 
-    if (!(rc == SQLITE_OK || rc == SQLITE_DONE))
-    {
-        return OGRERR_FAILURE;
-    }
+    return bOK ? OGRERR_NONE : OGRERR_FAILURE;
+}
 
-    return OGRERR_NONE;
+/************************************************************************/
+/*                             GetTileKey()                             */
+/************************************************************************/
+
+uint64_t OGRMVTWriterDataset::GetTileKey(int nZ, int nX, int nY) const
+{
+    if (m_poTileSink)
+        return m_poTileSink->GetTileKey(nZ, nX, nY);
+    // Tiles are generated by increasing z, x, y
+    return (static_cast<uint64_t>(nZ) << 56) |
+           (static_cast<uint64_t>(nX) << 28) | static_cast<uint64_t>(nY);
 }
 
 /************************************************************************/
@@ -4760,16 +5230,15 @@ GetReducedPrecisionGeometry(MVTTileLayerFeature::GeomType eGeomType,
 /************************************************************************/
 
 void OGRMVTWriterDataset::EncodeFeature(
-    const void *pabyBlob, int nBlobSize,
-    std::shared_ptr<MVTTileLayer> &poTargetLayer,
+    const std::string &osBlob, std::shared_ptr<MVTTileLayer> &poTargetLayer,
     std::map<CPLString, GUInt32> &oMapKeyToIdx,
     std::map<MVTTileLayerValue, GUInt32> &oMapValueToIdx,
-    MVTLayerProperties *poLayerProperties, GUInt32 nExtent,
-    unsigned &nFeaturesInTile)
+    MVTTileLayerStats *poLayerStats, GUInt32 nExtent,
+    unsigned &nFeaturesInTile) const
 {
     size_t nUncompressedSize = 0;
-    void *pCompressed =
-        CPLZLibInflate(pabyBlob, nBlobSize, nullptr, 0, &nUncompressedSize);
+    void *pCompressed = CPLZLibInflate(osBlob.data(), osBlob.size(), nullptr,
+                                       0, &nUncompressedSize);
     GByte *pabyUncompressed = static_cast<GByte *>(pCompressed);
 
     MVTTileLayer oSrcTileLayer;
@@ -4787,9 +5256,9 @@ void OGRMVTWriterDataset::EncodeFeature(
             if (poSrcFeature->hasId())
                 poFeature->setId(poSrcFeature->getId());
             poFeature->setType(poSrcFeature->getType());
-            if (poLayerProperties)
+            if (poLayerStats)
             {
-                poLayerProperties->m_oCountGeomType[poSrcFeature->getType()]++;
+                poLayerStats->oCountGeomType[poSrcFeature->getType()]++;
             }
             bool bOK = true;
             if (nExtent < m_nExtent)
@@ -4863,10 +5332,9 @@ void OGRMVTWriterDataset::EncodeFeature(
                         const auto &osKey = srcKeys[nSrcIdxKey];
                         const auto &oValue = srcValues[nSrcIdxValue];
 
-                        if (poLayerProperties)
+                        if (poLayerStats)
                         {
-                            UpdateLayerProperties(poLayerProperties, osKey,
-                                                  oValue);
+                            poLayerStats->aoTags.emplace_back(osKey, oValue);
                         }
 
                         poFeature->addTag(oMapKeyToIdx[osKey]);
@@ -4889,48 +5357,31 @@ void OGRMVTWriterDataset::EncodeFeature(
 }
 
 /************************************************************************/
-/*                            EncodeTile()                              */
+/*                        MergeTileLayerStats()                         */
 /************************************************************************/
 
-std::string OGRMVTWriterDataset::EncodeTile(
-    int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer, sqlite3_stmt *hStmtRows,
+void OGRMVTWriterDataset::MergeTileLayerStats(
+    int nZ, const std::vector<MVTTileLayerStats> &aoLayerStats,
     std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
-    std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead)
+    std::set<CPLString> &oSetLayers)
 {
-    MVTTile oTargetTile;
-
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
-
-    unsigned nFeaturesInTile = 0;
-    const GIntBig nProgressStep =
-        std::max(static_cast<GIntBig>(1), m_nTempTiles / 10);
-
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    for (const auto &oLayerStats : aoLayerStats)
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
-
-        auto oIterMapLayerProps = oMapLayerProps.find(pszLayerName);
+        const CPLString osLayerName(oLayerStats.osLayerName);
+        auto oIterMapLayerProps = oMapLayerProps.find(osLayerName);
         MVTLayerProperties *poLayerProperties = nullptr;
         if (oIterMapLayerProps == oMapLayerProps.end())
         {
             if (oSetLayers.size() < knMAX_COUNT_LAYERS)
             {
-                oSetLayers.insert(pszLayerName);
+                oSetLayers.insert(osLayerName);
                 if (oMapLayerProps.size() < knMAX_REPORT_LAYERS)
                 {
                     MVTLayerProperties props;
                     props.m_nMinZoom = nZ;
                     props.m_nMaxZoom = nZ;
-                    oMapLayerProps[pszLayerName] = std::move(props);
-                    poLayerProperties = &(oMapLayerProps[pszLayerName]);
+                    oMapLayerProps[osLayerName] = std::move(props);
+                    poLayerProperties = &(oMapLayerProps[osLayerName]);
                 }
             }
         }
@@ -4944,41 +5395,57 @@ std::string OGRMVTWriterDataset::EncodeTile(
                 std::min(nZ, poLayerProperties->m_nMinZoom);
             poLayerProperties->m_nMaxZoom =
                 std::max(nZ, poLayerProperties->m_nMaxZoom);
+            for (const auto &oIter : oLayerStats.oCountGeomType)
+                poLayerProperties->m_oCountGeomType[oIter.first] +=
+                    oIter.second;
+            for (const auto &oTag : oLayerStats.aoTags)
+                UpdateLayerProperties(poLayerProperties, oTag.first,
+                                      oTag.second);
         }
+    }
+}
+
+/************************************************************************/
+/*                            EncodeTile()                              */
+/************************************************************************/
+
+std::string OGRMVTWriterDataset::EncodeTile(MVTTileEncodingTask &oTask) const
+{
+    const int nZ = oTask.nZ;
+    const int nX = oTask.nX;
+    const int nY = oTask.nY;
+    const auto &aoFeatures = oTask.aoFeatures;
+
+    MVTTile oTargetTile;
+
+    unsigned nFeaturesInTile = 0;
+    size_t i = 0;
+    while (nFeaturesInTile < m_nMaxFeatures && i < aoFeatures.size())
+    {
+        const std::string &osLayerName = aoFeatures[i].osLayerName;
+        oTask.aoLayerStats.emplace_back();
+        MVTTileLayerStats &oLayerStats = oTask.aoLayerStats.back();
+        oLayerStats.osLayerName = osLayerName;
 
         std::shared_ptr<MVTTileLayer> poTargetLayer(new MVTTileLayer());
         oTargetTile.addLayer(poTargetLayer);
-        poTargetLayer->setName(pszLayerName);
+        poTargetLayer->setName(osLayerName);
         poTargetLayer->setVersion(m_nMVTVersion);
         poTargetLayer->setExtent(m_nExtent);
 
         std::map<CPLString, GUInt32> oMapKeyToIdx;
         std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
 
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
+        for (; nFeaturesInTile < m_nMaxFeatures && i < aoFeatures.size() &&
+               aoFeatures[i].osLayerName == osLayerName;
+             ++i)
         {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
-
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
-                          oMapValueToIdx, poLayerProperties, m_nExtent,
+            EncodeFeature(aoFeatures[i].osFeature, poTargetLayer, oMapKeyToIdx,
+                          oMapValueToIdx, &oLayerStats, m_nExtent,
                           nFeaturesInTile);
-
-            nTempTilesRead++;
-            if (nTempTilesRead == m_nTempTiles ||
-                (nTempTilesRead % nProgressStep) == 0)
-            {
-                const int nPct =
-                    static_cast<int>((100 * nTempTilesRead) / m_nTempTiles);
-                CPLDebug("MVT", "%d%%...", nPct);
-            }
         }
-        sqlite3_reset(hStmtRows);
     }
 
-    sqlite3_reset(hStmtLayer);
-
     std::string oTileBuffer(oTargetTile.write());
     size_t nSizeBefore = oTileBuffer.size();
     if (m_bGZip)
@@ -4998,8 +5465,7 @@ std::string OGRMVTWriterDataset::EncodeTile(
     {
         nExtent /= 2;
         nSizeBefore = oTileBuffer.size();
-        oTileBuffer = RecodeTileLowerResolution(nZ, nX, nY, nExtent, hStmtLayer,
-                                                hStmtRows);
+        oTileBuffer = RecodeTileLowerResolution(nExtent, aoFeatures);
         bTooBigTile = oTileBuffer.size() > m_nMaxTileSize;
         CPLDebug("MVT",
                  "Recoding tile %d/%d/%d with extent = %u. "
@@ -5025,19 +5491,21 @@ std::string OGRMVTWriterDataset::EncodeTile(
 
         oTargetTile.clear();
 
+        // Select the features with the largest area or length
         const unsigned nTotalFeaturesInTile =
             std::min(m_nMaxFeatures, nFeaturesInTile);
-        char *pszSQL =
-            sqlite3_mprintf("SELECT layer, feature FROM temp "
-                            "WHERE z = %d AND x = %d AND y = %d ORDER BY "
-                            "area_or_length DESC LIMIT %d",
-                            nZ, nX, nY, nTotalFeaturesInTile);
-        sqlite3_stmt *hTmpStmt = nullptr;
-        CPL_IGNORE_RET_VAL(
-            sqlite3_prepare_v2(m_hDB, pszSQL, -1, &hTmpStmt, nullptr));
-        sqlite3_free(pszSQL);
-        if (!hTmpStmt)
-            return std::string();
+        const auto &aoCandidateFeatures = oTask.aoLargerFeatures.empty()
+                                              ? aoFeatures
+                                              : oTask.aoLargerFeatures;
+        std::vector<const MVTTempFeature *> apoSelectedFeatures;
+        apoSelectedFeatures.reserve(aoCandidateFeatures.size());
+        for (const auto &sFeature : aoCandidateFeatures)
+            apoSelectedFeatures.push_back(&sFeature);
+        std::sort(apoSelectedFeatures.begin(), apoSelectedFeatures.end(),
+                  [](const MVTTempFeature *a, const MVTTempFeature *b)
+                  { return MVTTempFeatureLargerThan(*a, *b); });
+        if (apoSelectedFeatures.size() > nTotalFeaturesInTile)
+            apoSelectedFeatures.resize(nTotalFeaturesInTile);
 
         class TargetTileLayerProps
         {
@@ -5051,17 +5519,14 @@ std::string OGRMVTWriterDataset::EncodeTile(
 
         nFeaturesInTile = 0;
         const unsigned nCheckStep = std::max(1U, nTotalFeaturesInTile / 100);
-        while (sqlite3_step(hTmpStmt) == SQLITE_ROW)
+        for (const MVTTempFeature *psFeature : apoSelectedFeatures)
         {
-            const char *pszLayerName = reinterpret_cast<const char *>(
-                sqlite3_column_text(hTmpStmt, 0));
-            int nBlobSize = sqlite3_column_bytes(hTmpStmt, 1);
-            const void *pabyBlob = sqlite3_column_blob(hTmpStmt, 1);
+            const std::string &osLayerName = psFeature->osLayerName;
 
             std::shared_ptr<MVTTileLayer> poTargetLayer;
             std::map<CPLString, GUInt32> *poMapKeyToIdx;
             std::map<MVTTileLayerValue, GUInt32> *poMapValueToIdx;
-            auto oIter = oMapLayerNameToTargetLayer.find(pszLayerName);
+            auto oIter = oMapLayerNameToTargetLayer.find(osLayerName);
             if (oIter == oMapLayerNameToTargetLayer.end())
             {
                 poTargetLayer =
@@ -5069,14 +5534,14 @@ std::string OGRMVTWriterDataset::EncodeTile(
                 TargetTileLayerProps props;
                 props.m_poLayer = poTargetLayer;
                 oTargetTile.addLayer(poTargetLayer);
-                poTargetLayer->setName(pszLayerName);
+                poTargetLayer->setName(osLayerName);
                 poTargetLayer->setVersion(m_nMVTVersion);
                 poTargetLayer->setExtent(nExtent);
-                oMapLayerNameToTargetLayer[pszLayerName] = std::move(props);
+                oMapLayerNameToTargetLayer[osLayerName] = std::move(props);
                 poMapKeyToIdx =
-                    &oMapLayerNameToTargetLayer[pszLayerName].m_oMapKeyToIdx;
+                    &oMapLayerNameToTargetLayer[osLayerName].m_oMapKeyToIdx;
                 poMapValueToIdx =
-                    &oMapLayerNameToTargetLayer[pszLayerName].m_oMapValueToIdx;
+                    &oMapLayerNameToTargetLayer[osLayerName].m_oMapValueToIdx;
             }
             else
             {
@@ -5085,7 +5550,7 @@ std::string OGRMVTWriterDataset::EncodeTile(
                 poMapValueToIdx = &oIter->second.m_oMapValueToIdx;
             }
 
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, *poMapKeyToIdx,
+            EncodeFeature(psFeature->osFeature, poTargetLayer, *poMapKeyToIdx,
                           *poMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
 
             if (nFeaturesInTile == nTotalFeaturesInTile ||
@@ -5107,8 +5572,6 @@ std::string OGRMVTWriterDataset::EncodeTile(
             CPLDebug("MVT", "For tile %d/%d/%d, final tile size is %u", nZ, nX,
                      nY, static_cast<unsigned>(oTileBuffer.size()));
         }
-
-        sqlite3_finalize(hTmpStmt);
     }
 
     return oTileBuffer;
@@ -5119,49 +5582,34 @@ std::string OGRMVTWriterDataset::EncodeTile(
 /************************************************************************/
 
 std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
-    int nZ, int nX, int nY, int nExtent, sqlite3_stmt *hStmtLayer,
-    sqlite3_stmt *hStmtRows)
+    GUInt32 nExtent, const std::vector<MVTTempFeature> &aoFeatures) const
 {
     MVTTile oTargetTile;
 
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
-
     unsigned nFeaturesInTile = 0;
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    size_t i = 0;
+    while (nFeaturesInTile < m_nMaxFeatures && i < aoFeatures.size())
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
+        const std::string &osLayerName = aoFeatures[i].osLayerName;
 
         std::shared_ptr<MVTTileLayer> poTargetLayer(new MVTTileLayer());
         oTargetTile.addLayer(poTargetLayer);
-        poTargetLayer->setName(pszLayerName);
+        poTargetLayer->setName(osLayerName);
         poTargetLayer->setVersion(m_nMVTVersion);
         poTargetLayer->setExtent(nExtent);
 
         std::map<CPLString, GUInt32> oMapKeyToIdx;
         std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
 
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
+        for (; nFeaturesInTile < m_nMaxFeatures && i < aoFeatures.size() &&
+               aoFeatures[i].osLayerName == osLayerName;
+             ++i)
         {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
-
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
+            EncodeFeature(aoFeatures[i].osFeature, poTargetLayer, oMapKeyToIdx,
                           oMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
         }
-        sqlite3_reset(hStmtRows);
     }
 
-    sqlite3_reset(hStmtLayer);
-
     std::string oTileBuffer(oTargetTile.write());
     if (m_bGZip)
         GZIPCompress(oTileBuffer);
@@ -5169,6 +5617,92 @@ std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
     return oTileBuffer;
 }
 
+/************************************************************************/
+/*                        TileEncodingTaskFunc()                        */
+/************************************************************************/
+
+void OGRMVTWriterDataset::TileEncodingTaskFunc(void *pParam)
+{
+    MVTTileEncodingTask *poTask = static_cast<MVTTileEncodingTask *>(pParam);
+    poTask->osTileData = poTask->poDS->EncodeTile(*poTask);
+    // Release memory early
+    poTask->aoFeatures.clear();
+    poTask->aoFeatures.shrink_to_fit();
+    poTask->aoLargerFeatures.clear();
+    poTask->aoLargerFeatures.shrink_to_fit();
+    {
+        std::lock_guard<std::mutex> oLock(*(poTask->poMutex));
+        poTask->bDone = true;
+    }
+    poTask->poCV->notify_all();
+}
+
+/************************************************************************/
+/*                             WriteTile()                              */
+/************************************************************************/
+
+bool OGRMVTWriterDataset::WriteTile(int nZ, int nX, int nY,
+                                    const std::string &osTileData,
+                                    sqlite3_stmt *hInsertStmt, int &nLastZ,
+                                    int &nLastX)
+{
+    bool bRet;
+    if (m_poTileSink)
+    {
+        bRet = m_poTileSink->WriteTile(nZ, nX, nY, osTileData);
+    }
+    else if (hInsertStmt)
+    {
+        sqlite3_bind_int(hInsertStmt, 1, nZ);
+        sqlite3_bind_int(hInsertStmt, 2, nX);
+        sqlite3_bind_int(hInsertStmt, 3, (1 << nZ) - 1 - nY);
+        sqlite3_bind_blob(hInsertStmt, 4, osTileData.data(),
+                          static_cast<int>(osTileData.size()), SQLITE_STATIC);
+        const int rc = sqlite3_step(hInsertStmt);
+        bRet = (rc == SQLITE_OK || rc == SQLITE_DONE);
+        sqlite3_reset(hInsertStmt);
+    }
+    else
+    {
+        CPLString osZDirname(CPLFormFilename(
+            GetDescription(), CPLSPrintf("%d", nZ), nullptr));
+        CPLString osXDirname(
+            CPLFormFilename(osZDirname, CPLSPrintf("%d", nX), nullptr));
+        if (nZ != nLastZ)
+        {
+            VSIMkdir(osZDirname, 0755);
+            nLastZ = nZ;
+            nLastX = -1;
+        }
+        if (nX != nLastX)
+        {
+            VSIMkdir(osXDirname, 0755);
+            nLastX = nX;
+        }
+        CPLString osTileFilename(CPLFormFilename(
+            osXDirname, CPLSPrintf("%d", nY), m_osExtension.c_str()));
+        VSILFILE *fpOut = VSIFOpenL(osTileFilename, "wb");
+        if (fpOut)
+        {
+            const size_t nRet =
+                VSIFWriteL(osTileData.data(), 1, osTileData.size(), fpOut);
+            bRet = (nRet == osTileData.size());
+            VSIFCloseL(fpOut);
+        }
+        else
+        {
+            bRet = false;
+        }
+    }
+
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Error while writing tile %d/%d/%d", nZ, nX, nY);
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                            CreateOutput()                            */
 /************************************************************************/
@@ -5186,43 +5720,10 @@ bool OGRMVTWriterDataset::CreateOutput()
         return GenerateMetadata(0, oMapLayerProps);
     }
 
-    CPLDebug("MVT", "Building output file from temporary database...");
+    CPLDebug("MVT", "Building output file from temporary file...");
 
-    sqlite3_stmt *hStmtZXY = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        m_hDB, "SELECT DISTINCT z, x, y FROM temp ORDER BY z, x, y", -1,
-        &hStmtZXY, nullptr));
-    if (hStmtZXY == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
+    if (!m_oTempStore.FinishWriting())
         return false;
-    }
-
-    sqlite3_stmt *hStmtLayer = nullptr;
-    CPL_IGNORE_RET_VAL(
-        sqlite3_prepare_v2(m_hDB,
-                           "SELECT DISTINCT layer FROM temp "
-                           "WHERE z = ? AND x = ? AND y = ? ORDER BY layer",
-                           -1, &hStmtLayer, nullptr));
-    if (hStmtLayer == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        sqlite3_finalize(hStmtZXY);
-        return false;
-    }
-    sqlite3_stmt *hStmtRows = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        m_hDB,
-        "SELECT feature FROM temp "
-        "WHERE z = ? AND x = ? AND y = ? AND layer = ? ORDER BY idx",
-        -1, &hStmtRows, nullptr));
-    if (hStmtRows == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        sqlite3_finalize(hStmtZXY);
-        sqlite3_finalize(hStmtLayer);
-        return false;
-    }
 
     sqlite3_stmt *hInsertStmt = nullptr;
     if (m_hDBMBTILES)
@@ -5235,87 +5736,127 @@ bool OGRMVTWriterDataset::CreateOutput()
         if (hInsertStmt == nullptr)
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-            sqlite3_finalize(hStmtZXY);
-            sqlite3_finalize(hStmtLayer);
-            sqlite3_finalize(hStmtRows);
             return false;
         }
     }
 
-    int nLastZ = -1;
-    int nLastX = -1;
-    bool bRet = true;
-    GIntBig nTempTilesRead = 0;
+    MVTTempFeature sNextFeature;
+    bool bHasNextFeature = m_oTempStore.GetNext(sNextFeature);
 
-    while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    // Collect the features of the next tile from the sorted temporary
+    // features.
+    const auto ReadNextTile =
+        [this, &sNextFeature, &bHasNextFeature](MVTTileEncodingTask &oTask)
     {
-        int nZ = sqlite3_column_int(hStmtZXY, 0);
-        int nX = sqlite3_column_int(hStmtZXY, 1);
-        int nY = sqlite3_column_int(hStmtZXY, 2);
-
-        std::string oTileBuffer(EncodeTile(nZ, nX, nY, hStmtLayer, hStmtRows,
-                                           oMapLayerProps, oSetLayers,
-                                           nTempTilesRead));
-
-        if (oTileBuffer.empty())
-        {
-            bRet = false;
-        }
-        else if (hInsertStmt)
-        {
-            sqlite3_bind_int(hInsertStmt, 1, nZ);
-            sqlite3_bind_int(hInsertStmt, 2, nX);
-            sqlite3_bind_int(hInsertStmt, 3, (1 << nZ) - 1 - nY);
-            sqlite3_bind_blob(hInsertStmt, 4, oTileBuffer.data(),
-                              static_cast<int>(oTileBuffer.size()),
-                              SQLITE_STATIC);
-            const int rc = sqlite3_step(hInsertStmt);
-            bRet = (rc == SQLITE_OK || rc == SQLITE_DONE);
-            sqlite3_reset(hInsertStmt);
-        }
-        else
+        oTask.nZ = sNextFeature.nZ;
+        oTask.nX = sNextFeature.nX;
+        oTask.nY = sNextFeature.nY;
+        const uint64_t nTileKey = sNextFeature.nTileKey;
+        auto &aoLargerFeatures = oTask.aoLargerFeatures;
+        do
         {
-            CPLString osZDirname(CPLFormFilename(
-                GetDescription(), CPLSPrintf("%d", nZ), nullptr));
-            CPLString osXDirname(
-                CPLFormFilename(osZDirname, CPLSPrintf("%d", nX), nullptr));
-            if (nZ != nLastZ)
-            {
-                VSIMkdir(osZDirname, 0755);
-                nLastZ = nZ;
-                nLastX = -1;
-            }
-            if (nX != nLastX)
+            ++oTask.nFeatureCount;
+            if (oTask.aoFeatures.size() < m_nMaxFeatures)
             {
-                VSIMkdir(osXDirname, 0755);
-                nLastX = nX;
+                oTask.aoFeatures.emplace_back(std::move(sNextFeature));
             }
-            CPLString osTileFilename(CPLFormFilename(
-                osXDirname, CPLSPrintf("%d", nY), m_osExtension.c_str()));
-            VSILFILE *fpOut = VSIFOpenL(osTileFilename, "wb");
-            if (fpOut)
+            else
             {
-                const size_t nRet = VSIFWriteL(oTileBuffer.data(), 1,
-                                               oTileBuffer.size(), fpOut);
-                bRet = (nRet == oTileBuffer.size());
-                VSIFCloseL(fpOut);
+                // Beyond MAX_FEATURES, only keep track of the larger
+                // features, which are the ones retained in that situation.
+                if (aoLargerFeatures.empty())
+                {
+                    aoLargerFeatures = oTask.aoFeatures;
+                    std::make_heap(aoLargerFeatures.begin(),
+                                   aoLargerFeatures.end(),
+                                   MVTTempFeatureLargerThan);
+                }
+                if (MVTTempFeatureLargerThan(sNextFeature,
+                                             aoLargerFeatures.front()))
+                {
+                    std::pop_heap(aoLargerFeatures.begin(),
+                                  aoLargerFeatures.end(),
+                                  MVTTempFeatureLargerThan);
+                    aoLargerFeatures.back() = std::move(sNextFeature);
+                    std::push_heap(aoLargerFeatures.begin(),
+                                   aoLargerFeatures.end(),
+                                   MVTTempFeatureLargerThan);
+                }
             }
-            else
+            bHasNextFeature = m_oTempStore.GetNext(sNextFeature);
+        } while (bHasNextFeature && sNextFeature.nTileKey == nTileKey);
+    };
+
+    // Tiles are encoded by the worker threads, and written in order by this
+    // thread.
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::deque<std::unique_ptr<MVTTileEncodingTask>> apoTasks;
+    const size_t nMaxTasks =
+        m_bThreadPoolOK
+            ? static_cast<size_t>(2 * m_oThreadPool.GetThreadCount())
+            : 1;
+
+    int nLastZ = -1;
+    int nLastX = -1;
+    bool bRet = true;
+    const GIntBig nTempTiles = m_oTempStore.GetCount();
+    const GIntBig nProgressStep =
+        std::max(static_cast<GIntBig>(1), nTempTiles / 10);
+    GIntBig nTempTilesRead = 0;
+    GIntBig nNextProgress = nProgressStep;
+
+    while (bRet)
+    {
+        while (bHasNextFeature && apoTasks.size() < nMaxTasks)
+        {
+            auto poTask = std::make_unique<MVTTileEncodingTask>();
+            poTask->poDS = this;
+            poTask->poMutex = &oMutex;
+            poTask->poCV = &oCV;
+            ReadNextTile(*poTask);
+            MVTTileEncodingTask *psTask = poTask.get();
+            apoTasks.push_back(std::move(poTask));
+            if (!m_bThreadPoolOK ||
+                !m_oThreadPool.SubmitJob(TileEncodingTaskFunc, psTask))
             {
-                bRet = false;
+                TileEncodingTaskFunc(psTask);
             }
         }
+        if (apoTasks.empty())
+            break;
 
-        if (!bRet)
+        auto poTask = std::move(apoTasks.front());
+        apoTasks.pop_front();
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Error while writing tile %d/%d/%d", nZ, nX, nY);
-            break;
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [&poTask] { return poTask->bDone; });
         }
+
+        MergeTileLayerStats(poTask->nZ, poTask->aoLayerStats, oMapLayerProps,
+                            oSetLayers);
+
+        nTempTilesRead += poTask->nFeatureCount;
+        if (nTempTilesRead >= nNextProgress)
+        {
+            const int nPct =
+                static_cast<int>((100 * nTempTilesRead) / nTempTiles);
+            CPLDebug("MVT", "%d%%...", nPct);
+            nNextProgress =
+                (nTempTilesRead / nProgressStep + 1) * nProgressStep;
+        }
+
+        bRet = WriteTile(poTask->nZ, poTask->nX, poTask->nY,
+                         poTask->osTileData, hInsertStmt, nLastZ, nLastX);
     }
-    sqlite3_finalize(hStmtZXY);
-    sqlite3_finalize(hStmtLayer);
-    sqlite3_finalize(hStmtRows);
+
+    // Pending tasks reference oMutex and oCV
+    if (m_bThreadPoolOK)
+        m_oThreadPool.WaitCompletion();
+
+    if (m_oTempStore.HasError())
+        bRet = false;
+
     if (hInsertStmt)
         sqlite3_finalize(hInsertStmt);
 
@@ -5683,6 +6224,11 @@ bool OGRMVTWriterDataset::GenerateMetadata(
         return true;
     }
 
+    if (m_poTileSink)
+    {
+        return m_poTileSink->Finish(oRoot);
+    }
+
     return oDoc.Save(
         CPLFormFilename(GetDescription(), "metadata.json", nullptr));
 }
@@ -5720,105 +6266,102 @@ OGRErr OGRMVTWriterDataset::WriteFeature(OGRMVTWriterLayer *poLayer,
 
     if (!m_oEnvelope.IsInit())
     {
-        CPLDebug("MVT", "Creating temporary database...");
+        CPLDebug("MVT", "Creating temporary file...");
     }
 
     m_oEnvelope.Merge(sExtent);
 
-    if (!m_bReuseTempFile)
-    {
-        auto poFeatureContent =
-            std::shared_ptr<OGRMVTFeatureContent>(new OGRMVTFeatureContent());
-        auto poSharedGeom = std::shared_ptr<OGRGeometry>(poGeom->clone());
+    auto poFeatureContent =
+        std::shared_ptr<OGRMVTFeatureContent>(new OGRMVTFeatureContent());
+    auto poSharedGeom = std::shared_ptr<OGRGeometry>(poGeom->clone());
 
-        poFeatureContent->nFID = poFeature->GetFID();
+    poFeatureContent->nFID = poFeature->GetFID();
 
-        const OGRFeatureDefn *poFDefn = poFeature->GetDefnRef();
-        for (int i = 0; i < poFeature->GetFieldCount(); i++)
+    const OGRFeatureDefn *poFDefn = poFeature->GetDefnRef();
+    for (int i = 0; i < poFeature->GetFieldCount(); i++)
+    {
+        if (poFeature->IsFieldSetAndNotNull(i))
         {
-            if (poFeature->IsFieldSetAndNotNull(i))
+            MVTTileLayerValue oValue;
+            const OGRFieldDefn *poFieldDefn = poFDefn->GetFieldDefn(i);
+            OGRFieldType eFieldType = poFieldDefn->GetType();
+            if (eFieldType == OFTInteger || eFieldType == OFTInteger64)
             {
-                MVTTileLayerValue oValue;
-                const OGRFieldDefn *poFieldDefn = poFDefn->GetFieldDefn(i);
-                OGRFieldType eFieldType = poFieldDefn->GetType();
-                if (eFieldType == OFTInteger || eFieldType == OFTInteger64)
+                if (poFieldDefn->GetSubType() == OFSTBoolean)
                 {
-                    if (poFieldDefn->GetSubType() == OFSTBoolean)
-                    {
-                        oValue.setBoolValue(poFeature->GetFieldAsInteger(i) !=
-                                            0);
-                    }
-                    else
-                    {
-                        oValue.setValue(poFeature->GetFieldAsInteger64(i));
-                    }
+                    oValue.setBoolValue(poFeature->GetFieldAsInteger(i) !=
+                                        0);
                 }
-                else if (eFieldType == OFTReal)
+                else
                 {
-                    oValue.setValue(poFeature->GetFieldAsDouble(i));
+                    oValue.setValue(poFeature->GetFieldAsInteger64(i));
                 }
-                else if (eFieldType == OFTDate || eFieldType == OFTDateTime)
+            }
+            else if (eFieldType == OFTReal)
+            {
+                oValue.setValue(poFeature->GetFieldAsDouble(i));
+            }
+            else if (eFieldType == OFTDate || eFieldType == OFTDateTime)
+            {
+                int nYear, nMonth, nDay, nHour, nMin, nTZ;
+                float fSec;
+                poFeature->GetFieldAsDateTime(i, &nYear, &nMonth, &nDay,
+                                              &nHour, &nMin, &fSec, &nTZ);
+                CPLString osFormatted;
+                if (eFieldType == OFTDate)
                 {
-                    int nYear, nMonth, nDay, nHour, nMin, nTZ;
-                    float fSec;
-                    poFeature->GetFieldAsDateTime(i, &nYear, &nMonth, &nDay,
-                                                  &nHour, &nMin, &fSec, &nTZ);
-                    CPLString osFormatted;
-                    if (eFieldType == OFTDate)
-                    {
-                        osFormatted.Printf("%04d-%02d-%02d", nYear, nMonth,
-                                           nDay);
-                    }
-                    else
-                    {
-                        char *pszFormatted =
-                            OGRGetXMLDateTime(poFeature->GetRawFieldRef(i));
-                        osFormatted = pszFormatted;
-                        CPLFree(pszFormatted);
-                    }
-                    oValue.setStringValue(osFormatted);
+                    osFormatted.Printf("%04d-%02d-%02d", nYear, nMonth,
+                                       nDay);
                 }
                 else
                 {
-                    oValue.setStringValue(
-                        std::string(poFeature->GetFieldAsString(i)));
+                    char *pszFormatted =
+                        OGRGetXMLDateTime(poFeature->GetRawFieldRef(i));
+                    osFormatted = pszFormatted;
+                    CPLFree(pszFormatted);
                 }
-
-                poFeatureContent->oValues.emplace_back(
-                    std::pair<std::string, MVTTileLayerValue>(
-                        poFieldDefn->GetNameRef(), oValue));
+                oValue.setStringValue(osFormatted);
             }
+            else
+            {
+                oValue.setStringValue(
+                    std::string(poFeature->GetFieldAsString(i)));
+            }
+
+            poFeatureContent->oValues.emplace_back(
+                std::pair<std::string, MVTTileLayerValue>(
+                    poFieldDefn->GetNameRef(), oValue));
         }
+    }
 
-        for (int nZ = poLayer->m_nMinZoom; nZ <= poLayer->m_nMaxZoom; nZ++)
+    for (int nZ = poLayer->m_nMinZoom; nZ <= poLayer->m_nMaxZoom; nZ++)
+    {
+        double dfTileDim = m_dfTileDim0 / (1 << nZ);
+        double dfBuffer = dfTileDim * m_nBuffer / m_nExtent;
+        const int nTileMinX = std::max(
+            0, static_cast<int>((sExtent.MinX - m_dfTopX - dfBuffer) /
+                                dfTileDim));
+        const int nTileMinY = std::max(
+            0, static_cast<int>((m_dfTopY - sExtent.MaxY - dfBuffer) /
+                                dfTileDim));
+        const int nTileMaxX =
+            std::min(static_cast<int>((sExtent.MaxX - m_dfTopX + dfBuffer) /
+                                      dfTileDim),
+                     (1 << nZ) - 1);
+        const int nTileMaxY =
+            std::min(static_cast<int>((m_dfTopY - sExtent.MinY + dfBuffer) /
+                                      dfTileDim),
+                     (1 << nZ) - 1);
+        for (int iX = nTileMinX; iX <= nTileMaxX; iX++)
         {
-            double dfTileDim = m_dfTileDim0 / (1 << nZ);
-            double dfBuffer = dfTileDim * m_nBuffer / m_nExtent;
-            const int nTileMinX = std::max(
-                0, static_cast<int>((sExtent.MinX - m_dfTopX - dfBuffer) /
-                                    dfTileDim));
-            const int nTileMinY = std::max(
-                0, static_cast<int>((m_dfTopY - sExtent.MaxY - dfBuffer) /
-                                    dfTileDim));
-            const int nTileMaxX =
-                std::min(static_cast<int>((sExtent.MaxX - m_dfTopX + dfBuffer) /
-                                          dfTileDim),
-                         (1 << nZ) - 1);
-            const int nTileMaxY =
-                std::min(static_cast<int>((m_dfTopY - sExtent.MinY + dfBuffer) /
-                                          dfTileDim),
-                         (1 << nZ) - 1);
-            for (int iX = nTileMinX; iX <= nTileMaxX; iX++)
+            for (int iY = nTileMinY; iY <= nTileMaxY; iY++)
             {
-                for (int iY = nTileMinY; iY <= nTileMaxY; iY++)
+                if (PreGenerateForTile(
+                        nZ, iX, iY, poLayer->m_osTargetName,
+                        (nZ == poLayer->m_nMaxZoom), poFeatureContent,
+                        nSerial, poSharedGeom, sExtent) != OGRERR_NONE)
                 {
-                    if (PreGenerateForTile(
-                            nZ, iX, iY, poLayer->m_osTargetName,
-                            (nZ == poLayer->m_nMaxZoom), poFeatureContent,
-                            nSerial, poSharedGeom, sExtent) != OGRERR_NONE)
-                    {
-                        return OGRERR_FAILURE;
-                    }
+                    return OGRERR_FAILURE;
                 }
             }
         }
@@ -5943,6 +6486,16 @@ OGRMVTWriterDataset::ICreateLayer(const char *pszLayerName,
 GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
                                          int nYSize, int nBandsIn,
                                          GDALDataType eDT, char **papszOptions)
+{
+    return Create(pszFilename, nXSize, nYSize, nBandsIn, eDT, papszOptions,
+                  nullptr);
+}
+
+GDALDataset *
+OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize, int nYSize,
+                            int nBandsIn, GDALDataType eDT,
+                            char **papszOptions,
+                            std::unique_ptr<OGRMVTTileSink> poTileSink)
 {
     if (nXSize != 0 || nYSize != 0 || nBandsIn != 0 || eDT != GDT_Unknown)
     {
@@ -5957,13 +6510,14 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     {
         pszFormat = "MBTILES";
     }
-    const bool bMBTILES = pszFormat != nullptr && EQUAL(pszFormat, "MBTILES");
-
-    // For debug only
-    bool bReuseTempFile =
-        CPLTestBool(CPLGetConfigOption("OGR_MVT_REUSE_TEMP_FILE", "NO"));
+    const bool bMBTILES = poTileSink == nullptr && pszFormat != nullptr &&
+                          EQUAL(pszFormat, "MBTILES");
 
-    if (bMBTILES)
+    if (poTileSink)
+    {
+        // Tiles are directly forwarded to the sink
+    }
+    else if (bMBTILES)
     {
         if (!bMBTILESExt)
         {
@@ -5994,73 +6548,31 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     OGRMVTWriterDataset *poDS = new OGRMVTWriterDataset();
     poDS->m_pMyVFS = OGRSQLiteCreateVFS(nullptr, poDS);
     sqlite3_vfs_register(poDS->m_pMyVFS, 0);
+    poDS->m_poTileSink = std::move(poTileSink);
 
-    CPLString osTempDBDefault = CPLString(pszFilename) + ".temp.db";
-    if (STARTS_WITH(osTempDBDefault, "/vsizip/"))
-    {
-        osTempDBDefault =
-            CPLString(pszFilename + strlen("/vsizip/")) + ".temp.db";
-    }
-    CPLString osTempDB = CSLFetchNameValueDef(papszOptions, "TEMPORARY_DB",
-                                              osTempDBDefault.c_str());
-    if (!bReuseTempFile)
-        VSIUnlink(osTempDB);
-
-    sqlite3 *hDB = nullptr;
-    if (sqlite3_open_v2(osTempDB, &hDB,
-                        SQLITE_OPEN_READWRITE |
-                            (bReuseTempFile ? 0 : SQLITE_OPEN_CREATE) |
-                            SQLITE_OPEN_NOMUTEX,
-                        poDS->m_pMyVFS->zName) != SQLITE_OK ||
-        hDB == nullptr)
+    CPLString osTempFileDefault = CPLString(pszFilename) + ".temp";
+    if (STARTS_WITH(osTempFileDefault, "/vsizip/"))
     {
-        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s", osTempDB.c_str());
-        delete poDS;
-        sqlite3_close(hDB);
-        return nullptr;
+        osTempFileDefault =
+            CPLString(pszFilename + strlen("/vsizip/")) + ".temp";
     }
-    poDS->m_osTempDB = osTempDB;
-    poDS->m_hDB = hDB;
-    poDS->m_bReuseTempFile = bReuseTempFile;
-
-    // For Unix
-    if (!poDS->m_bReuseTempFile &&
-        CPLTestBool(CPLGetConfigOption("OGR_MVT_REMOVE_TEMP_FILE", "YES")))
+    else if (poDS->m_poTileSink && !VSIIsLocal(pszFilename))
     {
-        VSIUnlink(osTempDB);
+        // The temporary file is randomly accessed, which is not supported
+        // by streaming file systems.
+        osTempFileDefault = CPLGenerateTempFilename("mvt_temp");
     }
+    const CPLString osTempFile = CSLFetchNameValueDef(
+        papszOptions, "TEMPORARY_DB", osTempFileDefault.c_str());
+    VSIUnlink(osTempFile);
 
-    if (poDS->m_bReuseTempFile)
-    {
-        poDS->m_nTempTiles =
-            SQLGetInteger64(hDB, "SELECT COUNT(*) FROM temp", nullptr);
-    }
-    else
-    {
-        CPL_IGNORE_RET_VAL(SQLCommand(
-            hDB,
-            "PRAGMA page_size = 4096;"  // 4096: default since sqlite 3.12
-            "PRAGMA synchronous = OFF;"
-            "PRAGMA journal_mode = OFF;"
-            "PRAGMA temp_store = MEMORY;"
-            "CREATE TABLE temp(z INTEGER, x INTEGER, y INTEGER, layer TEXT, "
-            "idx INTEGER, feature BLOB, geomtype INTEGER, area_or_length "
-            "DOUBLE);"
-            "CREATE INDEX temp_index ON temp (z, x, y, layer, idx);"));
-    }
-
-    sqlite3_stmt *hInsertStmt = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        hDB,
-        "INSERT INTO temp (z,x,y,layer,idx,feature,geomtype,area_or_length) "
-        "VALUES (?,?,?,?,?,?,?,?)",
-        -1, &hInsertStmt, nullptr));
-    if (hInsertStmt == nullptr)
+    if (!poDS->m_oTempStore.Create(
+            osTempFile, CPLTestBool(CPLGetConfigOption(
+                            "OGR_MVT_REMOVE_TEMP_FILE", "YES"))))
     {
         delete poDS;
         return nullptr;
     }
-    poDS->m_hInsertStmt = hInsertStmt;
 
     poDS->m_nMinZoom = atoi(CSLFetchNameValueDef(
         papszOptions, "MINZOOM", CPLSPrintf("%d", poDS->m_nMinZoom)));
@@ -6127,7 +6639,7 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
         CSLFetchNameValue(papszOptions, "TILING_SCHEME");
     if (pszTilingScheme)
     {
-        if (bMBTILES)
+        if (bMBTILES || poDS->m_poTileSink)
         {
             CPLError(CE_Failure, CPLE_NotSupported,
                      "Custom TILING_SCHEME not supported with MBTILES output");
@@ -6201,12 +6713,14 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     return poDS;
 }
 
-GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
-                                       int nYSize, int nBandsIn,
-                                       GDALDataType eDT, char **papszOptions)
+GDALDataset *
+OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize, int nYSize,
+                          int nBandsIn, GDALDataType eDT, char **papszOptions,
+                          std::unique_ptr<OGRMVTTileSink> poTileSink)
 {
     return OGRMVTWriterDataset::Create(pszFilename, nXSize, nYSize, nBandsIn,
-                                       eDT, papszOptions);
+                                       eDT, papszOptions,
+                                       std::move(poTileSink));
 }
 
 #endif  // HAVE_MVT_WRITE_SUPPORT
@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cmath>
 #include <errno.h>
 #include <limits.h>
 #include <stddef.h>
@@ -3226,6 +3227,10 @@ class FileGDBOGRGeometryConverterImpl final : public FileGDBOGRGeometryConverter
     const FileGDBGeomField *poGeomField;
     GUInt32 *panPointCount = nullptr;
     GUInt32 nPointCountMax = 0;
+    std::vector<double> adfX{};  // used by GetAsWKB()
+    std::vector<double> adfY{};
+    std::vector<double> adfZ{};
+    std::vector<double> adfM{};
 #ifdef ASSUME_INNER_RINGS_IMMEDIATELY_AFTER_OUTER_RING
     int bUseOrganize = 0;
 #endif
@@ -3259,6 +3264,8 @@ class FileGDBOGRGeometryConverterImpl final : public FileGDBOGRGeometryConverter
     virtual ~FileGDBOGRGeometryConverterImpl();
 
     virtual OGRGeometry *GetAsGeometry(const OGRField *psField) override;
+    virtual bool GetAsWKB(const OGRField *psField,
+                          std::vector<GByte> &abyWKB) override;
 };
 
 /************************************************************************/
@@ -4404,6 +4411,339 @@ FileGDBOGRGeometryConverterImpl::GetAsGeometry(const OGRField *psField)
     return nullptr;
 }
 
+/************************************************************************/
+/*                          WKBBufferWriter                             */
+/************************************************************************/
+
+class WKBBufferWriter
+{
+    GByte *pabyCur;
+
+  public:
+    explicit WKBBufferWriter(GByte *pabyCurIn) : pabyCur(pabyCurIn)
+    {
+    }
+
+    void Header(GUInt32 nFlatType, bool bHasZ, bool bHasM)
+    {
+        *pabyCur = static_cast<GByte>(wkbNDR);
+        ++pabyCur;
+        // ISO WKB geometry type
+        UInt32(nFlatType + (bHasZ ? 1000 : 0) + (bHasM ? 2000 : 0));
+    }
+
+    void UInt32(GUInt32 nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        memcpy(pabyCur, &nVal, sizeof(nVal));
+        pabyCur += sizeof(nVal);
+    }
+
+    void Double(double dfVal)
+    {
+        CPL_LSBPTR64(&dfVal);
+        memcpy(pabyCur, &dfVal, sizeof(dfVal));
+        pabyCur += sizeof(dfVal);
+    }
+};
+
+/************************************************************************/
+/*                             GetAsWKB()                               */
+/************************************************************************/
+
+/* This must be kept consistent with GetAsGeometry(). Errors are checked and
+ * reported in the same order, so that the result is the same as
+ * GetAsGeometry() + exportToWkb(), once the shape type has been accepted.
+ */
+bool FileGDBOGRGeometryConverterImpl::GetAsWKB(const OGRField *psField,
+                                               std::vector<GByte> &abyWKB)
+{
+    // On error, return an empty buffer, that is a null geometry, as
+    // GetAsGeometry() does.
+    const bool errorRetValue = true;
+    abyWKB.clear();
+    GByte *pabyCur = psField->Binary.paData;
+    GByte *pabyEnd = pabyCur + psField->Binary.nCount;
+    GUInt32 nGeomType, i, nPoints, nParts, nCurves;
+    GIntBig dx, dy, dz;
+
+    ReadVarUInt32NoCheck(pabyCur, nGeomType);
+
+    bool bHasZ = (nGeomType & EXT_SHAPE_Z_FLAG) != 0;
+    bool bHasM = (nGeomType & EXT_SHAPE_M_FLAG) != 0;
+    switch ((nGeomType & 0xff))
+    {
+        case SHPT_POINTZ:
+        case SHPT_POINTZM:
+            bHasZ = true; /* go on */
+            [[fallthrough]];
+        case SHPT_POINT:
+        case SHPT_POINTM:
+        case SHPT_GENERALPOINT:
+        {
+            if (nGeomType == SHPT_POINTM || nGeomType == SHPT_POINTZM)
+                bHasM = true;
+
+            GUIntBig x, y;
+            ReadVarUInt64NoCheck(pabyCur, x);
+            ReadVarUInt64NoCheck(pabyCur, y);
+            // Empty point: let GetAsGeometry() deal with it
+            if (x == 0 || y == 0)
+                return false;
+
+            const double dfX = (x - 1U) / poGeomField->GetXYScale() +
+                                poGeomField->GetXOrigin();
+            const double dfY = (y - 1U) / poGeomField->GetXYScale() +
+                                poGeomField->GetYOrigin();
+            if (std::isnan(dfX) || std::isnan(dfY))
+                return false;
+
+            double dfZ = 0;
+            double dfM = 0;
+            if (bHasZ)
+            {
+                GUIntBig z = 0;
+                ReadVarUInt64NoCheck(pabyCur, z);
+                const double dfZScale = SanitizeScale(poGeomField->GetZScale());
+                dfZ = z == 0 ? std::numeric_limits<double>::quiet_NaN()
+                             : (z - 1U) / dfZScale + poGeomField->GetZOrigin();
+            }
+            if (bHasM)
+            {
+                GUIntBig m = 0;
+                ReadVarUInt64NoCheck(pabyCur, m);
+                const double dfMScale = SanitizeScale(poGeomField->GetMScale());
+                dfM = m == 0 ? std::numeric_limits<double>::quiet_NaN()
+                             : (m - 1U) / dfMScale + poGeomField->GetMOrigin();
+            }
+
+            abyWKB.resize(1 + 4 + (2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0)) *
+                                      sizeof(double));
+            WKBBufferWriter oWriter(abyWKB.data());
+            oWriter.Header(wkbPoint, bHasZ, bHasM);
+            oWriter.Double(dfX);
+            oWriter.Double(dfY);
+            if (bHasZ)
+                oWriter.Double(dfZ);
+            if (bHasM)
+                oWriter.Double(dfM);
+            return true;
+        }
+
+        case SHPT_MULTIPOINTZM:
+        case SHPT_MULTIPOINTZ:
+            bHasZ = true; /* go on */
+            [[fallthrough]];
+        case SHPT_MULTIPOINT:
+        case SHPT_MULTIPOINTM:
+        {
+            if (nGeomType == SHPT_MULTIPOINTM || nGeomType == SHPT_MULTIPOINTZM)
+                bHasM = true;
+
+            returnErrorIf(!ReadVarUInt32(pabyCur, pabyEnd, nPoints));
+            if (nPoints == 0)
+                return false;
+
+            returnErrorIf(!SkipVarUInt(pabyCur, pabyEnd, 4));
+
+            // nPoints is bounded by the blob size
+            returnErrorIf(nPoints > static_cast<GUInt32>(pabyEnd - pabyCur));
+            adfX.resize(nPoints);
+            adfY.resize(nPoints);
+
+            dx = dy = dz = 0;
+            XYArraySetter xySetter(adfX.data(), adfY.data());
+            if (!ReadXYArray<XYArraySetter>(xySetter, pabyCur, pabyEnd,
+                                            nPoints, dx, dy))
+            {
+                returnError();
+            }
+
+            if (bHasZ)
+            {
+                adfZ.resize(nPoints);
+                FileGDBArraySetter zSetter(adfZ.data());
+                if (!ReadZArray<FileGDBArraySetter>(zSetter, pabyCur, pabyEnd,
+                                                    nPoints, dz))
+                {
+                    returnError();
+                }
+            }
+
+            if (bHasM)
+            {
+                // Missing M array: let GetAsGeometry() deal with it
+                if (pabyCur + nPoints > pabyEnd)
+                    return false;
+                adfM.resize(nPoints);
+                GIntBig dm = 0;
+                FileGDBArraySetter mSetter(adfM.data());
+                if (!ReadMArray<FileGDBArraySetter>(mSetter, pabyCur, pabyEnd,
+                                                    nPoints, dm))
+                {
+                    returnError();
+                }
+            }
+
+            const size_t nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+            const size_t nPointSize = 1 + 4 + nDim * sizeof(double);
+            abyWKB.resize(1 + 4 + 4 + nPoints * nPointSize);
+            WKBBufferWriter oWriter(abyWKB.data());
+            oWriter.Header(wkbMultiPoint, bHasZ, bHasM);
+            oWriter.UInt32(nPoints);
+            for (i = 0; i < nPoints; i++)
+            {
+                oWriter.Header(wkbPoint, bHasZ, bHasM);
+                oWriter.Double(adfX[i]);
+                oWriter.Double(adfY[i]);
+                if (bHasZ)
+                    oWriter.Double(adfZ[i]);
+                if (bHasM)
+                    oWriter.Double(adfM[i]);
+            }
+            return true;
+        }
+
+        case SHPT_ARCZ:
+        case SHPT_ARCZM:
+        case SHPT_POLYGONZ:
+        case SHPT_POLYGONZM:
+            bHasZ = true; /* go on */
+            [[fallthrough]];
+        case SHPT_ARC:
+        case SHPT_ARCM:
+        case SHPT_GENERALPOLYLINE:
+        case SHPT_POLYGON:
+        case SHPT_POLYGONM:
+        case SHPT_GENERALPOLYGON:
+        {
+            const GUInt32 nBaseType = nGeomType & 0xff;
+            const bool bIsPolygon =
+                nBaseType == SHPT_POLYGONZ || nBaseType == SHPT_POLYGONZM ||
+                nBaseType == SHPT_POLYGON || nBaseType == SHPT_POLYGONM ||
+                nBaseType == SHPT_GENERALPOLYGON;
+            if (nGeomType == SHPT_ARCM || nGeomType == SHPT_ARCZM ||
+                nGeomType == SHPT_POLYGONM || nGeomType == SHPT_POLYGONZM)
+                bHasM = true;
+
+            returnErrorIf(
+                !ReadPartDefs(pabyCur, pabyEnd, nPoints, nParts, nCurves,
+                              (nGeomType & EXT_SHAPE_CURVE_FLAG) != 0, false));
+
+            // Empty geometries, curves, and polygons with several rings
+            // (which require a topological analysis) are left to
+            // GetAsGeometry()
+            if (nPoints == 0 || nParts == 0 || nCurves != 0 ||
+                (bIsPolygon && nParts > 1))
+            {
+                return false;
+            }
+            for (i = 0; i < nParts; i++)
+            {
+                if (panPointCount[i] == 0)
+                    return false;
+            }
+
+            adfX.resize(nPoints);
+            adfY.resize(nPoints);
+
+            // X/Y (and Z, M) deltas are accumulated through parts
+            dx = dy = dz = 0;
+            GUInt32 nStart = 0;
+            for (i = 0; i < nParts; i++)
+            {
+                XYArraySetter xySetter(adfX.data() + nStart,
+                                       adfY.data() + nStart);
+                if (!ReadXYArray<XYArraySetter>(xySetter, pabyCur, pabyEnd,
+                                                panPointCount[i], dx, dy))
+                {
+                    returnError();
+                }
+                nStart += panPointCount[i];
+            }
+
+            if (bHasZ)
+            {
+                adfZ.resize(nPoints);
+                nStart = 0;
+                for (i = 0; i < nParts; i++)
+                {
+                    FileGDBArraySetter zSetter(adfZ.data() + nStart);
+                    if (!ReadZArray<FileGDBArraySetter>(
+                            zSetter, pabyCur, pabyEnd, panPointCount[i], dz))
+                    {
+                        returnError();
+                    }
+                    nStart += panPointCount[i];
+                }
+            }
+
+            if (bHasM)
+            {
+                adfM.resize(nPoints);
+                GIntBig dm = 0;
+                nStart = 0;
+                for (i = 0; i < nParts; i++)
+                {
+                    // Missing M array: let GetAsGeometry() deal with it
+                    if (pabyCur + panPointCount[i] > pabyEnd)
+                        return false;
+                    FileGDBArraySetter mSetter(adfM.data() + nStart);
+                    if (!ReadMArray<FileGDBArraySetter>(
+                            mSetter, pabyCur, pabyEnd, panPointCount[i], dm))
+                    {
+                        returnError();
+                    }
+                    nStart += panPointCount[i];
+                }
+            }
+
+            // MultiLineString of LineStrings, or MultiPolygon of a single
+            // Polygon with a single ring.
+            const size_t nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+            abyWKB.resize(1 + 4 + 4 + (bIsPolygon ? 1 + 4 + 4 : 0) +
+                          nParts * (1 + 4 + 4) +
+                          static_cast<size_t>(nPoints) * nDim * sizeof(double));
+            WKBBufferWriter oWriter(abyWKB.data());
+            if (bIsPolygon)
+            {
+                oWriter.Header(wkbMultiPolygon, bHasZ, bHasM);
+                oWriter.UInt32(1);
+                oWriter.Header(wkbPolygon, bHasZ, bHasM);
+                oWriter.UInt32(1);
+            }
+            else
+            {
+                oWriter.Header(wkbMultiLineString, bHasZ, bHasM);
+                oWriter.UInt32(nParts);
+            }
+            nStart = 0;
+            for (i = 0; i < nParts; i++)
+            {
+                if (!bIsPolygon)
+                    oWriter.Header(wkbLineString, bHasZ, bHasM);
+                oWriter.UInt32(panPointCount[i]);
+                const GUInt32 nEnd = nStart + panPointCount[i];
+                for (GUInt32 j = nStart; j < nEnd; j++)
+                {
+                    oWriter.Double(adfX[j]);
+                    oWriter.Double(adfY[j]);
+                    if (bHasZ)
+                        oWriter.Double(adfZ[j]);
+                    if (bHasM)
+                        oWriter.Double(adfM[j]);
+                }
+                nStart = nEnd;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                           BuildConverter()                           */
 /************************************************************************/
@@ -864,6 +864,15 @@ class FileGDBOGRGeometryConverter
 
     virtual OGRGeometry *GetAsGeometry(const OGRField *psField) = 0;
 
+    /* Write directly the ISO WKB encoding of the geometry, for common shape
+     * types, without instantiating an OGRGeometry. Polygons and line strings
+     * are promoted to multi geometries, as OGROpenFileGDBLayer does.
+     * Returns false if the shape type or content is not handled by that
+     * code path, in which case GetAsGeometry() must be used instead.
+     * Returns true with an empty abyWKB if a decoding error occurred. */
+    virtual bool GetAsWKB(const OGRField *psField,
+                          std::vector<GByte> &abyWKB) = 0;
+
     static FileGDBOGRGeometryConverter *
     BuildConverter(const FileGDBGeomField *poGeomField);
     static OGRwkbGeometryType
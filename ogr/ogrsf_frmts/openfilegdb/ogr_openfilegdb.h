@@ -39,8 +39,10 @@
 #include "gdal_rat.h"
 
 #include <array>
-#include <vector>
+#include <deque>
 #include <map>
+#include <memory>
+#include <vector>
 
 using namespace OpenFileGDB;
 
@@ -109,6 +111,7 @@ constexpr const char *pszDatasetsRelatedThroughUUID =
 /*                      OGROpenFileGDBLayer                             */
 /************************************************************************/
 
+class OGRArrowArrayHelper;
 class OGROpenFileGDBDataSource;
 class OGROpenFileGDBGeomFieldDefn;
 class OGROpenFileGDBFeatureDefn;
@@ -194,6 +197,21 @@ class OGROpenFileGDBLayer final : public OGRLayer
                                std::vector<OGRField> &fields,
                                const OGRGeometry *&poGeom, bool bUpdate);
 
+    // Used by GetNextArrowArray() to decode ranges of rows in worker threads
+    struct ArrowArrayPrefetchTask;
+    std::deque<std::unique_ptr<ArrowArrayPrefetchTask>>
+        m_oQueueArrowArrayPrefetchTasks{};
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+
+    bool IsCompatOfOptimizedGetNextArrowArray();
+    int FillArrowArray(FileGDBTable *poTable,
+                       FileGDBOGRGeometryConverter *poGeomConverter,
+                       OGRArrowArrayHelper &sHelper, int64_t iRowStart,
+                       int64_t iRowEnd, int64_t &iRowStop) const;
+    static void ArrowArrayPrefetchJobFunc(void *pData);
+    void SubmitArrowArrayPrefetchTask(ArrowArrayPrefetchTask *poTask);
+    void CancelArrowArrayPrefetchTasks();
+
     CPL_DISALLOW_COPY_ASSIGN(OGROpenFileGDBLayer)
 
   public:
@@ -306,6 +324,12 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     virtual int TestCapability(const char *) override;
 
+    virtual int GetNextArrowArray(struct ArrowArrayStream *,
+                                  struct ArrowArray *out_array) override;
+
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
     virtual OGRErr Rename(const char *pszNewName) override;
 
     virtual OGRErr CreateField(const OGRFieldDefn *poField,
@@ -41,9 +41,12 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -54,6 +57,28 @@
 #include "filegdbtable.h"
 #include "ogr_swq.h"
 #include "filegdb_coordprec_read.h"
+#include "ograrrowarrayhelper.h"
+
+/************************************************************************/
+/*                       ArrowArrayPrefetchTask                         */
+/************************************************************************/
+
+// Decoding of a range of rows into an Arrow array, done by a worker thread
+// with its own handle on the table.
+struct OGROpenFileGDBLayer::ArrowArrayPrefetchTask
+{
+    const OGROpenFileGDBLayer *m_poLayer = nullptr;
+    std::unique_ptr<FileGDBTable> m_poTable{};
+    std::unique_ptr<FileGDBOGRGeometryConverter> m_poGeomConverter{};
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::unique_ptr<OGRArrowArrayHelper> m_poHelper{};
+    struct ArrowArray m_sArrowArray{};
+    int64_t m_iRowStart = 0;
+    int64_t m_iRowEnd = 0;
+    int64_t m_iRowStop = 0;
+    int m_nRet = 0;
+    std::vector<CPLErrorHandlerAccumulatorStruct> m_aoErrors{};
+};
 
 /************************************************************************/
 /*                      OGROpenFileGDBLayer()                           */
@@ -111,6 +136,8 @@ OGROpenFileGDBLayer::OGROpenFileGDBLayer(OGROpenFileGDBDataSource *poDS,
 
 OGROpenFileGDBLayer::~OGROpenFileGDBLayer()
 {
+    CancelArrowArrayPrefetchTasks();
+
     OGROpenFileGDBLayer::SyncToDisk();
 
     if (m_poFeatureDefn)
@@ -136,6 +163,7 @@ OGROpenFileGDBLayer::~OGROpenFileGDBLayer()
 
 void OGROpenFileGDBLayer::Close()
 {
+    CancelArrowArrayPrefetchTasks();
     delete m_poLyrTable;
     m_poLyrTable = nullptr;
     m_bValidLayerDefn = FALSE;
@@ -911,6 +939,7 @@ const char *OGROpenFileGDBLayer::GetFIDColumn()
 
 void OGROpenFileGDBLayer::ResetReading()
 {
+    CancelArrowArrayPrefetchTasks();
     if (m_iCurFeat != 0)
     {
         if (m_eSpatialIndexState == SPI_IN_BUILDING)
@@ -1698,6 +1727,35 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                      PromoteToMultiGeometry()                       */
+/***********************************************************************/
+
+// Polygons and line strings are reported as their multi counterpart, which
+// is the geometry type advertized by the layer.
+static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    const OGRwkbGeometryType eFlattenType =
+        wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
@@ -1766,27 +1824,7 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                 OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
-
+                    poGeom = PromoteToMultiGeometry(poGeom);
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
 
@@ -1995,6 +2033,8 @@ OGRFeature *OGROpenFileGDBLayer::GetFeature(GIntBig nFeatureId)
 
 OGRErr OGROpenFileGDBLayer::SetNextByIndex(GIntBig nIndex)
 {
+    CancelArrowArrayPrefetchTasks();
+
     if (m_poAttributeIterator != nullptr || m_poSpatialIndexIterator != nullptr)
         return OGRLayer::SetNextByIndex(nIndex);
 
@@ -2314,6 +2354,10 @@ int OGROpenFileGDBLayer::TestCapability(const char *pszCap)
     {
         return TRUE;
     }
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+    {
+        return IsCompatOfOptimizedGetNextArrowArray();
+    }
     else if (EQUAL(pszCap, OLCStringsAsUTF8))
     {
         return TRUE; /* ? */
@@ -2480,3 +2524,555 @@ GDALDataset *OGROpenFileGDBLayer::GetDataset()
 {
     return m_poDS;
 }
+
+/************************************************************************/
+/*                IsCompatOfOptimizedGetNextArrowArray()                */
+/************************************************************************/
+
+bool OGROpenFileGDBLayer::IsCompatOfOptimizedGetNextArrowArray()
+{
+    if (!BuildLayerDefinition() || m_poFilterGeom != nullptr ||
+        m_poAttrQuery != nullptr || m_iFIDAsRegularColumnIndex >= 0 ||
+        m_poLyrTable->HasDeletedFeaturesListed() ||
+        CPLTestBool(CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL",
+                                       "NO")))
+    {
+        return false;
+    }
+
+    if (m_iGeomFieldIdx >= 0)
+    {
+        const auto poGeomFieldDefn = m_poFeatureDefn->GetGeomFieldDefn(0);
+        if (!poGeomFieldDefn->IsIgnored() && !poGeomFieldDefn->IsNullable())
+            return false;
+    }
+
+    int iOGRIdx = 0;
+    for (int iGDBIdx = 0; iGDBIdx < m_poLyrTable->GetFieldCount(); iGDBIdx++)
+    {
+        if (iGDBIdx == m_iGeomFieldIdx ||
+            iGDBIdx == m_poLyrTable->GetObjectIdFieldIdx())
+        {
+            continue;
+        }
+        const OGRFieldDefn *poFieldDefn =
+            m_poFeatureDefn->GetFieldDefn(iOGRIdx);
+        iOGRIdx++;
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const auto poGDBField = m_poLyrTable->GetField(iGDBIdx);
+        if (poGDBField->GetType() == FGFT_RASTER)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           FillArrowArray()                           */
+/************************************************************************/
+
+// Decode the non-empty rows of [iRowStart, iRowEnd[ into the Arrow array of
+// sHelper, until the batch is full or its memory limit is reached.
+// iRowStop is set to the first row that has not been consumed.
+// This method only reads from poTable and poGeomConverter, and from the
+// (already built) layer definition, so that it can be run from worker
+// threads, each with its own table and converter.
+int OGROpenFileGDBLayer::FillArrowArray(
+    FileGDBTable *poTable, FileGDBOGRGeometryConverter *poGeomConverter,
+    OGRArrowArrayHelper &sHelper, int64_t iRowStart, int64_t iRowEnd,
+    int64_t &iRowStop) const
+{
+    struct Column
+    {
+        int iGDBIdx;
+        int iOGRIdx;  // -1 for the geometry field
+        int iArrowField;
+    };
+
+    // Columns to read, in the order of the row blob
+    std::vector<Column> aoColumns;
+    int iOGRIdx = 0;
+    for (int iGDBIdx = 0; iGDBIdx < poTable->GetFieldCount(); iGDBIdx++)
+    {
+        if (iGDBIdx == m_iGeomFieldIdx)
+        {
+            if (!m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
+            {
+                aoColumns.push_back(
+                    {iGDBIdx, -1, sHelper.m_mapOGRGeomFieldToArrowField[0]});
+            }
+        }
+        else if (iGDBIdx != poTable->GetObjectIdFieldIdx())
+        {
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iOGRIdx];
+            if (iArrowField >= 0)
+                aoColumns.push_back({iGDBIdx, iOGRIdx, iArrowField});
+            iOGRIdx++;
+        }
+    }
+
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    std::vector<GByte> abyWKB;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    const auto ReturnError = [&sHelper](int nErrno)
+    {
+        sHelper.ClearArray();
+        return nErrno;
+    };
+
+    int nCount = 0;
+    int64_t iRow = iRowStart;
+    bool bMemLimitReached = false;
+    while (nCount < sHelper.m_nMaxBatchSize && iRow < iRowEnd &&
+           !bMemLimitReached)
+    {
+        const int64_t iNextRow = poTable->GetAndSelectNextNonEmptyRow(iRow);
+        if (iNextRow < 0 || iNextRow >= iRowEnd)
+        {
+            iRow = iRowEnd;
+            break;
+        }
+        iRow = iNextRow;
+
+        const int iFeat = nCount;
+        for (const auto &oColumn : aoColumns)
+        {
+            const int iArrowField = oColumn.iArrowField;
+            auto psArray = sHelper.m_out_array->children[iArrowField];
+            const OGRField *psField = poTable->GetFieldValue(oColumn.iGDBIdx);
+
+            // Size of the value for string and binary columns
+            size_t nLen = 0;
+            const GByte *pabyData = nullptr;
+
+            if (oColumn.iOGRIdx < 0)
+            {
+                if (psField != nullptr)
+                {
+                    abyWKB.clear();
+                    if (!poGeomConverter->GetAsWKB(psField, abyWKB))
+                    {
+                        std::unique_ptr<OGRGeometry> poGeom(
+                            poGeomConverter->GetAsGeometry(psField));
+                        if (poGeom)
+                        {
+                            poGeom.reset(
+                                PromoteToMultiGeometry(poGeom.release()));
+                            abyWKB.resize(poGeom->WkbSize());
+                            poGeom->exportToWkb(wkbNDR, abyWKB.data(),
+                                                wkbVariantIso);
+                        }
+                    }
+                }
+                if (abyWKB.empty() || psField == nullptr)
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                        return ReturnError(ENOMEM);
+                    continue;
+                }
+                nLen = abyWKB.size();
+                pabyData = abyWKB.data();
+            }
+            else if (psField == nullptr)
+            {
+                if (sHelper.m_abNullableFields[oColumn.iOGRIdx])
+                {
+                    if (!sHelper.SetNull(iArrowField, iFeat))
+                        return ReturnError(ENOMEM);
+                }
+                else if (psArray->n_buffers == 3)
+                {
+                    OGRArrowArrayHelper::SetEmptyStringOrBinary(psArray,
+                                                                iFeat);
+                }
+                continue;
+            }
+            else
+            {
+                const OGRFieldDefn *poFieldDefn =
+                    m_poFeatureDefn->GetFieldDefn(oColumn.iOGRIdx);
+                switch (poFieldDefn->GetType())
+                {
+                    case OFTInteger:
+                        if (poFieldDefn->GetSubType() == OFSTInt16)
+                        {
+                            OGRArrowArrayHelper::SetInt16(
+                                psArray, iFeat,
+                                static_cast<int16_t>(psField->Integer));
+                        }
+                        else
+                        {
+                            OGRArrowArrayHelper::SetInt32(psArray, iFeat,
+                                                          psField->Integer);
+                        }
+                        break;
+
+                    case OFTInteger64:
+                        OGRArrowArrayHelper::SetInt64(psArray, iFeat,
+                                                      psField->Integer64);
+                        break;
+
+                    case OFTReal:
+                        if (poFieldDefn->GetSubType() == OFSTFloat32)
+                        {
+                            OGRArrowArrayHelper::SetFloat(
+                                psArray, iFeat,
+                                static_cast<float>(psField->Real));
+                        }
+                        else
+                        {
+                            OGRArrowArrayHelper::SetDouble(psArray, iFeat,
+                                                           psField->Real);
+                        }
+                        break;
+
+                    case OFTString:
+                        if (oColumn.iGDBIdx == m_iFieldToReadAsBinary)
+                        {
+                            // Binary content is nul-terminated by
+                            // FileGDBTable::GetFieldValue()
+                            pabyData = psField->Binary.paData;
+                            nLen = strlen(
+                                reinterpret_cast<const char *>(pabyData));
+                        }
+                        else
+                        {
+                            pabyData = reinterpret_cast<const GByte *>(
+                                psField->String);
+                            nLen = strlen(psField->String);
+                        }
+                        break;
+
+                    case OFTBinary:
+                        pabyData = psField->Binary.paData;
+                        nLen = psField->Binary.nCount;
+                        break;
+
+                    case OFTDate:
+                        OGRArrowArrayHelper::SetDate(psArray, iFeat,
+                                                     brokenDown, *psField);
+                        break;
+
+                    case OFTTime:
+                        OGRArrowArrayHelper::SetInt32(
+                            psArray, iFeat,
+                            psField->Date.Hour * 3600000 +
+                                psField->Date.Minute * 60000 +
+                                static_cast<int>(psField->Date.Second * 1000 +
+                                                 0.5));
+                        break;
+
+                    case OFTDateTime:
+                    {
+                        OGRField sField = *psField;
+                        if (poTable->GetField(oColumn.iGDBIdx)->GetType() ==
+                            FGFT_DATETIME)
+                        {
+                            sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                        }
+                        OGRArrowArrayHelper::SetDateTime(
+                            psArray, iFeat, brokenDown,
+                            sHelper.m_anTZFlags[oColumn.iOGRIdx], sField);
+                        break;
+                    }
+
+                    default:
+                        break;
+                }
+                if (pabyData == nullptr)
+                    continue;
+            }
+
+            // Stop the batch before this row if it would exceed the memory
+            // limit, unless it is the first one.
+            if (iFeat > 0)
+            {
+                auto panOffsets = static_cast<int32_t *>(
+                    const_cast<void *>(psArray->buffers[1]));
+                const uint32_t nCurLength =
+                    static_cast<uint32_t>(panOffsets[iFeat]);
+                if (nLen <= nMemLimit && nLen > nMemLimit - nCurLength)
+                {
+                    bMemLimitReached = true;
+                    break;
+                }
+            }
+
+            GByte *outPtr =
+                sHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nLen);
+            if (outPtr == nullptr)
+                return ReturnError(ENOMEM);
+            if (nLen)
+                memcpy(outPtr, pabyData, nLen);
+        }
+        if (bMemLimitReached)
+        {
+            // Nulls of the partially decoded row must not be accounted for
+            for (const auto &oColumn : aoColumns)
+            {
+                auto psArray =
+                    sHelper.m_out_array->children[oColumn.iArrowField];
+                const auto pabyValidity =
+                    static_cast<const uint8_t *>(psArray->buffers[0]);
+                if (pabyValidity &&
+                    (pabyValidity[iFeat / 8] & (1 << (iFeat % 8))) == 0)
+                {
+                    --psArray->null_count;
+                }
+            }
+            break;
+        }
+        if (poTable->HasGotError())
+            return ReturnError(EIO);
+
+        if (sHelper.m_bIncludeFID)
+            sHelper.m_panFIDValues[iFeat] = iRow + 1;
+        ++nCount;
+        ++iRow;
+    }
+
+    iRowStop = iRow;
+    sHelper.Shrink(nCount);
+    if (nCount == 0)
+        sHelper.ClearArray();
+    return 0;
+}
+
+/************************************************************************/
+/*                     ArrowArrayPrefetchJobFunc()                      */
+/************************************************************************/
+
+void OGROpenFileGDBLayer::ArrowArrayPrefetchJobFunc(void *pData)
+{
+    auto poTask = static_cast<ArrowArrayPrefetchTask *>(pData);
+    // Errors are replayed by the main thread when it collects the result
+    CPLInstallErrorHandlerAccumulator(poTask->m_aoErrors);
+    poTask->m_nRet = poTask->m_poLayer->FillArrowArray(
+        poTask->m_poTable.get(), poTask->m_poGeomConverter.get(),
+        *(poTask->m_poHelper), poTask->m_iRowStart, poTask->m_iRowEnd,
+        poTask->m_iRowStop);
+    CPLUninstallErrorHandlerAccumulator();
+}
+
+/************************************************************************/
+/*                    SubmitArrowArrayPrefetchTask()                    */
+/************************************************************************/
+
+void OGROpenFileGDBLayer::SubmitArrowArrayPrefetchTask(
+    ArrowArrayPrefetchTask *poTask)
+{
+    poTask->m_nRet = 0;
+    poTask->m_iRowStop = poTask->m_iRowStart;
+    poTask->m_aoErrors.clear();
+
+    // The Arrow array is allocated in the main thread, as this may involve
+    // fetching field domains from the dataset.
+    poTask->m_poHelper = std::make_unique<OGRArrowArrayHelper>(
+        m_poDS, m_poFeatureDefn, m_aosArrowArrayStreamOptions,
+        &poTask->m_sArrowArray);
+    if (poTask->m_sArrowArray.release == nullptr)
+    {
+        poTask->m_nRet = ENOMEM;
+        return;
+    }
+
+    if (!poTask->m_poJobQueue->SubmitJob(ArrowArrayPrefetchJobFunc, poTask))
+        ArrowArrayPrefetchJobFunc(poTask);
+}
+
+/************************************************************************/
+/*                   CancelArrowArrayPrefetchTasks()                    */
+/************************************************************************/
+
+void OGROpenFileGDBLayer::CancelArrowArrayPrefetchTasks()
+{
+    for (auto &poTask : m_oQueueArrowArrayPrefetchTasks)
+    {
+        poTask->m_poJobQueue->WaitCompletion();
+        if (poTask->m_sArrowArray.release)
+            poTask->m_sArrowArray.release(&poTask->m_sArrowArray);
+    }
+    m_oQueueArrowArrayPrefetchTasks.clear();
+}
+
+/************************************************************************/
+/*                         GetArrowNumThreads()                         */
+/************************************************************************/
+
+static int GetArrowNumThreads()
+{
+    return CPLParseNumThreads(
+        CPLGetConfigOption("OGR_OPENFILEGDB_NUM_THREADS", nullptr),
+        std::min(4, CPLGetNumCPUs()));
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (!IsCompatOfOptimizedGetNextArrowArray())
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    // Features are not fed to the in-memory spatial index by this code path
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+        m_eSpatialIndexState = SPI_INVALID;
+
+    const int64_t nTotalRecordCount = m_poLyrTable->GetTotalRecordCount();
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+
+    while (true)
+    {
+        if (!m_oQueueArrowArrayPrefetchTasks.empty())
+        {
+            auto poTask = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+            m_oQueueArrowArrayPrefetchTasks.pop_front();
+            poTask->m_poJobQueue->WaitCompletion();
+            poTask->m_poHelper.reset();
+            for (const auto &oError : poTask->m_aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+
+            if (poTask->m_nRet != 0)
+            {
+                const int nRet = poTask->m_nRet;
+                if (poTask->m_sArrowArray.release)
+                    poTask->m_sArrowArray.release(&poTask->m_sArrowArray);
+                CancelArrowArrayPrefetchTasks();
+                m_iCurFeat = nTotalRecordCount;
+                memset(out_array, 0, sizeof(*out_array));
+                return nRet;
+            }
+
+            const bool bHasArray = poTask->m_sArrowArray.release != nullptr;
+            if (bHasArray)
+            {
+                memcpy(out_array, &poTask->m_sArrowArray, sizeof(*out_array));
+                memset(&poTask->m_sArrowArray, 0,
+                       sizeof(poTask->m_sArrowArray));
+            }
+
+            if (poTask->m_iRowStop < poTask->m_iRowEnd)
+            {
+                // The batch has been truncated because of the memory limit:
+                // the remaining rows of the range must be returned before
+                // the ones of the other tasks.
+                poTask->m_iRowStart = poTask->m_iRowStop;
+                SubmitArrowArrayPrefetchTask(poTask.get());
+                m_oQueueArrowArrayPrefetchTasks.push_front(std::move(poTask));
+            }
+            else if (m_iCurFeat < nTotalRecordCount)
+            {
+                // Reuse the task for the next range of rows
+                poTask->m_iRowStart = m_iCurFeat;
+                poTask->m_iRowEnd =
+                    std::min(m_iCurFeat + nMaxBatchSize, nTotalRecordCount);
+                m_iCurFeat = poTask->m_iRowEnd;
+                SubmitArrowArrayPrefetchTask(poTask.get());
+                m_oQueueArrowArrayPrefetchTasks.push_back(std::move(poTask));
+            }
+
+            if (bHasArray)
+                return 0;
+            continue;
+        }
+
+        if (m_iCurFeat >= nTotalRecordCount)
+        {
+            memset(out_array, 0, sizeof(*out_array));
+            return 0;
+        }
+
+        // Decode ranges of rows in worker threads, each of them with its own
+        // handle on the table, which can directly seek to its range through
+        // the .gdbtablx offsets. This requires the table to be stable on
+        // disk, hence is not done in update mode.
+        const int nThreads = GetArrowNumThreads();
+        const int64_t nRemainingBatches =
+            (nTotalRecordCount - m_iCurFeat + nMaxBatchSize - 1) /
+            nMaxBatchSize;
+        if (!m_bEditable && nThreads >= 2 && nRemainingBatches >= 2)
+        {
+            const int nTasks = static_cast<int>(
+                std::min<int64_t>(nThreads, nRemainingBatches));
+            auto poThreadPool = GDALGetGlobalThreadPool(nTasks);
+            for (int iTask = 0; poThreadPool && iTask < nTasks; ++iTask)
+            {
+                auto poTask = std::make_unique<ArrowArrayPrefetchTask>();
+                poTask->m_poLayer = this;
+                poTask->m_poTable = std::make_unique<FileGDBTable>();
+                if (!poTask->m_poTable->Open(m_osGDBFilename, false,
+                                             GetDescription()) ||
+                    poTask->m_poTable->GetFieldCount() !=
+                        m_poLyrTable->GetFieldCount())
+                {
+                    break;
+                }
+                for (int i = 0; i < m_poLyrTable->GetFieldCount(); ++i)
+                {
+                    if (m_poLyrTable->GetField(i)->IsHighPrecision())
+                        poTask->m_poTable->GetField(i)->SetHighPrecision();
+                }
+                if (m_iGeomFieldIdx >= 0)
+                {
+                    poTask->m_poGeomConverter.reset(
+                        FileGDBOGRGeometryConverter::BuildConverter(
+                            poTask->m_poTable->GetGeomField()));
+                }
+                poTask->m_poJobQueue = poThreadPool->CreateJobQueue();
+                poTask->m_iRowStart = m_iCurFeat;
+                poTask->m_iRowEnd =
+                    std::min(m_iCurFeat + nMaxBatchSize, nTotalRecordCount);
+                m_iCurFeat = poTask->m_iRowEnd;
+                SubmitArrowArrayPrefetchTask(poTask.get());
+                m_oQueueArrowArrayPrefetchTasks.push_back(std::move(poTask));
+            }
+            if (!m_oQueueArrowArrayPrefetchTasks.empty())
+            {
+                CPLDebug("OpenFileGDB",
+                         "%s: using %d threads for Arrow reading",
+                         GetDescription(),
+                         static_cast<int>(
+                             m_oQueueArrowArrayPrefetchTasks.size()));
+                continue;
+            }
+        }
+
+        OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                    m_aosArrowArrayStreamOptions, out_array);
+        if (out_array->release == nullptr)
+            return ENOMEM;
+
+        int64_t iRowStop = m_iCurFeat;
+        const int nRet =
+            FillArrowArray(m_poLyrTable, m_poGeomConverter.get(), sHelper,
+                           m_iCurFeat, nTotalRecordCount, iRowStop);
+        m_iCurFeat = nRet == 0 ? iRowStop : nTotalRecordCount;
+        return nRet;
+    }
+}
+
+/************************************************************************/
+/*                          GetMetadataItem()                           */
+/************************************************************************/
+
+const char *OGROpenFileGDBLayer::GetMetadataItem(const char *pszName,
+                                                 const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
@@ -35,6 +35,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 
 #include "../arrow_common/ogr_arrow.h"
 #include "ogr_include_parquet.h"
@@ -88,6 +89,8 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
 /*                        OGRParquetLayer                               */
 /************************************************************************/
 
+class OGRParquetRowGroupsBatchReader;
+
 class OGRParquetLayer final : public OGRParquetLayerBase
 
 {
@@ -110,6 +113,8 @@ class OGRParquetLayer final : public OGRParquetLayerBase
     int64_t m_nFeatureIdxSelected = 0;
     std::vector<int> m_anRequestedParquetColumns{};  // only valid when
                                                      // m_bIgnoredFields is set
+    //! Set when m_poRecordBatchReader decodes row groups in worker threads
+    std::weak_ptr<OGRParquetRowGroupsBatchReader> m_poRowGroupsBatchReader{};
     CPLStringList m_aosFeatherMetadata{};
 
     //! Describe the bbox column of a geometry column
@@ -132,7 +137,9 @@ class OGRParquetLayer final : public OGRParquetLayerBase
         const CPLJSONObject &oJSONGeometryColumn,
         const std::map<std::string, int> &oMapParquetColumnNameToIdx);
     bool CreateRecordBatchReader(int iStartingRowGroup);
-    bool CreateRecordBatchReader(const std::vector<int> &anRowGroups);
+    bool CreateRecordBatchReader(const std::vector<int> &anRowGroups,
+                                 bool bDecodeInParallel = false);
+    void WaitPendingRowGroupsDecoding() const;
     bool ReadNextBatch() override;
 
     void InvalidateCachedBatches() override;
@@ -162,6 +169,7 @@ class OGRParquetLayer final : public OGRParquetLayerBase
     OGRParquetLayer(OGRParquetDataset *poDS, const char *pszLayerName,
                     std::unique_ptr<parquet::arrow::FileReader> &&arrow_reader,
                     CSLConstList papszOpenOptions);
+    ~OGRParquetLayer() override;
 
     void ResetReading() override;
     OGRFeature *GetFeature(GIntBig nFID) override;
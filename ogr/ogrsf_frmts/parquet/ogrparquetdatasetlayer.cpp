@@ -899,6 +899,31 @@ OGRParquetDatasetLayer::BuildArrowFilter(const swq_expr_node *poNode,
             return cp::is_null(expr);
     }
 
+    else if (poNode->eNodeType == SNT_OPERATION &&
+             poNode->nOperation == SWQ_IN && poNode->nSubExprCount >= 2)
+    {
+        // Translate "x IN (a, b, ...)" as "x = a OR x = b OR ..." so that
+        // the scanner can use row group statistics to skip row groups.
+        const auto sLeft =
+            BuildArrowFilter(poNode->papoSubExpr[0], bFullyTranslated);
+        if (sLeft.is_valid())
+        {
+            std::vector<cp::Expression> aoTerms;
+            for (int i = 1; i < poNode->nSubExprCount; ++i)
+            {
+                if (poNode->papoSubExpr[i]->eNodeType != SNT_CONSTANT)
+                    break;
+                const auto sRight =
+                    BuildArrowFilter(poNode->papoSubExpr[i], bFullyTranslated);
+                if (!sRight.is_valid())
+                    break;
+                aoTerms.push_back(cp::equal(sLeft, sRight));
+            }
+            if (static_cast<int>(aoTerms.size()) == poNode->nSubExprCount - 1)
+                return cp::or_(aoTerms);
+        }
+    }
+
     bFullyTranslated = false;
     return {};
 }
@@ -29,14 +29,20 @@
 #include "cpl_json.h"
 #include "cpl_time.h"
 #include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "ogrsf_frmts.h"
 #include "ogr_p.h"
 
 #include <algorithm>
 #include <cinttypes>
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
 #include <limits>
 #include <map>
+#include <mutex>
 #include <set>
 #include <utility>
 
@@ -548,6 +554,17 @@ OGRParquetLayer::OGRParquetLayer(
     m_oFeatureIdxRemappingIter = m_asFeatureIdxRemapping.begin();
 }
 
+/************************************************************************/
+/*                         ~OGRParquetLayer()                           */
+/************************************************************************/
+
+OGRParquetLayer::~OGRParquetLayer()
+{
+    // The record batch reader may have pending row group decoding jobs
+    // using m_poArrowReader, so it must be destroyed first.
+    m_poRecordBatchReader.reset();
+}
+
 /************************************************************************/
 /*                        EstablishFeatureDefn()                        */
 /************************************************************************/
@@ -1067,6 +1084,7 @@ OGRParquetLayer::BuildDomain(const std::string &osDomainName,
 #endif
     const int iParquetCol = m_anMapFieldIndexToParquetColumn[iFieldIndex];
     CPLAssert(iParquetCol >= 0);
+    WaitPendingRowGroupsDecoding();
     std::shared_ptr<arrow::RecordBatchReader> poRecordBatchReader;
     const auto oldBatchSize = m_poArrowReader->properties().batch_size();
     m_poArrowReader->set_batch_size(1);
@@ -1142,6 +1160,8 @@ OGRParquetLayer::ComputeGeometryColumnType(int iGeomCol, int iParquetCol) const
 
 OGRFeature *OGRParquetLayer::GetFeatureExplicitFID(GIntBig nFID)
 {
+    WaitPendingRowGroupsDecoding();
+
     std::shared_ptr<arrow::RecordBatchReader> poRecordBatchReader;
 
     std::vector<int> anRowGroups;
@@ -1218,6 +1238,8 @@ OGRFeature *OGRParquetLayer::GetFeatureByIndex(GIntBig nFID)
     if (nFID < 0)
         return nullptr;
 
+    WaitPendingRowGroupsDecoding();
+
     const auto metadata = m_poArrowReader->parquet_reader()->metadata();
     const int nNumGroups = m_poArrowReader->num_row_groups();
     int64_t nAccRows = 0;
@@ -1326,9 +1348,261 @@ bool OGRParquetLayer::CreateRecordBatchReader(int iStartingRowGroup)
     return CreateRecordBatchReader(anRowGroups);
 }
 
+/************************************************************************/
+/*                  OGRParquetRowGroupsBatchReader                      */
+/************************************************************************/
+
+// RecordBatchReader that decodes the next row groups of a list ahead, in
+// parallel, on the GDAL global thread pool. Batches do not cross row group
+// boundaries, as with parquet::arrow::FileReader::GetRecordBatchReader().
+// The row groups decoded ahead are limited both in number and in size, using
+// the uncompressed size of their column chunks as an estimate of their size
+// once decoded.
+// parquet::arrow::FileReader cannot be used concurrently from several
+// threads, so its other users must call WaitCompletion() first.
+class OGRParquetRowGroupsBatchReader final : public arrow::RecordBatchReader
+{
+    struct Task
+    {
+        OGRParquetRowGroupsBatchReader *poReader = nullptr;
+        int iRowGroup = 0;
+        int64_t nBytes = 0;
+        bool bDone = false;
+        std::shared_ptr<arrow::Table> poTable{};
+        arrow::Status status{};
+    };
+
+    parquet::arrow::FileReader *const m_poArrowReader;
+    const std::vector<int> m_anRowGroups;
+    const std::vector<int> m_anColumns;  // empty means all columns
+    const bool m_bAllColumns;
+    const int64_t m_nBatchSize;
+    const size_t m_nMaxTasks;
+    const uint64_t m_nMaxBytes;
+    std::vector<int64_t> m_anRowGroupBytes{};  // same size as m_anRowGroups
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::deque<std::unique_ptr<Task>> m_apoTasks{};
+    size_t m_iNextRowGroup = 0;
+    // Estimated size of the row groups of m_apoTasks and of m_poCurTable
+    uint64_t m_nBytesInFlight = 0;
+    int64_t m_nCurTableBytes = 0;
+    std::shared_ptr<arrow::Table> m_poCurTable{};
+    std::unique_ptr<arrow::TableBatchReader> m_poCurTableReader{};
+    std::shared_ptr<arrow::Schema> m_poSchema{};
+
+    OGRParquetRowGroupsBatchReader(const OGRParquetRowGroupsBatchReader &) =
+        delete;
+    OGRParquetRowGroupsBatchReader &
+    operator=(const OGRParquetRowGroupsBatchReader &) = delete;
+
+    static void JobFunc(void *pData)
+    {
+        Task *psTask = static_cast<Task *>(pData);
+        OGRParquetRowGroupsBatchReader *poReader = psTask->poReader;
+        std::shared_ptr<arrow::Table> poTable;
+        const auto status =
+            poReader->m_bAllColumns
+                ? poReader->m_poArrowReader->ReadRowGroup(psTask->iRowGroup,
+                                                          &poTable)
+                : poReader->m_poArrowReader->ReadRowGroup(
+                      psTask->iRowGroup, poReader->m_anColumns, &poTable);
+        {
+            std::lock_guard<std::mutex> oLock(poReader->m_oMutex);
+            psTask->poTable = std::move(poTable);
+            psTask->status = status;
+            psTask->bDone = true;
+        }
+        poReader->m_oCV.notify_all();
+    }
+
+    void SubmitTasks()
+    {
+        while (m_apoTasks.size() < m_nMaxTasks &&
+               m_iNextRowGroup < m_anRowGroups.size())
+        {
+            // Always decode at least one row group, whatever its size
+            const int64_t nBytes = m_anRowGroupBytes[m_iNextRowGroup];
+            if (m_nBytesInFlight > 0 &&
+                m_nBytesInFlight + static_cast<uint64_t>(nBytes) > m_nMaxBytes)
+            {
+                break;
+            }
+            auto poTask = std::make_unique<Task>();
+            poTask->poReader = this;
+            poTask->iRowGroup = m_anRowGroups[m_iNextRowGroup++];
+            poTask->nBytes = nBytes;
+            m_nBytesInFlight += static_cast<uint64_t>(nBytes);
+            Task *psTask = poTask.get();
+            m_apoTasks.push_back(std::move(poTask));
+            if (!m_poJobQueue->SubmitJob(JobFunc, psTask))
+                JobFunc(psTask);
+        }
+    }
+
+    void ReleaseCurTable()
+    {
+        m_poCurTableReader.reset();
+        m_poCurTable.reset();
+        m_nBytesInFlight -= static_cast<uint64_t>(m_nCurTableBytes);
+        m_nCurTableBytes = 0;
+    }
+
+  public:
+    OGRParquetRowGroupsBatchReader(
+        parquet::arrow::FileReader *poArrowReader,
+        const std::vector<int> &anRowGroups, const std::vector<int> &anColumns,
+        bool bAllColumns, CPLWorkerThreadPool *poThreadPool, int nMaxTasks,
+        uint64_t nMaxBytes)
+        : m_poArrowReader(poArrowReader), m_anRowGroups(anRowGroups),
+          m_anColumns(anColumns), m_bAllColumns(bAllColumns),
+          m_nBatchSize(poArrowReader->properties().batch_size()),
+          m_nMaxTasks(static_cast<size_t>(nMaxTasks)), m_nMaxBytes(nMaxBytes),
+          m_poJobQueue(poThreadPool->CreateJobQueue())
+    {
+        const auto metadata = poArrowReader->parquet_reader()->metadata();
+        m_anRowGroupBytes.reserve(anRowGroups.size());
+        for (int iRowGroup : anRowGroups)
+        {
+            const auto poRowGroup = metadata->RowGroup(iRowGroup);
+            int64_t nBytes = 0;
+            if (bAllColumns)
+            {
+                nBytes = poRowGroup->total_byte_size();
+            }
+            else
+            {
+                for (int iCol : anColumns)
+                {
+                    nBytes += poRowGroup->ColumnChunk(iCol)
+                                  ->total_uncompressed_size();
+                }
+            }
+            m_anRowGroupBytes.push_back(std::max<int64_t>(nBytes, 0));
+        }
+    }
+
+    ~OGRParquetRowGroupsBatchReader() override
+    {
+        m_poJobQueue->WaitCompletion();
+    }
+
+    // Wait for the row groups being decoded. The decoded ones are kept.
+    void WaitCompletion()
+    {
+        m_poJobQueue->WaitCompletion();
+    }
+
+    std::shared_ptr<arrow::Schema> schema() const override
+    {
+        // Only known once the first row group has been decoded
+        return m_poSchema;
+    }
+
+    arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch> *batch) override
+    {
+        batch->reset();
+        while (true)
+        {
+            if (m_poCurTableReader)
+            {
+                auto status = m_poCurTableReader->ReadNext(batch);
+                if (!status.ok() || *batch)
+                    return status;
+                ReleaseCurTable();
+            }
+
+            SubmitTasks();
+            if (m_apoTasks.empty())
+                return arrow::Status::OK();
+
+            auto poTask = std::move(m_apoTasks.front());
+            m_apoTasks.pop_front();
+            {
+                std::unique_lock<std::mutex> oLock(m_oMutex);
+                m_oCV.wait(oLock, [&poTask] { return poTask->bDone; });
+            }
+            m_poCurTable = std::move(poTask->poTable);
+            m_nCurTableBytes = poTask->nBytes;
+            if (!poTask->status.ok())
+            {
+                ReleaseCurTable();
+                return poTask->status;
+            }
+
+            // Keep the other threads busy while we consume this row group
+            SubmitTasks();
+
+            if (!m_poSchema)
+                m_poSchema = m_poCurTable->schema();
+            m_poCurTableReader =
+                std::make_unique<arrow::TableBatchReader>(*m_poCurTable);
+            m_poCurTableReader->set_chunksize(m_nBatchSize);
+        }
+    }
+};
+
+/************************************************************************/
+/*                   WaitPendingRowGroupsDecoding()                     */
+/************************************************************************/
+
+/** Wait for the row groups being decoded in worker threads by the current
+ * record batch reader, if any. Must be called before m_poArrowReader is used
+ * to read data or to change its properties.
+ */
+void OGRParquetLayer::WaitPendingRowGroupsDecoding() const
+{
+    if (auto poReader = m_poRowGroupsBatchReader.lock())
+        poReader->WaitCompletion();
+}
+
+/************************************************************************/
+/*                      CreateRecordBatchReader()                       */
+/************************************************************************/
+
 bool OGRParquetLayer::CreateRecordBatchReader(
-    const std::vector<int> &anRowGroups)
+    const std::vector<int> &anRowGroups, bool bDecodeInParallel)
 {
+    WaitPendingRowGroupsDecoding();
+
+    if (bDecodeInParallel && anRowGroups.size() >= 2)
+    {
+        const int nNumCPUs = GetNumCPUs();
+        const char *pszUseThreads =
+            CPLGetConfigOption("OGR_PARQUET_USE_THREADS", nullptr);
+        if (nNumCPUs > 1 && (!pszUseThreads || CPLTestBool(pszUseThreads)))
+        {
+            const int nMaxTasks = static_cast<int>(
+                std::min<size_t>(nNumCPUs, anRowGroups.size()));
+            CPLWorkerThreadPool *poThreadPool =
+                GDALGetGlobalThreadPool(nMaxTasks);
+            if (poThreadPool)
+            {
+                uint64_t nMaxBytes = CPLGetUsablePhysicalRAM() / 10;
+                if (nMaxBytes == 0)
+                    nMaxBytes = 100 * 1024 * 1024;
+                const char *pszMaxRAMUsage = CPLGetConfigOption(
+                    "OGR_PARQUET_PREFETCH_MAX_RAM_USAGE", nullptr);
+                if (pszMaxRAMUsage)
+                    nMaxBytes = std::strtoull(pszMaxRAMUsage, nullptr, 10);
+
+                CPLDebug("PARQUET",
+                         "Decoding up to %d row groups in parallel, within "
+                         "%" PRIu64 " bytes",
+                         nMaxTasks, nMaxBytes);
+                auto poReader =
+                    std::make_shared<OGRParquetRowGroupsBatchReader>(
+                        m_poArrowReader.get(), anRowGroups,
+                        m_anRequestedParquetColumns, !m_bIgnoredFields,
+                        poThreadPool, nMaxTasks, nMaxBytes);
+                m_poRowGroupsBatchReader = poReader;
+                m_poRecordBatchReader = std::move(poReader);
+                return true;
+            }
+        }
+    }
+
     arrow::Status status;
     if (m_bIgnoredFields)
     {
@@ -1627,8 +1901,10 @@ bool OGRParquetLayer::ReadNextBatch()
                                          eType, eSubType, osMinTmp, osMaxTmp) ||
                                      !bFoundMin || !bFoundMax)
                             {
-                                bIterateEverything = true;
-                                break;
+                                // No statistics for this row group: it cannot
+                                // be pruned by this constraint, but other
+                                // constraints and row groups may be.
+                                continue;
                             }
                         }
 
@@ -1758,16 +2034,13 @@ bool OGRParquetLayer::ReadNextBatch()
                                 static_cast<int>(constraint.eType), eType);
                         }
 
+                        // UNKNOWN means that this constraint cannot be used
+                        // to prune this row group.
                         if (res == IsConstraintPossibleRes::NO)
                         {
                             bSelectGroup = false;
                             break;
                         }
-                        else if (res == IsConstraintPossibleRes::UNKNOWN)
-                        {
-                            bIterateEverything = true;
-                            break;
-                        }
                     }
                 }
 
@@ -1803,7 +2076,8 @@ bool OGRParquetLayer::ReadNextBatch()
                      m_poArrowReader->num_row_groups());
             m_nFeatureIdx = m_oFeatureIdxRemappingIter->second;
             ++m_oFeatureIdxRemappingIter;
-            if (!CreateRecordBatchReader(anSelectedGroups))
+            if (!CreateRecordBatchReader(anSelectedGroups,
+                                         /* bDecodeInParallel = */ true))
             {
                 return false;
             }
@@ -2240,6 +2514,7 @@ bool OGRParquetLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
             nMaxBatchSize = 1;
         if (nMaxBatchSize > INT_MAX - 1)
             nMaxBatchSize = INT_MAX - 1;
+        WaitPendingRowGroupsDecoding();
         m_poArrowReader->set_batch_size(nMaxBatchSize);
     }
     return OGRArrowLayer::GetArrowStream(out_stream, papszOptions);
@@ -41,6 +41,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <limits>
 #include <unordered_map>
 #include <utility>
 
@@ -48,10 +49,8 @@
 /*                         ProcessMetadata()                            */
 /************************************************************************/
 
-static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
-                            std::string &osMetadata)
+static bool ProcessMetadata(GDALDataset *poSQLiteDS, CPLJSONObject &oObj)
 {
-
     auto poMetadata = poSQLiteDS->GetLayerByName("metadata");
     if (!poMetadata)
     {
@@ -68,7 +67,6 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
         return false;
     }
 
-    CPLJSONObject oObj;
     CPLJSONDocument oJsonDoc;
     for (auto &&poFeature : poMetadata)
     {
@@ -93,6 +91,18 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
         }
     }
 
+    return true;
+}
+
+/************************************************************************/
+/*                            BuildHeader()                             */
+/************************************************************************/
+
+static bool BuildHeader(const CPLJSONObject &oMetadata,
+                        pmtiles::headerv3 &sHeader, std::string &osMetadata)
+{
+    CPLJSONObject oObj = oMetadata.Clone();
+
     // MBTiles advertises scheme=tms. Override this
     oObj.Set("scheme", "xyz");
 
@@ -214,195 +224,150 @@ template <class T, size_t N> struct HashArray
 };
 
 /************************************************************************/
-/*                    OGRPMTilesConvertFromMBTiles()                    */
+/*                  OGRPMTilesArchiveWriter::Private                    */
 /************************************************************************/
 
-bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
-                                  const char *pszSrcName)
+struct OGRPMTilesArchiveWriter::Private
 {
-    const char *const apszAllowedDrivers[] = {"SQLite", nullptr};
-    auto poSQLiteDS = std::unique_ptr<GDALDataset>(
-        GDALDataset::Open(pszSrcName, GDAL_OF_VECTOR, apszAllowedDrivers));
-    if (!poSQLiteDS)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Cannot open %s with SQLite driver", pszSrcName);
-        return false;
-    }
+    std::string osDestName{};
+    std::string osTmpFile{};
+    VSIVirtualHandleUniquePtr poTmpFile{};
 
-    pmtiles::headerv3 sHeader;
-    std::string osMetadata;
-    if (!ProcessMetadata(poSQLiteDS.get(), sHeader, osMetadata))
-        return false;
+    std::vector<pmtiles::entryv3> asPMTilesEntries{};
+    bool bHasLastTile = false;
+    uint64_t nLastTileId = 0;
+    TileHash abyLastHash{};
+    uint64_t nFileOffset = 0;
+    uint64_t nAddressedTiles = 0;
+    std::unordered_map<TileHash, std::pair<uint64_t, uint32_t>,
+                       HashArray<unsigned char, 16>>
+        oMapMD5ToOffsetLen{};
+};
 
-    auto poTilesLayer = poSQLiteDS->GetLayerByName("tiles");
-    if (!poTilesLayer)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "tiles table not found");
-        return false;
-    }
+/************************************************************************/
+/*                       OGRPMTilesArchiveWriter()                      */
+/************************************************************************/
 
-    const int iZoomLevel =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("zoom_level");
-    const int iTileColumn =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_column");
-    const int iTileRow =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_row");
-    const int iTileData =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_data");
-    if (iZoomLevel < 0 || iTileColumn < 0 || iTileRow < 0 || iTileData < 0)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Bad structure for tiles table");
-        return false;
-    }
+OGRPMTilesArchiveWriter::OGRPMTilesArchiveWriter() : m_p(new Private())
+{
+}
 
-    struct TileEntry
-    {
-        uint64_t nTileId;
-        std::array<unsigned char, 16> abyMD5;
-    };
+/************************************************************************/
+/*                      ~OGRPMTilesArchiveWriter()                      */
+/************************************************************************/
 
-    // In a first step browse through the tiles table to compute the PMTiles
-    // tile_id of each tile, and compute a hash of the tile data for
-    // deduplication
-    std::vector<TileEntry> asTileEntries;
-    for (auto &&poFeature : poTilesLayer)
+OGRPMTilesArchiveWriter::~OGRPMTilesArchiveWriter()
+{
+    if (m_p->poTmpFile)
     {
-        const int nZoomLevel = poFeature->GetFieldAsInteger(iZoomLevel);
-        if (nZoomLevel < 0 || nZoomLevel > 30)
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid zoom_level");
-            continue;
-        }
-        const int nColumn = poFeature->GetFieldAsInteger(iTileColumn);
-        if (nColumn < 0 || nColumn >= (1 << nZoomLevel))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid tile_column");
-            continue;
-        }
-        const int nRow = poFeature->GetFieldAsInteger(iTileRow);
-        if (nRow < 0 || nRow >= (1 << nZoomLevel))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid tile_row");
-            continue;
-        }
-        // MBTiles uses a 0=bottom-most row, whereas PMTiles uses
-        // 0=top-most row
-        const int nY = (1 << nZoomLevel) - 1 - nRow;
-        uint64_t nTileId;
-        try
-        {
-            nTileId = pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZoomLevel),
-                                             nColumn, nY);
-        }
-        catch (const std::exception &e)
-        {
-            // shouldn't happen given previous checks
-            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute tile id: %s",
-                     e.what());
-            return false;
-        }
-        int nTileDataLength = 0;
-        const GByte *pabyData =
-            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
-        if (!pabyData)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
-            return false;
-        }
-
-        TileEntry sEntry;
-        sEntry.nTileId = nTileId;
-
-        CPLMD5Context md5context;
-        CPLMD5Init(&md5context);
-        CPLMD5Update(&md5context, pabyData, nTileDataLength);
-        CPLMD5Final(&sEntry.abyMD5[0], &md5context);
-        try
-        {
-            asTileEntries.push_back(sEntry);
-        }
-        catch (const std::exception &e)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Out of memory browsing through tiles: %s", e.what());
-            return false;
-        }
+        m_p->poTmpFile.reset();
+        VSIUnlink(m_p->osTmpFile.c_str());
     }
+}
 
-    // Sort the tiles by ascending tile_id. This is a requirement to build
-    // the PMTiles directories.
-    std::sort(asTileEntries.begin(), asTileEntries.end(),
-              [](const TileEntry &a, const TileEntry &b)
-              { return a.nTileId < b.nTileId; });
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::Open(const char *pszDestName)
+{
+    m_p->osDestName = pszDestName;
 
     // Let's build a temporary file that contains the tile data in
     // a way that corresponds to the "clustered" mode, that is
     // "offsets are either contiguous with the previous offset+length, or
     // refer to a lesser offset, when writing with deduplication."
-    std::string osTmpFile(std::string(pszDestName) + ".tmp");
+    m_p->osTmpFile = std::string(pszDestName) + ".tmp";
     if (!VSIIsLocal(pszDestName))
     {
-        osTmpFile = CPLGenerateTempFilename(CPLGetFilename(pszDestName));
+        m_p->osTmpFile = CPLGenerateTempFilename(CPLGetFilename(pszDestName));
     }
 
-    auto poTmpFile =
-        VSIVirtualHandleUniquePtr(VSIFOpenL(osTmpFile.c_str(), "wb+"));
-    VSIUnlink(osTmpFile.c_str());
-    if (!poTmpFile)
+    m_p->poTmpFile =
+        VSIVirtualHandleUniquePtr(VSIFOpenL(m_p->osTmpFile.c_str(), "wb+"));
+    VSIUnlink(m_p->osTmpFile.c_str());
+    if (!m_p->poTmpFile)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
-                 osTmpFile.c_str());
+                 m_p->osTmpFile.c_str());
         return false;
     }
+    return true;
+}
 
-    struct ResetAndUnlinkTmpFile
-    {
-        VSIVirtualHandleUniquePtr &m_poFile;
-        std::string m_osFilename;
+/************************************************************************/
+/*                            ComputeHash()                             */
+/************************************************************************/
 
-        ResetAndUnlinkTmpFile(VSIVirtualHandleUniquePtr &poFile,
-                              const std::string &osFilename)
-            : m_poFile(poFile), m_osFilename(osFilename)
-        {
-        }
+/* static */
+OGRPMTilesArchiveWriter::TileHash
+OGRPMTilesArchiveWriter::ComputeHash(const void *pData, size_t nSize)
+{
+    TileHash abyHash;
+    CPLMD5Context md5context;
+    CPLMD5Init(&md5context);
+    CPLMD5Update(&md5context, pData, nSize);
+    CPLMD5Final(&abyHash[0], &md5context);
+    return abyHash;
+}
 
-        ~ResetAndUnlinkTmpFile()
-        {
-            m_poFile.reset();
-            VSIUnlink(m_osFilename.c_str());
-        }
-    };
+/************************************************************************/
+/*                          HasTileContent()                            */
+/************************************************************************/
 
-    ResetAndUnlinkTmpFile oReseer(poTmpFile, osTmpFile);
+bool OGRPMTilesArchiveWriter::HasTileContent(const TileHash &abyHash) const
+{
+    return m_p->oMapMD5ToOffsetLen.find(abyHash) !=
+           m_p->oMapMD5ToOffsetLen.end();
+}
 
-    std::vector<pmtiles::entryv3> asPMTilesEntries;
-    uint64_t nLastTileId = 0;
-    uint64_t nFileOffset = 0;
-    std::array<unsigned char, 16> abyLastMD5;
-    std::unordered_map<std::array<unsigned char, 16>,
-                       std::pair<uint64_t, uint32_t>,
-                       HashArray<unsigned char, 16>>
-        oMapMD5ToOffsetLen;
-    for (const auto &sEntry : asTileEntries)
+/************************************************************************/
+/*                              AddTile()                               */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::AddTile(uint64_t nTileId, const void *pData,
+                                      size_t nSize)
+{
+    return AddTile(nTileId, ComputeHash(pData, nSize), pData, nSize);
+}
+
+/************************************************************************/
+/*                              AddTile()                               */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::AddTile(uint64_t nTileId,
+                                      const TileHash &abyHash,
+                                      const void *pData, size_t nSize)
+{
+    if (!m_p->poTmpFile)
+        return false;
+
+    // Tiles must be sorted by ascending tile_id. This is a requirement to
+    // build the PMTiles directories.
+    if (m_p->bHasLastTile && nTileId <= m_p->nLastTileId)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Tiles must be added by ascending tile id");
+        return false;
+    }
+
+    try
     {
-        if (sEntry.nTileId == nLastTileId + 1 && sEntry.abyMD5 == abyLastMD5)
+        if (m_p->bHasLastTile && nTileId == m_p->nLastTileId + 1 &&
+            abyHash == m_p->abyLastHash)
         {
             // If the tile id immediately follows the previous one and
             // has the same tile data, increase the run_length
-            asPMTilesEntries.back().run_length++;
+            m_p->asPMTilesEntries.back().run_length++;
         }
         else
         {
             pmtiles::entryv3 sPMTilesEntry;
-            sPMTilesEntry.tile_id = sEntry.nTileId;
+            sPMTilesEntry.tile_id = nTileId;
             sPMTilesEntry.run_length = 1;
 
-            auto oIter = oMapMD5ToOffsetLen.find(sEntry.abyMD5);
-            if (oIter != oMapMD5ToOffsetLen.end())
+            auto oIter = m_p->oMapMD5ToOffsetLen.find(abyHash);
+            if (oIter != m_p->oMapMD5ToOffsetLen.end())
             {
                 // Point to previously written tile data if this content
                 // has already been written
@@ -411,59 +376,59 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
             }
             else
             {
-                try
+                if (!pData || nSize > std::numeric_limits<uint32_t>::max())
                 {
-                    const auto sXYZ = pmtiles::tileid_to_zxy(sEntry.nTileId);
-                    poTilesLayer->SetAttributeFilter(CPLSPrintf(
-                        "zoom_level = %d AND tile_column = %u AND tile_row = "
-                        "%u",
-                        sXYZ.z, sXYZ.x, (1U << sXYZ.z) - 1U - sXYZ.y));
-                }
-                catch (const std::exception &e)
-                {
-                    // shouldn't happen given previous checks
                     CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot compute xyz: %s", e.what());
-                    return false;
-                }
-                poTilesLayer->ResetReading();
-                auto poFeature =
-                    std::unique_ptr<OGRFeature>(poTilesLayer->GetNextFeature());
-                if (!poFeature)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined, "Cannot find tile");
-                    return false;
-                }
-                int nTileDataLength = 0;
-                const GByte *pabyData =
-                    poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
-                if (!pabyData)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
+                             "Invalid tile data");
                     return false;
                 }
 
-                sPMTilesEntry.offset = nFileOffset;
-                sPMTilesEntry.length = nTileDataLength;
+                sPMTilesEntry.offset = m_p->nFileOffset;
+                sPMTilesEntry.length = static_cast<uint32_t>(nSize);
 
-                oMapMD5ToOffsetLen[sEntry.abyMD5] =
-                    std::pair<uint64_t, uint32_t>(nFileOffset, nTileDataLength);
+                m_p->oMapMD5ToOffsetLen[abyHash] =
+                    std::pair<uint64_t, uint32_t>(m_p->nFileOffset,
+                                                  sPMTilesEntry.length);
 
-                nFileOffset += nTileDataLength;
+                m_p->nFileOffset += nSize;
 
-                if (poTmpFile->Write(pabyData, nTileDataLength, 1) != 1)
+                if (m_p->poTmpFile->Write(pData, nSize, 1) != 1)
                 {
                     CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
                     return false;
                 }
             }
 
-            asPMTilesEntries.push_back(sPMTilesEntry);
-
-            nLastTileId = sEntry.nTileId;
-            abyLastMD5 = sEntry.abyMD5;
+            m_p->asPMTilesEntries.push_back(sPMTilesEntry);
         }
     }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Out of memory adding tile: %s", e.what());
+        return false;
+    }
+
+    m_p->bHasLastTile = true;
+    m_p->nLastTileId = nTileId;
+    m_p->abyLastHash = abyHash;
+    m_p->nAddressedTiles++;
+    return true;
+}
+
+/************************************************************************/
+/*                              Finish()                                */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::Finish(const CPLJSONObject &oMetadata)
+{
+    if (!m_p->poTmpFile)
+        return false;
+
+    pmtiles::headerv3 sHeader;
+    std::string osMetadata;
+    if (!BuildHeader(oMetadata, sHeader, osMetadata))
+        return false;
 
     const CPLCompressor *psCompressor = CPLGetCompressor("gzip");
     assert(psCompressor);
@@ -507,7 +472,7 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
         // Build the root and leave directories (one depth max)
         std::tie(osRootBytes, osLeaveBytes, nNumLeaves) =
             pmtiles::make_root_leaves(oCompressFunc, pmtiles::COMPRESSION_GZIP,
-                                      asPMTilesEntries);
+                                      m_p->asPMTilesEntries);
     }
     catch (const std::exception &e)
     {
@@ -527,29 +492,31 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
     sHeader.leaf_dirs_bytes = osLeaveBytes.size();
     sHeader.tile_data_offset =
         sHeader.leaf_dirs_offset + sHeader.leaf_dirs_bytes;
-    sHeader.tile_data_bytes = nFileOffset;
+    sHeader.tile_data_bytes = m_p->nFileOffset;
 
     // Nomber of tiles that are addressable in the PMTiles archive, that is
     // the number of tiles we would have if not deduplicating them
-    sHeader.addressed_tiles_count = asTileEntries.size();
+    sHeader.addressed_tiles_count = m_p->nAddressedTiles;
 
     // Number of tile entries in root and leave directories
     // ie entries whose run_length >= 1
-    sHeader.tile_entries_count = asPMTilesEntries.size();
+    sHeader.tile_entries_count = m_p->asPMTilesEntries.size();
 
     // Number of distinct tile blobs
-    sHeader.tile_contents_count = oMapMD5ToOffsetLen.size();
+    sHeader.tile_contents_count = m_p->oMapMD5ToOffsetLen.size();
 
     // Now build the final file!
-    auto poFile = VSIVirtualHandleUniquePtr(VSIFOpenL(pszDestName, "wb"));
+    auto poFile =
+        VSIVirtualHandleUniquePtr(VSIFOpenL(m_p->osDestName.c_str(), "wb"));
     if (!poFile)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
-                 pszDestName);
+                 m_p->osDestName.c_str());
         return false;
     }
     const auto osHeader = sHeader.serialize();
 
+    auto &poTmpFile = m_p->poTmpFile;
     if (poTmpFile->Seek(0, SEEK_SET) != 0 ||
         poFile->Write(osHeader.data(), osHeader.size(), 1) != 1 ||
         poFile->Write(osRootBytes.data(), osRootBytes.size(), 1) != 1 ||
@@ -565,8 +532,8 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
     // Copy content of the temporary file at end of the output file.
     std::string oCopyBuffer;
     oCopyBuffer.resize(1024 * 1024);
-    const uint64_t nTotalSize = nFileOffset;
-    nFileOffset = 0;
+    const uint64_t nTotalSize = m_p->nFileOffset;
+    uint64_t nFileOffset = 0;
     while (nFileOffset < nTotalSize)
     {
         const size_t nToRead = static_cast<size_t>(
@@ -585,3 +552,187 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
 
     return true;
 }
+
+/************************************************************************/
+/*                    OGRPMTilesConvertFromMBTiles()                    */
+/************************************************************************/
+
+bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
+                                  const char *pszSrcName)
+{
+    const char *const apszAllowedDrivers[] = {"SQLite", nullptr};
+    auto poSQLiteDS = std::unique_ptr<GDALDataset>(
+        GDALDataset::Open(pszSrcName, GDAL_OF_VECTOR, apszAllowedDrivers));
+    if (!poSQLiteDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot open %s with SQLite driver", pszSrcName);
+        return false;
+    }
+
+    CPLJSONObject oMetadata;
+    if (!ProcessMetadata(poSQLiteDS.get(), oMetadata))
+        return false;
+
+    // Validate metadata before processing tiles
+    {
+        pmtiles::headerv3 sHeader;
+        std::string osMetadata;
+        if (!BuildHeader(oMetadata, sHeader, osMetadata))
+            return false;
+    }
+
+    auto poTilesLayer = poSQLiteDS->GetLayerByName("tiles");
+    if (!poTilesLayer)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "tiles table not found");
+        return false;
+    }
+
+    const int iZoomLevel =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("zoom_level");
+    const int iTileColumn =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_column");
+    const int iTileRow =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_row");
+    const int iTileData =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_data");
+    if (iZoomLevel < 0 || iTileColumn < 0 || iTileRow < 0 || iTileData < 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Bad structure for tiles table");
+        return false;
+    }
+
+    struct TileEntry
+    {
+        uint64_t nTileId;
+        OGRPMTilesArchiveWriter::TileHash abyMD5;
+    };
+
+    // In a first step browse through the tiles table to compute the PMTiles
+    // tile_id of each tile, and compute a hash of the tile data for
+    // deduplication
+    std::vector<TileEntry> asTileEntries;
+    for (auto &&poFeature : poTilesLayer)
+    {
+        const int nZoomLevel = poFeature->GetFieldAsInteger(iZoomLevel);
+        if (nZoomLevel < 0 || nZoomLevel > 30)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid zoom_level");
+            continue;
+        }
+        const int nColumn = poFeature->GetFieldAsInteger(iTileColumn);
+        if (nColumn < 0 || nColumn >= (1 << nZoomLevel))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid tile_column");
+            continue;
+        }
+        const int nRow = poFeature->GetFieldAsInteger(iTileRow);
+        if (nRow < 0 || nRow >= (1 << nZoomLevel))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid tile_row");
+            continue;
+        }
+        // MBTiles uses a 0=bottom-most row, whereas PMTiles uses
+        // 0=top-most row
+        const int nY = (1 << nZoomLevel) - 1 - nRow;
+        uint64_t nTileId;
+        try
+        {
+            nTileId = pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZoomLevel),
+                                             nColumn, nY);
+        }
+        catch (const std::exception &e)
+        {
+            // shouldn't happen given previous checks
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute tile id: %s",
+                     e.what());
+            return false;
+        }
+        int nTileDataLength = 0;
+        const GByte *pabyData =
+            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
+        if (!pabyData)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
+            return false;
+        }
+
+        TileEntry sEntry;
+        sEntry.nTileId = nTileId;
+        sEntry.abyMD5 =
+            OGRPMTilesArchiveWriter::ComputeHash(pabyData, nTileDataLength);
+        try
+        {
+            asTileEntries.push_back(sEntry);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Out of memory browsing through tiles: %s", e.what());
+            return false;
+        }
+    }
+
+    // Sort the tiles by ascending tile_id. This is a requirement to build
+    // the PMTiles directories.
+    std::sort(asTileEntries.begin(), asTileEntries.end(),
+              [](const TileEntry &a, const TileEntry &b)
+              { return a.nTileId < b.nTileId; });
+
+    OGRPMTilesArchiveWriter oWriter;
+    if (!oWriter.Open(pszDestName))
+        return false;
+
+    for (const auto &sEntry : asTileEntries)
+    {
+        if (oWriter.HasTileContent(sEntry.abyMD5))
+        {
+            if (!oWriter.AddTile(sEntry.nTileId, sEntry.abyMD5, nullptr, 0))
+                return false;
+            continue;
+        }
+
+        try
+        {
+            const auto sXYZ = pmtiles::tileid_to_zxy(sEntry.nTileId);
+            poTilesLayer->SetAttributeFilter(CPLSPrintf(
+                "zoom_level = %d AND tile_column = %u AND tile_row = %u",
+                sXYZ.z, sXYZ.x, (1U << sXYZ.z) - 1U - sXYZ.y));
+        }
+        catch (const std::exception &e)
+        {
+            // shouldn't happen given previous checks
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute xyz: %s",
+                     e.what());
+            return false;
+        }
+        poTilesLayer->ResetReading();
+        auto poFeature =
+            std::unique_ptr<OGRFeature>(poTilesLayer->GetNextFeature());
+        if (!poFeature)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot find tile");
+            return false;
+        }
+        int nTileDataLength = 0;
+        const GByte *pabyData =
+            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
+        if (!pabyData)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
+            return false;
+        }
+
+        if (!oWriter.AddTile(sEntry.nTileId, sEntry.abyMD5, pabyData,
+                             static_cast<size_t>(nTileDataLength)))
+        {
+            return false;
+        }
+    }
+
+    return oWriter.Finish(oMetadata);
+}
@@ -30,8 +30,58 @@
 #define OGRPMTILESFROMMBTILES_H_INCLUDED
 
 #include "gdal_priv.h"
+#include "cpl_json.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
 
 bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
                                   const char *pszSrcName);
 
+/************************************************************************/
+/*                       OGRPMTilesArchiveWriter                        */
+/************************************************************************/
+
+/** Streaming writer of a vector PMTiles archive.
+ *
+ * Tiles must be added by ascending tile id. Tile data is appended to a
+ * temporary file, with consecutive identical tiles merged into a single
+ * run-length entry and identical contents deduplicated, and the final
+ * archive is assembled by Finish().
+ */
+class OGRPMTilesArchiveWriter
+{
+  public:
+    typedef std::array<unsigned char, 16> TileHash;
+
+    OGRPMTilesArchiveWriter();
+    ~OGRPMTilesArchiveWriter();
+
+    bool Open(const char *pszDestName);
+
+    static TileHash ComputeHash(const void *pData, size_t nSize);
+
+    //! Whether a tile with that content has already been added
+    bool HasTileContent(const TileHash &abyHash) const;
+
+    /** Add a tile. pData may be null if HasTileContent(abyHash) is true */
+    bool AddTile(uint64_t nTileId, const TileHash &abyHash, const void *pData,
+                 size_t nSize);
+
+    bool AddTile(uint64_t nTileId, const void *pData, size_t nSize);
+
+    /** Write the final archive, given a metadata object whose members are
+     * the MBTiles metadata items, with the ones from the "json" item expanded.
+     */
+    bool Finish(const CPLJSONObject &oMetadata);
+
+  private:
+    struct Private;
+    std::unique_ptr<Private> m_p;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesArchiveWriter)
+};
+
 #endif /* OGRPMTILESFROMMBTILES_H_INCLUDED */
@@ -33,6 +33,86 @@
 #include "mvtutils.h"
 #include "ogrpmtilesfrommbtiles.h"
 
+#include "include_pmtiles.h"
+
+/************************************************************************/
+/*                        OGRPMTilesMVTTileSink                         */
+/************************************************************************/
+
+namespace
+{
+/** Receives the tiles encoded by the MVT writer, by ascending tile id, and
+ * streams them into the PMTiles archive. */
+class OGRPMTilesMVTTileSink final : public OGRMVTTileSink
+{
+    OGRPMTilesArchiveWriter m_oWriter{};
+
+  public:
+    bool Open(const char *pszFilename)
+    {
+        return m_oWriter.Open(pszFilename);
+    }
+
+    uint64_t GetTileKey(int nZ, int nX, int nY) const override
+    {
+        return pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZ), nX, nY);
+    }
+
+    bool WriteTile(int nZ, int nX, int nY,
+                   const std::string &osTileData) override
+    {
+        return m_oWriter.AddTile(GetTileKey(nZ, nX, nY), osTileData.data(),
+                                 osTileData.size());
+    }
+
+    bool Finish(const CPLJSONObject &oMVTMetadata) override;
+};
+
+/************************************************************************/
+/*                              Finish()                                */
+/************************************************************************/
+
+bool OGRPMTilesMVTTileSink::Finish(const CPLJSONObject &oMVTMetadata)
+{
+    // Build the same object as from the metadata table of a MBTiles file:
+    // items as strings, with the members of the "json" item expanded.
+    CPLJSONObject oObj;
+    for (const auto &oChild : oMVTMetadata.GetChildren())
+    {
+        const auto osName = oChild.GetName();
+        if (osName == "json")
+        {
+            CPLJSONDocument oJsonDoc;
+            if (!oJsonDoc.LoadMemory(oChild.ToString()))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot parse 'json' metadata item");
+                return false;
+            }
+            for (const auto &oJsonChild : oJsonDoc.GetRoot().GetChildren())
+            {
+                oObj.Add(oJsonChild.GetName(), oJsonChild);
+            }
+        }
+        else if (oChild.GetType() == CPLJSONObject::Type::Integer ||
+                 oChild.GetType() == CPLJSONObject::Type::Long)
+        {
+            oObj.Add(osName, std::to_string(oChild.ToLong()));
+        }
+        else if (oChild.GetType() == CPLJSONObject::Type::Double)
+        {
+            oObj.Add(osName, CPLSPrintf("%.18g", oChild.ToDouble()));
+        }
+        else
+        {
+            oObj.Add(osName, oChild.ToString());
+        }
+    }
+    return m_oWriter.Finish(oObj);
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                     ~OGRPMTilesWriterDataset()                       */
 /************************************************************************/
@@ -51,24 +131,15 @@ CPLErr OGRPMTilesWriterDataset::Close()
     CPLErr eErr = CE_None;
     if (nOpenFlags != OPEN_FLAGS_CLOSED)
     {
-        if (m_poMBTilesWriterDataset)
+        if (m_poMVTWriterDataset)
         {
-            if (m_poMBTilesWriterDataset->Close() != CE_None)
+            // Tiles and metadata are written by the MVT writer into the
+            // PMTiles sink
+            if (m_poMVTWriterDataset->Close() != CE_None)
             {
                 eErr = CE_Failure;
             }
-            else
-            {
-                if (!OGRPMTilesConvertFromMBTiles(
-                        GetDescription(),
-                        m_poMBTilesWriterDataset->GetDescription()))
-                {
-                    eErr = CE_Failure;
-                }
-            }
-
-            VSIUnlink(m_poMBTilesWriterDataset->GetDescription());
-            m_poMBTilesWriterDataset.reset();
+            m_poMVTWriterDataset.reset();
         }
 
         if (GDALDataset::Close() != CE_None)
@@ -86,26 +157,19 @@ bool OGRPMTilesWriterDataset::Create(const char *pszFilename,
 {
     SetDescription(pszFilename);
     CPLStringList aosOptions(papszOptions);
-    aosOptions.SetNameValue("FORMAT", "MBTILES");
-
-    // Let's build a temporary file that contains the tile data in
-    // a way that corresponds to the "clustered" mode, that is
-    // "offsets are either contiguous with the previous offset+length, or
-    // refer to a lesser offset, when writing with deduplication."
-    std::string osTmpFile(pszFilename);
-    if (!VSIIsLocal(pszFilename))
-    {
-        osTmpFile = CPLGenerateTempFilename(CPLGetFilename(pszFilename));
-    }
-    osTmpFile += ".tmp.mbtiles";
 
     if (!aosOptions.FetchNameValue("NAME"))
         aosOptions.SetNameValue("NAME", CPLGetBasename(pszFilename));
 
-    m_poMBTilesWriterDataset.reset(OGRMVTWriterDatasetCreate(
-        osTmpFile.c_str(), 0, 0, 0, GDT_Unknown, aosOptions.List()));
+    auto poTileSink = std::make_unique<OGRPMTilesMVTTileSink>();
+    if (!poTileSink->Open(pszFilename))
+        return false;
+
+    m_poMVTWriterDataset.reset(
+        OGRMVTWriterDatasetCreate(pszFilename, 0, 0, 0, GDT_Unknown,
+                                  aosOptions.List(), std::move(poTileSink)));
 
-    return m_poMBTilesWriterDataset != nullptr;
+    return m_poMVTWriterDataset != nullptr;
 }
 
 /************************************************************************/
@@ -117,8 +181,8 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
                                       const OGRGeomFieldDefn *poGeomFieldDefn,
                                       CSLConstList papszOptions)
 {
-    return m_poMBTilesWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
-                                                 papszOptions);
+    return m_poMVTWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
+                                             papszOptions);
 }
 
 /************************************************************************/
@@ -127,7 +191,7 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
 
 int OGRPMTilesWriterDataset::TestCapability(const char *pszCap)
 {
-    return m_poMBTilesWriterDataset->TestCapability(pszCap);
+    return m_poMVTWriterDataset->TestCapability(pszCap);
 }
 
 #endif  // HAVE_MVT_WRITE_SUPPORT
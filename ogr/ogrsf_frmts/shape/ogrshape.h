@@ -49,6 +49,8 @@
 /* #5052 ) */
 #define OGR_DBF_MAX_FIELD_WIDTH 254
 
+class OGRArrowArrayHelper;
+
 /* ==================================================================== */
 /*      Functions from Shape2ogr.cpp.                                   */
 /* ==================================================================== */
@@ -58,6 +60,10 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               bool &bHasWarnedWrongWindingOrder);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                               bool &bHasWarnedWrongWindingOrder);
+bool SHPReadOGRObjectAsWKB(SHPHandle hSHP, int iShape,
+                           OGRwkbGeometryType eLayerGeomType,
+                           std::vector<GByte> &abyWKB,
+                           bool &bHasWarnedWrongWindingOrder);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
                                       DBFHandle hDBF,
                                       const char *pszSHPEncoding,
@@ -191,6 +197,11 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     bool m_bHasWarnedWrongWindingOrder = false;
     bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
 
+    bool
+    FillArrowArrayFromDBFRecords(OGRArrowArrayHelper &sHelper, int iField,
+                                 const std::vector<const char *> &apszRecords,
+                                 int iFeatStart, int nRecords);
+
     bool m_bAutoRepack;
 
     typedef enum
@@ -3866,12 +3866,221 @@ GDALDataset *OGRShapeLayer::GetDataset()
     return poDS;
 }
 
+/************************************************************************/
+/*                        GetTrimmedDBFValue()                          */
+/************************************************************************/
+
+// Extract the value of a DBF field from a raw record, with leading and
+// trailing spaces removed, as DBFReadStringAttribute() does.
+static const char *GetTrimmedDBFValue(const char *pszField, int nWidth,
+                                      char *pszBuffer, size_t &nLen)
+{
+    int nStart = 0;
+    while (nStart < nWidth && pszField[nStart] == ' ')
+        ++nStart;
+    int nEnd = nStart;
+    while (nEnd < nWidth && pszField[nEnd] != '\0')
+        ++nEnd;
+    while (nEnd > nStart && pszField[nEnd - 1] == ' ')
+        --nEnd;
+    nLen = static_cast<size_t>(nEnd - nStart);
+    memcpy(pszBuffer, pszField + nStart, nLen);
+    pszBuffer[nLen] = '\0';
+    return pszBuffer;
+}
+
+/************************************************************************/
+/*                          IsDBFValueNull()                            */
+/************************************************************************/
+
+// Must be kept consistent with DBFIsValueNULL() from dbfopen.c
+static bool IsDBFValueNull(char chType, const char *pszValue)
+{
+    switch (chType)
+    {
+        case 'N':
+        case 'F':
+            // Value is trimmed, so all blanks means empty
+            return pszValue[0] == '*' || pszValue[0] == '\0';
+
+        case 'D':
+            return strncmp(pszValue, "00000000", 8) == 0 ||
+                   strcmp(pszValue, " ") == 0 || strcmp(pszValue, "0") == 0;
+
+        case 'L':
+            return pszValue[0] == '?';
+
+        default:
+            return pszValue[0] == '\0';
+    }
+}
+
+/************************************************************************/
+/*                   FillArrowArrayFromDBFRecords()                     */
+/************************************************************************/
+
+// Decode column iField of nRecords raw DBF records into the corresponding
+// child of the Arrow array, starting at feature index iFeatStart.
+// The decoding logic mirrors SHPReadOGRFeature().
+bool OGRShapeLayer::FillArrowArrayFromDBFRecords(
+    OGRArrowArrayHelper &sHelper, int iField,
+    const std::vector<const char *> &apszRecords, int iFeatStart,
+    int nRecords)
+{
+    static int bWarn = -1;
+    if (bWarn < 0)
+        bWarn = CPLTestBool(
+            CPLGetConfigOption("OGR_SETFIELD_NUMERIC_WARNING", "YES"));
+
+    const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iField];
+    auto psArray = sHelper.m_out_array->children[iArrowField];
+    const OGRFieldDefn *poFieldDefn = poFeatureDefn->GetFieldDefn(iField);
+    const OGRFieldType eType = poFieldDefn->GetType();
+    const bool bIsBoolean = poFieldDefn->GetSubType() == OFSTBoolean;
+    const int nFieldOffset = hDBF->panFieldOffset[iField];
+    const int nFieldWidth = hDBF->panFieldSize[iField];
+    const char chDBFType = hDBF->pachFieldType[iField];
+    std::vector<char> achBuffer(nFieldWidth + 1);
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    for (int i = 0; i < nRecords; ++i)
+    {
+        const int iFeat = iFeatStart + i;
+        size_t nLen = 0;
+        const char *pszVal =
+            GetTrimmedDBFValue(apszRecords[i] + nFieldOffset, nFieldWidth,
+                               achBuffer.data(), nLen);
+
+        if (eType == OFTString)
+        {
+            if (nLen == 0)
+            {
+                if (!sHelper.SetNull(iArrowField, iFeat))
+                    return false;
+                continue;
+            }
+            char *pszUTF8 = nullptr;
+            if (!osEncoding.empty())
+            {
+                pszUTF8 = CPLRecode(pszVal, osEncoding, CPL_ENC_UTF8);
+                pszVal = pszUTF8;
+                nLen = strlen(pszUTF8);
+            }
+            GByte *outPtr =
+                sHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nLen);
+            if (outPtr)
+                memcpy(outPtr, pszVal, nLen);
+            CPLFree(pszUTF8);
+            if (outPtr == nullptr)
+                return false;
+            continue;
+        }
+
+        if (IsDBFValueNull(chDBFType, pszVal))
+        {
+            if (!sHelper.SetNull(iArrowField, iFeat))
+                return false;
+            continue;
+        }
+
+        switch (eType)
+        {
+            case OFTInteger:
+            {
+                if (bIsBoolean)
+                {
+                    if (pszVal[0] == 'T' || pszVal[0] == 't' ||
+                        pszVal[0] == 'Y' || pszVal[0] == 'y')
+                    {
+                        OGRArrowArrayHelper::SetBoolOn(psArray, iFeat);
+                    }
+                }
+                else
+                {
+                    errno = 0;
+                    char *pszLast = nullptr;
+                    const long long nVal64 =
+                        std::strtoll(pszVal, &pszLast, 10);
+                    const int nVal32 =
+                        nVal64 > INT_MAX   ? INT_MAX
+                        : nVal64 < INT_MIN ? INT_MIN
+                                           : static_cast<int>(nVal64);
+                    if (bWarn && (errno == ERANGE || nVal32 != nVal64 ||
+                                  !pszLast || *pszLast))
+                    {
+                        CPLError(CE_Warning, CPLE_AppDefined,
+                                 "Value '%s' of field %s.%s parsed "
+                                 "incompletely to integer %d.",
+                                 pszVal, poFeatureDefn->GetName(),
+                                 poFieldDefn->GetNameRef(), nVal32);
+                    }
+                    OGRArrowArrayHelper::SetInt32(psArray, iFeat, nVal32);
+                }
+                break;
+            }
+
+            case OFTInteger64:
+            {
+                OGRArrowArrayHelper::SetInt64(
+                    psArray, iFeat, CPLAtoGIntBigEx(pszVal, bWarn, nullptr));
+                break;
+            }
+
+            case OFTReal:
+            {
+                char *pszLast = nullptr;
+                const double dfVal = CPLStrtod(pszVal, &pszLast);
+                if (bWarn && (!pszLast || *pszLast))
+                {
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "Value '%s' of field %s.%s parsed incompletely "
+                             "to real %.16g.",
+                             pszVal, poFeatureDefn->GetName(),
+                             poFieldDefn->GetNameRef(), dfVal);
+                }
+                OGRArrowArrayHelper::SetDouble(psArray, iFeat, dfVal);
+                break;
+            }
+
+            case OFTDate:
+            {
+                OGRField sFld;
+                memset(&sFld, 0, sizeof(sFld));
+                if (nLen >= 10 && pszVal[2] == '/' && pszVal[5] == '/')
+                {
+                    sFld.Date.Month = static_cast<GByte>(atoi(pszVal + 0));
+                    sFld.Date.Day = static_cast<GByte>(atoi(pszVal + 3));
+                    sFld.Date.Year = static_cast<GInt16>(atoi(pszVal + 6));
+                }
+                else
+                {
+                    const int nFullDate = atoi(pszVal);
+                    sFld.Date.Year = static_cast<GInt16>(nFullDate / 10000);
+                    sFld.Date.Month =
+                        static_cast<GByte>((nFullDate / 100) % 100);
+                    sFld.Date.Day = static_cast<GByte>(nFullDate % 100);
+                }
+                OGRArrowArrayHelper::SetDate(psArray, iFeat, brokenDown, sFld);
+                break;
+            }
+
+            default:
+                CPLAssert(false);
+                break;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                        GetNextArrowArray()                           */
 /************************************************************************/
 
-// Specialized implementation restricted to situations where only retrieving
-// of FID values is asked (without filters)
+// Specialized implementation that reads DBF records by blocks, decodes
+// them column by column, and translates SHP records directly to WKB.
+// Restricted to situations without filters and where all requested fields
+// are of a type that can be decoded from the raw DBF record.
 // In other cases, fall back to generic implementation.
 int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                      struct ArrowArray *out_array)
@@ -3883,21 +4092,39 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
-    if (!hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
+    // bCurrentRecordModified: pending write in the shapelib record buffer
+    if (!hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        hDBF->bNoHeader || hDBF->bCurrentRecordModified)
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
 
-    // If any field is not ignored, use generic implementation
     const int nFieldCount = poFeatureDefn->GetFieldCount();
     for (int i = 0; i < nFieldCount; ++i)
     {
-        if (!poFeatureDefn->GetFieldDefn(i)->IsIgnored())
+        const auto poFieldDefn = poFeatureDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            continue;
+        const auto eType = poFieldDefn->GetType();
+        const auto eSubType = poFieldDefn->GetSubType();
+        if (!((eType == OFTInteger &&
+               (eSubType == OFSTNone || eSubType == OFSTBoolean)) ||
+              ((eType == OFTInteger64 || eType == OFTReal ||
+                eType == OFTString) &&
+               eSubType == OFSTNone) ||
+              eType == OFTDate))
+        {
             return OGRLayer::GetNextArrowArray(stream, out_array);
+        }
     }
-    if (GetGeomType() != wkbNone &&
-        !poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
+    const bool bReadGeometry =
+        GetGeomType() != wkbNone &&
+        !poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored();
+    if (bReadGeometry &&
+        (hSHP == nullptr || !poFeatureDefn->GetGeomFieldDefn(0)->IsNullable()))
+    {
         return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
 
     OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
                                 m_aosArrowArrayStreamOptions, out_array);
@@ -3906,33 +4133,145 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return ENOMEM;
     }
 
-    if (!sHelper.m_bIncludeFID)
+    if (sHelper.m_nChildren == 0)
+    {
+        out_array->release(out_array);
         return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
 
     m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    const int iGeomArrowField =
+        bReadGeometry ? sHelper.m_mapOGRGeomFieldToArrowField[0] : -1;
+    const OGRwkbGeometryType eLayerGeomType = GetGeomType();
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    const int nRecordLength = hDBF->nRecordLength;
+    // Records beyond the end of the .dbf are considered as deleted.
+    const int nDBFRecords = std::min(nTotalShapeCount, hDBF->nRecords);
+    // Read DBF records by blocks of about 1 MB
+    constexpr int DBF_BLOCK_SIZE = 1024 * 1024;
+    const int nMaxRecordsInBlock = std::max(1, DBF_BLOCK_SIZE / nRecordLength);
+
+    std::vector<GByte> abyRecords;
+    std::vector<const char *> apszRecords;
+    std::vector<int> anShapeIds;
+    std::vector<GByte> abyWKB;
+
+    const auto ReturnError = [out_array](int nErrno)
+    {
+        out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+        return nErrno;
+    };
+
     int nCount = 0;
-    while (iNextShapeId < nTotalShapeCount)
+    bool bMemLimitReached = false;
+    while (nCount < sHelper.m_nMaxBatchSize && !bMemLimitReached)
     {
-        const bool bIsDeleted =
-            CPL_TO_BOOL(DBFIsRecordDeleted(hDBF, iNextShapeId));
-        if (bIsDeleted)
+        if (iNextShapeId >= nDBFRecords)
         {
-            ++iNextShapeId;
-            continue;
+            iNextShapeId = std::max(iNextShapeId, nTotalShapeCount);
+            break;
         }
-        if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)) ||
-            VSIFErrorL(VSI_SHP_GetVSIL(hDBF->fp)))
+
+        const int nToRead =
+            std::min(std::min(nMaxRecordsInBlock,
+                              sHelper.m_nMaxBatchSize - nCount),
+                     nDBFRecords - iNextShapeId);
+        abyRecords.resize(static_cast<size_t>(nToRead) * nRecordLength);
+        const SAOffset nOffset =
+            static_cast<SAOffset>(hDBF->nHeaderLength) +
+            static_cast<SAOffset>(iNextShapeId) * nRecordLength;
+        // We move the file pointer behind the back of shapelib.
+        hDBF->bRequireNextWriteSeek = TRUE;
+        if (hDBF->sHooks.FSeek(hDBF->fp, nOffset, SEEK_SET) != 0 ||
+            hDBF->sHooks.FRead(abyRecords.data(), nRecordLength, nToRead,
+                               hDBF->fp) != static_cast<SAOffset>(nToRead))
         {
-            out_array->release(out_array);
-            memset(out_array, 0, sizeof(*out_array));
-            return EIO;
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read DBF records %d to %d", iNextShapeId,
+                     iNextShapeId + nToRead - 1);
+            return ReturnError(EIO);
         }
-        sHelper.m_panFIDValues[nCount] = iNextShapeId;
-        ++iNextShapeId;
-        ++nCount;
-        if (nCount == sHelper.m_nMaxBatchSize)
-            break;
+
+        apszRecords.clear();
+        anShapeIds.clear();
+        for (int i = 0; i < nToRead; ++i)
+        {
+            const char *pszRecord =
+                reinterpret_cast<const char *>(abyRecords.data()) +
+                static_cast<size_t>(i) * nRecordLength;
+            // '*' means deleted
+            if (pszRecord[0] != '*')
+            {
+                apszRecords.push_back(pszRecord);
+                anShapeIds.push_back(iNextShapeId + i);
+            }
+        }
+        int nBlockCount = static_cast<int>(anShapeIds.size());
+        int nNextShapeIdAfterBlock = iNextShapeId + nToRead;
+
+        // Geometries first, as they can cause the batch to be truncated
+        if (iGeomArrowField >= 0)
+        {
+            auto psArray = out_array->children[iGeomArrowField];
+            for (int i = 0; i < nBlockCount; ++i)
+            {
+                const int iFeat = nCount + i;
+                if (!SHPReadOGRObjectAsWKB(hSHP, anShapeIds[i], eLayerGeomType,
+                                           abyWKB,
+                                           m_bHasWarnedWrongWindingOrder))
+                {
+                    if (!sHelper.SetNull(iGeomArrowField, iFeat))
+                        return ReturnError(ENOMEM);
+                    continue;
+                }
+
+                const size_t nWKBSize = abyWKB.size();
+                if (iFeat > 0)
+                {
+                    auto panOffsets = static_cast<int32_t *>(
+                        const_cast<void *>(psArray->buffers[1]));
+                    const uint32_t nCurLength =
+                        static_cast<uint32_t>(panOffsets[iFeat]);
+                    if (nWKBSize <= nMemLimit &&
+                        nWKBSize > nMemLimit - nCurLength)
+                    {
+                        nBlockCount = i;
+                        nNextShapeIdAfterBlock = anShapeIds[i];
+                        bMemLimitReached = true;
+                        break;
+                    }
+                }
+
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iGeomArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                    return ReturnError(ENOMEM);
+                memcpy(outPtr, abyWKB.data(), nWKBSize);
+            }
+        }
+
+        if (sHelper.m_bIncludeFID)
+        {
+            for (int i = 0; i < nBlockCount; ++i)
+                sHelper.m_panFIDValues[nCount + i] = anShapeIds[i];
+        }
+
+        for (int iField = 0; iField < nFieldCount; ++iField)
+        {
+            if (sHelper.m_mapOGRFieldToArrowField[iField] >= 0 &&
+                !FillArrowArrayFromDBFRecords(sHelper, iField, apszRecords,
+                                              nCount, nBlockCount))
+            {
+                return ReturnError(ENOMEM);
+            }
+        }
+
+        nCount += nBlockCount;
+        iNextShapeId = nNextShapeIdAfterBlock;
     }
+
     sHelper.Shrink(nCount);
     if (nCount == 0)
     {
@@ -1290,6 +1290,279 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
     return poDefn;
 }
 
+/************************************************************************/
+/*                     SHPSetOGRGeometryDimension()                     */
+/*                                                                      */
+/*      Make the dimension of a geometry consistent with the one of     */
+/*      the layer geometry type.                                        */
+/************************************************************************/
+
+static void SHPSetOGRGeometryDimension(OGRGeometry *poGeometry,
+                                       OGRwkbGeometryType eLayerGeomType)
+{
+    if (eLayerGeomType == wkbUnknown)
+        return;
+
+    const OGRwkbGeometryType eGeomInType = poGeometry->getGeometryType();
+    if (wkbHasZ(eLayerGeomType) && !wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(TRUE);
+    }
+    else if (!wkbHasZ(eLayerGeomType) && wkbHasZ(eGeomInType))
+    {
+        poGeometry->set3D(FALSE);
+    }
+    if (wkbHasM(eLayerGeomType) && !wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(TRUE);
+    }
+    else if (!wkbHasM(eLayerGeomType) && wkbHasM(eGeomInType))
+    {
+        poGeometry->setMeasured(FALSE);
+    }
+}
+
+/************************************************************************/
+/*                           SHPWKBWriter                               */
+/************************************************************************/
+
+namespace
+{
+struct SHPWKBWriter
+{
+    const SHPObject *psShape = nullptr;
+    bool bOutHasZ = false;
+    bool bOutHasM = false;
+    bool bShapeHasZ = false;
+    bool bShapeHasM = false;
+    GByte *pabyCur = nullptr;
+
+    size_t GetPointSize() const
+    {
+        return sizeof(double) * (2 + (bOutHasZ ? 1 : 0) + (bOutHasM ? 1 : 0));
+    }
+
+    void WriteUInt32(uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        memcpy(pabyCur, &nVal, sizeof(nVal));
+        pabyCur += sizeof(nVal);
+    }
+
+    void WriteDouble(double dfVal)
+    {
+        CPL_LSBPTR64(&dfVal);
+        memcpy(pabyCur, &dfVal, sizeof(dfVal));
+        pabyCur += sizeof(dfVal);
+    }
+
+    void WriteHeader(OGRwkbGeometryType eFlatType)
+    {
+        *pabyCur = wkbNDR;
+        ++pabyCur;
+        WriteUInt32(static_cast<uint32_t>(eFlatType) +
+                    (bOutHasZ ? 1000 : 0) + (bOutHasM ? 2000 : 0));
+    }
+
+    void WritePoints(int nStart, int nPoints)
+    {
+        for (int i = nStart; i < nStart + nPoints; ++i)
+        {
+            WriteDouble(psShape->padfX[i]);
+            WriteDouble(psShape->padfY[i]);
+            if (bOutHasZ)
+                WriteDouble(bShapeHasZ ? psShape->padfZ[i] : 0.0);
+            if (bOutHasM)
+                WriteDouble(bShapeHasM ? psShape->padfM[i] : 0.0);
+        }
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                       SHPReadOGRObjectAsWKB()                        */
+/*                                                                      */
+/*      Read an item in a shapefile, and translate it to ISO WKB, in    */
+/*      little-endian order, with the dimension of the layer geometry  */
+/*      type. Points, multipoints, lines and single-part polygons are   */
+/*      directly encoded from the shape vertices. Other shapes, such    */
+/*      as multi-part polygons that require ring analysis, go through   */
+/*      SHPReadOGRObject().                                             */
+/*      Returns false if the shape has no geometry.                     */
+/************************************************************************/
+
+bool SHPReadOGRObjectAsWKB(SHPHandle hSHP, int iShape,
+                           OGRwkbGeometryType eLayerGeomType,
+                           std::vector<GByte> &abyWKB,
+                           bool &bHasWarnedWrongWindingOrder)
+{
+    SHPObject *psShape = SHPReadObject(hSHP, iShape);
+    if (psShape == nullptr)
+        return false;
+
+    const int nSHPType = psShape->nSHPType;
+    const bool bIsZ =
+        nSHPType == SHPT_POINTZ || nSHPType == SHPT_MULTIPOINTZ ||
+        nSHPType == SHPT_ARCZ || nSHPType == SHPT_POLYGONZ;
+    const bool bIsM =
+        nSHPType == SHPT_POINTM || nSHPType == SHPT_MULTIPOINTM ||
+        nSHPType == SHPT_ARCM || nSHPType == SHPT_POLYGONM;
+
+    SHPWKBWriter oWriter;
+    oWriter.psShape = psShape;
+    oWriter.bOutHasZ = wkbHasZ(eLayerGeomType) != FALSE;
+    oWriter.bOutHasM = wkbHasM(eLayerGeomType) != FALSE;
+    oWriter.bShapeHasZ = bIsZ && psShape->padfZ != nullptr;
+    // Consistent with the M handling of SHPReadOGRObject()
+    oWriter.bShapeHasM = psShape->padfM != nullptr &&
+                         (bIsM || (bIsZ && (nSHPType != SHPT_POINTZ ||
+                                            psShape->bMeasureIsUsed)));
+    const size_t nPointSize = oWriter.GetPointSize();
+    constexpr size_t HEADER_SIZE = 1 + sizeof(uint32_t);
+
+    bool bDirect = eLayerGeomType != wkbUnknown;
+    if (bDirect && (nSHPType == SHPT_POINT || nSHPType == SHPT_POINTZ ||
+                    nSHPType == SHPT_POINTM))
+    {
+        if (psShape->nVertices < 1)
+        {
+            bDirect = false;
+        }
+        else
+        {
+            abyWKB.resize(HEADER_SIZE + nPointSize);
+            oWriter.pabyCur = abyWKB.data();
+            oWriter.WriteHeader(wkbPoint);
+            oWriter.WritePoints(0, 1);
+        }
+    }
+    else if (bDirect &&
+             (nSHPType == SHPT_MULTIPOINT || nSHPType == SHPT_MULTIPOINTZ ||
+              nSHPType == SHPT_MULTIPOINTM))
+    {
+        const int nPoints = psShape->nVertices;
+        if (nPoints == 0)
+        {
+            SHPDestroyObject(psShape);
+            return false;
+        }
+        abyWKB.resize(HEADER_SIZE + sizeof(uint32_t) +
+                      nPoints * (HEADER_SIZE + nPointSize));
+        oWriter.pabyCur = abyWKB.data();
+        oWriter.WriteHeader(wkbMultiPoint);
+        oWriter.WriteUInt32(static_cast<uint32_t>(nPoints));
+        for (int i = 0; i < nPoints; ++i)
+        {
+            oWriter.WriteHeader(wkbPoint);
+            oWriter.WritePoints(i, 1);
+        }
+    }
+    else if (bDirect && (nSHPType == SHPT_ARC || nSHPType == SHPT_ARCZ ||
+                         nSHPType == SHPT_ARCM))
+    {
+        const int nParts = psShape->nParts;
+        if (nParts == 0)
+        {
+            SHPDestroyObject(psShape);
+            return false;
+        }
+        else if (nParts == 1)
+        {
+            const int nPoints = psShape->nVertices;
+            abyWKB.resize(HEADER_SIZE + sizeof(uint32_t) +
+                          nPoints * nPointSize);
+            oWriter.pabyCur = abyWKB.data();
+            oWriter.WriteHeader(wkbLineString);
+            oWriter.WriteUInt32(static_cast<uint32_t>(nPoints));
+            oWriter.WritePoints(0, nPoints);
+        }
+        else
+        {
+            const auto GetPartStartAndCount =
+                [psShape](int iPart, int &nStart, int &nPoints)
+            {
+                if (psShape->panPartStart == nullptr)
+                {
+                    nStart = 0;
+                    nPoints = psShape->nVertices;
+                }
+                else
+                {
+                    nStart = psShape->panPartStart[iPart];
+                    nPoints = (iPart == psShape->nParts - 1
+                                   ? psShape->nVertices
+                                   : psShape->panPartStart[iPart + 1]) -
+                              nStart;
+                }
+            };
+
+            size_t nSize = HEADER_SIZE + sizeof(uint32_t);
+            for (int iPart = 0; iPart < nParts; ++iPart)
+            {
+                int nStart = 0;
+                int nPoints = 0;
+                GetPartStartAndCount(iPart, nStart, nPoints);
+                nSize += HEADER_SIZE + sizeof(uint32_t) + nPoints * nPointSize;
+            }
+            abyWKB.resize(nSize);
+            oWriter.pabyCur = abyWKB.data();
+            oWriter.WriteHeader(wkbMultiLineString);
+            oWriter.WriteUInt32(static_cast<uint32_t>(nParts));
+            for (int iPart = 0; iPart < nParts; ++iPart)
+            {
+                int nStart = 0;
+                int nPoints = 0;
+                GetPartStartAndCount(iPart, nStart, nPoints);
+                oWriter.WriteHeader(wkbLineString);
+                oWriter.WriteUInt32(static_cast<uint32_t>(nPoints));
+                oWriter.WritePoints(nStart, nPoints);
+            }
+        }
+    }
+    else if (bDirect &&
+             (nSHPType == SHPT_POLYGON || nSHPType == SHPT_POLYGONZ ||
+              nSHPType == SHPT_POLYGONM) &&
+             psShape->nParts <= 1)
+    {
+        if (psShape->nParts == 0)
+        {
+            SHPDestroyObject(psShape);
+            return false;
+        }
+        int nRingStart = 0;
+        int nRingEnd = 0;
+        RingStartEnd(psShape, 0, &nRingStart, &nRingEnd);
+        const int nPoints = std::max(0, nRingEnd - nRingStart + 1);
+        abyWKB.resize(HEADER_SIZE + 2 * sizeof(uint32_t) +
+                      nPoints * nPointSize);
+        oWriter.pabyCur = abyWKB.data();
+        oWriter.WriteHeader(wkbPolygon);
+        oWriter.WriteUInt32(1);
+        oWriter.WriteUInt32(static_cast<uint32_t>(nPoints));
+        oWriter.WritePoints(nRingStart, nPoints);
+    }
+    else
+    {
+        bDirect = false;
+    }
+
+    if (bDirect)
+    {
+        SHPDestroyObject(psShape);
+        return true;
+    }
+
+    // Takes ownership of psShape
+    std::unique_ptr<OGRGeometry> poGeometry(SHPReadOGRObject(
+        hSHP, iShape, psShape, bHasWarnedWrongWindingOrder));
+    if (!poGeometry)
+        return false;
+    SHPSetOGRGeometryDimension(poGeometry.get(), eLayerGeomType);
+    abyWKB.resize(poGeometry->WkbSize());
+    poGeometry->exportToWkb(wkbNDR, abyWKB.data(), wkbVariantIso);
+    return true;
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
 /************************************************************************/
@@ -1344,30 +1617,9 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
             if (poGeometry)
             {
                 // Set/unset flags.
-                const OGRwkbGeometryType eMyGeomType =
-                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType();
-
-                if (eMyGeomType != wkbUnknown)
-                {
-                    OGRwkbGeometryType eGeomInType =
-                        poGeometry->getGeometryType();
-                    if (wkbHasZ(eMyGeomType) && !wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(TRUE);
-                    }
-                    else if (!wkbHasZ(eMyGeomType) && wkbHasZ(eGeomInType))
-                    {
-                        poGeometry->set3D(FALSE);
-                    }
-                    if (wkbHasM(eMyGeomType) && !wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(TRUE);
-                    }
-                    else if (!wkbHasM(eMyGeomType) && wkbHasM(eGeomInType))
-                    {
-                        poGeometry->setMeasured(FALSE);
-                    }
-                }
+                SHPSetOGRGeometryDimension(
+                    poGeometry,
+                    poFeature->GetDefnRef()->GetGeomFieldDefn(0)->GetType());
             }
 
             poFeature->SetGeometryDirectly(poGeometry);
@@ -237,6 +237,9 @@ class OGRVRTDataSource final : public OGRDataSource
     OGRLayer *InstantiateUnionLayer(CPLXMLNode *psLTree,
                                     const char *pszVRTDirectory, int bUpdate,
                                     int nRecLevel);
+    OGRLayer *InstantiateSpatialIndexedLayer(CPLXMLNode *psLTree,
+                                             const char *pszVRTDirectory,
+                                             int bUpdate, int nRecLevel);
 
     OGRLayerPool *poLayerPool;
 
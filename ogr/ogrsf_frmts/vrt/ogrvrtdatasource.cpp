@@ -45,6 +45,7 @@
 #include "ogr_feature.h"
 #include "ogr_spatialref.h"
 #include "ogrlayerpool.h"
+#include "ogrspatialindexedlayer.h"
 #include "ogrunionlayer.h"
 #include "ogrwarpedlayer.h"
 #include "ogrsf_frmts.h"
@@ -349,6 +350,82 @@ OGRLayer *OGRVRTDataSource::InstantiateWarpedLayer(CPLXMLNode *psLTree,
     return poLayer;
 }
 
+/************************************************************************/
+/*                   InstantiateSpatialIndexedLayer()                   */
+/************************************************************************/
+
+OGRLayer *OGRVRTDataSource::InstantiateSpatialIndexedLayer(
+    CPLXMLNode *psLTree, const char *pszVRTDirectory, int bUpdate,
+    int nRecLevel)
+{
+    if (!EQUAL(psLTree->pszValue, "OGRVRTSpatialIndexedLayer"))
+        return nullptr;
+
+    OGRLayer *poSrcLayer = nullptr;
+
+    for (CPLXMLNode *psSubNode = psLTree->psChild; psSubNode != nullptr;
+         psSubNode = psSubNode->psNext)
+    {
+        if (psSubNode->eType != CXT_Element)
+            continue;
+
+        poSrcLayer = InstantiateLayer(psSubNode, pszVRTDirectory, bUpdate,
+                                      nRecLevel + 1);
+        if (poSrcLayer != nullptr)
+            break;
+    }
+
+    if (poSrcLayer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot instantiate source layer");
+        return nullptr;
+    }
+
+    const char *pszGeomFieldName =
+        CPLGetXMLValue(psLTree, "IndexedGeomFieldName", nullptr);
+    int iGeomField = 0;
+    if (pszGeomFieldName != nullptr)
+    {
+        iGeomField =
+            poSrcLayer->GetLayerDefn()->GetGeomFieldIndex(pszGeomFieldName);
+        if (iGeomField < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot find source geometry field '%s'",
+                     pszGeomFieldName);
+            delete poSrcLayer;
+            return nullptr;
+        }
+    }
+
+    std::string osIndexFilename = CPLGetXMLValue(psLTree, "IndexFile", "");
+    if (!osIndexFilename.empty() &&
+        CPLTestBool(CPLGetXMLValue(psLTree, "IndexFile.relativeToVRT", "0")))
+    {
+        osIndexFilename = CPLProjectRelativeFilename(pszVRTDirectory,
+                                                     osIndexFilename.c_str());
+    }
+
+    // The staleness of the index file is checked against the file of the
+    // dataset of the source layer, not against the VRT file.
+    std::string osSourceFilename;
+    if (auto poVRTLayer = dynamic_cast<OGRVRTLayer *>(poSrcLayer))
+    {
+        if (GDALDataset *poSrcDS = poVRTLayer->GetSrcDataset())
+            osSourceFilename = poSrcDS->GetDescription();
+    }
+
+    // Writing a file whose name comes from the VRT file must be explicitly
+    // allowed by the user.
+    const bool bWriteIndexFile = CPLTestBool(
+        CPLGetConfigOption("OGR_VRT_WRITE_SPATIAL_INDEX_FILE", "NO"));
+
+    return new OGRSpatialIndexedLayer(poSrcLayer, /* bTakeOwnership = */ true,
+                                      iGeomField, osIndexFilename,
+                                      bWriteIndexFile, osSourceFilename);
+}
+
 /************************************************************************/
 /*                        InstantiateUnionLayer()                       */
 /************************************************************************/
@@ -754,6 +831,12 @@ OGRVRTDataSource::InstantiateLayerInternal(CPLXMLNode *psLTree,
         return InstantiateUnionLayer(psLTree, pszVRTDirectory, bUpdate,
                                      nRecLevel + 1);
     }
+    else if (EQUAL(psLTree->pszValue, "OGRVRTSpatialIndexedLayer") &&
+             nRecLevel < 30)
+    {
+        return InstantiateSpatialIndexedLayer(psLTree, pszVRTDirectory, bUpdate,
+                                              nRecLevel + 1);
+    }
 
     return nullptr;
 }
@@ -3807,6 +3807,25 @@ static void RemoveIDFromMemberOfEnsembles(CPLJSONObject &obj)
     }
 }
 
+/************************************************************************/
+/*                     OSRCreatePJFromDefinition()                      */
+/************************************************************************/
+
+// proj_create() with caching of the resulting CRS in the per-thread and
+// process-wide caches, keyed by the definition.
+static PJ *OSRCreatePJFromDefinition(PJ_CONTEXT *ctx, const char *pszDefinition)
+{
+    auto tlsCache = OSRGetProjTLSCache();
+    const std::string osDefinition(pszDefinition);
+    PJ *pj = tlsCache->GetPJForDefinition(osDefinition);
+    if (pj)
+        return pj;
+    pj = proj_create(ctx, pszDefinition);
+    if (pj && proj_is_crs(pj))
+        tlsCache->CachePJForDefinition(osDefinition, pj);
+    return pj;
+}
+
 /************************************************************************/
 /*                          SetFromUserInput()                          */
 /************************************************************************/
@@ -3944,7 +3963,8 @@ OGRErr OGRSpatialReference::SetFromUserInput(const char *pszDefinition,
             // Use proj_create() as it allows things like EPSG:3157+4617
             // that are not normally supported by the below code that
             // builds manually a compound CRS
-            PJ *pj = proj_create(d->getPROJContext(), pszDefinition);
+            PJ *pj =
+                OSRCreatePJFromDefinition(d->getPROJContext(), pszDefinition);
             if (!pj)
             {
                 return OGRERR_FAILURE;
@@ -4040,7 +4060,7 @@ OGRErr OGRSpatialReference::SetFromUserInput(const char *pszDefinition,
         }
         else
         {
-            pj = proj_create(d->getPROJContext(), pszDefinition);
+            pj = OSRCreatePJFromDefinition(d->getPROJContext(), pszDefinition);
         }
         if (!pj)
         {
@@ -4510,7 +4530,7 @@ OGRErr OGRSpatialReference::importFromURN(const char *pszURN)
         CPLError(CE_Failure, CPLE_AppDefined, "Too long input string");
         return OGRERR_CORRUPT_DATA;
     }
-    auto obj = proj_create(d->getPROJContext(), pszURN);
+    auto obj = OSRCreatePJFromDefinition(d->getPROJContext(), pszURN);
     if (!obj)
     {
         return OGRERR_FAILURE;
@@ -4692,7 +4712,7 @@ OGRErr OGRSpatialReference::importFromCRSURL(const char *pszURL)
     else
 #endif
     {
-        obj = proj_create(d->getPROJContext(), pszURL);
+        obj = OSRCreatePJFromDefinition(d->getPROJContext(), pszURL);
     }
     if (!obj)
     {
@@ -10478,6 +10498,7 @@ void OSRCleanup(void)
     CleanupSRSWGS84Mutex();
     OSRCTCleanCache();
     OSRCleanupTLSContext();
+    OSRCleanupSharedCRSCache();
 }
 
 /************************************************************************/
@@ -32,7 +32,9 @@
 #include "ogr_geometry.h"
 #include "ogr_p.h"
 
+#include <algorithm>
 #include <cassert>
+#include <charconv>
 #include <cmath>
 #include <cstddef>
 #include <cstdio>
@@ -40,8 +42,6 @@
 #include <cstring>
 #include <cctype>
 #include <limits>
-#include <sstream>
-#include <iomanip>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -69,81 +69,195 @@ inline bool CPLIsDoubleAnInt(double d)
 namespace
 {
 
-// Remove trailing zeros except the last one.
-std::string removeTrailingZeros(std::string s)
+// Maximum size of the string representation of a double, in fixed or
+// exponential notation, with the specified number of digits after the decimal
+// point (DBL_MAX has 309 digits before the decimal point), and some room for
+// the sign, the decimal point and a ".0" suffix.
+size_t OGRFormatDoubleMaxSize(int nPrecision)
 {
-    auto pos = s.find('.');
-    if (pos == std::string::npos)
-        return s;
+    return 330 + static_cast<size_t>(std::max(0, nPrecision));
+}
 
-    // Remove zeros at the end.  We know this won't be npos because we
-    // have a decimal point.
-    auto nzpos = s.find_last_not_of('0');
-    s = s.substr(0, nzpos + 1);
+// Formats a double like printf("%.*f") or printf("%.*G") would do in the
+// C locale. Returns the length of the string, or 0 if the buffer is too small.
+size_t OGRFormatDoubleRaw(char *pszBuffer, size_t nBufferSize, double dfVal,
+                          bool bFixed, int nPrecision)
+{
+    if (nBufferSize == 0)
+        return 0;
+#if defined(__cpp_lib_to_chars)
+    const auto sRes = std::to_chars(
+        pszBuffer, pszBuffer + nBufferSize - 1, dfVal,
+        bFixed ? std::chars_format::fixed : std::chars_format::general,
+        nPrecision);
+    if (sRes.ec != std::errc())
+    {
+        pszBuffer[0] = '\0';
+        return 0;
+    }
+    *sRes.ptr = '\0';
+    const size_t nLen = static_cast<size_t>(sRes.ptr - pszBuffer);
+    if (!bFixed)
+    {
+        // Uppercase because OGC spec says capital 'E'.
+        char *pszE = static_cast<char *>(memchr(pszBuffer, 'e', nLen));
+        if (pszE)
+            *pszE = 'E';
+    }
+    return nLen;
+#else
+    char szFormat[16];
+    snprintf(szFormat, sizeof(szFormat), bFixed ? "%%.%df" : "%%.%dG",
+             nPrecision);
+    const int nLen = CPLsnprintf(pszBuffer, nBufferSize, szFormat, dfVal);
+    if (nLen < 0 || static_cast<size_t>(nLen) >= nBufferSize)
+    {
+        pszBuffer[0] = '\0';
+        return 0;
+    }
+    return static_cast<size_t>(nLen);
+#endif
+}
 
-    // Make sure there is one 0 after the decimal point.
-    if (s.back() == '.')
-        s += '0';
-    return s;
+// Formats a double with the shortest representation that converts back to the
+// same value. Returns the length of the string, or 0 if the buffer is too
+// small.
+size_t OGRFormatDoubleRoundTrip(char *pszBuffer, size_t nBufferSize,
+                                double dfVal)
+{
+    if (nBufferSize == 0)
+        return 0;
+#if defined(__cpp_lib_to_chars)
+    const auto sRes =
+        std::to_chars(pszBuffer, pszBuffer + nBufferSize - 1, dfVal);
+    if (sRes.ec != std::errc())
+    {
+        pszBuffer[0] = '\0';
+        return 0;
+    }
+    *sRes.ptr = '\0';
+    const size_t nLen = static_cast<size_t>(sRes.ptr - pszBuffer);
+    char *pszE = static_cast<char *>(memchr(pszBuffer, 'e', nLen));
+    if (pszE)
+        *pszE = 'E';
+    return nLen;
+#else
+    // 17 significant digits are always enough, but fewer are generally.
+    size_t nLen = 0;
+    for (int nPrecision = 15; nPrecision <= 17; ++nPrecision)
+    {
+        nLen = OGRFormatDoubleRaw(pszBuffer, nBufferSize, dfVal, false,
+                                  nPrecision);
+        if (nLen == 0 || CPLAtof(pszBuffer) == dfVal)
+            break;
+    }
+    return nLen;
+#endif
 }
 
-// Round a string representing a number by 1 in the least significant digit.
-std::string roundup(std::string s)
+// Remove trailing zeros of the decimal part except the last one.
+// Returns the new length of the string.
+size_t removeTrailingZeros(char *pszBuffer, size_t nLen)
 {
-    // Remove a negative sign if it exists to make processing
-    // more straigtforward.
-    bool negative(false);
-    if (s[0] == '-')
+    const char *pszDot =
+        static_cast<const char *>(memchr(pszBuffer, '.', nLen));
+    if (pszDot == nullptr)
+        return nLen;
+
+    // Do not touch the exponent, if any.
+    const char *pszExp = static_cast<const char *>(
+        memchr(pszDot, 'E', nLen - (pszDot - pszBuffer)));
+    const size_t nMantissaLen =
+        pszExp ? static_cast<size_t>(pszExp - pszBuffer) : nLen;
+
+    // Remove zeros at the end.  We know this will stop at the decimal
+    // point at the latest.
+    size_t nNewMantissaLen = nMantissaLen;
+    while (pszBuffer[nNewMantissaLen - 1] == '0')
+        nNewMantissaLen--;
+
+    // Make sure there is one 0 after the decimal point.
+    if (pszBuffer[nNewMantissaLen - 1] == '.')
     {
-        negative = true;
-        s = s.substr(1);
+        if (nNewMantissaLen == nMantissaLen)
+        {
+            // No zero was removed: insert one.
+            memmove(pszBuffer + nMantissaLen + 1, pszBuffer + nMantissaLen,
+                    nLen - nMantissaLen + 1);
+            pszBuffer[nMantissaLen] = '0';
+            return nLen + 1;
+        }
+        nNewMantissaLen++;
     }
 
+    if (nNewMantissaLen == nMantissaLen)
+        return nLen;
+    memmove(pszBuffer + nNewMantissaLen, pszBuffer + nMantissaLen,
+            nLen - nMantissaLen + 1);
+    return nLen - (nMantissaLen - nNewMantissaLen);
+}
+
+// Round a string representing a number by 1 in the least significant digit.
+// The buffer must have room for one extra character. Returns the new length
+// of the string.
+size_t roundup(char *pszBuffer, size_t nLen)
+{
+    // Skip a negative sign if it exists to make processing
+    // more straightforward.
+    const size_t nStart = pszBuffer[0] == '-' ? 1 : 0;
+
     // Go from the back to the front.  If we increment a digit other than
     // a '9', we're done.  If we increment a '9', set it to a '0' and move
     // to the next (more significant) digit.  If we get to the front of the
     // string, add a '1' to the front of the string.
-    for (int pos = static_cast<int>(s.size() - 1); pos >= 0; pos--)
+    for (size_t pos = nLen; pos > nStart; pos--)
     {
-        if (s[pos] == '.')
+        char &ch = pszBuffer[pos - 1];
+        if (ch == '.')
             continue;
-        s[pos]++;
+        ch++;
 
         // Incrementing past 9 gets you a colon in ASCII.
-        if (s[pos] != ':')
+        if (ch != ':')
             break;
-        else
-            s[pos] = '0';
-        if (pos == 0)
-            s = '1' + s;
+        ch = '0';
+        if (pos - 1 == nStart)
+        {
+            memmove(pszBuffer + nStart + 1, pszBuffer + nStart,
+                    nLen - nStart + 1);
+            pszBuffer[nStart] = '1';
+            nLen++;
+        }
     }
-    if (negative)
-        s = '-' + s;
-    return s;
+    return nLen;
 }
 
 // This attempts to eliminate what is likely binary -> decimal representation
 // error or the result of low-order rounding with calculations.  The result
 // may be more visually pleasing and takes up fewer places.
-std::string intelliround(std::string &s)
+// The buffer must have room for one extra character. Returns the new length
+// of the string.
+size_t intelliround(char *pszBuffer, size_t nLen)
 {
     // If there is no decimal point, just return.
-    auto dotPos = s.find(".");
-    if (dotPos == std::string::npos)
-        return s;
+    const char *pszDot =
+        static_cast<const char *>(memchr(pszBuffer, '.', nLen));
+    if (pszDot == nullptr)
+        return nLen;
 
     // Don't mess with exponential formatting.
-    if (s.find_first_of("eE") != std::string::npos)
-        return s;
-    size_t iDotPos = static_cast<size_t>(dotPos);
+    if (memchr(pszBuffer, 'e', nLen) || memchr(pszBuffer, 'E', nLen))
+        return nLen;
+    const char *s = pszBuffer;
+    const size_t iDotPos = static_cast<size_t>(pszDot - pszBuffer);
     size_t nCountBeforeDot = iDotPos - 1;
     if (s[0] == '-')
         nCountBeforeDot--;
-    size_t i = s.size();
+    const size_t i = nLen;
 
     // If we don't have ten characters, don't do anything.
     if (i <= 10)
-        return s;
+        return nLen;
 
     /* -------------------------------------------------------------------- */
     /*      Trim trailing 00000x's as they are likely roundoff error.       */
@@ -151,7 +265,7 @@ std::string intelliround(std::string &s)
     if (s[i - 2] == '0' && s[i - 3] == '0' && s[i - 4] == '0' &&
         s[i - 5] == '0' && s[i - 6] == '0')
     {
-        s.resize(s.size() - 1);
+        nLen--;
     }
     // I don't understand this case exactly.  It's like saying if the
     // value is large enough and there are sufficient sig digits before
@@ -168,7 +282,7 @@ std::string intelliround(std::string &s)
              (nCountBeforeDot >= 8 || s[i - 7] == '0') && s[i - 8] == '0' &&
              s[i - 9] == '0')
     {
-        s.resize(s.size() - 8);
+        nLen -= 8;
     }
     /* -------------------------------------------------------------------- */
     /*      Trim trailing 99999x's as they are likely roundoff error.       */
@@ -176,8 +290,9 @@ std::string intelliround(std::string &s)
     else if (s[i - 2] == '9' && s[i - 3] == '9' && s[i - 4] == '9' &&
              s[i - 5] == '9' && s[i - 6] == '9')
     {
-        s.resize(i - 6);
-        s = roundup(s);
+        nLen = i - 6;
+        pszBuffer[nLen] = '\0';
+        return roundup(pszBuffer, nLen);
     }
     else if (iDotPos < i - 9 && (nCountBeforeDot >= 4 || s[i - 3] == '9') &&
              (nCountBeforeDot >= 5 || s[i - 4] == '9') &&
@@ -186,10 +301,39 @@ std::string intelliround(std::string &s)
              (nCountBeforeDot >= 8 || s[i - 7] == '9') && s[i - 8] == '9' &&
              s[i - 9] == '9')
     {
-        s.resize(i - 9);
-        s = roundup(s);
+        nLen = i - 9;
+        pszBuffer[nLen] = '\0';
+        return roundup(pszBuffer, nLen);
+    }
+    pszBuffer[nLen] = '\0';
+    return nLen;
+}
+
+// Writes an integer value. Returns the length of the string, or 0 if the
+// buffer is too small.
+size_t OGRFormatIntToBuffer(char *pszBuffer, size_t nBufferSize, int nVal)
+{
+    if (nBufferSize == 0)
+        return 0;
+    const auto sRes =
+        std::to_chars(pszBuffer, pszBuffer + nBufferSize - 1, nVal);
+    if (sRes.ec != std::errc())
+    {
+        pszBuffer[0] = '\0';
+        return 0;
+    }
+    *sRes.ptr = '\0';
+    return static_cast<size_t>(sRes.ptr - pszBuffer);
+}
+
+bool isInteger(const char *pszBuffer, size_t nLen)
+{
+    for (size_t i = 0; i < nLen; ++i)
+    {
+        if (!(pszBuffer[i] >= '0' && pszBuffer[i] <= '9'))
+            return false;
     }
-    return s;
+    return true;
 }
 
 }  // unnamed namespace
@@ -211,56 +355,122 @@ void OGRFormatDouble(char *pszBuffer, int nBufferLen, double dfVal,
                       ? OGRWktFormat::G
                       : OGRWktFormat::F;
 
-    std::string s = OGRFormatDouble(dfVal, opts, 1);
-    if (chDecimalSep != '\0' && chDecimalSep != '.')
+    if (nBufferLen <= 0)
+        return;
+    size_t nLen = OGRFormatDoubleToBuffer(
+        pszBuffer, static_cast<size_t>(nBufferLen), dfVal, opts, 1);
+    if (nLen == 0)
     {
-        auto pos = s.find('.');
-        if (pos != std::string::npos)
-            s.replace(pos, 1, std::string(1, chDecimalSep));
+        std::string s = OGRFormatDouble(dfVal, opts, 1);
+        if (s.size() + 1 > static_cast<size_t>(nBufferLen))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Truncated double value %s to "
+                     "%s.",
+                     s.data(), s.substr(0, nBufferLen - 1).data());
+            s.resize(nBufferLen - 1);
+        }
+        memcpy(pszBuffer, s.data(), s.size() + 1);
+        nLen = s.size();
     }
-    if (s.size() + 1 > static_cast<size_t>(nBufferLen))
+    if (chDecimalSep != '\0' && chDecimalSep != '.')
     {
-        CPLError(CE_Warning, CPLE_AppDefined,
-                 "Truncated double value %s to "
-                 "%s.",
-                 s.data(), s.substr(0, nBufferLen - 1).data());
-        s.resize(nBufferLen - 1);
+        char *pszDot = static_cast<char *>(memchr(pszBuffer, '.', nLen));
+        if (pszDot)
+            *pszDot = chDecimalSep;
     }
-    strcpy(pszBuffer, s.data());
 }
 
 /// Simplified OGRFormatDouble that can be made to adhere to provided
 /// options.
 std::string OGRFormatDouble(double val, const OGRWktOptions &opts, int nDimIdx)
+{
+    char szBuffer[128];
+    size_t nLen =
+        OGRFormatDoubleToBuffer(szBuffer, sizeof(szBuffer), val, opts, nDimIdx);
+    if (nLen > 0)
+        return std::string(szBuffer, nLen);
+
+    std::string osBuffer;
+    osBuffer.resize(OGRFormatDoubleMaxSize(std::max(
+        opts.xyPrecision, std::max(opts.zPrecision, opts.mPrecision))));
+    nLen = OGRFormatDoubleToBuffer(&osBuffer[0], osBuffer.size(), val, opts,
+                                   nDimIdx);
+    osBuffer.resize(nLen);
+    return osBuffer;
+}
+
+/************************************************************************/
+/*                       OGRFormatDoubleToBuffer()                      */
+/************************************************************************/
+
+/** Formats a double like OGRFormatDouble(double, const OGRWktOptions&, int),
+ * but into a caller provided buffer, without any dynamic memory allocation.
+ *
+ * @param pszBuffer Output buffer.
+ * @param nBufferSize Size of pszBuffer, including the nul terminating
+ *                    character.
+ * @param dfVal Value to format.
+ * @param opts Formatting options.
+ * @param nDimIdx 1 for X, 2 for Y, 3 for Z and 4 for M.
+ * @return the length of the string, or 0 if the buffer is too small (in which
+ * case pszBuffer is set to an empty string)
+ * @since GDAL 3.10
+ */
+size_t OGRFormatDoubleToBuffer(char *pszBuffer, size_t nBufferSize,
+                               double dfVal, const OGRWktOptions &opts,
+                               int nDimIdx)
 {
     // So to have identical cross platform representation.
-    if (std::isinf(val))
-        return (val > 0) ? "inf" : "-inf";
-    if (std::isnan(val))
-        return "nan";
+    const char *pszSpecial = nullptr;
+    if (std::isinf(dfVal))
+        pszSpecial = (dfVal > 0) ? "inf" : "-inf";
+    else if (std::isnan(dfVal))
+        pszSpecial = "nan";
+    if (pszSpecial)
+    {
+        const size_t nLen = strlen(pszSpecial);
+        if (nLen + 1 > nBufferSize)
+        {
+            if (nBufferSize)
+                pszBuffer[0] = '\0';
+            return 0;
+        }
+        memcpy(pszBuffer, pszSpecial, nLen + 1);
+        return nLen;
+    }
+
+    if (opts.format == OGRWktFormat::RoundTrip)
+        return OGRFormatDoubleRoundTrip(pszBuffer, nBufferSize, dfVal);
 
-    std::ostringstream oss;
-    oss.imbue(std::locale::classic());  // Make sure we output decimal points.
     bool l_round(opts.round);
-    if (opts.format == OGRWktFormat::F ||
-        (opts.format == OGRWktFormat::Default && fabs(val) < 1))
-        oss << std::fixed;
-    else
+    bool bFixed = true;
+    if (!(opts.format == OGRWktFormat::F ||
+          (opts.format == OGRWktFormat::Default && fabs(dfVal) < 1)))
     {
-        // Uppercase because OGC spec says capital 'E'.
-        oss << std::uppercase;
+        bFixed = false;
         l_round = false;
     }
-    oss << std::setprecision(nDimIdx < 3    ? opts.xyPrecision
-                             : nDimIdx == 3 ? opts.zPrecision
-                                            : opts.mPrecision);
-    oss << val;
+    const int nPrecision = nDimIdx < 3    ? opts.xyPrecision
+                           : nDimIdx == 3 ? opts.zPrecision
+                                          : opts.mPrecision;
 
-    std::string sval = oss.str();
+    // Keep room for the extra characters that roundup() and
+    // removeTrailingZeros() may add.
+    if (nBufferSize < 3)
+    {
+        if (nBufferSize)
+            pszBuffer[0] = '\0';
+        return 0;
+    }
+    size_t nLen = OGRFormatDoubleRaw(pszBuffer, nBufferSize - 2, dfVal,
+                                     bFixed, nPrecision);
+    if (nLen == 0)
+        return 0;
 
     if (l_round)
-        sval = intelliround(sval);
-    return removeTrailingZeros(std::move(sval));
+        nLen = intelliround(pszBuffer, nLen);
+    return removeTrailingZeros(pszBuffer, nLen);
 }
 
 /************************************************************************/
@@ -283,50 +493,29 @@ void OGRMakeWktCoordinate(char *pszTarget, double x, double y, double z,
     memcpy(pszTarget, wkt.data(), wkt.size() + 1);
 }
 
-static bool isInteger(const std::string &s)
-{
-    return s.find_first_not_of("0123456789") == std::string::npos;
-}
-
 std::string OGRMakeWktCoordinate(double x, double y, double z, int nDimension,
                                  const OGRWktOptions &opts)
 {
-    std::string wkt;
-
-    // Why do we do this?  Seems especially strange since we're ADDING
-    // ".0" onto values in the case below.  The "&&" here also seems strange.
-    if (opts.format == OGRWktFormat::Default && CPLIsDoubleAnInt(x) &&
-        CPLIsDoubleAnInt(y))
-    {
-        wkt = std::to_string(static_cast<int>(x));
-        wkt += ' ';
-        wkt += std::to_string(static_cast<int>(y));
-    }
-    else
-    {
-        wkt = OGRFormatDouble(x, opts, 1);
-        // ABELL - Why do we do special formatting?
-        if (isInteger(wkt))
-            wkt += ".0";
-        wkt += ' ';
+    return OGRMakeWktCoordinateM(x, y, z, 0, nDimension == 3, FALSE, opts);
+}
 
-        std::string yval = OGRFormatDouble(y, opts, 2);
-        if (isInteger(yval))
-            yval += ".0";
-        wkt += yval;
-    }
+/************************************************************************/
+/*                    OGRMakeWktCoordinateToBuffer()                    */
+/************************************************************************/
 
-    if (nDimension == 3)
-    {
-        wkt += ' ';
-        if (opts.format == OGRWktFormat::Default && CPLIsDoubleAnInt(z))
-            wkt += std::to_string(static_cast<int>(z));
-        else
-        {
-            wkt += OGRFormatDouble(z, opts, 3);
-        }
-    }
-    return wkt;
+/** Formats a well known text coordinate like
+ * OGRMakeWktCoordinate(double, double, double, int, const OGRWktOptions&),
+ * but into a caller provided buffer, without any dynamic memory allocation.
+ *
+ * @return the length of the string, or 0 if the buffer is too small.
+ * @since GDAL 3.10
+ */
+size_t OGRMakeWktCoordinateToBuffer(char *pszBuffer, size_t nBufferSize,
+                                    double x, double y, double z,
+                                    int nDimension, const OGRWktOptions &opts)
+{
+    return OGRMakeWktCoordinateMToBuffer(pszBuffer, nBufferSize, x, y, z, 0,
+                                         nDimension == 3, FALSE, opts);
 }
 
 /************************************************************************/
@@ -353,45 +542,110 @@ std::string OGRMakeWktCoordinateM(double x, double y, double z, double m,
                                   OGRBoolean hasZ, OGRBoolean hasM,
                                   const OGRWktOptions &opts)
 {
-    std::string wkt;
+    char szBuffer[256];
+    size_t nLen = OGRMakeWktCoordinateMToBuffer(szBuffer, sizeof(szBuffer), x,
+                                                y, z, m, hasZ, hasM, opts);
+    if (nLen > 0)
+        return std::string(szBuffer, nLen);
+
+    std::string osBuffer;
+    osBuffer.resize(4 * OGRFormatDoubleMaxSize(std::max(
+                            opts.xyPrecision,
+                            std::max(opts.zPrecision, opts.mPrecision))));
+    nLen = OGRMakeWktCoordinateMToBuffer(&osBuffer[0], osBuffer.size(), x, y,
+                                         z, m, hasZ, hasM, opts);
+    osBuffer.resize(nLen);
+    return osBuffer;
+}
+
+/************************************************************************/
+/*                   OGRMakeWktCoordinateMToBuffer()                    */
+/************************************************************************/
+
+/** Formats a well known text coordinate like
+ * OGRMakeWktCoordinateM(double, double, double, double, OGRBoolean,
+ * OGRBoolean, const OGRWktOptions&), but into a caller provided buffer,
+ * without any dynamic memory allocation.
+ *
+ * @return the length of the string, or 0 if the buffer is too small.
+ * @since GDAL 3.10
+ */
+size_t OGRMakeWktCoordinateMToBuffer(char *pszBuffer, size_t nBufferSize,
+                                     double x, double y, double z, double m,
+                                     OGRBoolean hasZ, OGRBoolean hasM,
+                                     const OGRWktOptions &opts)
+{
+    size_t nLen = 0;
+
+    // Appends a character, keeping room for the nul terminating character.
+    const auto AppendChar = [pszBuffer, nBufferSize, &nLen](char ch)
+    {
+        if (nLen + 2 > nBufferSize)
+            return false;
+        pszBuffer[nLen++] = ch;
+        pszBuffer[nLen] = '\0';
+        return true;
+    };
+
+    // Appends a value formatted as an integer, or with OGRFormatDouble().
+    const auto AppendValue =
+        [pszBuffer, nBufferSize, &nLen, &opts](double dfVal, int nDimIdx,
+                                               bool bAsInt)
+    {
+        const size_t nValLen =
+            bAsInt ? OGRFormatIntToBuffer(pszBuffer + nLen, nBufferSize - nLen,
+                                          static_cast<int>(dfVal))
+                   : OGRFormatDoubleToBuffer(pszBuffer + nLen,
+                                             nBufferSize - nLen, dfVal, opts,
+                                             nDimIdx);
+        nLen += nValLen;
+        return nValLen > 0;
+    };
+
+    // Why do we do this?  Seems especially strange since we're ADDING
+    // ".0" onto values in the case below.  The "&&" here also seems strange.
     if (opts.format == OGRWktFormat::Default && CPLIsDoubleAnInt(x) &&
         CPLIsDoubleAnInt(y))
     {
-        wkt = std::to_string(static_cast<int>(x));
-        wkt += ' ';
-        wkt += std::to_string(static_cast<int>(y));
+        if (!AppendValue(x, 1, true) || !AppendChar(' ') ||
+            !AppendValue(y, 2, true))
+            return 0;
     }
     else
     {
-        wkt = OGRFormatDouble(x, opts, 1);
-        if (isInteger(wkt))
-            wkt += ".0";
-        wkt += ' ';
+        // ABELL - Why do we do special formatting?
+        size_t nStart = nLen;
+        if (!AppendValue(x, 1, false) ||
+            (isInteger(pszBuffer + nStart, nLen - nStart) &&
+             (!AppendChar('.') || !AppendChar('0'))) ||
+            !AppendChar(' '))
+            return 0;
 
-        std::string yval = OGRFormatDouble(y, opts, 2);
-        if (isInteger(yval))
-            yval += ".0";
-        wkt += yval;
+        nStart = nLen;
+        if (!AppendValue(y, 2, false) ||
+            (isInteger(pszBuffer + nStart, nLen - nStart) &&
+             (!AppendChar('.') || !AppendChar('0'))))
+            return 0;
     }
 
     if (hasZ)
     {
-        wkt += ' ';
-        if (opts.format == OGRWktFormat::Default && CPLIsDoubleAnInt(z))
-            wkt += std::to_string(static_cast<int>(z));
-        else
-            wkt += OGRFormatDouble(z, opts, 3);
+        if (!AppendChar(' ') ||
+            !AppendValue(z, 3,
+                         opts.format == OGRWktFormat::Default &&
+                             CPLIsDoubleAnInt(z)))
+            return 0;
     }
 
     if (hasM)
     {
-        wkt += ' ';
-        if (opts.format == OGRWktFormat::Default && CPLIsDoubleAnInt(m))
-            wkt += std::to_string(static_cast<int>(m));
-        else
-            wkt += OGRFormatDouble(m, opts, 4);
+        if (!AppendChar(' ') ||
+            !AppendValue(m, 4,
+                         opts.format == OGRWktFormat::Default &&
+                             CPLIsDoubleAnInt(m)))
+            return 0;
     }
-    return wkt;
+    return nLen;
 }
 
 /************************************************************************/
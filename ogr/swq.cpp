@@ -64,6 +64,27 @@ void swqerror(swq_parse_context *context, const char *msg)
     CPLError(CE_Failure, CPLE_AppDefined, "%s", osMsg.c_str());
 }
 
+/************************************************************************/
+/*                        SkipCountStarArgument()                       */
+/*                                                                      */
+/*      Return the position after a "(*)" argument list, possibly       */
+/*      with white space, or nullptr if there is none.                  */
+/************************************************************************/
+
+static const char *SkipCountStarArgument(const char *pszInput)
+{
+    for (const char chExpected : {'(', '*', ')'})
+    {
+        while (*pszInput == ' ' || *pszInput == '\t' || *pszInput == 10 ||
+               *pszInput == 13)
+            pszInput++;
+        if (*pszInput != chExpected)
+            return nullptr;
+        pszInput++;
+    }
+    return pszInput;
+}
+
 /************************************************************************/
 /*                               swqlex()                               */
 /*                                                                      */
@@ -231,6 +252,18 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
 
         context->pszNext = pszNext;
 
+        // COUNT(*) is only an expression in the HAVING clause. In the
+        // column list it is handled by dedicated column_spec rules.
+        if (context->bInHaving && EQUAL(osToken, "COUNT"))
+        {
+            const char *pszEnd = SkipCountStarArgument(pszNext);
+            if (pszEnd)
+            {
+                context->pszNext = pszEnd;
+                return SWQT_HAVING_COUNT_STAR;
+            }
+        }
+
         if (EQUAL(osToken, "IN"))
             nReturn = SWQT_IN;
         else if (EQUAL(osToken, "LIKE"))
@@ -269,6 +302,10 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
             nReturn = SWQT_ORDER;
         else if (EQUAL(osToken, "BY"))
             nReturn = SWQT_BY;
+        else if (EQUAL(osToken, "GROUP"))
+            nReturn = SWQT_GROUP;
+        else if (EQUAL(osToken, "HAVING"))
+            nReturn = SWQT_HAVING;
         else if (EQUAL(osToken, "FROM"))
             nReturn = SWQT_FROM;
         else if (EQUAL(osToken, "AS"))
@@ -942,7 +979,8 @@ CPLErr swq_expr_compile2(const char *where_clause, swq_field_list *field_list,
 static const char *const apszSQLReservedKeywords[] = {
     "OR",    "AND",      "NOT",    "LIKE",   "IS",   "NULL", "IN",    "BETWEEN",
     "CAST",  "DISTINCT", "ESCAPE", "SELECT", "LEFT", "JOIN", "WHERE", "ON",
-    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL"};
+    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL",
+    "GROUP", "HAVING"};
 
 int swq_is_reserved_keyword(const char *pszStr)
 {
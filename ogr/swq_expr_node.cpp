@@ -786,6 +786,15 @@ CPLString swq_expr_node::UnparseOperationFromUnparsedSubExpr(char **apszSubExpr)
             osExpr += ")";
             break;
 
+        case SWQ_COUNT:
+            // COUNT(*), as found in HAVING clauses.
+            if (nSubExprCount == 1 && strcmp(apszSubExpr[0], "*") == 0)
+            {
+                osExpr = "COUNT(*)";
+                break;
+            }
+            [[fallthrough]];
+
         default:  // function style.
             if (nOperation != SWQ_CUSTOM_FUNC)
                 osExpr.Printf("%s(", poOp->pszName);
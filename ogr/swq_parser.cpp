@@ -173,66 +173,74 @@ enum yysymbol_kind_t
   YYSYMBOL_SWQT_ON = 18,                   /* "ON"  */
   YYSYMBOL_SWQT_ORDER = 19,                /* "ORDER"  */
   YYSYMBOL_SWQT_BY = 20,                   /* "BY"  */
-  YYSYMBOL_SWQT_FROM = 21,                 /* "FROM"  */
-  YYSYMBOL_SWQT_AS = 22,                   /* "AS"  */
-  YYSYMBOL_SWQT_ASC = 23,                  /* "ASC"  */
-  YYSYMBOL_SWQT_DESC = 24,                 /* "DESC"  */
-  YYSYMBOL_SWQT_DISTINCT = 25,             /* "DISTINCT"  */
-  YYSYMBOL_SWQT_CAST = 26,                 /* "CAST"  */
-  YYSYMBOL_SWQT_UNION = 27,                /* "UNION"  */
-  YYSYMBOL_SWQT_ALL = 28,                  /* "ALL"  */
-  YYSYMBOL_SWQT_LIMIT = 29,                /* "LIMIT"  */
-  YYSYMBOL_SWQT_OFFSET = 30,               /* "OFFSET"  */
-  YYSYMBOL_SWQT_EXCEPT = 31,               /* "EXCEPT"  */
-  YYSYMBOL_SWQT_EXCLUDE = 32,              /* "EXCLUDE"  */
-  YYSYMBOL_SWQT_HIDDEN = 33,               /* "HIDDEN"  */
-  YYSYMBOL_SWQT_VALUE_START = 34,          /* SWQT_VALUE_START  */
-  YYSYMBOL_SWQT_SELECT_START = 35,         /* SWQT_SELECT_START  */
-  YYSYMBOL_SWQT_NOT = 36,                  /* "NOT"  */
-  YYSYMBOL_SWQT_OR = 37,                   /* "OR"  */
-  YYSYMBOL_SWQT_AND = 38,                  /* "AND"  */
-  YYSYMBOL_39_ = 39,                       /* '='  */
-  YYSYMBOL_40_ = 40,                       /* '<'  */
-  YYSYMBOL_41_ = 41,                       /* '>'  */
-  YYSYMBOL_42_ = 42,                       /* '!'  */
-  YYSYMBOL_43_ = 43,                       /* '+'  */
-  YYSYMBOL_44_ = 44,                       /* '-'  */
-  YYSYMBOL_45_ = 45,                       /* '*'  */
-  YYSYMBOL_46_ = 46,                       /* '/'  */
-  YYSYMBOL_47_ = 47,                       /* '%'  */
-  YYSYMBOL_SWQT_UMINUS = 48,               /* SWQT_UMINUS  */
-  YYSYMBOL_SWQT_RESERVED_KEYWORD = 49,     /* "reserved keyword"  */
-  YYSYMBOL_50_ = 50,                       /* '('  */
-  YYSYMBOL_51_ = 51,                       /* ')'  */
-  YYSYMBOL_52_ = 52,                       /* ','  */
-  YYSYMBOL_53_ = 53,                       /* '.'  */
-  YYSYMBOL_YYACCEPT = 54,                  /* $accept  */
-  YYSYMBOL_input = 55,                     /* input  */
-  YYSYMBOL_value_expr = 56,                /* value_expr  */
-  YYSYMBOL_value_expr_list = 57,           /* value_expr_list  */
-  YYSYMBOL_identifier = 58,                /* identifier  */
-  YYSYMBOL_field_value = 59,               /* field_value  */
-  YYSYMBOL_value_expr_non_logical = 60,    /* value_expr_non_logical  */
-  YYSYMBOL_type_def = 61,                  /* type_def  */
-  YYSYMBOL_select_statement = 62,          /* select_statement  */
-  YYSYMBOL_select_core = 63,               /* select_core  */
-  YYSYMBOL_opt_union_all = 64,             /* opt_union_all  */
-  YYSYMBOL_union_all = 65,                 /* union_all  */
-  YYSYMBOL_select_field_list = 66,         /* select_field_list  */
-  YYSYMBOL_exclude_field = 67,             /* exclude_field  */
-  YYSYMBOL_exclude_field_list = 68,        /* exclude_field_list  */
-  YYSYMBOL_except_or_exclude = 69,         /* except_or_exclude  */
-  YYSYMBOL_column_spec = 70,               /* column_spec  */
-  YYSYMBOL_as_clause = 71,                 /* as_clause  */
-  YYSYMBOL_as_clause_with_hidden = 72,     /* as_clause_with_hidden  */
-  YYSYMBOL_opt_where = 73,                 /* opt_where  */
-  YYSYMBOL_opt_joins = 74,                 /* opt_joins  */
-  YYSYMBOL_opt_order_by = 75,              /* opt_order_by  */
-  YYSYMBOL_sort_spec_list = 76,            /* sort_spec_list  */
-  YYSYMBOL_sort_spec = 77,                 /* sort_spec  */
-  YYSYMBOL_opt_limit = 78,                 /* opt_limit  */
-  YYSYMBOL_opt_offset = 79,                /* opt_offset  */
-  YYSYMBOL_table_def = 80                  /* table_def  */
+  YYSYMBOL_SWQT_GROUP = 21,                /* "GROUP"  */
+  YYSYMBOL_SWQT_HAVING = 22,               /* "HAVING"  */
+  YYSYMBOL_SWQT_FROM = 23,                 /* "FROM"  */
+  YYSYMBOL_SWQT_AS = 24,                   /* "AS"  */
+  YYSYMBOL_SWQT_ASC = 25,                  /* "ASC"  */
+  YYSYMBOL_SWQT_DESC = 26,                 /* "DESC"  */
+  YYSYMBOL_SWQT_DISTINCT = 27,             /* "DISTINCT"  */
+  YYSYMBOL_SWQT_CAST = 28,                 /* "CAST"  */
+  YYSYMBOL_SWQT_UNION = 29,                /* "UNION"  */
+  YYSYMBOL_SWQT_ALL = 30,                  /* "ALL"  */
+  YYSYMBOL_SWQT_LIMIT = 31,                /* "LIMIT"  */
+  YYSYMBOL_SWQT_OFFSET = 32,               /* "OFFSET"  */
+  YYSYMBOL_SWQT_EXCEPT = 33,               /* "EXCEPT"  */
+  YYSYMBOL_SWQT_EXCLUDE = 34,              /* "EXCLUDE"  */
+  YYSYMBOL_SWQT_HIDDEN = 35,               /* "HIDDEN"  */
+  YYSYMBOL_SWQT_HAVING_COUNT_STAR = 36,    /* "COUNT(*)"  */
+  YYSYMBOL_SWQT_VALUE_START = 37,          /* SWQT_VALUE_START  */
+  YYSYMBOL_SWQT_SELECT_START = 38,         /* SWQT_SELECT_START  */
+  YYSYMBOL_SWQT_NOT = 39,                  /* "NOT"  */
+  YYSYMBOL_SWQT_OR = 40,                   /* "OR"  */
+  YYSYMBOL_SWQT_AND = 41,                  /* "AND"  */
+  YYSYMBOL_42_ = 42,                       /* '='  */
+  YYSYMBOL_43_ = 43,                       /* '<'  */
+  YYSYMBOL_44_ = 44,                       /* '>'  */
+  YYSYMBOL_45_ = 45,                       /* '!'  */
+  YYSYMBOL_46_ = 46,                       /* '+'  */
+  YYSYMBOL_47_ = 47,                       /* '-'  */
+  YYSYMBOL_48_ = 48,                       /* '*'  */
+  YYSYMBOL_49_ = 49,                       /* '/'  */
+  YYSYMBOL_50_ = 50,                       /* '%'  */
+  YYSYMBOL_SWQT_UMINUS = 51,               /* SWQT_UMINUS  */
+  YYSYMBOL_SWQT_RESERVED_KEYWORD = 52,     /* "reserved keyword"  */
+  YYSYMBOL_53_ = 53,                       /* '('  */
+  YYSYMBOL_54_ = 54,                       /* ')'  */
+  YYSYMBOL_55_ = 55,                       /* ','  */
+  YYSYMBOL_56_ = 56,                       /* '.'  */
+  YYSYMBOL_YYACCEPT = 57,                  /* $accept  */
+  YYSYMBOL_input = 58,                     /* input  */
+  YYSYMBOL_value_expr = 59,                /* value_expr  */
+  YYSYMBOL_value_expr_list = 60,           /* value_expr_list  */
+  YYSYMBOL_identifier = 61,                /* identifier  */
+  YYSYMBOL_field_value = 62,               /* field_value  */
+  YYSYMBOL_value_expr_non_logical = 63,    /* value_expr_non_logical  */
+  YYSYMBOL_type_def = 64,                  /* type_def  */
+  YYSYMBOL_select_statement = 65,          /* select_statement  */
+  YYSYMBOL_select_core = 66,               /* select_core  */
+  YYSYMBOL_opt_union_all = 67,             /* opt_union_all  */
+  YYSYMBOL_union_all = 68,                 /* union_all  */
+  YYSYMBOL_select_field_list = 69,         /* select_field_list  */
+  YYSYMBOL_exclude_field = 70,             /* exclude_field  */
+  YYSYMBOL_exclude_field_list = 71,        /* exclude_field_list  */
+  YYSYMBOL_except_or_exclude = 72,         /* except_or_exclude  */
+  YYSYMBOL_column_spec = 73,               /* column_spec  */
+  YYSYMBOL_as_clause = 74,                 /* as_clause  */
+  YYSYMBOL_as_clause_with_hidden = 75,     /* as_clause_with_hidden  */
+  YYSYMBOL_opt_where = 76,                 /* opt_where  */
+  YYSYMBOL_opt_joins = 77,                 /* opt_joins  */
+  YYSYMBOL_opt_group_by = 78,              /* opt_group_by  */
+  YYSYMBOL_group_by_spec_list = 79,        /* group_by_spec_list  */
+  YYSYMBOL_group_by_spec = 80,             /* group_by_spec  */
+  YYSYMBOL_opt_having = 81,                /* opt_having  */
+  YYSYMBOL_82_1 = 82,                      /* $@1  */
+  YYSYMBOL_opt_order_by = 83,              /* opt_order_by  */
+  YYSYMBOL_sort_spec_list = 84,            /* sort_spec_list  */
+  YYSYMBOL_sort_spec = 85,                 /* sort_spec  */
+  YYSYMBOL_opt_limit = 86,                 /* opt_limit  */
+  YYSYMBOL_opt_offset = 87,                /* opt_offset  */
+  YYSYMBOL_table_def = 88                  /* table_def  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -558,21 +566,21 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  22
+#define YYFINAL  23
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   469
+#define YYLAST   513
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  54
+#define YYNTOKENS  57
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  27
+#define YYNNTS  32
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  105
+#define YYNRULES  114
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  215
+#define YYNSTATES  229
 
 /* YYMAXUTOK -- Last valid token kind.  */
-#define YYMAXUTOK   295
+#define YYMAXUTOK   298
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -589,10 +597,10 @@ static const yytype_int8 yytranslate[] =
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    42,     2,     2,     2,    47,     2,     2,
-      50,    51,    45,    43,    52,    44,    53,    46,     2,     2,
+       2,     2,     2,    45,     2,     2,     2,    50,     2,     2,
+      53,    54,    48,    46,    55,    47,    56,    49,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      40,    39,    41,     2,     2,     2,     2,     2,     2,     2,
+      43,    42,    44,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -615,35 +623,35 @@ static const yytype_int8 yytranslate[] =
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    48,    49
+      35,    36,    37,    38,    39,    40,    41,    51,    52
 };
 
 #if YYDEBUG
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   125,   125,   126,   132,   139,   144,   149,   154,   161,
-     169,   177,   185,   193,   201,   209,   217,   225,   233,   241,
-     253,   262,   275,   283,   295,   304,   317,   326,   339,   348,
-     361,   368,   380,   386,   393,   395,   398,   406,   419,   424,
-     429,   433,   438,   443,   448,   483,   490,   497,   504,   511,
-     518,   554,   562,   568,   575,   584,   602,   622,   623,   626,
-     631,   637,   638,   640,   648,   649,   652,   662,   663,   666,
-     667,   670,   679,   690,   705,   720,   741,   772,   807,   832,
-     861,   867,   870,   872,   881,   882,   887,   888,   894,   901,
-     902,   905,   906,   909,   915,   921,   928,   929,   936,   937,
-     945,   955,   966,   977,   990,  1001
+       0,   128,   128,   129,   135,   142,   147,   152,   157,   164,
+     172,   180,   188,   196,   204,   212,   220,   228,   236,   244,
+     256,   265,   278,   286,   298,   307,   320,   329,   342,   351,
+     364,   371,   383,   389,   396,   398,   401,   409,   422,   427,
+     432,   436,   441,   446,   451,   486,   493,   500,   507,   514,
+     521,   557,   571,   579,   585,   592,   601,   619,   639,   640,
+     643,   648,   654,   655,   657,   665,   666,   669,   679,   680,
+     683,   684,   687,   696,   707,   722,   737,   758,   789,   824,
+     849,   878,   884,   887,   889,   898,   899,   904,   905,   911,
+     918,   919,   922,   923,   926,   933,   935,   934,   944,   945,
+     948,   949,   952,   958,   964,   971,   972,   979,   980,   988,
+     998,  1009,  1020,  1033,  1044
 };
 #endif
 
 /** Accessing symbol of state STATE.  */
 #define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-#if 0
+#if 1
 /* The user-facing name of the symbol whose (internal) number is
    YYSYMBOL.  No bounds checking.  */
 static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
-#endif
 
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
@@ -653,22 +661,22 @@ static const char *const yytname[] =
   "\"floating point number\"", "\"string\"", "\"identifier\"", "\"IN\"",
   "\"LIKE\"", "\"ILIKE\"", "\"ESCAPE\"", "\"BETWEEN\"", "\"NULL\"",
   "\"IS\"", "\"SELECT\"", "\"LEFT\"", "\"JOIN\"", "\"WHERE\"", "\"ON\"",
-  "\"ORDER\"", "\"BY\"", "\"FROM\"", "\"AS\"", "\"ASC\"", "\"DESC\"",
-  "\"DISTINCT\"", "\"CAST\"", "\"UNION\"", "\"ALL\"", "\"LIMIT\"",
-  "\"OFFSET\"", "\"EXCEPT\"", "\"EXCLUDE\"", "\"HIDDEN\"",
-  "SWQT_VALUE_START", "SWQT_SELECT_START", "\"NOT\"", "\"OR\"", "\"AND\"",
-  "'='", "'<'", "'>'", "'!'", "'+'", "'-'", "'*'", "'/'", "'%'",
-  "SWQT_UMINUS", "\"reserved keyword\"", "'('", "')'", "','", "'.'",
-  "$accept", "input", "value_expr", "value_expr_list", "identifier",
-  "field_value", "value_expr_non_logical", "type_def", "select_statement",
-  "select_core", "opt_union_all", "union_all", "select_field_list",
-  "exclude_field", "exclude_field_list", "except_or_exclude",
-  "column_spec", "as_clause", "as_clause_with_hidden", "opt_where",
-  "opt_joins", "opt_order_by", "sort_spec_list", "sort_spec", "opt_limit",
-  "opt_offset", "table_def", YY_NULLPTR
+  "\"ORDER\"", "\"BY\"", "\"GROUP\"", "\"HAVING\"", "\"FROM\"", "\"AS\"",
+  "\"ASC\"", "\"DESC\"", "\"DISTINCT\"", "\"CAST\"", "\"UNION\"",
+  "\"ALL\"", "\"LIMIT\"", "\"OFFSET\"", "\"EXCEPT\"", "\"EXCLUDE\"",
+  "\"HIDDEN\"", "\"COUNT(*)\"", "SWQT_VALUE_START", "SWQT_SELECT_START",
+  "\"NOT\"", "\"OR\"", "\"AND\"", "'='", "'<'", "'>'", "'!'", "'+'", "'-'",
+  "'*'", "'/'", "'%'", "SWQT_UMINUS", "\"reserved keyword\"", "'('", "')'",
+  "','", "'.'", "$accept", "input", "value_expr", "value_expr_list",
+  "identifier", "field_value", "value_expr_non_logical", "type_def",
+  "select_statement", "select_core", "opt_union_all", "union_all",
+  "select_field_list", "exclude_field", "exclude_field_list",
+  "except_or_exclude", "column_spec", "as_clause", "as_clause_with_hidden",
+  "opt_where", "opt_joins", "opt_group_by", "group_by_spec_list",
+  "group_by_spec", "opt_having", "$@1", "opt_order_by", "sort_spec_list",
+  "sort_spec", "opt_limit", "opt_offset", "table_def", YY_NULLPTR
 };
 
-#if 0
 static const char *
 yysymbol_name (yysymbol_kind_t yysymbol)
 {
@@ -676,7 +684,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-136)
+#define YYPACT_NINF (-141)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -690,28 +698,29 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      66,    93,   -13,    11,  -136,  -136,  -136,  -136,  -136,   -24,
-    -136,    93,   292,    93,   413,   -34,  -136,   174,   136,    21,
-    -136,    30,  -136,    93,   427,  -136,   315,    -9,    93,    93,
-     292,     2,   116,    93,    93,   172,   197,   239,    25,    93,
-       0,   292,   292,   292,   292,   292,   258,    84,   356,   -32,
-      27,    19,    23,    48,  -136,   -13,   377,  -136,    93,    73,
-      75,   145,  -136,    92,    57,    93,    93,   292,   420,   298,
-      93,    93,  -136,    93,    93,  -136,    93,  -136,    93,   308,
-      62,  -136,   -22,   -22,  -136,  -136,  -136,   107,  -136,  -136,
-      72,     0,  -136,   111,  -136,   223,    14,     7,   258,    30,
-    -136,  -136,     0,    95,    93,    93,   292,  -136,    93,   144,
-     149,   399,  -136,  -136,  -136,  -136,  -136,  -136,    93,  -136,
-       7,     0,  -136,  -136,     0,   109,  -136,   110,    55,   102,
-    -136,  -136,   114,   115,  -136,  -136,  -136,   174,   117,    93,
-      93,   292,  -136,   102,   118,  -136,   121,   119,   128,     9,
-       0,     0,  -136,   151,     7,   165,    -1,  -136,  -136,  -136,
-    -136,   174,   165,     0,  -136,     9,  -136,     9,     9,     7,
-     167,    93,   176,    83,   101,   176,  -136,  -136,  -136,  -136,
-     175,    93,   413,   179,   178,  -136,   193,  -136,   201,   178,
-      93,   364,     0,   207,   181,   163,   164,   181,   364,  -136,
-     134,  -136,   173,  -136,   221,  -136,  -136,  -136,  -136,  -136,
-    -136,  -136,     0,  -136,  -136
+      47,   284,     7,     3,  -141,  -141,  -141,  -141,  -141,   -46,
+    -141,  -141,   284,   289,   284,   422,   -48,  -141,   116,    97,
+      -5,  -141,    40,  -141,   284,   468,  -141,   338,   -10,   284,
+     284,   289,    38,    88,   284,   284,   164,   209,   229,    30,
+     284,    -4,   289,   289,   289,   289,   289,   274,    73,   361,
+     -34,    44,    20,    26,    57,  -141,     7,   404,  -141,   284,
+      98,   104,    81,  -141,   105,    66,   284,   284,   289,   429,
+     443,   284,   284,  -141,   284,   284,  -141,   284,  -141,   284,
+     321,    67,  -141,   -23,   -23,  -141,  -141,  -141,   100,  -141,
+    -141,    96,    -4,  -141,    99,  -141,   219,    33,    10,   274,
+      40,  -141,  -141,    -4,   102,   284,   284,   289,  -141,   284,
+     148,   162,   139,  -141,  -141,  -141,  -141,  -141,  -141,   284,
+    -141,    10,    -4,  -141,  -141,    -4,   119,  -141,   118,     6,
+      76,  -141,  -141,   124,   125,  -141,  -141,  -141,   116,   128,
+     284,   284,   289,  -141,    76,   122,  -141,   141,   129,   143,
+      58,    -4,    -4,  -141,   182,    10,   184,    14,  -141,  -141,
+    -141,  -141,   116,   184,    -4,  -141,    58,  -141,    58,    58,
+      10,   187,   284,   181,    56,    83,   181,  -141,  -141,  -141,
+    -141,   188,   284,   422,   189,   191,  -141,   215,  -141,   216,
+     191,   284,   382,    -4,   206,   196,   174,   175,   196,   382,
+    -141,  -141,   208,   183,    -4,   233,   207,  -141,  -141,   207,
+    -141,  -141,  -141,    -4,   126,  -141,   185,  -141,   239,  -141,
+    -141,   284,  -141,  -141,  -141,    -4,  -141,   422,  -141
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -720,43 +729,46 @@ static const yytype_int16 yypact[] =
 static const yytype_int8 yydefact[] =
 {
        2,     0,     0,     0,    38,    39,    40,    34,    43,     0,
-      35,     0,     0,     0,     3,    36,    41,     5,     0,     0,
-       4,    61,     1,     0,     8,    44,     0,     0,     0,     0,
+      35,    51,     0,     0,     0,     3,    36,    41,     5,     0,
+       0,     4,    62,     1,     0,     8,    44,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    74,    71,    36,
-       0,    64,     0,     0,    57,     0,     0,    42,     0,    18,
-      22,     0,    30,     0,     0,     0,     0,     0,     7,     6,
-       0,     0,     9,     0,     0,    12,     0,    13,     0,    33,
-       0,    37,    45,    46,    47,    48,    49,     0,    69,    70,
-       0,     0,    81,    82,    72,     0,     0,     0,     0,    61,
-      63,    62,     0,     0,     0,     0,     0,    31,     0,    19,
-      23,     0,    15,    16,    14,    10,    17,    11,     0,    50,
-       0,     0,    80,    83,     0,     0,    75,     0,   100,    86,
-      65,    58,    52,     0,    26,    20,    24,    28,     0,     0,
-       0,     0,    32,    86,    36,    66,    67,     0,     0,    76,
-       0,     0,   101,     0,     0,    84,     0,    51,    27,    21,
-      25,    29,    84,     0,    73,    78,    77,   102,   104,     0,
-       0,     0,    89,     0,     0,    89,    68,    79,   103,   105,
-       0,     0,    85,     0,    96,    53,     0,    55,     0,    96,
-       0,    86,     0,     0,    98,     0,     0,    98,    86,    87,
-      93,    90,    92,    97,     0,    59,    54,    56,    60,    88,
-      94,    95,     0,    99,    91
+       0,     0,     0,     0,     0,     0,     0,     0,    75,    72,
+      36,     0,    65,     0,     0,    58,     0,     0,    42,     0,
+      18,    22,     0,    30,     0,     0,     0,     0,     0,     7,
+       6,     0,     0,     9,     0,     0,    12,     0,    13,     0,
+      33,     0,    37,    45,    46,    47,    48,    49,     0,    70,
+      71,     0,     0,    82,    83,    73,     0,     0,     0,     0,
+      62,    64,    63,     0,     0,     0,     0,     0,    31,     0,
+      19,    23,     0,    15,    16,    14,    10,    17,    11,     0,
+      50,     0,     0,    81,    84,     0,     0,    76,     0,   109,
+      87,    66,    59,    53,     0,    26,    20,    24,    28,     0,
+       0,     0,     0,    32,    87,    36,    67,    68,     0,     0,
+      77,     0,     0,   110,     0,     0,    85,     0,    52,    27,
+      21,    25,    29,    85,     0,    74,    79,    78,   111,   113,
+       0,     0,     0,    90,     0,     0,    90,    69,    80,   112,
+     114,     0,     0,    86,     0,    98,    54,     0,    56,     0,
+      98,     0,    87,     0,     0,   105,     0,     0,   105,    87,
+      88,    94,    95,    93,     0,     0,   107,    55,    57,   107,
+      89,    96,    91,     0,   102,    99,   101,   106,     0,    60,
+      61,     0,    92,   103,   104,     0,   108,    97,   100
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -136,  -136,    16,   -48,   -18,  -117,    24,  -136,   177,   212,
-     135,  -136,   -43,  -136,    74,  -136,  -136,   -56,  -136,    77,
-    -135,    65,    34,  -136,    61,    56,  -111
+    -141,  -141,    -1,   -58,    -9,   -78,    11,  -141,   193,   223,
+     150,  -141,   -41,  -141,    95,  -141,  -141,    25,  -141,    89,
+    -140,    84,    48,  -141,  -141,  -141,    79,    45,  -141,    65,
+      64,  -107
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_uint8 yydefgoto[] =
 {
-       0,     3,    79,    80,    15,    16,    17,   133,    20,    21,
-      54,    55,    50,   146,   147,    90,    51,    93,    94,   172,
-     155,   184,   201,   202,   194,   205,   129
+       0,     3,    80,    81,    16,    17,    18,   134,    21,    22,
+      55,    56,    51,   147,   148,    91,    52,    94,    95,   173,
+     156,   185,   202,   203,   212,   221,   195,   215,   216,   206,
+     219,   130
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -764,148 +776,160 @@ static const yytype_uint8 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
-      49,    18,   173,    87,   145,     7,     7,   148,   162,   143,
-     103,    22,   127,     7,    62,     7,    39,    14,    95,    40,
-       7,    96,    81,    43,    44,    45,    23,    24,    49,    26,
-      92,    91,    10,    10,    48,    18,    25,    19,    63,    56,
-      10,    58,    10,   170,    59,    60,   145,    10,    97,    68,
-      69,    72,    75,    77,    61,   130,   199,    53,   180,   126,
-     138,     7,    48,   209,    78,    82,    83,    84,    85,    86,
-     142,    98,   152,   122,    99,   200,   100,    91,    81,   128,
-      49,   109,   110,   104,   132,   105,   112,   113,    10,   114,
-     115,   111,   116,   166,   117,   200,     4,     5,     6,     7,
-       1,     2,   128,   144,   107,     8,   144,   108,   151,   177,
-      92,   178,   179,   119,    48,    88,    89,   153,   154,     9,
-     135,   136,   121,    64,    65,    66,    10,    67,   120,    11,
-     137,    92,   167,   168,   185,   186,   128,    12,   174,     4,
-       5,     6,     7,    13,   123,   144,   134,    92,     8,    92,
-      92,   128,   187,   188,   139,   159,   160,   210,   211,   140,
-     149,    46,     9,   150,   156,   161,   157,   169,   158,    10,
-     164,    40,    11,   163,   144,     4,     5,     6,     7,   165,
-      12,    47,   171,   106,     8,   181,    13,   182,    41,    42,
-      43,    44,    45,   190,   144,   183,   195,   191,     9,   192,
-       4,     5,     6,     7,   196,    10,   198,   193,    11,     8,
-     203,   204,    70,    71,   206,   207,    12,    41,    42,    43,
-      44,    45,    13,     9,   213,   212,     4,     5,     6,     7,
-      10,    52,   101,    11,   131,     8,    73,   176,    74,   175,
-     189,    12,     4,     5,     6,     7,   214,    13,   124,     9,
-     197,     8,     0,   208,     0,     0,    10,     0,     0,    11,
-       0,     4,     5,     6,     7,     9,     0,    12,   125,     0,
-       8,     0,    10,    13,     0,    11,     0,     0,    76,     0,
-       0,     0,     0,    12,     9,     0,     0,     0,     0,    13,
-       0,    10,     0,     0,    11,     4,     5,     6,     7,     0,
-       0,     0,    12,    47,     8,    27,    28,    29,    13,    30,
-       0,    31,     0,     0,     0,    27,    28,    29,     9,    30,
-       0,    31,    27,    28,    29,    10,    30,     0,    31,     0,
-       0,     0,     0,     0,    32,     0,    12,    35,    36,    37,
-      38,     0,    13,     0,    32,    33,    34,    35,    36,    37,
-      38,    32,    33,    34,    35,    36,    37,    38,     0,     0,
-     118,     0,     7,    27,    28,    29,    57,    30,     0,    31,
-       0,    27,    28,    29,     0,    30,     0,    31,    91,   153,
-     154,     0,     0,     0,    27,    28,    29,     0,    30,    10,
-      31,     0,    32,    33,    34,    35,    36,    37,    38,   102,
-      32,    33,    34,    35,    36,    37,    38,     0,     0,     0,
-       0,     0,     0,    32,    33,    34,    35,    36,    37,    38,
-      27,    28,    29,     0,    30,     0,    31,    27,    28,    29,
-       0,    30,     0,    31,    27,    28,    29,   141,    30,     0,
-      31,     0,    41,    42,    43,    44,    45,     0,     0,    32,
-      33,    34,    35,    36,    37,    38,    32,     0,    34,    35,
-      36,    37,    38,     0,     0,     0,    35,    36,    37,    38
+      15,   104,     7,    23,   163,    40,    88,    24,    41,    19,
+      50,    25,     7,    27,   144,   128,     7,   174,    49,    96,
+       7,    19,    97,    57,    26,    44,    45,    46,    60,    61,
+      92,    10,    82,    69,    70,    73,    76,    78,    50,     7,
+      93,    10,    62,    59,   146,    10,    49,   149,   171,    10,
+      63,   139,   200,    83,    84,    85,    86,    87,   131,   210,
+      20,   143,   152,   181,     7,   110,   111,    98,    10,    54,
+     113,   114,    79,   115,   116,    99,   117,    64,   118,   112,
+     100,   127,    92,   123,     1,     2,   146,   101,    82,   129,
+      50,   154,   155,    10,   133,    65,    66,    67,    49,    68,
+       4,     5,     6,     7,   136,   137,    89,    90,   105,     8,
+     186,   187,   129,   145,   106,   201,   145,   108,   138,   109,
+      93,   120,   107,   121,    47,     9,   214,    42,    43,    44,
+      45,    46,    10,    11,   124,   201,    12,   188,   189,   160,
+     161,    93,   168,   169,    13,    48,   129,   214,   175,   122,
+      14,   223,   224,   162,   153,   145,   135,    93,   140,    93,
+      93,   129,    42,    43,    44,    45,    46,     4,     5,     6,
+       7,   183,   141,   150,   151,   167,     8,   157,    41,   158,
+     142,   192,   159,   165,   145,    42,    43,    44,    45,    46,
+     199,   178,     9,   179,   180,   145,   164,   166,   170,    10,
+      11,   172,   184,    12,   145,   182,   191,    71,    72,   193,
+     194,    13,     4,     5,     6,     7,   145,    14,   196,   197,
+     227,     8,     4,     5,     6,     7,   204,   205,   207,   208,
+     211,     8,     4,     5,     6,     7,   217,     9,   213,   218,
+     225,     8,   226,    53,    10,    11,   125,     9,    12,   102,
+     132,    74,   176,    75,    10,    11,    13,     9,    12,   177,
+     190,   222,    14,   209,    10,    11,    13,   126,    12,   198,
+     228,    77,    14,   220,     0,     0,    13,     4,     5,     6,
+       7,     0,    14,     0,     0,     0,     8,     4,     5,     6,
+       7,     0,     4,     5,     6,     7,     8,     0,     0,     0,
+       0,     8,     9,     0,     0,     0,     0,     0,     0,    10,
+      11,     0,     9,    12,     0,     0,     0,     9,     0,    10,
+      11,    13,    48,    12,    10,    11,     0,    14,    28,    29,
+      30,    13,    31,     0,    32,     0,    13,    14,     0,     0,
+       0,     0,    14,     0,     0,    28,    29,    30,     0,    31,
+       0,    32,     0,     0,     0,     0,     0,     0,     0,     0,
+      33,    34,    35,    36,    37,    38,    39,     7,    28,    29,
+      30,     0,    31,     0,    32,     0,   119,    33,    34,    35,
+      36,    37,    38,    39,     0,    92,     0,     0,     0,    28,
+      29,    30,    58,    31,     0,    32,    10,   154,   155,     0,
+      33,    34,    35,    36,    37,    38,    39,     0,     0,     0,
+       0,    28,    29,    30,     0,    31,     0,    32,     0,     0,
+       0,    33,    34,    35,    36,    37,    38,    39,   103,    28,
+      29,    30,     0,    31,     0,    32,    28,    29,    30,     0,
+      31,     0,    32,    33,    34,    35,    36,    37,    38,    39,
+      28,    29,    30,     0,    31,     0,    32,     0,     0,     0,
+       0,    33,    34,    35,    36,    37,    38,    39,    33,     0,
+      35,    36,    37,    38,    39,    28,    29,    30,     0,    31,
+       0,    32,    33,     0,     0,    36,    37,    38,    39,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      36,    37,    38,    39
 };
 
 static const yytype_int16 yycheck[] =
 {
-      18,    14,     3,    46,   121,     6,     6,   124,   143,   120,
-      58,     0,     5,     6,    12,     6,    50,     1,    50,    53,
-       6,    53,    40,    45,    46,    47,    50,    11,    46,    13,
-      48,    22,    33,    33,    18,    14,    12,    50,    36,    23,
-      33,    50,    33,   154,    28,    29,   163,    33,    21,    33,
-      34,    35,    36,    37,    30,    98,   191,    27,   169,    45,
-     108,     6,    46,   198,    39,    41,    42,    43,    44,    45,
-     118,    52,   128,    91,    51,   192,    28,    22,    96,    97,
-      98,    65,    66,    10,   102,    10,    70,    71,    33,    73,
-      74,    67,    76,   149,    78,   212,     3,     4,     5,     6,
-      34,    35,   120,   121,    12,    12,   124,    50,    53,   165,
-     128,   167,   168,    51,    98,    31,    32,    15,    16,    26,
-     104,   105,    50,     7,     8,     9,    33,    11,    21,    36,
-     106,   149,   150,   151,    51,    52,   154,    44,   156,     3,
-       4,     5,     6,    50,    33,   163,    51,   165,    12,   167,
-     168,   169,    51,    52,    10,   139,   140,    23,    24,    10,
-      51,    25,    26,    53,    50,   141,    51,    16,    51,    33,
-      51,    53,    36,    52,   192,     3,     4,     5,     6,    51,
-      44,    45,    17,    38,    12,    18,    50,   171,    43,    44,
-      45,    46,    47,    18,   212,    19,     3,   181,    26,    20,
-       3,     4,     5,     6,     3,    33,   190,    29,    36,    12,
-       3,    30,    40,    41,    51,    51,    44,    43,    44,    45,
-      46,    47,    50,    26,     3,    52,     3,     4,     5,     6,
-      33,    19,    55,    36,    99,    12,    39,   163,    41,   162,
-     175,    44,     3,     4,     5,     6,   212,    50,    25,    26,
-     189,    12,    -1,   197,    -1,    -1,    33,    -1,    -1,    36,
-      -1,     3,     4,     5,     6,    26,    -1,    44,    45,    -1,
-      12,    -1,    33,    50,    -1,    36,    -1,    -1,    39,    -1,
-      -1,    -1,    -1,    44,    26,    -1,    -1,    -1,    -1,    50,
-      -1,    33,    -1,    -1,    36,     3,     4,     5,     6,    -1,
-      -1,    -1,    44,    45,    12,     7,     8,     9,    50,    11,
-      -1,    13,    -1,    -1,    -1,     7,     8,     9,    26,    11,
-      -1,    13,     7,     8,     9,    33,    11,    -1,    13,    -1,
-      -1,    -1,    -1,    -1,    36,    -1,    44,    39,    40,    41,
-      42,    -1,    50,    -1,    36,    37,    38,    39,    40,    41,
-      42,    36,    37,    38,    39,    40,    41,    42,    -1,    -1,
-      52,    -1,     6,     7,     8,     9,    51,    11,    -1,    13,
-      -1,     7,     8,     9,    -1,    11,    -1,    13,    22,    15,
-      16,    -1,    -1,    -1,     7,     8,     9,    -1,    11,    33,
-      13,    -1,    36,    37,    38,    39,    40,    41,    42,    22,
-      36,    37,    38,    39,    40,    41,    42,    -1,    -1,    -1,
-      -1,    -1,    -1,    36,    37,    38,    39,    40,    41,    42,
-       7,     8,     9,    -1,    11,    -1,    13,     7,     8,     9,
-      -1,    11,    -1,    13,     7,     8,     9,    38,    11,    -1,
-      13,    -1,    43,    44,    45,    46,    47,    -1,    -1,    36,
-      37,    38,    39,    40,    41,    42,    36,    -1,    38,    39,
-      40,    41,    42,    -1,    -1,    -1,    39,    40,    41,    42
+       1,    59,     6,     0,   144,    53,    47,    53,    56,    14,
+      19,    12,     6,    14,   121,     5,     6,     3,    19,    53,
+       6,    14,    56,    24,    13,    48,    49,    50,    29,    30,
+      24,    35,    41,    34,    35,    36,    37,    38,    47,     6,
+      49,    35,    31,    53,   122,    35,    47,   125,   155,    35,
+      12,   109,   192,    42,    43,    44,    45,    46,    99,   199,
+      53,   119,    56,   170,     6,    66,    67,    23,    35,    29,
+      71,    72,    42,    74,    75,    55,    77,    39,    79,    68,
+      54,    48,    24,    92,    37,    38,   164,    30,    97,    98,
+      99,    15,    16,    35,   103,     7,     8,     9,    99,    11,
+       3,     4,     5,     6,   105,   106,    33,    34,    10,    12,
+      54,    55,   121,   122,    10,   193,   125,    12,   107,    53,
+     129,    54,    41,    23,    27,    28,   204,    46,    47,    48,
+      49,    50,    35,    36,    35,   213,    39,    54,    55,   140,
+     141,   150,   151,   152,    47,    48,   155,   225,   157,    53,
+      53,    25,    26,   142,   129,   164,    54,   166,    10,   168,
+     169,   170,    46,    47,    48,    49,    50,     3,     4,     5,
+       6,   172,    10,    54,    56,   150,    12,    53,    56,    54,
+      41,   182,    54,    54,   193,    46,    47,    48,    49,    50,
+     191,   166,    28,   168,   169,   204,    55,    54,    16,    35,
+      36,    17,    21,    39,   213,    18,    18,    43,    44,    20,
+      19,    47,     3,     4,     5,     6,   225,    53,     3,     3,
+     221,    12,     3,     4,     5,     6,    20,    31,    54,    54,
+      22,    12,     3,     4,     5,     6,     3,    28,    55,    32,
+      55,    12,     3,    20,    35,    36,    27,    28,    39,    56,
+     100,    42,   163,    44,    35,    36,    47,    28,    39,   164,
+     176,   213,    53,   198,    35,    36,    47,    48,    39,   190,
+     225,    42,    53,   209,    -1,    -1,    47,     3,     4,     5,
+       6,    -1,    53,    -1,    -1,    -1,    12,     3,     4,     5,
+       6,    -1,     3,     4,     5,     6,    12,    -1,    -1,    -1,
+      -1,    12,    28,    -1,    -1,    -1,    -1,    -1,    -1,    35,
+      36,    -1,    28,    39,    -1,    -1,    -1,    28,    -1,    35,
+      36,    47,    48,    39,    35,    36,    -1,    53,     7,     8,
+       9,    47,    11,    -1,    13,    -1,    47,    53,    -1,    -1,
+      -1,    -1,    53,    -1,    -1,     7,     8,     9,    -1,    11,
+      -1,    13,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      39,    40,    41,    42,    43,    44,    45,     6,     7,     8,
+       9,    -1,    11,    -1,    13,    -1,    55,    39,    40,    41,
+      42,    43,    44,    45,    -1,    24,    -1,    -1,    -1,     7,
+       8,     9,    54,    11,    -1,    13,    35,    15,    16,    -1,
+      39,    40,    41,    42,    43,    44,    45,    -1,    -1,    -1,
+      -1,     7,     8,     9,    -1,    11,    -1,    13,    -1,    -1,
+      -1,    39,    40,    41,    42,    43,    44,    45,    24,     7,
+       8,     9,    -1,    11,    -1,    13,     7,     8,     9,    -1,
+      11,    -1,    13,    39,    40,    41,    42,    43,    44,    45,
+       7,     8,     9,    -1,    11,    -1,    13,    -1,    -1,    -1,
+      -1,    39,    40,    41,    42,    43,    44,    45,    39,    -1,
+      41,    42,    43,    44,    45,     7,     8,     9,    -1,    11,
+      -1,    13,    39,    -1,    -1,    42,    43,    44,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      42,    43,    44,    45
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
-       0,    34,    35,    55,     3,     4,     5,     6,    12,    26,
-      33,    36,    44,    50,    56,    58,    59,    60,    14,    50,
-      62,    63,     0,    50,    56,    60,    56,     7,     8,     9,
-      11,    13,    36,    37,    38,    39,    40,    41,    42,    50,
-      53,    43,    44,    45,    46,    47,    25,    45,    56,    58,
-      66,    70,    63,    27,    64,    65,    56,    51,    50,    56,
-      56,    60,    12,    36,     7,     8,     9,    11,    56,    56,
-      40,    41,    56,    39,    41,    56,    39,    56,    39,    56,
-      57,    58,    60,    60,    60,    60,    60,    66,    31,    32,
-      69,    22,    58,    71,    72,    50,    53,    21,    52,    51,
-      28,    62,    22,    57,    10,    10,    38,    12,    50,    56,
-      56,    60,    56,    56,    56,    56,    56,    56,    52,    51,
-      21,    50,    58,    33,    25,    45,    45,     5,    58,    80,
-      66,    64,    58,    61,    51,    56,    56,    60,    57,    10,
-      10,    38,    57,    80,    58,    59,    67,    68,    59,    51,
-      53,    53,    71,    15,    16,    74,    50,    51,    51,    56,
-      56,    60,    74,    52,    51,    51,    71,    58,    58,    16,
-      80,    17,    73,     3,    58,    73,    68,    71,    71,    71,
-      80,    18,    56,    19,    75,    51,    52,    51,    52,    75,
-      18,    56,    20,    29,    78,     3,     3,    78,    56,    74,
-      59,    76,    77,     3,    30,    79,    51,    51,    79,    74,
-      23,    24,    52,     3,    76
+       0,    37,    38,    58,     3,     4,     5,     6,    12,    28,
+      35,    36,    39,    47,    53,    59,    61,    62,    63,    14,
+      53,    65,    66,     0,    53,    59,    63,    59,     7,     8,
+       9,    11,    13,    39,    40,    41,    42,    43,    44,    45,
+      53,    56,    46,    47,    48,    49,    50,    27,    48,    59,
+      61,    69,    73,    66,    29,    67,    68,    59,    54,    53,
+      59,    59,    63,    12,    39,     7,     8,     9,    11,    59,
+      59,    43,    44,    59,    42,    44,    59,    42,    59,    42,
+      59,    60,    61,    63,    63,    63,    63,    63,    69,    33,
+      34,    72,    24,    61,    74,    75,    53,    56,    23,    55,
+      54,    30,    65,    24,    60,    10,    10,    41,    12,    53,
+      59,    59,    63,    59,    59,    59,    59,    59,    59,    55,
+      54,    23,    53,    61,    35,    27,    48,    48,     5,    61,
+      88,    69,    67,    61,    64,    54,    59,    59,    63,    60,
+      10,    10,    41,    60,    88,    61,    62,    70,    71,    62,
+      54,    56,    56,    74,    15,    16,    77,    53,    54,    54,
+      59,    59,    63,    77,    55,    54,    54,    74,    61,    61,
+      16,    88,    17,    76,     3,    61,    76,    71,    74,    74,
+      74,    88,    18,    59,    21,    78,    54,    55,    54,    55,
+      78,    18,    59,    20,    19,    83,     3,     3,    83,    59,
+      77,    62,    79,    80,    20,    31,    86,    54,    54,    86,
+      77,    22,    81,    55,    62,    84,    85,     3,    32,    87,
+      87,    82,    79,    25,    26,    55,     3,    59,    84
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    54,    55,    55,    55,    56,    56,    56,    56,    56,
-      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-      56,    56,    57,    57,    58,    58,    59,    59,    60,    60,
-      60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
-      60,    60,    61,    61,    61,    61,    61,    62,    62,    63,
-      63,    64,    64,    65,    66,    66,    67,    68,    68,    69,
-      69,    70,    70,    70,    70,    70,    70,    70,    70,    70,
-      71,    71,    72,    72,    73,    73,    74,    74,    74,    75,
-      75,    76,    76,    77,    77,    77,    78,    78,    79,    79,
-      80,    80,    80,    80,    80,    80
+       0,    57,    58,    58,    58,    59,    59,    59,    59,    59,
+      59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
+      59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
+      59,    59,    60,    60,    61,    61,    62,    62,    63,    63,
+      63,    63,    63,    63,    63,    63,    63,    63,    63,    63,
+      63,    63,    63,    64,    64,    64,    64,    64,    65,    65,
+      66,    66,    67,    67,    68,    69,    69,    70,    71,    71,
+      72,    72,    73,    73,    73,    73,    73,    73,    73,    73,
+      73,    74,    74,    75,    75,    76,    76,    77,    77,    77,
+      78,    78,    79,    79,    80,    81,    82,    81,    83,    83,
+      84,    84,    85,    85,    85,    86,    86,    87,    87,    88,
+      88,    88,    88,    88,    88
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -916,12 +940,13 @@ static const yytype_int8 yyr2[] =
        5,     6,     3,     4,     5,     6,     5,     6,     5,     6,
        3,     4,     3,     1,     1,     1,     1,     3,     1,     1,
        1,     1,     3,     1,     2,     3,     3,     3,     3,     3,
-       4,     6,     1,     4,     6,     4,     6,     2,     4,     9,
-      10,     0,     2,     2,     1,     3,     1,     1,     3,     1,
-       1,     1,     2,     5,     1,     3,     4,     5,     5,     6,
-       2,     1,     1,     2,     0,     2,     0,     5,     6,     0,
-       3,     3,     1,     1,     2,     2,     0,     2,     0,     2,
-       1,     2,     3,     4,     3,     4
+       4,     1,     6,     1,     4,     6,     4,     6,     2,     4,
+      10,    11,     0,     2,     2,     1,     3,     1,     1,     3,
+       1,     1,     1,     2,     5,     1,     3,     4,     5,     5,
+       6,     2,     1,     1,     2,     0,     2,     0,     5,     6,
+       0,     4,     3,     1,     1,     0,     0,     3,     0,     3,
+       3,     1,     1,     2,     2,     0,     2,     0,     2,     1,
+       2,     3,     4,     3,     4
 };
 
 
@@ -2176,7 +2201,22 @@ yyreduce:
         }
     break;
 
-  case 51: /* value_expr_non_logical: "CAST" '(' value_expr "AS" type_def ')'  */
+  case 51: /* value_expr_non_logical: "COUNT(*)"  */
+        {
+            // COUNT(*) in the HAVING clause, which is evaluated on the
+            // aggregated rows.
+            swq_expr_node *poNode = new swq_expr_node();
+            poNode->eNodeType = SNT_COLUMN;
+            poNode->string_value = CPLStrdup( "*" );
+            poNode->table_index = -1;
+            poNode->field_index = -1;
+
+            yyval = new swq_expr_node( SWQ_COUNT );
+            yyval->PushSubExpression( poNode );
+        }
+    break;
+
+  case 52: /* value_expr_non_logical: "CAST" '(' value_expr "AS" type_def ')'  */
         {
             yyval = yyvsp[-1];
             yyval->PushSubExpression( yyvsp[-3] );
@@ -2184,14 +2224,14 @@ yyreduce:
         }
     break;
 
-  case 52: /* type_def: identifier  */
+  case 53: /* type_def: identifier  */
     {
         yyval = new swq_expr_node( SWQ_CAST );
         yyval->PushSubExpression( yyvsp[0] );
     }
     break;
 
-  case 53: /* type_def: identifier '(' "integer number" ')'  */
+  case 54: /* type_def: identifier '(' "integer number" ')'  */
     {
         yyval = new swq_expr_node( SWQ_CAST );
         yyval->PushSubExpression( yyvsp[-1] );
@@ -2199,7 +2239,7 @@ yyreduce:
     }
     break;
 
-  case 54: /* type_def: identifier '(' "integer number" ',' "integer number" ')'  */
+  case 55: /* type_def: identifier '(' "integer number" ',' "integer number" ')'  */
     {
         yyval = new swq_expr_node( SWQ_CAST );
         yyval->PushSubExpression( yyvsp[-1] );
@@ -2208,7 +2248,7 @@ yyreduce:
     }
     break;
 
-  case 55: /* type_def: identifier '(' identifier ')'  */
+  case 56: /* type_def: identifier '(' identifier ')'  */
     {
         OGRwkbGeometryType eType = OGRFromOGCGeomType(yyvsp[-1]->string_value);
         if( !EQUAL(yyvsp[-3]->string_value, "GEOMETRY") ||
@@ -2226,7 +2266,7 @@ yyreduce:
     }
     break;
 
-  case 56: /* type_def: identifier '(' identifier ',' "integer number" ')'  */
+  case 57: /* type_def: identifier '(' identifier ',' "integer number" ')'  */
     {
         OGRwkbGeometryType eType = OGRFromOGCGeomType(yyvsp[-3]->string_value);
         if( !EQUAL(yyvsp[-5]->string_value, "GEOMETRY") ||
@@ -2246,20 +2286,20 @@ yyreduce:
     }
     break;
 
-  case 59: /* select_core: "SELECT" select_field_list "FROM" table_def opt_joins opt_where opt_order_by opt_limit opt_offset  */
+  case 60: /* select_core: "SELECT" select_field_list "FROM" table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset  */
     {
-        delete yyvsp[-5];
+        delete yyvsp[-6];
     }
     break;
 
-  case 60: /* select_core: "SELECT" "DISTINCT" select_field_list "FROM" table_def opt_joins opt_where opt_order_by opt_limit opt_offset  */
+  case 61: /* select_core: "SELECT" "DISTINCT" select_field_list "FROM" table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset  */
     {
         context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
-        delete yyvsp[-5];
+        delete yyvsp[-6];
     }
     break;
 
-  case 63: /* union_all: "UNION" "ALL"  */
+  case 64: /* union_all: "UNION" "ALL"  */
     {
         swq_select* poNewSelect = new swq_select();
         context->poCurSelect->PushUnionAll(poNewSelect);
@@ -2267,7 +2307,7 @@ yyreduce:
     }
     break;
 
-  case 66: /* exclude_field: field_value  */
+  case 67: /* exclude_field: field_value  */
         {
             if ( !context->poCurSelect->PushExcludeField( yyvsp[0] ) )
             {
@@ -2277,7 +2317,7 @@ yyreduce:
         }
     break;
 
-  case 71: /* column_spec: value_expr  */
+  case 72: /* column_spec: value_expr  */
         {
             if( !context->poCurSelect->PushField( yyvsp[0], nullptr, false, false ) )
             {
@@ -2287,7 +2327,7 @@ yyreduce:
         }
     break;
 
-  case 72: /* column_spec: value_expr as_clause_with_hidden  */
+  case 73: /* column_spec: value_expr as_clause_with_hidden  */
         {
             if( !context->poCurSelect->PushField( yyvsp[-1], yyvsp[0]->string_value, false, yyvsp[0]->bHidden ) )
             {
@@ -2299,7 +2339,7 @@ yyreduce:
         }
     break;
 
-  case 73: /* column_spec: '*' except_or_exclude '(' exclude_field_list ')'  */
+  case 74: /* column_spec: '*' except_or_exclude '(' exclude_field_list ')'  */
         {
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
@@ -2315,7 +2355,7 @@ yyreduce:
         }
     break;
 
-  case 74: /* column_spec: '*'  */
+  case 75: /* column_spec: '*'  */
         {
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
@@ -2331,7 +2371,7 @@ yyreduce:
         }
     break;
 
-  case 75: /* column_spec: identifier '.' '*'  */
+  case 76: /* column_spec: identifier '.' '*'  */
         {
             CPLString osTableName = yyvsp[-2]->string_value;
 
@@ -2353,7 +2393,7 @@ yyreduce:
         }
     break;
 
-  case 76: /* column_spec: identifier '(' '*' ')'  */
+  case 77: /* column_spec: identifier '(' '*' ')'  */
         {
                 // special case for COUNT(*), confirm it.
             if( !EQUAL(yyvsp[-3]->string_value, "COUNT") )
@@ -2385,7 +2425,7 @@ yyreduce:
         }
     break;
 
-  case 77: /* column_spec: identifier '(' '*' ')' as_clause  */
+  case 78: /* column_spec: identifier '(' '*' ')' as_clause  */
         {
                 // special case for COUNT(*), confirm it.
             if( !EQUAL(yyvsp[-4]->string_value, "COUNT") )
@@ -2421,7 +2461,7 @@ yyreduce:
         }
     break;
 
-  case 78: /* column_spec: identifier '(' "DISTINCT" field_value ')'  */
+  case 79: /* column_spec: identifier '(' "DISTINCT" field_value ')'  */
         {
                 // special case for COUNT(DISTINCT x), confirm it.
             if( !EQUAL(yyvsp[-4]->string_value, "COUNT") )
@@ -2447,7 +2487,7 @@ yyreduce:
         }
     break;
 
-  case 79: /* column_spec: identifier '(' "DISTINCT" field_value ')' as_clause  */
+  case 80: /* column_spec: identifier '(' "DISTINCT" field_value ')' as_clause  */
         {
             // special case for COUNT(DISTINCT x), confirm it.
             if( !EQUAL(yyvsp[-5]->string_value, "COUNT") )
@@ -2476,14 +2516,14 @@ yyreduce:
         }
     break;
 
-  case 80: /* as_clause: "AS" identifier  */
+  case 81: /* as_clause: "AS" identifier  */
         {
             yyval = yyvsp[0];
             yyvsp[0] = nullptr;
         }
     break;
 
-  case 83: /* as_clause_with_hidden: as_clause "HIDDEN"  */
+  case 84: /* as_clause_with_hidden: as_clause "HIDDEN"  */
         {
             yyval = yyvsp[-1];
             yyvsp[-1] = nullptr;
@@ -2493,13 +2533,13 @@ yyreduce:
         }
     break;
 
-  case 85: /* opt_where: "WHERE" value_expr  */
+  case 86: /* opt_where: "WHERE" value_expr  */
         {
             context->poCurSelect->where_expr = yyvsp[0];
         }
     break;
 
-  case 87: /* opt_joins: "JOIN" table_def "ON" value_expr opt_joins  */
+  case 88: /* opt_joins: "JOIN" table_def "ON" value_expr opt_joins  */
         {
             context->poCurSelect->PushJoin( static_cast<int>(yyvsp[-3]->int_value),
                                             yyvsp[-1] );
@@ -2507,7 +2547,7 @@ yyreduce:
         }
     break;
 
-  case 88: /* opt_joins: "LEFT" "JOIN" table_def "ON" value_expr opt_joins  */
+  case 89: /* opt_joins: "LEFT" "JOIN" table_def "ON" value_expr opt_joins  */
         {
             context->poCurSelect->PushJoin( static_cast<int>(yyvsp[-3]->int_value),
                                             yyvsp[-1] );
@@ -2515,7 +2555,28 @@ yyreduce:
         }
     break;
 
-  case 93: /* sort_spec: field_value  */
+  case 94: /* group_by_spec: field_value  */
+        {
+            context->poCurSelect->PushGroupBy( yyvsp[0]->table_name, yyvsp[0]->string_value );
+            delete yyvsp[0];
+            yyvsp[0] = nullptr;
+        }
+    break;
+
+  case 96: /* $@1: %empty  */
+        {
+            context->bInHaving = TRUE;
+        }
+    break;
+
+  case 97: /* opt_having: "HAVING" $@1 value_expr  */
+        {
+            context->bInHaving = FALSE;
+            context->poCurSelect->having_expr = yyvsp[0];
+        }
+    break;
+
+  case 102: /* sort_spec: field_value  */
         {
             context->poCurSelect->PushOrderBy( yyvsp[0]->table_name, yyvsp[0]->string_value, TRUE );
             delete yyvsp[0];
@@ -2523,7 +2584,7 @@ yyreduce:
         }
     break;
 
-  case 94: /* sort_spec: field_value "ASC"  */
+  case 103: /* sort_spec: field_value "ASC"  */
         {
             context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, TRUE );
             delete yyvsp[-1];
@@ -2531,7 +2592,7 @@ yyreduce:
         }
     break;
 
-  case 95: /* sort_spec: field_value "DESC"  */
+  case 104: /* sort_spec: field_value "DESC"  */
         {
             context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, FALSE );
             delete yyvsp[-1];
@@ -2539,7 +2600,7 @@ yyreduce:
         }
     break;
 
-  case 97: /* opt_limit: "LIMIT" "integer number"  */
+  case 106: /* opt_limit: "LIMIT" "integer number"  */
     {
         context->poCurSelect->SetLimit( yyvsp[0]->int_value );
         delete yyvsp[0];
@@ -2547,7 +2608,7 @@ yyreduce:
     }
     break;
 
-  case 99: /* opt_offset: "OFFSET" "integer number"  */
+  case 108: /* opt_offset: "OFFSET" "integer number"  */
     {
         context->poCurSelect->SetOffset( yyvsp[0]->int_value );
         delete yyvsp[0];
@@ -2555,7 +2616,7 @@ yyreduce:
     }
     break;
 
-  case 100: /* table_def: identifier  */
+  case 109: /* table_def: identifier  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( nullptr, yyvsp[0]->string_value,
@@ -2566,7 +2627,7 @@ yyreduce:
     }
     break;
 
-  case 101: /* table_def: identifier as_clause  */
+  case 110: /* table_def: identifier as_clause  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( nullptr, yyvsp[-1]->string_value,
@@ -2578,7 +2639,7 @@ yyreduce:
     }
     break;
 
-  case 102: /* table_def: "string" '.' identifier  */
+  case 111: /* table_def: "string" '.' identifier  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
@@ -2590,7 +2651,7 @@ yyreduce:
     }
     break;
 
-  case 103: /* table_def: "string" '.' identifier as_clause  */
+  case 112: /* table_def: "string" '.' identifier as_clause  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
@@ -2604,7 +2665,7 @@ yyreduce:
     }
     break;
 
-  case 104: /* table_def: identifier '.' identifier  */
+  case 113: /* table_def: identifier '.' identifier  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
@@ -2616,7 +2677,7 @@ yyreduce:
     }
     break;
 
-  case 105: /* table_def: identifier '.' identifier as_clause  */
+  case 114: /* table_def: identifier '.' identifier as_clause  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
@@ -72,26 +72,29 @@ extern int swqdebug;
     SWQT_ON = 273,                 /* "ON"  */
     SWQT_ORDER = 274,              /* "ORDER"  */
     SWQT_BY = 275,                 /* "BY"  */
-    SWQT_FROM = 276,               /* "FROM"  */
-    SWQT_AS = 277,                 /* "AS"  */
-    SWQT_ASC = 278,                /* "ASC"  */
-    SWQT_DESC = 279,               /* "DESC"  */
-    SWQT_DISTINCT = 280,           /* "DISTINCT"  */
-    SWQT_CAST = 281,               /* "CAST"  */
-    SWQT_UNION = 282,              /* "UNION"  */
-    SWQT_ALL = 283,                /* "ALL"  */
-    SWQT_LIMIT = 284,              /* "LIMIT"  */
-    SWQT_OFFSET = 285,             /* "OFFSET"  */
-    SWQT_EXCEPT = 286,             /* "EXCEPT"  */
-    SWQT_EXCLUDE = 287,            /* "EXCLUDE"  */
-    SWQT_HIDDEN = 288,             /* "HIDDEN"  */
-    SWQT_VALUE_START = 289,        /* SWQT_VALUE_START  */
-    SWQT_SELECT_START = 290,       /* SWQT_SELECT_START  */
-    SWQT_NOT = 291,                /* "NOT"  */
-    SWQT_OR = 292,                 /* "OR"  */
-    SWQT_AND = 293,                /* "AND"  */
-    SWQT_UMINUS = 294,             /* SWQT_UMINUS  */
-    SWQT_RESERVED_KEYWORD = 295    /* "reserved keyword"  */
+    SWQT_GROUP = 276,              /* "GROUP"  */
+    SWQT_HAVING = 277,             /* "HAVING"  */
+    SWQT_FROM = 278,               /* "FROM"  */
+    SWQT_AS = 279,                 /* "AS"  */
+    SWQT_ASC = 280,                /* "ASC"  */
+    SWQT_DESC = 281,               /* "DESC"  */
+    SWQT_DISTINCT = 282,           /* "DISTINCT"  */
+    SWQT_CAST = 283,               /* "CAST"  */
+    SWQT_UNION = 284,              /* "UNION"  */
+    SWQT_ALL = 285,                /* "ALL"  */
+    SWQT_LIMIT = 286,              /* "LIMIT"  */
+    SWQT_OFFSET = 287,             /* "OFFSET"  */
+    SWQT_EXCEPT = 288,             /* "EXCEPT"  */
+    SWQT_EXCLUDE = 289,            /* "EXCLUDE"  */
+    SWQT_HIDDEN = 290,             /* "HIDDEN"  */
+    SWQT_HAVING_COUNT_STAR = 291,  /* "COUNT(*)"  */
+    SWQT_VALUE_START = 292,        /* SWQT_VALUE_START  */
+    SWQT_SELECT_START = 293,       /* SWQT_SELECT_START  */
+    SWQT_NOT = 294,                /* "NOT"  */
+    SWQT_OR = 295,                 /* "OR"  */
+    SWQT_AND = 296,                /* "AND"  */
+    SWQT_UMINUS = 297,             /* SWQT_UMINUS  */
+    SWQT_RESERVED_KEYWORD = 298    /* "reserved keyword"  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
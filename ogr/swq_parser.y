@@ -79,6 +79,8 @@
 %token SWQT_ON                  "ON"
 %token SWQT_ORDER               "ORDER"
 %token SWQT_BY                  "BY"
+%token SWQT_GROUP               "GROUP"
+%token SWQT_HAVING              "HAVING"
 %token SWQT_FROM                "FROM"
 %token SWQT_AS                  "AS"
 %token SWQT_ASC                 "ASC"
@@ -92,6 +94,7 @@
 %token SWQT_EXCEPT              "EXCEPT"
 %token SWQT_EXCLUDE             "EXCLUDE"
 %token SWQT_HIDDEN              "HIDDEN"
+%token SWQT_HAVING_COUNT_STAR   "COUNT(*)"
 
 %token SWQT_VALUE_START
 %token SWQT_SELECT_START
@@ -551,6 +554,20 @@ value_expr_non_logical:
             }
         }
 
+    | SWQT_HAVING_COUNT_STAR
+        {
+            // COUNT(*) in the HAVING clause, which is evaluated on the
+            // aggregated rows.
+            swq_expr_node *poNode = new swq_expr_node();
+            poNode->eNodeType = SNT_COLUMN;
+            poNode->string_value = CPLStrdup( "*" );
+            poNode->table_index = -1;
+            poNode->field_index = -1;
+
+            $$ = new swq_expr_node( SWQ_COUNT );
+            $$->PushSubExpression( poNode );
+        }
+
     | SWQT_CAST '(' value_expr SWQT_AS type_def ')'
         {
             $$ = $5;
@@ -623,12 +640,12 @@ select_statement:
     | '(' select_core ')' opt_union_all
 
 select_core:
-    SWQT_SELECT select_field_list SWQT_FROM table_def opt_joins opt_where opt_order_by opt_limit opt_offset
+    SWQT_SELECT select_field_list SWQT_FROM table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset
     {
         delete $4;
     }
 
-    | SWQT_SELECT SWQT_DISTINCT select_field_list SWQT_FROM table_def opt_joins opt_where opt_order_by opt_limit opt_offset
+    | SWQT_SELECT SWQT_DISTINCT select_field_list SWQT_FROM table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset
     {
         context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
         delete $5;
@@ -898,6 +915,32 @@ opt_joins:
             delete $3;
         }
 
+opt_group_by:
+    | SWQT_GROUP SWQT_BY group_by_spec_list opt_having
+
+group_by_spec_list:
+    group_by_spec ',' group_by_spec_list
+    | group_by_spec
+
+group_by_spec:
+    field_value
+        {
+            context->poCurSelect->PushGroupBy( $1->table_name, $1->string_value );
+            delete $1;
+            $1 = nullptr;
+        }
+
+opt_having:
+    | SWQT_HAVING
+        {
+            context->bInHaving = TRUE;
+        }
+      value_expr
+        {
+            context->bInHaving = FALSE;
+            context->poCurSelect->having_expr = $3;
+        }
+
 opt_order_by:
     | SWQT_ORDER SWQT_BY sort_spec_list
 
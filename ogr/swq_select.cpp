@@ -100,6 +100,15 @@ swq_select::~swq_select()
 
     CPLFree(order_defs);
 
+    for (int i = 0; i < group_by_specs; i++)
+    {
+        CPLFree(group_by_defs[i].table_name);
+        CPLFree(group_by_defs[i].field_name);
+    }
+
+    CPLFree(group_by_defs);
+    delete having_expr;
+
     for (int i = 0; i < join_count; i++)
     {
         delete join_defs[i].poExpr;
@@ -286,6 +295,32 @@ char *swq_select::Unparse()
         CPLFree(pszTmp);
     }
 
+    if (group_by_specs > 0)
+    {
+        osSelect += " GROUP BY ";
+        for (int i = 0; i < group_by_specs; i++)
+        {
+            if (i > 0)
+                osSelect += ", ";
+            if (group_by_defs[i].table_name[0] != '\0')
+            {
+                osSelect += swq_expr_node::QuoteIfNecessary(
+                    group_by_defs[i].table_name, '"');
+                osSelect += ".";
+            }
+            osSelect += swq_expr_node::QuoteIfNecessary(
+                group_by_defs[i].field_name, '"');
+        }
+
+        if (having_expr != nullptr)
+        {
+            osSelect += " HAVING ";
+            char *pszTmp = having_expr->Unparse(nullptr, '"');
+            osSelect += pszTmp;
+            CPLFree(pszTmp);
+        }
+    }
+
     if (order_specs > 0)
     {
         osSelect += " ORDER BY ";
@@ -714,6 +749,25 @@ void swq_select::PushOrderBy(const char *pszTableName, const char *pszFieldName,
     order_defs[order_specs - 1].ascending_flag = bAscending;
 }
 
+/************************************************************************/
+/*                            PushGroupBy()                             */
+/************************************************************************/
+
+void swq_select::PushGroupBy(const char *pszTableName, const char *pszFieldName)
+
+{
+    group_by_specs++;
+    group_by_defs = static_cast<swq_group_by_def *>(
+        CPLRealloc(group_by_defs, sizeof(swq_group_by_def) * group_by_specs));
+
+    group_by_defs[group_by_specs - 1].table_name =
+        CPLStrdup(pszTableName ? pszTableName : "");
+    group_by_defs[group_by_specs - 1].field_name = CPLStrdup(pszFieldName);
+    group_by_defs[group_by_specs - 1].table_index = -1;
+    group_by_defs[group_by_specs - 1].field_index = -1;
+    group_by_defs[group_by_specs - 1].field_type = SWQ_OTHER;
+}
+
 /************************************************************************/
 /*                              PushJoin()                              */
 /************************************************************************/
@@ -1038,6 +1092,13 @@ CPLErr swq_select::parse(swq_field_list *field_list,
     /*      indications.                                                    */
     /* -------------------------------------------------------------------- */
 
+    if (group_by_specs > 0)
+    {
+        eError = ParseGroupBy(field_list);
+        if (eError != CE_None)
+            return eError;
+    }
+
     int bAllowDistinctOnMultipleFields =
         (poParseOptions && poParseOptions->bAllowDistinctOnMultipleFields);
     if (query_mode == SWQM_DISTINCT_LIST && result_columns() > 1 &&
@@ -1048,7 +1109,8 @@ CPLErr swq_select::parse(swq_field_list *field_list,
         return CE_Failure;
     }
 
-    for (int i = 0; i < result_columns(); i++)
+    // The result columns of GROUP BY queries are checked by ParseGroupBy().
+    for (int i = 0; query_mode != SWQM_GROUP_BY && i < result_columns(); i++)
     {
         swq_col_def *def = &column_defs[i];
         int this_indicator = -1;
@@ -1102,7 +1164,7 @@ CPLErr swq_select::parse(swq_field_list *field_list,
             query_mode = this_indicator;
     }
 
-    if (result_columns() == 0)
+    if (result_columns() == 0 && query_mode != SWQM_GROUP_BY)
     {
         query_mode = SWQM_RECORDSET;
     }
@@ -1159,6 +1221,15 @@ CPLErr swq_select::parse(swq_field_list *field_list,
                      def->field_name);
             return CE_Failure;
         }
+
+        if (query_mode == SWQM_GROUP_BY &&
+            !IsGroupByField(def->table_index, def->field_index))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Only GROUP BY fields can be used in the ORDER BY "
+                     "clause of a GROUP BY query");
+            return CE_Failure;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -1176,6 +1247,16 @@ CPLErr swq_select::parse(swq_field_list *field_list,
         return CE_Failure;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Post process the having clause.  It is checked later against    */
+    /*      the aggregated rows, since it may contain column functions.     */
+    /* -------------------------------------------------------------------- */
+    if (having_expr != nullptr &&
+        !ResolveHavingExpr(having_expr, field_list, false, true))
+    {
+        return CE_Failure;
+    }
+
     return CE_None;
 }
 
@@ -1219,4 +1300,287 @@ bool swq_select::IsFieldExcluded(int src_index, const char *pszTableName,
     return false;
 }
 
+/************************************************************************/
+/*                           IsGroupByField()                           */
+/************************************************************************/
+
+bool swq_select::IsGroupByField(int table_index, int field_index) const
+{
+    for (int i = 0; i < group_by_specs; i++)
+    {
+        if (group_by_defs[i].table_index == table_index &&
+            group_by_defs[i].field_index == field_index)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                            ParseGroupBy()                            */
+/*                                                                      */
+/*      Identify GROUP BY fields and check that the result columns      */
+/*      are either GROUP BY fields or column functions.                 */
+/************************************************************************/
+
+CPLErr swq_select::ParseGroupBy(swq_field_list *field_list)
+{
+    if (query_mode == SWQM_DISTINCT_LIST)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "SELECT DISTINCT not supported together with GROUP BY.");
+        return CE_Failure;
+    }
+
+    for (int i = 0; i < group_by_specs; i++)
+    {
+        swq_group_by_def *def = group_by_defs + i;
+
+        def->field_index =
+            swq_identify_field(def->table_name, def->field_name, field_list,
+                               &(def->field_type), &(def->table_index));
+        if (def->field_index == -1)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized field name %s in GROUP BY.",
+                     def->table_name[0]
+                         ? CPLSPrintf("%s.%s", def->table_name, def->field_name)
+                         : def->field_name);
+            return CE_Failure;
+        }
+
+        if (def->table_index != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use field '%s' of a secondary table in "
+                     "a GROUP BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+
+        if (def->field_type == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use geometry field '%s' in a GROUP BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+    }
+
+    for (int i = 0; i < result_columns(); i++)
+    {
+        swq_col_def *def = &column_defs[i];
+
+        if (def->col_func == SWQCF_MIN || def->col_func == SWQCF_MAX ||
+            def->col_func == SWQCF_AVG || def->col_func == SWQCF_SUM ||
+            def->col_func == SWQCF_COUNT)
+        {
+            if (def->distinct_flag)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "COUNT(DISTINCT ...) not supported together with "
+                         "GROUP BY.");
+                return CE_Failure;
+            }
+            if (def->field_index >= 0 && def->table_index != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot use field '%s' of a secondary table in "
+                         "a column function of a GROUP BY query",
+                         def->field_name);
+                return CE_Failure;
+            }
+            continue;
+        }
+
+        // Only plain GROUP BY fields, possibly CAST, may be selected.
+        int table_index = -1;
+        int field_index = -1;
+        if (def->col_func == SWQCF_NONE && def->expr != nullptr)
+        {
+            if (def->expr->eNodeType == SNT_COLUMN)
+            {
+                table_index = def->table_index;
+                field_index = def->field_index;
+            }
+            else if (def->expr->eNodeType == SNT_OPERATION &&
+                     def->expr->nOperation == SWQ_CAST &&
+                     def->expr->papoSubExpr[0]->eNodeType == SNT_COLUMN)
+            {
+                table_index = def->expr->papoSubExpr[0]->table_index;
+                field_index = def->expr->papoSubExpr[0]->field_index;
+            }
+        }
+        if (field_index < 0 || !IsGroupByField(table_index, field_index))
+        {
+            const char *pszName =
+                def->field_alias ? def->field_alias : def->field_name;
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Column '%s' must appear in the GROUP BY clause or be "
+                     "used in a column function.",
+                     pszName);
+            return CE_Failure;
+        }
+    }
+
+    query_mode = SWQM_GROUP_BY;
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                         ResolveHavingExpr()                          */
+/*                                                                      */
+/*      Identify the fields referenced by the HAVING clause.  They      */
+/*      must be arguments of column functions or GROUP BY fields.       */
+/*      References to result column aliases are replaced by the         */
+/*      expression of the column.                                       */
+/************************************************************************/
+
+bool swq_select::ResolveHavingExpr(swq_expr_node *&poNode,
+                                   swq_field_list *field_list,
+                                   bool bInAggregate, bool bAllowAlias)
+{
+    if (poNode->eNodeType == SNT_CONSTANT)
+        return true;
+
+    if (poNode->eNodeType == SNT_OPERATION)
+    {
+        const bool bAggregate = poNode->nOperation >= SWQ_AVG &&
+                                poNode->nOperation <= SWQ_SUM;
+        if (bAggregate)
+        {
+            const swq_operation *poOp =
+                swq_op_registrar::GetOperator(poNode->nOperation);
+            if (bInAggregate)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Column Summary Function '%s' found in an "
+                         "inappropriate context.",
+                         poOp->pszName);
+                return false;
+            }
+            if (poNode->nSubExprCount != 1 ||
+                poNode->papoSubExpr[0]->eNodeType != SNT_COLUMN)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Argument of column Summary Function '%s' "
+                         "should be a column.",
+                         poOp->pszName);
+                return false;
+            }
+        }
+
+        for (int i = 0; i < poNode->nSubExprCount; i++)
+        {
+            if (!ResolveHavingExpr(poNode->papoSubExpr[i], field_list,
+                                   bAggregate, bAllowAlias))
+                return false;
+        }
+
+        if (bAggregate)
+        {
+            const swq_field_type eType = poNode->papoSubExpr[0]->field_type;
+            if (((poNode->nOperation == SWQ_MIN ||
+                  poNode->nOperation == SWQ_MAX ||
+                  poNode->nOperation == SWQ_AVG ||
+                  poNode->nOperation == SWQ_SUM) &&
+                 eType == SWQ_GEOMETRY) ||
+                ((poNode->nOperation == SWQ_AVG ||
+                  poNode->nOperation == SWQ_SUM) &&
+                 eType == SWQ_STRING))
+            {
+                const swq_operation *poOp =
+                    swq_op_registrar::GetOperator(poNode->nOperation);
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Use of field function %s() on %s field %s illegal.",
+                         poOp->pszName, SWQFieldTypeToString(eType),
+                         poNode->papoSubExpr[0]->string_value);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    CPLAssert(poNode->eNodeType == SNT_COLUMN);
+
+    // COUNT(*)
+    if (bInAggregate && poNode->table_name == nullptr &&
+        strcmp(poNode->string_value, "*") == 0)
+    {
+        poNode->table_index = 0;
+        poNode->field_index = -1;
+        return true;
+    }
+
+    swq_field_type eType = SWQ_OTHER;
+    int table_index = -1;
+    const int field_index =
+        swq_identify_field(poNode->table_name, poNode->string_value,
+                           field_list, &eType, &table_index);
+
+    if (!bInAggregate && bAllowAlias && poNode->table_name == nullptr &&
+        (field_index < 0 || !IsGroupByField(table_index, field_index)))
+    {
+        for (const auto &col : column_defs)
+        {
+            if (col.field_alias == nullptr || col.expr == nullptr ||
+                !EQUAL(col.field_alias, poNode->string_value))
+            {
+                continue;
+            }
+
+            swq_expr_node *poNewNode;
+            if (col.col_func != SWQCF_NONE)
+            {
+                poNewNode =
+                    new swq_expr_node(static_cast<swq_op>(col.col_func));
+                poNewNode->PushSubExpression(col.expr->Clone());
+            }
+            else
+            {
+                poNewNode = col.expr->Clone();
+            }
+            delete poNode;
+            poNode = poNewNode;
+            return ResolveHavingExpr(poNode, field_list, false, false);
+        }
+    }
+
+    if (field_index < 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unrecognized field name %s in HAVING clause.",
+                 poNode->table_name ? CPLSPrintf("%s.%s", poNode->table_name,
+                                                 poNode->string_value)
+                                    : poNode->string_value);
+        return false;
+    }
+
+    if (table_index != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot use field '%s' of a secondary table in "
+                 "a HAVING clause",
+                 poNode->string_value);
+        return false;
+    }
+
+    if (!bInAggregate && !IsGroupByField(table_index, field_index))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Column '%s' in HAVING clause must appear in the GROUP BY "
+                 "clause or be used in a column function.",
+                 poNode->string_value);
+        return false;
+    }
+
+    poNode->field_type = eType;
+    poNode->table_index = table_index;
+    poNode->field_index = field_index;
+
+    return true;
+}
+
 //! @endcond
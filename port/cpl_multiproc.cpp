@@ -2763,3 +2763,27 @@ int CPLGetCurrentProcessID()
 }
 
 #endif
+
+/************************************************************************/
+/*                         CPLParseNumThreads()                         */
+/************************************************************************/
+
+/**
+ * Returns the number of threads corresponding to the value of a NUM_THREADS
+ * option or configuration option.
+ *
+ * @param pszValue an integer, ALL_CPUS to use the number of CPUs, or NULL.
+ * @param nDefault number of threads returned when pszValue is NULL.
+ * @return a number of threads, clamped to [1, 128].
+ * @since GDAL 3.10
+ */
+
+int CPLParseNumThreads(const char *pszValue, int nDefault)
+{
+    constexpr int MAX_THREADS = 128;
+    int nThreads = nDefault;
+    if (pszValue)
+        nThreads =
+            EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    return std::max(1, std::min(MAX_THREADS, nThreads));
+}
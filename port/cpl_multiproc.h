@@ -108,6 +108,7 @@ void CPL_DLL CPLSleep(double dfWaitInSeconds);
 const char CPL_DLL *CPLGetThreadingModel(void);
 
 int CPL_DLL CPLGetNumCPUs(void);
+int CPL_DLL CPLParseNumThreads(const char *pszValue, int nDefault);
 
 typedef struct _CPLLock CPLLock;
 